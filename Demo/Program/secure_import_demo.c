@@ -0,0 +1,151 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/secure_import_demo: fast vs secure import
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Compares the time to import a large random matrix with the default fast
+// import (which trusts the input) and with GxB_SECURE_IMPORT (which checks
+// the input), for a range of thread counts.  The time for GxB_Matrix_fprint
+// with GxB_SILENT, which checks the matrix serially, is also reported.  The
+// matrix is moved in and out of GraphBLAS with GxB_Matrix_export_CSC and
+// GxB_Matrix_import_CSC, which take O(1) time, so that only the checks are
+// timed.
+
+// usage:
+// secure_import_demo [n [nvals [ntrials]]]
+
+#include "GraphBLAS.h"
+#undef I
+#include "simple_rand.h"
+#include "simple_rand.c"
+#ifdef _OPENMP
+#include <omp.h>
+#define TIMER omp_get_wtime ( )
+#else
+#define TIMER 0
+#endif
+
+#undef  OK
+#define OK(method)                                                      \
+{                                                                       \
+    GrB_Info info = (method) ;                                          \
+    if (info != GrB_SUCCESS)                                            \
+    {                                                                   \
+        printf ("abort at line: %d, info: %d\n", __LINE__, info) ;      \
+        abort ( ) ;                                                     \
+    }                                                                   \
+}
+
+int main (int argc, char **argv)
+{
+
+    //--------------------------------------------------------------------------
+    // get the problem size
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = (argc > 1) ? strtoull (argv [1], NULL, 0) : 1000000 ;
+    GrB_Index nvals = (argc > 2) ? strtoull (argv [2], NULL, 0) : 20000000 ;
+    int ntrials = (argc > 3) ? atoi (argv [3]) : 3 ;
+
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+    int nthreads_max = 0 ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads_max)) ;
+    printf ("secure import demo: n %" PRIu64 " nvals %" PRIu64 " threads: %d\n",
+        n, nvals, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // create a random matrix
+    //--------------------------------------------------------------------------
+
+    GrB_Index *I = (GrB_Index *) malloc (nvals * sizeof (GrB_Index)) ;
+    GrB_Index *J = (GrB_Index *) malloc (nvals * sizeof (GrB_Index)) ;
+    double    *X = (double    *) malloc (nvals * sizeof (double)) ;
+    if (I == NULL || J == NULL || X == NULL)
+    {
+        printf ("out of memory\n") ;
+        abort ( ) ;
+    }
+    simple_rand_seed (1) ;
+    for (GrB_Index k = 0 ; k < nvals ; k++)
+    {
+        I [k] = simple_rand ( ) % n ;
+        J [k] = simple_rand ( ) % n ;
+        X [k] = simple_rand_x ( ) ;
+    }
+    GrB_Matrix A = NULL ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_build_FP64 (A, I, J, X, nvals, GrB_PLUS_FP64)) ;
+    free (I) ;
+    free (J) ;
+    free (X) ;
+    OK (GrB_Matrix_set_INT32 (A, GxB_SPARSE, GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    printf ("nvals after removing duplicates: %" PRIu64 "\n", nvals) ;
+
+    GrB_Descriptor secure = NULL ;
+    OK (GrB_Descriptor_new (&secure)) ;
+    OK (GrB_Descriptor_set_INT32 (secure, GxB_SECURE_IMPORT, GxB_IMPORT)) ;
+
+    //--------------------------------------------------------------------------
+    // export and import the matrix, with fast and secure import
+    //--------------------------------------------------------------------------
+
+    GrB_Index *Ap, *Ai, Ap_size, Ai_size, Ax_size, nrows, ncols ;
+    void *Ax ;
+    bool iso, jumbled ;
+    GrB_Type type ;
+    OK (GxB_Matrix_export_CSC (&A, &type, &nrows, &ncols, &Ap, &Ai, &Ax,
+        &Ap_size, &Ai_size, &Ax_size, &iso, &jumbled, NULL)) ;
+
+    printf ("threads    fast import  secure import    serial check\n") ;
+    int nthreads = 1 ;
+    while (1)
+    {
+        OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads)) ;
+        double t_fast = 0, t_secure = 0, t_check = 0 ;
+        for (int trial = 0 ; trial < ntrials ; trial++)
+        {
+            // fast import: O(1) time
+            double t = TIMER ;
+            OK (GxB_Matrix_import_CSC (&A, type, nrows, ncols, &Ap, &Ai,
+                &Ax, Ap_size, Ai_size, Ax_size, iso, jumbled, NULL)) ;
+            t_fast += TIMER - t ;
+
+            // serial check of the matrix, with GB_matvec_check
+            t = TIMER ;
+            OK (GxB_Matrix_fprint (A, "A", GxB_SILENT, NULL)) ;
+            t_check += TIMER - t ;
+            OK (GxB_Matrix_export_CSC (&A, &type, &nrows, &ncols, &Ap, &Ai,
+                &Ax, &Ap_size, &Ai_size, &Ax_size, &iso, &jumbled, NULL)) ;
+
+            // secure import: checks the matrix in parallel
+            t = TIMER ;
+            OK (GxB_Matrix_import_CSC (&A, type, nrows, ncols, &Ap, &Ai,
+                &Ax, Ap_size, Ai_size, Ax_size, iso, jumbled, secure)) ;
+            t_secure += TIMER - t ;
+            OK (GxB_Matrix_export_CSC (&A, &type, &nrows, &ncols, &Ap, &Ai,
+                &Ax, &Ap_size, &Ai_size, &Ax_size, &iso, &jumbled, NULL)) ;
+        }
+        printf ("%4d %15.6f %14.6f %15.6f\n", nthreads, t_fast / ntrials,
+            t_secure / ntrials, t_check / ntrials) ;
+        if (nthreads >= nthreads_max) break ;
+        // double the # of threads, and end with nthreads_max
+        nthreads = (2*nthreads > nthreads_max) ? nthreads_max : (2*nthreads) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free the matrix and finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Matrix_import_CSC (&A, type, nrows, ncols, &Ap, &Ai, &Ax,
+        Ap_size, Ai_size, Ax_size, iso, jumbled, NULL)) ;
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Descriptor_free (&secure)) ;
+    OK (GrB_finalize ( )) ;
+    return (0) ;
+}
@@ -0,0 +1,470 @@
+//------------------------------------------------------------------------------
+// GB_AxB__bor_first_uint64.c: matrix multiply for a single semiring
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_control.h"
+#if defined (GxB_NO_UINT64)
+#define GB_TYPE_ENABLED 0
+#else
+#define GB_TYPE_ENABLED 1
+#endif
+
+#if GB_TYPE_ENABLED
+#include "GB.h"
+#include "mxm/GB_AxB_saxpy.h"
+#include "include/GB_unused.h"
+#include "assign/GB_bitmap_assign_methods.h"
+#include "FactoryKernels/GB_AxB__include2.h"
+
+// semiring operators:
+#define GB_MULTADD(z,a,b,i,k,j) { uint64_t x_op_y = a ; z |= x_op_y ; }
+#define GB_MULT(z,a,b,i,k,j)    z = a
+#define GB_ADD(z,zin,t)         z = (zin | t)
+#define GB_UPDATE(z,t)          z |= t
+// identity: 0
+
+// A matrix, typecast to A2 for multiplier input
+
+#define GB_A_TYPE uint64_t
+#define GB_A2TYPE uint64_t
+#define GB_DECLAREA(aik) uint64_t aik
+#define GB_GETA(aik,Ax,pA,A_iso) aik = Ax [(A_iso) ? 0 : (pA)]
+
+// B matrix, typecast to B2 for multiplier input
+#define GB_B_IS_PATTERN 1
+#define GB_B_TYPE void
+#define GB_B2TYPE void
+#define GB_DECLAREB(bkj)
+#define GB_GETB(bkj,Bx,pB,B_iso)
+#define GB_B_SIZE 0
+
+// C matrix
+#define GB_C_ISO 0
+#define GB_C_TYPE uint64_t
+#define GB_PUTC(cij,Cx,p) Cx [p] = cij
+
+// special case semirings:
+
+// monoid properties:
+#define GB_Z_TYPE uint64_t
+#define GB_DECLARE_IDENTITY(z) uint64_t z = 0
+#define GB_DECLARE_IDENTITY_CONST(z) const uint64_t z = 0
+#define GB_Z_NBITS 64
+#define GB_HAS_IDENTITY_BYTE 1
+#define GB_IDENTITY_BYTE 0
+#define GB_Z_ATOMIC_BITS 64
+
+#define GB_Z_HAS_ATOMIC_UPDATE 1
+#define GB_Z_HAS_OMP_ATOMIC_UPDATE (!GB_COMPILER_MSC)
+#define GB_Z_IGNORE_OVERFLOW 1
+
+#define GB_MONOID_IS_TERMINAL 1
+#define GB_TERMINAL_CONDITION(z,zterminal) (z == 0xFFFFFFFFFFFFFFFFL)
+#define GB_IF_TERMINAL_BREAK(z,zterminal) if (z == 0xFFFFFFFFFFFFFFFFL) { break ; }
+#define GB_DECLARE_TERMINAL_CONST(zterminal) const uint64_t zterminal = 0xFFFFFFFFFFFFFFFFL
+
+// special case multipliers:
+
+// disable this semiring and use the generic case if these conditions hold
+#if (defined(GxB_NO_BOR) || defined(GxB_NO_FIRST) || defined(GxB_NO_UINT64) || defined(GxB_NO_BOR_UINT64) || defined(GxB_NO_FIRST_UINT64) || defined(GxB_NO_BOR_FIRST_UINT64))
+#define GB_DISABLE 1
+#else
+#define GB_DISABLE 0
+#endif
+
+#include "mxm/include/GB_mxm_shared_definitions.h"
+
+//------------------------------------------------------------------------------
+// GB_Adot2B: C=A'*B, C<M>=A'*B, or C<!M>=A'*B: dot product method, C is bitmap
+//------------------------------------------------------------------------------
+
+// if A_not_transposed is true, then C=A*B is computed where A is bitmap or full
+
+GrB_Info GB (_Adot2B__bor_first_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M, const bool Mask_comp, const bool Mask_struct,
+    const bool A_not_transposed,
+    const GrB_Matrix A, int64_t *restrict A_slice,
+    const GrB_Matrix B, int64_t *restrict B_slice,
+    int nthreads, int naslice, int nbslice
+)
+{ 
+    #if GB_DISABLE
+    return (GrB_NO_VALUE) ;
+    #else
+    #include "mxm/template/GB_AxB_dot2_meta.c"
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_Adot3B: C<M>=A'*B: masked dot product, C is sparse or hyper
+//------------------------------------------------------------------------------
+
+GrB_Info GB (_Adot3B__bor_first_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M, const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GB_task_struct *restrict TaskList,
+    const int ntasks,
+    const int nthreads
+)
+{ 
+    #if GB_DISABLE
+    return (GrB_NO_VALUE) ;
+    #else
+    #include "mxm/template/GB_AxB_dot3_meta.c"
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_Adot4B:  C+=A'*B: dense dot product
+//------------------------------------------------------------------------------
+
+GrB_Info GB (_Adot4B__bor_first_uint64)
+(
+    GrB_Matrix C,
+    const bool C_in_iso,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict A_slice,
+    const int64_t *restrict B_slice,
+    const int naslice,
+    const int nbslice,
+    const int nthreads,
+    GB_Werk Werk
+)
+{ 
+    #if GB_DISABLE
+    return (GrB_NO_VALUE) ;
+    #else
+    #include "mxm/template/GB_AxB_dot4_meta.c"
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_AsaxbitB: C=A*B, C<M>=A*B, C<!M>=A*B: saxpy method, C is bitmap only
+//------------------------------------------------------------------------------
+
+#include "mxm/include/GB_AxB_saxpy3_template.h"
+
+GrB_Info GB (_AsaxbitB__bor_first_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_comp,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads,
+    const int nfine_tasks_per_vector,
+    const bool use_coarse_tasks,
+    const bool use_atomics,
+    const int64_t *restrict M_ek_slicing,
+    const int M_nthreads,
+    const int M_ntasks,
+    const int64_t *restrict A_slice,
+    const int64_t *restrict H_slice,
+    GB_void *restrict Wcx,
+    int8_t *restrict Wf
+)
+{ 
+    #if GB_DISABLE
+    return (GrB_NO_VALUE) ;
+    #else
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    #include "mxm/template/GB_AxB_saxbit_template.c"
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_Asaxpy4B: C += A*B when C is full
+//------------------------------------------------------------------------------
+
+GrB_Info GB (_Asaxpy4B__bor_first_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads,
+    const int nfine_tasks_per_vector,
+    const bool use_coarse_tasks,
+    const bool use_atomics,
+    const int64_t *A_slice,
+    const int64_t *H_slice,
+    GB_void *restrict Wcx,
+    int8_t *restrict Wf
+)
+{ 
+    #if GB_DISABLE
+    return (GrB_NO_VALUE) ;
+    #else
+    #include "mxm/template/GB_AxB_saxpy4_meta.c"
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_Asaxpy5B: C += A*B when C is full, A is bitmap/full, B is sparse/hyper
+//------------------------------------------------------------------------------
+
+    #if !GB_DISABLE && !GB_A_IS_PATTERN
+
+        //----------------------------------------------------------------------
+        // saxpy5 method unrolled, with no vectors
+        //----------------------------------------------------------------------
+
+        #undef  GB_V16
+        #undef  GB_V8
+        #undef  GB_V4
+
+        #define GB_V16 0
+        #define GB_V8  0
+        #define GB_V4  0
+
+        static inline void GB_AxB_saxpy5_unrolled_vanilla
+        (
+            GrB_Matrix C,
+            const GrB_Matrix A,
+            const GrB_Matrix B,
+            const int ntasks,
+            const int nthreads,
+            const int64_t *B_slice
+        )
+        {
+            #include "mxm/template/GB_AxB_saxpy5_unrolled.c"
+        }
+
+    #endif
+
+    GrB_Info GB (_Asaxpy5B__bor_first_uint64)
+    (
+        GrB_Matrix C,
+        const GrB_Matrix A,
+        const GrB_Matrix B,
+        const int ntasks,
+        const int nthreads,
+        const int64_t *B_slice
+    )
+    { 
+        #if GB_DISABLE
+        return (GrB_NO_VALUE) ;
+        #else
+        #include "mxm/factory/GB_AxB_saxpy5_meta.c"
+        return (GrB_SUCCESS) ;
+        #endif
+    }
+
+//------------------------------------------------------------------------------
+// GB_Asaxpy3B: C=A*B, C<M>=A*B, C<!M>=A*B: saxpy method (Gustavson + Hash)
+//------------------------------------------------------------------------------
+
+GrB_Info GB (_Asaxpy3B__bor_first_uint64)
+(
+    GrB_Matrix C,   // C<any M>=A*B, C sparse or hypersparse
+    const GrB_Matrix M, const bool Mask_comp, const bool Mask_struct,
+    const bool M_in_place,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_saxpy3task_struct *restrict SaxpyTasks,
+    const int ntasks, const int nfine, const int nthreads, const int do_sort,
+    GB_Werk Werk
+)
+{ 
+    #if GB_DISABLE
+    return (GrB_NO_VALUE) ;
+    #else
+    ASSERT (GB_IS_SPARSE (C) || GB_IS_HYPERSPARSE (C)) ;
+    if (M == NULL)
+    {
+        // C = A*B, no mask
+        return (GB (_Asaxpy3B_noM__bor_first_uint64) (C, A, B,
+            SaxpyTasks, ntasks, nfine, nthreads, do_sort, Werk)) ;
+    }
+    else if (!Mask_comp)
+    {
+        // C<M> = A*B
+        return (GB (_Asaxpy3B_M__bor_first_uint64) (C,
+            M, Mask_struct, M_in_place, A, B,
+            SaxpyTasks, ntasks, nfine, nthreads, do_sort, Werk)) ;
+    }
+    else
+    {
+        // C<!M> = A*B
+        return (GB (_Asaxpy3B_notM__bor_first_uint64) (C,
+            M, Mask_struct, M_in_place, A, B,
+            SaxpyTasks, ntasks, nfine, nthreads, do_sort, Werk)) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_Asaxpy3B_M: C<M>=A*B: saxpy method (Gustavson + Hash)
+//------------------------------------------------------------------------------
+
+#if ( !GB_DISABLE )
+
+    GrB_Info GB (_Asaxpy3B_M__bor_first_uint64)
+    (
+        GrB_Matrix C,   // C<M>=A*B, C sparse or hypersparse
+        const GrB_Matrix M, const bool Mask_struct,
+        const bool M_in_place,
+        const GrB_Matrix A,
+        const GrB_Matrix B,
+        GB_saxpy3task_struct *restrict SaxpyTasks,
+        const int ntasks, const int nfine, const int nthreads,
+        const int do_sort,
+        GB_Werk Werk
+    )
+    {
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        double chunk = GB_Context_chunk ( ) ;
+        if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
+        {
+            // both A and B are sparse
+            #define GB_META16
+            #define GB_NO_MASK 0
+            #define GB_MASK_COMP 0
+            #define GB_A_IS_SPARSE 1
+            #define GB_A_IS_HYPER  0
+            #define GB_A_IS_BITMAP 0
+            #define GB_A_IS_FULL   0
+            #define GB_B_IS_SPARSE 1
+            #define GB_B_IS_HYPER  0
+            #define GB_B_IS_BITMAP 0
+            #define GB_B_IS_FULL   0
+            #include "mxm/include/GB_meta16_definitions.h"
+            #include "mxm/template/GB_AxB_saxpy3_template.c"
+        }
+        else
+        {
+            // general case
+            #undef GB_META16
+            #define GB_NO_MASK 0
+            #define GB_MASK_COMP 0
+            #include "mxm/include/GB_meta16_definitions.h"
+            #include "mxm/template/GB_AxB_saxpy3_template.c"
+        }
+        return (GrB_SUCCESS) ;
+    }
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_Asaxpy3B_noM: C=A*B: saxpy method (Gustavson + Hash)
+//------------------------------------------------------------------------------
+
+#if ( !GB_DISABLE )
+
+    GrB_Info GB (_Asaxpy3B_noM__bor_first_uint64)
+    (
+        GrB_Matrix C,   // C=A*B, C sparse or hypersparse
+        const GrB_Matrix A,
+        const GrB_Matrix B,
+        GB_saxpy3task_struct *restrict SaxpyTasks,
+        const int ntasks, const int nfine, const int nthreads,
+        const int do_sort,
+        GB_Werk Werk
+    )
+    {
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        double chunk = GB_Context_chunk ( ) ;
+        if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
+        {
+            // both A and B are sparse
+            #define GB_META16
+            #define GB_NO_MASK 1
+            #define GB_MASK_COMP 0
+            #define GB_A_IS_SPARSE 1
+            #define GB_A_IS_HYPER  0
+            #define GB_A_IS_BITMAP 0
+            #define GB_A_IS_FULL   0
+            #define GB_B_IS_SPARSE 1
+            #define GB_B_IS_HYPER  0
+            #define GB_B_IS_BITMAP 0
+            #define GB_B_IS_FULL   0
+            #include "mxm/include/GB_meta16_definitions.h"
+            #include "mxm/template/GB_AxB_saxpy3_template.c"
+        }
+        else
+        {
+            // general case
+            #undef GB_META16
+            #define GB_NO_MASK 1
+            #define GB_MASK_COMP 0
+            #include "mxm/include/GB_meta16_definitions.h"
+            #include "mxm/template/GB_AxB_saxpy3_template.c"
+        }
+        return (GrB_SUCCESS) ;
+    }
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_Asaxpy3B_notM: C<!M>=A*B: saxpy method (Gustavson + Hash)
+//------------------------------------------------------------------------------
+
+#if ( !GB_DISABLE )
+
+    GrB_Info GB (_Asaxpy3B_notM__bor_first_uint64)
+    (
+        GrB_Matrix C,   // C<!M>=A*B, C sparse or hypersparse
+        const GrB_Matrix M, const bool Mask_struct,
+        const bool M_in_place,
+        const GrB_Matrix A,
+        const GrB_Matrix B,
+        GB_saxpy3task_struct *restrict SaxpyTasks,
+        const int ntasks, const int nfine, const int nthreads,
+        const int do_sort,
+        GB_Werk Werk
+    )
+    {
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        double chunk = GB_Context_chunk ( ) ;
+        if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
+        {
+            // both A and B are sparse
+            #define GB_META16
+            #define GB_NO_MASK 0
+            #define GB_MASK_COMP 1
+            #define GB_A_IS_SPARSE 1
+            #define GB_A_IS_HYPER  0
+            #define GB_A_IS_BITMAP 0
+            #define GB_A_IS_FULL   0
+            #define GB_B_IS_SPARSE 1
+            #define GB_B_IS_HYPER  0
+            #define GB_B_IS_BITMAP 0
+            #define GB_B_IS_FULL   0
+            #include "mxm/include/GB_meta16_definitions.h"
+            #include "mxm/template/GB_AxB_saxpy3_template.c"
+        }
+        else
+        {
+            // general case
+            #undef GB_META16
+            #define GB_NO_MASK 0
+            #define GB_MASK_COMP 1
+            #include "mxm/include/GB_meta16_definitions.h"
+            #include "mxm/template/GB_AxB_saxpy3_template.c"
+        }
+        return (GrB_SUCCESS) ;
+    }
+
+#endif
+
+#endif
+
@@ -14,6 +14,8 @@
 #define GB_apply GM_apply
 #define GB_apply_op GM_apply_op
 #define GB_apply_unop_jit GM_apply_unop_jit
+#define GB_arrow_export GM_arrow_export
+#define GB_arrow_import GM_arrow_import
 #define GB_assign_burble GM_assign_burble
 #define GB_assign_describe GM_assign_describe
 #define GB_assign GM_assign
@@ -33,6 +35,8 @@
 #define GB_AxB_dot3_one_slice GM_AxB_dot3_one_slice
 #define GB_AxB_dot3_slice GM_AxB_dot3_slice
 #define GB_AxB_dot4 GM_AxB_dot4
+#define GB_AxB_dot3_reduce GM_AxB_dot3_reduce
+#define GB_AxB_dot3_reduce_jit GM_AxB_dot3_reduce_jit
 #define GB_AxB_dot4_jit GM_AxB_dot4_jit
 #define GB_AxB_dot GM_AxB_dot
 #define GB_AxB_iso GM_AxB_iso
@@ -104,10 +108,18 @@
 #define GB_AxB_saxpy4_tasks GM_AxB_saxpy4_tasks
 #define GB_AxB_saxpy5 GM_AxB_saxpy5
 #define GB_AxB_saxpy5_jit GM_AxB_saxpy5_jit
+#define GB_AxB_saxpy6 GM_AxB_saxpy6
 #define GB_AxB_saxpy_generic GM_AxB_saxpy_generic
 #define GB_AxB_saxpy GM_AxB_saxpy
 #define GB_AxB_saxpy_sparsity GM_AxB_saxpy_sparsity
 #define GB_AxB_semiring_builtin GM_AxB_semiring_builtin
+#define GB_AxB_tune_calibrate GM_AxB_tune_calibrate
+#define GB_AxB_tune_choose GM_AxB_tune_choose
+#define GB_AxB_tune_class GM_AxB_tune_class
+#define GB_AxB_tune_clear GM_AxB_tune_clear
+#define GB_AxB_tune_dot2_ratio GM_AxB_tune_dot2_ratio
+#define GB_AxB_tune_record GM_AxB_tune_record
+#define GB_AxB_tune_set GM_AxB_tune_set
 #define GB_BinaryOp_check GM_BinaryOp_check
 #define GB_BinaryOp_compatible GM_BinaryOp_compatible
 #define GB_binop_builtin GM_binop_builtin
@@ -244,7 +256,13 @@
 #define GB_Context_nthreads_max_get GM_Context_nthreads_max_get
 #define GB_Context_nthreads_max GM_Context_nthreads_max
 #define GB_Context_nthreads_max_set GM_Context_nthreads_max_set
+#define GB_Context_saxpy3_workspace_free GM_Context_saxpy3_workspace_free
+#define GB_Context_saxpy3_workspace_give GM_Context_saxpy3_workspace_give
+#define GB_Context_saxpy3_workspace_take GM_Context_saxpy3_workspace_take
 #define GB_CONTEXT_THREAD GM_CONTEXT_THREAD
+#define GB_Context_workspace_max_get GM_Context_workspace_max_get
+#define GB_Context_workspace_max GM_Context_workspace_max
+#define GB_Context_workspace_max_set GM_Context_workspace_max_set
 #define GB_convert_any_to_bitmap GM_convert_any_to_bitmap
 #define GB_convert_any_to_full GM_convert_any_to_full
 #define GB_convert_any_to_hyper GM_convert_any_to_hyper
@@ -273,17 +291,26 @@
 #define GB_ctruncf GM_ctruncf
 #define GB_ctrunc GM_ctrunc
 #define GB_cumsum GM_cumsum
+#define GB_delta_get GM_delta_get
+#define GB_delta_hash GM_delta_hash
+#define GB_delta_splice GM_delta_splice
 #define GB_demacrofy_name GM_demacrofy_name
 #define GB_desc_name_get GM_desc_name_get
 #define GB_Descriptor_check GM_Descriptor_check
 #define GB_Descriptor_get GM_Descriptor_get
+#define GB_deserialize_delta GM_deserialize_delta
 #define GB_deserialize_from_blob GM_deserialize_from_blob
 #define GB_deserialize GM_deserialize
+#define GB_deserialize_range GM_deserialize_range
+#define GB_deserialize_stream GM_deserialize_stream
+#define GB_deserialize_unfilter GM_deserialize_unfilter
 #define GB_dup GM_dup
 #define GB_dup_worker GM_dup_worker
+#define GB_edges_read GM_edges_read
 #define GB_ek_slice GM_ek_slice
 #define GB_ek_slice_merge1 GM_ek_slice_merge1
 #define GB_ek_slice_merge2 GM_ek_slice_merge2
+#define GB_Element_lookup GM_Element_lookup
 #define GB_emult_02 GM_emult_02
 #define GB_emult_02_jit GM_emult_02_jit
 #define GB_emult_02_phase1 GM_emult_02_phase1
@@ -339,6 +366,7 @@
 #define GB_ewise GM_ewise
 #define GB_ewise_slice GM_ewise_slice
 #define GB_export GM_export
+#define GB_extractElements GM_extractElements
 #define GB_extract GM_extract
 #define GB_extractTuples GM_extractTuples
 #define GB_extract_vector_list GM_extract_vector_list
@@ -351,6 +379,8 @@
 #define GB_file_dlopen GM_file_dlopen
 #define GB_file_dlsym GM_file_dlsym
 #define GB_file_mkdir GM_file_mkdir
+#define GB_file_mmap GM_file_mmap
+#define GB_file_munmap GM_file_munmap
 #define GB_file_open_and_lock GM_file_open_and_lock
 #define GB_file_unlock_and_close GM_file_unlock_and_close
 #define GB_flip_binop GM_flip_binop
@@ -376,6 +406,14 @@
 #define GB_FSE_writeNCount GM_FSE_writeNCount
 #define GB_Global_abort GM_Global_abort
 #define GB_Global_abort_set GM_Global_abort_set
+#define GB_Global_axb_calibrated_get GM_Global_axb_calibrated_get
+#define GB_Global_axb_calibrated_set GM_Global_axb_calibrated_set
+#define GB_Global_axb_dot2_ratio_get GM_Global_axb_dot2_ratio_get
+#define GB_Global_axb_dot2_ratio_set GM_Global_axb_dot2_ratio_set
+#define GB_Global_axb_tune_get GM_Global_axb_tune_get
+#define GB_Global_axb_tune_set GM_Global_axb_tune_set
+#define GB_Global_background_wait_get GM_Global_background_wait_get
+#define GB_Global_background_wait_set GM_Global_background_wait_set
 #define GB_Global_bitmap_switch_default GM_Global_bitmap_switch_default
 #define GB_Global_bitmap_switch_get GM_Global_bitmap_switch_get
 #define GB_Global_bitmap_switch_matrix_get GM_Global_bitmap_switch_matrix_get
@@ -435,6 +473,8 @@
 #define GB_Global_mode_set GM_Global_mode_set
 #define GB_Global_nmalloc_clear GM_Global_nmalloc_clear
 #define GB_Global_nmalloc_get GM_Global_nmalloc_get
+#define GB_Global_pending_combine_get GM_Global_pending_combine_get
+#define GB_Global_pending_combine_set GM_Global_pending_combine_set
 #define GB_Global_persistent_free GM_Global_persistent_free
 #define GB_Global_persistent_malloc GM_Global_persistent_malloc
 #define GB_Global_persistent_set GM_Global_persistent_set
@@ -511,10 +551,17 @@
 #define GB_ijlength GM_ijlength
 #define GB_ijproperties GM_ijproperties
 #define GB_ijsort GM_ijsort
+#define GB_import_borrowed GM_import_borrowed
+#define GB_import_check GM_import_check
 #define GB_import GM_import
 #define GB_IndexBinaryOp_check GM_IndexBinaryOp_check
 #define GB_IndexUnaryOp_check GM_IndexUnaryOp_check
+#define GB_Ingest_flush GM_Ingest_flush
+#define GB_Ingest_free GM_Ingest_free
+#define GB_Ingest_setElement GM_Ingest_setElement
+#define GB_Ingest_set GM_Ingest_set
 #define GB_init GM_init
+#define GB_io_load GM_io_load
 #define GB_is_diagonal GM_is_diagonal
 #define GB_iso_expand GM_iso_expand
 #define GB_iso_expand_jit GM_iso_expand_jit
@@ -1049,6 +1096,7 @@
 #define GB_make_shallow GM_make_shallow
 #define GB_malloc_memory GM_malloc_memory
 #define GB_Mask_compatible GM_Mask_compatible
+#define GB_mapping_free GM_mapping_free
 #define GB_masker GM_masker
 #define GB_masker_phase1 GM_masker_phase1
 #define GB_masker_phase1_jit GM_masker_phase1_jit
@@ -1082,7 +1130,10 @@
 #define GB_msort_2 GM_msort_2
 #define GB_msort_3_create_merge_tasks GM_msort_3_create_merge_tasks
 #define GB_msort_3 GM_msort_3
+#define GB_mtx_read GM_mtx_read
+#define GB_mtx_write GM_mtx_write
 #define GB_mxm GM_mxm
+#define GB_mxm_reduce GM_mxm_reduce
 #define GB_new_bix GM_new_bix
 #define GB_new GM_new
 #define GB_nnz_full GM_nnz_full
@@ -1106,8 +1157,12 @@
 #define GB_op_string_get GM_op_string_get
 #define GB_op_string_set GM_op_string_set
 #define GB_Pending_alloc GM_Pending_alloc
+#define GB_Pending_background GM_Pending_background
 #define GB_Pending_ensure GM_Pending_ensure
 #define GB_Pending_free GM_Pending_free
+#define GB_Pending_hash GM_Pending_hash
+#define GB_Pending_job_free GM_Pending_job_free
+#define GB_Pending_join GM_Pending_join
 #define GB_Pending_n GM_Pending_n
 #define GB_Pending_realloc GM_Pending_realloc
 #define GB_phybix_free GM_phybix_free
@@ -1168,6 +1223,7 @@
 #define GB_SelectOp_check GM_SelectOp_check
 #define GB_selectop_to_idxunop GM_selectop_to_idxunop
 #define GB_selector GM_selector
+#define GB_selector_flip GM_selector_flip
 #define GB_select_phase1_jit GM_select_phase1_jit
 #define GB_select_phase2_jit GM_select_phase2_jit
 #define GB_select_positional_bitmap GM_select_positional_bitmap
@@ -1179,11 +1235,16 @@
 #define GB_semiring_name_get GM_semiring_name_get
 #define GB_Semiring_new GM_Semiring_new
 #define GB_serialize_array GM_serialize_array
+#define GB_serialize_checksum GM_serialize_checksum
+#define GB_serialize_delta GM_serialize_delta
+#define GB_serialize_filter GM_serialize_filter
 #define GB_serialize_free_blocks GM_serialize_free_blocks
 #define GB_serialize GM_serialize
 #define GB_serialize_method GM_serialize_method
+#define GB_serialize_stream GM_serialize_stream
 #define GB_serialize_to_blob GM_serialize_to_blob
 #define GB_setElement GM_setElement
+#define GB_setElements GM_setElements
 #define GB_shallow_copy GM_shallow_copy
 #define GB_shallow_op GM_shallow_op
 #define GB_signumf GM_signumf
@@ -1249,6 +1310,8 @@
 #define GB_transpose_bind1st_jit GM_transpose_bind1st_jit
 #define GB_transpose_bind2nd_jit GM_transpose_bind2nd_jit
 #define GB_transpose_bucket GM_transpose_bucket
+#define GB_transpose_cache GM_transpose_cache
+#define GB_transpose_cached GM_transpose_cached
 #define GB_transpose_cast GM_transpose_cast
 #define GB_transpose GM_transpose
 #define GB_transpose_in_place GM_transpose_in_place
@@ -1264,6 +1327,7 @@
 #define GB_union_jit GM_union_jit
 #define GB_unjumble GM_unjumble
 #define GB_unjumble_jit GM_unjumble_jit
+#define GB_unmap GM_unmap
 #define GB_unop_code_iso GM_unop_code_iso
 #define GB_unop_identity GM_unop_identity
 #define GB_unop_iso GM_unop_iso
@@ -1276,6 +1340,7 @@
 #define GB_Vector_diag GM_Vector_diag
 #define GB_Vector_removeElement GM_Vector_removeElement
 #define GB_wait GM_wait
+#define GB_wait_inplace GM_wait_inplace
 #define GB_werk_pop GM_werk_pop
 #define GB_werk_push GM_werk_push
 #define GB_xalloc_memory GM_xalloc_memory
@@ -1507,6 +1572,8 @@
 #define GB_ZSTD_ldm_skipSequences GM_ZSTD_ldm_skipSequences
 #define GB_ZSTD_loadCEntropy GM_ZSTD_loadCEntropy
 #define GB_ZSTD_loadDEntropy GM_ZSTD_loadDEntropy
+#define GB_zstd_long_compress GM_zstd_long_compress
+#define GB_zstd_long_decompress GM_zstd_long_decompress
 #define GB_ZSTD_malloc GM_ZSTD_malloc
 #define GB_ZSTD_maxCLevel GM_ZSTD_maxCLevel
 #define GB_ZSTD_mergeBlockDelimiters GM_ZSTD_mergeBlockDelimiters
@@ -3056,6 +3123,14 @@
 #define GxB_BOR_BXOR_UINT32 GxM_BOR_BXOR_UINT32
 #define GxB_BOR_BXOR_UINT64 GxM_BOR_BXOR_UINT64
 #define GxB_BOR_BXOR_UINT8 GxM_BOR_BXOR_UINT8
+#define GxB_BOR_FIRST_UINT16 GxM_BOR_FIRST_UINT16
+#define GxB_BOR_FIRST_UINT32 GxM_BOR_FIRST_UINT32
+#define GxB_BOR_FIRST_UINT64 GxM_BOR_FIRST_UINT64
+#define GxB_BOR_FIRST_UINT8 GxM_BOR_FIRST_UINT8
+#define GxB_BOR_SECOND_UINT16 GxM_BOR_SECOND_UINT16
+#define GxB_BOR_SECOND_UINT32 GxM_BOR_SECOND_UINT32
+#define GxB_BOR_SECOND_UINT64 GxM_BOR_SECOND_UINT64
+#define GxB_BOR_SECOND_UINT8 GxM_BOR_SECOND_UINT8
 #define GxB_BOR_UINT16_MONOID GxM_BOR_UINT16_MONOID
 #define GxB_BOR_UINT32_MONOID GxM_BOR_UINT32_MONOID
 #define GxB_BOR_UINT64_MONOID GxM_BOR_UINT64_MONOID
@@ -3720,9 +3795,14 @@
 #define GxB_Matrix_build_FC64 GxM_Matrix_build_FC64
 #define GxB_Matrix_build_Scalar GxM_Matrix_build_Scalar
 #define GxB_Matrix_concat GxM_Matrix_concat
+#define GxB_Matrix_deserialize_delta GxM_Matrix_deserialize_delta
 #define GxB_Matrix_deserialize GxM_Matrix_deserialize
+#define GxB_Matrix_deserialize_mmap GxM_Matrix_deserialize_mmap
+#define GxB_Matrix_deserialize_range GxM_Matrix_deserialize_range
+#define GxB_Matrix_deserialize_stream GxM_Matrix_deserialize_stream
 #define GxB_Matrix_diag GxM_Matrix_diag
 #define GxB_Matrix_eWiseUnion GxM_Matrix_eWiseUnion
+#define GxB_Matrix_export_Arrow GxM_Matrix_export_Arrow
 #define GxB_Matrix_export_BitmapC GxM_Matrix_export_BitmapC
 #define GxB_Matrix_export_BitmapR GxM_Matrix_export_BitmapR
 #define GxB_Matrix_export_CSC GxM_Matrix_export_CSC
@@ -3735,11 +3815,14 @@
 #define GxB_Matrix_export_HyperCSR GxM_Matrix_export_HyperCSR
 #define GxB_Matrix_extractElement_FC32 GxM_Matrix_extractElement_FC32
 #define GxB_Matrix_extractElement_FC64 GxM_Matrix_extractElement_FC64
+#define GxB_Matrix_extractElements GxM_Matrix_extractElements
 #define GxB_Matrix_extractTuples_FC32 GxM_Matrix_extractTuples_FC32
 #define GxB_Matrix_extractTuples_FC64 GxM_Matrix_extractTuples_FC64
 #define GxB_Matrix_fprint GxM_Matrix_fprint
+#define GxB_Matrix_import_Arrow GxM_Matrix_import_Arrow
 #define GxB_Matrix_import_BitmapC GxM_Matrix_import_BitmapC
 #define GxB_Matrix_import_BitmapR GxM_Matrix_import_BitmapR
+#define GxB_Matrix_import_borrowed GxM_Matrix_import_borrowed
 #define GxB_Matrix_import_CSC GxM_Matrix_import_CSC
 #define GxB_Matrix_import_CSR GxM_Matrix_import_CSR
 #define GxB_Matrix_import_FC32 GxM_Matrix_import_FC32
@@ -3765,6 +3848,8 @@
 #define GxB_Matrix_pack_FullR GxM_Matrix_pack_FullR
 #define GxB_Matrix_pack_HyperCSC GxM_Matrix_pack_HyperCSC
 #define GxB_Matrix_pack_HyperCSR GxM_Matrix_pack_HyperCSR
+#define GxB_Matrix_read_edges GxM_Matrix_read_edges
+#define GxB_Matrix_read_mtx GxM_Matrix_read_mtx
 #define GxB_Matrix_reduce_FC32 GxM_Matrix_reduce_FC32
 #define GxB_Matrix_reduce_FC64 GxM_Matrix_reduce_FC64
 #define GxB_Matrix_reshapeDup GxM_Matrix_reshapeDup
@@ -3773,9 +3858,12 @@
 #define GxB_Matrix_select_FC32 GxM_Matrix_select_FC32
 #define GxB_Matrix_select_FC64 GxM_Matrix_select_FC64
 #define GxB_Matrix_select GxM_Matrix_select
+#define GxB_Matrix_serialize_delta GxM_Matrix_serialize_delta
 #define GxB_Matrix_serialize GxM_Matrix_serialize
+#define GxB_Matrix_serialize_stream GxM_Matrix_serialize_stream
 #define GxB_Matrix_setElement_FC32 GxM_Matrix_setElement_FC32
 #define GxB_Matrix_setElement_FC64 GxM_Matrix_setElement_FC64
+#define GxB_Matrix_setElements GxM_Matrix_setElements
 #define GxB_Matrix_sort GxM_Matrix_sort
 #define GxB_Matrix_split GxM_Matrix_split
 #define GxB_Matrix_subassign_BOOL GxM_Matrix_subassign_BOOL
@@ -3804,6 +3892,7 @@
 #define GxB_Matrix_unpack_FullR GxM_Matrix_unpack_FullR
 #define GxB_Matrix_unpack_HyperCSC GxM_Matrix_unpack_HyperCSC
 #define GxB_Matrix_unpack_HyperCSR GxM_Matrix_unpack_HyperCSR
+#define GxB_Matrix_write_mtx GxM_Matrix_write_mtx
 #define GxB_MAX_DIV_FP32 GxM_MAX_DIV_FP32
 #define GxB_MAX_DIV_FP64 GxM_MAX_DIV_FP64
 #define GxB_MAX_DIV_INT16 GxM_MAX_DIV_INT16
@@ -4280,6 +4369,8 @@
 #define GxB_Monoid_terminal_new_UINT32 GxM_Monoid_terminal_new_UINT32
 #define GxB_Monoid_terminal_new_UINT64 GxM_Monoid_terminal_new_UINT64
 #define GxB_Monoid_terminal_new_UINT8 GxM_Monoid_terminal_new_UINT8
+#define GxB_mxm_reduce GxM_mxm_reduce
+#define GxB_mxm_select GxM_mxm_select
 #define GxB_NE_FC32 GxM_NE_FC32
 #define GxB_NE_FC64 GxM_NE_FC64
 #define GxB_NE_THUNK GxM_NE_THUNK
@@ -4995,6 +5086,7 @@
 #define GxB_Vector_export_Full GxM_Vector_export_Full
 #define GxB_Vector_extractElement_FC32 GxM_Vector_extractElement_FC32
 #define GxB_Vector_extractElement_FC64 GxM_Vector_extractElement_FC64
+#define GxB_Vector_extractElements GxM_Vector_extractElements
 #define GxB_Vector_extractTuples_FC32 GxM_Vector_extractTuples_FC32
 #define GxB_Vector_extractTuples_FC64 GxM_Vector_extractTuples_FC64
 #define GxB_Vector_fprint GxM_Vector_fprint
@@ -5022,6 +5114,7 @@
 #define GxB_Vector_serialize GxM_Vector_serialize
 #define GxB_Vector_setElement_FC32 GxM_Vector_setElement_FC32
 #define GxB_Vector_setElement_FC64 GxM_Vector_setElement_FC64
+#define GxB_Vector_setElements GxM_Vector_setElements
 #define GxB_Vector_sort GxM_Vector_sort
 #define GxB_Vector_subassign_BOOL GxM_Vector_subassign_BOOL
 #define GxB_Vector_subassign_FC32 GxM_Vector_subassign_FC32
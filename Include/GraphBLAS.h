@@ -1,4 +1,4 @@
-// SuiteSparse:GraphBLAS 9.4.5
+// SuiteSparse:GraphBLAS 9.5.0
 //------------------------------------------------------------------------------
 // GraphBLAS.h: definitions for the GraphBLAS package
 //------------------------------------------------------------------------------
@@ -268,10 +268,10 @@
 
 // The version of this implementation, and the GraphBLAS API version:
 #define GxB_IMPLEMENTATION_NAME "SuiteSparse:GraphBLAS"
-#define GxB_IMPLEMENTATION_DATE "Feb 20, 2025"
+#define GxB_IMPLEMENTATION_DATE "Oct 19, 2026"
 #define GxB_IMPLEMENTATION_MAJOR 9
-#define GxB_IMPLEMENTATION_MINOR 4
-#define GxB_IMPLEMENTATION_SUB   5
+#define GxB_IMPLEMENTATION_MINOR 5
+#define GxB_IMPLEMENTATION_SUB   0
 #define GxB_SPEC_DATE "Dec 22, 2023"
 #define GxB_SPEC_MAJOR 2
 #define GxB_SPEC_MINOR 1
@@ -1431,6 +1431,12 @@ typedef enum            // for global options or matrix options
     GxB_JIT_USE_CMAKE = 7032,        // CPU JIT: use cmake or direct compile
     GxB_JIT_ERROR_LOG = 7033,        // CPU JIT: error log file
 
+    GxB_AxB_TUNE = 7054,             // C=A*B method selection (see below)
+    GxB_AxB_CALIBRATE = 7055,        // calibrate the C=A*B cost model
+    GxB_AxB_DOT2_RATIO = 7056,       // C=A*B cost model: dot2 vs saxpy
+    GxB_BACKGROUND_WAIT = 7059,      // # pending tuples for background wait
+    GxB_PENDING_COMBINE = 7060,      // # keys to combine in pending tuples
+
     GxB_JIT_CUDA_PREFACE = 7100,     // CUDA JIT C++ preface
 
     //------------------------------------------------------------
@@ -1445,6 +1451,8 @@ typedef enum            // for global options or matrix options
     //------------------------------------------------------------
 
     GxB_SPARSITY_CONTROL = 7036,    // sparsity control: 0 to 15; see below
+    GxB_CACHE_TRANSPOSE = 7049,     // if true, keep A' once it is computed
+    GxB_CONCURRENT_SETELEMENT = 7058,   // # of slots for concurrent setElement
 
 } GxB_Option_Field ;
 
@@ -1459,6 +1467,15 @@ typedef enum
 }
 GxB_JIT_Control ;
 
+// for GxB_AxB_TUNE:
+typedef enum
+{
+    GxB_AxB_TUNE_OFF = 0,        // fixed heuristics (the default)
+    GxB_AxB_TUNE_CALIBRATED = 1, // cost model calibrated for this host
+    GxB_AxB_TUNE_ONLINE = 2,     // calibrated, and adapted to run times
+}
+GxB_AxB_Tune_Control ;
+
 // the default hyper_switch parameter
 GB_GLOBAL const double GxB_HYPER_DEFAULT ;
 
@@ -1554,6 +1571,11 @@ typedef enum
 
     // GPU control (DRAFT: in progress, do not use)
     GxB_CONTEXT_GPU_ID      = GxB_GPU_ID,
+
+    // workspace kept in the Context between calls to GrB_mxm and related
+    // methods (a double, in bytes).  If <= 0 (the default), no workspace is
+    // kept.
+    GxB_CONTEXT_WORKSPACE_MAX = 7053,
 }
 GxB_Context_Field ;
 
@@ -1631,6 +1653,9 @@ typedef enum
 
     // GrB_BinaryOp or GrB_Semiring:
     GxB_THETA = 7052,               // to get the value of theta
+
+    // serialized blob:
+    GxB_BLOB_CHECKSUM = 7057,       // digest of the checksums of a blob
 }
 GrB_Field ;
 
@@ -1839,7 +1864,7 @@ GB_GLOBAL GrB_Monoid
 //==============================================================================
 
 // Using built-in types and operators, SuiteSparse:GraphBLAS provides
-// 1553 pre-defined, built-in semirings:
+// 1561 pre-defined, built-in semirings:
 
 // 1000 semirings with a multiply operator TxT -> T where T is non-Boolean,
 // from the complete cross product of:
@@ -1892,6 +1917,12 @@ GB_GLOBAL GrB_Monoid
 //      4 bitwise multiply operators: BOR, BAND, BXOR, BXNOR
 //      4 unsigned integer types: UINT8, UINT16, UINT32, UINT64
 
+// 8 bitset semirings: TxT -> T where T is an unsigned integer:
+
+//      1 bitwise monoid: BOR
+//      2 multiply operators: FIRST, SECOND
+//      4 unsigned integer types: UINT8, UINT16, UINT32, UINT64
+
 // 80 positional semirings: XxX -> T where T is int64 or int32, and the type of
 // X is ignored:
 
@@ -1920,10 +1951,10 @@ GB_GLOBAL GrB_Monoid
 // always the same.  This is the type T for the first set, and Boolean for
 // the second and third sets of semirngs.
 
-// 1553 = 1000 + 300 + 55 + 54 + 64 + 80 semirings are named below, but 35 = 30
-// + 3 + 2 are identical to the corresponding any_pair semirings of the same
-// type.  For positional semirings, the mulitiply ops FIRSTJ and SECONDI are
-// identical, as are FIRSTJ1 and SECONDI1.  These semirings still appear as
+// 1561 = 1000 + 300 + 55 + 54 + 64 + 8 + 80 semirings are named below, but
+// 35 = 30 + 3 + 2 are identical to the corresponding any_pair semirings of the
+// same type.  For positional semirings, the mulitiply ops FIRSTJ and SECONDI
+// are identical, as are FIRSTJ1 and SECONDI1.  These semirings still appear as
 // predefined, for convenience.
 
 // 124 of the GxB_* semirings are now superceded by GrB_* semirings.
@@ -2342,6 +2373,21 @@ GB_GLOBAL GrB_Semiring
     GxB_BXNOR_BXOR_UINT8   , GxB_BXNOR_BXOR_UINT16  , GxB_BXNOR_BXOR_UINT32  , GxB_BXNOR_BXOR_UINT64  ,
     GxB_BXNOR_BXNOR_UINT8  , GxB_BXNOR_BXNOR_UINT16 , GxB_BXNOR_BXNOR_UINT32 , GxB_BXNOR_BXNOR_UINT64 ,
 
+//------------------------------------------------------------------------------
+// 8 bitset semirings
+//------------------------------------------------------------------------------
+
+    // monoid:  BOR x
+    // mult:    (FIRST, SECOND) x
+    // types:   (UINT8, UINT16, UINT32, UINT64)
+
+    // Each bit of an entry is a separate lane, so that up to 64 independent
+    // problems (such as 64 breadth-first searches from different sources)
+    // can be solved at once, with a uint64_t frontier.
+
+    GxB_BOR_FIRST_UINT8    , GxB_BOR_FIRST_UINT16   , GxB_BOR_FIRST_UINT32   , GxB_BOR_FIRST_UINT64   ,
+    GxB_BOR_SECOND_UINT8   , GxB_BOR_SECOND_UINT16  , GxB_BOR_SECOND_UINT32  , GxB_BOR_SECOND_UINT64  ,
+
 //------------------------------------------------------------------------------
 // 80 positional semirings
 //------------------------------------------------------------------------------
@@ -2631,6 +2677,9 @@ GB_GLOBAL const GxB_Format_Value GxB_FORMAT_DEFAULT ;
 #define GxB_COMPRESSION_LZ4   1000  // LZ4
 #define GxB_COMPRESSION_LZ4HC 2000  // LZ4HC, with default level 9
 #define GxB_COMPRESSION_ZSTD  3000  // ZSTD, with default level 1
+#define GxB_COMPRESSION_ZSTD_LONG 4000 // ZSTD, long-distance, default level 1
+#define GxB_COMPRESSION_FILTER 100000 // add to any method to enable filters
+#define GxB_COMPRESSION_CHECKSUM 10000000 // add to any method for checksums
 
 //==============================================================================
 //=== GraphBLAS functions ======================================================
@@ -3974,6 +4023,36 @@ GrB_Info GxB_Vector_isStoredElement // determine if v(i) is a stored element
     GrB_Index i                     // row index
 ) ;
 
+//------------------------------------------------------------------------------
+// GxB_Vector_setElements and GxB_Vector_extractElements
+//------------------------------------------------------------------------------
+
+// GxB_Vector_setElements sets w(I(k)) = X(k) for k = 0 to nvals-1, with the
+// same result as nvals calls to GrB_Vector_setElement in the same order.
+// GxB_Vector_extractElements extracts X(k) = v(I(k)).  It returns
+// GrB_NO_VALUE if any entry is not present, and X(k) is then not modified.
+// If present is not NULL, present [k] is set true if v(I(k)) is present.  The
+// array X has type xtype, which can be typecast to or from the vector type.
+
+GrB_Info GxB_Vector_setElements     // w(I(k)) = X(k), k = 0:nvals-1
+(
+    GrB_Vector w,                   // vector to modify
+    const void *X,                  // array of values, of size nvals
+    const GrB_Type xtype,           // type of X
+    const GrB_Index *Ilist,         // array of indices, of size nvals
+    GrB_Index nvals                 // number of entries to set
+) ;
+
+GrB_Info GxB_Vector_extractElements // X(k) = v(I(k)), k = 0:nvals-1
+(
+    void *X,                        // array of values, of size nvals
+    bool *present,                  // optional array of size nvals
+    const GrB_Type xtype,           // type of X
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *Ilist,         // array of indices, of size nvals
+    GrB_Index nvals                 // number of entries to extract
+) ;
+
 //------------------------------------------------------------------------------
 // GrB_Vector_removeElement
 //------------------------------------------------------------------------------
@@ -4686,6 +4765,41 @@ GrB_Info GxB_Matrix_isStoredElement // determine if A(i,j) is a stored element
     GrB_Index j                         // column index
 ) ;
 
+//------------------------------------------------------------------------------
+// GxB_Matrix_setElements and GxB_Matrix_extractElements
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_setElements sets C(I(k),J(k)) = X(k) for k = 0 to nvals-1, with
+// the same result as nvals calls to GrB_Matrix_setElement in the same order,
+// but with much less overhead.  The entries already present in C are found in
+// parallel and updated in place, and the rest are added as pending tuples all
+// at once.  GxB_Matrix_extractElements extracts X(k) = A(I(k),J(k)), in
+// parallel.  It returns GrB_NO_VALUE if any entry is not present, and X(k) is
+// then not modified.  If present is not NULL, present [k] is set true if
+// A(I(k),J(k)) is present, and false otherwise.  The array X has type xtype,
+// which can be typecast to or from the matrix type.
+
+GrB_Info GxB_Matrix_setElements     // C(I(k),J(k)) = X(k), k = 0:nvals-1
+(
+    GrB_Matrix C,                   // matrix to modify
+    const void *X,                  // array of values, of size nvals
+    const GrB_Type xtype,           // type of X
+    const GrB_Index *Ilist,         // array of row indices, of size nvals
+    const GrB_Index *J,             // array of column indices, of size nvals
+    GrB_Index nvals                 // number of entries to set
+) ;
+
+GrB_Info GxB_Matrix_extractElements // X(k) = A(I(k),J(k)), k = 0:nvals-1
+(
+    void *X,                        // array of values, of size nvals
+    bool *present,                  // optional array of size nvals
+    const GrB_Type xtype,           // type of X
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *Ilist,         // array of row indices, of size nvals
+    const GrB_Index *J,             // array of column indices, of size nvals
+    GrB_Index nvals                 // number of entries to extract
+) ;
+
 //------------------------------------------------------------------------------
 // GrB_Matrix_removeElement
 //------------------------------------------------------------------------------
@@ -5617,6 +5731,47 @@ GrB_Info GrB_mxv                    // w<Mask> = accum (w, A*u)
     const GrB_Descriptor desc       // descriptor for w, mask, and A
 ) ;
 
+// GxB_mxm_reduce: s = accum (s, reduce (C<Mask>=A*B)).  C is computed with
+// the semiring and then reduced to a scalar with the monoid.  If the monoid
+// is the additive monoid of the semiring and the Mask is sparse and not
+// complemented, C is not constructed (via the JIT only).  The descriptor
+// field GrB_MASK is used for the Mask, and GrB_INP0, GrB_INP1, and
+// GxB_AxB_METHOD are used for C=A*B.
+
+GrB_Info GxB_mxm_reduce             // s = accum (s, reduce (C<Mask>=A*B))
+(
+    GrB_Scalar s,                   // input/output scalar for result
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Monoid monoid,        // monoid to reduce C to a scalar
+    const GrB_Matrix Mask,          // optional mask for C, unused if NULL
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for Mask, A, and B
+) ;
+
+// GxB_mxm_select: C<Mask> = accum (C, select (A*B, Thunk)).  This is a
+// convenience method, with the same result as T=A*B followed by
+// GrB_select (C, Mask, accum, op, T, Thunk, desc), but T<Mask>=A*B is computed
+// with the mask (if not complemented), and T is never returned to the caller.
+// If the JIT is enabled and T is computed by the dot3 or saxpy3 method, the op
+// is applied inside the multiply, as each entry of T is computed.  Otherwise,
+// T is computed in full, and then the selected entries are kept, in place in
+// T.  C is never computed in place, even when GrB_mxm would do so.
+
+GrB_Info GxB_mxm_select             // C<Mask> = accum (C, select (A*B, Thunk))
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix Mask,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for T=A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_IndexUnaryOp op,      // operator to select entries of A*B
+    const GrB_Scalar Thunk,         // optional input for the select operator
+    const GrB_Descriptor desc       // descriptor for C, Mask, A, and B
+) ;
+
 //==============================================================================
 // GrB_eWiseMult: element-wise matrix and vector operations, set intersection
 //==============================================================================
@@ -10290,6 +10445,7 @@ GrB_Info GrB_Matrix_exportHint  // suggest the best export format
 //  LZ4     no level setting
 //  LZ4HC   1: fast, 9: default, 9: max
 //  ZSTD:   1: fast, 1: default, 19: max
+//  ZSTD_LONG:  1: fast, 1: default, 19: max
 
 // For all methods, a level of zero results in the default level setting.
 // These settings can be added, so to use LZ4HC at level 5, use method =
@@ -10300,6 +10456,34 @@ GrB_Info GrB_Matrix_exportHint  // suggest the best export format
 // positive but unrecognized, the default is used (GxB_COMPRESSION_ZSTD,
 // level 1).
 
+// GxB_COMPRESSION_ZSTD_LONG is ZSTD with long-distance matching.  As with
+// the other methods, each array is compressed in independent blocks, in
+// parallel, but for arrays of 1MB or more the first block of the array is
+// used as a shared dictionary for all the other blocks.  This gives a smaller
+// blob when the content of an array repeats across its blocks, as is often
+// the case for the indices of a graph, with no loss of parallelism.  Smaller
+// arrays are compressed with GxB_COMPRESSION_ZSTD.  GxB_Matrix_serialize_stream
+// uses GxB_COMPRESSION_ZSTD in place of GxB_COMPRESSION_ZSTD_LONG.  A blob that
+// uses this method cannot be deserialized by versions of GraphBLAS prior to
+// v9.5.0.
+
+// Adding GxB_COMPRESSION_FILTER to a (non-negative) method enables lossless
+// filters that are applied to each block before it is compressed: the integer
+// arrays A->p, A->h, and A->i are delta and zigzag encoded, and then byte
+// shuffled, and the values A->x are byte shuffled.  This often gives a much
+// smaller blob.  For example, use GxB_COMPRESSION_ZSTD +
+// GxB_COMPRESSION_FILTER + 3 for ZSTD at level 3 with the filters.  A blob
+// that uses these filters cannot be deserialized by versions of GraphBLAS
+// prior to v9.5.0.
+
+// Adding GxB_COMPRESSION_CHECKSUM to any method (including
+// GxB_COMPRESSION_NONE) adds an XXH3 checksum of each block to the blob.  The
+// checksums are computed in parallel, and checked by each deserialize method
+// for every block it reads; GrB_INVALID_OBJECT is returned if the blob is
+// corrupted.  GrB_get (blob, &value, GxB_BLOB_CHECKSUM, blob_size), with a
+// size_t value, returns a 64-bit digest of all of the checksums in the blob,
+// or zero if the blob has no checksums.
+
 GrB_Info GxB_Matrix_serialize       // serialize a GrB_Matrix to a blob
 (
     // output:
@@ -10387,6 +10571,344 @@ GrB_Info GxB_Vector_deserialize     // deserialize blob into a GrB_Vector
     const GrB_Descriptor desc       // to control # of threads used
 ) ;
 
+// GxB_Matrix_deserialize_mmap creates a matrix from a file that holds a single
+// blob, written by GrB_Matrix_serialize or GxB_Matrix_serialize.  The file is
+// mapped into memory, read-only.  If the blob is not compressed (written with
+// GxB_COMPRESSION_NONE), the matrix uses the mapped file directly, without
+// copying it, so loading a large matrix takes little time and memory, and
+// the page cache is shared by all processes that map the same file.  If the
+// matrix is later modified, it is first copied into its own memory.  The file
+// must not be modified while the matrix uses it.  A compressed blob is
+// deserialized as a copy, as if by GxB_Matrix_deserialize.
+
+GrB_Info GxB_Matrix_deserialize_mmap    // deserialize a file into a GrB_Matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the file
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blob holds a
+                        // matrix of user-defined type.  May be NULL if blob
+                        // holds a built-in type; otherwise must match the
+                        // type of C.
+    const char *filename,       // file holding the blob
+    const GrB_Descriptor desc   // to control # of threads used
+) ;
+
+// GxB_Matrix_deserialize_range creates C = A(first:last,:) (if format is
+// GxB_BY_ROW) or C = A(:,first:last) (if format is GxB_BY_COL), where A is the
+// matrix held in a blob.  If A was held by row and a range of rows is
+// requested, or by column for a range of columns, only the parts of the blob
+// holding that range are decompressed.  Otherwise, the whole blob is
+// deserialized and C is extracted from it.  If pattern is true, the values of
+// A are not read, and C is returned as an iso-valued GrB_BOOL matrix with all
+// of its entries equal to true.
+
+GrB_Info GxB_Matrix_deserialize_range   // deserialize part of a blob
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blob
+    // input:
+    GrB_Type type,      // type of the matrix in the blob.  Required if the
+                        // blob holds a matrix of user-defined type.  May be
+                        // NULL if blob holds a built-in type; otherwise must
+                        // match the type of the matrix in the blob.
+    const void *blob,       // the blob
+    GrB_Index blob_size,    // size of the blob
+    int format,             // GxB_BY_ROW: C = A(first:last,:)
+                            // GxB_BY_COL: C = A(:,first:last)
+    GrB_Index first,        // first row or column of the range
+    GrB_Index last,         // last row or column of the range
+    bool pattern,           // if true, return just the pattern of C
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+// GxB_Matrix_serialize_stream serializes a matrix in pieces, passing each
+// piece to a user-provided write function as soon as it has been compressed,
+// so the whole blob is never held in memory.  The write function is given the
+// user's handle (a FILE *, a file descriptor, a socket, and so on), and must
+// return true if all of its bytes were written.  GxB_Matrix_deserialize_stream
+// reads the same stream back, with a user-provided read function that must
+// return true only if it reads exactly the number of bytes requested.  Only a
+// bounded amount of compressed data is held in memory at any one time.  A
+// stream that is saved in memory, or to a file, can also be deserialized with
+// GxB_Matrix_deserialize, GrB_Matrix_deserialize, or
+// GxB_Matrix_deserialize_mmap, and queried with GrB_get.  The descriptor
+// selects the compression method, as for GxB_Matrix_serialize.
+
+typedef bool (*GxB_write_function)  // return true if successful
+(
+    void *handle,           // user handle: file, socket, buffer, ...
+    const void *buffer,     // bytes to write
+    size_t size             // # of bytes to write
+) ;
+
+typedef bool (*GxB_read_function)   // return true if size bytes were read
+(
+    void *handle,           // user handle: file, socket, buffer, ...
+    void *buffer,           // bytes read
+    size_t size             // # of bytes to read
+) ;
+
+GrB_Info GxB_Matrix_serialize_stream    // serialize a GrB_Matrix to a stream
+(
+    GxB_write_function write_func,  // user function to write the stream
+    void *handle,                   // user handle passed to write_func
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+) ;
+
+GrB_Info GxB_Matrix_deserialize_stream  // deserialize a stream to a GrB_Matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the stream
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the stream holds
+                        // a matrix of user-defined type.  May be NULL if it
+                        // holds a built-in type; otherwise must match the
+                        // type of C.
+    GxB_read_function read_func,    // user function to read the stream
+    void *handle,                   // user handle passed to read_func
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+// GxB_Matrix_serialize_delta serializes only the part of a matrix that has
+// changed since a prior snapshot.  The vectors of A (rows if A is held by row,
+// columns if by column) are partitioned into groups, and a hash of each group
+// is recorded in the blob.  If base is NULL, all of A is serialized, and the
+// blob can also be deserialized with GxB_Matrix_deserialize and the other
+// deserialize methods.  Otherwise, base must be a blob written by this method
+// for a prior snapshot of A (either a complete snapshot, or a delta), and only
+// the groups of A whose hashes differ from those recorded in the base are
+// serialized.  The base blob is not decompressed.  GxB_Matrix_deserialize_delta
+// applies a delta to the matrix C, which must hold the matrix of the base
+// snapshot, and updates C in place to hold the matrix that was serialized.
+// If C does not match the base, GrB_INVALID_VALUE is returned.  A delta that
+// is a complete snapshot can be applied to any matrix of the same type,
+// dimensions, and format.  The descriptor selects the compression method, as
+// for GxB_Matrix_serialize.
+
+GrB_Info GxB_Matrix_serialize_delta     // serialize the changes to a matrix
+(
+    // output:
+    void **blob_handle,             // the blob, allocated on output
+    GrB_Index *blob_size_handle,    // size of the blob on output
+    // input:
+    GrB_Matrix A,                   // matrix to serialize
+    const void *base,               // blob of a prior snapshot, or NULL
+    GrB_Index base_size,            // size of the base blob
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+) ;
+
+GrB_Info GxB_Matrix_deserialize_delta   // apply a delta blob to a matrix
+(
+    // input/output:
+    GrB_Matrix C,                   // matrix to update
+    // input:
+    const void *blob,               // the blob
+    GrB_Index blob_size,            // size of the blob
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+//==============================================================================
+// GxB_Matrix_read_mtx, GxB_Matrix_write_mtx: Matrix Market files
+//==============================================================================
+
+// GxB_Matrix_read_mtx reads a matrix from a Matrix Market file, in the
+// coordinate or array format, with any field and symmetry.  The file is
+// parsed in parallel, and C is built directly from it.  If type is NULL, C has
+// the type recorded in the file by GxB_Matrix_write_mtx, or otherwise
+// GrB_BOOL, GrB_INT64, GrB_FP64, or GxB_FC64 for the pattern, integer, real,
+// and complex fields.  Duplicate entries are summed.  GxB_Matrix_write_mtx
+// writes a matrix of any built-in type, formatting its entries in parallel.
+
+// GxB_Matrix_read_edges reads a binary edge list: pairs (i,j) of zero-based
+// indices of size index_size (4 or 8 bytes), with no header.  C(i,j) is one
+// for each edge, and C is iso-valued.  If type is NULL, C is GrB_BOOL.  If
+// nrows or ncols is zero, it is found from the largest index in the file.
+
+GrB_Info GxB_Matrix_read_mtx    // read a matrix from a Matrix Market file
+(
+    // output:
+    GrB_Matrix *C,              // output matrix created from the file
+    // input:
+    GrB_Type type,              // type of C, or NULL to use the file
+    const char *filename,       // file to read
+    const GrB_Descriptor desc   // to control # of threads used
+) ;
+
+GrB_Info GxB_Matrix_write_mtx   // write a matrix to a Matrix Market file
+(
+    const char *filename,       // file to write
+    const GrB_Matrix A,         // matrix to write
+    const GrB_Descriptor desc   // to control # of threads used
+) ;
+
+GrB_Info GxB_Matrix_read_edges  // read a matrix from a binary edge list
+(
+    // output:
+    GrB_Matrix *C,              // output matrix created from the file
+    // input:
+    GrB_Type type,              // type of C, or NULL for GrB_BOOL
+    GrB_Index nrows,            // # of rows of C, or 0 to find it
+    GrB_Index ncols,            // # of columns of C, or 0 to find it
+    const char *filename,       // file to read
+    size_t index_size,          // size of each index: 4 or 8 bytes
+    const GrB_Descriptor desc   // to control # of threads used
+) ;
+
+//==============================================================================
+// GxB_Matrix_import_borrowed: import a matrix without taking ownership
+//==============================================================================
+
+// GxB_Matrix_import_borrowed creates a matrix C from arrays owned by the user
+// application, in any of the formats of the GxB_Matrix_import_* methods
+// (selected by the sparsity parameter: GxB_HYPERSPARSE, GxB_SPARSE,
+// GxB_BITMAP, or GxB_FULL).  Unlike GxB_Matrix_import_*, the arrays are not
+// moved into C, and they are never freed or modified by GraphBLAS: C holds
+// read-only references to them.  The arrays may live in memory managed by the
+// user application, such as an arena or a memory-mapped file.  Ap, Ah, Ab, and
+// Ai are ignored (and may be NULL) if not used by the format, as are their
+// sizes.  The nvals parameter is used only for the bitmap format, and nvec
+// only for the hypersparse format.
+
+// When C no longer needs the arrays, release (handle) is called, if release
+// is not NULL.  This occurs when C is freed, or before C is modified: C first
+// makes a private copy of the arrays (copy-on-write) and then calls release.
+// The arrays must not be modified or freed until release is called.  If an
+// error is returned, release is not called.  The import is trusted unless
+// the descriptor has GxB_IMPORT set to GxB_SECURE_IMPORT.
+
+typedef void (*GxB_release_function)    // release borrowed arrays
+(
+    void *handle            // user handle passed to GxB_Matrix_import_borrowed
+) ;
+
+GrB_Info GxB_Matrix_import_borrowed     // import a matrix from borrowed arrays
+(
+    GrB_Matrix *C,          // handle of matrix to create
+    GrB_Type type,          // type of matrix to create
+    GrB_Index nrows,        // number of rows of the matrix
+    GrB_Index ncols,        // number of columns of the matrix
+    const GrB_Index *Ap,    // pointers (hypersparse and sparse)
+    const GrB_Index *Ah,    // vector indices (hypersparse)
+    const int8_t *Ab,       // bitmap (bitmap)
+    const GrB_Index *Ai,    // indices (hypersparse and sparse)
+    const void *Ax,         // values (all formats)
+    GrB_Index Ap_size,      // size of Ap in bytes
+    GrB_Index Ah_size,      // size of Ah in bytes
+    GrB_Index Ab_size,      // size of Ab in bytes
+    GrB_Index Ai_size,      // size of Ai in bytes
+    GrB_Index Ax_size,      // size of Ax in bytes
+    GrB_Index nvals,        // # of entries (bitmap)
+    GrB_Index nvec,         // # of vectors in Ah (hypersparse)
+    int sparsity,           // GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP, or
+                            // GxB_FULL
+    bool by_col,            // if true, C is held by column, else by row
+    bool iso,               // if true, C is iso
+    bool jumbled,           // if true, indices in each vector may be unsorted
+    GxB_release_function release,   // function to release the arrays, or NULL
+    void *handle,           // user handle passed to release
+    const GrB_Descriptor desc       // secure or fast import
+) ;
+
+//==============================================================================
+// GxB_Matrix_export_Arrow, GxB_Matrix_import_Arrow: Arrow C Data Interface
+//==============================================================================
+
+// GxB_Matrix_export_Arrow exports a matrix as an ArrowArray and ArrowSchema
+// of the Arrow C Data Interface (https://arrow.apache.org/docs/format/
+// CDataInterface.html), and frees the matrix, like GxB_Matrix_export_CSR.
+// No values or indices are copied: the arrays of the matrix become the
+// buffers of the ArrowArray, and are freed by its release callback.  The
+// matrix is exported as a struct array with one element per vector (a row if
+// A is held by row, a column if held by column), with up to two fields: "id"
+// (int64, the vector index, present only if A is hypersparse), and "vectors"
+// (a large list of struct, with the fields "index" (int64) and "value").  The
+// offsets of the "vectors" list are A->p, and the "id" is A->h.  The schema
+// metadata records the GraphBLAS.nrows, GraphBLAS.ncols, GraphBLAS.format
+// (CSR, CSC, HyperCSR, or HyperCSC) and GraphBLAS.type.  The "value" field
+// has the Arrow type that matches the type of A; GrB_BOOL values are exported
+// as uint8, GxB_FC32 and GxB_FC64 values as a fixed-size list of 2 floats or
+// doubles, and user-defined types as fixed-size binary.  A bitmap or full
+// matrix is exported as sparse, and an iso matrix is expanded.
+
+// GxB_Matrix_import_Arrow creates a matrix from an ArrowArray and ArrowSchema
+// in the same layout, taking ownership of the ArrowArray (its release
+// callback is set to NULL) and releasing the schema.  The buffers of the
+// ArrowArray are not copied (except for a bit-packed boolean "value" field, or
+// when the "vectors" offsets do not start at zero).  They become read-only
+// shallow components of C, and the ArrowArray is released when C is freed.
+// If C is modified, it first makes a copy of its content and releases the
+// ArrowArray (copy-on-write).  The vectors must be sorted, and the buffers
+// must not have nulls.  The import is trusted unless the descriptor has
+// GxB_IMPORT set to GxB_SECURE_IMPORT.  On error, the array and schema are
+// left unchanged, and still owned by the caller.
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema
+{
+    // array type description
+    const char *format ;
+    const char *name ;
+    const char *metadata ;
+    int64_t flags ;
+    int64_t n_children ;
+    struct ArrowSchema **children ;
+    struct ArrowSchema *dictionary ;
+    // release callback
+    void (*release) (struct ArrowSchema *) ;
+    // opaque producer-specific data
+    void *private_data ;
+} ;
+
+struct ArrowArray
+{
+    // array data description
+    int64_t length ;
+    int64_t null_count ;
+    int64_t offset ;
+    int64_t n_buffers ;
+    int64_t n_children ;
+    const void **buffers ;
+    struct ArrowArray **children ;
+    struct ArrowArray *dictionary ;
+    // release callback
+    void (*release) (struct ArrowArray *) ;
+    // opaque producer-specific data
+    void *private_data ;
+} ;
+
+#endif
+
+GrB_Info GxB_Matrix_export_Arrow    // export and free a matrix as Arrow
+(
+    // output:
+    struct ArrowArray *array,       // the content of A
+    struct ArrowSchema *schema,     // the layout and type of A
+    // input/output:
+    GrB_Matrix *A,                  // handle of matrix to export and free
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+GrB_Info GxB_Matrix_import_Arrow    // import a matrix from Arrow
+(
+    // output:
+    GrB_Matrix *C,                  // handle of matrix to create
+    // input:
+    GrB_Type type,                  // type of C
+    struct ArrowArray *array,       // the content of C, moved into C
+    struct ArrowSchema *schema,     // the layout and type of C, released
+    const GrB_Descriptor desc       // secure or fast import
+) ;
+
 //==============================================================================
 // GxB_Vector_sort and GxB_Matrix_sort: sort a matrix or vector
 //==============================================================================
@@ -25,6 +25,7 @@
 #include "memory/GB_memory.h"
 #include "iso/GB_iso.h"
 #include "pending/GB_Pending_n.h"
+#include "pending/GB_Ingest.h"
 #include "nvals/GB_nvals.h"
 #include "aliased/GB_aliased.h"
 #include "matrix/GB_new.h"
@@ -2222,6 +2222,27 @@
    #define GxB_NO_BXNOR_BXNOR_UINT32    1
    #define GxB_NO_BXNOR_BXNOR_UINT64    1
 
+//----------------------------------------
+// bitset semirings:
+//----------------------------------------
+
+//  8 bitset semirings: for 4 unsigned integer types
+//
+//      (BOR) x (FIRST, SECOND)
+//
+//  These are enabled by default, since they are used for multi-source
+//  breadth-first search, with one bit per source.
+
+// #define GxB_NO_BOR_FIRST_UINT8       1
+// #define GxB_NO_BOR_FIRST_UINT16      1
+// #define GxB_NO_BOR_FIRST_UINT32      1
+// #define GxB_NO_BOR_FIRST_UINT64      1
+
+// #define GxB_NO_BOR_SECOND_UINT8      1
+// #define GxB_NO_BOR_SECOND_UINT16     1
+// #define GxB_NO_BOR_SECOND_UINT32     1
+// #define GxB_NO_BOR_SECOND_UINT64     1
+
 //----------------------------------------
 // semirings with positional multiplicative operators:
 //----------------------------------------
@@ -1039,6 +1039,8 @@ struct GB_Context_opaque GB_OPAQUE (CONTEXT_WORLD) =
     (double) GB_CHUNK_DEFAULT,      // chunk
     1,                              // nthreads_max
     -1,                             // gpu_id
+    0,                              // workspace_max: no workspace kept
+    { NULL, 0, 0, NULL, 0, NULL, 0 },   // saxpy3_work: empty
 } ;
 
 GxB_Context GxB_CONTEXT_WORLD = & GB_OPAQUE (CONTEXT_WORLD) ;
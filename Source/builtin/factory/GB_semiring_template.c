@@ -60,6 +60,12 @@
 //      4 bitwise multiply operators: BOR, BAND, BXOR, BXNOR
 //      4 unsigned integer types: UINT8, UINT16, UINT32, UINT64
 
+// 8 bitset semirings:
+
+//      1 bitwise monoid: BOR
+//      2 multiply operators: FIRST, SECOND
+//      4 unsigned integer types: UINT8, UINT16, UINT32, UINT64
+
 // 80 positional semirings:
 
 //      5 monoids: MIN, MAX, PLUS, TIMES, ANY
@@ -378,6 +384,13 @@
     GXB_SEMIRING ( BXNOR , BXOR   )
     GXB_SEMIRING ( BXNOR , BXNOR  )
 
+    //--------------------------------------------------------------------------
+    // 2 bitset semirings (for unsigned integers only)
+    //--------------------------------------------------------------------------
+
+    GXB_SEMIRING ( BOR   , FIRST  )
+    GXB_SEMIRING ( BOR   , SECOND )
+
 #endif
 
 #if defined ( GB_POSITIONAL )
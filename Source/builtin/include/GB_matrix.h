@@ -492,7 +492,7 @@ int sparsity_control ;  // controls sparsity structure: hypersparse,
 // to the content of another matrix, or A->Y which points to the Y hyper_hash
 // of another matrix.  Using shallow components speeds up computations and
 // saves memory, but shallow matrices are never passed back to the user
-// application.
+// application (except for memory-mapped matrices; see A->mapping below).
 
 // If the following are true, then the corresponding component of the
 // object is a pointer into components of another object.  They must not
@@ -540,6 +540,55 @@ bool jumbled ;          // true if the matrix may be jumbled.  bitmap and full
 
 bool iso ;              // true if all entries have the same value
 
+//------------------------------------------------------------------------------
+// cached transpose
+//------------------------------------------------------------------------------
+
+// If A->cache_AT is true (set by GrB_set (A, true, GxB_CACHE_TRANSPOSE)), the
+// transpose of A is kept in A->AT once it has been computed, so that repeated
+// uses of A' (such as C=A'*B in a push-pull BFS or PageRank) do not need to
+// transpose A again.  A->AT holds the transpose of the storage of A, with the
+// same type and the same format (A->AT->is_csc == A->is_csc), and is never
+// shallow.  It is freed whenever A is modified, so it is only valid for as
+// long as A does not change.  A->AT is built by GrB_wait, or on first use by
+// GB_transpose_cached, inside a critical section.
+
+GrB_Matrix AT ;     // cached transpose of A, or NULL
+bool cache_AT ;     // if true, keep the transpose of A in A->AT
+
+//------------------------------------------------------------------------------
+// memory-mapped matrices
+//------------------------------------------------------------------------------
+
+// A matrix created by GxB_Matrix_deserialize_mmap from an uncompressed blob
+// in a file holds the read-only memory mapping of that file in A->mapping.
+// Its A->p, A->h, A->b, A->i, and A->x components are shallow pointers into
+// the mapping.  Likewise, a matrix created by GxB_Matrix_import_Arrow holds
+// the ArrowArray that owns its buffers in A->mapping, and its components are
+// shallow pointers into those buffers, and a matrix created by
+// GxB_Matrix_import_borrowed holds the user's release function and handle
+// for the arrays it borrows.  These are the only cases where a
+// matrix with shallow components is returned to the user application.  Before
+// A is modified, GB_unmap makes a private copy of all its shallow components
+// and releases the mapping (copy-on-write).  The mapping is also released when
+// A is freed, by A->mapping_release (or by GB_file_munmap if NULL).
+
+void *mapping ;         // mapped blob, ArrowArray, or borrowed arrays, or NULL
+size_t mapping_size ;   // size of the mapping, in bytes
+void (*mapping_release) (void *, size_t) ;  // releases the mapping, or NULL
+
+//------------------------------------------------------------------------------
+// concurrent setElement
+//------------------------------------------------------------------------------
+
+// If not NULL, A->Ingest holds the per-thread lists of pending tuples used by
+// GrB_*_setElement when it is enabled via GrB_set (A, nslots,
+// GxB_CONCURRENT_SETELEMENT).  Unlike the rest of the content of A, it is not
+// freed by GB_phybix_free, so the setting is kept when A is modified.  It is
+// freed only when A itself is freed.
+
+GB_Ingest Ingest ;      // concurrent setElement buffers, or NULL
+
 //------------------------------------------------------------------------------
 // iterating through a matrix
 //------------------------------------------------------------------------------
@@ -466,6 +466,24 @@ struct GB_Descriptor_opaque // content of GrB_Descriptor
     int import ;            // if zero (default), trust input data
 } ;
 
+// The Hf, Hi, and Hx workspace used by GB_AxB_saxpy3 can be kept in a
+// GxB_Context between calls to GrB_mxm, GrB_mxv, and GrB_vxm, if the
+// GxB_CONTEXT_WORKSPACE_MAX of the Context is large enough.  All entries of
+// the kept Hf workspace are in the range 0 to Hf_mark, so they do not need
+// to be cleared before they are used by the coarse tasks of the next call.
+
+typedef struct
+{
+    int64_t *Hf ;           // Hf workspace for GB_AxB_saxpy3
+    size_t Hf_size ;        // allocated size of Hf, in bytes
+    int64_t Hf_mark ;       // all entries of Hf are in the range 0 to Hf_mark
+    int64_t *Hi ;           // Hi workspace for GB_AxB_saxpy3
+    size_t Hi_size ;        // allocated size of Hi, in bytes
+    GB_void *Hx ;           // Hx workspace for GB_AxB_saxpy3
+    size_t Hx_size ;        // allocated size of Hx, in bytes
+}
+GB_saxpy3_workspace_struct ;
+
 struct GB_Context_opaque    // content of GxB_Context
 {
     int64_t magic ;         // for detecting uninitialized objects
@@ -480,6 +498,9 @@ struct GB_Context_opaque    // content of GxB_Context
     // GPU:
     int gpu_id ;            // if negative: use the CPU only; do not use a GPU
                             // if >= 0: then use GPU gpu_id
+    // workspace kept between calls to GraphBLAS (see GB_Context.c):
+    double workspace_max ;  // max size of the kept workspace, in bytes
+    GB_saxpy3_workspace_struct saxpy3_work ;    // kept saxpy3 workspace
 } ;
 
 //------------------------------------------------------------------------------
@@ -489,6 +510,20 @@ struct GB_Context_opaque    // content of GxB_Context
 // Pending tuples are a list of unsorted (i,j,x) tuples that have not yet been
 // added to a matrix.  The data structure is defined in GB_Pending.h.
 
+// If enabled by GrB_set (GrB_GLOBAL, threshold, GxB_BACKGROUND_WAIT), a list
+// that reaches the threshold is handed to a background thread, which
+// assembles it, and a new empty list takes its place.  Pending->job is the
+// work done by that thread, and is part of the pending tuples of the matrix.
+// The GB_Pending_job struct is defined in GB_Pending.h.
+
+// If enabled by GrB_set (GrB_GLOBAL, nkeys, GxB_PENDING_COMBINE), the tuples
+// added by GB_Pending_add are combined with any prior tuple with the same
+// (i,j), using Pending->op, for up to nkeys distinct (i,j) in the list.  The
+// hash table maps (i,j) to the position of its last tuple in the list, or to
+// a flipped position if (i,j) has several tuples that cannot be combined.
+
+typedef struct GB_Pending_job_struct *GB_Pending_job ;
+
 struct GB_Pending_struct    // list of pending tuples for a matrix
 {
     size_t header_size ;    // size of the malloc'd block for this struct, or 0
@@ -504,10 +539,49 @@ struct GB_Pending_struct    // list of pending tuples for a matrix
     GrB_Type type ;     // the type of x
     size_t size ;       // type->size
     GrB_BinaryOp op ;   // operator to assemble pending tuples
+    GB_Pending_job job ;    // prior tuples assembled in background, or NULL
+    int64_t *hash ;     // hash table of positions in the list, or NULL
+    size_t hash_size ;
+    int64_t hash_bits ;     // # of entries in the hash table, minus one
+    int64_t hash_nkeys ;    // # of distinct (i,j) in the hash table
+    int64_t hash_nkeys_max ;    // max # of distinct (i,j) in the hash table
+    int64_t hash_ntuples ;  // tuples 0:hash_ntuples-1 have been hashed
 } ;
 
 typedef struct GB_Pending_struct *GB_Pending ;
 
+//------------------------------------------------------------------------------
+// GB_Ingest data structure: pending tuples for concurrent GrB_setElement
+//------------------------------------------------------------------------------
+
+// If enabled by GrB_set (A, nslots, GxB_CONCURRENT_SETELEMENT), the
+// GrB_*_setElement methods on A can be called by many user threads at the same
+// time.  Each user thread appends its tuples to its own slot, with a list of
+// pending tuples of the same type as A and the implicit SECOND operator.  Each
+// slot has a spin lock that is uncontended unless more user threads than slots
+// are active.  The slots are padded to a 64-byte cache line to avoid false
+// sharing.  The tuples are moved into A->Pending by GB_Ingest_flush, which is
+// done by GB_wait, and by GB_WHERE before A is modified by any other method.
+
+typedef struct
+{
+    GB_Pending Pending ;    // pending tuples held in this slot
+    int8_t lock ;           // 1 if the slot is in use by a thread, 0 if not
+    int8_t unused [64 - sizeof (GB_Pending) - sizeof (int8_t)] ;    // pad
+}
+GB_Ingest_slot ;
+
+struct GB_Ingest_struct     // concurrent setElement buffers for a matrix
+{
+    size_t header_size ;    // size of the malloc'd block for this struct
+    int32_t nslots ;        // number of slots
+    int8_t pending ;        // 1 if any slot may hold pending tuples
+    GB_Ingest_slot *slot ;  // array of size nslots
+    size_t slot_size ;
+} ;
+
+typedef struct GB_Ingest_struct *GB_Ingest ;
+
 //------------------------------------------------------------------------------
 // scalar, vector, and matrix types
 //------------------------------------------------------------------------------
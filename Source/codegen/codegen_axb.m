@@ -213,6 +213,20 @@ for i = 1:4
     end
 end
 
+% bitset semirings: bor monoid with first and second, for multi-source BFS
+mults = { 'first', 'second' } ;
+multfuncs = { 'xarg', 'yarg' } ;
+for j = 1:2
+    multop = mults {j} ;
+    mult = multfuncs {j} ;
+    fprintf ('\nbor_%-7s', multop) ;
+    for k = 1:4
+        fprintf ('.') ;
+        type = sprintf ('uint%d_t', nbits (k)) ;
+        codegen_axb_method ('bor', multop, 'warg |= targ', 'zarg = (xarg | yarg)', mult, type, type, '0', bits {k}) ;
+    end
+end
+
 % positional semirings
 mults = { 'firsti', 'firsti1', 'firstj', 'firstj1', 'secondj', 'secondj1' } ;
 multfuncs = { 'i', '(i+1)', 'k', '(k+1)', 'j', '(j+1)' } ;
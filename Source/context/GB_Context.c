@@ -247,3 +247,134 @@ void GB_Context_gpu_id_set
     }
 }
 
+//------------------------------------------------------------------------------
+// Context->workspace_max: max size of workspace kept in the Context
+//------------------------------------------------------------------------------
+
+//  GB_Context_workspace_max_get: get workspace_max from a Context
+double GB_Context_workspace_max_get (GxB_Context Context)
+{
+    double workspace_max ;
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        GB_ATOMIC_READ
+        workspace_max = GxB_CONTEXT_WORLD->workspace_max ;
+    }
+    else
+    { 
+        workspace_max = Context->workspace_max ;
+    }
+    return (workspace_max) ;
+}
+
+//  GB_Context_workspace_max: get workspace_max from the current Context
+double GB_Context_workspace_max (void)
+{ 
+    return (GB_Context_workspace_max_get (GB_CONTEXT_THREAD)) ;
+}
+
+//  GB_Context_workspace_max_set: set workspace_max in a Context
+void GB_Context_workspace_max_set
+(
+    GxB_Context Context,
+    double workspace_max
+)
+{
+    if (!(workspace_max > 0))
+    { 
+        // workspace_max <= 0 or NaN: do not keep any workspace
+        workspace_max = 0 ;
+    }
+    if (Context == NULL) Context = GxB_CONTEXT_WORLD ;
+    if (Context == GxB_CONTEXT_WORLD)
+    { 
+        GB_ATOMIC_WRITE
+        GxB_CONTEXT_WORLD->workspace_max = workspace_max ;
+    }
+    else
+    { 
+        Context->workspace_max = workspace_max ;
+    }
+    // free any kept workspace that is now too large
+    GB_saxpy3_workspace_struct W ;
+    GB_Context_saxpy3_workspace_take (Context, &W) ;
+    GB_Context_saxpy3_workspace_give (Context, &W) ;
+}
+
+//------------------------------------------------------------------------------
+// Context->saxpy3_work: workspace for GB_AxB_saxpy3
+//------------------------------------------------------------------------------
+
+// The Hf, Hi, and Hx workspace of GB_AxB_saxpy3 can be kept in the Context
+// between calls to GrB_mxm, so that it need not be allocated and cleared
+// each time.  A user thread takes the workspace from the Context, which
+// leaves the Context without any workspace, and gives it back when done.  If
+// two user threads share the same Context, only one of them obtains the
+// kept workspace; the other allocates its own.
+
+//  GB_Context_saxpy3_workspace_take: take the workspace from a Context
+void GB_Context_saxpy3_workspace_take
+(
+    GxB_Context Context,            // Context to use; NULL: current Context
+    GB_saxpy3_workspace_struct *W   // workspace taken from the Context
+)
+{
+    if (Context == NULL) Context = GB_CONTEXT_THREAD ;
+    if (Context == NULL) Context = GxB_CONTEXT_WORLD ;
+    memset (W, 0, sizeof (GB_saxpy3_workspace_struct)) ;
+    #pragma omp critical (GB_Context_workspace)
+    { 
+        (*W) = Context->saxpy3_work ;
+        memset (&(Context->saxpy3_work), 0,
+            sizeof (GB_saxpy3_workspace_struct)) ;
+    }
+}
+
+//  GB_Context_saxpy3_workspace_give: give the workspace back to a Context
+void GB_Context_saxpy3_workspace_give
+(
+    GxB_Context Context,            // Context to use; NULL: current Context
+    GB_saxpy3_workspace_struct *W   // workspace to keep or free
+)
+{
+    if (Context == NULL) Context = GB_CONTEXT_THREAD ;
+    if (Context == NULL) Context = GxB_CONTEXT_WORLD ;
+    double workspace_max = GB_Context_workspace_max_get (Context) ;
+    double wsize = ((double) W->Hf_size) + ((double) W->Hi_size)
+        + ((double) W->Hx_size) ;
+    bool kept = false ;
+    if (wsize > 0 && wsize <= workspace_max)
+    {
+        #pragma omp critical (GB_Context_workspace)
+        {
+            if (Context->saxpy3_work.Hf == NULL &&
+                Context->saxpy3_work.Hi == NULL &&
+                Context->saxpy3_work.Hx == NULL)
+            { 
+                // the Context has no workspace; keep W in the Context
+                Context->saxpy3_work = (*W) ;
+                kept = true ;
+            }
+        }
+    }
+    if (!kept)
+    { 
+        // the workspace is too large, or the Context already has some
+        GB_FREE_WORK (&(W->Hf), W->Hf_size) ;
+        GB_FREE_WORK (&(W->Hi), W->Hi_size) ;
+        GB_FREE_WORK (&(W->Hx), W->Hx_size) ;
+    }
+    memset (W, 0, sizeof (GB_saxpy3_workspace_struct)) ;
+}
+
+//  GB_Context_saxpy3_workspace_free: free the workspace kept in a Context
+void GB_Context_saxpy3_workspace_free (GxB_Context Context)
+{ 
+    if (Context == NULL) Context = GxB_CONTEXT_WORLD ;
+    GB_saxpy3_workspace_struct W ;
+    GB_Context_saxpy3_workspace_take (Context, &W) ;
+    GB_FREE_WORK (&(W.Hf), W.Hf_size) ;
+    GB_FREE_WORK (&(W.Hi), W.Hi_size) ;
+    GB_FREE_WORK (&(W.Hx), W.Hx_size) ;
+}
+
@@ -25,4 +25,22 @@ int    GB_Context_gpu_id (void) ;
 int    GB_Context_gpu_id_get (GxB_Context Context) ;
 void   GB_Context_gpu_id_set (GxB_Context Context, int gpu_id) ;
 
+double GB_Context_workspace_max (void) ;
+double GB_Context_workspace_max_get (GxB_Context Context) ;
+void   GB_Context_workspace_max_set (GxB_Context Context, double wmax) ;
+
+void GB_Context_saxpy3_workspace_take
+(
+    GxB_Context Context,            // Context to use; NULL: current Context
+    GB_saxpy3_workspace_struct *W   // workspace taken from the Context
+) ;
+
+void GB_Context_saxpy3_workspace_give
+(
+    GxB_Context Context,            // Context to use; NULL: current Context
+    GB_saxpy3_workspace_struct *W   // workspace to keep or free
+) ;
+
+void GB_Context_saxpy3_workspace_free (GxB_Context Context) ;
+
 #endif
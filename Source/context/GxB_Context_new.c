@@ -48,6 +48,10 @@ GrB_Info GxB_Context_new            // create a new Context
     Context->nthreads_max = GB_Context_nthreads_max_get (NULL) ;
     Context->chunk = GB_Context_chunk_get (NULL) ;
     Context->gpu_id = GB_Context_gpu_id_get (NULL) ;
+    Context->workspace_max = GB_Context_workspace_max_get (NULL) ;
+
+    // the new Context does not yet hold any workspace
+    memset (&(Context->saxpy3_work), 0, sizeof (GB_saxpy3_workspace_struct)) ;
 
     // return the result
     (*Context_handle) = Context ;
@@ -22,6 +22,41 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_setElements             // C(I(k),J(k)) = X(k), k = 0:n-1
+(
+    GrB_Matrix C,                   // matrix to modify
+    const void *X,                  // array of values
+    const GrB_Type xtype,           // type of X
+    const GrB_Index *I,             // array of row indices
+    const GrB_Index *J,             // array of column indices; NULL if C
+                                    // is a GrB_Vector
+    const GrB_Index n,              // # of entries to set
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_extractElements         // X(k) = A(I(k),J(k)), k = 0:n-1
+(
+    void *X,                        // array of values extracted
+    bool *present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Type xtype,           // type of X
+    const GrB_Matrix A,             // matrix to extract from
+    const GrB_Index *I,             // array of row indices
+    const GrB_Index *J,             // array of column indices; NULL if A
+                                    // is a GrB_Vector
+    const GrB_Index n,              // # of entries to extract
+    GB_Werk Werk
+) ;
+
+void GB_Element_lookup          // find a list of entries in a matrix
+(
+    int64_t *restrict W,        // size n: position of each entry, or -1
+    const GrB_Matrix A,         // matrix to search
+    const int64_t *restrict Ilist,  // size n: index i of each entry
+    const int64_t *restrict Jlist,  // size n: vector j of each entry, or NULL
+    const int64_t n,            // # of entries to find
+    const int nthreads          // # of threads to use
+) ;
+
 GrB_Info GB_Vector_removeElement
 (
     GrB_Vector V,               // vector to remove entry from
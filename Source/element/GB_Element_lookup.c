@@ -0,0 +1,111 @@
+//------------------------------------------------------------------------------
+// GB_Element_lookup: find a list of entries in a matrix, in parallel
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// For each k in the range 0 to n-1, W [k] is set to the position p of the
+// entry A(i,j) in A->i and A->x, where i = Ilist [k] and j = Jlist [k] (or
+// zero if Jlist is NULL), or -1 if A(i,j) is not present.  The indices i and j
+// refer to the internal CSC/CSR format of A, and must be in range.
+
+// If A is sparse or hypersparse, it must not be jumbled, but it may have
+// zombies and pending tuples.  A zombie is found as if it were a live entry;
+// the caller can check GB_IS_ZOMBIE (A->i [p]).  Pending tuples are not
+// searched.  Vectors are found with the A->Y hyper_hash, if present, and each
+// index is found with a binary search, as done by GB_setElement.
+
+// If A is bitmap or full, W [k] = i + j * A->vlen, whether or not the entry
+// is present in the bitmap A->b.
+
+#include "GB.h"
+
+void GB_Element_lookup          // find a list of entries in a matrix
+(
+    int64_t *restrict W,        // size n: position of each entry, or -1
+    const GrB_Matrix A,         // matrix to search
+    const int64_t *restrict Ilist,  // size n: index i of each entry
+    const int64_t *restrict Jlist,  // size n: vector j of each entry, or NULL
+    const int64_t n,            // # of entries to find
+    const int nthreads          // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (W != NULL) ;
+    ASSERT (A != NULL) ;
+    ASSERT (Ilist != NULL) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    const int64_t avlen = A->vlen ;
+    const int64_t anvec = A->nvec ;
+    const int64_t nzombies = A->nzombies ;
+    int64_t k ;
+
+    //--------------------------------------------------------------------------
+    // bitmap or full case
+    //--------------------------------------------------------------------------
+
+    if (Ap == NULL)
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            int64_t j = (Jlist == NULL) ? 0 : Jlist [k] ;
+            W [k] = Ilist [k] + j * avlen ;
+        }
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sparse or hypersparse case
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict A_Yp = (A->Y == NULL) ? NULL : A->Y->p ;
+    const int64_t *restrict A_Yi = (A->Y == NULL) ? NULL : A->Y->i ;
+    const int64_t *restrict A_Yx = (A->Y == NULL) ? NULL : A->Y->x ;
+    const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < n ; k++)
+    {
+        int64_t i = Ilist [k] ;
+        int64_t j = (Jlist == NULL) ? 0 : Jlist [k] ;
+        int64_t pA_start, pA_end ;
+        bool found ;
+        if (Ah != NULL)
+        {
+            // A is hypersparse: look for j in the hyperlist
+            int64_t kA = GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yp, A_Yi, A_Yx,
+                A_hash_bits, j, &pA_start, &pA_end) ;
+            found = (kA >= 0) ;
+        }
+        else
+        {
+            // A is sparse: look in the jth vector
+            pA_start = Ap [j] ;
+            pA_end   = Ap [j+1] ;
+            found = true ;
+        }
+        int64_t pleft = pA_start ;
+        if (found)
+        {
+            // vector j has been found; now look for index i
+            int64_t pright = pA_end - 1 ;
+            bool is_zombie ;
+            GB_BINARY_SEARCH_ZOMBIE (i, Ai, pleft, pright, found, nzombies,
+                is_zombie) ;
+        }
+        W [k] = (found) ? pleft : (-1) ;
+    }
+}
+
@@ -0,0 +1,186 @@
+//------------------------------------------------------------------------------
+// GB_extractElements: X(k) = A(I(k),J(k)) for a list of entries
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Extracts a list of n entries, X(k) = A(I(k),J(k)) for k = 0 to n-1,
+// typecasting from the type of A to the type of X, as needed.  Not
+// user-callable; does the work for GxB_Matrix_extractElements and
+// GxB_Vector_extractElements.
+
+// Any pending work on A is finished first, and the A->Y hyper_hash is built
+// if A is hypersparse with many vectors.  The entries are then found in
+// parallel by GB_Element_lookup, and copied into X in parallel.
+
+// Returns GrB_SUCCESS if all entries are present, or GrB_NO_VALUE if any
+// entry is not present.  X(k) is not modified if A(I(k),J(k)) is not present.
+// If the optional array present is not NULL, present [k] is set true if
+// A(I(k),J(k)) is present, and false otherwise.
+
+// Compare this function with GB_Matrix_extractElement and GB_setElements.
+
+#include "GB.h"
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_FREE_WORK (&W, W_size) ;         \
+}
+
+GrB_Info GB_extractElements         // X(k) = A(I(k),J(k)), k = 0:n-1
+(
+    void *X,                        // array of values extracted
+    bool *present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Type xtype,           // type of X
+    const GrB_Matrix A,             // matrix to extract from
+    const GrB_Index *I,             // array of row indices
+    const GrB_Index *J,             // array of column indices; NULL if A
+                                    // is a GrB_Vector
+    const GrB_Index n,              // # of entries to extract
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *restrict W = NULL ; size_t W_size = 0 ;
+    ASSERT (A != NULL) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (xtype) ;
+    if (n == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+    GB_RETURN_IF_NULL (X) ;
+    GB_RETURN_IF_NULL (I) ;
+
+    GrB_Type atype = A->type ;
+    GB_Type_code acode = atype->code ;
+    GB_Type_code xcode = xtype->code ;
+    if (!GB_Type_compatible (xtype, atype))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Entries of type [%s]\n"
+            "cannot be typecast to output values of type [%s]",
+            atype->name, xtype->name) ;
+    }
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // check the indices
+    //--------------------------------------------------------------------------
+
+    const GrB_Index nrows = GB_NROWS (A) ;
+    const GrB_Index ncols = GB_NCOLS (A) ;
+    int64_t nbad = 0 ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nbad)
+    for (k = 0 ; k < n ; k++)
+    {
+        nbad += (I [k] >= nrows) || (J != NULL && J [k] >= ncols) ;
+    }
+
+    if (nbad > 0)
+    {
+        // report the first invalid index
+        for (k = 0 ; k < n ; k++)
+        {
+            if (I [k] >= nrows)
+            {
+                GB_ERROR (GrB_INVALID_INDEX,
+                    "Row index " GBu " out of range; must be < " GBd,
+                    I [k], nrows) ;
+            }
+            if (J != NULL && J [k] >= ncols)
+            {
+                GB_ERROR (GrB_INVALID_INDEX,
+                    "Column index " GBu " out of range; must be < " GBd,
+                    J [k], ncols) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // finish any pending work, and build the hyper_hash if needed
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (A) ;
+    GB_OK (GB_hyper_hash_build (A, Werk)) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+
+    //--------------------------------------------------------------------------
+    // find the entries in A
+    //--------------------------------------------------------------------------
+
+    // handle the CSR/CSC format: entry k is at index i = Ilist [k] in the
+    // vector j = Jlist [k] (or zero if Jlist is NULL)
+    const int64_t *restrict Ilist = (const int64_t *) (A->is_csc ? I : J) ;
+    const int64_t *restrict Jlist = (const int64_t *) (A->is_csc ? J : I) ;
+
+    W = GB_MALLOC_WORK (n, int64_t, &W_size) ;
+    if (W == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    GB_Element_lookup (W, A, Ilist, Jlist, n, nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // extract the entries
+    //--------------------------------------------------------------------------
+
+    const int8_t  *restrict Ab = A->b ;
+    const GB_void *restrict Ax = (GB_void *) A->x ;
+    const bool A_iso = A->iso ;
+    const size_t asize = atype->size ;
+    const size_t xsize = xtype->size ;
+    GB_cast_function cast_A_to_X = (xcode == acode) ? NULL :
+        GB_cast_factory (xcode, acode) ;
+    int64_t nmissing = 0 ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nmissing)
+    for (k = 0 ; k < n ; k++)
+    {
+        int64_t p = W [k] ;
+        bool found = (p >= 0) && (Ab == NULL || Ab [p] == 1) ;
+        if (found)
+        {
+            // X(k) = (xtype) A(i,j)
+            GB_void *xk = ((GB_void *) X) + k * xsize ;
+            const GB_void *ax = Ax + (A_iso ? 0 : (p * asize)) ;
+            if (cast_A_to_X == NULL)
+            {
+                memcpy (xk, ax, xsize) ;
+            }
+            else
+            {
+                cast_A_to_X (xk, ax, asize) ;
+            }
+        }
+        if (present != NULL)
+        {
+            present [k] = found ;
+        }
+        nmissing += !found ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    #pragma omp flush
+    return ((nmissing == 0) ? GrB_SUCCESS : GrB_NO_VALUE) ;
+}
+
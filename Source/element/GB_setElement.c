@@ -428,8 +428,12 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
             // tuples becomes the type of this scalar, and the pending operator
             // becomes NULL, which is the implicit SECOND_ctype operator,
             // or non-NULL if accum is present.
+            // Duplicates may be combined as they are added if the scalar
+            // has the same type as C, or if they are not combined with an
+            // accum operator, since the last one is kept in that case.
+            bool combine = (accum == NULL || stype == ctype) ;
             if (!GB_Pending_add (&(C->Pending), C->iso, (GB_void *) scalar,
-                stype, accum, i, j, C->vdim > 1, Werk))
+                stype, accum, i, j, C->vdim > 1, combine, Werk))
             { 
                 // out of memory
                 GB_phybix_free (C) ;
@@ -0,0 +1,336 @@
+//------------------------------------------------------------------------------
+// GB_setElements: C(I(k),J(k)) = X(k) for a list of entries
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Sets a list of n entries, C(I(k),J(k)) = X(k) for k = 0 to n-1, with the
+// same result as n calls to GB_setElement in the same order: if an entry
+// appears more than once, its last value is kept.  Not user-callable; does the
+// work for GxB_Matrix_setElements and GxB_Vector_setElements.
+
+// The values X are typecast to the type of C all at once.  The entries
+// already present in C (including zombies) are found in parallel by
+// GB_Element_lookup, using the hyper_hash if C is hypersparse, and are then
+// updated in place.  The remaining entries are appended to the pending tuples
+// of C in a single step, and are assembled later by GB_wait, just like the
+// pending tuples from GB_setElement.
+
+// Compare this function with GB_setElement and GB_extractElements.
+
+#include "pending/GB_Pending.h"
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_FREE_WORK (&W, W_size) ;         \
+    GB_FREE_WORK (&Xwork, Xwork_size) ; \
+}
+
+GrB_Info GB_setElements             // C(I(k),J(k)) = X(k), k = 0:n-1
+(
+    GrB_Matrix C,                   // matrix to modify
+    const void *X,                  // array of values
+    const GrB_Type xtype,           // type of X
+    const GrB_Index *I,             // array of row indices
+    const GrB_Index *J,             // array of column indices; NULL if C
+                                    // is a GrB_Vector
+    const GrB_Index n,              // # of entries to set
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *restrict W = NULL ; size_t W_size = 0 ;
+    GB_void *restrict Xwork = NULL ; size_t Xwork_size = 0 ;
+    ASSERT (C != NULL) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (xtype) ;
+    if (n == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+    GB_RETURN_IF_NULL (X) ;
+    GB_RETURN_IF_NULL (I) ;
+
+    GrB_Type ctype = C->type ;
+    GB_Type_code ccode = ctype->code ;
+    GB_Type_code xcode = xtype->code ;
+    if (!GB_Type_compatible (xtype, ctype))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Input values of type [%s]\n"
+            "cannot be typecast to entries of type [%s]",
+            xtype->name, ctype->name) ;
+    }
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // check the indices
+    //--------------------------------------------------------------------------
+
+    const GrB_Index nrows = GB_NROWS (C) ;
+    const GrB_Index ncols = GB_NCOLS (C) ;
+    int64_t nbad = 0 ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nbad)
+    for (k = 0 ; k < n ; k++)
+    {
+        nbad += (I [k] >= nrows) || (J != NULL && J [k] >= ncols) ;
+    }
+
+    if (nbad > 0)
+    {
+        // report the first invalid index
+        for (k = 0 ; k < n ; k++)
+        {
+            if (I [k] >= nrows)
+            {
+                GB_ERROR (GrB_INVALID_INDEX,
+                    "Row index " GBu " out of range; must be < " GBd,
+                    I [k], nrows) ;
+            }
+            if (J != NULL && J [k] >= ncols)
+            {
+                GB_ERROR (GrB_INVALID_INDEX,
+                    "Column index " GBu " out of range; must be < " GBd,
+                    J [k], ncols) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // sort C and assemble incompatible pending tuples, if needed
+    //--------------------------------------------------------------------------
+
+    // The new pending tuples will have the type of C, with the implicit
+    // SECOND operator.  Zombies are still OK.
+
+    if (C->jumbled)
+    {
+        GB_OK (GB_wait (C, "C (setElements:jumbled)", Werk)) ;
+    }
+    if (C->Pending != NULL && !(C->Pending->type == ctype &&
+        GB_op_is_second (C->Pending->op, ctype)))
+    {
+        GB_OK (GB_wait (C, "C (setElements:incompatible pending tuples)",
+            Werk)) ;
+    }
+
+    ASSERT (!GB_JUMBLED (C)) ;
+    ASSERT (GB_PENDING_OK (C)) ;
+    ASSERT (GB_ZOMBIES_OK (C)) ;
+
+    //--------------------------------------------------------------------------
+    // typecast the values to the type of C
+    //--------------------------------------------------------------------------
+
+    const size_t csize = ctype->size ;
+    const GB_void *restrict Xc ;
+    if (xcode == ccode)
+    {
+        // no typecasting needed; X is used as-is
+        Xc = (const GB_void *) X ;
+    }
+    else
+    {
+        // Xwork = (ctype) X
+        Xwork = GB_MALLOC_WORK (n * csize, GB_void, &Xwork_size) ;
+        if (Xwork == NULL)
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        GB_cast_function cast_X_to_C = GB_cast_factory (ccode, xcode) ;
+        const size_t xsize = xtype->size ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            cast_X_to_C (Xwork + k * csize, ((GB_void *) X) + k * xsize,
+                xsize) ;
+        }
+        Xc = Xwork ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check if C needs to convert to non-iso, or if C is a new iso matrix
+    //--------------------------------------------------------------------------
+
+    const GB_void *x0 = (C->iso) ? ((GB_void *) C->x) : Xc ;
+    int64_t ndiff = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:ndiff)
+    for (k = 0 ; k < n ; k++)
+    {
+        ndiff += (memcmp (Xc + k * csize, x0, csize) != 0) ;
+    }
+
+    if (C->iso && ndiff > 0)
+    {
+        // Some new entries differ from the iso value of C.  Assemble all
+        // pending tuples and convert C to non-iso.  Zombies are OK.
+        if (C->Pending != NULL)
+        {
+            GB_OK (GB_wait (C, "C (setElements:to non-iso)", Werk)) ;
+        }
+        GB_OK (GB_convert_any_to_non_iso (C, true)) ;
+    }
+    else if (!C->iso && ndiff == 0 && GB_nnz (C) == 0 && !GB_IS_FULL (C)
+        && C->Pending == NULL)
+    {
+        // C is empty and all new entries are the same: convert C to iso
+        GB_OK (GB_convert_any_to_iso (C, (GB_void *) x0)) ;
+    }
+
+    const bool C_iso = C->iso ;
+
+    //--------------------------------------------------------------------------
+    // find the entries in C
+    //--------------------------------------------------------------------------
+
+    // handle the CSR/CSC format: entry k is at index i = Ilist [k] in the
+    // vector j = Jlist [k] (or zero if Jlist is NULL)
+    const int64_t *restrict Ilist = (const int64_t *) (C->is_csc ? I : J) ;
+    const int64_t *restrict Jlist = (const int64_t *) (C->is_csc ? J : I) ;
+
+    // build the hyper_hash of C, if C is hypersparse with many vectors, and
+    // if its hyperlist is not about to be changed by GB_wait
+    if (!GB_ANY_PENDING_WORK (C))
+    {
+        GB_OK (GB_hyper_hash_build (C, Werk)) ;
+    }
+
+    W = GB_MALLOC_WORK (n, int64_t, &W_size) ;
+    if (W == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    GB_Element_lookup (W, C, Ilist, Jlist, n, nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // update the entries found in C
+    //--------------------------------------------------------------------------
+
+    // This is done in order, so that the last of any duplicate entries is
+    // kept.  The list of entries not found is compacted into W [0:nnew-1].
+
+    int64_t *restrict Ci = C->i ;
+    int8_t  *restrict Cb = C->b ;
+    GB_void *restrict Cx = (GB_void *) C->x ;
+    int64_t nnew = 0 ;
+    for (k = 0 ; k < n ; k++)
+    {
+        int64_t p = W [k] ;
+        if (p >= 0)
+        {
+            // C(i,j) = X(k)
+            if (!C_iso)
+            {
+                memcpy (Cx + p * csize, Xc + k * csize, csize) ;
+            }
+            if (Cb != NULL)
+            {
+                // set the entry in the C bitmap
+                C->nvals += (Cb [p] == 0) ;
+                Cb [p] = 1 ;
+            }
+            else if (Ci != NULL && GB_IS_ZOMBIE (Ci [p]))
+            {
+                // bring the zombie back to life
+                Ci [p] = Ilist [k] ;
+                C->nzombies-- ;
+            }
+        }
+        else
+        {
+            // C(i,j) not found: add it as a pending tuple below
+            W [nnew++] = k ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // append the entries not found to the list of pending tuples
+    //--------------------------------------------------------------------------
+
+    if (nnew > 0)
+    {
+
+        ASSERT (GB_IS_SPARSE (C) || GB_IS_HYPERSPARSE (C)) ;
+        if (!GB_Pending_ensure (&(C->Pending), C_iso, ctype, NULL, C->vdim > 1,
+            nnew, Werk))
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            GB_phybix_free (C) ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        GB_Pending Pending = C->Pending ;
+        const int64_t pn = Pending->n ;
+        int64_t *restrict Pending_i = Pending->i ;
+        int64_t *restrict Pending_j = Pending->j ;
+        GB_void *restrict Pending_x = Pending->x ;
+        ASSERT (pn + nnew <= Pending->nmax) ;
+        ASSERT ((Pending_j == NULL) == (Jlist == NULL || C->vdim <= 1)) ;
+
+        int64_t t ;
+        nthreads = GB_nthreads (nnew, chunk, nthreads_max) ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (t = 0 ; t < nnew ; t++)
+        {
+            int64_t k = W [t] ;
+            Pending_i [pn + t] = Ilist [k] ;
+            if (Pending_j != NULL)
+            {
+                Pending_j [pn + t] = Jlist [k] ;
+            }
+            if (!C_iso)
+            {
+                memcpy (Pending_x + (pn + t) * csize, Xc + k * csize, csize) ;
+            }
+        }
+
+        // keep track of whether or not the pending tuples are still sorted
+        if (Pending->sorted)
+        {
+            int64_t nunsorted = 0 ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                reduction(+:nunsorted)
+            for (t = GB_IMAX (pn, 1) ; t < pn + nnew ; t++)
+            {
+                int64_t ilast = Pending_i [t-1] ;
+                int64_t jlast = (Pending_j == NULL) ? 0 : Pending_j [t-1] ;
+                int64_t i = Pending_i [t] ;
+                int64_t j = (Pending_j == NULL) ? 0 : Pending_j [t] ;
+                nunsorted += !((jlast < j) || (jlast == j && ilast <= i)) ;
+            }
+            Pending->sorted = (nunsorted == 0) ;
+        }
+        Pending->n += nnew ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    if (nnew > 0)
+    {
+        // more pending tuples; block if too many of them
+        return (GB_block (C, Werk)) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
@@ -22,6 +22,12 @@ GrB_Info GB_EVAL3 (prefix, _Matrix_setElement_, T) /* C (row,col) = x */    \
     GrB_Index col                       /* column index                   */\
 )                                                                           \
 {                                                                           \
+    if (GB_INGEST (C))                                                      \
+    {                                                                       \
+        /* concurrent setElement, from any user thread */                   \
+        return (GB_Ingest_setElement (C, ampersand x, row, col,             \
+            GB_ ## T ## _code)) ;                                           \
+    }                                                                       \
     GB_WHERE (C, GB_STR(prefix) "_Matrix_setElement_" GB_STR(T)             \
         " (C, row, col, x)") ;                                              \
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;                                       \
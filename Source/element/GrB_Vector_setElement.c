@@ -21,6 +21,12 @@ GrB_Info GB_EVAL3 (prefix, _Vector_setElement_, T)    /* w(row) = x */      \
     GrB_Index row                       /* row index                  */    \
 )                                                                           \
 {                                                                           \
+    if (GB_INGEST (w))                                                      \
+    {                                                                       \
+        /* concurrent setElement, from any user thread */                   \
+        return (GB_Ingest_setElement ((GrB_Matrix) w, ampersand x, row, 0,  \
+            GB_ ## T ## _code)) ;                                           \
+    }                                                                       \
     GB_WHERE (w, "GrB_Vector_setElement_" GB_STR(T) " (w, x, row)") ;       \
     GB_RETURN_IF_NULL_OR_FAULTY (w) ;                                       \
     ASSERT (GB_VECTOR_OK (w)) ;                                             \
@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_extractElements: extract a list of entries from a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// X(k) = A(I(k),J(k)) for k = 0 to nvals-1, typecasting from the type of A to
+// the type of X as needed.  The entries are found and extracted in parallel.
+
+// Returns GrB_SUCCESS if all the entries are present, or GrB_NO_VALUE if any
+// entry is not present, in which case X(k) is not modified.  If the optional
+// array present is not NULL, present [k] is true if A(I(k),J(k)) is present,
+// and false otherwise.
+
+#include "GB.h"
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_Matrix_extractElements // X(k) = A(I(k),J(k)), k = 0:nvals-1
+(
+    void *X,                        // array of values, of size nvals
+    bool *present,                  // optional array of size nvals
+    const GrB_Type xtype,           // type of X
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices, of size nvals
+    const GrB_Index *J,             // array of column indices, of size nvals
+    GrB_Index nvals                 // number of entries to extract
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_extractElements (X, present, xtype, A, I, J, "
+        "nvals)") ;
+    GB_BURBLE_START ("GxB_Matrix_extractElements") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    if (nvals > 0)
+    { 
+        GB_RETURN_IF_NULL (J) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // extract the entries
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_extractElements (X, present, xtype, A, I, J, nvals,
+        Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,49 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_setElements: set a list of entries in a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C(I(k),J(k)) = X(k) for k = 0 to nvals-1, typecasting from the type of X to
+// the type of C as needed.  The result is the same as nvals calls to
+// GrB_Matrix_setElement, in order, but the entries are found in parallel, and
+// the new entries are added to the pending tuples of C all at once.
+
+#include "GB.h"
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_Matrix_setElements     // C(I(k),J(k)) = X(k), k = 0:nvals-1
+(
+    GrB_Matrix C,                   // matrix to modify
+    const void *X,                  // array of values, of size nvals
+    const GrB_Type xtype,           // type of X
+    const GrB_Index *I,             // array of row indices, of size nvals
+    const GrB_Index *J,             // array of column indices, of size nvals
+    GrB_Index nvals                 // number of entries to set
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (C, "GxB_Matrix_setElements (C, X, xtype, I, J, nvals)") ;
+    GB_BURBLE_START ("GxB_Matrix_setElements") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    if (nvals > 0)
+    { 
+        GB_RETURN_IF_NULL (J) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // set the entries
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_setElements (C, X, xtype, I, J, nvals, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_extractElements: extract a list of entries from a vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// X(k) = v(I(k)) for k = 0 to nvals-1, typecasting from the type of v to the
+// type of X as needed.  Returns GrB_NO_VALUE if any entry is not present; see
+// GxB_Matrix_extractElements for details.
+
+#include "GB.h"
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_Vector_extractElements // X(k) = v(I(k)), k = 0:nvals-1
+(
+    void *X,                        // array of values, of size nvals
+    bool *present,                  // optional array of size nvals
+    const GrB_Type xtype,           // type of X
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices, of size nvals
+    GrB_Index nvals                 // number of entries to extract
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Vector_extractElements (X, present, xtype, v, I, nvals)") ;
+    GB_BURBLE_START ("GxB_Vector_extractElements") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (v) ;
+    ASSERT (GB_VECTOR_OK (v)) ;
+
+    //--------------------------------------------------------------------------
+    // extract the entries
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_extractElements (X, present, xtype, (GrB_Matrix) v, I,
+        NULL, nvals, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
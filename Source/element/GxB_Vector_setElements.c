@@ -0,0 +1,45 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_setElements: set a list of entries in a vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// w(I(k)) = X(k) for k = 0 to nvals-1, typecasting from the type of X to the
+// type of w as needed.  The result is the same as nvals calls to
+// GrB_Vector_setElement, in order.
+
+#include "GB.h"
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_Vector_setElements     // w(I(k)) = X(k), k = 0:nvals-1
+(
+    GrB_Vector w,                   // vector to modify
+    const void *X,                  // array of values, of size nvals
+    const GrB_Type xtype,           // type of X
+    const GrB_Index *I,             // array of indices, of size nvals
+    GrB_Index nvals                 // number of entries to set
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (w, "GxB_Vector_setElements (w, X, xtype, I, nvals)") ;
+    GB_BURBLE_START ("GxB_Vector_setElements") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (w) ;
+    ASSERT (GB_VECTOR_OK (w)) ;
+
+    //--------------------------------------------------------------------------
+    // set the entries
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_setElements ((GrB_Matrix) w, X, xtype, I, NULL, nvals,
+        Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
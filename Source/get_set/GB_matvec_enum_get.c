@@ -38,6 +38,16 @@ GrB_Info GB_matvec_enum_get (GrB_Matrix A, int32_t *value, int field)
             (*value) = !(A->no_hyper_hash) ;
             break ;
 
+        case GxB_CACHE_TRANSPOSE : 
+
+            (*value) = A->cache_AT ;
+            break ;
+
+        case GxB_CONCURRENT_SETELEMENT : 
+
+            (*value) = (A->Ingest == NULL) ? 0 : A->Ingest->nslots ;
+            break ;
+
         case GxB_FORMAT : 
 
             (*value) = (A->is_csc) ? GxB_BY_COL : GxB_BY_ROW ;
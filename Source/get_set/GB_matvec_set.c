@@ -25,6 +25,10 @@ GrB_Info GB_matvec_set
     GrB_Info info ;
     GB_BURBLE_START ("GrB_set") ;
 
+    // A may be converted or transposed below, so copy it out of its memory
+    // mapping, if any
+    GB_OK (GB_unmap (A)) ;
+
     int format = ivalue ;
 
     switch (field)
@@ -49,6 +53,25 @@ GrB_Info GB_matvec_set
             A->bitmap_switch = (float) dvalue ;
             break ;
 
+        case GxB_CACHE_TRANSPOSE : 
+
+            if (is_vector)
+            { 
+                return (GrB_INVALID_VALUE) ;
+            }
+            A->cache_AT = (bool) ivalue ;
+            if (!A->cache_AT)
+            { 
+                // free any cached transpose of A
+                GB_Matrix_free (&(A->AT)) ;
+            }
+            break ;
+
+        case GxB_CONCURRENT_SETELEMENT : 
+
+            GB_OK (GB_Ingest_set (A, ivalue, Werk)) ;
+            break ;
+
         case GxB_SPARSITY_CONTROL : 
 
             A->sparsity_control = GB_sparsity_control (ivalue, (int64_t) (-1)) ;
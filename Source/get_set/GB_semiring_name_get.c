@@ -31,10 +31,11 @@ const char *GB_semiring_name_get (GrB_Semiring semiring)
         case GB_FIRST_binop_code   :    // z = x
         //----------------------------------------------------------------------
 
-            // 61 semirings with FIRST:
+            // 65 semirings with FIRST:
             // 50: (min,max,plus,times,any) for 10 non-boolean real
             // 5: (or,and,xor,eq,any) for boolean
             // 6: (plus,times,any) for 2 complex
+            // 4: (bor) for 4 unsigned integers
 
             switch (add_opcode)
             {
@@ -141,6 +142,19 @@ const char *GB_semiring_name_get (GrB_Semiring semiring)
                     }
                     break ;
 
+                case GB_BOR_binop_code:
+
+                    switch (xcode)
+                    {
+                        // 4 unsigned integer types
+                        case GB_UINT8_code  : return ("GxB_BOR_FIRST_UINT8" ) ;
+                        case GB_UINT16_code : return ("GxB_BOR_FIRST_UINT16") ;
+                        case GB_UINT32_code : return ("GxB_BOR_FIRST_UINT32") ;
+                        case GB_UINT64_code : return ("GxB_BOR_FIRST_UINT64") ;
+                        default: ;
+                    }
+                    break ;
+
                 case GB_LOR_binop_code  : if (xbool) return ("GxB_LOR_FIRST_BOOL"  ) ;
                 case GB_LAND_binop_code : if (xbool) return ("GxB_LAND_FIRST_BOOL" ) ;
                 case GB_EQ_binop_code   : if (xbool) return ("GxB_EQ_FIRST_BOOL"   ) ;
@@ -154,10 +168,11 @@ const char *GB_semiring_name_get (GrB_Semiring semiring)
         case GB_SECOND_binop_code  :    // z = y
         //----------------------------------------------------------------------
 
-            // 61 semirings with SECOND:
+            // 65 semirings with SECOND:
             // 50: (min,max,plus,times,any) for 10 real non-boolean
             // 5: (or,and,xor,eq,any) for boolean
             // 6: (plus,times,any) for 2 complex
+            // 4: (bor) for 4 unsigned integers
 
             switch (add_opcode)
             {
@@ -264,6 +279,19 @@ const char *GB_semiring_name_get (GrB_Semiring semiring)
                     }
                     break ;
 
+                case GB_BOR_binop_code:
+
+                    switch (xcode)
+                    {
+                        // 4 unsigned integer types
+                        case GB_UINT8_code  : return ("GxB_BOR_SECOND_UINT8" ) ;
+                        case GB_UINT16_code : return ("GxB_BOR_SECOND_UINT16") ;
+                        case GB_UINT32_code : return ("GxB_BOR_SECOND_UINT32") ;
+                        case GB_UINT64_code : return ("GxB_BOR_SECOND_UINT64") ;
+                        default: ;
+                    }
+                    break ;
+
                 case GB_LOR_binop_code  : if (xbool) return ("GxB_LOR_SECOND_BOOL"  ) ;
                 case GB_LAND_binop_code : if (xbool) return ("GxB_LAND_SECOND_BOOL" ) ;
                 case GB_EQ_binop_code   : if (xbool) return ("GxB_EQ_SECOND_BOOL"   ) ;
@@ -127,6 +127,16 @@ static GrB_Info GB_global_enum_get (int32_t *value, int field)
             (*value) = (int) GB_jitifyer_get_use_cmake ( ) ;
             break ;
 
+        case GxB_AxB_TUNE : 
+
+            (*value) = (int) GB_Global_axb_tune_get ( ) ;
+            break ;
+
+        case GxB_AxB_CALIBRATE : 
+
+            (*value) = (int) GB_Global_axb_calibrated_get ( ) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -201,6 +211,27 @@ GrB_Info GrB_Global_get_Scalar
                         GB_INT64_code, Werk) ;
                     break ;
 
+                case GxB_BACKGROUND_WAIT : 
+
+                    i64 = GB_Global_background_wait_get ( ) ;
+                    info = GB_setElement ((GrB_Matrix) value, NULL, &i64, 0, 0,
+                        GB_INT64_code, Werk) ;
+                    break ;
+
+                case GxB_PENDING_COMBINE : 
+
+                    i64 = GB_Global_pending_combine_get ( ) ;
+                    info = GB_setElement ((GrB_Matrix) value, NULL, &i64, 0, 0,
+                        GB_INT64_code, Werk) ;
+                    break ;
+
+                case GxB_AxB_DOT2_RATIO : 
+
+                    x = GB_Global_axb_dot2_ratio_get ( ) ;
+                    info = GB_setElement ((GrB_Matrix) value, NULL, &x, 0, 0,
+                        GB_FP64_code, Werk) ;
+                    break ;
+
                 default : 
 
                     info = GrB_INVALID_VALUE ;
@@ -9,12 +9,13 @@
 
 #include "get_set/GB_get_set.h"
 #include "jitifyer/GB_jitifyer.h"
+#include "mxm/GB_mxm.h"
 
 //------------------------------------------------------------------------------
 // GB_global_enum_set: get an enum value from the global state
 //------------------------------------------------------------------------------
 
-static GrB_Info GB_global_enum_set (int32_t value, int field)
+static GrB_Info GB_global_enum_set (int32_t value, int field, GB_Werk Werk)
 {
 
     switch (field)
@@ -71,6 +72,16 @@ static GrB_Info GB_global_enum_set (int32_t value, int field)
             GB_jitifyer_set_control (value) ;
             break ;
 
+        case GxB_AxB_TUNE : 
+
+            // may load or calibrate the cost model for C=A*B
+            return (GB_AxB_tune_set (value, Werk)) ;
+
+        case GxB_AxB_CALIBRATE : 
+
+            // run the benchmark to calibrate the cost model for C=A*B
+            return (value ? GB_AxB_tune_calibrate (Werk) : GrB_SUCCESS) ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -140,12 +151,60 @@ GrB_Info GrB_Global_set_Scalar
                 }
                 break ;
 
+            case GxB_BACKGROUND_WAIT : 
+
+                info = GrB_Scalar_extractElement_INT64 (&i64value, value) ;
+                if (info == GrB_SUCCESS)
+                {
+                    if (i64value >= 0)
+                    { 
+                        GB_Global_background_wait_set (i64value) ;
+                    }
+                    else
+                    { 
+                        info = GrB_INVALID_VALUE ;
+                    }
+                }
+                break ;
+
+            case GxB_PENDING_COMBINE : 
+
+                info = GrB_Scalar_extractElement_INT64 (&i64value, value) ;
+                if (info == GrB_SUCCESS)
+                {
+                    if (i64value >= 0)
+                    { 
+                        GB_Global_pending_combine_set (i64value) ;
+                    }
+                    else
+                    { 
+                        info = GrB_INVALID_VALUE ;
+                    }
+                }
+                break ;
+
+            case GxB_AxB_DOT2_RATIO : 
+
+                info = GrB_Scalar_extractElement_FP64 (&dvalue, value) ;
+                if (info == GrB_SUCCESS)
+                {
+                    if (dvalue > 0 && isfinite (dvalue))
+                    { 
+                        GB_Global_axb_dot2_ratio_set (dvalue) ;
+                    }
+                    else
+                    { 
+                        info = GrB_INVALID_VALUE ;
+                    }
+                }
+                break ;
+
             default : 
 
                 info = GrB_Scalar_extractElement_INT32 (&ivalue, value) ;
                 if (info == GrB_SUCCESS)
                 {
-                    info = GB_global_enum_set (ivalue, field) ;
+                    info = GB_global_enum_set (ivalue, field, Werk) ;
                 }
                 break ;
         }
@@ -267,7 +326,7 @@ GrB_Info GrB_Global_set_INT32
 
     #pragma omp critical (GB_global_get_set)
     {
-        info = GB_global_enum_set (value, field) ;
+        info = GB_global_enum_set (value, field, Werk) ;
     }
 
     return (info) ;
@@ -87,6 +87,11 @@ GrB_Info GxB_Context_get_FP64       // get a parameter in a Context
             (*value) = GB_Context_chunk_get (Context) ;
             break ;
 
+        case GxB_CONTEXT_WORKSPACE_MAX :
+
+            (*value) = GB_Context_workspace_max_get (Context) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -157,6 +162,17 @@ GrB_Info GxB_Context_get            // get a parameter in a Context
             }
             break ;
 
+        case GxB_CONTEXT_WORKSPACE_MAX :
+
+            {
+                va_start (ap, field) ;
+                double *value = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = GB_Context_workspace_max_get (Context) ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
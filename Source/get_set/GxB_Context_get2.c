@@ -46,6 +46,11 @@ GrB_Info GxB_Context_get_Scalar
             dvalue = GB_Context_chunk_get (Context) ;
             break ;
 
+        case GxB_CONTEXT_WORKSPACE_MAX :
+
+            dvalue = GB_Context_workspace_max_get (Context) ;
+            break ;
+
         case GxB_CONTEXT_NTHREADS :         // same as GxB_NTHREADS
 
             ivalue = GB_Context_nthreads_max_get (Context) ;
@@ -65,6 +70,7 @@ GrB_Info GxB_Context_get_Scalar
     {
 
         case GxB_CONTEXT_CHUNK :         // same as GxB_CHUNK
+        case GxB_CONTEXT_WORKSPACE_MAX :
 
             info = GB_setElement ((GrB_Matrix) value, NULL, &dvalue, 0, 0,
                 GB_FP64_code, Werk) ;
@@ -84,6 +84,11 @@ GrB_Info GxB_Context_set_FP64       // set a parameter in a Context
             GB_Context_chunk_set (Context, value) ;
             break ;
 
+        case GxB_CONTEXT_WORKSPACE_MAX :
+
+            GB_Context_workspace_max_set (Context, value) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -150,6 +155,16 @@ GrB_Info GxB_Context_set            // set a parameter in a Context
             }
             break ;
 
+        case GxB_CONTEXT_WORKSPACE_MAX :
+
+            {
+                va_start (ap, field) ;
+                double value = va_arg (ap, double) ;
+                GB_Context_workspace_max_set (Context, value) ;
+                va_end (ap) ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
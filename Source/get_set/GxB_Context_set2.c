@@ -47,6 +47,7 @@ GrB_Info GxB_Context_set_Scalar
             break ;
 
         case GxB_CONTEXT_CHUNK :            // same as GxB_CHUNK
+        case GxB_CONTEXT_WORKSPACE_MAX :
             info = GrB_Scalar_extractElement_FP64 (&dvalue, value) ;
             break ;
 
@@ -78,6 +79,11 @@ GrB_Info GxB_Context_set_Scalar
 
             GB_Context_chunk_set (Context, dvalue) ;
             break ;
+
+        case GxB_CONTEXT_WORKSPACE_MAX :
+
+            GB_Context_workspace_max_set (Context, dvalue) ;
+            break ;
     }
 
     return (GrB_SUCCESS) ;
@@ -37,10 +37,11 @@ GrB_Info GxB_Matrix_Option_set_INT32    // set an option in a matrix
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
-    GB_WHERE (A, "GxB_Matrix_Option_set_INT32 (A, field, value)") ;
+    GB_WHERE_LOGGER (A, "GxB_Matrix_Option_set_INT32 (A, field, value)") ;
     GB_BURBLE_START ("GxB_set") ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
     ASSERT_MATRIX_OK (A, "A to set option", GB0) ;
+    GB_OK (GB_unmap (A)) ;
 
     //--------------------------------------------------------------------------
     // set the matrix option
@@ -107,10 +108,11 @@ GrB_Info GxB_Matrix_Option_set_FP64     // set an option in a matrix
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
-    GB_WHERE (A, "GxB_Matrix_Option_set_FP64 (A, field, value)") ;
+    GB_WHERE_LOGGER (A, "GxB_Matrix_Option_set_FP64 (A, field, value)") ;
     GB_BURBLE_START ("GxB_set") ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
     ASSERT_MATRIX_OK (A, "A to set option", GB0) ;
+    GB_OK (GB_unmap (A)) ;
 
     //--------------------------------------------------------------------------
     // set the matrix option
@@ -162,10 +164,11 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
-    GB_WHERE (A, "GxB_Matrix_Option_set (A, field, value)") ;
+    GB_WHERE_LOGGER (A, "GxB_Matrix_Option_set (A, field, value)") ;
     GB_BURBLE_START ("GxB_set") ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
     ASSERT_MATRIX_OK (A, "A to set option", GB0) ;
+    GB_OK (GB_unmap (A)) ;
 
     //--------------------------------------------------------------------------
     // set the matrix option
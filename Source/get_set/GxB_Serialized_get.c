@@ -8,8 +8,19 @@
 //------------------------------------------------------------------------------
 
 #include "get_set/GB_get_set.h"
+#include "jitifyer/GB_jitifyer.h"
 #include "serialize/GB_serialize.h"
 
+// The GxB_BLOB_CHECKSUM of a blob is a digest of all of the checksums of its
+// blocks, in order, or zero if the blob has no checksums.
+#define GB_DIGEST(h)                                                    \
+{                                                                       \
+    uint64_t pair [2] ;                                                 \
+    pair [0] = (*digest) ;                                              \
+    memcpy (&(pair [1]), h, sizeof (uint64_t)) ;                        \
+    (*digest) = GB_jitifyer_hash (pair, 2 * sizeof (uint64_t), true) ;  \
+}
+
 //------------------------------------------------------------------------------
 // GB_blob_header_get: get all properties of the blob
 //------------------------------------------------------------------------------
@@ -27,6 +38,7 @@ static GrB_Info GB_blob_header_get
     int32_t *storage,           // GrB_COLMAJOR or GrB_ROWMAJOR
     char **user_name,           // GrB_NAME of the blob
     char **eltype_string,       // GrB_EL_TYPE_STRING of the type of the blob
+    uint64_t *digest,           // digest of the checksums of the blob
 
     // input, not modified:
     const GB_void *blob,        // the blob
@@ -50,7 +62,10 @@ static GrB_Info GB_blob_header_get
     GB_BLOB_READ (typecode, int32_t) ;
     uint64_t blob_size1 = (uint64_t) blob_size ;
 
-    if (blob_size1 != blob_size2
+    // a blob_size2 of zero denotes a streamed blob (see GB_serialize.h)
+    bool streamed = (blob_size2 == 0) ;
+
+    if ((!streamed && blob_size1 != blob_size2)
         || typecode < GB_BOOL_code || typecode > GB_UDT_code
         || (typecode == GB_UDT_code &&
             blob_size < GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN))
@@ -81,6 +96,11 @@ static GrB_Info GB_blob_header_get
     GB_BLOB_READ (Ci_nblocks, int32_t) ; GB_BLOB_READ (Ci_method, int32_t) ;
     GB_BLOB_READ (Cx_nblocks, int32_t) ; GB_BLOB_READ (Cx_method, int32_t) ;
 
+    bool aligned = ((sparsity_iso_csc & GB_BLOB_ALIGNED) != 0) ;
+    bool checksum = ((sparsity_iso_csc & GB_BLOB_CHECKSUM) != 0) ;
+    bool has_delta = ((sparsity_iso_csc & GB_BLOB_DELTA) != 0) ;
+    (*digest) = 0 ;
+    sparsity_iso_csc = sparsity_iso_csc & (GB_BLOB_ALIGNED - 1) ;
     (*sparsity_status) = sparsity_iso_csc / 4 ;
     bool iso = ((sparsity_iso_csc & 2) == 2) ;
     bool is_csc = ((sparsity_iso_csc & 1) == 1) ;
@@ -113,47 +133,135 @@ static GrB_Info GB_blob_header_get
     // this should already be in the blob, but set it to null just in case
     type_name [GxB_MAX_NAME_LEN-1] = '\0' ;
 
-    //--------------------------------------------------------------------------
-    // get the compressed block sizes from the blob for each array
-    //--------------------------------------------------------------------------
-
-    GB_BLOB_READS (Cp_Sblocks, Cp_nblocks) ;
-    GB_BLOB_READS (Ch_Sblocks, Ch_nblocks) ;
-    GB_BLOB_READS (Cb_Sblocks, Cb_nblocks) ;
-    GB_BLOB_READS (Ci_Sblocks, Ci_nblocks) ;
-    GB_BLOB_READS (Cx_Sblocks, Cx_nblocks) ;
+    // Each array of a blob starts at an aligned offset, if it is aligned.
 
-    //--------------------------------------------------------------------------
-    // skip past each array (Cp, Ch, Cb, Ci, and Cx)
-    //--------------------------------------------------------------------------
+    #define GB_BLOB_SKIP(CX)                                                \
+    {                                                                       \
+        if (aligned) s = GB_BLOB_ALIGN (s) ;                                \
+        s += (CX ## _nblocks > 0) ? CX ## _Sblocks [CX ## _nblocks-1] : 0 ; \
+    }
 
-    switch (*sparsity_status)
+    if (streamed)
     {
-        case GxB_HYPERSPARSE : 
-            // skip Cp, Ch, and Ci
-            s += (Cp_nblocks > 0) ? Cp_Sblocks [Cp_nblocks-1] : 0 ;
-            s += (Ch_nblocks > 0) ? Ch_Sblocks [Ch_nblocks-1] : 0 ;
-            s += (Ci_nblocks > 0) ? Ci_Sblocks [Ci_nblocks-1] : 0 ;
-            break ;
-
-        case GxB_SPARSE : 
-            // skip Cp and Ci
-            s += (Cp_nblocks > 0) ? Cp_Sblocks [Cp_nblocks-1] : 0 ;
-            s += (Ci_nblocks > 0) ? Ci_Sblocks [Ci_nblocks-1] : 0 ;
-            break ;
-
-        case GxB_BITMAP : 
-            // skip Cb
-            s += (Cb_nblocks > 0) ? Cb_Sblocks [Cb_nblocks-1] : 0 ;
-            break ;
-
-        case GxB_FULL : 
-            break ;
-        default: ;
+
+        //----------------------------------------------------------------------
+        // skip past the block records of each array of a streamed blob
+        //----------------------------------------------------------------------
+
+        int64_t X_len_list [5] = { Cp_len, Ch_len, Cb_len, Ci_len, Cx_len } ;
+        for (int k = 0 ; k < 5 ; k++)
+        {
+            int64_t X_len = X_len_list [k] ;
+            for (int64_t len = 0 ; len < X_len ; )
+            {
+                int64_t record [3] ;
+                if (s + GB_STREAM_RECORD_SIZE > blob_size)
+                { 
+                    // blob is invalid
+                    return (GrB_INVALID_OBJECT) ;
+                }
+                memcpy (record, blob + s, GB_STREAM_RECORD_SIZE) ;
+                s += GB_STREAM_RECORD_SIZE ;
+                if (checksum)
+                {
+                    // fold the checksum of the block into the digest
+                    if (s + GB_STREAM_CHECKSUM_SIZE > blob_size)
+                    { 
+                        // blob is invalid
+                        return (GrB_INVALID_OBJECT) ;
+                    }
+                    GB_DIGEST (blob + s) ;
+                    s += GB_STREAM_CHECKSUM_SIZE ;
+                }
+                if (record [0] <= 0 || record [1] < 0 ||
+                    record [1] > (int64_t) (blob_size - s))
+                { 
+                    // blob is invalid
+                    return (GrB_INVALID_OBJECT) ;
+                }
+                len += record [0] ;
+                s += record [1] ;
+            }
+        }
     }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // get the compressed block sizes from the blob for each array
+        //----------------------------------------------------------------------
+
+        GB_BLOB_READS (Cp_Sblocks, Cp_nblocks) ;
+        GB_BLOB_READS (Ch_Sblocks, Ch_nblocks) ;
+        GB_BLOB_READS (Cb_Sblocks, Cb_nblocks) ;
+        GB_BLOB_READS (Ci_Sblocks, Ci_nblocks) ;
+        GB_BLOB_READS (Cx_Sblocks, Cx_nblocks) ;
+
+        //----------------------------------------------------------------------
+        // fold the checksums of all arrays into the digest, if present
+        //----------------------------------------------------------------------
+
+        if (checksum)
+        {
+            int64_t nchecksums =
+                GB_CHECKSUM_COUNT (Cp_len, Cp_nblocks, Cp_method) +
+                GB_CHECKSUM_COUNT (Ch_len, Ch_nblocks, Ch_method) +
+                GB_CHECKSUM_COUNT (Cb_len, Cb_nblocks, Cb_method) +
+                GB_CHECKSUM_COUNT (Ci_len, Ci_nblocks, Ci_method) +
+                GB_CHECKSUM_COUNT (Cx_len, Cx_nblocks, Cx_method) ;
+            if (nchecksums < 0 ||
+                s + nchecksums * sizeof (uint64_t) > blob_size)
+            { 
+                // blob is invalid
+                return (GrB_INVALID_OBJECT) ;
+            }
+            for (int64_t k = 0 ; k < nchecksums ; k++)
+            { 
+                GB_DIGEST (blob + s) ;
+                s += sizeof (uint64_t) ;
+            }
+        }
+
+        // skip the delta section, if present
+        GB_BLOB_READ_DELTA (Delta) ;
+        if (s > blob_size)
+        { 
+            // blob is invalid
+            return (GrB_INVALID_OBJECT) ;
+        }
+
+        //----------------------------------------------------------------------
+        // skip past each array (Cp, Ch, Cb, Ci, and Cx)
+        //----------------------------------------------------------------------
+
+        switch (*sparsity_status)
+        {
+            case GxB_HYPERSPARSE : 
+                // skip Cp, Ch, and Ci
+                GB_BLOB_SKIP (Cp) ;
+                GB_BLOB_SKIP (Ch) ;
+                GB_BLOB_SKIP (Ci) ;
+                break ;
+
+            case GxB_SPARSE : 
+                // skip Cp and Ci
+                GB_BLOB_SKIP (Cp) ;
+                GB_BLOB_SKIP (Ci) ;
+                break ;
+
+            case GxB_BITMAP : 
+                // skip Cb
+                GB_BLOB_SKIP (Cb) ;
+                break ;
 
-    // skip Cx
-    s += (Cx_nblocks > 0) ? Cx_Sblocks [Cx_nblocks-1] : 0 ;
+            case GxB_FULL : 
+                break ;
+            default: ;
+        }
+
+        // skip Cx
+        GB_BLOB_SKIP (Cx) ;
+    }
 
     //--------------------------------------------------------------------------
     // get the GrB_NAME and GrB_EL_TYPE_STRING
@@ -226,10 +334,11 @@ GrB_Info GxB_Serialized_get_Scalar
     char type_name [GxB_MAX_NAME_LEN], *user_name, *eltype_string ;
     int32_t sparsity_status, sparsity_ctrl, type_code, storage ;
     double hyper_sw, bitmap_sw ;
+    uint64_t digest ;
 
     GrB_Info info = GB_blob_header_get (type_name, &type_code, &sparsity_status,
         &sparsity_ctrl, &hyper_sw, &bitmap_sw, &storage,
-        &user_name, &eltype_string, blob, blob_size) ;
+        &user_name, &eltype_string, &digest, blob, blob_size) ;
 
     //--------------------------------------------------------------------------
     // get the field
@@ -328,10 +437,11 @@ GrB_Info GxB_Serialized_get_String
     char type_name [GxB_MAX_NAME_LEN], *user_name, *eltype_string ;
     int32_t sparsity_status, sparsity_ctrl, type_code, storage ;
     double hyper_sw, bitmap_sw ;
+    uint64_t digest ;
 
     GrB_Info info = GB_blob_header_get (type_name, &type_code, &sparsity_status,
         &sparsity_ctrl, &hyper_sw, &bitmap_sw, &storage,
-        &user_name, &eltype_string, blob, blob_size) ;
+        &user_name, &eltype_string, &digest, blob, blob_size) ;
 
     //--------------------------------------------------------------------------
     // get the field
@@ -400,10 +510,11 @@ GrB_Info GxB_Serialized_get_INT32
     char type_name [GxB_MAX_NAME_LEN], *user_name, *eltype_string ;
     int32_t sparsity_status, sparsity_ctrl, type_code, storage ;
     double hyper_sw, bitmap_sw ;
+    uint64_t digest ;
 
     GrB_Info info = GB_blob_header_get (type_name, &type_code, &sparsity_status,
         &sparsity_ctrl, &hyper_sw, &bitmap_sw, &storage,
-        &user_name, &eltype_string, blob, blob_size) ;
+        &user_name, &eltype_string, &digest, blob, blob_size) ;
 
     //--------------------------------------------------------------------------
     // get the field
@@ -475,10 +586,11 @@ GrB_Info GxB_Serialized_get_SIZE
     char type_name [GxB_MAX_NAME_LEN], *user_name, *eltype_string ;
     int32_t sparsity_status, sparsity_ctrl, type_code, storage ;
     double hyper_sw, bitmap_sw ;
+    uint64_t digest ;
 
     GrB_Info info = GB_blob_header_get (type_name, &type_code, &sparsity_status,
         &sparsity_ctrl, &hyper_sw, &bitmap_sw, &storage,
-        &user_name, &eltype_string, blob, blob_size) ;
+        &user_name, &eltype_string, &digest, blob, blob_size) ;
 
     //--------------------------------------------------------------------------
     // get the field
@@ -504,6 +616,10 @@ GrB_Info GxB_Serialized_get_SIZE
                     1 : (strlen (eltype_string) + 1) ;
                 break ;
 
+            case GxB_BLOB_CHECKSUM : 
+                (*value) = (size_t) digest ;
+                break ;
+
             default : 
                 return (GrB_INVALID_VALUE) ;
         }
@@ -37,7 +37,7 @@ GrB_Info GxB_Vector_Option_set_INT32    // set an option in a vector
     //--------------------------------------------------------------------------
 
     GrB_Info info = GrB_SUCCESS ;
-    GB_WHERE (v, "GxB_Vector_Option_set_INT32 (v, field, value)") ;
+    GB_WHERE_LOGGER (v, "GxB_Vector_Option_set_INT32 (v, field, value)") ;
     GB_BURBLE_START ("GxB_set (vector option)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (v) ;
     ASSERT_VECTOR_OK (v, "v to set option", GB0) ;
@@ -86,7 +86,7 @@ GrB_Info GxB_Vector_Option_set_FP64    // set an option in a vector
     //--------------------------------------------------------------------------
 
     GrB_Info info = GrB_SUCCESS ;
-    GB_WHERE (v, "GxB_Vector_Option_set_FP64 (v, field, value)") ;
+    GB_WHERE_LOGGER (v, "GxB_Vector_Option_set_FP64 (v, field, value)") ;
     GB_BURBLE_START ("GxB_set (vector option)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (v) ;
     ASSERT_VECTOR_OK (v, "v to set option", GB0) ;
@@ -135,7 +135,7 @@ GrB_Info GxB_Vector_Option_set      // set an option in a vector
     //--------------------------------------------------------------------------
 
     GrB_Info info = GrB_SUCCESS ;
-    GB_WHERE (v, "GxB_Vector_Option_set (v, field, value)") ;
+    GB_WHERE_LOGGER (v, "GxB_Vector_Option_set (v, field, value)") ;
     GB_BURBLE_START ("GxB_set (vector option)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (v) ;
     ASSERT_VECTOR_OK (v, "v to set option", GB0) ;
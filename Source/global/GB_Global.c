@@ -40,6 +40,23 @@ typedef struct
     bool is_csc ;               // default CSR/CSC format for new matrices
     int64_t hyper_hash ;        // controls when A->Y hyper_hash is created
 
+    //--------------------------------------------------------------------------
+    // C=A*B method selection
+    //--------------------------------------------------------------------------
+
+    int axb_tune ;              // GxB_AxB_TUNE_OFF, _CALIBRATED, or _ONLINE
+    double axb_dot2_ratio ;     // use dot2 for C=A'*B if cnz < ratio*(anz+bnz)
+    bool axb_calibrated ;       // true if axb_dot2_ratio has been calibrated
+
+    //--------------------------------------------------------------------------
+    // assembly of pending tuples
+    //--------------------------------------------------------------------------
+
+    int64_t background_wait ;   // # of pending tuples to start a background
+                                // assembly; 0 if disabled
+    int64_t pending_combine ;   // max # of distinct pending tuples combined
+                                // on insert; 0 if disabled
+
     //--------------------------------------------------------------------------
     // abort function: only used for debugging
     //--------------------------------------------------------------------------
@@ -178,6 +195,15 @@ static GB_Global_struct GB_Global =
 
     .hyper_hash = GB_HYPER_HASH_DEFAULT,
 
+    // C=A*B method selection
+    .axb_tune = GxB_AxB_TUNE_OFF,
+    .axb_dot2_ratio = GB_AXB_DOT2_RATIO_DEFAULT,
+    .axb_calibrated = false,
+
+    // assembly of pending tuples
+    .background_wait = GB_BACKGROUND_WAIT_DEFAULT,
+    .pending_combine = GB_PENDING_COMBINE_DEFAULT,
+
     // abort function for debugging only
     .abort_function   = abort,
 
@@ -359,6 +385,68 @@ int64_t GB_Global_hyper_hash_get (void)
     return (GB_Global.hyper_hash) ;
 }
 
+//------------------------------------------------------------------------------
+// axb_tune, axb_dot2_ratio, axb_calibrated: C=A*B method selection
+//------------------------------------------------------------------------------
+
+void GB_Global_axb_tune_set (int axb_tune)
+{ 
+    GB_Global.axb_tune = axb_tune ;
+}
+
+int GB_Global_axb_tune_get (void)
+{ 
+    return (GB_Global.axb_tune) ;
+}
+
+void GB_Global_axb_dot2_ratio_set (double axb_dot2_ratio)
+{ 
+    GB_Global.axb_dot2_ratio = axb_dot2_ratio ;
+}
+
+double GB_Global_axb_dot2_ratio_get (void)
+{ 
+    return (GB_Global.axb_dot2_ratio) ;
+}
+
+void GB_Global_axb_calibrated_set (bool axb_calibrated)
+{ 
+    GB_Global.axb_calibrated = axb_calibrated ;
+}
+
+bool GB_Global_axb_calibrated_get (void)
+{ 
+    return (GB_Global.axb_calibrated) ;
+}
+
+//------------------------------------------------------------------------------
+// background_wait: background assembly of pending tuples
+//------------------------------------------------------------------------------
+
+void GB_Global_background_wait_set (int64_t background_wait)
+{ 
+    GB_Global.background_wait = background_wait ;
+}
+
+int64_t GB_Global_background_wait_get (void)
+{ 
+    return (GB_Global.background_wait) ;
+}
+
+//------------------------------------------------------------------------------
+// pending_combine: combine duplicate pending tuples on insert
+//------------------------------------------------------------------------------
+
+void GB_Global_pending_combine_set (int64_t pending_combine)
+{ 
+    GB_Global.pending_combine = pending_combine ;
+}
+
+int64_t GB_Global_pending_combine_get (void)
+{ 
+    return (GB_Global.pending_combine) ;
+}
+
 //------------------------------------------------------------------------------
 // bitmap_switch
 //------------------------------------------------------------------------------
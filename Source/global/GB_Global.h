@@ -33,6 +33,18 @@ float    GB_Global_hyper_switch_get (void) ;
 void     GB_Global_hyper_hash_set (int64_t hyper_hash) ;
 int64_t  GB_Global_hyper_hash_get (void) ;
 
+void     GB_Global_axb_tune_set (int axb_tune) ;
+int      GB_Global_axb_tune_get (void) ;
+void     GB_Global_axb_dot2_ratio_set (double axb_dot2_ratio) ;
+double   GB_Global_axb_dot2_ratio_get (void) ;
+void     GB_Global_axb_calibrated_set (bool axb_calibrated) ;
+bool     GB_Global_axb_calibrated_get (void) ;
+
+void     GB_Global_background_wait_set (int64_t background_wait) ;
+int64_t  GB_Global_background_wait_get (void) ;
+void     GB_Global_pending_combine_set (int64_t pending_combine) ;
+int64_t  GB_Global_pending_combine_get (void) ;
+
 void     GB_Global_bitmap_switch_set (int k, float b) ;
 float    GB_Global_bitmap_switch_get (int k) ;
 float    GB_Global_bitmap_switch_matrix_get
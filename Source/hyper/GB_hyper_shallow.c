@@ -56,6 +56,16 @@ GrB_Matrix GB_hyper_shallow         // return C
     C->Y_shallow = false ;
     C->no_hyper_hash = false ;  // C is sparse, this flag is not necessary
 
+    // C does not have a cached transpose, and does not own a memory mapping
+    C->AT = NULL ;
+    C->cache_AT = false ;
+    C->mapping = NULL ;
+    C->mapping_size = 0 ;
+    C->mapping_release = NULL ;
+
+    // C does not have concurrent setElement buffers
+    C->Ingest = NULL ;
+
     // flag all content of C as shallow
     C->p_shallow = true ;
     C->i_shallow = true ;
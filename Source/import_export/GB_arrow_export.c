@@ -0,0 +1,402 @@
+//------------------------------------------------------------------------------
+// GB_arrow_export: export and free a matrix as an ArrowArray and ArrowSchema
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The matrix A is exported with GB_export, and its arrays become the buffers
+// of the ArrowArray, with no copy.  The ArrowArray is a tree of up to 7 nodes:
+
+//      node 0: struct "+s", length nvec, with the children:
+//      node 1:     "id": int64 "l", length nvec (A->h), if A is hypersparse
+//      node 2:     "vectors": large list "+L", length nvec (A->p)
+//      node 3:         "entries": struct "+s", length nnz
+//      node 4:             "index": int64 "l", length nnz (A->i)
+//      node 5:             "value": length nnz (A->x)
+//      node 6:                 "item": float or double, length 2*nnz (A->x),
+//                              if A is complex
+
+// All nodes of the ArrowArray share a single holder, allocated with the
+// malloc function given to GrB_init or GxB_init, which holds the nodes, their
+// children and buffer pointers, and the 4 arrays exported from A.  The release
+// callback of each node releases its children that have not been moved by the
+// consumer, and the last node released frees the arrays of A and the holder.
+// The ArrowSchema is a tree of the same shape, with its own holder.
+
+#include "import_export/GB_export.h"
+#include "get_set/GB_get_set.h"
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_Global_free_function (array_holder) ;        \
+    GB_Global_free_function (schema_holder) ;       \
+}
+
+#define GB_ARROW_NODES 7
+
+typedef struct
+{
+    int64_t nreleased ;             // # of nodes released so far
+    int64_t nnodes ;                // # of nodes in the ArrowArray
+    void *content [4] ;             // Ap, Ah, Ai, and Ax exported from A
+    struct ArrowArray node [GB_ARROW_NODES] ;
+    struct ArrowArray *children [GB_ARROW_NODES] ;
+    const void *buffers [GB_ARROW_NODES][2] ;
+}
+GB_arrow_array_holder ;
+
+typedef struct
+{
+    int64_t nreleased ;             // # of nodes released so far
+    int64_t nnodes ;                // # of nodes in the ArrowSchema
+    struct ArrowSchema node [GB_ARROW_NODES] ;
+    struct ArrowSchema *children [GB_ARROW_NODES] ;
+    char value_format [32] ;        // format of the "value" field
+    char metadata [ ] ;             // metadata of node 0
+}
+GB_arrow_schema_holder ;
+
+//------------------------------------------------------------------------------
+// GB_arrow_array_release: release a node of the ArrowArray
+//------------------------------------------------------------------------------
+
+static void GB_arrow_array_release (struct ArrowArray *array)
+{
+    GB_arrow_array_holder *holder =
+        (GB_arrow_array_holder *) array->private_data ;
+    for (int64_t k = 0 ; k < array->n_children ; k++)
+    {
+        struct ArrowArray *child = array->children [k] ;
+        if (child->release != NULL)
+        {
+            // release a child that has not been moved by the consumer
+            child->release (child) ;
+        }
+    }
+    array->release = NULL ;
+    int64_t nreleased ;
+    GB_ATOMIC_CAPTURE_INC64 (nreleased, holder->nreleased) ;
+    if (nreleased + 1 == holder->nnodes)
+    {
+        // all nodes have been released
+        for (int k = 0 ; k < 4 ; k++)
+        {
+            GB_Global_free_function (holder->content [k]) ;
+        }
+        GB_Global_free_function (holder) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_arrow_schema_release: release a node of the ArrowSchema
+//------------------------------------------------------------------------------
+
+static void GB_arrow_schema_release (struct ArrowSchema *schema)
+{
+    GB_arrow_schema_holder *holder =
+        (GB_arrow_schema_holder *) schema->private_data ;
+    for (int64_t k = 0 ; k < schema->n_children ; k++)
+    {
+        struct ArrowSchema *child = schema->children [k] ;
+        if (child->release != NULL)
+        {
+            // release a child that has not been moved by the consumer
+            child->release (child) ;
+        }
+    }
+    schema->release = NULL ;
+    int64_t nreleased ;
+    GB_ATOMIC_CAPTURE_INC64 (nreleased, holder->nreleased) ;
+    if (nreleased + 1 == holder->nnodes)
+    {
+        // all nodes have been released
+        GB_Global_free_function (holder) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_arrow_metadata_put: append a key/value pair to the schema metadata
+//------------------------------------------------------------------------------
+
+// The metadata is an int32 count of the key/value pairs, followed by each
+// pair as an int32 length and the bytes of the key, then of the value.  If
+// metadata is NULL, the space required is returned but nothing is written.
+
+static size_t GB_arrow_metadata_put
+(
+    char *metadata,         // metadata to append to, or NULL
+    size_t len,             // current length of the metadata
+    const char *key,
+    const char *value
+)
+{
+    int32_t klen = (int32_t) strlen (key) ;
+    int32_t vlen = (int32_t) strlen (value) ;
+    if (metadata != NULL)
+    {
+        int32_t npairs ;
+        memcpy (&npairs, metadata, sizeof (int32_t)) ;
+        npairs++ ;
+        memcpy (metadata, &npairs, sizeof (int32_t)) ;
+        memcpy (metadata + len, &klen, sizeof (int32_t)) ;
+        memcpy (metadata + len + sizeof (int32_t), key, klen) ;
+        len += sizeof (int32_t) + klen ;
+        memcpy (metadata + len, &vlen, sizeof (int32_t)) ;
+        memcpy (metadata + len + sizeof (int32_t), value, vlen) ;
+        len += sizeof (int32_t) + vlen ;
+        return (len) ;
+    }
+    return (len + 2 * sizeof (int32_t) + klen + vlen) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_arrow_export
+//------------------------------------------------------------------------------
+
+GrB_Info GB_arrow_export            // export and free a matrix as Arrow
+(
+    // output:
+    struct ArrowArray *array,       // the content of A
+    struct ArrowSchema *schema,     // the layout and type of A
+    // input/output:
+    GrB_Matrix *A,                  // handle of matrix to export and free
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (array != NULL && schema != NULL) ;
+    ASSERT (A != NULL) ;
+    ASSERT_MATRIX_OK (*A, "A to export as Arrow", GB0) ;
+
+    GB_arrow_array_holder *array_holder = NULL ;
+    GB_arrow_schema_holder *schema_holder = NULL ;
+
+    //--------------------------------------------------------------------------
+    // finish any pending work, and ensure A is sparse or hypersparse
+    //--------------------------------------------------------------------------
+
+    // the exported matrix cannot be jumbled
+    GB_MATRIX_WAIT (*A) ;
+    if (GB_IS_BITMAP (*A) || GB_IS_FULL (*A))
+    {
+        GB_OK (GB_convert_any_to_sparse (*A, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the type and format of A
+    //--------------------------------------------------------------------------
+
+    GrB_Type atype = (*A)->type ;
+    const GB_Type_code code = atype->code ;
+    const bool is_hyper = GB_IS_HYPERSPARSE (*A) ;
+    const bool is_complex = (code == GB_FC32_code || code == GB_FC64_code) ;
+    const char *type_name = GB_type_name_get (atype) ;
+    if (type_name == NULL || type_name [0] == '\0')
+    {
+        type_name = atype->name ;
+    }
+    const char *format = (*A)->is_csc ?
+        (is_hyper ? "HyperCSC" : "CSC") : (is_hyper ? "HyperCSR" : "CSR") ;
+    char nrows_string [32], ncols_string [32] ;
+    snprintf (nrows_string, 32, GBd, GB_NROWS (*A)) ;
+    snprintf (ncols_string, 32, GBd, GB_NCOLS (*A)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the holders
+    //--------------------------------------------------------------------------
+
+    // The holders are allocated before A is exported, so that A is unchanged
+    // if out of memory.
+
+    size_t metadata_len = sizeof (int32_t) ;
+    metadata_len = GB_arrow_metadata_put (NULL, metadata_len,
+        "GraphBLAS.nrows", nrows_string) ;
+    metadata_len = GB_arrow_metadata_put (NULL, metadata_len,
+        "GraphBLAS.ncols", ncols_string) ;
+    metadata_len = GB_arrow_metadata_put (NULL, metadata_len,
+        "GraphBLAS.format", format) ;
+    metadata_len = GB_arrow_metadata_put (NULL, metadata_len,
+        "GraphBLAS.type", type_name) ;
+
+    array_holder = (GB_arrow_array_holder *)
+        GB_Global_malloc_function (sizeof (GB_arrow_array_holder)) ;
+    schema_holder = (GB_arrow_schema_holder *)
+        GB_Global_malloc_function (sizeof (GB_arrow_schema_holder)
+            + metadata_len) ;
+    if (array_holder == NULL || schema_holder == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    memset (array_holder, 0, sizeof (GB_arrow_array_holder)) ;
+    memset (schema_holder, 0, sizeof (GB_arrow_schema_holder)) ;
+
+    //--------------------------------------------------------------------------
+    // export A
+    //--------------------------------------------------------------------------
+
+    GrB_Type type ;
+    GrB_Index vlen, vdim, nvec = 0 ;
+    GrB_Index *Ap = NULL, *Ah = NULL, *Ai = NULL ;
+    void *Ax = NULL ;
+    GrB_Index Ap_size = 0, Ah_size = 0, Ai_size = 0, Ax_size = 0 ;
+    int sparsity ;
+    bool is_csc ;
+
+    info = GB_export (false, A, &type, &vlen, &vdim, false,
+        &Ap,  &Ap_size,     // Ap
+        &Ah,  &Ah_size,     // Ah
+        NULL, NULL,         // Ab
+        &Ai,  &Ai_size,     // Ai
+        &Ax,  &Ax_size,     // Ax
+        NULL, NULL, &nvec,  // not jumbled
+        &sparsity, &is_csc,
+        NULL, Werk) ;       // A is exported as non-iso
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory; A is unchanged
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+    if (sparsity != GxB_HYPERSPARSE)
+    {
+        nvec = vdim ;
+    }
+    int64_t nnz = (int64_t) Ap [nvec] ;
+
+    // GB_export removes the arrays from the debug memtable, but they are
+    // freed by GB_Global_free_function when the ArrowArray is released, like
+    // the holders, so they are added back.
+    GB_Global_memtable_add (Ap, Ap_size) ;
+    GB_Global_memtable_add (Ah, Ah_size) ;
+    GB_Global_memtable_add (Ai, Ai_size) ;
+    GB_Global_memtable_add (Ax, Ax_size) ;
+
+    //--------------------------------------------------------------------------
+    // construct the nodes of the ArrowArray and ArrowSchema
+    //--------------------------------------------------------------------------
+
+    array_holder->content [0] = Ap ;
+    array_holder->content [1] = Ah ;
+    array_holder->content [2] = Ai ;
+    array_holder->content [3] = Ax ;
+
+    // parent, length, content, name, and format of each node
+    int parent [GB_ARROW_NODES] = { -1, 0, 0, 2, 3, 3, 5 } ;
+    int64_t length [GB_ARROW_NODES] =
+        { nvec, nvec, nvec, nnz, nnz, nnz, 2*nnz } ;
+    const void *X [GB_ARROW_NODES] = { NULL, Ah, Ap, NULL, Ai, Ax, Ax } ;
+    const char *name [GB_ARROW_NODES] =
+        { "", "id", "vectors", "entries", "index", "value", "item" } ;
+    const char *fmt [GB_ARROW_NODES] =
+        { "+s", "l", "+L", "+s", "l", schema_holder->value_format,
+          (code == GB_FC32_code) ? "f" : "g" } ;
+    bool present [GB_ARROW_NODES] =
+        { true, is_hyper, true, true, true, true, is_complex } ;
+
+    char *value_format = schema_holder->value_format ;
+    switch (code)
+    {
+        case GB_BOOL_code   : strcpy (value_format, "C") ; break ;
+        case GB_INT8_code   : strcpy (value_format, "c") ; break ;
+        case GB_INT16_code  : strcpy (value_format, "s") ; break ;
+        case GB_INT32_code  : strcpy (value_format, "i") ; break ;
+        case GB_INT64_code  : strcpy (value_format, "l") ; break ;
+        case GB_UINT8_code  : strcpy (value_format, "C") ; break ;
+        case GB_UINT16_code : strcpy (value_format, "S") ; break ;
+        case GB_UINT32_code : strcpy (value_format, "I") ; break ;
+        case GB_UINT64_code : strcpy (value_format, "L") ; break ;
+        case GB_FP32_code   : strcpy (value_format, "f") ; break ;
+        case GB_FP64_code   : strcpy (value_format, "g") ; break ;
+        case GB_FC32_code   :
+        case GB_FC64_code   : strcpy (value_format, "+w:2") ; break ;
+        default             :
+            snprintf (value_format, 32, "w:%d", (int) type->size) ;
+            break ;
+    }
+
+    int nnodes = 0, nchildren = 0 ;
+    for (int k = 0 ; k < GB_ARROW_NODES ; k++)
+    {
+        if (!present [k]) continue ;
+        nnodes++ ;
+
+        // the ArrowArray node
+        struct ArrowArray *a = &(array_holder->node [k]) ;
+        a->length = length [k] ;
+        a->null_count = 0 ;
+        a->offset = 0 ;
+        // a struct, or a fixed-size list, has only a validity buffer
+        a->n_buffers = (k == 0 || k == 3 || (k == 5 && is_complex)) ? 1 : 2 ;
+        a->buffers = array_holder->buffers [k] ;
+        a->buffers [0] = NULL ;
+        a->buffers [1] = X [k] ;
+        a->n_children = 0 ;
+        a->children = NULL ;
+        a->dictionary = NULL ;
+        a->release = GB_arrow_array_release ;
+        a->private_data = array_holder ;
+
+        // the ArrowSchema node
+        struct ArrowSchema *s = &(schema_holder->node [k]) ;
+        s->format = fmt [k] ;
+        s->name = name [k] ;
+        s->metadata = (k == 0) ? schema_holder->metadata : NULL ;
+        s->flags = 0 ;
+        s->n_children = 0 ;
+        s->children = NULL ;
+        s->dictionary = NULL ;
+        s->release = GB_arrow_schema_release ;
+        s->private_data = schema_holder ;
+
+        // append the node to the children of its parent
+        int p = parent [k] ;
+        if (p >= 0)
+        {
+            struct ArrowArray *ap = &(array_holder->node [p]) ;
+            struct ArrowSchema *sp = &(schema_holder->node [p]) ;
+            if (ap->n_children == 0)
+            {
+                // the children of the parent start here
+                ap->children = &(array_holder->children [nchildren]) ;
+                sp->children = &(schema_holder->children [nchildren]) ;
+            }
+            ap->children [ap->n_children++] = a ;
+            sp->children [sp->n_children++] = s ;
+            nchildren++ ;
+        }
+    }
+    array_holder->nnodes = nnodes ;
+    schema_holder->nnodes = nnodes ;
+
+    // the metadata of the schema
+    char *metadata = schema_holder->metadata ;
+    memset (metadata, 0, sizeof (int32_t)) ;
+    size_t len = sizeof (int32_t) ;
+    len = GB_arrow_metadata_put (metadata, len, "GraphBLAS.nrows",
+        nrows_string) ;
+    len = GB_arrow_metadata_put (metadata, len, "GraphBLAS.ncols",
+        ncols_string) ;
+    len = GB_arrow_metadata_put (metadata, len, "GraphBLAS.format", format) ;
+    len = GB_arrow_metadata_put (metadata, len, "GraphBLAS.type", type_name) ;
+    ASSERT (len == metadata_len) ;
+
+    //--------------------------------------------------------------------------
+    // return the root nodes, moved out of the holders
+    //--------------------------------------------------------------------------
+
+    // The root nodes are moved to the caller's structs, and the children of
+    // the roots still point into the holders.
+    (*array) = array_holder->node [0] ;
+    (*schema) = schema_holder->node [0] ;
+    return (GrB_SUCCESS) ;
+}
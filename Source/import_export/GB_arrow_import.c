@@ -0,0 +1,512 @@
+//------------------------------------------------------------------------------
+// GB_arrow_import: import a matrix from an ArrowArray and ArrowSchema
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The ArrowArray and ArrowSchema must have the layout written by
+// GB_arrow_export (see GxB_Matrix_export_Arrow), although the nodes of the
+// ArrowArray may have non-zero offsets, and the GraphBLAS.format and
+// GraphBLAS.type metadata are optional.  The buffers of the ArrowArray become
+// shallow components of C, with no copy, and the ArrowArray is moved into
+// C->mapping, to be released by GB_mapping_free when C is freed or modified
+// (see GB_unmap).  Only a bit-packed boolean "value" field, "vectors" offsets
+// that do not start at zero, and empty buffers are replaced with arrays owned
+// by C.  The import takes O(1) time, plus the time to copy those arrays,
+// unless it is a secure import.
+
+// The caller's ArrowArray and ArrowSchema are not modified if an error is
+// returned.
+
+#include "import_export/GB_export.h"
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_Matrix_free (C) ;                            \
+    GB_FREE (&Ap_owned, Ap_owned_size) ;            \
+    GB_FREE (&Ah_owned, Ah_owned_size) ;            \
+    GB_FREE (&Ai_owned, Ai_owned_size) ;            \
+    GB_FREE (&Ax_owned, Ax_owned_size) ;            \
+    GB_FREE (&moved, moved_size) ;                  \
+}
+
+//------------------------------------------------------------------------------
+// GB_arrow_release: release the ArrowArray held by a matrix
+//------------------------------------------------------------------------------
+
+static void GB_arrow_release (void *mapping, size_t mapping_size)
+{
+    struct ArrowArray *array = (struct ArrowArray *) mapping ;
+    if (array->release != NULL)
+    {
+        array->release (array) ;
+    }
+    GB_FREE (&array, mapping_size) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_arrow_metadata_get: find a key in the schema metadata
+//------------------------------------------------------------------------------
+
+// Returns true if the key is found, and copies its value into the string
+// value, of size len.
+
+static bool GB_arrow_metadata_get
+(
+    char *value,                // value of the key
+    size_t len,                 // size of the value string
+    const char *metadata,       // schema metadata (see GB_arrow_export)
+    const char *key
+)
+{
+    if (metadata == NULL)
+    {
+        return (false) ;
+    }
+    int32_t npairs ;
+    memcpy (&npairs, metadata, sizeof (int32_t)) ;
+    const char *s = metadata + sizeof (int32_t) ;
+    for (int32_t k = 0 ; k < npairs ; k++)
+    {
+        int32_t klen, vlen ;
+        memcpy (&klen, s, sizeof (int32_t)) ;
+        const char *kstring = s + sizeof (int32_t) ;
+        s = kstring + klen ;
+        memcpy (&vlen, s, sizeof (int32_t)) ;
+        const char *vstring = s + sizeof (int32_t) ;
+        s = vstring + vlen ;
+        if (klen == (int32_t) strlen (key) && memcmp (kstring, key, klen) == 0)
+        {
+            if (vlen < 0 || (size_t) vlen >= len) return (false) ;
+            memcpy (value, vstring, vlen) ;
+            value [vlen] = '\0' ;
+            return (true) ;
+        }
+    }
+    return (false) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_arrow_node_ok: check a node of the ArrowArray against its schema
+//------------------------------------------------------------------------------
+
+static bool GB_arrow_node_ok
+(
+    const struct ArrowArray *a,
+    const struct ArrowSchema *s,
+    const char *format,         // required format, or NULL if checked already
+    int64_t n_buffers,          // required # of buffers
+    int64_t n_children          // required # of children
+)
+{
+    return (a != NULL && s != NULL && a->release != NULL
+        && (format == NULL || strcmp (s->format, format) == 0)
+        && a->n_buffers == n_buffers && a->n_children == n_children
+        && s->n_children == n_children
+        && a->length >= 0 && a->offset >= 0
+        // nulls are not allowed
+        && (a->null_count == 0 || a->buffers [0] == NULL)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_arrow_import
+//------------------------------------------------------------------------------
+
+GrB_Info GB_arrow_import            // import a matrix from Arrow
+(
+    // output:
+    GrB_Matrix *C,                  // handle of matrix to create
+    // input:
+    GrB_Type type,                  // type of C
+    struct ArrowArray *array,       // the content of C, moved into C
+    struct ArrowSchema *schema,     // the layout and type of C, released
+    bool fast_import,               // if true: trust the data
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL) ;
+    ASSERT (array != NULL && schema != NULL) ;
+    (*C) = NULL ;
+
+    int64_t *Ap_owned = NULL ; size_t Ap_owned_size = 0 ;
+    int64_t *Ah_owned = NULL ; size_t Ah_owned_size = 0 ;
+    int64_t *Ai_owned = NULL ; size_t Ai_owned_size = 0 ;
+    GB_void *Ax_owned = NULL ; size_t Ax_owned_size = 0 ;
+    struct ArrowArray *moved = NULL ; size_t moved_size = 0 ;
+
+    if (array->release == NULL || schema->release == NULL)
+    {
+        // the array or schema has already been released
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the nodes of the ArrowArray and ArrowSchema
+    //--------------------------------------------------------------------------
+
+    const struct ArrowArray *top = array ;
+    const struct ArrowSchema *top_s = schema ;
+    if (!GB_arrow_node_ok (top, top_s, "+s", 1, top->n_children)
+        || top->n_children < 1 || top->n_children > 2)
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+    const bool is_hyper = (top->n_children == 2) ;
+    const struct ArrowArray  *id    = is_hyper ? top->children [0] : NULL ;
+    const struct ArrowSchema *id_s  = is_hyper ? top_s->children [0] : NULL ;
+    const struct ArrowArray  *vec   = top->children [is_hyper ? 1 : 0] ;
+    const struct ArrowSchema *vec_s = top_s->children [is_hyper ? 1 : 0] ;
+    if ((is_hyper && !GB_arrow_node_ok (id, id_s, "l", 2, 0))
+        || !GB_arrow_node_ok (vec, vec_s, "+L", 2, 1))
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+    const struct ArrowArray  *ent   = vec->children [0] ;
+    const struct ArrowSchema *ent_s = vec_s->children [0] ;
+    if (!GB_arrow_node_ok (ent, ent_s, "+s", 1, 2))
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+    const struct ArrowArray  *idx   = ent->children [0] ;
+    const struct ArrowSchema *idx_s = ent_s->children [0] ;
+    const struct ArrowArray  *val   = ent->children [1] ;
+    const struct ArrowSchema *val_s = ent_s->children [1] ;
+    if (!GB_arrow_node_ok (idx, idx_s, "l", 2, 0) || val_s == NULL)
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the "value" field against the type of C
+    //--------------------------------------------------------------------------
+
+    GB_RETURN_IF_NULL_OR_FAULTY (type) ;
+    const GB_Type_code code = type->code ;
+    const size_t csize = type->size ;
+    const bool is_complex = (code == GB_FC32_code || code == GB_FC64_code) ;
+    bool is_bitpacked = false ;
+    const char *vf = val_s->format ;
+    bool ok ;
+    switch (code)
+    {
+        case GB_BOOL_code   :
+            is_bitpacked = (strcmp (vf, "b") == 0) ;
+            ok = is_bitpacked || (strcmp (vf, "C") == 0) ;  break ;
+        case GB_INT8_code   : ok = (strcmp (vf, "c") == 0) ; break ;
+        case GB_INT16_code  : ok = (strcmp (vf, "s") == 0) ; break ;
+        case GB_INT32_code  : ok = (strcmp (vf, "i") == 0) ; break ;
+        case GB_INT64_code  : ok = (strcmp (vf, "l") == 0) ; break ;
+        case GB_UINT8_code  : ok = (strcmp (vf, "C") == 0) ; break ;
+        case GB_UINT16_code : ok = (strcmp (vf, "S") == 0) ; break ;
+        case GB_UINT32_code : ok = (strcmp (vf, "I") == 0) ; break ;
+        case GB_UINT64_code : ok = (strcmp (vf, "L") == 0) ; break ;
+        case GB_FP32_code   : ok = (strcmp (vf, "f") == 0) ; break ;
+        case GB_FP64_code   : ok = (strcmp (vf, "g") == 0) ; break ;
+        case GB_FC32_code   :
+        case GB_FC64_code   : ok = (strcmp (vf, "+w:2") == 0) ; break ;
+        default             :
+            {
+                char udt_format [32] ;
+                snprintf (udt_format, 32, "w:%d", (int) csize) ;
+                ok = (strcmp (vf, udt_format) == 0) ;
+            }
+            break ;
+    }
+    if (!ok)
+    {
+        // the "value" field does not hold values of the type of C
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    const struct ArrowArray *item = NULL ;
+    if (is_complex)
+    {
+        // the values are held in the "item" child of the "value" field
+        const struct ArrowSchema *item_s = val_s->children [0] ;
+        item = val->children [0] ;
+        if (!GB_arrow_node_ok (val, val_s, NULL, 1, 1)
+            || !GB_arrow_node_ok (item, item_s,
+                (code == GB_FC32_code) ? "f" : "g", 2, 0))
+        {
+            return (GrB_INVALID_VALUE) ;
+        }
+    }
+    else if (!GB_arrow_node_ok (val, val_s, NULL, 2, 0))
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the dimensions and format of C
+    //--------------------------------------------------------------------------
+
+    char nrows_string [32], ncols_string [32], format [32] ;
+    if (!GB_arrow_metadata_get (nrows_string, 32, top_s->metadata,
+            "GraphBLAS.nrows")
+     || !GB_arrow_metadata_get (ncols_string, 32, top_s->metadata,
+            "GraphBLAS.ncols"))
+    {
+        // the dimensions of the matrix are required
+        return (GrB_INVALID_VALUE) ;
+    }
+    int64_t nrows = (int64_t) strtoll (nrows_string, NULL, 10) ;
+    int64_t ncols = (int64_t) strtoll (ncols_string, NULL, 10) ;
+    if (!GB_arrow_metadata_get (format, 32, top_s->metadata,
+        "GraphBLAS.format"))
+    {
+        // the format is optional
+        strcpy (format, is_hyper ? "HyperCSR" : "CSR") ;
+    }
+    bool is_csc ;
+    if (strcmp (format, is_hyper ? "HyperCSR" : "CSR") == 0)
+    {
+        is_csc = false ;
+    }
+    else if (strcmp (format, is_hyper ? "HyperCSC" : "CSC") == 0)
+    {
+        is_csc = true ;
+    }
+    else
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+    if (nrows < 0 || nrows > GB_NMAX || ncols < 0 || ncols > GB_NMAX)
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+    int64_t vlen = is_csc ? nrows : ncols ;
+    int64_t vdim = is_csc ? ncols : nrows ;
+
+    //--------------------------------------------------------------------------
+    // get the buffers
+    //--------------------------------------------------------------------------
+
+    // The offset of a struct applies to its children.
+    int64_t nvec = top->length ;
+    int64_t koffset = top->offset ;
+    if ((is_hyper && id->length < koffset + nvec)
+        || vec->length < koffset + nvec
+        || (!is_hyper && nvec != vdim) || (is_hyper && nvec > vdim))
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+    if (vec->buffers [1] == NULL || (is_hyper && id->buffers [1] == NULL
+        && nvec > 0))
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+    const int64_t *Ap =
+        ((const int64_t *) vec->buffers [1]) + vec->offset + koffset ;
+    const int64_t *Ah = (is_hyper && nvec > 0) ?
+        (((const int64_t *) id->buffers [1]) + id->offset + koffset) : NULL ;
+
+    // entries p0 to p0+nnz-1 of the "entries" struct hold the entries of C
+    int64_t p0 = Ap [0] ;
+    int64_t nnz = Ap [nvec] - p0 ;
+    if (p0 < 0 || nnz < 0 || ent->length < p0 + nnz
+        || idx->length < ent->offset + p0 + nnz
+        || val->length < ent->offset + p0 + nnz
+        || (is_complex && item->length < 2 * (val->offset + ent->offset
+            + p0 + nnz)))
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+    int64_t q0 = ent->offset + p0 ;
+    const int64_t *Ai = (const int64_t *) idx->buffers [1] ;
+    if (Ai != NULL) Ai += idx->offset + q0 ;
+    const GB_void *Ax ;
+    int64_t xoffset = 0 ;
+    if (is_complex)
+    {
+        Ax = (const GB_void *) item->buffers [1] ;
+        xoffset = 2 * (val->offset + q0) + item->offset ;
+        if (Ax != NULL) Ax += xoffset * (csize / 2) ;
+    }
+    else if (is_bitpacked)
+    {
+        Ax = (const GB_void *) val->buffers [1] ;
+        xoffset = val->offset + q0 ;
+    }
+    else
+    {
+        Ax = (const GB_void *) val->buffers [1] ;
+        if (Ax != NULL) Ax += (val->offset + q0) * csize ;
+    }
+
+    // the buffers must be aligned
+    size_t xalign = is_complex ? (csize / 2) : (code == GB_UDT_code) ? 1 :
+        (is_bitpacked ? 1 : csize) ;
+    if (((uintptr_t) Ap) % sizeof (int64_t) != 0
+        || ((uintptr_t) Ah) % sizeof (int64_t) != 0
+        || ((uintptr_t) Ai) % sizeof (int64_t) != 0
+        || ((uintptr_t) Ax) % xalign != 0)
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // replace buffers that cannot be used as-is
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int64_t k, p ;
+
+    if (p0 != 0 || (is_hyper && nvec == 0))
+    {
+        // Ap must start at zero, and a hypersparse C needs Ap [0:1]
+        int64_t aplen = GB_IMAX (nvec + 1, 2) ;
+        Ap_owned = GB_CALLOC (aplen, int64_t, &Ap_owned_size) ;
+        if (Ap_owned == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        int nthreads = GB_nthreads (nvec + 1, chunk, nthreads_max) ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k <= nvec ; k++)
+        {
+            Ap_owned [k] = Ap [k] - p0 ;
+        }
+        Ap = Ap_owned ;
+    }
+
+    if (is_hyper && (Ah == NULL || nvec == 0))
+    {
+        Ah_owned = GB_CALLOC (GB_IMAX (nvec, 1), int64_t, &Ah_owned_size) ;
+        if (Ah_owned == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        Ah = Ah_owned ;
+    }
+
+    if (Ai == NULL || nnz == 0)
+    {
+        // an empty index buffer
+        if (nnz > 0)
+        {
+            return (GrB_INVALID_VALUE) ;
+        }
+        Ai_owned = GB_CALLOC (1, int64_t, &Ai_owned_size) ;
+        if (Ai_owned == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        Ai = Ai_owned ;
+    }
+
+    if (Ax == NULL || nnz == 0 || is_bitpacked)
+    {
+        // an empty or bit-packed value buffer
+        if (Ax == NULL && nnz > 0)
+        {
+            return (GrB_INVALID_VALUE) ;
+        }
+        Ax_owned = GB_CALLOC (GB_IMAX (nnz, 1) * csize, GB_void,
+            &Ax_owned_size) ;
+        if (Ax_owned == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        if (is_bitpacked)
+        {
+            int nthreads = GB_nthreads (nnz, chunk, nthreads_max) ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (p = 0 ; p < nnz ; p++)
+            {
+                int64_t bit = xoffset + p ;
+                Ax_owned [p] = (Ax [bit / 8] >> (bit % 8)) & 1 ;
+            }
+        }
+        Ax = Ax_owned ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate space for the ArrowArray moved into C
+    //--------------------------------------------------------------------------
+
+    moved = GB_MALLOC (1, struct ArrowArray, &moved_size) ;
+    if (moved == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // import the matrix
+    //--------------------------------------------------------------------------
+
+    // The import is always fast here, since GB_import frees the content of C
+    // if the secure check fails, and the buffers are owned by the ArrowArray.
+    GrB_Index *Ap_in = (GrB_Index *) Ap ;
+    GrB_Index *Ah_in = (GrB_Index *) Ah ;
+    GrB_Index *Ai_in = (GrB_Index *) Ai ;
+    void *Ax_in = (void *) Ax ;
+    size_t Ap_size = (Ap == Ap_owned) ? Ap_owned_size :
+        ((nvec + 1) * sizeof (int64_t)) ;
+    size_t Ah_size = (Ah == Ah_owned) ? Ah_owned_size :
+        (nvec * sizeof (int64_t)) ;
+    size_t Ai_size = (Ai == Ai_owned) ? Ai_owned_size :
+        (nnz * sizeof (int64_t)) ;
+    size_t Ax_size = (Ax == Ax_owned) ? Ax_owned_size : (nnz * csize) ;
+    GB_OK (GB_import (false, C, type, vlen, vdim, false,
+        &Ap_in, Ap_size,                // Ap
+        is_hyper ? &Ah_in : NULL, Ah_size,  // Ah
+        NULL, 0,                        // Ab
+        &Ai_in, Ai_size,                // Ai
+        &Ax_in, Ax_size,                // Ax
+        0, false, nvec,                 // not jumbled
+        is_hyper ? GxB_HYPERSPARSE : GxB_SPARSE, is_csc,
+        false, true, false, Werk)) ;    // non-iso, fast, not in memtable
+
+    // the buffers of the ArrowArray are shallow; the owned arrays are not
+    GrB_Matrix A = (*C) ;
+    A->p_shallow = (Ap != Ap_owned) ;
+    A->h_shallow = is_hyper && (Ah != Ah_owned) ;
+    A->i_shallow = (Ai != Ai_owned) ;
+    A->x_shallow = (Ax != Ax_owned) ;
+    Ap_owned = NULL ;
+    Ah_owned = NULL ;
+    Ai_owned = NULL ;
+    Ax_owned = NULL ;
+
+    if (!fast_import)
+    {
+        // see GB_import
+        GBURBLE ("(secure import) ") ;
+        GB_OK (GB_import_check (A, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // move the ArrowArray into C, and release the schema
+    //--------------------------------------------------------------------------
+
+    (*moved) = (*array) ;
+    array->release = NULL ;
+    A->mapping = moved ;
+    A->mapping_size = moved_size ;
+    A->mapping_release = GB_arrow_release ;
+    moved = NULL ;
+    schema->release (schema) ;
+
+    ASSERT_MATRIX_OK (A, "C imported from Arrow", GB0) ;
+    return (GrB_SUCCESS) ;
+}
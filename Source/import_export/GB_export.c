@@ -111,6 +111,14 @@ GrB_Info GB_export      // export/unpack a matrix in any format
         default: ;
     }
 
+    //--------------------------------------------------------------------------
+    // copy A out of its memory mapping, if any
+    //--------------------------------------------------------------------------
+
+    // The arrays of A are given to the user application, so they cannot be
+    // shallow pointers into a memory-mapped file.
+    GB_OK (GB_unmap (*A)) ;
+
     //--------------------------------------------------------------------------
     // allocate new space for Ap and Ah if unpacking
     //--------------------------------------------------------------------------
@@ -56,6 +56,12 @@ GrB_Info GB_import      // import/pack a matrix in any format
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_import_check        // check an imported matrix
+(
+    GrB_Matrix A,               // matrix to check
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_export      // export/unpack a matrix in any format
 (
     bool unpacking,     // unpack if true, export and free if false
@@ -95,5 +101,55 @@ GrB_Info GB_export      // export/unpack a matrix in any format
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_import_borrowed     // import a matrix from borrowed arrays
+(
+    GrB_Matrix *C,              // handle of matrix to create
+    GrB_Type type,              // type of matrix to create
+    GrB_Index vlen,             // vector length
+    GrB_Index vdim,             // vector dimension
+    const GrB_Index *Ap,        // pointers
+    GrB_Index Ap_size,          // size of Ap in bytes
+    const GrB_Index *Ah,        // vector indices
+    GrB_Index Ah_size,          // size of Ah in bytes
+    const int8_t *Ab,           // bitmap
+    GrB_Index Ab_size,          // size of Ab in bytes
+    const GrB_Index *Ai,        // indices
+    GrB_Index Ai_size,          // size of Ai in bytes
+    const void *Ax,             // values
+    GrB_Index Ax_size,          // size of Ax in bytes
+    GrB_Index nvals,            // # of entries for bitmap format
+    GrB_Index nvec,             // size of Ah for hypersparse format
+    int sparsity,               // hypersparse, sparse, bitmap, or full
+    bool is_csc,                // if true then matrix is by-column, else by-row
+    bool iso,                   // if true then A is iso
+    bool jumbled,               // if true, sparse/hypersparse may be jumbled
+    GxB_release_function release,   // function to release the arrays
+    void *handle,               // user handle passed to release
+    bool fast_import,           // if true: trust the data, if false: check it
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_arrow_export            // export and free a matrix as Arrow
+(
+    // output:
+    struct ArrowArray *array,       // the content of A
+    struct ArrowSchema *schema,     // the layout and type of A
+    // input/output:
+    GrB_Matrix *A,                  // handle of matrix to export and free
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_arrow_import            // import a matrix from Arrow
+(
+    // output:
+    GrB_Matrix *C,                  // handle of matrix to create
+    // input:
+    GrB_Type type,                  // type of C
+    struct ArrowArray *array,       // the content of C, moved into C
+    struct ArrowSchema *schema,     // the layout and type of C, released
+    bool fast_import,               // if true: trust the data
+    GB_Werk Werk
+) ;
+
 #endif
 
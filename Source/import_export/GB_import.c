@@ -200,8 +200,10 @@ GrB_Info GB_import      // import/pack a matrix in any format
 
     if (packing)
     { 
-        // clear the content and reuse the header
+        // clear the content and reuse the header, and release any memory
+        // mapping, since all of the content of A is replaced
         GB_phybix_free (*A) ;
+        GB_mapping_free (*A) ;
         ASSERT (!((*A)->static_header)) ;
     }
 
@@ -362,9 +364,11 @@ GrB_Info GB_import      // import/pack a matrix in any format
         //
         // The time for this check is proportional to the size of the 5 input
         // arrays, far higher than the O(1) time for the fast import.  However,
-        // this check is essential if the input data is not trusted.
+        // this check is essential if the input data is not trusted.  It is
+        // done in parallel by GB_import_check, which returns the same result
+        // as GB_matvec_check, and also computes A->nvec_nonempty.
         GBURBLE ("(secure import) ") ;
-        GB_OK (GB_matvec_check (*A, "secure import", GxB_SILENT, NULL, "")) ;
+        GB_OK (GB_import_check (*A, Werk)) ;
     }
 
     //--------------------------------------------------------------------------
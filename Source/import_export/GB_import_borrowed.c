@@ -0,0 +1,146 @@
+//------------------------------------------------------------------------------
+// GB_import_borrowed: import a matrix from arrays owned by the user
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The arrays are imported with GB_import, but are not added to the debug
+// memtable, and are flagged as shallow components of C, so GraphBLAS never
+// frees or modifies them.  The user's release function and handle are held
+// in C->mapping, as if the arrays were a memory mapping: GB_unmap copies them
+// before C is modified, and GB_mapping_free calls the release function when C
+// no longer refers to them.
+
+#include "import_export/GB_export.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_Matrix_free (C) ;                    \
+    GB_FREE (&borrowed, borrowed_size) ;    \
+}
+
+typedef struct
+{
+    GxB_release_function release ;  // user function to release the arrays
+    void *handle ;                  // user handle passed to release
+}
+GB_borrowed_struct ;
+
+//------------------------------------------------------------------------------
+// GB_borrowed_release: release the arrays borrowed by a matrix
+//------------------------------------------------------------------------------
+
+static void GB_borrowed_release (void *mapping, size_t mapping_size)
+{
+    GB_borrowed_struct *borrowed = (GB_borrowed_struct *) mapping ;
+    if (borrowed->release != NULL)
+    { 
+        borrowed->release (borrowed->handle) ;
+    }
+    GB_FREE (&borrowed, mapping_size) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_import_borrowed
+//------------------------------------------------------------------------------
+
+GrB_Info GB_import_borrowed     // import a matrix from borrowed arrays
+(
+    GrB_Matrix *C,              // handle of matrix to create
+    GrB_Type type,              // type of matrix to create
+    GrB_Index vlen,             // vector length
+    GrB_Index vdim,             // vector dimension
+    const GrB_Index *Ap,        // pointers
+    GrB_Index Ap_size,          // size of Ap in bytes
+    const GrB_Index *Ah,        // vector indices
+    GrB_Index Ah_size,          // size of Ah in bytes
+    const int8_t *Ab,           // bitmap
+    GrB_Index Ab_size,          // size of Ab in bytes
+    const GrB_Index *Ai,        // indices
+    GrB_Index Ai_size,          // size of Ai in bytes
+    const void *Ax,             // values
+    GrB_Index Ax_size,          // size of Ax in bytes
+    GrB_Index nvals,            // # of entries for bitmap format
+    GrB_Index nvec,             // size of Ah for hypersparse format
+    int sparsity,               // hypersparse, sparse, bitmap, or full
+    bool is_csc,                // if true then matrix is by-column, else by-row
+    bool iso,                   // if true then A is iso
+    bool jumbled,               // if true, sparse/hypersparse may be jumbled
+    GxB_release_function release,   // function to release the arrays
+    void *handle,               // user handle passed to release
+    bool fast_import,           // if true: trust the data, if false: check it
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL) ;
+    (*C) = NULL ;
+    GB_borrowed_struct *borrowed = NULL ; size_t borrowed_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // allocate the holder of the release function
+    //--------------------------------------------------------------------------
+
+    borrowed = GB_MALLOC (1, GB_borrowed_struct, &borrowed_size) ;
+    if (borrowed == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    borrowed->release = release ;
+    borrowed->handle = handle ;
+
+    //--------------------------------------------------------------------------
+    // import the matrix
+    //--------------------------------------------------------------------------
+
+    // The import is always fast here, since GB_import frees the content of C
+    // if the secure check fails, and the arrays are owned by the user.
+    GrB_Index *Ap_in = (GrB_Index *) Ap ;
+    GrB_Index *Ah_in = (GrB_Index *) Ah ;
+    int8_t *Ab_in = (int8_t *) Ab ;
+    GrB_Index *Ai_in = (GrB_Index *) Ai ;
+    void *Ax_in = (void *) Ax ;
+    GB_OK (GB_import (false, C, type, vlen, vdim, false,
+        &Ap_in, Ap_size,        // Ap
+        &Ah_in, Ah_size,        // Ah
+        &Ab_in, Ab_size,        // Ab
+        &Ai_in, Ai_size,        // Ai
+        &Ax_in, Ax_size,        // Ax
+        nvals, jumbled, nvec,
+        sparsity, is_csc,
+        iso, true, false, Werk)) ;  // fast, not in memtable
+
+    // all imported arrays of C are borrowed from the user
+    GrB_Matrix A = (*C) ;
+    A->p_shallow = (A->p != NULL) ;
+    A->h_shallow = (A->h != NULL) ;
+    A->b_shallow = (A->b != NULL) ;
+    A->i_shallow = (A->i != NULL) ;
+    A->x_shallow = (A->x != NULL) ;
+
+    if (!fast_import)
+    { 
+        // see GB_import
+        GBURBLE ("(secure import) ") ;
+        GB_OK (GB_import_check (A, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // hold the release function in the mapping of C
+    //--------------------------------------------------------------------------
+
+    A->mapping = borrowed ;
+    A->mapping_size = borrowed_size ;
+    A->mapping_release = GB_borrowed_release ;
+    ASSERT_MATRIX_OK (A, "C imported from borrowed arrays", GB0) ;
+    return (GrB_SUCCESS) ;
+}
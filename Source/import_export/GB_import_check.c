@@ -0,0 +1,285 @@
+//------------------------------------------------------------------------------
+// GB_import_check: validate the content of a matrix for a secure import
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_import_check performs the same exhaustive check of an imported matrix as
+// GB_matvec_check (A, "secure import", GxB_SILENT, NULL, ""), and returns the
+// same error codes:  GrB_INDEX_OUT_OF_BOUNDS if the indices in a vector are
+// unsorted (for a matrix not declared as jumbled) or if adjacent indices are
+// duplicates, and GrB_INVALID_OBJECT for any other invalid content.  Unlike
+// GB_matvec_check, the checks are done in parallel, with inner loops that are
+// free of branches and data-dependent exits, so that they can be vectorized.
+
+// The checks of A->p and A->h are fused with the count of non-empty vectors,
+// and the check of the indices A->i is fused with the detection of sorted
+// vectors.  On success, A->nvec_nonempty is computed, and A->jumbled is
+// cleared if A was declared as jumbled but all of its vectors are sorted.
+
+// A is a newly imported matrix, with no zombies, pending tuples, or A->Y.
+// The arrays A->p, A->h, A->b, and A->i are not modified.
+
+#include "import_export/GB_export.h"
+#include "slice/GB_ek_slice.h"
+
+#define GB_FREE_ALL GB_WERK_POP (A_ek_slicing, int64_t) ;
+
+// flags for the check of the indices
+#define GB_OUT_OF_RANGE 1
+#define GB_UNSORTED     2
+#define GB_DUPLICATE    4
+
+GrB_Info GB_import_check        // check an imported matrix
+(
+    GrB_Matrix A,               // matrix to check
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (A != NULL && A->magic == GB_MAGIC) ;
+    ASSERT (A->Pending == NULL && A->nzombies == 0 && A->Y == NULL) ;
+    GB_WERK_DECLARE (A_ek_slicing, int64_t) ;
+
+    const int64_t avlen = A->vlen ;
+    const int64_t avdim = A->vdim ;
+    const int64_t anvec = A->nvec ;
+    const bool is_hyper = GB_IS_HYPERSPARSE (A) ;
+    const bool is_sparse = GB_IS_SPARSE (A) ;
+    const bool is_bitmap = GB_IS_BITMAP (A) ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+
+    if (avlen < 0 || avlen > GB_NMAX || avdim < 0 || avdim > GB_NMAX)
+    {
+        // invalid dimensions
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    if (A->iso && (A->x == NULL || A->x_size < A->type->size))
+    {
+        // invalid iso matrix
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // full case: only the structure needs to be checked
+    //--------------------------------------------------------------------------
+
+    if (!(is_hyper || is_sparse || is_bitmap))
+    {
+        if (!(anvec == avdim && A->plen == -1) || A->jumbled)
+        {
+            // invalid full structure
+            return (GrB_INVALID_OBJECT) ;
+        }
+        A->nvec_nonempty = (avlen == 0) ? 0 : avdim ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // bitmap case: check the values in A->b and count the entries
+    //--------------------------------------------------------------------------
+
+    if (is_bitmap)
+    {
+        if (!(anvec == avdim && A->plen == -1 && A->h == NULL && A->p == NULL
+            && A->i == NULL) || A->jumbled)
+        {
+            // invalid bitmap structure
+            return (GrB_INVALID_OBJECT) ;
+        }
+        const uint8_t *restrict Ab = (uint8_t *) A->b ;
+        const int64_t anz_held = GB_nnz_held (A) ;
+        if (anz_held > 0 && (Ab == NULL || A->b_size < anz_held))
+        {
+            // A->b is missing or too small
+            return (GrB_INVALID_OBJECT) ;
+        }
+        int nthreads = GB_nthreads (anz_held, chunk, nthreads_max) ;
+        int64_t cnt = 0 ;
+        int bad = 0 ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:cnt) reduction(|:bad)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t pstart, pend, my_cnt = 0 ;
+            int my_bad = 0 ;
+            GB_PARTITION (pstart, pend, anz_held, tid, nthreads) ;
+            GB_PRAGMA_SIMD_REDUCTION2 (+,my_cnt,|,my_bad)
+            for (int64_t p = pstart ; p < pend ; p++)
+            {
+                // a negative int8_t value becomes larger than 1 as uint8_t
+                uint8_t ab = Ab [p] ;
+                my_cnt += ab ;
+                my_bad |= (ab > 1) ;
+            }
+            cnt += my_cnt ;
+            bad |= my_bad ;
+        }
+        if (bad || cnt != GB_nnz (A))
+        {
+            // invalid bitmap value, or invalid entry count
+            return (GrB_INVALID_OBJECT) ;
+        }
+        A->nvec_nonempty = (avlen == 0) ? 0 : avdim ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sparse/hypersparse case: check the structure and the size of A->p, A->h
+    //--------------------------------------------------------------------------
+
+    if (is_sparse ? !(anvec == A->plen && A->plen == avdim) :
+        !(anvec >= 0 && anvec <= A->plen && A->plen <= avdim))
+    {
+        // invalid sparse/hypersparse structure
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    if (Ap == NULL || A->p_size < (A->plen + 1) * sizeof (int64_t) ||
+        (is_hyper && (Ah == NULL || A->h_size < A->plen * sizeof (int64_t))))
+    {
+        // A->p or A->h are missing or too small
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check A->p and A->h, and count the non-empty vectors
+    //--------------------------------------------------------------------------
+
+    // A->p must be monotonically non-decreasing, starting at zero, with
+    // A->p [anvec] no larger than the size of A->i.  A->h must be strictly
+    // increasing, in the range 0 to avdim-1.
+
+    const int64_t nzmax = A->i_size / sizeof (int64_t) ;
+    int64_t nvec_nonempty = 0 ;
+    int bad = (Ap [0] != 0) ;
+    if (is_hyper && anvec > 0)
+    {
+        bad |= (Ah [0] < 0) | (Ah [0] >= avdim) ;
+    }
+
+    int nthreads = GB_nthreads (anvec, chunk, nthreads_max) ;
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nvec_nonempty) reduction(|:bad)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t kstart, kend, my_nonempty = 0 ;
+        int my_bad = 0 ;
+        GB_PARTITION (kstart, kend, anvec, tid, nthreads) ;
+        GB_PRAGMA_SIMD_REDUCTION2 (+,my_nonempty,|,my_bad)
+        for (int64_t k = kstart ; k < kend ; k++)
+        {
+            int64_t pA_start = Ap [k] ;
+            int64_t pA_end = Ap [k+1] ;
+            my_bad |= (pA_end < pA_start) | (pA_end > nzmax) ;
+            my_nonempty += (pA_end > pA_start) ;
+        }
+        if (is_hyper)
+        {
+            // Ah [0] has already been checked
+            GB_PRAGMA_SIMD_REDUCTION (|,my_bad)
+            for (int64_t k = GB_IMAX (kstart, 1) ; k < kend ; k++)
+            {
+                int64_t j = Ah [k] ;
+                my_bad |= (j <= Ah [k-1]) | (j >= avdim) ;
+            }
+        }
+        nvec_nonempty += my_nonempty ;
+        bad |= my_bad ;
+    }
+
+    // GB_nnz (A) cannot be used until A->p has been checked
+    if (bad || Ap [anvec] != GB_nnz (A) || (nzmax > 0 && Ai == NULL))
+    {
+        // invalid A->p or A->h, or invalid entry count
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the indices, and determine if the vectors are sorted
+    //--------------------------------------------------------------------------
+
+    // Each index i = Ai [p] must be in the range 0 to avlen-1.  It is compared
+    // with the prior index in the same vector, to determine if the vector is
+    // sorted and if it has adjacent duplicates.  A->p is now known to be
+    // valid, so the entries can be sliced.
+
+    int flags = 0 ;
+    if (Ap [anvec] > 0)
+    {
+        int A_nthreads, A_ntasks ;
+        GB_SLICE_MATRIX (A, 8) ;
+
+        #pragma omp parallel for num_threads(A_nthreads) schedule(dynamic,1) \
+            reduction(|:flags)
+        for (tid = 0 ; tid < A_ntasks ; tid++)
+        {
+            int64_t kfirst = kfirst_Aslice [tid] ;
+            int64_t klast  = klast_Aslice  [tid] ;
+            int my_flags = 0 ;
+            for (int64_t k = kfirst ; k <= klast ; k++)
+            {
+                GB_GET_PA (pA_start, pA_end, tid, k,
+                    kfirst, klast, pstart_Aslice, Ap [k], Ap [k+1]) ;
+                if (pA_start >= pA_end) continue ;
+                if (pA_start == Ap [k])
+                {
+                    // the first entry in A(:,j) has no prior index
+                    my_flags |= (((uint64_t) Ai [pA_start]) >= avlen) ;
+                    pA_start++ ;
+                }
+                GB_PRAGMA_SIMD_REDUCTION (|,my_flags)
+                for (int64_t p = pA_start ; p < pA_end ; p++)
+                {
+                    int64_t i = Ai [p] ;
+                    int64_t ilast = Ai [p-1] ;
+                    my_flags |= (((uint64_t) i) >= avlen) * GB_OUT_OF_RANGE
+                              | (i <= ilast) * GB_UNSORTED
+                              | (i == ilast) * GB_DUPLICATE ;
+                }
+            }
+            flags |= my_flags ;
+        }
+
+        GB_FREE_ALL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    if (flags & GB_OUT_OF_RANGE)
+    {
+        // index out of range
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    if (A->jumbled ? (flags & GB_DUPLICATE) : (flags & GB_UNSORTED))
+    {
+        // indices unsorted, or duplicates present
+        return (GrB_INDEX_OUT_OF_BOUNDS) ;
+    }
+
+    if (!(flags & GB_UNSORTED))
+    {
+        // all vectors are sorted, even if A was declared as jumbled
+        A->jumbled = false ;
+    }
+    A->nvec_nonempty = nvec_nonempty ;
+    return (GrB_SUCCESS) ;
+}
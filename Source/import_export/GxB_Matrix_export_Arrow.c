@@ -0,0 +1,44 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_export_Arrow: export a matrix with the Arrow C Data Interface
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "import_export/GB_export.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GxB_Matrix_export_Arrow    // export and free a matrix as Arrow
+(
+    // output:
+    struct ArrowArray *array,       // the content of A
+    struct ArrowSchema *schema,     // the layout and type of A
+    // input/output:
+    GrB_Matrix *A,                  // handle of matrix to export and free
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs and get the descriptor
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_export_Arrow (array, schema, &A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_export_Arrow") ;
+    GB_RETURN_IF_NULL (array) ;
+    GB_RETURN_IF_NULL (schema) ;
+    GB_RETURN_IF_NULL (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (*A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // export the matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_arrow_export (array, schema, A, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,44 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_import_Arrow: import a matrix with the Arrow C Data Interface
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "import_export/GB_export.h"
+
+GrB_Info GxB_Matrix_import_Arrow    // import a matrix from Arrow
+(
+    // output:
+    GrB_Matrix *C,                  // handle of matrix to create
+    // input:
+    GrB_Type type,                  // type of C
+    struct ArrowArray *array,       // the content of C, moved into C
+    struct ArrowSchema *schema,     // the layout and type of C, released
+    const GrB_Descriptor desc       // secure or fast import
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs and get the descriptor
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_import_Arrow (&C, type, array, schema, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_import_Arrow") ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_RETURN_IF_NULL (array) ;
+    GB_RETURN_IF_NULL (schema) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (type) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_GET_DESCRIPTOR_IMPORT (desc, fast_import) ;
+
+    //--------------------------------------------------------------------------
+    // import the matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_arrow_import (C, type, array, schema, fast_import, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
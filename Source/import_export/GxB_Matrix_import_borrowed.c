@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_import_borrowed: import a matrix without taking ownership
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "import_export/GB_export.h"
+
+GrB_Info GxB_Matrix_import_borrowed     // import a matrix from borrowed arrays
+(
+    GrB_Matrix *C,          // handle of matrix to create
+    GrB_Type type,          // type of matrix to create
+    GrB_Index nrows,        // number of rows of the matrix
+    GrB_Index ncols,        // number of columns of the matrix
+    const GrB_Index *Ap,    // pointers (hypersparse and sparse)
+    const GrB_Index *Ah,    // vector indices (hypersparse)
+    const int8_t *Ab,       // bitmap (bitmap)
+    const GrB_Index *Ai,    // indices (hypersparse and sparse)
+    const void *Ax,         // values (all formats)
+    GrB_Index Ap_size,      // size of Ap in bytes
+    GrB_Index Ah_size,      // size of Ah in bytes
+    GrB_Index Ab_size,      // size of Ab in bytes
+    GrB_Index Ai_size,      // size of Ai in bytes
+    GrB_Index Ax_size,      // size of Ax in bytes
+    GrB_Index nvals,        // # of entries (bitmap)
+    GrB_Index nvec,         // # of vectors in Ah (hypersparse)
+    int sparsity,           // GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP, or
+                            // GxB_FULL
+    bool by_col,            // if true, C is held by column, else by row
+    bool iso,               // if true, C is iso
+    bool jumbled,           // if true, indices in each vector may be unsorted
+    GxB_release_function release,   // function to release the arrays, or NULL
+    void *handle,           // user handle passed to release
+    const GrB_Descriptor desc       // secure or fast import
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs and get the descriptor
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_import_borrowed (&C, type, nrows, ncols, "
+        "Ap, Ah, Ab, Ai, Ax, Ap_size, Ah_size, Ab_size, Ai_size, Ax_size, "
+        "nvals, nvec, sparsity, by_col, iso, jumbled, release, handle, "
+        "desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_import_borrowed") ;
+    GB_RETURN_IF_NULL (C) ;
+    (*C) = NULL ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_GET_DESCRIPTOR_IMPORT (desc, fast_import) ;
+    if (!(sparsity == GxB_HYPERSPARSE || sparsity == GxB_SPARSE ||
+          sparsity == GxB_BITMAP || sparsity == GxB_FULL))
+    { 
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // import the matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_import_borrowed (C, type,
+        by_col ? nrows : ncols,     // vlen
+        by_col ? ncols : nrows,     // vdim
+        Ap, Ap_size, Ah, Ah_size, Ab, Ab_size, Ai, Ai_size, Ax, Ax_size,
+        nvals, nvec, sparsity, by_col, iso, jumbled, release, handle,
+        fast_import, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -145,6 +145,7 @@
     // no #pragma omp simd is available in MS Visual Studio
     #define GB_PRAGMA_SIMD
     #define GB_PRAGMA_SIMD_REDUCTION(op,s)
+    #define GB_PRAGMA_SIMD_REDUCTION2(op1,s1,op2,s2)
 
 #else
 
@@ -153,9 +154,13 @@
     // create two kinds of SIMD pragmas:
     // GB_PRAGMA_SIMD becomes "#pragma omp simd"
     // GB_PRAGMA_SIMD_REDUCTION (+,cij) becomes
-    // "#pragma omp simd reduction(+:cij)"
+    // "#pragma omp simd reduction(+:cij)", and
+    // GB_PRAGMA_SIMD_REDUCTION2 (+,cnt,|,bad) becomes
+    // "#pragma omp simd reduction(+:cnt) reduction(|:bad)"
     #define GB_PRAGMA_SIMD GB_PRAGMA (omp simd)
     #define GB_PRAGMA_SIMD_REDUCTION(op,s) GB_PRAGMA (omp simd reduction(op:s))
+    #define GB_PRAGMA_SIMD_REDUCTION2(op1,s1,op2,s2) \
+        GB_PRAGMA (omp simd reduction(op1:s1) reduction(op2:s2))
 
 #endif
 
@@ -23,8 +23,18 @@
 // by default, give each thread at least 64K units of work to do
 #define GB_CHUNK_DEFAULT (64*1024)
 
+// C=A'*B with A and B sparse uses dot2 if the bitmap C is smaller than this
+// fraction of nnz(A)+nnz(B)
+#define GB_AXB_DOT2_RATIO_DEFAULT (1e-4)
+
 // initial size of the pending tuples
 #define GB_PENDING_INIT 256
 
+// pending tuples are not assembled in the background unless enabled
+#define GB_BACKGROUND_WAIT_DEFAULT 0
+
+// duplicate pending tuples are not combined on insert unless enabled
+#define GB_PENDING_COMBINE_DEFAULT 0
+
 #endif
 
@@ -82,6 +82,7 @@
     #include "include/GB_task_struct.h"
     #include "include/GB_callback_proto.h"
     #include "include/GB_saxpy3task_struct.h"
+    #include "include/GB_AxB_select_struct.h"
     #include "include/GB_callback.h"
     #include "include/GB_hyper_hash_lookup.h"
 
@@ -126,6 +127,7 @@
     #include "slice/include/GB_task_struct.h"
     #include "callback/include/GB_callback_proto.h"
     #include "mxm/include/GB_saxpy3task_struct.h"
+    #include "mxm/include/GB_AxB_select_struct.h"
     #include "callback/include/GB_callback.h"
     #include "hyper/include/GB_hyper_hash_lookup.h"
 
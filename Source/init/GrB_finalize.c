@@ -17,6 +17,8 @@
 
 GrB_Info GrB_finalize ( )
 { 
+    // free any workspace kept in GxB_CONTEXT_WORLD
+    GB_Context_saxpy3_workspace_free (GxB_CONTEXT_WORLD) ;
     GB_jitifyer_finalize ( ) ;
     return (GrB_SUCCESS) ;
 }
@@ -0,0 +1,247 @@
+//------------------------------------------------------------------------------
+// GB_edges_read: read a matrix from a binary edge list
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The file holds a list of edges, each a pair (i,j) of zero-based row and
+// column indices, as uint32_t (if index_size is 4) or uint64_t (if index_size
+// is 8), in native byte order, with no header.  The file is loaded into
+// memory (see GB_io_load), and the edges are copied in parallel directly into
+// the I_work and J_work arrays of GB_builder.  C(i,j) is true for each edge:
+// C is iso-valued, with a value of one typecasted to the type of C.
+// Duplicate edges are ignored.  If nrows (or ncols) is zero, C has one more
+// row (or column) than the largest row (or column) index in the file.
+
+#include "GB.h"
+#include "io/GB_io.h"
+#include "builder/GB_build.h"
+#include "jitifyer/GB_file.h"
+
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_file_munmap (mapping, data_size) ;       \
+    GB_FREE (&buffer, buffer_size) ;            \
+    GB_FREE (&I_work, I_work_size) ;            \
+    GB_FREE (&J_work, J_work_size) ;            \
+}
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORKSPACE ;                         \
+    GB_Matrix_free (&T) ;                       \
+    GB_Matrix_free (Chandle) ;                  \
+}
+
+GrB_Info GB_edges_read              // read a binary edge list
+(
+    // output:
+    GrB_Matrix *Chandle,            // matrix created from the file
+    // input:
+    GrB_Type type,                  // type of C, or NULL for GrB_BOOL
+    int64_t nrows,                  // # of rows of C, or 0 to find it
+    int64_t ncols,                  // # of columns of C, or 0 to find it
+    const char *filename,           // file to read
+    size_t index_size,              // size of each index: 4 or 8 bytes
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Chandle != NULL) ;
+    ASSERT (filename != NULL) ;
+    ASSERT (index_size == 4 || index_size == 8) ;
+    (*Chandle) = NULL ;
+
+    const GB_void *data = NULL ; size_t data_size = 0 ;
+    void *mapping = NULL ;
+    GB_void *buffer = NULL ; size_t buffer_size = 0 ;
+    int64_t *I_work = NULL ; size_t I_work_size = 0 ;
+    int64_t *J_work = NULL ; size_t J_work_size = 0 ;
+    GB_void *no_S_work = NULL ; size_t S_work_size = 0 ;
+    struct GB_Matrix_opaque T_header ;
+    GrB_Matrix T = NULL ;
+
+    if (type == NULL)
+    {
+        type = GrB_BOOL ;
+    }
+    if (type->code == GB_UDT_code)
+    {
+        // the value one cannot be typecasted to a user-defined type
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // load the file
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_io_load (&data, &data_size, &mapping, &buffer, &buffer_size,
+        filename)) ;
+    if (data_size % (2 * index_size) != 0)
+    {
+        // the file does not hold a list of edges
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+    const int64_t nedges = (int64_t) (data_size / (2 * index_size)) ;
+    const uint32_t *restrict E32 = (const uint32_t *) data ;
+    const uint64_t *restrict E64 = (const uint64_t *) data ;
+
+    //--------------------------------------------------------------------------
+    // find the dimensions of C, if not given
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (nedges, chunk, nthreads_max) ;
+    int64_t e ;
+
+    if (nrows == 0 || ncols == 0)
+    {
+        GB_WERK_DECLARE (Work, uint64_t) ;
+        GB_WERK_PUSH (Work, 2 * nthreads, uint64_t) ;
+        if (Work == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t estart, eend ;
+            GB_PARTITION (estart, eend, nedges, tid, nthreads) ;
+            uint64_t my_imax = 0, my_jmax = 0 ;
+            for (int64_t k = estart ; k < eend ; k++)
+            {
+                uint64_t i = (index_size == 4) ? E32 [2*k] : E64 [2*k] ;
+                uint64_t j = (index_size == 4) ? E32 [2*k+1] : E64 [2*k+1] ;
+                my_imax = GB_IMAX (my_imax, i) ;
+                my_jmax = GB_IMAX (my_jmax, j) ;
+            }
+            Work [2*tid  ] = my_imax ;
+            Work [2*tid+1] = my_jmax ;
+        }
+        uint64_t imax = 0, jmax = 0 ;
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            imax = GB_IMAX (imax, Work [2*tid  ]) ;
+            jmax = GB_IMAX (jmax, Work [2*tid+1]) ;
+        }
+        GB_WERK_POP (Work, uint64_t) ;
+        if (imax >= GB_NMAX || jmax >= GB_NMAX)
+        { 
+            // an index is out of bounds
+            GB_FREE_ALL ;
+            return (GrB_INDEX_OUT_OF_BOUNDS) ;
+        }
+        if (nrows == 0 && nedges > 0) nrows = (int64_t) (imax + 1) ;
+        if (ncols == 0 && nedges > 0) ncols = (int64_t) (jmax + 1) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // create the output matrix
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_Matrix_new (Chandle, type, nrows, ncols)) ;
+    GrB_Matrix C = (*Chandle) ;
+    const bool is_csc = C->is_csc ;
+
+    //--------------------------------------------------------------------------
+    // copy the edges into the tuples
+    //--------------------------------------------------------------------------
+
+    int64_t ijslen = GB_IMAX (nedges, 1) ;
+    I_work = GB_MALLOC (ijslen, int64_t, &I_work_size) ;
+    J_work = GB_MALLOC (ijslen, int64_t, &J_work_size) ;
+    if (I_work == NULL || J_work == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    bool known_sorted = true, bad = false ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:known_sorted) reduction(||:bad)
+    for (e = 0 ; e < nedges ; e++)
+    {
+        uint64_t i = (index_size == 4) ? E32 [2*e] : E64 [2*e] ;
+        uint64_t j = (index_size == 4) ? E32 [2*e+1] : E64 [2*e+1] ;
+        bad = bad || (i >= (uint64_t) nrows) || (j >= (uint64_t) ncols) ;
+        int64_t iv = (int64_t) (is_csc ? i : j) ;
+        int64_t jv = (int64_t) (is_csc ? j : i) ;
+        I_work [e] = iv ;
+        J_work [e] = jv ;
+        if (e > 0)
+        {
+            // check if the edges are sorted
+            uint64_t ilast = (index_size == 4) ? E32 [2*e-2] : E64 [2*e-2] ;
+            uint64_t jlast = (index_size == 4) ? E32 [2*e-1] : E64 [2*e-1] ;
+            int64_t ivlast = (int64_t) (is_csc ? ilast : jlast) ;
+            int64_t jvlast = (int64_t) (is_csc ? jlast : ilast) ;
+            known_sorted = known_sorted &&
+                ((jvlast < jv) || (jvlast == jv && ivlast <= iv)) ;
+        }
+    }
+
+    if (bad)
+    {
+        // an index is out of bounds
+        GB_FREE_ALL ;
+        return (GrB_INDEX_OUT_OF_BOUNDS) ;
+    }
+
+    GB_file_munmap (mapping, data_size) ;
+    mapping = NULL ;
+    GB_FREE (&buffer, buffer_size) ;
+
+    //--------------------------------------------------------------------------
+    // build the matrix from the tuples
+    //--------------------------------------------------------------------------
+
+    bool one = true ;
+    GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+    GB_OK (GB_builder (
+        T,              // create T using a static header
+        GrB_BOOL,       // the type of T
+        C->vlen,        // T->vlen = C->vlen
+        C->vdim,        // T->vdim = C->vdim
+        is_csc,         // T has the same CSR/CSC format as C
+        &I_work,        // I_work_handle, becomes T->i on output
+        &I_work_size,
+        &J_work,        // J_work_handle, freed on output
+        &J_work_size,
+        &no_S_work,     // no S_work
+        &S_work_size,
+        known_sorted,   // tuples may or may not be sorted
+        false,          // there might be duplicates; look for them
+        ijslen,         // size of I_work and J_work
+        true,           // is_matrix: unused
+        NULL, NULL,     // original I,J tuples: not used here
+        (GB_void *) &one,   // iso value
+        true,           // T is iso
+        nedges,         // number of tuples
+        NULL,           // duplicates are ignored
+        GrB_BOOL,       // type of the iso value
+        true,           // burble is OK
+        Werk
+    )) ;
+
+    //--------------------------------------------------------------------------
+    // transplant and typecast T into C, and conform C
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_transplant_conform (C, C->type, &T, Werk)) ;
+    ASSERT_MATRIX_OK (C, "C read from edge list", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,59 @@
+//------------------------------------------------------------------------------
+// GB_io.h: definitions for reading and writing matrices in files
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#ifndef GB_IO_H
+#define GB_IO_H
+
+GrB_Info GB_io_load                 // load a file into memory
+(
+    // output:
+    const GB_void **data_handle,    // content of the file
+    size_t *data_size_handle,       // size of the file
+    void **mapping_handle,          // mapping of the file, or NULL
+    GB_void **buffer_handle,        // copy of the file, if it is not mapped
+    size_t *buffer_size_handle,     // allocated size of the copy
+    // input:
+    const char *filename            // file to load
+) ;
+
+GrB_Info GB_mtx_read                // read a Matrix Market file
+(
+    // output:
+    GrB_Matrix *Chandle,            // matrix created from the file
+    // input:
+    GrB_Type type,                  // type of C, or NULL to use the file
+    const char *filename,           // file to read
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_mtx_write               // write a Matrix Market file
+(
+    // input:
+    const char *filename,           // file to write
+    const GrB_Matrix A,             // matrix to write
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_edges_read              // read a binary edge list
+(
+    // output:
+    GrB_Matrix *Chandle,            // matrix created from the file
+    // input:
+    GrB_Type type,                  // type of C, or NULL for GrB_BOOL
+    int64_t nrows,                  // # of rows of C, or 0 to find it
+    int64_t ncols,                  // # of columns of C, or 0 to find it
+    const char *filename,           // file to read
+    size_t index_size,              // size of each index: 4 or 8 bytes
+    GB_Werk Werk
+) ;
+
+// # of bytes of text parsed or formatted by each task
+#define GB_IO_CHUNK (256 * 1024)
+
+#endif
@@ -0,0 +1,93 @@
+//------------------------------------------------------------------------------
+// GB_io_load: load a file into memory
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The file is mapped into memory, read-only, if possible.  Otherwise (on
+// Windows, for example) it is read into a buffer.  On output, the content of
+// the file is in data [0:data_size-1], which is not null-terminated.  The
+// caller must release the mapping with GB_file_munmap (mapping, data_size),
+// and free the buffer with GB_FREE (&buffer, buffer_size); at most one of
+// them is non-NULL.
+
+#include "GB.h"
+#include "io/GB_io.h"
+#include "jitifyer/GB_file.h"
+
+GrB_Info GB_io_load                 // load a file into memory
+(
+    // output:
+    const GB_void **data_handle,    // content of the file
+    size_t *data_size_handle,       // size of the file
+    void **mapping_handle,          // mapping of the file, or NULL
+    GB_void **buffer_handle,        // copy of the file, if it is not mapped
+    size_t *buffer_size_handle,     // allocated size of the copy
+    // input:
+    const char *filename            // file to load
+)
+{
+
+    //--------------------------------------------------------------------------
+    // map the file into memory
+    //--------------------------------------------------------------------------
+
+    (*data_handle) = NULL ;
+    (*data_size_handle) = 0 ;
+    (*buffer_handle) = NULL ;
+    (*buffer_size_handle) = 0 ;
+    size_t size = 0 ;
+    void *mapping = GB_file_mmap (filename, &size) ;
+    (*mapping_handle) = mapping ;
+    if (mapping != NULL)
+    { 
+        (*data_handle) = (const GB_void *) mapping ;
+        (*data_size_handle) = size ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // otherwise, read the file into a buffer
+    //--------------------------------------------------------------------------
+
+    FILE *f = fopen (filename, "rb") ;
+    if (f == NULL)
+    { 
+        // file cannot be opened
+        return (GrB_INVALID_VALUE) ;
+    }
+    fseek (f, 0, SEEK_END) ;
+    long len = ftell (f) ;
+    fseek (f, 0, SEEK_SET) ;
+    if (len <= 0)
+    { 
+        // file is empty or cannot be read
+        fclose (f) ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+    size = (size_t) len ;
+    size_t buffer_size = 0 ;
+    GB_void *buffer = GB_MALLOC (size, GB_void, &buffer_size) ;
+    if (buffer == NULL)
+    { 
+        // out of memory
+        fclose (f) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    bool ok = (fread (buffer, 1, size, f) == size) ;
+    fclose (f) ;
+    if (!ok)
+    { 
+        // file cannot be read
+        GB_FREE (&buffer, buffer_size) ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+    (*data_handle) = buffer ;
+    (*data_size_handle) = size ;
+    (*buffer_handle) = buffer ;
+    (*buffer_size_handle) = buffer_size ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,731 @@
+//------------------------------------------------------------------------------
+// GB_mtx_read: read a matrix from a Matrix Market file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The file is loaded into memory (see GB_io_load), and its header is parsed.
+// The data lines that follow are then split into chunks of about GB_IO_CHUNK
+// bytes, each starting at the beginning of a line.  The lines of each chunk
+// are counted in parallel, and then parsed in parallel, directly into the
+// I_work, J_work, and S_work arrays of GB_builder, at the offset of the
+// chunk.  For a symmetric, skew-symmetric, or Hermitian file, the mirror
+// image of each off-diagonal entry is then appended, also in parallel.
+
+// Both the coordinate and array formats are supported, with the real,
+// integer, complex, and pattern fields, and any symmetry.  Integer values are
+// parsed as int64_t, real values as double, and complex values as GxB_FC64_t,
+// and duplicate entries are summed.  The matrix is then typecasted to the
+// requested type.  If the type is NULL, the type given by a
+// "%%GraphBLAS type <name>" comment is used, as written by GB_mtx_write.
+// Otherwise, the type is GrB_BOOL, GrB_INT64, GrB_FP64, or GxB_FC64, for the
+// pattern, integer, real, and complex fields, respectively.  A pattern file
+// results in an iso-valued matrix.
+
+// Numbers are parsed with a fast path, which is exact: integers of up to 19
+// significant digits, with a power of 10 up to 10^22, are computed directly
+// in double precision.  Other values (including inf and nan) are parsed with
+// strtod.
+
+#include "GB.h"
+#include "io/GB_io.h"
+#include "builder/GB_build.h"
+#include "jitifyer/GB_file.h"
+#include <ctype.h>
+
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_file_munmap (mapping, data_size) ;       \
+    GB_FREE (&buffer, buffer_size) ;            \
+    GB_FREE_WORK (&Work, Work_size) ;           \
+    GB_FREE (&I_work, I_work_size) ;            \
+    GB_FREE (&J_work, J_work_size) ;            \
+    GB_FREE (&S_work, S_work_size) ;            \
+}
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORKSPACE ;                         \
+    GB_Matrix_free (&T) ;                       \
+    GB_Matrix_free (Chandle) ;                  \
+}
+
+// fields and symmetry of a Matrix Market file
+#define GB_MTX_PATTERN   0
+#define GB_MTX_INTEGER   1
+#define GB_MTX_REAL      2
+#define GB_MTX_COMPLEX   3
+#define GB_MTX_GENERAL   0
+#define GB_MTX_SYMMETRIC 1
+#define GB_MTX_SKEW      2
+#define GB_MTX_HERMITIAN 3
+
+//------------------------------------------------------------------------------
+// parsing helpers
+//------------------------------------------------------------------------------
+
+// true if p is at the end of a token
+static inline bool GB_mtx_delim (const char *p, const char *end)
+{
+    return (p >= end || *p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') ;
+}
+
+// skip blanks within a line
+static inline const char *GB_mtx_skip (const char *p, const char *end)
+{
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) p++ ;
+    return (p) ;
+}
+
+// advance to the start of the next line
+static inline const char *GB_mtx_next_line (const char *p, const char *end)
+{
+    const char *q = (const char *) memchr (p, '\n', end - p) ;
+    return ((q == NULL) ? end : (q + 1)) ;
+}
+
+// copy the next token of a line into tok, in lower case
+static const char *GB_mtx_token
+(
+    char *tok,                  // size GxB_MAX_NAME_LEN
+    const char *p,
+    const char *end
+)
+{
+    p = GB_mtx_skip (p, end) ;
+    int len = 0 ;
+    while (!GB_mtx_delim (p, end))
+    {
+        if (len < GxB_MAX_NAME_LEN - 1) tok [len++] = (char) tolower (*p) ;
+        p++ ;
+    }
+    tok [len] = '\0' ;
+    return (p) ;
+}
+
+// parse an integer, or return NULL on error
+static inline const char *GB_mtx_int
+(
+    int64_t *x,
+    const char *p,
+    const char *end
+)
+{
+    p = GB_mtx_skip (p, end) ;
+    bool neg = false ;
+    if (p < end && (*p == '-' || *p == '+'))
+    {
+        neg = (*p == '-') ;
+        p++ ;
+    }
+    const char *p0 = p ;
+    uint64_t v = 0 ;
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+        uint64_t d = (uint64_t) (*p - '0') ;
+        if (v > (UINT64_MAX - d) / 10) return (NULL) ;
+        v = 10 * v + d ;
+        p++ ;
+    }
+    if (p == p0 || !GB_mtx_delim (p, end)) return (NULL) ;
+    (*x) = (int64_t) (neg ? (0 - v) : v) ;
+    return (p) ;
+}
+
+// exact powers of 10 in double precision
+static const double GB_mtx_pow10 [23] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+} ;
+
+// parse a floating-point value, or return NULL on error
+static inline const char *GB_mtx_double
+(
+    double *x,
+    const char *p,
+    const char *end
+)
+{
+    p = GB_mtx_skip (p, end) ;
+    const char *p0 = p ;
+    bool neg = false ;
+    if (p < end && (*p == '-' || *p == '+'))
+    {
+        neg = (*p == '-') ;
+        p++ ;
+    }
+
+    // get the significand m, up to 19 digits, and the exponent e
+    uint64_t m = 0 ;
+    int nd = 0 ;
+    int64_t e = 0 ;
+    bool digits = false, exact = true ;
+    for ( ; p < end && *p >= '0' && *p <= '9' ; p++)
+    {
+        digits = true ;
+        if (m == 0 && *p == '0') continue ;
+        if (nd == 19) { exact = false ; break ; }
+        m = 10 * m + (uint64_t) (*p - '0') ;
+        nd++ ;
+    }
+    if (exact && p < end && *p == '.')
+    {
+        for (p++ ; p < end && *p >= '0' && *p <= '9' ; p++)
+        {
+            digits = true ;
+            if (m == 0 && *p == '0') { e-- ; continue ; }
+            if (nd == 19) { exact = false ; break ; }
+            m = 10 * m + (uint64_t) (*p - '0') ;
+            nd++ ;
+            e-- ;
+        }
+    }
+    if (exact && digits && p < end && (*p == 'e' || *p == 'E'))
+    {
+        int64_t ex ;
+        p = GB_mtx_int (&ex, p + 1, end) ;
+        if (p == NULL || ex > 100000 || ex < -100000) return (NULL) ;
+        e += ex ;
+    }
+
+    if (exact && digits && GB_mtx_delim (p, end) &&
+        m <= ((uint64_t) 1 << 53) && e >= -22 && e <= 22)
+    {
+        // fast path: m and 10^|e| are exact, so m*10^e is correctly rounded
+        double v = (double) m ;
+        v = (e >= 0) ? (v * GB_mtx_pow10 [e]) : (v / GB_mtx_pow10 [-e]) ;
+        (*x) = neg ? (-v) : v ;
+        return (p) ;
+    }
+
+    // slow path: use strtod on a copy of the token
+    char tok [64] ;
+    p = p0 ;
+    while (!GB_mtx_delim (p, end)) p++ ;
+    size_t len = (size_t) (p - p0) ;
+    if (len == 0 || len >= sizeof (tok)) return (NULL) ;
+    memcpy (tok, p0, len) ;
+    tok [len] = '\0' ;
+    char *tend ;
+    (*x) = strtod (tok, &tend) ;
+    return ((tend == tok + len) ? p : NULL) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mtx_read
+//------------------------------------------------------------------------------
+
+GrB_Info GB_mtx_read                // read a Matrix Market file
+(
+    // output:
+    GrB_Matrix *Chandle,            // matrix created from the file
+    // input:
+    GrB_Type type,                  // type of C, or NULL to use the file
+    const char *filename,           // file to read
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Chandle != NULL) ;
+    ASSERT (filename != NULL) ;
+    (*Chandle) = NULL ;
+
+    const GB_void *data = NULL ; size_t data_size = 0 ;
+    void *mapping = NULL ;
+    GB_void *buffer = NULL ; size_t buffer_size = 0 ;
+    int64_t *Work = NULL ; size_t Work_size = 0 ;
+    int64_t *I_work = NULL ; size_t I_work_size = 0 ;
+    int64_t *J_work = NULL ; size_t J_work_size = 0 ;
+    GB_void *S_work = NULL ; size_t S_work_size = 0 ;
+    struct GB_Matrix_opaque T_header ;
+    GrB_Matrix T = NULL ;
+
+    //--------------------------------------------------------------------------
+    // load the file
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_io_load (&data, &data_size, &mapping, &buffer, &buffer_size,
+        filename)) ;
+    const char *p = (const char *) data ;
+    const char *end = p + data_size ;
+
+    //--------------------------------------------------------------------------
+    // parse the header
+    //--------------------------------------------------------------------------
+
+    // %%MatrixMarket matrix (coordinate|array) field symmetry
+    char tok [GxB_MAX_NAME_LEN] ;
+    p = GB_mtx_token (tok, p, end) ;
+    bool ok = (strcmp (tok, "%%matrixmarket") == 0) ;
+    p = GB_mtx_token (tok, p, end) ;
+    ok = ok && (strcmp (tok, "matrix") == 0) ;
+    p = GB_mtx_token (tok, p, end) ;
+    bool coord = (strcmp (tok, "coordinate") == 0) ;
+    ok = ok && (coord || strcmp (tok, "array") == 0) ;
+    p = GB_mtx_token (tok, p, end) ;
+    int field =
+        (strcmp (tok, "pattern") == 0) ? GB_MTX_PATTERN :
+        (strcmp (tok, "integer") == 0) ? GB_MTX_INTEGER :
+        (strcmp (tok, "real"   ) == 0) ? GB_MTX_REAL    :
+        (strcmp (tok, "double" ) == 0) ? GB_MTX_REAL    :
+        (strcmp (tok, "complex") == 0) ? GB_MTX_COMPLEX : -1 ;
+    ok = ok && (field >= 0) && (coord || field != GB_MTX_PATTERN) ;
+    p = GB_mtx_token (tok, p, end) ;
+    int symmetry =
+        (strcmp (tok, "general"       ) == 0) ? GB_MTX_GENERAL   :
+        (strcmp (tok, "symmetric"     ) == 0) ? GB_MTX_SYMMETRIC :
+        (strcmp (tok, "skew-symmetric") == 0) ? GB_MTX_SKEW      :
+        (strcmp (tok, "hermitian"     ) == 0) ? GB_MTX_HERMITIAN : -1 ;
+    ok = ok && (symmetry >= 0) ;
+    if (!ok)
+    {
+        // not a Matrix Market file, or not supported
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+    if (symmetry == GB_MTX_HERMITIAN && field != GB_MTX_COMPLEX)
+    {
+        // a real Hermitian matrix is symmetric
+        symmetry = GB_MTX_SYMMETRIC ;
+    }
+    p = GB_mtx_next_line (p, end) ;
+
+    // skip comments and blank lines, and look for the GraphBLAS type
+    GrB_Type file_type = NULL ;
+    while (p < end)
+    {
+        const char *q = GB_mtx_skip (p, end) ;
+        if (q < end && *q == '%')
+        {
+            p = GB_mtx_token (tok, q, end) ;
+            if (strcmp (tok, "%%graphblas") == 0)
+            {
+                p = GB_mtx_token (tok, p, end) ;
+                if (strcmp (tok, "type") == 0)
+                {
+                    // the rest of the line is the name of the type
+                    q = GB_mtx_skip (p, end) ;
+                    const char *qend = GB_mtx_next_line (q, end) ;
+                    while (qend > q && GB_mtx_delim (qend - 1, end)) qend-- ;
+                    for (int code = GB_BOOL_code ; code <= GB_FC64_code ;
+                        code++)
+                    {
+                        const char *name = GB_code_string (code) ;
+                        if (strlen (name) == (size_t) (qend - q) &&
+                            strncmp (name, q, qend - q) == 0)
+                        {
+                            file_type = GB_code_type (code, NULL) ;
+                        }
+                    }
+                }
+            }
+        }
+        else if (q < end && *q != '\n')
+        {
+            // start of the size line
+            break ;
+        }
+        p = GB_mtx_next_line (p, end) ;
+    }
+
+    // nrows ncols [nz]
+    int64_t nrows = -1, ncols = -1, nz = -1 ;
+    p = GB_mtx_int (&nrows, p, end) ;
+    if (p != NULL) p = GB_mtx_int (&ncols, p, end) ;
+    if (p != NULL && coord) p = GB_mtx_int (&nz, p, end) ;
+    if (p == NULL || nrows < 0 || ncols < 0 || nrows > GB_NMAX
+        || ncols > GB_NMAX || (coord && nz < 0)
+        || (symmetry != GB_MTX_GENERAL && nrows != ncols)
+        || (!coord && ncols > 0 && nrows > INT64_MAX / ncols))
+    {
+        // invalid size line
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+    if (!coord)
+    {
+        // # of entries in a dense array
+        nz = (symmetry == GB_MTX_GENERAL) ? (nrows * ncols) :
+             (symmetry == GB_MTX_SKEW) ? ((nrows * (nrows-1)) / 2) :
+             ((nrows * (nrows+1)) / 2) ;
+    }
+    p = GB_mtx_next_line (p, end) ;
+
+    //--------------------------------------------------------------------------
+    // determine the types
+    //--------------------------------------------------------------------------
+
+    GrB_Type stype =
+        (field == GB_MTX_PATTERN) ? GrB_BOOL  :
+        (field == GB_MTX_INTEGER) ? GrB_INT64 :
+        (field == GB_MTX_REAL   ) ? GrB_FP64  : GxB_FC64 ;
+    if (type == NULL)
+    {
+        type = (file_type != NULL) ? file_type : stype ;
+    }
+    if (type->code == GB_UDT_code)
+    {
+        // values cannot be typecasted to a user-defined type
+        GB_FREE_ALL ;
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+    const bool S_iso = (field == GB_MTX_PATTERN) ;
+    const size_t ssize = S_iso ? 0 : stype->size ;
+    GrB_BinaryOp dup =
+        (field == GB_MTX_PATTERN) ? NULL :
+        (field == GB_MTX_INTEGER) ? GrB_PLUS_INT64 :
+        (field == GB_MTX_REAL   ) ? GrB_PLUS_FP64  : GxB_PLUS_FC64 ;
+
+    //--------------------------------------------------------------------------
+    // create the output matrix
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_Matrix_new (Chandle, type, nrows, ncols)) ;
+    GrB_Matrix C = (*Chandle) ;
+    const bool is_csc = C->is_csc ;
+
+    //--------------------------------------------------------------------------
+    // split the data lines into chunks
+    //--------------------------------------------------------------------------
+
+    const char *d0 = p ;
+    int64_t dlen = (int64_t) (end - d0) ;
+    int64_t nchunks = GB_IMAX (1, GB_ICEIL (dlen, GB_IO_CHUNK)) ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    int nthreads = (int) GB_IMIN (nthreads_max, nchunks) ;
+
+    // Cstart [c]: offset of the first line of chunk c
+    // Ccount [c]: # of data lines in chunk c, then its first entry
+    // Coff [c]: # of off-diagonal entries in chunk c, then their offset
+    // Cinfo [c]: status of chunk c
+    Work = GB_MALLOC_WORK (4 * (nchunks + 1), int64_t, &Work_size) ;
+    if (Work == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    int64_t *restrict Cstart = Work ;
+    int64_t *restrict Ccount = Work +   (nchunks + 1) ;
+    int64_t *restrict Coff   = Work + 2*(nchunks + 1) ;
+    int64_t *restrict Cinfo  = Work + 3*(nchunks + 1) ;
+
+    int64_t c ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (c = 0 ; c <= nchunks ; c++)
+    {
+        // start chunk c at the first line that begins at or after its
+        // nominal position
+        int64_t pos = (c == nchunks) ? dlen :
+            (int64_t) (((double) c / (double) nchunks) * dlen) ;
+        if (pos > 0 && pos < dlen && d0 [pos-1] != '\n')
+        {
+            pos = (int64_t) (GB_mtx_next_line (d0 + pos, end) - d0) ;
+        }
+        Cstart [c] = pos ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the data lines in each chunk
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (c = 0 ; c < nchunks ; c++)
+    {
+        const char *q = d0 + Cstart [c] ;
+        const char *qend = d0 + Cstart [c+1] ;
+        int64_t count = 0 ;
+        while (q < qend)
+        {
+            const char *s = GB_mtx_skip (q, qend) ;
+            count += (s < qend && *s != '\n' && *s != '%') ;
+            q = GB_mtx_next_line (s, qend) ;
+        }
+        Ccount [c] = count ;
+    }
+
+    GB_cumsum (Ccount, nchunks, NULL, 1, NULL) ;
+    int64_t nlines = Ccount [nchunks] ;
+    if (nlines != nz)
+    {
+        // the file does not hold the number of entries in its header
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the tuples
+    //--------------------------------------------------------------------------
+
+    // the mirror image of each off-diagonal entry is appended to the tuples
+    const bool mirror = (symmetry != GB_MTX_GENERAL) ;
+    int64_t ijslen = GB_IMAX (1, (mirror ? 2 : 1) * nz) ;
+    I_work = GB_MALLOC (ijslen, int64_t, &I_work_size) ;
+    J_work = GB_MALLOC (ijslen, int64_t, &J_work_size) ;
+    if (!S_iso)
+    {
+        S_work = GB_MALLOC (ijslen * ssize, GB_void, &S_work_size) ;
+    }
+    if (I_work == NULL || J_work == NULL || (!S_iso && S_work == NULL))
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // parse each chunk
+    //--------------------------------------------------------------------------
+
+    bool known_sorted = true ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(&&:known_sorted)
+    for (c = 0 ; c < nchunks ; c++)
+    {
+        const char *q = d0 + Cstart [c] ;
+        const char *qend = d0 + Cstart [c+1] ;
+        int64_t k = Ccount [c] ;
+        int64_t noff = 0 ;
+        int64_t ilast = -1, jlast = -1 ;
+        GrB_Info cinfo = GrB_SUCCESS ;
+
+        // position (row,col) of the first entry of a dense array
+        int64_t row = 0, col = 0 ;
+        if (!coord && nrows > 0)
+        {
+            if (symmetry == GB_MTX_GENERAL)
+            {
+                row = k % nrows ;
+                col = k / nrows ;
+            }
+            else
+            {
+                // column col holds rows col:n-1, or col+1:n-1 if skew
+                int64_t first = (symmetry == GB_MTX_SKEW) ? 1 : 0 ;
+                int64_t kk = k ;
+                while (col < ncols && kk >= nrows - col - first)
+                {
+                    kk -= nrows - col - first ;
+                    col++ ;
+                }
+                row = col + first + kk ;
+            }
+        }
+
+        while (q < qend && cinfo == GrB_SUCCESS)
+        {
+            const char *s = GB_mtx_skip (q, qend) ;
+            if (s >= qend || *s == '\n' || *s == '%')
+            {
+                // blank line or comment
+                q = GB_mtx_next_line (s, qend) ;
+                continue ;
+            }
+
+            // get the row and column indices
+            int64_t i, j ;
+            if (coord)
+            {
+                s = GB_mtx_int (&i, s, qend) ;
+                if (s != NULL) s = GB_mtx_int (&j, s, qend) ;
+                if (s == NULL)
+                {
+                    cinfo = GrB_INVALID_OBJECT ;
+                    break ;
+                }
+                i-- ;
+                j-- ;
+                if (i < 0 || i >= nrows || j < 0 || j >= ncols)
+                {
+                    cinfo = GrB_INDEX_OUT_OF_BOUNDS ;
+                    break ;
+                }
+            }
+            else
+            {
+                i = row ;
+                j = col ;
+                if (++row == nrows)
+                {
+                    col++ ;
+                    row = (symmetry == GB_MTX_GENERAL) ? 0 :
+                        (symmetry == GB_MTX_SKEW) ? (col + 1) : col ;
+                }
+            }
+
+            // get the value
+            GB_void *restrict Sx = S_iso ? NULL : (S_work + k * ssize) ;
+            switch (field)
+            {
+                case GB_MTX_INTEGER :
+                {
+                    int64_t x ;
+                    s = GB_mtx_int (&x, s, qend) ;
+                    memcpy (Sx, &x, sizeof (int64_t)) ;
+                }
+                break ;
+                case GB_MTX_REAL :
+                {
+                    double x ;
+                    s = GB_mtx_double (&x, s, qend) ;
+                    memcpy (Sx, &x, sizeof (double)) ;
+                }
+                break ;
+                case GB_MTX_COMPLEX :
+                {
+                    double x [2] ;
+                    s = GB_mtx_double (&x [0], s, qend) ;
+                    if (s != NULL) s = GB_mtx_double (&x [1], s, qend) ;
+                    memcpy (Sx, x, 2 * sizeof (double)) ;
+                }
+                break ;
+                default : ;
+            }
+            if (s == NULL)
+            {
+                cinfo = GrB_INVALID_OBJECT ;
+                break ;
+            }
+
+            // save the tuple
+            int64_t iv = is_csc ? i : j ;
+            int64_t jv = is_csc ? j : i ;
+            I_work [k] = iv ;
+            J_work [k] = jv ;
+            known_sorted = known_sorted &&
+                ((jlast < jv) || (jlast == jv && ilast <= iv)) ;
+            ilast = iv ;
+            jlast = jv ;
+            noff += (i != j) ;
+            k++ ;
+            q = GB_mtx_next_line (s, qend) ;
+        }
+        Coff [c] = noff ;
+        Cinfo [c] = cinfo ;
+    }
+
+    for (c = 0 ; c < nchunks ; c++)
+    {
+        if (Cinfo [c] != GrB_SUCCESS)
+        {
+            // a data line is invalid, or an index is out of bounds
+            info = (GrB_Info) Cinfo [c] ;
+            GB_FREE_ALL ;
+            return (info) ;
+        }
+        int64_t k = Ccount [c] ;
+        if (k > 0 && k < nz)
+        {
+            // check if the tuples are sorted across the chunk boundary
+            known_sorted = known_sorted && ((J_work [k-1] < J_work [k]) ||
+                (J_work [k-1] == J_work [k] && I_work [k-1] <= I_work [k])) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // append the mirror image of each off-diagonal entry
+    //--------------------------------------------------------------------------
+
+    int64_t nvals = nz ;
+    if (mirror)
+    {
+        GB_cumsum (Coff, nchunks, NULL, 1, NULL) ;
+        nvals += Coff [nchunks] ;
+        known_sorted = known_sorted && (nvals == nz) ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (c = 0 ; c < nchunks ; c++)
+        {
+            int64_t pm = nz + Coff [c] ;
+            for (int64_t k = Ccount [c] ; k < Ccount [c+1] ; k++)
+            {
+                if (I_work [k] == J_work [k]) continue ;
+                I_work [pm] = J_work [k] ;
+                J_work [pm] = I_work [k] ;
+                if (!S_iso)
+                {
+                    GB_void *Sx = S_work + k * ssize ;
+                    GB_void *Sm = S_work + pm * ssize ;
+                    if (symmetry == GB_MTX_SYMMETRIC)
+                    {
+                        memcpy (Sm, Sx, ssize) ;
+                    }
+                    else if (field == GB_MTX_INTEGER)
+                    {
+                        // skew-symmetric
+                        int64_t x ;
+                        memcpy (&x, Sx, sizeof (int64_t)) ;
+                        x = (int64_t) (0 - (uint64_t) x) ;
+                        memcpy (Sm, &x, sizeof (int64_t)) ;
+                    }
+                    else
+                    {
+                        // skew-symmetric: negate the real part
+                        // Hermitian: keep the real part
+                        double x [2] = { 0, 0 } ;
+                        memcpy (x, Sx, ssize) ;
+                        if (symmetry == GB_MTX_SKEW) x [0] = -x [0] ;
+                        x [1] = -x [1] ;
+                        memcpy (Sm, x, ssize) ;
+                    }
+                }
+                pm++ ;
+            }
+        }
+    }
+
+    GBURBLE ("(mtx: " GBd " lines, " GBd " chunks) ", nz, nchunks) ;
+
+    //--------------------------------------------------------------------------
+    // free the file, and build the matrix from the tuples
+    //--------------------------------------------------------------------------
+
+    GB_file_munmap (mapping, data_size) ;
+    mapping = NULL ;
+    GB_FREE (&buffer, buffer_size) ;
+    GB_FREE_WORK (&Work, Work_size) ;
+
+    bool one = true ;
+    GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+    GB_OK (GB_builder (
+        T,              // create T using a static header
+        stype,          // the type of T
+        C->vlen,        // T->vlen = C->vlen
+        C->vdim,        // T->vdim = C->vdim
+        is_csc,         // T has the same CSR/CSC format as C
+        &I_work,        // I_work_handle, becomes T->i on output
+        &I_work_size,
+        &J_work,        // J_work_handle, freed on output
+        &J_work_size,
+        &S_work,        // S_work_handle, freed on output
+        &S_work_size,
+        known_sorted,   // tuples may or may not be sorted
+        false,          // there might be duplicates; look for them
+        ijslen,         // size of I_work, J_work, and S_work
+        true,           // is_matrix: unused
+        NULL, NULL,     // original I,J tuples: not used here
+        S_iso ? ((GB_void *) &one) : NULL,  // iso value of a pattern
+        S_iso,          // true if the file is a pattern
+        nvals,          // number of tuples
+        dup,            // sum up any duplicates
+        stype,          // type of S_work
+        true,           // burble is OK
+        Werk
+    )) ;
+
+    //--------------------------------------------------------------------------
+    // transplant and typecast T into C, and conform C
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_transplant_conform (C, C->type, &T, Werk)) ;
+    ASSERT_MATRIX_OK (C, "C read from Matrix Market file", GB0) ;
+    return (GrB_SUCCESS) ;
+}
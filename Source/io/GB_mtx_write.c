@@ -0,0 +1,302 @@
+//------------------------------------------------------------------------------
+// GB_mtx_write: write a matrix to a Matrix Market file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The matrix is written in the coordinate format, with the general symmetry.
+// Boolean and integer matrices are written with the integer field, real
+// matrices with the real field, and complex matrices with the complex field.
+// The type of the matrix is recorded in a "%%GraphBLAS type <name>" comment,
+// so that GB_mtx_read can return a matrix of the same type.  Floating-point
+// values are written with the fewest digits (up to 9 for float and 17 for
+// double) that read back to the same value.
+
+// The entries are written in rounds.  In each round, each thread formats its
+// own slice of the entries into its own buffer, in parallel, and the buffers
+// are then written to the file in order.  A bitmap or full matrix is written
+// from a sparse copy.
+
+#include "GB.h"
+#include "io/GB_io.h"
+
+#define GB_FREE_ALL                             \
+{                                               \
+    if (f != NULL) fclose (f) ;                 \
+    GB_FREE_WORK (&Buf, Buf_size) ;             \
+    GB_FREE_WORK (&Len, Len_size) ;             \
+    GB_Matrix_free (&T) ;                       \
+}
+
+// # of entries formatted by each thread in each round
+#define GB_MTX_ENTRIES (64 * 1024)
+
+// space for the text of an entry:  two indices of up to 20 digits, two values
+// of up to 24 characters each, the separators, and the 32 bytes that
+// snprintf may use for the last value
+#define GB_MTX_ENTRY_LEN 128
+
+//------------------------------------------------------------------------------
+// formatting helpers
+//------------------------------------------------------------------------------
+
+// write an unsigned integer
+static inline char *GB_mtx_put_uint (char *s, uint64_t x)
+{
+    char digits [24] ;
+    int n = 0 ;
+    do
+    {
+        digits [n++] = (char) ('0' + (x % 10)) ;
+        x /= 10 ;
+    }
+    while (x > 0) ;
+    while (n > 0) (*s++) = digits [--n] ;
+    return (s) ;
+}
+
+// write a signed integer
+static inline char *GB_mtx_put_int (char *s, int64_t x)
+{
+    if (x < 0)
+    {
+        (*s++) = '-' ;
+        return (GB_mtx_put_uint (s, 0 - (uint64_t) x)) ;
+    }
+    return (GB_mtx_put_uint (s, (uint64_t) x)) ;
+}
+
+// write a double with the fewest digits that read back to the same value
+static inline char *GB_mtx_put_double (char *s, double x)
+{
+    if (x > -9007199254740992.0 && x < 9007199254740992.0 &&
+        x == (double) ((int64_t) x) && (x != 0 || !signbit (x)))
+    {
+        // x is an integer that is exactly representable: no need for snprintf
+        return (GB_mtx_put_int (s, (int64_t) x)) ;
+    }
+    int n = snprintf (s, 32, "%.15g", x) ;
+    if (isfinite (x) && strtod (s, NULL) != x)
+    {
+        n = snprintf (s, 32, "%.17g", x) ;
+    }
+    return (s + n) ;
+}
+
+// write a float with the fewest digits that read back to the same value
+static inline char *GB_mtx_put_float (char *s, float x)
+{
+    if (x > -16777216.0f && x < 16777216.0f &&
+        x == (float) ((int32_t) x) && (x != 0 || !signbit (x)))
+    {
+        // x is an integer that is exactly representable: no need for snprintf
+        return (GB_mtx_put_int (s, (int64_t) x)) ;
+    }
+    int n = snprintf (s, 32, "%.7g", (double) x) ;
+    if (isfinite (x) && strtof (s, NULL) != x)
+    {
+        n = snprintf (s, 32, "%.9g", (double) x) ;
+    }
+    return (s + n) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mtx_write
+//------------------------------------------------------------------------------
+
+GrB_Info GB_mtx_write               // write a Matrix Market file
+(
+    // input:
+    const char *filename,           // file to write
+    const GrB_Matrix A,             // matrix to write
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (filename != NULL) ;
+    ASSERT_MATRIX_OK (A, "A to write to Matrix Market file", GB0) ;
+
+    FILE *f = NULL ;
+    char *Buf = NULL ; size_t Buf_size = 0 ;
+    int64_t *Len = NULL ; size_t Len_size = 0 ;
+    GrB_Matrix T = NULL ;
+
+    const GB_Type_code code = A->type->code ;
+    if (code == GB_UDT_code)
+    {
+        // user-defined types cannot be written
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+    const char *field =
+        (code == GB_FC32_code || code == GB_FC64_code) ? "complex" :
+        (code == GB_FP32_code || code == GB_FP64_code) ? "real" : "integer" ;
+
+    GB_OK (GB_wait (A, "A to write to Matrix Market file", Werk)) ;
+    if (GB_IS_BITMAP (A) || GB_IS_FULL (A))
+    {
+        // write a sparse copy of A
+        GB_OK (GB_dup (&T, A, Werk)) ;
+        GB_ENSURE_SPARSE (T) ;
+    }
+    GrB_Matrix S = (T == NULL) ? A : T ;
+
+    const int64_t *restrict Sp = S->p ;
+    const int64_t *restrict Sh = S->h ;
+    const int64_t *restrict Si = S->i ;
+    const GB_void *restrict Sx = (GB_void *) S->x ;
+    const int64_t snvec = S->nvec ;
+    const int64_t snz = GB_nnz (S) ;
+    const size_t ssize = S->type->size ;
+    const bool S_iso = S->iso ;
+    const bool is_csc = S->is_csc ;
+
+    //--------------------------------------------------------------------------
+    // allocate a buffer for each thread
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    int64_t ntasks_max = GB_IMAX (1, GB_ICEIL (snz, GB_MTX_ENTRIES)) ;
+    int nthreads = (int) GB_IMIN (nthreads_max, ntasks_max) ;
+    size_t buflen = GB_MTX_ENTRIES * GB_MTX_ENTRY_LEN ;
+    Buf = GB_MALLOC_WORK (nthreads * buflen, char, &Buf_size) ;
+    Len = GB_MALLOC_WORK (nthreads, int64_t, &Len_size) ;
+    if (Buf == NULL || Len == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the header
+    //--------------------------------------------------------------------------
+
+    f = fopen (filename, "w") ;
+    if (f == NULL)
+    {
+        // file cannot be opened
+        GB_FREE_ALL ;
+        return (GrB_INVALID_VALUE) ;
+    }
+    int64_t nrows = GB_NROWS (S) ;
+    int64_t ncols = GB_NCOLS (S) ;
+    bool ok = fprintf (f, "%%%%MatrixMarket matrix coordinate %s general\n"
+        "%%%%GraphBLAS type %s\n" GBd " " GBd " " GBd "\n", field,
+        GB_code_string (code), nrows, ncols, snz) > 0 ;
+
+    //--------------------------------------------------------------------------
+    // write the entries
+    //--------------------------------------------------------------------------
+
+    for (int64_t pstart = 0 ; ok && pstart < snz ;
+        pstart += nthreads * GB_MTX_ENTRIES)
+    {
+
+        //----------------------------------------------------------------------
+        // each thread formats its slice of the entries of this round
+        //----------------------------------------------------------------------
+
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t p0 = GB_IMIN (pstart + tid * GB_MTX_ENTRIES, snz) ;
+            int64_t p1 = GB_IMIN (p0 + GB_MTX_ENTRIES, snz) ;
+            char *s0 = Buf + tid * buflen ;
+            char *s = s0 ;
+            if (p0 < p1)
+            {
+                // find the vector k that holds the entry p0
+                int64_t k = 0, kright = snvec - 1 ;
+                while (k < kright)
+                {
+                    int64_t kmid = (k + kright + 1) / 2 ;
+                    if (Sp [kmid] <= p0)
+                    {
+                        k = kmid ;
+                    }
+                    else
+                    {
+                        kright = kmid - 1 ;
+                    }
+                }
+                for (int64_t p = p0 ; p < p1 ; p++)
+                {
+                    while (Sp [k+1] <= p) k++ ;
+                    int64_t i = Si [p] ;
+                    int64_t j = GBH (Sh, k) ;
+                    s = GB_mtx_put_int (s, 1 + (is_csc ? i : j)) ;
+                    (*s++) = ' ' ;
+                    s = GB_mtx_put_int (s, 1 + (is_csc ? j : i)) ;
+                    (*s++) = ' ' ;
+                    const GB_void *x = Sx + (S_iso ? 0 : (p * ssize)) ;
+                    switch (code)
+                    {
+                        case GB_BOOL_code   :
+                            (*s++) = (*((bool *) x)) ? '1' : '0' ; break ;
+                        case GB_INT8_code   :
+                            s = GB_mtx_put_int (s, *((int8_t   *) x)) ; break ;
+                        case GB_INT16_code  :
+                            s = GB_mtx_put_int (s, *((int16_t  *) x)) ; break ;
+                        case GB_INT32_code  :
+                            s = GB_mtx_put_int (s, *((int32_t  *) x)) ; break ;
+                        case GB_INT64_code  :
+                            s = GB_mtx_put_int (s, *((int64_t  *) x)) ; break ;
+                        case GB_UINT8_code  :
+                            s = GB_mtx_put_uint (s, *((uint8_t  *) x)) ; break ;
+                        case GB_UINT16_code :
+                            s = GB_mtx_put_uint (s, *((uint16_t *) x)) ; break ;
+                        case GB_UINT32_code :
+                            s = GB_mtx_put_uint (s, *((uint32_t *) x)) ; break ;
+                        case GB_UINT64_code :
+                            s = GB_mtx_put_uint (s, *((uint64_t *) x)) ; break ;
+                        case GB_FP32_code   :
+                            s = GB_mtx_put_float (s, *((float *) x)) ; break ;
+                        case GB_FP64_code   :
+                            s = GB_mtx_put_double (s, *((double *) x)) ; break ;
+                        case GB_FC32_code   :
+                            s = GB_mtx_put_float (s, ((float *) x) [0]) ;
+                            (*s++) = ' ' ;
+                            s = GB_mtx_put_float (s, ((float *) x) [1]) ;
+                            break ;
+                        case GB_FC64_code   :
+                            s = GB_mtx_put_double (s, ((double *) x) [0]) ;
+                            (*s++) = ' ' ;
+                            s = GB_mtx_put_double (s, ((double *) x) [1]) ;
+                            break ;
+                        default: ;
+                    }
+                    (*s++) = '\n' ;
+                }
+            }
+            Len [tid] = (int64_t) (s - s0) ;
+        }
+
+        //----------------------------------------------------------------------
+        // write the buffers in order
+        //----------------------------------------------------------------------
+
+        for (tid = 0 ; ok && tid < nthreads ; tid++)
+        {
+            size_t len = (size_t) Len [tid] ;
+            ok = (fwrite (Buf + tid * buflen, 1, len, f) == len) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // close the file and free workspace
+    //--------------------------------------------------------------------------
+
+    ok = (fclose (f) == 0) && ok ;
+    f = NULL ;
+    GB_FREE_ALL ;
+    return (ok ? GrB_SUCCESS : GrB_INVALID_VALUE) ;
+}
@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_read_edges: read a matrix from a binary edge list
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The file holds pairs (i,j) of zero-based indices, as uint32_t or uint64_t,
+// with no header (see GB_edges_read).  C(i,j) is one for each edge, and C is
+// iso-valued.  If type is NULL, C is GrB_BOOL.  If nrows or ncols is zero, the
+// dimension is found from the largest index in the file.  Example usage:
+
+/*
+    // edges.bin holds uint32_t pairs: i0 j0 i1 j1 ...
+    GrB_Matrix A = NULL ;
+    GxB_Matrix_read_edges (&A, NULL, 0, 0, "edges.bin", sizeof (uint32_t),
+        NULL) ;
+*/
+
+#include "GB.h"
+#include "io/GB_io.h"
+
+GrB_Info GxB_Matrix_read_edges  // read a matrix from a binary edge list
+(
+    // output:
+    GrB_Matrix *C,              // output matrix created from the file
+    // input:
+    GrB_Type type,              // type of C, or NULL for GrB_BOOL
+    GrB_Index nrows,            // # of rows of C, or 0 to find it
+    GrB_Index ncols,            // # of columns of C, or 0 to find it
+    const char *filename,       // file to read
+    size_t index_size,          // size of each index: 4 or 8 bytes
+    const GrB_Descriptor desc   // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_read_edges (&C, type, nrows, ncols, filename, "
+        "index_size, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_read_edges") ;
+    GB_RETURN_IF_NULL (C) ;
+    (*C) = NULL ;
+    GB_RETURN_IF_NULL (filename) ;
+    GB_RETURN_IF_FAULTY (type) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    if (nrows > GB_NMAX || ncols > GB_NMAX ||
+        (index_size != sizeof (uint32_t) && index_size != sizeof (uint64_t)))
+    { 
+        // problem too large, or index size not supported
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read the matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_edges_read (C, type, (int64_t) nrows, (int64_t) ncols, filename,
+        index_size, Werk) ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_read_mtx: read a matrix from a Matrix Market file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The file is parsed in parallel, and the matrix C is built directly from it,
+// with no intermediate user arrays.  If type is NULL, the type of C is
+// determined by the file (see GB_mtx_read).  Example usage:
+
+/*
+    GrB_Matrix A = NULL, C = NULL ;
+    GxB_Matrix_read_mtx (&A, NULL, "A.mtx", NULL) ;     // any type
+    GxB_Matrix_read_mtx (&C, GrB_FP32, "A.mtx", NULL) ; // typecast to float
+    GxB_Matrix_write_mtx ("C.mtx", C, NULL) ;
+*/
+
+#include "GB.h"
+#include "io/GB_io.h"
+
+GrB_Info GxB_Matrix_read_mtx    // read a matrix from a Matrix Market file
+(
+    // output:
+    GrB_Matrix *C,              // output matrix created from the file
+    // input:
+    GrB_Type type,              // type of C, or NULL to use the file
+    const char *filename,       // file to read
+    const GrB_Descriptor desc   // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_read_mtx (&C, type, filename, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_read_mtx") ;
+    GB_RETURN_IF_NULL (C) ;
+    (*C) = NULL ;
+    GB_RETURN_IF_NULL (filename) ;
+    GB_RETURN_IF_FAULTY (type) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // read the matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_mtx_read (C, type, filename, Werk) ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
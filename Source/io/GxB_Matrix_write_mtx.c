@@ -0,0 +1,43 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_write_mtx: write a matrix to a Matrix Market file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The entries of A are formatted in parallel, and written to the file in the
+// coordinate format (see GB_mtx_write).  The file can be read back with
+// GxB_Matrix_read_mtx, which returns a matrix of the same type as A.
+
+#include "GB.h"
+#include "io/GB_io.h"
+
+GrB_Info GxB_Matrix_write_mtx   // write a matrix to a Matrix Market file
+(
+    const char *filename,       // file to write
+    const GrB_Matrix A,         // matrix to write
+    const GrB_Descriptor desc   // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_write_mtx (filename, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_write_mtx") ;
+    GB_RETURN_IF_NULL (filename) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // write the matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_mtx_write (filename, A, Werk) ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
@@ -125,6 +125,24 @@ GrB_Info GB_jit_kernel_AxB_dot3                                         \
     const GB_task_struct *restrict TaskList,                            \
     const int ntasks,                                                   \
     const int nthreads,                                                 \
+    const GB_AxB_select_struct *Select,                                 \
+    const void *theta                                                   \
+)
+
+#define GB_JIT_KERNEL_AXB_DOT3R_PROTO(GB_jit_kernel_AxB_dot3r)          \
+GrB_Info GB_jit_kernel_AxB_dot3r                                        \
+(                                                                       \
+    GB_void *result,                                                    \
+    bool *result_exists,                                                \
+    GB_void *restrict Wx_workspace,                                     \
+    bool *restrict Wb,                                                  \
+    const GrB_Matrix C,                                                 \
+    const GrB_Matrix M,                                                 \
+    const GrB_Matrix A,                                                 \
+    const GrB_Matrix B,                                                 \
+    const GB_task_struct *restrict TaskList,                            \
+    const int ntasks,                                                   \
+    const int nthreads,                                                 \
     const void *theta                                                   \
 )
 
@@ -186,6 +204,7 @@ GrB_Info GB_jit_kernel_AxB_saxpy3                                       \
     double chunk,                                                       \
     GB_Werk Werk,                                                       \
     const GB_callback_struct *restrict my_callback,                     \
+    const GB_AxB_select_struct *Select,                                 \
     const void *theta                                                   \
 )
 
@@ -826,6 +845,7 @@ GrB_Info GB_jit_kernel_AxB_dot3                                         \
 #define JIT_DOT2(g) GB_JIT_KERNEL_AXB_DOT2_PROTO(g) ;
 #define JIT_DO2N(g) GB_JIT_KERNEL_AXB_DOT2N_PROTO(g) ;
 #define JIT_DOT3(g) GB_JIT_KERNEL_AXB_DOT3_PROTO(g) ;
+#define JIT_DO3R(g) GB_JIT_KERNEL_AXB_DOT3R_PROTO(g) ;
 #define JIT_DOT4(g) GB_JIT_KERNEL_AXB_DOT4_PROTO(g) ;
 #define JIT_SAXB(g) GB_JIT_KERNEL_AXB_SAXBIT_PROTO(g) ;
 #define JIT_SAX3(g) GB_JIT_KERNEL_AXB_SAXPY3_PROTO(g) ;
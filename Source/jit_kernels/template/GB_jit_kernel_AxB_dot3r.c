@@ -0,0 +1,22 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_AxB_dot3r.c: JIT kernel for s = sum (C<M>=A'*B), dot3 method
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M>=A'*B is computed with the masked dot product method, but each entry
+// C(i,j) is summed into a scalar with the monoid of the semiring, and C itself
+// is never constructed.  M is sparse or hypersparse.
+
+#define GB_DOT3_REDUCE
+
+GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_DOT3R_PROTO (GB_jit_kernel) ;
+GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_DOT3R_PROTO (GB_jit_kernel)
+{
+    GB_C_TYPE *restrict Wx = (GB_C_TYPE *) Wx_workspace ;
+    #include "template/GB_AxB_dot3_meta.c"
+    return (GrB_SUCCESS) ;
+}
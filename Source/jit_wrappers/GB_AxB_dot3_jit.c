@@ -24,7 +24,8 @@ GrB_Info GB_AxB_dot3_jit        // C<M>=A'B, dot3, via the JIT
     const bool flipxy,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    const GB_AxB_select_struct *Select  // optional select op, may be NULL
 )
 { 
 
@@ -55,7 +56,7 @@ GrB_Info GB_AxB_dot3_jit        // C<M>=A'B, dot3, via the JIT
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, M, A, B, TaskList, ntasks, nthreads,
+    return (GB_jit_kernel (C, M, A, B, TaskList, ntasks, nthreads, Select,
         semiring->multiply->theta)) ;
 }
 
@@ -0,0 +1,66 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot3_reduce_jit: s = sum (C<M>=A'*B), dot3 method, via the JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+#include "jitifyer/GB_stringify.h"
+
+typedef GB_JIT_KERNEL_AXB_DOT3R_PROTO ((*GB_jit_dl_function)) ;
+
+GrB_Info GB_AxB_dot3_reduce_jit     // s = sum (C<M>=A'B), dot3, via the JIT
+(
+    // output:
+    GB_void *result,            // the scalar result, of type C->type
+    bool *result_exists,        // true if C has at least one entry
+    // workspace:
+    GB_void *restrict Wx,       // size ntasks * C->type->size
+    bool *restrict Wb,          // size ntasks
+    // input:
+    const GrB_Matrix C,         // header of C, with C->p and C->h only
+    const GrB_Matrix M, const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,
+    const bool flipxy,
+    const GB_task_struct *restrict TaskList,
+    const int ntasks,
+    const int nthreads
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // encodify the problem
+    //--------------------------------------------------------------------------
+
+    GB_jit_encoding encoding ;
+    char *suffix ;
+    uint64_t hash = GB_encodify_mxm (&encoding, &suffix,
+        GB_JIT_KERNEL_AXB_DOT3R,
+        false, false, GB_sparsity (C), C->type,
+        M, Mask_struct, false, semiring, flipxy, A, B) ;
+
+    //--------------------------------------------------------------------------
+    // get the kernel function pointer, loading or compiling it if needed
+    //--------------------------------------------------------------------------
+
+    void *dl_function ;
+    GrB_Info info = GB_jitifyer_load (&dl_function,
+        GB_jit_mxm_family, "AxB_dot3r",
+        hash, &encoding, suffix, semiring, NULL,
+        NULL, C->type, A->type, B->type) ;
+    if (info != GrB_SUCCESS) return (info) ;
+
+    //--------------------------------------------------------------------------
+    // call the jit kernel and return result
+    //--------------------------------------------------------------------------
+
+    GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
+    return (GB_jit_kernel (result, result_exists, Wx, Wb, C, M, A, B,
+        TaskList, ntasks, nthreads, semiring->multiply->theta)) ;
+}
+
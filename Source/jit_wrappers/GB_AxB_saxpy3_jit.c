@@ -30,6 +30,7 @@ GrB_Info GB_AxB_saxpy3_jit      // C<M>=A*B, saxpy3, via the JIT
     const int nfine,
     const int nthreads,
     const int do_sort,          // if nonzero, try to sort in saxpy3
+    const GB_AxB_select_struct *Select, // optional select op, may be NULL
     GB_Werk Werk
 )
 { 
@@ -66,6 +67,7 @@ GrB_Info GB_AxB_saxpy3_jit      // C<M>=A*B, saxpy3, via the JIT
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
     return (GB_jit_kernel (C, M, M_in_place, A, B,
         (GB_saxpy3task_struct *) SaxpyTasks, ntasks, nfine, nthreads, do_sort,
-        nthreads_max, chunk, Werk, &GB_callback, semiring->multiply->theta)) ;
+        nthreads_max, chunk, Werk, &GB_callback, Select,
+        semiring->multiply->theta)) ;
 }
 
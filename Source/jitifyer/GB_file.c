@@ -9,7 +9,9 @@
 
 // These methods provide portable open/close/lock/unlock/mkdir functions, in
 // support of the JIT.  If the JIT is disabled at compile time, these functions
-// do nothing.
+// do nothing.  GB_file_mmap and GB_file_munmap are used by
+// GxB_Matrix_deserialize_mmap, and are available even if the JIT is disabled.
+// They do nothing on Windows.
 
 // Windows references:
 // https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/open-wopen
@@ -62,6 +64,14 @@
 
 #endif
 
+#if !GB_WINDOWS
+    #include <fcntl.h>
+    #include <sys/types.h>
+    #include <sys/stat.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
 //------------------------------------------------------------------------------
 // GB_file_lock:  lock a file for exclusive writing
 //------------------------------------------------------------------------------
@@ -372,3 +382,64 @@ void GB_file_dlclose (void *dl_handle)
     }
 }
 
+
+//------------------------------------------------------------------------------
+// GB_file_mmap: map an entire file into memory, read-only
+//------------------------------------------------------------------------------
+
+// Returns the mapping, or NULL if the file cannot be opened or mapped.
+
+void *GB_file_mmap
+(
+    // input
+    const char *filename,   // full path to file to map
+    // output
+    size_t *size_handle     // size of the file and its mapping
+)
+{
+    (*size_handle) = 0 ;
+    #if GB_WINDOWS
+    {
+        // not supported on Windows
+        return (NULL) ;
+    }
+    #else
+    {
+        // map a file in POSIX
+        int fd = open (filename, O_RDONLY) ;
+        if (fd == -1)
+        { 
+            return (NULL) ;
+        }
+        struct stat st ;
+        if (fstat (fd, &st) != 0 || st.st_size <= 0)
+        { 
+            close (fd) ;
+            return (NULL) ;
+        }
+        size_t size = (size_t) st.st_size ;
+        void *p = mmap (NULL, size, PROT_READ, MAP_SHARED, fd, 0) ;
+        close (fd) ;
+        if (p == MAP_FAILED)
+        { 
+            return (NULL) ;
+        }
+        (*size_handle) = size ;
+        return (p) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_file_munmap: release a mapping created by GB_file_mmap
+//------------------------------------------------------------------------------
+
+void GB_file_munmap (void *p, size_t size)
+{ 
+    #if !GB_WINDOWS
+    if (p != NULL)
+    {
+        munmap (p, size) ;
+    }
+    #endif
+}
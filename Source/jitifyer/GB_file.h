@@ -47,5 +47,15 @@ void *GB_file_dlsym (void *dl_handle, char *symbol) ;
 
 void GB_file_dlclose (void *dl_handle) ;
 
+void *GB_file_mmap
+(
+    // input
+    const char *filename,   // full path to file to map
+    // output
+    size_t *size_handle     // size of the file and its mapping
+) ;
+
+void GB_file_munmap (void *p, size_t size) ;
+
 #endif
 
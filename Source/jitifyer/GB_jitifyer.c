@@ -546,6 +546,7 @@ GrB_Info GB_jitifyer_init (void)
         else if (IS ("convert_b2s"  )) c = GB_JIT_KERNEL_CONVERT_B2S ;
         else if (IS ("kroner"       )) c = GB_JIT_KERNEL_KRONER ;
         else if (IS ("sort"         )) c = GB_JIT_KERNEL_SORT ;
+        else if (IS ("AxB_dot3r"    )) c = GB_JIT_KERNEL_AXB_DOT3R ;
 
         // add CUDA PreJIT kernels here (future):
 //      else if (IS ("cuda_reduce"  )) c = GB_JIT_CUDA_KERNEL_REDUCE ;
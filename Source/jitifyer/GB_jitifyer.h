@@ -31,7 +31,7 @@ void GB_prejit
 typedef enum
 {
     GB_jit_reduce_family    = 1,    // kcode 1
-    GB_jit_mxm_family       = 2,    // kcodes 2 to 9
+    GB_jit_mxm_family       = 2,    // kcodes 2 to 9, 88
     GB_jit_ewise_family     = 3,    // kcodes 10 to 24, 83
     GB_jit_apply_family     = 4,    // kcodes 25 to 33, 84 to 86
     GB_jit_build_family     = 5,    // kcode 34
@@ -163,6 +163,9 @@ typedef enum
     // sort methods:
     GB_JIT_KERNEL_SORT          = 87, // GB_sort
 
+    // C<M>=A'*B reduced to a scalar:
+    GB_JIT_KERNEL_AXB_DOT3R     = 88, // GB_AxB_dot3_reduce
+
     //--------------------------------------------------------------------------
     // future:: CUDA kernels
     //--------------------------------------------------------------------------
@@ -474,6 +474,7 @@ GrB_Info GB_AxB_saxpy3_jit      // C<M>=A*B, saxpy3, via the JIT
     const int nfine,
     const int nthreads,
     const int do_sort,          // if nonzero, try to sort in saxpy3
+    const GB_AxB_select_struct *Select, // optional select op, may be NULL
     GB_Werk Werk
 ) ;
 
@@ -587,6 +588,27 @@ GrB_Info GB_AxB_dot3_jit        // C<M>=A'B, dot3, via the JIT
     const bool flipxy,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
+    const int nthreads,
+    const GB_AxB_select_struct *Select  // optional select op, may be NULL
+) ;
+
+GrB_Info GB_AxB_dot3_reduce_jit     // s = sum (C<M>=A'B), dot3, via the JIT
+(
+    // output:
+    GB_void *result,            // the scalar result, of type C->type
+    bool *result_exists,        // true if C has at least one entry
+    // workspace:
+    GB_void *restrict Wx,       // size ntasks * C->type->size
+    bool *restrict Wb,          // size ntasks
+    // input:
+    const GrB_Matrix C,         // header of C, with C->p and C->h only
+    const GrB_Matrix M, const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,
+    const bool flipxy,
+    const GB_task_struct *restrict TaskList,
+    const int ntasks,
     const int nthreads
 ) ;
 
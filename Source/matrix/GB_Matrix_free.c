@@ -25,8 +25,10 @@ void GB_Matrix_free             // free a matrix
         {
             // free all content of A
             GB_FREE (&(A->user_name), A->user_name_size) ;
+            GB_Ingest_free (&(A->Ingest)) ;
             size_t header_size = A->header_size ;
             GB_phybix_free (A) ;
+            GB_mapping_free (A) ;       // release any memory mapping
             if (!(A->static_header))
             { 
                 // free the header of A itself, unless it is static
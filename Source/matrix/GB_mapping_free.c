@@ -0,0 +1,41 @@
+//------------------------------------------------------------------------------
+// GB_mapping_free: release the memory mapping of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Releases the read-only memory mapping held by a matrix created by
+// GxB_Matrix_deserialize_mmap, the ArrowArray held by a matrix created by
+// GxB_Matrix_import_Arrow, or the arrays borrowed by a matrix created by
+// GxB_Matrix_import_borrowed.  The caller must ensure that no component of
+// the matrix still points into the mapping.
+
+#include "GB.h"
+#include "jitifyer/GB_file.h"
+
+void GB_mapping_free            // release the memory mapping of a matrix
+(
+    GrB_Matrix A                // matrix with mapping to release
+)
+{
+
+    if (A != NULL && A->mapping != NULL)
+    { 
+        if (A->mapping_release != NULL)
+        { 
+            // release an ArrowArray, or borrowed arrays
+            A->mapping_release (A->mapping, A->mapping_size) ;
+        }
+        else
+        { 
+            // release a memory-mapped file
+            GB_file_munmap (A->mapping, A->mapping_size) ;
+        }
+        A->mapping = NULL ;
+        A->mapping_size = 0 ;
+        A->mapping_release = NULL ;
+    }
+}
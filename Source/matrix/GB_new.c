@@ -74,12 +74,13 @@ GrB_Info GB_new                 // create matrix, except for indices & values
         allocated_header = true ;
         (*Ahandle)->static_header = false ;  // header of A has been malloc'd
         (*Ahandle)->header_size = header_size ;
+        (*Ahandle)->Ingest = NULL ;          // no concurrent setElement
     }
 //  else
 //  { 
 //      // the header of A has been provided on input.  It may already be
 //      // malloc'd, or it might be statically allocated in the caller. 
-//      // (*Ahandle)->static_header is not modified.
+//      // (*Ahandle)->static_header and (*Ahandle)->Ingest are not modified.
 //  }
 
     GrB_Matrix A = *Ahandle ;
@@ -159,6 +160,8 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->p = NULL ; A->p_shallow = false ; A->p_size = 0 ;
     A->h = NULL ; A->h_shallow = false ; A->h_size = 0 ;
     A->Y = NULL ; A->Y_shallow = false ; A->no_hyper_hash = false ;
+    A->AT = NULL ; A->cache_AT = false ;
+    A->mapping = NULL ; A->mapping_size = 0 ; A->mapping_release = NULL ;
     A->b = NULL ; A->b_shallow = false ; A->b_size = 0 ;
     A->i = NULL ; A->i_shallow = false ; A->i_size = 0 ;
     A->x = NULL ; A->x_shallow = false ; A->x_size = 0 ;
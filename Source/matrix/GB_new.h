@@ -90,5 +90,15 @@ void GB_Matrix_free             // free a matrix
     GrB_Matrix *Ahandle         // handle of matrix to free
 ) ;
 
+void GB_mapping_free            // release the memory mapping of a matrix
+(
+    GrB_Matrix A                // matrix with mapping to release
+) ;
+
+GrB_Info GB_unmap               // copy a memory-mapped matrix out of its mapping
+(
+    GrB_Matrix A                // matrix to copy
+) ;
+
 #endif
 
@@ -11,6 +11,10 @@
 // A->magic becomes GB_MAGIC2.  If this matrix is given to a user-callable
 // GraphBLAS function, it will generate a GrB_INVALID_OBJECT error.
 
+// Any memory mapping of A is not released, since the caller may keep a shallow
+// component of A (such as the iso value) and transplant it back into A.  The
+// mapping is released by GB_Matrix_free, or by GB_unmap.
+
 #include "GB.h"
 
 void GB_phybix_free             // free all content of a matrix
@@ -23,6 +27,7 @@ void GB_phybix_free             // free all content of a matrix
     { 
         GB_phy_free (A) ;           // free A->p, A->h, and A->Y
         GB_bix_free (A) ;           // free A->b, A->i, and A->x
+        GB_Matrix_free (&(A->AT)) ; // free the cached transpose
         GB_FREE (&(A->logger), A->logger_size) ;        // free the error logger
     }
 }
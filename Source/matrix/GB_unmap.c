@@ -0,0 +1,101 @@
+//------------------------------------------------------------------------------
+// GB_unmap: copy a memory-mapped matrix out of its mapping
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix created by GxB_Matrix_deserialize_mmap has shallow components that
+// point into a read-only memory-mapped file (likewise for the buffers of a
+// matrix created by GxB_Matrix_import_Arrow or GxB_Matrix_import_borrowed).
+// Before the matrix is modified, each of these components is copied into
+// newly allocated memory, and the mapping is released (copy-on-write).  If out
+// of memory, the components copied so far are kept, and the rest remain
+// shallow, so the matrix is still valid and still holds its mapping.
+
+#include "GB.h"
+
+//------------------------------------------------------------------------------
+// GB_unmap_component: copy a single shallow component
+//------------------------------------------------------------------------------
+
+static bool GB_unmap_component  // true if successful, false if out of memory
+(
+    GB_void **X_handle,         // component to copy
+    size_t *X_size_handle,      // its size
+    bool *X_shallow_handle,     // true if the component is shallow
+    int nthreads_max
+)
+{
+
+    if ((*X_shallow_handle) && (*X_handle) != NULL)
+    {
+        size_t X_len = (*X_size_handle) ;
+        size_t X_size = 0 ;
+        GB_void *X = GB_MALLOC (X_len, GB_void, &X_size) ;
+        if (X == NULL)
+        { 
+            // out of memory
+            return (false) ;
+        }
+        GB_memcpy (X, (*X_handle), X_len, nthreads_max) ;
+        (*X_handle) = X ;
+        (*X_size_handle) = X_size ;
+    }
+    (*X_shallow_handle) = false ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_unmap
+//------------------------------------------------------------------------------
+
+GrB_Info GB_unmap               // copy a memory-mapped matrix out of its mapping
+(
+    GrB_Matrix A                // matrix to copy
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (A == NULL || A->mapping == NULL)
+    { 
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    GBURBLE ("(unmap) ") ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+
+    //--------------------------------------------------------------------------
+    // copy each shallow component of A
+    //--------------------------------------------------------------------------
+
+    if (!GB_unmap_component ((GB_void **) &(A->p), &(A->p_size),
+            &(A->p_shallow), nthreads_max)
+     || !GB_unmap_component ((GB_void **) &(A->h), &(A->h_size),
+            &(A->h_shallow), nthreads_max)
+     || !GB_unmap_component ((GB_void **) &(A->b), &(A->b_size),
+            &(A->b_shallow), nthreads_max)
+     || !GB_unmap_component ((GB_void **) &(A->i), &(A->i_size),
+            &(A->i_shallow), nthreads_max)
+     || !GB_unmap_component ((GB_void **) &(A->x), &(A->x_size),
+            &(A->x_shallow), nthreads_max))
+    { 
+        // out of memory; A is unchanged except for the components already
+        // copied, and still holds its mapping
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // release the mapping
+    //--------------------------------------------------------------------------
+
+    GB_mapping_free (A) ;
+    ASSERT (!GB_is_shallow (A)) ;
+    return (GrB_SUCCESS) ;
+}
@@ -32,7 +32,7 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
     //--------------------------------------------------------------------------
 
     // a matrix contains 0 to 10 dynamically malloc'd blocks, not including
-    // A->Y
+    // A->Y and A->AT
     (*nallocs) = 0 ;
     (*mem_deep) = 0 ;
     (*mem_shallow) = 0 ;
@@ -140,6 +140,29 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
         (*mem_deep) += Pending->x_size ;
     }
 
+    if (Pending != NULL && Pending->hash != NULL)
+    { 
+        (*nallocs)++ ;
+        (*mem_deep) += Pending->hash_size ;
+    }
+
+    GB_Ingest Ingest = A->Ingest ;
+    if (Ingest != NULL)
+    {
+        (*nallocs) += 2 ;
+        (*mem_deep) += Ingest->header_size + Ingest->slot_size ;
+        for (int s = 0 ; s < Ingest->nslots ; s++)
+        {
+            GB_Pending P = Ingest->slot [s].Pending ;
+            if (P != NULL)
+            { 
+                (*nallocs) += 2 + (P->j != NULL) + (P->x != NULL) ;
+                (*mem_deep) += P->header_size + P->i_size + P->j_size
+                    + P->x_size ;
+            }
+        }
+    }
+
     if (count_hyper_hash && A->Y != NULL)
     {
         int64_t Y_nallocs = 0 ;
@@ -160,6 +183,19 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
         }
     }
 
+    if (A->AT != NULL)
+    { 
+        // the cached transpose A->AT is owned by A and is never shallow
+        int64_t AT_nallocs = 0 ;
+        size_t AT_mem_deep = 0 ;
+        size_t AT_mem_shallow = 0 ;
+        GB_memoryUsage (&AT_nallocs, &AT_mem_deep, &AT_mem_shallow, A->AT,
+            count_hyper_hash) ;
+        (*nallocs) += AT_nallocs ;
+        (*mem_deep) += AT_mem_deep ;
+        (*mem_shallow) += AT_mem_shallow ;
+    }
+
     #pragma omp flush
     return ;
 }
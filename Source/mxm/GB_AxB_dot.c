@@ -58,6 +58,7 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     bool *mask_applied,             // if true, mask was applied
     bool *done_in_place,            // if true, C_in was computed in-place
+    GB_AxB_select_struct *Select,   // optional select op, may be NULL
     GB_Werk Werk
 )
 {
@@ -198,7 +199,7 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
         { 
             // use the CPU
             info = (GB_AxB_dot3 (C, C_iso, cscalar, M, Mask_struct, A, B,
-                semiring, flipxy, Werk)) ;
+                semiring, flipxy, Select, Werk)) ;
         }
         return (info) ;
     }
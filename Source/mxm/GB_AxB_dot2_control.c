@@ -15,10 +15,17 @@
 bool GB_AxB_dot2_control  // true: use dot2, false: use saxpy
 (
     const GrB_Matrix A,
-    const GrB_Matrix B
+    const GrB_Matrix B,
+    int *tune_class         // shape class for online tuning, or -1 if none;
+                            // may be NULL
 )
 {
 
+    if (tune_class != NULL)
+    { 
+        (*tune_class) = -1 ;
+    }
+
     //--------------------------------------------------------------------------
     // C = A'*B is very efficient if A and/or B are full or bitmap
     //--------------------------------------------------------------------------
@@ -59,25 +66,28 @@ bool GB_AxB_dot2_control  // true: use dot2, false: use saxpy
     double row_degree = anz / GB_IMAX (avlen, 1) ;
     double col_degree = anz / GB_IMAX (anvec, 1) ;
 
-    if (cnz > anz + bnz)
+    // With GxB_AxB_TUNE_OFF, dot2_ratio is 1e-4; otherwise, it is calibrated
+    // for this host (see GB_AxB_tune.c).
+    double dot2_ratio = GB_AxB_tune_dot2_ratio ( ) ;
+    bool use_dot2 ;
+
+    if (cnz > fmax (dot2_ratio, 1) * (anz + bnz))
     { 
         // The C bitmap is too big, use saxpy and construct C as sparse
         GBURBLE ("(C large: use saxpy C=(A')*B) ") ;
         return (false) ;
     }
-
-    if ((anz + bnz > 10000 * cnz) || (cnz <= 100))
+    else if ((dot2_ratio * (anz + bnz) > cnz) || (cnz <= 100))
     { 
         // The C bitmap is very small compared with A and B, so use dot2
         // and construct C as bitmap
         GBURBLE ("(C tiny: dot) ") ;
-        return (true) ;
+        use_dot2 = true ;
     }
-
-    // average # of entries in each row and column of A (assuming A is CSC)
-    if (row_degree < 0.125 && col_degree > 1200)
+    else if (row_degree < 0.125 && col_degree > 1200)
     { 
-        // If AT=A' is computed, it will have mostly empty vectors (the
+        // average # of entries in each row and column of A (assuming A is
+        // CSC).  If AT=A' is computed, it will have mostly empty vectors (the
         // row_degree of A), so do not transpose it.  If the fraction of
         // populated vectors in AT is very low (< 0.0625 by default), then AT
         // will become hypersparse, and this slows down the saxpy method.  If
@@ -85,11 +95,33 @@ bool GB_AxB_dot2_control  // true: use dot2, false: use saxpy
         // efficient in this case.  If both conditions hold, use dot2 and
         // compute C as bitmap.
         GBURBLE ("(A' implicit: dot) ") ;
-        return (true) ;
+        use_dot2 = true ;
+    }
+    else
+    { 
+        // if none of the above rules trigger, use saxpy
+        GBURBLE ("(saxpy C=(A')*B) ") ;
+        use_dot2 = false ;
     }
 
-    // if none of the above rules trigger, use saxpy
-    GBURBLE ("(saxpy C=(A')*B) ") ;
-    return (false) ;
+    //--------------------------------------------------------------------------
+    // revise the choice with the run times of prior problems of this shape
+    //--------------------------------------------------------------------------
+
+    int c = GB_AxB_tune_class (anz, bnz, cnz) ;
+    if (c >= 0)
+    { 
+        bool tuned = GB_AxB_tune_choose (c, use_dot2) ;
+        if (tuned != use_dot2)
+        { 
+            GBURBLE ("(tuned: %s) ", tuned ? "dot" : "saxpy") ;
+        }
+        use_dot2 = tuned ;
+        if (tune_class != NULL)
+        { 
+            (*tune_class) = c ;
+        }
+    }
+    return (use_dot2) ;
 }
 
@@ -44,6 +44,7 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     const GrB_Matrix B,             // input matrix
     const GrB_Semiring semiring,    // semiring that defines C=A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_AxB_select_struct *Select,   // optional select op, may be NULL
     GB_Werk Werk
 )
 {
@@ -274,6 +275,12 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
         //----------------------------------------------------------------------
 
         info = GrB_NO_VALUE ;
+
+        // If GxB_mxm_select gives a select op, the factory kernel is skipped
+        // so that the JIT kernel can apply the op as it computes C.
+        bool select_in_jit = (Select != NULL) &&
+            (GB_jitifyer_get_control ( ) == GxB_JIT_ON) ;
+
         #ifndef GBCOMPACT
         GB_IF_FACTORY_KERNELS_ENABLED
         { 
@@ -298,7 +305,8 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
 
             GB_Opcode mult_binop_code, add_binop_code ;
             GB_Type_code xcode, ycode, zcode ;
-            if (GB_AxB_semiring_builtin (A, A_is_pattern, B, B_is_pattern,
+            if (!select_in_jit &&
+                GB_AxB_semiring_builtin (A, A_is_pattern, B, B_is_pattern,
                 semiring, flipxy, &mult_binop_code, &add_binop_code, &xcode,
                 &ycode, &zcode))
             { 
@@ -319,7 +327,13 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
         if (info == GrB_NO_VALUE)
         { 
             info = GB_AxB_dot3_jit (C, M, Mask_struct, A, B,
-                semiring, flipxy, TaskList, ntasks, nthreads) ;
+                semiring, flipxy, TaskList, ntasks, nthreads, Select) ;
+            if (info == GrB_SUCCESS && Select != NULL)
+            { 
+                // the JIT kernel has applied the select op to C
+                GBURBLE ("(select in dot3) ") ;
+                Select->applied = true ;
+            }
         }
 
         //----------------------------------------------------------------------
@@ -0,0 +1,141 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot3_reduce: s = sum (C<M>=A'*B), without constructing C
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The entries of C<M>=A'*B are computed with the dot3 method, and summed into
+// a single scalar with the additive monoid of the semiring.  C is never
+// constructed: its header is built with a shallow copy of M->p and M->h, but
+// C->i and C->x are not allocated.  This saves the O(nnz(M)) space for C, and
+// the time to construct and then reduce it.  The work for each entry is not
+// estimated, so GB_AxB_dot3_slice slices M uniformly by its entries.
+
+// The mask M must be present, not complemented, and sparse or hypersparse.
+// C is not iso.  The result is returned in (*result), of type
+// semiring->add->op->ztype, which is valid only if (*result_exists) is true.
+
+// This method is only available via the JIT.  GrB_NO_VALUE is returned if the
+// JIT is disabled or the semiring cannot be JIT'ed, and the caller must then
+// use another method.
+
+#include "mxm/GB_mxm.h"
+#include "jitifyer/GB_stringify.h"
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_WERK_POP (Wb, bool) ;                    \
+    GB_WERK_POP (Wx, GB_void) ;                 \
+    GB_FREE_WORK (&TaskList, TaskList_size) ;   \
+}
+
+GrB_Info GB_AxB_dot3_reduce         // s = sum (C<M>=A'*B), dot3 method
+(
+    // output:
+    GB_void *result,                // scalar result, of type add->op->ztype
+    bool *result_exists,            // true if C has at least one entry
+    // input:
+    const GrB_Matrix M,             // mask matrix
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (result != NULL) ;
+    ASSERT (result_exists != NULL) ;
+    ASSERT_MATRIX_OK (M, "M for dot3 reduce", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for dot3 reduce", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for dot3 reduce", GB0) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for dot3 reduce", GB0) ;
+
+    ASSERT (!GB_ZOMBIES (M)) ;
+    ASSERT (GB_JUMBLED_OK (M)) ;
+    ASSERT (!GB_PENDING (M)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!GB_ZOMBIES (B)) ;
+    ASSERT (!GB_JUMBLED (B)) ;
+    ASSERT (!GB_PENDING (B)) ;
+    ASSERT (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)) ;
+    ASSERT (A->vlen == B->vlen) ;
+    ASSERT (A->vlen > 0) ;
+
+    (*result_exists) = false ;
+    GB_task_struct *TaskList = NULL ; size_t TaskList_size = 0 ;
+    GB_WERK_DECLARE (Wx, GB_void) ;
+    GB_WERK_DECLARE (Wb, bool) ;
+
+    //--------------------------------------------------------------------------
+    // construct the header of C, with the same pattern as M
+    //--------------------------------------------------------------------------
+
+    GrB_Type ctype = semiring->add->op->ztype ;
+    struct GB_Matrix_opaque C_header ;
+    GrB_Matrix C = NULL ;
+    GB_CLEAR_STATIC_HEADER (C, &C_header) ;
+    int C_sparsity = GB_IS_HYPERSPARSE (M) ? GxB_HYPERSPARSE : GxB_SPARSE ;
+    GB_OK (GB_new (&C, // sparse or hyper, existing header
+        ctype, M->vlen, M->vdim, GB_Ap_null, true, C_sparsity,
+        M->hyper_switch, 0)) ;
+    C->p = M->p ; C->p_shallow = true ;
+    C->h = M->h ; C->h_shallow = true ;
+    C->plen = M->plen ;
+    C->nvec = M->nvec ;
+    C->nvec_nonempty = M->nvec_nonempty ;
+    C->nvals = M->nvals ;
+    C->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // construct the tasks
+    //--------------------------------------------------------------------------
+
+    int ntasks, nthreads ;
+    GB_OK (GB_AxB_dot3_slice (&TaskList, &TaskList_size, &ntasks, &nthreads,
+        C, Werk)) ;
+    GBURBLE ("(dot3 reduce) nthreads %d ntasks %d ", nthreads, ntasks) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    int nw = GB_IMAX (ntasks, 1) ;
+    GB_WERK_PUSH (Wx, nw * ctype->size, GB_void) ;
+    GB_WERK_PUSH (Wb, nw, bool) ;
+    if (Wx == NULL || Wb == NULL)
+    { 
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // s = sum (C<M>=A'*B), via the JIT or PreJIT kernel
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_hyper_hash_build (A, Werk)) ;
+    GB_OK (GB_hyper_hash_build (B, Werk)) ;
+
+    info = GB_AxB_dot3_reduce_jit (result, result_exists, Wx, Wb, C, M,
+        Mask_struct, A, B, semiring, flipxy, TaskList, ntasks, nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (info) ;
+}
+
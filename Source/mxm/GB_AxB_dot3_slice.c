@@ -19,6 +19,9 @@
 // is costly to compute, it is possible that it is placed by itself in a
 // single coarse task.
 
+// If C->i is NULL, the work for each entry is not known, and all entries are
+// assumed to require the same work (see GB_AxB_dot3_reduce).
+
 // FUTURE:: Ultra-fine tasks could also be constructed, so that the computation
 // of a single entry C(i,j) can be broken into multiple tasks.  The slice of
 // A(:,i) and B(:,j) would use GB_slice_vector, where no mask would be used.
@@ -90,7 +93,8 @@ GrB_Info GB_AxB_dot3_slice
     int64_t *restrict Cwork = C->i ;
     const int64_t cnvec = C->nvec ;
     const int64_t cvlen = C->vlen ;
-    const int64_t cnz = GB_nnz_held (C) ;
+    // C is sparse or hypersparse; C->x may be NULL (see GB_AxB_dot3_reduce)
+    const int64_t cnz = Cp [cnvec] ;
 
     //--------------------------------------------------------------------------
     // compute the cumulative sum of the work
@@ -99,8 +103,12 @@ GrB_Info GB_AxB_dot3_slice
     // FUTURE:: handle possible int64_t overflow
 
     int nthreads = GB_nthreads (cnz, chunk, nthreads_max) ;
-    GB_cumsum (Cwork, cnz, NULL, nthreads, Werk) ;
-    double total_work = (double) Cwork [cnz] ;
+    double total_work = (double) cnz ;
+    if (Cwork != NULL)
+    { 
+        GB_cumsum (Cwork, cnz, NULL, nthreads, Werk) ;
+        total_work = (double) Cwork [cnz] ;
+    }
 
     //--------------------------------------------------------------------------
     // allocate the initial TaskList
@@ -154,6 +162,7 @@ GrB_Info GB_AxB_dot3_slice
         GB_FREE_ALL ;
         return (GrB_OUT_OF_MEMORY) ;
     }
+    // if Cwork is NULL, the entries 0:cnz-1 are sliced equally
     GB_p_slice (Coarse, Cwork, cnz, ntasks1, false) ;
 
     //--------------------------------------------------------------------------
@@ -60,6 +60,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     bool *done_in_place,            // if true, C was computed in-place
     GrB_Desc_Value AxB_method,      // for auto vs user selection of methods
     const int do_sort,              // if nonzero, try to return C unjumbled
+    GB_AxB_select_struct *Select,   // optional select op, may be NULL
     GB_Werk Werk
 )
 {
@@ -128,8 +129,11 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     // estimate the work to transpose A, B, and C
     //--------------------------------------------------------------------------
 
-    double A_work = GB_nnz_held (A_in) ;    // work to transpose A
-    double B_work = GB_nnz_held (B_in) ;    // work to transpose B
+    // If A or B has a cached transpose, it is transposed for free by
+    // GB_transpose_cached (A->AT is built on its first use, and then kept),
+    // so the swap_rule below prefers the direction that uses it.
+    double A_work = A_in->cache_AT ? 0 : GB_nnz_held (A_in) ;
+    double B_work = B_in->cache_AT ? 0 : GB_nnz_held (B_in) ;
     // work to transpose C cannot be determined; assume it is full
     double C_work =
         (double) (A_transpose ? GB_NCOLS (A_in) : GB_NROWS (A_in)) *
@@ -315,7 +319,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         A_in_is_diagonal = GB_is_diagonal (A_in) ;
 
         int tentative_axb_method ;
-        GB_AxB_meta_adotb_control (&tentative_axb_method, C_in, M_in,
+        GB_AxB_meta_adotb_control (&tentative_axb_method, NULL, C_in, M_in,
             Mask_comp, B_in, A_in, accum, semiring_in, flipxy, can_do_in_place,
             allow_scale, A_in_is_diagonal, AxB_method) ;
 
@@ -385,7 +389,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         B_in_is_diagonal = GB_is_diagonal (B_in) ;
 
         int tentative_axb_method ;
-        GB_AxB_meta_adotb_control (&tentative_axb_method, C_in, M_in,
+        GB_AxB_meta_adotb_control (&tentative_axb_method, NULL, C_in, M_in,
             Mask_comp, A_in, B_in, accum, semiring_in, flipxy, can_do_in_place,
             allow_scale, B_in_is_diagonal, AxB_method) ;
 
@@ -562,6 +566,14 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     // select the final algorithm and perform the matrix multiply
     //==========================================================================
 
+    // The dot3 and saxpy3 kernels can apply the select op of GxB_mxm_select
+    // as they compute C.  They see C as if held by column, but C is held by
+    // row if C->is_csc is false on output (see below).
+    if (Select != NULL)
+    {
+        Select->flipij = C_transpose ? C_is_csc : !C_is_csc ;
+    }
+
     // use GB_AxB_saxpy3 by default
     int axb_method = GB_USE_SAXPY ;
 
@@ -585,8 +597,8 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             // converted to C=(B*A)' and C=B*A, respectively.  It is left here
             // in case the swap_rule changes.
             GB_CLEAR_STATIC_HEADER (BT, &BT_header) ;
-            GB_OK (GB_transpose_cast (BT, btype_cast, true, B, B_is_pattern,
-                Werk)) ;
+            GB_OK (GB_transpose_cached (BT, btype_cast, true, B,
+                B_is_pattern, Werk)) ;
             B = BT ;
         }
 
@@ -594,10 +606,14 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         // select the method for C<M>=A'*B
         //----------------------------------------------------------------------
 
-        GB_AxB_meta_adotb_control (&axb_method, C_in, M,
+        int tune_class = -1 ;
+        GB_AxB_meta_adotb_control (&axb_method, &tune_class, C_in, M,
             Mask_comp, A, B, accum, semiring, flipxy, can_do_in_place,
             allow_scale, B_is_diagonal, AxB_method) ;
 
+        // if tuned online, time the method, including the transpose of A
+        double tune_time = (tune_class < 0) ? 0 : GB_OPENMP_GET_WTIME ;
+
         //----------------------------------------------------------------------
         // AT = A'
         //----------------------------------------------------------------------
@@ -606,8 +622,8 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         {
             // AT = A', or AT=one(A') if only the pattern is needed.
             GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
-            GB_OK (GB_transpose_cast (AT, atype_cast, true, A, A_is_pattern,
-                Werk)) ;
+            GB_OK (GB_transpose_cached (AT, atype_cast, true, A,
+                A_is_pattern, Werk)) ;
             // do not use colscale if AT is now bitmap
             if (GB_IS_BITMAP (AT))
             { 
@@ -639,7 +655,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                     (M != NULL && !Mask_comp) ? "masked_" : "") ;
                 GB_OK (GB_AxB_dot (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, A, B, semiring, flipxy,
-                    mask_applied, done_in_place, Werk)) ;
+                    mask_applied, done_in_place, Select, Werk)) ;
                 break ;
 
             default : 
@@ -647,10 +663,20 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 GBURBLE ("C%s=A'*B, saxpy (transposed %s) ", M_str, A_str) ;
                 GB_OK (GB_AxB_saxpy (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, AT, B, semiring, flipxy,
-                    mask_applied, done_in_place, AxB_method, do_sort, Werk)) ;
+                    mask_applied, done_in_place, AxB_method, do_sort, Select,
+                    Werk)) ;
                 break ;
         }
 
+        if (tune_class >= 0)
+        { 
+            // record the run time of dot2 or saxpy for this shape of A'*B
+            double work = GB_nnz (A) + GB_nnz (B) +
+                ((double) A->nvec_nonempty) * ((double) B->nvec_nonempty) ;
+            GB_AxB_tune_record (tune_class, axb_method == GB_USE_DOT, work,
+                GB_OPENMP_GET_WTIME - tune_time) ;
+        }
+
     }
     else if (btrans)
     {
@@ -687,8 +713,8 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         {
             // BT = B', or BT=one(B') if only the pattern of B is needed
             GB_CLEAR_STATIC_HEADER (BT, &BT_header) ;
-            GB_OK (GB_transpose_cast (BT, btype_cast, true, B, B_is_pattern,
-                Werk)) ;
+            GB_OK (GB_transpose_cached (BT, btype_cast, true, B,
+                B_is_pattern, Werk)) ;
             // do not use rowscale if BT is now bitmap
             if (axb_method == GB_USE_ROWSCALE && GB_IS_BITMAP (BT))
             { 
@@ -719,11 +745,11 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 GBURBLE ("C%s=A*B', dot_product (transposed %s) "
                     "(transposed %s) ", M_str, A_str, B_str) ;
                 GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
-                GB_OK (GB_transpose_cast (AT, atype_cast, true, A, A_is_pattern,
-                    Werk)) ;
+                GB_OK (GB_transpose_cached (AT, atype_cast, true, A,
+                    A_is_pattern, Werk)) ;
                 GB_OK (GB_AxB_dot (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, AT, BT, semiring, flipxy,
-                    mask_applied, done_in_place, Werk)) ;
+                    mask_applied, done_in_place, Select, Werk)) ;
                 break ;
 
             default : 
@@ -731,7 +757,8 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 GBURBLE ("C%s=A*B', saxpy (transposed %s) ", M_str, B_str) ;
                 GB_OK (GB_AxB_saxpy (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, A, BT, semiring, flipxy,
-                    mask_applied, done_in_place, AxB_method, do_sort, Werk)) ;
+                    mask_applied, done_in_place, AxB_method, do_sort, Select,
+                    Werk)) ;
                 break ;
         }
 
@@ -823,11 +850,11 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 GBURBLE ("C%s=A*B', dot_product (transposed %s) ",
                     M_str, A_str) ;
                 GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
-                GB_OK (GB_transpose_cast (AT, atype_cast, true, A, A_is_pattern,
-                    Werk)) ;
+                GB_OK (GB_transpose_cached (AT, atype_cast, true, A,
+                    A_is_pattern, Werk)) ;
                 GB_OK (GB_AxB_dot (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, AT, B, semiring, flipxy,
-                    mask_applied, done_in_place, Werk)) ;
+                    mask_applied, done_in_place, Select, Werk)) ;
                 break ;
 
             default : 
@@ -835,7 +862,8 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 GBURBLE ("C%s=A*B, saxpy ", M_str) ;
                 GB_OK (GB_AxB_saxpy (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, A, B, semiring, flipxy,
-                    mask_applied, done_in_place, AxB_method, do_sort, Werk)) ;
+                    mask_applied, done_in_place, AxB_method, do_sort, Select,
+                    Werk)) ;
                 break ;
         }
     }
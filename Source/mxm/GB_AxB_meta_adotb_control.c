@@ -13,6 +13,8 @@ void GB_AxB_meta_adotb_control
 (
     // output:
     int *axb_method,
+    int *tune_class,        // shape class for online tuning, or -1 if none;
+                            // may be NULL
     // input:
     const GrB_Matrix C_in,
     const GrB_Matrix M,
@@ -34,6 +36,10 @@ void GB_AxB_meta_adotb_control
 
     // use saxpy by default, unless selecting other methods below
     (*axb_method) = GB_USE_SAXPY ;
+    if (tune_class != NULL)
+    { 
+        (*tune_class) = -1 ;
+    }
 
     // If the mask is present, only entries for which M(i,j)=1 are
     // computed, which makes this method very efficient when the mask is
@@ -80,7 +86,7 @@ void GB_AxB_meta_adotb_control
             // C<M>=A'*B uses the masked dot product method (dot3)
             (*axb_method) = GB_USE_DOT ;
         }
-        else if (GB_AxB_dot2_control (A, B))
+        else if (GB_AxB_dot2_control (A, B, tune_class))
         { 
             // C=A'*B or C<!M>=A'B* can efficiently use the dot2 method
             (*axb_method) = GB_USE_DOT ;
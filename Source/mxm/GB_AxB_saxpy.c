@@ -29,6 +29,7 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
     bool *done_in_place,            // if true, C was computed in-place 
     const GrB_Desc_Value AxB_method,
     const int do_sort,              // if nonzero, try to sort in saxpy3
+    GB_AxB_select_struct *Select,   // optional select op, may be NULL
     GB_Werk Werk
 )
 {
@@ -207,7 +208,7 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
         ASSERT (C_sparsity == GxB_HYPERSPARSE || C_sparsity == GxB_SPARSE) ;
         info = GB_AxB_saxpy3 (C, C_iso, cscalar, C_sparsity, M, Mask_comp,
             Mask_struct, A, B, semiring, flipxy, mask_applied, AxB_method,
-            do_sort, Werk) ;
+            do_sort, Select, Werk) ;
 
         if (info == GrB_NO_VALUE)
         { 
@@ -221,7 +222,7 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
             ASSERT (M != NULL) ;
             info = GB_AxB_saxpy (C, NULL, NULL, false, false, NULL, A, B,
                 semiring, flipxy, mask_applied, done_in_place, AxB_method,
-                do_sort, Werk) ;
+                do_sort, Select, Werk) ;
         }
 
     }
@@ -234,7 +235,20 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
 
         ASSERT (C_sparsity == GxB_BITMAP) ;
 
-        if ((GB_IS_BITMAP (A) || GB_IS_FULL (A)) &&
+        info = GrB_NO_VALUE ;
+        if (M == NULL && !C_iso && GB_IS_FULL (A) && A->vlen <= 64 &&
+            (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)))
+        { 
+            // C = A*B where A is full and has few rows, for a few built-in
+            // semirings.  C is computed as full or bitmap.
+            info = GB_AxB_saxpy6 (C, A, B, semiring, flipxy, Werk) ;
+        }
+
+        if (info != GrB_NO_VALUE)
+        { 
+            // saxpy6 has handled this case
+        }
+        else if ((GB_IS_BITMAP (A) || GB_IS_FULL (A)) &&
             (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)))
         { 
             // C<#M> = A*B via dot products, where A is bitmap or full and B is
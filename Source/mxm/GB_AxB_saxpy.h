@@ -33,6 +33,7 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
     bool *done_in_place,            // if true, C was computed in-place 
     const GrB_Desc_Value AxB_method,
     const int do_sort,              // if nonzero, try to sort in saxpy3
+    GB_AxB_select_struct *Select,   // optional select op, may be NULL
     GB_Werk Werk
 ) ;
 
@@ -97,6 +98,20 @@ GrB_Info GB_AxB_saxpy5              // C += A*B
     GB_Werk Werk
 ) ;
 
+//------------------------------------------------------------------------------
+// saxpy6: C=A*B where A is full with 2 to 64 rows, and B is sparse/hyper
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_saxpy6              // C=A*B, A full with 2 to 64 rows
+(
+    GrB_Matrix C,                   // output matrix, static header
+    const GrB_Matrix A,             // input matrix A, full
+    const GrB_Matrix B,             // input matrix B, sparse or hypersparse
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Werk Werk
+) ;
+
 //------------------------------------------------------------------------------
 // saxbit:
 //------------------------------------------------------------------------------
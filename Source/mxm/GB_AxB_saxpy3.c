@@ -66,12 +66,17 @@
 //      fine Gustavson task (shared):   int8_t  Hf [m] ; ctype Hx [m] ;
 //      fine hash task (shared):        int64_t Hf [s] ; ctype Hx [s] ;
 //      coarse Gustavson task:          int64_t Hf [m] ; ctype Hx [m] ;
+//                                      int64_t Hi [2*b] if tiled ;
 //      coarse hash task:               int64_t Hf [s] ; ctype Hx [s] ;
 //                                      int64_t Hi [s] ; 
 //
-// Note that the Hi array is needed only for the coarse hash task.  Additional
-// workspace is allocated to construct the list of tasks, but this is freed
-// before C is constructed.
+// where b = max (nnz (B (:,j))) for the vectors of the task.  A coarse
+// Gustavson task is tiled into bands of rows if m is large, so that each
+// band accesses a part of Hf and Hx that fits in cache.
+//
+// Note that the Hi array is needed only for the coarse hash task, and for
+// tiled coarse Gustavson tasks.  Additional workspace is allocated to
+// construct the list of tasks, but this is freed before C is constructed.
 
 // References:
 
@@ -103,6 +108,9 @@
     GB_FREE_WORK (&Hi_all, Hi_all_size) ;           \
     GB_FREE_WORK (&Hf_all, Hf_all_size) ;           \
     GB_FREE_WORK (&Hx_all, Hx_all_size) ;           \
+    GB_FREE_WORK (&(W.Hi), W.Hi_size) ;             \
+    GB_FREE_WORK (&(W.Hf), W.Hf_size) ;             \
+    GB_FREE_WORK (&(W.Hx), W.Hx_size) ;             \
 }
 
 #define GB_FREE_ALL             \
@@ -111,6 +119,27 @@
     GB_phybix_free (C) ;        \
 }
 
+//------------------------------------------------------------------------------
+// GB_tile_cursors: size of the Hi workspace for a tiled coarse Gustavson task
+//------------------------------------------------------------------------------
+
+// A tiled coarse Gustavson task needs 2 cursors into A for each entry of the
+// vector B(:,j) it is computing, for any vector j in its range of vectors.
+
+static inline int64_t GB_tile_cursors
+(
+    const GB_saxpy3task_struct *Task,
+    const int64_t *restrict Bp
+)
+{
+    int64_t max_bjnz = 0 ;
+    for (int64_t kk = Task->start ; kk <= Task->end ; kk++)
+    { 
+        max_bjnz = GB_IMAX (max_bjnz, Bp [kk+1] - Bp [kk]) ;
+    }
+    return (2 * max_bjnz) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_AxB_saxpy3: compute C=A*B, C<M>=A*B, or C<!M>=A*B in parallel
 //------------------------------------------------------------------------------
@@ -131,6 +160,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     bool *mask_applied,             // if true, then mask was applied
     GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
     const int do_sort,              // if nonzero, try to sort in saxpy3
+    GB_AxB_select_struct *Select,   // optional select op, may be NULL
     GB_Werk Werk
 )
 {
@@ -183,6 +213,8 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     int64_t *restrict Hi_all = NULL ; size_t Hi_all_size = 0 ;
     int64_t *restrict Hf_all = NULL ; size_t Hf_all_size = 0 ;
     GB_void *restrict Hx_all = NULL ; size_t Hx_all_size = 0 ;
+    GB_saxpy3_workspace_struct W ;
+    memset (&W, 0, sizeof (GB_saxpy3_workspace_struct)) ;
     GB_saxpy3task_struct *SaxpyTasks = NULL ; size_t SaxpyTasks_size = 0 ;
 
     //--------------------------------------------------------------------------
@@ -329,7 +361,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     // If Gustavson's method is used (coarse tasks):
     //
     //      hash_size is cvlen.
-    //      Hi is not allocated.
+    //      Hi is not allocated, unless the task is tiled (nbands > 1).
     //      Hf and Hx are both of size hash_size.
     //
     //      (Hf [i] == mark) is true if i is in the hash table.
@@ -363,6 +395,14 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     //      Hf starts out all zero (via calloc), and mark starts out as 1.  To
     //      clear Hf, mark is incremented, so that all entries in Hf are not
     //      equal to mark.
+    //
+    //      If the Hf workspace is kept in the Context from a prior call (see
+    //      GxB_CONTEXT_WORKSPACE_MAX), all of its entries are in the range 0
+    //      to W.Hf_mark.  Each coarse task then starts with a mark of
+    //      W.Hf_mark instead of zero, and its part of Hf is not cleared.  The
+    //      fine tasks use a mark of 1 and require their part of Hf to be zero,
+    //      so only that part of Hf is cleared.  All of Hf is cleared instead
+    //      if W.Hf_mark is close to GB_SAXPY3_HF_MARK_MAX.
 
     // add some padding to the end of each hash table, to avoid false
     // sharing of cache lines between the hash tables.  But only add the
@@ -392,6 +432,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     int ncoarse_hash = 0 ;
     int ncoarse_1hash = 0 ;
     int ncoarse_gus = 0 ;
+    int ncoarse_tiled = 0 ;
 
     for (int taskid = 0 ; taskid < ntasks ; taskid++)
     {
@@ -423,6 +464,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
             { 
                 // coarse Gustavson task
                 ncoarse_gus++ ;
+                if (SaxpyTasks [taskid].nbands > 1) ncoarse_tiled++ ;
             }
             else
             { 
@@ -462,6 +504,11 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
             // only coarse hash tasks need Hi
             Hi_size_total += hi_size ;
         }
+        else if (!is_fine && SaxpyTasks [taskid].nbands > 1)
+        { 
+            // except for tiled coarse Gustavson tasks, for their cursors
+            Hi_size_total += GB_tile_cursors (&(SaxpyTasks [taskid]), Bp) ;
+        }
         // all tasks use an Hx array of size hash_size
         if (!C_iso)
         { 
@@ -472,6 +519,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 
     GBURBLE ("(nthreads %d", nthreads) ;
     if (ncoarse_gus  > 0) GBURBLE (" coarse: %d",      ncoarse_gus) ;
+    if (ncoarse_tiled > 0) GBURBLE (" (tiled: %d)",    ncoarse_tiled) ;
     if (ncoarse_hash > 0) GBURBLE (" coarse hash: %d", ncoarse_hash) ;
     if (nfine_gus    > 0) GBURBLE (" fine: %d",        nfine_gus) ;
     if (nfine_hash   > 0) GBURBLE (" fine hash: %d",   nfine_hash) ;
@@ -481,16 +529,47 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     // allocate space for all hash tables
     //--------------------------------------------------------------------------
 
-    if (Hi_size_total > 0)
+    // take any workspace kept in the Context by a prior call, and use it
+    // for Hi, Hf, and Hx if it is large enough
+    GB_Context_saxpy3_workspace_take (NULL, &W) ;
+    int64_t mark0 = 0 ;
+    if (W.Hi != NULL && W.Hi_size >= Hi_size_total * sizeof (int64_t))
+    { 
+        Hi_all = W.Hi ; Hi_all_size = W.Hi_size ;
+        W.Hi = NULL ; W.Hi_size = 0 ;
+    }
+    if (W.Hf != NULL && W.Hf_size >= Hf_size_total * sizeof (int64_t))
+    { 
+        // all entries of W.Hf are in the range 0 to W.Hf_mark
+        Hf_all = W.Hf ; Hf_all_size = W.Hf_size ;
+        mark0 = W.Hf_mark ;
+        W.Hf = NULL ; W.Hf_size = 0 ;
+        if (mark0 > GB_SAXPY3_HF_MARK_MAX - 4 * bnvec - 4)
+        { 
+            // the mark would grow too large: clear Hf and start again
+            GB_memset (Hf_all, 0, Hf_all_size, nthreads_max) ;
+            mark0 = 0 ;
+        }
+    }
+    if (W.Hx != NULL && W.Hx_size >= Hx_size_total * csize)
+    { 
+        Hx_all = W.Hx ; Hx_all_size = W.Hx_size ;
+        W.Hx = NULL ; W.Hx_size = 0 ;
+    }
+    GB_FREE_WORK (&(W.Hi), W.Hi_size) ;
+    GB_FREE_WORK (&(W.Hf), W.Hf_size) ;
+    GB_FREE_WORK (&(W.Hx), W.Hx_size) ;
+
+    if (Hi_size_total > 0 && Hi_all == NULL)
     { 
         Hi_all = GB_MALLOC_WORK (Hi_size_total, int64_t, &Hi_all_size) ;
     }
-    if (Hf_size_total > 0)
+    if (Hf_size_total > 0 && Hf_all == NULL)
     { 
         // Hf must be calloc'd to initialize all entries as empty 
         Hf_all = GB_CALLOC_WORK (Hf_size_total, int64_t, &Hf_all_size) ;
     }
-    if (Hx_size_total > 0)
+    if (Hx_size_total > 0 && Hx_all == NULL)
     { 
         Hx_all = GB_MALLOC_WORK (Hx_size_total * csize, GB_void, &Hx_all_size) ;
     }
@@ -511,6 +590,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     int64_t *restrict Hi_part = Hi_all ;
     int64_t *restrict Hf_part = Hf_all ;
     GB_void *restrict Hx_part = Hx_all ;
+    int64_t Hf_fine_size = 0 ;      // size of Hf used by the fine tasks
 
     for (int taskid = 0 ; taskid < ntasks ; taskid++)
     {
@@ -530,6 +610,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         SaxpyTasks [taskid].Hi = Hi_part ;
         SaxpyTasks [taskid].Hf = (GB_void *) Hf_part ;
         SaxpyTasks [taskid].Hx = Hx_part ;
+        SaxpyTasks [taskid].mark = mark0 ;
 
         int64_t hi_size = GB_IMAX (hash_size, 8) ;
         int64_t hx_size = hi_size ;
@@ -555,12 +636,28 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
             // only coarse hash tasks need Hi
             Hi_part += hi_size ;
         }
+        else if (!is_fine && SaxpyTasks [taskid].nbands > 1)
+        { 
+            // except for tiled coarse Gustavson tasks, for their cursors
+            Hi_part += GB_tile_cursors (&(SaxpyTasks [taskid]), Bp) ;
+        }
         // all tasks use an Hx array of size hash_size
         if (!C_iso)
         { 
             // except that the ANY_PAIR iso semiring does not use Hx
             Hx_part += hx_size * csize ;
         }
+        if (is_fine)
+        { 
+            // the fine tasks come first, so their Hf is a prefix of Hf_all
+            Hf_fine_size = Hf_part - Hf_all ;
+        }
+    }
+
+    if (mark0 > 0 && Hf_fine_size > 0)
+    { 
+        // the fine tasks require their part of the kept Hf to be zero
+        GB_memset (Hf_all, 0, Hf_fine_size * sizeof (int64_t), nthreads_max) ;
     }
 
     // assign shared hash tables to fine task teams
@@ -621,6 +718,11 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         info = GrB_NO_VALUE ;
         GBURBLE ("(sparse saxpy) ") ;
 
+        // If GxB_mxm_select gives a select op, the factory kernel is skipped
+        // so that the JIT kernel can apply the op as it computes C.
+        bool select_in_jit = (Select != NULL) &&
+            (GB_jitifyer_get_control ( ) == GxB_JIT_ON) ;
+
         #ifndef GBCOMPACT
         GB_IF_FACTORY_KERNELS_ENABLED
         { 
@@ -644,7 +746,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
             // launch the switch factory
             //------------------------------------------------------------------
 
-            if (builtin_semiring)
+            if (builtin_semiring && !select_in_jit)
             { 
                 #include "mxm/factory/GB_AxB_factory.c"
             }
@@ -659,7 +761,13 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         { 
             info = GB_AxB_saxpy3_jit (C, M, Mask_comp,
                 Mask_struct, M_in_place, A, B, semiring, flipxy,
-                SaxpyTasks, ntasks, nfine, nthreads, do_sort, Werk) ;
+                SaxpyTasks, ntasks, nfine, nthreads, do_sort, Select, Werk) ;
+            if (info == GrB_SUCCESS && Select != NULL)
+            { 
+                // the JIT kernel has applied the select op to C
+                GBURBLE ("(select in saxpy3) ") ;
+                Select->applied = true ;
+            }
         }
 
         //----------------------------------------------------------------------
@@ -689,10 +797,28 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     //--------------------------------------------------------------------------
 
     C->magic = GB_MAGIC ;
+    if (Hf_all != NULL && GB_Context_workspace_max ( ) > 0)
+    { 
+        // Keep the workspace in the Context for the next call, if it is not
+        // too large.  The fine tasks leave their part of Hf in any state, so
+        // it is cleared.  The coarse tasks leave all entries of Hf less than
+        // or equal to mark0 + 4*bnvec + 2.
+        if (Hf_fine_size > 0)
+        { 
+            GB_memset (Hf_all, 0, Hf_fine_size * sizeof (int64_t),
+                nthreads_max) ;
+        }
+        W.Hf = Hf_all ; W.Hf_size = Hf_all_size ;
+        W.Hf_mark = mark0 + 4 * bnvec + 4 ;
+        W.Hi = Hi_all ; W.Hi_size = Hi_all_size ;
+        W.Hx = Hx_all ; W.Hx_size = Hx_all_size ;
+        Hf_all = NULL ; Hi_all = NULL ; Hx_all = NULL ;
+        GB_Context_saxpy3_workspace_give (NULL, &W) ;
+    }
     GB_FREE_WORKSPACE ;
     GB_OK (GB_hypermatrix_prune (C, Werk)) ;
     ASSERT_MATRIX_OK (C, "saxpy3: output", GB0) ;
-    ASSERT (!GB_ZOMBIES (C)) ;
+    ASSERT (GB_ZOMBIES_OK (C)) ;    // zombies only from the select op
     ASSERT (!GB_PENDING (C)) ;
     (*mask_applied) = apply_mask ;
     return (info) ;
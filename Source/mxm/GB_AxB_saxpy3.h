@@ -32,6 +32,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     bool *mask_applied,             // if true, then mask was applied
     GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
     const int do_sort,              // if nonzero, try to sort in saxpy3
+    GB_AxB_select_struct *Select,   // optional select op, may be NULL
     GB_Werk Werk
 ) ;
 
@@ -60,6 +61,25 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 // Hash method is not used, and Gustavson's method is used, with the hash size
 // is set to C->vlen.
 
+// A coarse Gustavson task uses Hf and Hx of size C->vlen, which do not fit in
+// cache if C->vlen is large.  In that case, the task is tiled into nbands
+// bands of rows, each of which has a portion of Hf and Hx that fits in about
+// GB_SAXPY3_TILE_BYTES.  Each C(:,j) with enough work is then computed one
+// band at a time.  The Hi array of a tiled coarse Gustavson task holds
+// 2*max(nnz(B(:,j))) cursors into A, for the vectors B(:,j) of the task.
+// Tasks that are not tiled have nbands = 1.
+
+#define GB_SAXPY3_TILE_BYTES (1024 * 1024)
+#define GB_SAXPY3_TILE_ROW_BYTES 16
+#define GB_SAXPY3_TILE_MAX_BANDS 4096
+
+// The Hf workspace kept in the Context by GB_AxB_saxpy3 has a mark that grows
+// by 4*bnvec+4 on each call.  If the next call could take it past
+// GB_SAXPY3_HF_MARK_MAX, Hf is cleared and the mark starts again at zero, so
+// the mark never overflows.
+
+#define GB_SAXPY3_HF_MARK_MAX (((int64_t) 1) << 62)
+
 #include "mxm/include/GB_saxpy3task_struct.h"
 
 //------------------------------------------------------------------------------
@@ -77,6 +97,33 @@ GrB_Info GB_AxB_saxpy3_flopcount
     GB_Werk Werk
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_saxpy3_nbands: determine the # of row bands for a coarse Gustavson task
+//------------------------------------------------------------------------------
+
+// A coarse Gustavson task accesses Hf [0:cvlen-1] and Hx [0:cvlen-1].  If
+// these do not fit in about GB_SAXPY3_TILE_BYTES, the task is split into
+// bands of rows that do.  Tiling requires A to be sparse or hypersparse and
+// not jumbled, B to be sparse or hypersparse, and the mask to not be applied
+// during saxpy3 (tile_ok is false otherwise).
+
+static inline int GB_saxpy3_nbands
+(
+    int64_t hash_size,  // hash table size for this task
+    int64_t cvlen,      // vector length of C
+    bool tile_ok        // if true, the task can be tiled
+)
+{
+    if (!tile_ok || hash_size != cvlen)
+    { 
+        // not a Gustavson task, or A, B, or M are not suitable for tiling
+        return (1) ;
+    }
+    double workspace = ((double) cvlen) * GB_SAXPY3_TILE_ROW_BYTES ;
+    double nbands = ceil (workspace / GB_SAXPY3_TILE_BYTES) ;
+    return ((int) GB_IMIN (nbands, GB_SAXPY3_TILE_MAX_BANDS)) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_AxB_saxpy3_slice_balanced: create balanced parallel tasks for saxpy3
 //------------------------------------------------------------------------------
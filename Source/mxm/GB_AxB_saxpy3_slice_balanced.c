@@ -124,7 +124,8 @@ static inline void GB_create_coarse_task
     double chunk,
     int nthreads_max,
     int64_t *Coarse_Work,   // workspace for parallel reduction for flop count
-    const GrB_Desc_Value AxB_method     // Default, Gustavson, or Hash
+    const GrB_Desc_Value AxB_method,    // Default, Gustavson, or Hash
+    const bool tile_ok      // if true, a coarse Gustavson task can be tiled
 )
 {
 
@@ -176,13 +177,16 @@ static inline void GB_create_coarse_task
     SaxpyTasks [taskid].start  = kfirst ;
     SaxpyTasks [taskid].end    = klast ;
     SaxpyTasks [taskid].vector = -1 ;
-    SaxpyTasks [taskid].hsize  = GB_hash_table_size (flmax, cvlen, AxB_method) ;
+    int64_t hsize = GB_hash_table_size (flmax, cvlen, AxB_method) ;
+    SaxpyTasks [taskid].hsize  = hsize ;
     SaxpyTasks [taskid].Hi     = NULL ;      // assigned later
     SaxpyTasks [taskid].Hf     = NULL ;      // assigned later
     SaxpyTasks [taskid].Hx     = NULL ;      // assigned later
+    SaxpyTasks [taskid].mark   = 0 ;        // assigned later
     SaxpyTasks [taskid].my_cjnz = 0 ;        // for fine tasks only 
     SaxpyTasks [taskid].leader  = taskid ;
     SaxpyTasks [taskid].team_size = 1 ;
+    SaxpyTasks [taskid].nbands = GB_saxpy3_nbands (hsize, cvlen, tile_ok) ;
 }
 
 //------------------------------------------------------------------------------
@@ -402,6 +406,14 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
         GBURBLE ("(use mask) ") ;
     }
 
+    //--------------------------------------------------------------------------
+    // determine if coarse Gustavson tasks can be tiled
+    //--------------------------------------------------------------------------
+
+    const bool tile_ok = !(*apply_mask) && !(A->jumbled)
+        && (GB_IS_SPARSE (A) || A_is_hyper)
+        && (GB_IS_SPARSE (B) || B_is_hyper) ;
+
     //--------------------------------------------------------------------------
     // determine # of threads and # of initial coarse tasks
     //--------------------------------------------------------------------------
@@ -650,7 +662,8 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                             // kcoarse_start:kk-1 form a single coarse task
                             GB_create_coarse_task (kcoarse_start, kk-1,
                                 SaxpyTasks, nc++, Bflops, cvlen, chunk,
-                                nthreads_max, Coarse_Work, AxB_method) ;
+                                nthreads_max, Coarse_Work, AxB_method,
+                                tile_ok) ;
                         }
 
                         // next coarse task (if any) starts at kk+1
@@ -720,9 +733,11 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                             SaxpyTasks [nf].Hi = NULL ;   // assigned later
                             SaxpyTasks [nf].Hf = NULL ;   // assigned later
                             SaxpyTasks [nf].Hx = NULL ;   // assigned later
+                            SaxpyTasks [nf].mark = 0 ;
                             SaxpyTasks [nf].my_cjnz = 0 ;
                             SaxpyTasks [nf].leader = leader ;
                             SaxpyTasks [nf].team_size = team_size ;
+                            SaxpyTasks [nf].nbands = 1 ;
                             nf++ ;
                         }
                     }
@@ -734,7 +749,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                     // kcoarse_start:klast-1 form a single coarse task
                     GB_create_coarse_task (kcoarse_start, klast-1, SaxpyTasks,
                         nc++, Bflops, cvlen, chunk, nthreads_max,
-                        Coarse_Work, AxB_method) ;
+                        Coarse_Work, AxB_method, tile_ok) ;
                 }
 
             }
@@ -743,7 +758,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                 // This coarse task is OK as-is.
                 GB_create_coarse_task (kfirst, klast-1, SaxpyTasks,
                     nc++, Bflops, cvlen, chunk, nthreads_max,
-                    Coarse_Work, AxB_method) ;
+                    Coarse_Work, AxB_method, tile_ok) ;
             }
         }
 
@@ -757,7 +772,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
 
         // create a single coarse task: hash or Gustavson
         GB_create_coarse_task (0, bnvec-1, SaxpyTasks, 0, Bflops, cvlen, 1, 1,
-            Coarse_Work, AxB_method) ;
+            Coarse_Work, AxB_method, tile_ok) ;
 
         int64_t hash_size = SaxpyTasks [0].hsize ;
         bool use_Gustavson = (hash_size == cvlen) ;
@@ -37,6 +37,9 @@ GrB_Info GB_AxB_saxpy3_slice_quick
 
     const int64_t bnvec = B->nvec ;
     const int64_t cvlen = A->vlen ;
+    const bool tile_ok = !(A->jumbled)
+        && (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A))
+        && (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)) ;
 
     //--------------------------------------------------------------------------
     // allocate the task
@@ -65,9 +68,11 @@ GrB_Info GB_AxB_saxpy3_slice_quick
     SaxpyTasks [0].Hi      = NULL ;      // assigned later
     SaxpyTasks [0].Hf      = NULL ;      // assigned later
     SaxpyTasks [0].Hx      = NULL ;      // assigned later
+    SaxpyTasks [0].mark    = 0 ;         // assigned later
     SaxpyTasks [0].my_cjnz = 0 ;         // unused
     SaxpyTasks [0].leader  = 0 ;
     SaxpyTasks [0].team_size = 1 ;
+    SaxpyTasks [0].nbands  = GB_saxpy3_nbands (cvlen, cvlen, tile_ok) ;
 
     //--------------------------------------------------------------------------
     // return result
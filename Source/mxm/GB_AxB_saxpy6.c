@@ -0,0 +1,351 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy6: compute C=A*B where A is full and tall-and-skinny
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_AxB_saxpy6 computes C=A*B where A is full and non-iso with between 2 and
+// 64 rows, and B is sparse or hypersparse.  No mask is present, and C is not
+// iso.  C is returned as full if B has no empty vectors, or bitmap otherwise.
+
+// This case arises in C=A*B when A is sparse and held by row, and B is full,
+// held by row, with a small number of columns (a set of feature vectors, for
+// example).  GB_AxB_meta computes this as C'=B'*A', so B' becomes the full
+// matrix with 2 to 64 rows, which is the A matrix here.  Each column C(:,j)
+// is then a linear combination of the columns of A, and is held in a set of
+// registers while it is computed.
+
+// Only the PLUS_TIMES, PLUS_FIRST, PLUS_SECOND, and MAX_PLUS semirings are
+// supported, for the FP32 and FP64 types, with no typecasting.  Explicit
+// AVX512F and AVX2 variants are used, if available.  GrB_NO_VALUE is returned
+// if the method does not apply, and the caller falls back to another method.
+
+// Rows of C that do not fill a whole vector (GB_AxB_saxpy6_vl entries) are
+// computed one at a time, which is slower than the dot2 method.  Thus saxpy6
+// is not used if A has fewer rows than that, except for PLUS_SECOND, which
+// does not access A.
+
+#include "mxm/GB_mxm.h"
+#include "mxm/GB_AxB_saxpy.h"
+#include "binaryop/GB_binop.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_WERK_POP (B_slice, int64_t) ;        \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    GB_phybix_free (C) ;                    \
+}
+
+//------------------------------------------------------------------------------
+// the saxpy6 kernels
+//------------------------------------------------------------------------------
+
+// max(c,t) for vectors, where c is never NaN: if t is NaN, c is unchanged,
+// just like fmax (c,t)
+#define GB_S6_VMAX(c,t)                                                 \
+{                                                                       \
+    vi mask_ = (vi) ((t) > (c)) ;                                       \
+    c = (v) ((((vi) (t)) & mask_) | (((vi) (c)) & ~mask_)) ;            \
+}
+
+#define GB_S6_GETB_VALUE(bkj,pB) \
+    const GB_S6_TYPE bkj = Bx [B_iso ? 0 : (pB)]
+
+// PLUS_TIMES:
+#define GB_S6_A_IS_PATTERN 0
+#define GB_S6_B_IS_PATTERN 0
+#define GB_S6_IDENTITY 0
+#define GB_S6_GETB(bkj,pB)          GB_S6_GETB_VALUE (bkj, pB)
+#define GB_S6_MULTADD(c,a,b)        c += (a) * (b)
+#define GB_S6_MULTADD_V(c,a,b)      c += (a) * (b)
+
+    #define GB_S6_NAME plus_times_fp32
+    #define GB_S6_TYPE float
+    #define GB_S6_NBITS 32
+    #include "mxm/template/GB_AxB_saxpy6_variants.c"
+    #undef  GB_S6_NAME
+    #undef  GB_S6_TYPE
+    #undef  GB_S6_NBITS
+
+    #define GB_S6_NAME plus_times_fp64
+    #define GB_S6_TYPE double
+    #define GB_S6_NBITS 64
+    #include "mxm/template/GB_AxB_saxpy6_variants.c"
+    #undef  GB_S6_NAME
+    #undef  GB_S6_TYPE
+    #undef  GB_S6_NBITS
+
+#undef  GB_S6_B_IS_PATTERN
+#undef  GB_S6_GETB
+#undef  GB_S6_MULTADD
+#undef  GB_S6_MULTADD_V
+
+// PLUS_FIRST: B is not accessed
+#define GB_S6_B_IS_PATTERN 1
+#define GB_S6_GETB(bkj,pB)
+#define GB_S6_MULTADD(c,a,b)        c += (a)
+#define GB_S6_MULTADD_V(c,a,b)      c += (a)
+
+    #define GB_S6_NAME plus_first_fp32
+    #define GB_S6_TYPE float
+    #define GB_S6_NBITS 32
+    #include "mxm/template/GB_AxB_saxpy6_variants.c"
+    #undef  GB_S6_NAME
+    #undef  GB_S6_TYPE
+    #undef  GB_S6_NBITS
+
+    #define GB_S6_NAME plus_first_fp64
+    #define GB_S6_TYPE double
+    #define GB_S6_NBITS 64
+    #include "mxm/template/GB_AxB_saxpy6_variants.c"
+    #undef  GB_S6_NAME
+    #undef  GB_S6_TYPE
+    #undef  GB_S6_NBITS
+
+#undef  GB_S6_A_IS_PATTERN
+#undef  GB_S6_B_IS_PATTERN
+#undef  GB_S6_GETB
+#undef  GB_S6_MULTADD
+#undef  GB_S6_MULTADD_V
+
+// PLUS_SECOND: A is not accessed
+#define GB_S6_A_IS_PATTERN 1
+#define GB_S6_B_IS_PATTERN 0
+#define GB_S6_GETB(bkj,pB)          GB_S6_GETB_VALUE (bkj, pB)
+#define GB_S6_MULTADD(c,a,b)        c += (b)
+#define GB_S6_MULTADD_V(c,a,b)      c += (b)
+
+    #define GB_S6_NAME plus_second_fp32
+    #define GB_S6_TYPE float
+    #define GB_S6_NBITS 32
+    #include "mxm/template/GB_AxB_saxpy6_variants.c"
+    #undef  GB_S6_NAME
+    #undef  GB_S6_TYPE
+    #undef  GB_S6_NBITS
+
+    #define GB_S6_NAME plus_second_fp64
+    #define GB_S6_TYPE double
+    #define GB_S6_NBITS 64
+    #include "mxm/template/GB_AxB_saxpy6_variants.c"
+    #undef  GB_S6_NAME
+    #undef  GB_S6_TYPE
+    #undef  GB_S6_NBITS
+
+#undef  GB_S6_A_IS_PATTERN
+#undef  GB_S6_IDENTITY
+#undef  GB_S6_MULTADD
+#undef  GB_S6_MULTADD_V
+
+// MAX_PLUS:
+#define GB_S6_A_IS_PATTERN 0
+#define GB_S6_IDENTITY (-INFINITY)
+#define GB_S6_MULTADD_V(c,a,b)                                          \
+{                                                                       \
+    v t_ = (a) + (b) ;                                                  \
+    GB_S6_VMAX (c, t_) ;                                                \
+}
+
+    #define GB_S6_NAME max_plus_fp32
+    #define GB_S6_TYPE float
+    #define GB_S6_ITYPE int32_t
+    #define GB_S6_NBITS 32
+    #define GB_S6_MULTADD(c,a,b)    c = fmaxf (c, (a) + (b))
+    #include "mxm/template/GB_AxB_saxpy6_variants.c"
+    #undef  GB_S6_NAME
+    #undef  GB_S6_TYPE
+    #undef  GB_S6_ITYPE
+    #undef  GB_S6_NBITS
+    #undef  GB_S6_MULTADD
+
+    #define GB_S6_NAME max_plus_fp64
+    #define GB_S6_TYPE double
+    #define GB_S6_ITYPE int64_t
+    #define GB_S6_NBITS 64
+    #define GB_S6_MULTADD(c,a,b)    c = fmax (c, (a) + (b))
+    #include "mxm/template/GB_AxB_saxpy6_variants.c"
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy6_vl: # of entries in a vector of the kernel variant used
+//------------------------------------------------------------------------------
+
+static int64_t GB_AxB_saxpy6_vl (const size_t zsize)
+{
+    #if GB_COMPILER_SUPPORTS_AVX512F
+    if (GB_Global_cpu_features_avx512f ( ))
+    {
+        return (64 / zsize) ;
+    }
+    #endif
+    #if GB_COMPILER_SUPPORTS_AVX2
+    if (GB_Global_cpu_features_avx2 ( ))
+    {
+        return (32 / zsize) ;
+    }
+    #endif
+    // the vanilla kernel uses a workspace of 16 entries
+    return (16) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy6: compute C=A*B
+//------------------------------------------------------------------------------
+
+typedef void (*GB_AxB_saxpy6_kernel_f)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict B_slice,
+    const int ntasks,
+    const int nthreads,
+    int64_t *cnvals_handle
+) ;
+
+GrB_Info GB_AxB_saxpy6              // C=A*B, A full with 2 to 64 rows
+(
+    GrB_Matrix C,                   // output matrix, static header
+    const GrB_Matrix A,             // input matrix A, full
+    const GrB_Matrix B,             // input matrix B, sparse or hypersparse
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_WERK_DECLARE (B_slice, int64_t) ;
+    ASSERT (C != NULL && (C->static_header || GBNSTATIC)) ;
+    ASSERT_MATRIX_OK (A, "A for saxpy6 C=A*B", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for saxpy6 C=A*B", GB0) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for saxpy6 C=A*B", GB0) ;
+    ASSERT (A->vdim == B->vlen) ;
+
+    if (!GB_IS_FULL (A) || A->iso || A->vlen < 2 || A->vlen > 64
+        || !(GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)))
+    {
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the semiring operators
+    //--------------------------------------------------------------------------
+
+    GrB_BinaryOp mult = semiring->multiply ;
+    bool A_is_pattern, B_is_pattern ;
+    GB_binop_pattern (&A_is_pattern, &B_is_pattern, flipxy, mult->opcode) ;
+
+    GB_Opcode mult_binop_code, add_binop_code ;
+    GB_Type_code xcode, ycode, zcode ;
+    if (!GB_AxB_semiring_builtin (A, A_is_pattern, B, B_is_pattern, semiring,
+        flipxy, &mult_binop_code, &add_binop_code, &xcode, &ycode, &zcode))
+    {
+        return (GrB_NO_VALUE) ;
+    }
+
+    GB_AxB_saxpy6_kernel_f kernel = NULL ;
+    #define GB_S6_CASE(add,mult,name)                                   \
+        if (add_binop_code == add && mult_binop_code == mult)           \
+        {                                                               \
+            kernel = (zcode == GB_FP32_code) ?                          \
+                GB_AxB_saxpy6_ ## name ## _fp32_kernel :                \
+                GB_AxB_saxpy6_ ## name ## _fp64_kernel ;                \
+        }
+    if (zcode == GB_FP32_code || zcode == GB_FP64_code)
+    {
+        GB_S6_CASE (GB_PLUS_binop_code, GB_TIMES_binop_code,  plus_times)
+        GB_S6_CASE (GB_PLUS_binop_code, GB_FIRST_binop_code,  plus_first)
+        GB_S6_CASE (GB_PLUS_binop_code, GB_SECOND_binop_code, plus_second)
+        GB_S6_CASE (GB_MAX_binop_code,  GB_PLUS_binop_code,   max_plus)
+    }
+    if (kernel == NULL)
+    {
+        return (GrB_NO_VALUE) ;
+    }
+
+    size_t zsize = semiring->add->op->ztype->size ;
+    if (!A_is_pattern && A->vlen < GB_AxB_saxpy6_vl (zsize))
+    {
+        // too few rows to fill a single vector
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate C as full if B has no empty vectors, or bitmap otherwise
+    //--------------------------------------------------------------------------
+
+    if (B->nvec_nonempty < 0)
+    {
+        B->nvec_nonempty = GB_nvec_nonempty (B) ;
+    }
+    int C_sparsity = (B->nvec_nonempty == B->vdim) ? GxB_FULL : GxB_BITMAP ;
+
+    GBURBLE ("(saxpy6: %s = %s*%s, %d rows) ",
+        GB_sparsity_char (C_sparsity),
+        GB_sparsity_char_matrix (A),
+        GB_sparsity_char_matrix (B), (int) A->vlen) ;
+
+    int64_t cnz ;
+    bool ok = GB_int64_multiply ((GrB_Index *) (&cnz), A->vlen, B->vdim) ;
+    if (!ok)
+    {
+        // C is too large
+        return (GrB_NO_VALUE) ;
+    }
+
+    // set C->iso = false   OK
+    GB_OK (GB_new_bix (&C, // full or bitmap, existing header
+        semiring->add->op->ztype, A->vlen, B->vdim, GB_Ap_null, true,
+        C_sparsity, true, B->hyper_switch, -1, cnz, true, false)) ;
+
+    //--------------------------------------------------------------------------
+    // determine the # of threads to use and the parallel tasks
+    //--------------------------------------------------------------------------
+
+    int64_t bnz = GB_nnz_held (B) ;
+    int64_t bnvec = B->nvec ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (cnz + A->vlen * bnz, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : 4 * nthreads ;
+    ntasks = GB_IMIN (ntasks, bnvec) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
+    GB_WERK_PUSH (B_slice, ntasks + 1, int64_t) ;
+    if (B_slice == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    GB_p_slice (B_slice, B->p, bnvec, ntasks, false) ;
+
+    //--------------------------------------------------------------------------
+    // C = A*B
+    //--------------------------------------------------------------------------
+
+    int64_t cnvals = 0 ;
+    kernel (C, A, B, B_slice, ntasks, nthreads, &cnvals) ;
+    if (C_sparsity == GxB_BITMAP)
+    {
+        C->nvals = cnvals ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    C->magic = GB_MAGIC ;
+    ASSERT_MATRIX_OK (C, "saxpy6: C = A*B output", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,521 @@
+//------------------------------------------------------------------------------
+// GB_AxB_tune: calibrated and online selection of dot2 vs saxpy for C=A'*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_AxB_dot2_control selects between the dot2 method (C=A'*B computed as a
+// bitmap, without transposing A) and the saxpy method (A is transposed and
+// then C=(A')*B is computed via saxpy) when A and B are both sparse or
+// hypersparse.  This is the decision used for most y=A*x and y=A'*x with a
+// sparse vector x.  The fixed rule uses dot2 when the C bitmap is tiny
+// compared with A and B: cnz < dot2_ratio * (anz + bnz), with a default
+// dot2_ratio of 1e-4.
+
+// GxB_AxB_TUNE selects how dot2_ratio is found:
+
+// GxB_AxB_TUNE_OFF: the fixed rule with dot2_ratio = 1e-4 (the default).
+
+// GxB_AxB_TUNE_CALIBRATED: dot2_ratio is found by a microbenchmark on this
+//      host (GB_AxB_tune_calibrate).  The result is saved in the JIT cache
+//      folder, as GB_AxB_tune.txt, and loaded from there the next time it is
+//      needed, so the benchmark only runs once per host and library version.
+//      It can also be set directly with GxB_AxB_DOT2_RATIO.
+
+// GxB_AxB_TUNE_ONLINE: the calibrated rule is used as a starting point.  Each
+//      problem is also placed into a shape class, by the ratio cnz/(anz+bnz)
+//      and the total size anz+bnz+cnz.  The run time of each dot2 or saxpy
+//      method used for C=A'*B is recorded for its shape class, normalized by
+//      anz+bnz+cnz.  Once both methods have been tried a few times in a shape
+//      class, the faster one is used for all further problems in that class.
+
+// Both tuned modes require a wall-clock timer, which is only available when
+// the library is compiled with OpenMP (GB_OPENMP_GET_WTIME is zero otherwise).
+// Without OpenMP, GxB_AxB_TUNE_CALIBRATED, GxB_AxB_TUNE_ONLINE, and
+// GxB_AxB_CALIBRATE return GrB_NOT_IMPLEMENTED.
+
+#include "mxm/GB_mxm.h"
+#include "jitifyer/GB_jitifyer.h"
+#include "jitifyer/GB_file.h"
+
+#define GB_FREE_ALL ;
+
+#if defined ( _OPENMP )
+#define GB_AXB_TUNE_HAS_TIMER true
+#else
+#define GB_AXB_TUNE_HAS_TIMER false
+#endif
+
+//------------------------------------------------------------------------------
+// online statistics
+//------------------------------------------------------------------------------
+
+// shape classes: 16 classes for the ratio r = cnz/(anz+bnz), from 2^(-14) to
+// 4, times 6 classes for the total size, anz+bnz+cnz.  Outside of this range
+// of r, the choice is clear and the fixed rules are used.
+
+#define GB_AXB_TUNE_NRATIO  16
+#define GB_AXB_TUNE_NSIZE   6
+#define GB_AXB_TUNE_NCLASS  (GB_AXB_TUNE_NRATIO * GB_AXB_TUNE_NSIZE)
+
+// each method is tried this many times in a shape class before its run time
+// is trusted
+#define GB_AXB_TUNE_WARMUP  3
+
+typedef struct
+{
+    int64_t count [2] ;         // # of times saxpy [0] and dot2 [1] were used
+    double  cost [2] ;          // mean time per unit of work, for each method
+}
+GB_AxB_tune_stats_struct ;
+
+static GB_AxB_tune_stats_struct GB_AxB_tune_stats [GB_AXB_TUNE_NCLASS] ;
+
+//------------------------------------------------------------------------------
+// GB_AxB_tune_clear: clear the online statistics
+//------------------------------------------------------------------------------
+
+void GB_AxB_tune_clear (void)
+{
+    #pragma omp critical (GB_AxB_tune)
+    {
+        memset (GB_AxB_tune_stats, 0, sizeof (GB_AxB_tune_stats)) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_tune_dot2_ratio: return the dot2_ratio for GB_AxB_dot2_control
+//------------------------------------------------------------------------------
+
+double GB_AxB_tune_dot2_ratio (void)
+{
+    return ((GB_Global_axb_tune_get ( ) == GxB_AxB_TUNE_OFF) ?
+        GB_AXB_DOT2_RATIO_DEFAULT : GB_Global_axb_dot2_ratio_get ( )) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_tune_class: determine the shape class of C=A'*B
+//------------------------------------------------------------------------------
+
+// Returns -1 if online tuning is off, or if the problem is outside the range
+// of the shape classes.
+
+int GB_AxB_tune_class
+(
+    double anz,         // # of entries in A
+    double bnz,         // # of entries in B
+    double cnz          // size of the C bitmap, if computed by dot2
+)
+{
+    if (GB_Global_axb_tune_get ( ) != GxB_AxB_TUNE_ONLINE || cnz <= 100)
+    {
+        return (-1) ;
+    }
+    int rlog = (int) floor (log2 (cnz / fmax (anz + bnz, 1))) ;
+    if (rlog < -14 || rlog > 1)
+    {
+        return (-1) ;
+    }
+    int slog = (int) floor (log2 (anz + bnz + cnz)) / 4 - 2 ;
+    slog = GB_IMAX (slog, 0) ;
+    slog = GB_IMIN (slog, GB_AXB_TUNE_NSIZE - 1) ;
+    return (slog * GB_AXB_TUNE_NRATIO + (rlog + 14)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_tune_choose: select dot2 or saxpy using the online statistics
+//------------------------------------------------------------------------------
+
+bool GB_AxB_tune_choose     // return true to use dot2, false for saxpy
+(
+    int tune_class,         // shape class from GB_AxB_tune_class
+    bool use_dot2           // method selected by the calibrated rule
+)
+{
+    if (tune_class < 0 || tune_class >= GB_AXB_TUNE_NCLASS)
+    {
+        return (use_dot2) ;
+    }
+    GB_AxB_tune_stats_struct s ;
+    #pragma omp critical (GB_AxB_tune)
+    {
+        s = GB_AxB_tune_stats [tune_class] ;
+    }
+    if (s.count [use_dot2] < GB_AXB_TUNE_WARMUP)
+    {
+        // first try the method selected by the calibrated rule
+        return (use_dot2) ;
+    }
+    else if (s.count [!use_dot2] < GB_AXB_TUNE_WARMUP)
+    {
+        // then explore the other method
+        return (!use_dot2) ;
+    }
+    else
+    {
+        // both have been tried: use the fastest one
+        return (s.cost [1] < s.cost [0]) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_tune_record: record the run time of dot2 or saxpy
+//------------------------------------------------------------------------------
+
+void GB_AxB_tune_record
+(
+    int tune_class,         // shape class from GB_AxB_tune_class
+    bool used_dot2,         // true if dot2 was used, false for saxpy
+    double work,            // anz + bnz + cnz
+    double t                // run time of the method, in seconds
+)
+{
+    if (tune_class < 0 || tune_class >= GB_AXB_TUNE_NCLASS)
+    {
+        return ;
+    }
+    double cost = t / fmax (work, 1) ;
+    #pragma omp critical (GB_AxB_tune)
+    {
+        GB_AxB_tune_stats_struct *s = &(GB_AxB_tune_stats [tune_class]) ;
+        int64_t n = ++(s->count [used_dot2]) ;
+        // running mean of the first few samples, then an exponential
+        // moving average so the statistics can follow changes in the host
+        double alpha = 1.0 / ((double) GB_IMIN (n, 8)) ;
+        s->cost [used_dot2] += alpha * (cost - s->cost [used_dot2]) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_tune_filename: construct the name of the cost model file
+//------------------------------------------------------------------------------
+
+static char *GB_AxB_tune_filename   // returns NULL if no JIT cache
+(
+    const char *name,
+    size_t *filename_size
+)
+{
+    const char *cache_path = GB_jitifyer_get_cache_path ( ) ;
+    if (cache_path == NULL || cache_path [0] == '\0')
+    {
+        return (NULL) ;
+    }
+    size_t len = strlen (cache_path) + strlen (name) + 2 ;
+    char *filename = GB_MALLOC_WORK (len, char, filename_size) ;
+    if (filename != NULL)
+    {
+        snprintf (filename, len, "%s/%s", cache_path, name) ;
+    }
+    return (filename) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_tune_load: load the cost model from the JIT cache
+//------------------------------------------------------------------------------
+
+static bool GB_AxB_tune_load (void)     // returns true if successful
+{
+    size_t filename_size = 0 ;
+    char *filename = GB_AxB_tune_filename ("GB_AxB_tune.txt", &filename_size) ;
+    if (filename == NULL)
+    {
+        return (false) ;
+    }
+    FILE *fp = fopen (filename, "r") ;
+    GB_FREE_WORK (&filename, filename_size) ;
+    if (fp == NULL)
+    {
+        return (false) ;
+    }
+    int v1 = -1, v2 = -1, v3 = -1 ;
+    double dot2_ratio = 0 ;
+    int r = fscanf (fp, "// SuiteSparse:GraphBLAS %d.%d.%d AxB cost model "
+        "dot2_ratio %lg", &v1, &v2, &v3, &dot2_ratio) ;
+    fclose (fp) ;
+    bool ok = (r == 4 && v1 == GxB_IMPLEMENTATION_MAJOR &&
+        v2 == GxB_IMPLEMENTATION_MINOR && v3 == GxB_IMPLEMENTATION_SUB &&
+        dot2_ratio > 0 && isfinite (dot2_ratio)) ;
+    if (ok)
+    {
+        GB_Global_axb_dot2_ratio_set (dot2_ratio) ;
+        GB_Global_axb_calibrated_set (true) ;
+        GBURBLE ("(AxB cost model loaded: dot2_ratio %g) ", dot2_ratio) ;
+    }
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_tune_save: save the cost model in the JIT cache
+//------------------------------------------------------------------------------
+
+static void GB_AxB_tune_save (double dot2_ratio)
+{
+
+    // lock the cache for this process, so that two processes calibrating at
+    // the same time do not write the file at the same time
+    size_t lockname_size = 0, filename_size = 0 ;
+    char *lockname = GB_AxB_tune_filename ("lock/00/tune_lock",
+        &lockname_size) ;
+    char *filename = GB_AxB_tune_filename ("GB_AxB_tune.txt", &filename_size) ;
+    FILE *fp_lock = NULL ;
+    int fd_lock = -1 ;
+    if (lockname != NULL && filename != NULL &&
+        GB_file_open_and_lock (lockname, &fp_lock, &fd_lock))
+    {
+        FILE *fp = fopen (filename, "w") ;
+        if (fp != NULL)
+        {
+            fprintf (fp, "// SuiteSparse:GraphBLAS %d.%d.%d AxB cost model\n"
+                "dot2_ratio %.17g\n", GxB_IMPLEMENTATION_MAJOR,
+                GxB_IMPLEMENTATION_MINOR, GxB_IMPLEMENTATION_SUB, dot2_ratio) ;
+            fclose (fp) ;
+        }
+        GB_file_unlock_and_close (&fp_lock, &fd_lock) ;
+    }
+    GB_FREE_WORK (&lockname, lockname_size) ;
+    GB_FREE_WORK (&filename, filename_size) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_tune_random: construct a sparse test matrix for the benchmark
+//------------------------------------------------------------------------------
+
+// A is n-by-ncols, held by column, with d entries in each column.  The
+// entries in A(:,j) are spread out over d equal bands of rows, with one entry
+// in each band at a pseudo-random position.
+
+static GrB_Info GB_AxB_tune_random
+(
+    GrB_Matrix *Ahandle,
+    int64_t n,
+    int64_t ncols,
+    int64_t d,
+    uint64_t seed
+)
+{
+    GrB_Info info ;
+    int64_t anz = ncols * d ;
+    GB_OK (GB_new_bix (Ahandle, // sparse, new header
+        GrB_FP64, n, ncols, GB_Ap_malloc, true, GxB_SPARSE, false,
+        GB_HYPER_SWITCH_DEFAULT, ncols, anz, true, false)) ;
+    GrB_Matrix A = (*Ahandle) ;
+    int64_t *restrict Ap = A->p ;
+    int64_t *restrict Ai = A->i ;
+    double  *restrict Ax = (double *) A->x ;
+    int64_t band = n / d ;
+    uint64_t state = seed ;
+    for (int64_t j = 0 ; j < ncols ; j++)
+    {
+        Ap [j] = j * d ;
+        for (int64_t k = 0 ; k < d ; k++)
+        {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL ;
+            int64_t p = j * d + k ;
+            Ai [p] = k * band + (int64_t) ((state >> 33) % band) ;
+            Ax [p] = 1 + (double) (k & 3) ;
+        }
+    }
+    Ap [ncols] = anz ;
+    A->nvals = anz ;
+    A->nvec_nonempty = ncols ;
+    A->magic = GB_MAGIC ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_tune_time: time C=A'*B with a given method
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_AxB_tune_time
+(
+    double *t,                  // best time of 3 trials
+    GrB_Matrix C,
+    GrB_Matrix A,
+    GrB_Matrix B,
+    GrB_Desc_Value AxB_method,  // GxB_AxB_DOT or GxB_AxB_SAXPY
+    GB_Werk Werk
+)
+{
+    GrB_Info info ;
+    double tbest = INFINITY ;
+    for (int trial = 0 ; trial < 3 ; trial++)
+    {
+        // the first trial may include the time to load or compile a JIT
+        // kernel, so the best time of the 3 trials is used
+        double t0 = GB_OPENMP_GET_WTIME ;
+        GB_OK (GB_mxm (C, true, NULL, false, false, NULL,
+            GrB_PLUS_TIMES_SEMIRING_FP64, A, true, B, false, false,
+            AxB_method, 0, NULL, NULL, Werk)) ;
+        tbest = fmin (tbest, GB_OPENMP_GET_WTIME - t0) ;
+    }
+    (*t) = tbest ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_tune_calibrate: fit dot2_ratio for this host
+//------------------------------------------------------------------------------
+
+// C=A'*B is computed with the dot2 and saxpy methods, for a range of sparse
+// matrices A and B that span the ratio r = cnz/(anz+bnz) from about 1/64 to
+// 64.  A is n-by-n with d entries per column, and B is n-by-m with 4 entries
+// per column, so r is about m/d.  The dot2_ratio is then selected to minimize
+// the total run time if the rule "use dot2 if r < dot2_ratio" were applied to
+// all of these problems.
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_Matrix_free (&A) ;           \
+    GB_Matrix_free (&B) ;           \
+    GB_Matrix_free (&C) ;           \
+}
+
+#define GB_AXB_TUNE_NTRIALS 15
+
+GrB_Info GB_AxB_tune_calibrate (GB_Werk Werk)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL ;
+    if (!GB_AXB_TUNE_HAS_TIMER)
+    { 
+        // the benchmark cannot be timed
+        return (GrB_NOT_IMPLEMENTED) ;
+    }
+    GBURBLE ("(AxB calibrate) ") ;
+    bool burble = GB_Global_burble_get ( ) ;
+    GB_Global_burble_set (false) ;
+
+    // the benchmark itself must not be affected by online tuning
+    int tune = GB_Global_axb_tune_get ( ) ;
+    GB_Global_axb_tune_set (GxB_AxB_TUNE_OFF) ;
+
+    const int64_t n = 8192 ;
+    const int64_t dlist [3] = { 32, 8, 2 } ;
+    const int64_t mlist [5] = { 1, 4, 16, 64, 256 } ;
+    double r [GB_AXB_TUNE_NTRIALS] ;
+    double tdot [GB_AXB_TUNE_NTRIALS] ;
+    double tsaxpy [GB_AXB_TUNE_NTRIALS] ;
+    int ntrials = 0 ;
+
+    for (int kd = 0 ; kd < 3 ; kd++)
+    {
+        int64_t d = dlist [kd] ;
+        GB_Matrix_free (&A) ;
+        info = GB_AxB_tune_random (&A, n, n, d, 42 + d) ;
+        for (int km = 0 ; info == GrB_SUCCESS && km < 5 ; km++)
+        {
+            int64_t m = mlist [km] ;
+            GB_Matrix_free (&B) ;
+            GB_Matrix_free (&C) ;
+            info = GB_AxB_tune_random (&B, n, m, 4, 7 + m) ;
+            if (info == GrB_SUCCESS)
+            {
+                info = GB_new (&C, // auto sparsity, new header
+                    GrB_FP64, n, m, GB_Ap_calloc, true, GxB_AUTO_SPARSITY,
+                    GB_Global_hyper_switch_get ( ), 1) ;
+            }
+            if (info == GrB_SUCCESS)
+            {
+                info = GB_AxB_tune_time (&tdot [ntrials], C, A, B,
+                    GxB_AxB_DOT, Werk) ;
+            }
+            if (info == GrB_SUCCESS)
+            {
+                info = GB_AxB_tune_time (&tsaxpy [ntrials], C, A, B,
+                    GxB_AxB_SAXPY, Werk) ;
+            }
+            if (info == GrB_SUCCESS)
+            {
+                double anz = GB_nnz (A) ;
+                double bnz = GB_nnz (B) ;
+                r [ntrials++] = (double) (n * m) / (anz + bnz) ;
+            }
+        }
+        if (info != GrB_SUCCESS)
+        {
+            break ;
+        }
+    }
+
+    GB_FREE_ALL ;
+    GB_Global_axb_tune_set (tune) ;
+    GB_Global_burble_set (burble) ;
+    if (info != GrB_SUCCESS)
+    {
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the dot2_ratio that minimizes the total run time
+    //--------------------------------------------------------------------------
+
+    // try each candidate threshold just above each r [k], and the default
+    double best_ratio = GB_AXB_DOT2_RATIO_DEFAULT ;
+    double best_time = INFINITY ;
+    for (int k = -1 ; k < ntrials ; k++)
+    {
+        double ratio = (k < 0) ? GB_AXB_DOT2_RATIO_DEFAULT : (r [k] * 1.001) ;
+        double total = 0 ;
+        for (int i = 0 ; i < ntrials ; i++)
+        {
+            total += (r [i] < ratio) ? tdot [i] : tsaxpy [i] ;
+        }
+        if (total < best_time)
+        {
+            best_time = total ;
+            best_ratio = ratio ;
+        }
+    }
+
+    GB_Global_axb_dot2_ratio_set (best_ratio) ;
+    GB_Global_axb_calibrated_set (true) ;
+    GB_AxB_tune_save (best_ratio) ;
+    GBURBLE ("(AxB calibrated: dot2_ratio %g) ", best_ratio) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_tune_set: set the tuning mode
+//------------------------------------------------------------------------------
+
+// If the calibrated cost model is needed but has not yet been found, it is
+// loaded from the JIT cache, or computed and saved there if not present.
+
+GrB_Info GB_AxB_tune_set (int tune, GB_Werk Werk)
+{
+    if (! (tune == GxB_AxB_TUNE_OFF || tune == GxB_AxB_TUNE_CALIBRATED ||
+           tune == GxB_AxB_TUNE_ONLINE))
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+    if (tune != GxB_AxB_TUNE_OFF && !GB_AXB_TUNE_HAS_TIMER)
+    { 
+        // the tuned modes rely on run times, which cannot be measured
+        return (GrB_NOT_IMPLEMENTED) ;
+    }
+    if (tune != GxB_AxB_TUNE_OFF && !GB_Global_axb_calibrated_get ( ))
+    {
+        if (!GB_AxB_tune_load ( ))
+        {
+            GrB_Info info = GB_AxB_tune_calibrate (Werk) ;
+            if (info != GrB_SUCCESS)
+            {
+                return (info) ;
+            }
+        }
+    }
+    if (tune == GxB_AxB_TUNE_ONLINE &&
+        GB_Global_axb_tune_get ( ) != GxB_AxB_TUNE_ONLINE)
+    {
+        // start with fresh statistics
+        GB_AxB_tune_clear ( ) ;
+    }
+    GB_Global_axb_tune_set (tune) ;
+    return (GrB_SUCCESS) ;
+}
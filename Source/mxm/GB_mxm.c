@@ -10,7 +10,18 @@
 // C<M> = accum (C,A*B) and variations.
 
 // This function is not user-callable.  It does the work for user-callable
-// functions GrB_mxm, GrB_mxv, and GrB_vxm.
+// functions GrB_mxm, GrB_mxv, GrB_vxm, and GxB_mxm_select.
+
+// If select_op is present, T = select (T, select_thunk) is applied to the
+// result T=A*B before it is accumulated into C.  If T is computed by the dot3
+// or saxpy3 JIT kernel, the kernel applies the select_op to each entry as it
+// is computed, and the entries it drops become zombies in T.  This requires a
+// select_op with a function pointer, a bool ztype, and an xtype that is NULL
+// or the same as the type of T.  Otherwise, or if T is computed by any other
+// kernel (a factory or generic kernel, dot2, bitmap saxpy, etc), the
+// select_op is applied to T afterwards, in place, by GB_selector.  C is never
+// computed in place when a select_op is present, since T must exist on its
+// own.
 
 #define GB_FREE_ALL         \
 {                           \
@@ -20,6 +31,7 @@
 
 #include "mxm/GB_mxm.h"
 #include "mask/GB_accum_mask.h"
+#include "select/GB_select.h"
 
 GrB_Info GB_mxm                     // C<M> = A*B
 (
@@ -37,6 +49,8 @@ GrB_Info GB_mxm                     // C<M> = A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
     const int do_sort,              // if nonzero, try to return C unjumbled
+    const GrB_IndexUnaryOp select_op,   // optional: T = select (T,thunk)
+    const GrB_Scalar select_thunk,      // thunk for select_op
     GB_Werk Werk
 )
 {
@@ -98,6 +112,44 @@ GrB_Info GB_mxm                     // C<M> = A*B
             bnrows, bncols, B_transpose ? " (transposed)" : "") ;
     }
 
+    // check the optional select_op
+    if (select_op != NULL)
+    {
+        GB_RETURN_IF_FAULTY (select_op) ;
+        GB_RETURN_IF_NULL_OR_FAULTY (select_thunk) ;
+        ASSERT_INDEXUNARYOP_OK (select_op, "select_op for GB_mxm", GB0) ;
+        ASSERT (select_op->opcode != GB_FLIPDIAGINDEX_idxunop_code) ;
+        if (!GB_Type_compatible (T_type, select_op->xtype))
+        { 
+            GB_ERROR (GrB_DOMAIN_MISMATCH,
+                "Incompatible type for T=%s(A*B,Thunk):\n"
+                "A*B type [%s]\n"
+                "cannot be typecast to operator input of type [%s]",
+                select_op->name, T_type->name, select_op->xtype->name) ;
+        }
+        if (!GB_Type_compatible (GrB_BOOL, select_op->ztype))
+        { 
+            GB_ERROR (GrB_DOMAIN_MISMATCH,
+                "Output of user-defined IndexUnaryOp %s is %s\n"
+                "which cannot be typecasted to bool\n",
+                select_op->name, select_op->ztype->name) ;
+        }
+        if (!GB_Type_compatible (select_thunk->type, select_op->ytype))
+        { 
+            GB_ERROR (GrB_DOMAIN_MISMATCH,
+                "Incompatible type for T=%s(A*B,Thunk):\n"
+                "input Thunk type [%s] and op thunk type [%s]"
+                " not compatible", select_op->name,
+                select_thunk->type->name, select_op->ytype->name) ;
+        }
+        GB_MATRIX_WAIT (select_thunk) ;
+        if (GB_nnz ((GrB_Matrix) select_thunk) == 0)
+        { 
+            GB_ERROR (GrB_EMPTY_OBJECT, "Thunk for T=%s(A*B,Thunk)"
+                " cannot be an empty scalar\n", select_op->name) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // finish any pending work and check for C<!NULL> mask
     //--------------------------------------------------------------------------
@@ -138,13 +190,36 @@ GrB_Info GB_mxm                     // C<M> = A*B
     GB_CLEAR_STATIC_HEADER (MT, &MT_header) ;
     GB_CLEAR_STATIC_HEADER (T, &T_header) ;
 
+    // If possible, the select_op is passed to the dot3 and saxpy3 kernels
+    GB_AxB_select_struct Select_struct, *Select = NULL ;
+    size_t ysize = (select_op == NULL) ? 1 : select_op->ytype->size ;
+    GB_void ythunk [GB_VLA(ysize)] ;
+    if (select_op != NULL && select_op->idxunop_function != NULL
+        && select_op->ztype == GrB_BOOL
+        && (select_op->xtype == NULL || select_op->xtype == T_type))
+    { 
+        GB_cast_scalar (ythunk, select_op->ytype->code, select_thunk->x,
+            select_thunk->type->code, ysize) ;
+        Select = &Select_struct ;
+        Select->fselect = select_op->idxunop_function ;
+        Select->ythunk = ythunk ;
+        Select->use_x = (select_op->xtype != NULL) ;
+        Select->flipij = false ;    // set by GB_AxB_meta
+        Select->applied = false ;
+    }
+
     bool mask_applied = false ;
     bool done_in_place = false ;
     bool M_transposed = false ;
-    GB_OK (GB_AxB_meta (T, C, C_replace, C->is_csc, MT, &M_transposed, M,
+    GB_OK (GB_AxB_meta (T, (select_op == NULL) ? C : NULL, C_replace,
+        C->is_csc, MT, &M_transposed, M,
         Mask_comp, Mask_struct, accum, A, B, semiring, A_transpose,
         B_transpose, flipxy, &mask_applied, &done_in_place, AxB_method,
-        do_sort, Werk)) ;
+        do_sort, Select, Werk)) ;
+
+    // C may be aliased with A or B, and GB_AxB_meta may have constructed its
+    // cached transpose, which is no longer valid once C is modified
+    GB_Matrix_free (&(C->AT)) ;
 
     if (done_in_place)
     { 
@@ -161,6 +236,20 @@ GrB_Info GB_mxm                     // C<M> = A*B
     ASSERT (GB_JUMBLED_OK (T)) ;
     ASSERT (!GB_PENDING (T)) ;
 
+    //--------------------------------------------------------------------------
+    // T = select (T, select_thunk), in place
+    //--------------------------------------------------------------------------
+
+    if (select_op != NULL && (Select == NULL || !Select->applied))
+    { 
+        // T was computed by a kernel that does not apply the select_op.
+        // Zombies from the dot3 method are removed first.
+        GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (T) ;
+        GB_OK (GB_selector_flip (NULL, select_op, T->is_csc, T, select_thunk,
+            Werk)) ;
+        ASSERT_MATRIX_OK (T, "T=select(A*B,Thunk) for GB_mxm", GB0) ;
+    }
+
     //--------------------------------------------------------------------------
     // C<M> = accum (C,T): accumulate the results into C via the mask
     //--------------------------------------------------------------------------
@@ -30,6 +30,26 @@ GrB_Info GB_mxm                     // C<M> = A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
     const int do_sort,              // if nonzero, try to return C unjumbled
+    const GrB_IndexUnaryOp select_op,   // optional: T = select (T,thunk)
+    const GrB_Scalar select_thunk,      // thunk for select_op
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_mxm_reduce              // s = accum (s, reduce (C<M>=A*B))
+(
+    GrB_Scalar S,                   // input/output scalar for result
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Monoid monoid,        // monoid to reduce C to a scalar
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    const int do_sort,              // if nonzero, try to return C unjumbled
     GB_Werk Werk
 ) ;
 
@@ -47,6 +67,7 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     bool *mask_applied,             // if true, mask was applied
     bool *done_in_place,            // if true, C_in_place was computed in-place
+    GB_AxB_select_struct *Select,   // optional select op, may be NULL
     GB_Werk Werk
 ) ;
 
@@ -72,6 +93,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     bool *done_in_place,            // if true, C was computed in-place
     GrB_Desc_Value AxB_method,      // for auto vs user selection of methods
     const int do_sort,              // if nonzero, try to return C unjumbled
+    GB_AxB_select_struct *Select,   // optional select op, may be NULL
     GB_Werk Werk
 ) ;
 
@@ -146,6 +168,22 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     const GrB_Matrix B,             // input matrix
     const GrB_Semiring semiring,    // semiring that defines C=A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_AxB_select_struct *Select,   // optional select op, may be NULL
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_AxB_dot3_reduce         // s = sum (C<M>=A'*B), dot3 method
+(
+    // output:
+    GB_void *result,                // scalar result, of type add->op->ztype
+    bool *result_exists,            // true if C has at least one entry
+    // input:
+    const GrB_Matrix M,             // mask matrix
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     GB_Werk Werk
 ) ;
 
@@ -250,9 +288,42 @@ static inline bool GB_AxB_dot3_control
 bool GB_AxB_dot2_control  // true: use dot2, false: use saxpy
 (
     const GrB_Matrix A,
-    const GrB_Matrix B
+    const GrB_Matrix B,
+    int *tune_class         // shape class for online tuning, or -1 if none;
+                            // may be NULL
+) ;
+
+//------------------------------------------------------------------------------
+// GB_AxB_tune: calibrated and online selection of dot2 vs saxpy
+//------------------------------------------------------------------------------
+
+double GB_AxB_tune_dot2_ratio (void) ;
+
+int GB_AxB_tune_class       // shape class, or -1 if not tuned online
+(
+    double anz,             // # of entries in A
+    double bnz,             // # of entries in B
+    double cnz              // size of the C bitmap, if computed by dot2
+) ;
+
+bool GB_AxB_tune_choose     // return true to use dot2, false for saxpy
+(
+    int tune_class,         // shape class from GB_AxB_tune_class
+    bool use_dot2           // method selected by the calibrated rule
 ) ;
 
+void GB_AxB_tune_record
+(
+    int tune_class,         // shape class from GB_AxB_tune_class
+    bool used_dot2,         // true if dot2 was used, false for saxpy
+    double work,            // anz + bnz + cnz
+    double t                // run time of the method, in seconds
+) ;
+
+void GB_AxB_tune_clear (void) ;
+GrB_Info GB_AxB_tune_calibrate (GB_Werk Werk) ;
+GrB_Info GB_AxB_tune_set (int tune, GB_Werk Werk) ;
+
 //------------------------------------------------------------------------------
 // GB_AxB_iso: determine if C=A*B results in an iso matrix C
 //------------------------------------------------------------------------------
@@ -278,6 +349,8 @@ void GB_AxB_meta_adotb_control
 (
     // output:
     int *axb_method,
+    int *tune_class,        // shape class for online tuning, or -1 if none;
+                            // may be NULL
     // input:
     const GrB_Matrix C_in,
     const GrB_Matrix M,
@@ -0,0 +1,183 @@
+//------------------------------------------------------------------------------
+// GB_mxm_reduce: s = accum (s, reduce (C<M>=A*B))
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This function is not user-callable.  It does the work for GxB_mxm_reduce.
+
+// If the mask M is present, not complemented, and sparse or hypersparse, and
+// if the monoid is the same as the additive monoid of the semiring, then the
+// entries of C<M>=A*B are computed with the dot3 method and summed into a
+// scalar as they are computed, without constructing C (see
+// GB_AxB_dot3_reduce).  This is the case for many graph algorithms, such as
+// triangle counting, where s = sum (C<L>=L*L') for the lower triangular part
+// L of the adjacency matrix of the graph.  A and B must be held in a format
+// that does not require an explicit transpose.
+
+// Otherwise, T<M>=A*B is computed with GB_mxm, and then reduced to a scalar
+// with GB_Scalar_reduce.
+
+#define GB_FREE_ALL         \
+{                           \
+    GB_Matrix_free (&T) ;   \
+}
+
+#include "mxm/GB_mxm.h"
+#include "reduce/GB_reduce.h"
+#include "scalar/GB_Scalar_wrap.h"
+
+GrB_Info GB_mxm_reduce              // s = accum (s, reduce (C<M>=A*B))
+(
+    GrB_Scalar S,                   // input/output scalar for result
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Monoid monoid,        // monoid to reduce C to a scalar
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    const int do_sort,              // if nonzero, try to return C unjumbled
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix T = NULL ;
+
+    GB_RETURN_IF_NULL_OR_FAULTY (monoid) ;
+    GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+
+    ASSERT_SCALAR_OK (S, "S input for GB_mxm_reduce", GB0) ;
+    ASSERT_MONOID_OK (monoid, "monoid for GB_mxm_reduce", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_mxm_reduce", GB0) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for GB_mxm_reduce", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for GB_mxm_reduce", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for GB_mxm_reduce", GB0) ;
+
+    // C=A*B via semiring: A and B must be compatible with semiring->multiply
+    GB_OK (GB_BinaryOp_compatible (semiring->multiply,
+            NULL, A->type, B->type, GB_ignore_code, Werk)) ;
+
+    // the type of C must be compatible with the monoid
+    GrB_Type ctype = semiring->add->op->ztype ;
+    if (!GB_Type_compatible (ctype, monoid->op->ztype))
+    { 
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Semiring of type [%s] cannot be reduced with a monoid of type "
+            "[%s]", ctype->name, monoid->op->ztype->name) ;
+    }
+
+    // s = accum (s, reduce (C)): S must be compatible with the monoid, and
+    // with accum if present.  This is checked here, since the fused method
+    // below may clear S without calling GB_Scalar_reduce.
+    GB_OK (GB_compatible (S->type, NULL, NULL, false, accum, monoid->op->ztype,
+        Werk)) ;
+
+    // check the dimensions
+    int64_t anrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    int64_t ancols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    int64_t bnrows = (B_transpose) ? GB_NCOLS (B) : GB_NROWS (B) ;
+    int64_t bncols = (B_transpose) ? GB_NROWS (B) : GB_NCOLS (B) ;
+    if (ancols != bnrows || (M != NULL &&
+        (GB_NROWS (M) != anrows || GB_NCOLS (M) != bncols)))
+    { 
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "Dimensions not compatible:\n"
+            "mask is " GBd "-by-" GBd "\n"
+            "first input is " GBd "-by-" GBd "%s\n"
+            "second input is " GBd "-by-" GBd "%s",
+            (M == NULL) ? anrows : GB_NROWS (M),
+            (M == NULL) ? bncols : GB_NCOLS (M),
+            anrows, ancols, A_transpose ? " (transposed)" : "",
+            bnrows, bncols, B_transpose ? " (transposed)" : "") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // s = reduce (C<M>=A*B) without constructing C, if possible
+    //--------------------------------------------------------------------------
+
+    // C<M>=A*B is computed as C<M>=X'*Y, if M is held by column, or as
+    // C'<M'>=X'*Y with X=B and Y=A' if M is held by row.  In both cases, X
+    // and Y must be held by column (in the transposed sense), so that no
+    // explicit transpose is required: A must be held by row if A_transpose is
+    // false, or by column if A_transpose is true, and the reverse for B.
+
+    bool monoid_matches = (monoid == semiring->add) ||
+        (monoid->op->opcode == semiring->add->op->opcode &&
+         monoid->op->opcode != GB_USER_binop_code &&
+         monoid->op->ztype == ctype) ;
+
+    if (monoid_matches && ancols > 0
+        && GB_AxB_dot3_control (M, Mask_comp)
+        && (AxB_method == GxB_DEFAULT || AxB_method == GxB_AxB_DOT)
+        && (A->is_csc == A_transpose) && (B->is_csc != B_transpose))
+    {
+        GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (M) ;
+        GB_MATRIX_WAIT (A) ;
+        GB_MATRIX_WAIT (B) ;
+        GrB_Matrix X = (M->is_csc) ? A : B ;
+        GrB_Matrix Y = (M->is_csc) ? B : A ;
+        bool flipxy = !(M->is_csc) ;
+        size_t zsize = ctype->size ;
+        GB_void cscalar [GB_VLA(zsize)] ;
+        if ((GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)) &&
+            !GB_AxB_iso (cscalar, X, Y, X->vlen, semiring, flipxy, false))
+        { 
+            GB_void z [GB_VLA(zsize)] ;
+            bool z_exists = false ;
+            info = GB_AxB_dot3_reduce (z, &z_exists, M, Mask_struct, X, Y,
+                semiring, flipxy, Werk) ;
+            if (info == GrB_SUCCESS)
+            {
+                if (z_exists)
+                { 
+                    // s = accum (s, z)
+                    struct GB_Scalar_opaque Z_header ;
+                    GrB_Scalar Z = GB_Scalar_wrap (&Z_header, ctype, z) ;
+                    info = GB_Scalar_reduce (S, accum, monoid,
+                        (GrB_Matrix) Z, Werk) ;
+                }
+                else if (accum == NULL)
+                { 
+                    // C has no entries, so s is cleared
+                    info = GB_clear ((GrB_Matrix) S, Werk) ;
+                }
+            }
+            if (info != GrB_NO_VALUE)
+            { 
+                // the fused method succeeded, or failed with an error
+                return (info) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // T<M>=A*B, then s = accum (s, reduce (T))
+    //--------------------------------------------------------------------------
+
+    bool T_is_csc = (M == NULL) ? true : M->is_csc ;
+    GB_OK (GB_new (&T, // auto sparsity, new header
+        ctype, T_is_csc ? anrows : bncols, T_is_csc ? bncols : anrows,
+        GB_Ap_calloc, T_is_csc, GxB_AUTO_SPARSITY,
+        GB_Global_hyper_switch_get ( ), 1)) ;
+    GB_OK (GB_mxm (T, false, M, Mask_comp, Mask_struct, NULL, semiring,
+        A, A_transpose, B, B_transpose, false, AxB_method, do_sort, NULL, NULL,
+        Werk)) ;
+    GB_OK (GB_Scalar_reduce (S, accum, monoid, T, Werk)) ;
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
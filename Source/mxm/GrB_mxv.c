@@ -63,6 +63,7 @@ GrB_Info GrB_mxv                    // w<M> = accum (w, A*u)
         (GrB_Matrix) u,     false,          // u is never transposed
         false,                              // fmult(x,y), flipxy = false
         AxB_method, do_sort,                // algorithm selector
+        NULL, NULL,                         // no select op
         Werk) ;
 
     GB_BURBLE_END ;
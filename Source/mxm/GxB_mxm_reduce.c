@@ -0,0 +1,66 @@
+//------------------------------------------------------------------------------
+// GxB_mxm_reduce: reduce a matrix-matrix product to a scalar
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// s = accum (s, reduce (C<M>=A*B)), where C<M>=A*B is computed with the
+// semiring, and reduced to a scalar with the monoid.  The input matrices A and
+// B are optionally transposed, as determined by the Descriptor desc.
+
+#include "mxm/GB_mxm.h"
+#include "mask/GB_get_mask.h"
+
+GrB_Info GxB_mxm_reduce             // s = accum (s, reduce (C<M>=A*B))
+(
+    GrB_Scalar s,                   // input/output scalar for result
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Monoid monoid,        // monoid to reduce C to a scalar
+    const GrB_Matrix M_in,          // optional mask for C, unused if NULL
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for M, A, and B
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (s, "GxB_mxm_reduce (s, accum, monoid, M, semiring, A, B, desc)");
+    GB_BURBLE_START ("GxB_mxm_reduce") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (s) ;
+    GB_RETURN_IF_FAULTY (M_in) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, B_transpose, AxB_method, do_sort) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // s = accum (s, reduce (C<M>=A*B))
+    //--------------------------------------------------------------------------
+
+    info = GB_mxm_reduce (
+        s,                          // output scalar
+        accum,                      // for accum (s,t)
+        monoid,                     // monoid to reduce C to a scalar
+        M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
+        semiring,                   // semiring that defines C=A*B
+        A,          A_transpose,    // A matrix and its descriptor
+        B,          B_transpose,    // B matrix and its descriptor
+        AxB_method, do_sort,        // algorithm selector
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,79 @@
+//------------------------------------------------------------------------------
+// GxB_mxm_select: matrix-matrix multiply followed by a select
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M> = accum (C, select (A*B, Thunk)) and variations.
+
+// This computes T<M>=A*B followed by C<M>=accum(C,select(T,Thunk)), and T is
+// never returned to the user.  If T is computed by the dot3 or saxpy3 JIT
+// kernels, the op is applied inside the kernel to each entry of T as it is
+// computed, and the entries it drops become zombies of T.  Otherwise (for
+// the generic and factory kernels, and for the other methods), T is computed
+// in full and GB_selector then keeps the selected entries of T, in place.
+// C is never computed in place.  The input matrices A and B are optionally
+// transposed, as determined by the Descriptor desc.
+
+#include "mxm/GB_mxm.h"
+#include "mask/GB_get_mask.h"
+
+GrB_Info GxB_mxm_select             // C<M> = accum (C, select (A*B, Thunk))
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix M_in,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for T=A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_IndexUnaryOp op,      // operator to select entries of A*B
+    const GrB_Scalar Thunk,         // optional input for the select operator
+    const GrB_Descriptor desc       // descriptor for C, M, A, and B,
+                                    // and method used for C=A*B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (C, "GxB_mxm_select (C, M, accum, semiring, A, B, op, Thunk, "
+        "desc)") ;
+    GB_BURBLE_START ("GxB_mxm_select") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_FAULTY (M_in) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (op) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (Thunk) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, B_transpose, AxB_method, do_sort) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C,select(A*B,Thunk)) and variations, using the mxm kernel
+    //--------------------------------------------------------------------------
+
+    info = GB_mxm (
+        C,          C_replace,      // C matrix and its descriptor
+        M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
+        accum,                      // for accum (C,T)
+        semiring,                   // semiring that defines T=A*B
+        A,          A_transpose,    // A matrix and its descriptor
+        B,          B_transpose,    // B matrix and its descriptor
+        false,                      // use fmult(x,y), flipxy = false
+        AxB_method, do_sort,        // algorithm selector
+        op, Thunk,                  // T = select (T,Thunk)
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
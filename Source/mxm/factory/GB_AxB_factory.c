@@ -46,12 +46,14 @@ ASSERT (mult_binop_code != GB_ANY_binop_code) ;
         case GB_FIRST_binop_code   :    // z = x
         //----------------------------------------------------------------------
 
-            // 61 semirings with FIRST:
+            // 65 semirings with FIRST:
             // 50: (min,max,plus,times,any) for 10 non-boolean real
             // 5: (or,and,xor,eq,any) for boolean
             // 6: (plus,times,any) for 2 complex
+            // 4: (bor) for 4 unsigned integers
             #define GB_MNAME _first
             #define GB_COMPLEX
+            #define GB_BITWISE_MONOIDS
             #include "mxm/factory/GB_AxB_type_factory.c"
             break ;
 
@@ -59,12 +61,14 @@ ASSERT (mult_binop_code != GB_ANY_binop_code) ;
         case GB_SECOND_binop_code  :    // z = y
         //----------------------------------------------------------------------
 
-            // 61 semirings with SECOND:
+            // 65 semirings with SECOND:
             // 50: (min,max,plus,times,any) for 10 real non-boolean
             // 5: (or,and,xor,eq,any) for boolean
             // 6: (plus,times,any) for 2 complex
+            // 4: (bor) for 4 unsigned integers
             #define GB_MNAME _second
             #define GB_COMPLEX
+            #define GB_BITWISE_MONOIDS
             #include "mxm/factory/GB_AxB_type_factory.c"
             break ;
 
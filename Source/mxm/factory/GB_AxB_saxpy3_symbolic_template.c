@@ -105,7 +105,10 @@ void GB_EVAL2 (GB (AxB_saxpy3_sym), GB_MASK_A_B_SUFFIX)
     // phase1: count nnz(C(:,j)) for coarse tasks, scatter M for fine tasks
     //==========================================================================
 
-    // At this point, all of Hf [...] is zero, for all tasks.
+    // At this point, all of Hf [...] is zero for the fine tasks.  For a
+    // coarse task, all of its Hf [...] is in the range 0 to
+    // SaxpyTasks [taskid].mark, which is zero unless the Hf workspace has
+    // been kept from a prior call to GB_AxB_saxpy3.
     // Hi and Hx are not initialized.
 
     int taskid ;
@@ -233,7 +236,7 @@ void GB_EVAL2 (GB (AxB_saxpy3_sym), GB_MASK_A_B_SUFFIX)
                 Hf = (int64_t *restrict) SaxpyTasks [taskid].Hf ;
             int64_t kfirst = SaxpyTasks [taskid].start ;
             int64_t klast  = SaxpyTasks [taskid].end ;
-            int64_t mark = 0 ;
+            int64_t mark = SaxpyTasks [taskid].mark ;
 
             if (use_Gustavson)
             {
@@ -31,6 +31,12 @@
 // statement.  For the PAIR operator, these semirings are all done by the
 // single ANY_PAIR iso semiring, since C is always iso in that case.
 
+// GB_BITWISE_MONOIDS is defined for the FIRST and SECOND multiply operators,
+// to enable the BOR monoid for the 4 unsigned integer types.  These bitset
+// semirings treat each entry as a set of independent 1-bit lanes, so that
+// (for example) 64 breadth-first searches can be done with a single uint64_t
+// frontier entry per node.
+
 // the additive operator is a monoid, where all types of x,y,z are the same
 ASSERT (zcode == xcode) ;
 ASSERT (zcode == ycode) ;
@@ -240,6 +246,20 @@ if (xcode != GB_BOOL_code)
             }
             break ;
 
+        #if defined ( GB_BITWISE_MONOIDS )
+        case GB_BOR_binop_code : 
+            switch (xcode)
+            {
+                // 4 unsigned integer types
+                GB_CASE_UINT8  (_bor)
+                GB_CASE_UINT16 (_bor)
+                GB_CASE_UINT32 (_bor)
+                GB_CASE_UINT64 (_bor)
+                default: ;
+            }
+            break ;
+        #endif
+
         default: ;
     }
 }
@@ -272,6 +292,7 @@ else
 #undef GB_COMPLEX
 #undef GB_NO_MIN_MAX_ANY_TIMES_MONOIDS
 #undef GB_MULT_IS_PAIR_OPERATOR
+#undef GB_BITWISE_MONOIDS
 
 #undef GB_CASE_INT8
 #undef GB_CASE_INT16
@@ -281,13 +281,14 @@
 //------------------------------------------------------------------------------
 
 // gather the pattern and values of C(:,j) for a coarse Gustavson task;
-// the pattern is not flagged as jumbled.
+// the pattern is not flagged as jumbled.  GB_GATHER_RANGE_C_j gathers just
+// the entries C(istart:iend-1,j), for a single band of a tiled task.
 
 #if GB_IS_ANY_PAIR_SEMIRING
 
     // ANY_PAIR: result is purely symbolic; no numeric work to do
-    #define GB_GATHER_ALL_C_j(mark)                                 \
-        for (int64_t i = 0 ; i < cvlen ; i++)                       \
+    #define GB_GATHER_RANGE_C_j(mark,istart,iend)                   \
+        for (int64_t i = istart ; i < iend ; i++)                   \
         {                                                           \
             if (Hf [i] == mark)                                     \
             {                                                       \
@@ -298,8 +299,8 @@
 #else
 
     // typical semiring
-    #define GB_GATHER_ALL_C_j(mark)                                 \
-        for (int64_t i = 0 ; i < cvlen ; i++)                       \
+    #define GB_GATHER_RANGE_C_j(mark,istart,iend)                   \
+        for (int64_t i = istart ; i < iend ; i++)                   \
         {                                                           \
             if (Hf [i] == mark)                                     \
             {                                                       \
@@ -310,6 +311,8 @@
 
 #endif
 
+#define GB_GATHER_ALL_C_j(mark) GB_GATHER_RANGE_C_j (mark, 0, cvlen)
+
 //------------------------------------------------------------------------------
 // GB_SORT_C_j_PATTERN: sort C(:,j) for a coarse task, or flag as jumbled
 //------------------------------------------------------------------------------
@@ -0,0 +1,41 @@
+//------------------------------------------------------------------------------
+// GB_AxB_select_struct.h: select op applied by the dot3 and saxpy3 kernels
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#ifndef GB_AXB_SELECT_STRUCT_H
+#define GB_AXB_SELECT_STRUCT_H
+
+// GxB_mxm_select computes T=A*B and then keeps the entries T(i,j) for which
+// z = fselect (T(i,j), i, j, y) is true.  If the dot3 or saxpy3 JIT kernel
+// computes T, it applies fselect to each entry of T as the entry is written,
+// and turns the entries it drops into zombies.  The kernels work on T as if
+// it were held by column, where j is the vector and i is the index in that
+// vector.  If T is held by row, flipij is true, and the kernel passes (j,i) to
+// fselect instead.  x is NULL if the op does not depend on the value of T(i,j)
+// (a positional op); otherwise, T is not iso and the op xtype is T->type.
+
+typedef struct
+{
+    GxB_index_unary_function fselect ;  // z = fselect (x, i, j, y), z is bool
+    const void *ythunk ;    // thunk y, already typecasted to the op ytype
+    bool use_x ;            // if false, fselect is passed x = NULL
+    bool flipij ;           // if true, T is held by row
+    bool applied ;          // set true once a kernel has applied the op to T
+}
+GB_AxB_select_struct ;
+
+// keep = fselect (x, i, j, y) for the entry C(i,j), where x points to its
+// value in Cx, or is NULL if not used
+#define GB_AXB_SELECT_KEEP(keep, Select, x, i, j)                           \
+    bool keep ;                                                             \
+    (Select)->fselect (&keep, (Select)->use_x ? (const void *) (x) : NULL,  \
+        (Select)->flipij ? (j) : (i), (Select)->flipij ? (i) : (j),         \
+        (Select)->ythunk) ;
+
+#endif
+
@@ -24,6 +24,8 @@ typedef struct
     int64_t my_cjnz ;   // # entries in C(:,j) found by this fine task
     int leader ;        // leader fine task for the vector C(:,j)
     int team_size ;     // # of fine tasks in the team for vector C(:,j)
+    int nbands ;        // # of row bands for a coarse Gustavson task
+    int64_t mark ;      // initial mark for a coarse task: all Hf [...] <= mark
 }
 GB_saxpy3task_struct ;
 
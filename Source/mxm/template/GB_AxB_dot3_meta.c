@@ -7,10 +7,17 @@
 
 //------------------------------------------------------------------------------
 
-// This template is #include'd in 3 ways to construct:
+// This template is #include'd in 4 ways to construct:
 //  * a generic method: mxm/factory/GB_AxB_dot_generic.c
 //  * a Factory method: FactoryKernels/GB_AxB_*, the Adot3B method
 //  * a JIT kernel: jit_kernels/GB_jit_kernel_AxB_dot3.c
+//  * a JIT kernel: jit_kernels/GB_jit_kernel_AxB_dot3r.c, which defines
+//      GB_DOT3_REDUCE.  C(i,j) is computed for each entry M(i,j) as usual,
+//      but it is summed into a scalar with the semiring monoid instead of
+//      being saved in C.  C->p and C->h are the pattern of M, and C->i and
+//      C->x are not accessed.  Each task tid sums its entries into Wx [tid],
+//      and Wb [tid] is true if any entry was found.  The result is returned
+//      in (*result), which is valid if (*result_exists) is true.
 
 #define GB_DOT3
 #define GB_DOT3_PHASE2
@@ -19,7 +26,15 @@
 #include "include/GB_AxB_dot_cij.h"
 
 // GB_DOT_ALWAYS_SAVE_CIJ: C(i,j) = cij
-#if GB_CIJ_CHECK
+#if defined ( GB_DOT3_REDUCE )
+
+    // C(i,j) is not saved; the template sums it into the task scalar
+    #define GB_DOT_ALWAYS_SAVE_CIJ      \
+    {                                   \
+        cij_exists = true ;             \
+    }
+
+#elif GB_CIJ_CHECK
 
     #define GB_DOT_ALWAYS_SAVE_CIJ      \
     {                                   \
@@ -41,15 +56,23 @@
 #endif
 
 // GB_DOT_SAVE_CIJ: C(i,j) = cij, if it exists
-#define GB_DOT_SAVE_CIJ                 \
-{                                       \
-    if (GB_CIJ_EXISTS)                  \
-    {                                   \
-        /* Cx [pC] = cij */             \
-        GB_PUTC (cij, Cx, pC) ;         \
-        Ci [pC] = i ;                   \
-    }                                   \
-}
+#if defined ( GB_DOT3_REDUCE )
+
+    #define GB_DOT_SAVE_CIJ
+
+#else
+
+    #define GB_DOT_SAVE_CIJ                 \
+    {                                       \
+        if (GB_CIJ_EXISTS)                  \
+        {                                   \
+            /* Cx [pC] = cij */             \
+            GB_PUTC (cij, Cx, pC) ;         \
+            Ci [pC] = i ;                   \
+        }                                   \
+    }
+
+#endif
 
 {
 
@@ -186,7 +209,35 @@
     }
     #endif
 
+    #if defined ( GB_DOT3_REDUCE )
+    { 
+        // result = sum of the task scalars Wx [0:ntasks-1]
+        bool s_exists = false ;
+        GB_CIJ_DECLARE (s) ;
+        for (int tid = 0 ; tid < ntasks ; tid++)
+        {
+            if (!Wb [tid]) continue ;
+            if (s_exists)
+            { 
+                // s += Wx [tid]
+                GB_UPDATE (s, Wx [tid]) ;
+            }
+            else
+            { 
+                // s = Wx [tid]
+                s = Wx [tid] ;
+                s_exists = true ;
+            }
+        }
+        if (s_exists)
+        { 
+            memcpy (result, &s, sizeof (GB_C_TYPE)) ;
+        }
+        (*result_exists) = s_exists ;
+    }
+    #else
     C->nzombies = nzombies ;
+    #endif
 }
 
 #undef GB_DOT_ALWAYS_SAVE_CIJ
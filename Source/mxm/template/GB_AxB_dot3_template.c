@@ -10,6 +10,13 @@
 // C and M are both sparse or both hyper, and C->h is a copy of M->h.
 // M is present, and not complemented.  It may be valued or structural.
 
+// If GB_DOT3_REDUCE is defined, C is not computed.  Each task sums its
+// entries C(i,j) into Wx [tid] with the monoid, and no zombies are created.
+
+// In the JIT kernel, if Select is not NULL, each entry C(i,j) is also passed
+// to the select op of GxB_mxm_select once it is computed, and it becomes a
+// zombie if the op is false (see GB_AxB_select_struct.h).
+
 {
 
     int tid ;
@@ -27,6 +34,10 @@
         int64_t pC_first = TaskList [tid].pC ;
         int64_t pC_last  = TaskList [tid].pC_end ;
         int64_t task_nzombies = 0 ;     // # of zombies found by this task
+        #if defined ( GB_DOT3_REDUCE )
+        bool task_s_exists = false ;    // true if task_s has a value
+        GB_CIJ_DECLARE (task_s) ;       // sum of C(i,j) for this task
+        #endif
 
         //----------------------------------------------------------------------
         // compute all vectors in this task
@@ -88,6 +99,9 @@
                 if (bjnz == 0)
                 {
                     // no work to do if B(:,j) is empty, except for zombies
+                    #if defined ( GB_DOT3_REDUCE )
+                    continue ;
+                    #endif
                     task_nzombies += (pC_end - pC_start) ;
                     for (int64_t pC = pC_start ; pC < pC_end ; pC++)
                     { 
@@ -156,15 +170,56 @@
                     }
                 }
 
+                #if defined ( GB_DOT3_REDUCE )
+                if (GB_CIJ_EXISTS)
+                {
+                    if (task_s_exists)
+                    { 
+                        // task_s += cij
+                        GB_UPDATE (task_s, cij) ;
+                    }
+                    else
+                    { 
+                        // task_s = cij
+                        task_s = cij ;
+                        task_s_exists = true ;
+                    }
+                }
+                #else
                 if (!GB_CIJ_EXISTS)
                 { 
                     // C(i,j) is a zombie
                     task_nzombies++ ;
                     Ci [pC] = GB_ZOMBIE (i) ;
                 }
+                #if defined ( GB_JIT_KERNEL )
+                else if (Select != NULL)
+                {
+                    // keep C(i,j) only if the select op is true
+                    #if GB_IS_ANY_PAIR_SEMIRING
+                    GB_AXB_SELECT_KEEP (keep, Select, NULL, i, j) ;
+                    #else
+                    GB_AXB_SELECT_KEEP (keep, Select, Cx + pC, i, j) ;
+                    #endif
+                    if (!keep)
+                    {
+                        // C(i,j) is dropped, and becomes a zombie
+                        task_nzombies++ ;
+                        Ci [pC] = GB_ZOMBIE (i) ;
+                    }
+                }
+                #endif
+                #endif
             }
         }
         nzombies += task_nzombies ;
+        #if defined ( GB_DOT3_REDUCE )
+        Wb [tid] = task_s_exists ;
+        if (task_s_exists)
+        { 
+            Wx [tid] = task_s ;
+        }
+        #endif
     }
 }
 
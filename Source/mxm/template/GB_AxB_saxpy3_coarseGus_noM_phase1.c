@@ -10,7 +10,16 @@
 // Initially, Hf [...] < mark for all Hf.
 // Hf [i] is set to mark when C(i,j) is found.
 
+// If the task is tiled (nbands > 1), nnz (C (:,j)) is counted one band of
+// rows at a time, as in GB_AxB_saxpy3_coarseGus_noM_phase5.
+
 {
+    #if ( GB_A_IS_SPARSE || GB_A_IS_HYPER ) && \
+        ( GB_B_IS_SPARSE || GB_B_IS_HYPER )
+    const int nbands = SaxpyTasks [taskid].nbands ;
+    int64_t *restrict Hcursor = SaxpyTasks [taskid].Hi ;
+    #endif
+
     for (int64_t kk = kfirst ; kk <= klast ; kk++)
     {
         GB_GET_B_j ;                    // get B(:,j)
@@ -36,11 +45,67 @@
         #endif
         #endif
 
+        const int64_t f = (++mark) ;
+
+        //----------------------------------------------------------------------
+        // count nnz in C(:,j) one band at a time, if the task is tiled
+        //----------------------------------------------------------------------
+
+        #if ( GB_A_IS_SPARSE || GB_A_IS_HYPER ) && \
+        ( GB_B_IS_SPARSE || GB_B_IS_HYPER )
+        if (nbands > 1)
+        {
+            // find A(:,k) for each entry in B(:,j), and count the flops
+            ASSERT (!A_jumbled) ;
+            int64_t *restrict Hend = Hcursor + bjnz ;
+            const int64_t pB_start = pB ;
+            int64_t bjflops = 0 ;
+            for (int64_t s = 0 ; s < bjnz ; s++)
+            { 
+                int64_t pB = pB_start + s ;
+                GB_GET_B_kj_INDEX ;         // get index k of entry B(k,j)
+                GB_GET_A_k ;                // get A(:,k)
+                Hcursor [s] = pA_start ;
+                Hend [s] = pA_end ;
+                bjflops += aknz ;
+            }
+
+            // use the bands only if B(:,j) is short compared with the work
+            if (bjnz * nbands <= bjflops)
+            {
+                int64_t cjnz = 0 ;
+                const int64_t band_size = GB_ICEIL (cvlen, nbands) ;
+                for (int64_t i1 = 0 ; i1 < cvlen ; i1 += band_size)
+                {
+                    // count the entries in C(i1:i2-1,j)
+                    const int64_t i2 = GB_IMIN (i1 + band_size, cvlen) ;
+                    for (int64_t s = 0 ; s < bjnz ; s++)
+                    {
+                        int64_t pA = Hcursor [s] ;
+                        const int64_t pA_end = Hend [s] ;
+                        for ( ; pA < pA_end ; pA++)
+                        {
+                            GB_GET_A_ik_INDEX ;     // get index i of A(i,k)
+                            if (i >= i2) break ;    // A(i,k) in a later band
+                            if (Hf [i] != f)        // if true, i is new
+                            { 
+                                Hf [i] = f ;        // mark C(i,j) as seen
+                                cjnz++ ;            // C(i,j) is a new entry
+                            }
+                        }
+                        Hcursor [s] = pA ;
+                    }
+                }
+                Cp [kk] = cjnz ;            // save count of entries in C(:,j)
+                continue ;
+            }
+        }
+        #endif
+
         //----------------------------------------------------------------------
         // count nnz in C(:,j), terminating early if C(:,j) becomes dense
         //----------------------------------------------------------------------
 
-        const int64_t f = (++mark) ;
         int64_t cjnz = 0 ;
         for ( ; pB < pB_end && cjnz < cvlen ; pB++)     // scan B(:,j)
         {
@@ -7,7 +7,18 @@
 
 //------------------------------------------------------------------------------
 
+// If the task is tiled (nbands > 1), Hf and Hx are too large to fit in cache.
+// A C(:,j) that is not very sparse is then computed one band of rows at a
+// time, so that each band only touches a cache-sized portion of Hf and Hx.
+// A must be sparse or hypersparse, and not jumbled, and B must be sparse or
+// hypersparse (see GB_AxB_saxpy3_slice_balanced).  The Hi workspace holds
+// the cursors for each A(:,k): Hcursor [s] is the next entry of A(:,k) to
+// consider for the kth entry of B(:,j), and Hend [s] is the end of A(:,k).
+
 {
+    const int nbands = SaxpyTasks [taskid].nbands ;
+    int64_t *restrict Hcursor = SaxpyTasks [taskid].Hi ;
+
     for (int64_t kk = kfirst ; kk <= klast ; kk++)
     {
 
@@ -47,6 +58,63 @@
 
             GB_COMPUTE_C_j_WHEN_NNZ_B_j_IS_ONE ;
 
+        }
+        else if (nbands > 1 && 16 * cjnz > cvlen && bjnz * nbands <= cjnz)
+        {
+
+            //------------------------------------------------------------------
+            // C(:,j) is not very sparse, and Hf and Hx do not fit in cache
+            //------------------------------------------------------------------
+
+            ASSERT ((A_is_sparse || A_is_hyper) && !A_jumbled) ;
+            ASSERT (B_is_sparse_or_hyper) ;
+            int64_t *restrict Hend = Hcursor + bjnz ;
+            const int64_t pB_start = pB ;
+            for (int64_t s = 0 ; s < bjnz ; s++)
+            { 
+                int64_t pB = pB_start + s ;
+                GB_GET_B_kj_INDEX ;             // get index k of entry B(k,j)
+                GB_GET_A_k ;                    // get A(:,k)
+                Hcursor [s] = pA_start ;
+                Hend [s] = pA_end ;
+            }
+
+            const int64_t band_size = GB_ICEIL (cvlen, nbands) ;
+            for (int64_t i1 = 0 ; i1 < cvlen ; i1 += band_size)
+            {
+                // compute C(i1:i2-1,j) = A(i1:i2-1,:) * B(:,j)
+                const int64_t i2 = GB_IMIN (i1 + band_size, cvlen) ;
+                for (int64_t s = 0 ; s < bjnz ; s++)
+                {
+                    int64_t pA = Hcursor [s] ;
+                    const int64_t pA_end = Hend [s] ;
+                    if (pA == pA_end) continue ;    // A(:,k) is done
+                    int64_t pB = pB_start + s ;
+                    GB_GET_B_kj_INDEX ;             // get index k of B(k,j)
+                    GB_GET_B_kj ;                   // bkj = B(k,j)
+                    // scan A(i1:i2-1,k)
+                    for ( ; pA < pA_end ; pA++)
+                    {
+                        GB_GET_A_ik_INDEX ;         // get index i of A(i,k)
+                        if (i >= i2) break ;        // A(i,k) in a later band
+                        GB_MULT_A_ik_B_kj ;         // t = A(i,k)*B(k,j)
+                        if (Hf [i] != mark)
+                        { 
+                            // C(i,j) = A(i,k) * B(k,j)
+                            Hf [i] = mark ;
+                            GB_HX_WRITE (i, t) ;    // Hx [i] = t
+                        }
+                        else
+                        { 
+                            // C(i,j) += A(i,k) * B(k,j)
+                            GB_HX_UPDATE (i, t) ;   // Hx [i] += t
+                        }
+                    }
+                    Hcursor [s] = pA ;
+                }
+                GB_GATHER_RANGE_C_j (mark, i1, i2) ;   // gather C(i1:i2-1,j)
+            }
+
         }
         else if (16 * cjnz > cvlen)
         {
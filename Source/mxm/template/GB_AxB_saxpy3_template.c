@@ -8,10 +8,25 @@
 //------------------------------------------------------------------------------
 
 // GB_AxB_saxpy3_template.c computes C=A*B for any semiring and matrix types,
-// where C is sparse or hypersparse.
+// where C is sparse or hypersparse.  In the JIT kernel, if Select is not
+// NULL, each task applies the select op of GxB_mxm_select to the entries it
+// has just written in phase5, and turns the entries it drops into zombies
+// (see GB_AxB_select_struct.h).
 
 #include "include/GB_unused.h"
 
+// GB_SAXPY3_SELECT_RANGE: log the entries computed by a task in phase5, so
+// that the JIT kernel can apply the select op of GxB_mxm_select to them
+#if defined ( GB_JIT_KERNEL )
+    #define GB_SAXPY3_SELECT_RANGE(k1,k2,p1,p2)                             \
+    {                                                                       \
+        kselect = (k1) ; kselect_last = (k2) ;                              \
+        pselect = (p1) ; pselect_end  = (p2) ;                              \
+    }
+#else
+    #define GB_SAXPY3_SELECT_RANGE(k1,k2,p1,p2)
+#endif
+
 //------------------------------------------------------------------------------
 // template code for C=A*B via the saxpy3 method
 //------------------------------------------------------------------------------
@@ -344,8 +359,9 @@
     #endif
 
     bool C_jumbled = false ;
+    int64_t nzombies = 0 ;
     #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
-        reduction(||:C_jumbled)
+        reduction(||:C_jumbled) reduction(+:nzombies)
     for (taskid = 0 ; taskid < ntasks ; taskid++)
     {
 
@@ -359,6 +375,11 @@
         int64_t hash_size = SaxpyTasks [taskid].hsize ;
         bool use_Gustavson = (hash_size == cvlen) ;
         bool task_C_jumbled = false ;
+        #if defined ( GB_JIT_KERNEL )
+        // this task computes the entries Ci,Cx [pselect:pselect_end-1] in
+        // the vectors C(:,kselect:kselect_last), for the select op
+        int64_t kselect, kselect_last, pselect, pselect_end ;
+        #endif
 
         if (taskid < nfine)
         {
@@ -395,6 +416,7 @@
                     }
                     // copy Hx [istart:iend-1] into Cx [pC+istart:pC+iend-1]
                     GB_CIJ_MEMCPY (pC + istart, istart, iend - istart) ;
+                    GB_SAXPY3_SELECT_RANGE (kk, kk, pC + istart, pC + iend) ;
                 }
                 else
                 {
@@ -408,6 +430,8 @@
                             Ci [pC++] = i ;
                         }
                     }
+                    GB_SAXPY3_SELECT_RANGE (kk, kk,
+                        Cp [kk] + SaxpyTasks [taskid].my_cjnz, pC) ;
                 }
 
             }
@@ -437,6 +461,8 @@
                         pC++ ;
                     }
                 }
+                GB_SAXPY3_SELECT_RANGE (kk, kk,
+                    Cp [kk] + SaxpyTasks [taskid].my_cjnz, pC) ;
                 task_C_jumbled = true ;
             }
 
@@ -453,7 +479,8 @@
             int64_t kfirst = SaxpyTasks [taskid].start ;
             int64_t klast = SaxpyTasks [taskid].end ;
             int64_t nk = klast - kfirst + 1 ;
-            int64_t mark = 2*nk + 1 ;
+            int64_t mark = SaxpyTasks [taskid].mark + 2*nk + 1 ;
+            GB_SAXPY3_SELECT_RANGE (kfirst, klast, Cp [kfirst], Cp [klast+1]) ;
 
             if (use_Gustavson)
             {
@@ -585,16 +612,53 @@
                 #endif
             }
         }
+
+        //----------------------------------------------------------------------
+        // apply the select op to the entries computed by this task
+        //----------------------------------------------------------------------
+
+        #if defined ( GB_JIT_KERNEL )
+        if (Select != NULL)
+        {
+            const int64_t *restrict Ch = C->h ;
+            int64_t task_nzombies = 0 ;
+            for (int64_t kk = kselect ; kk <= kselect_last ; kk++)
+            {
+                const int64_t j = GBH (Ch, kk) ;
+                int64_t pC_start = GB_IMAX (Cp [kk], pselect) ;
+                int64_t pC_end   = GB_IMIN (Cp [kk+1], pselect_end) ;
+                for (int64_t pC = pC_start ; pC < pC_end ; pC++)
+                {
+                    int64_t i = Ci [pC] ;
+                    #if GB_IS_ANY_PAIR_SEMIRING
+                    GB_AXB_SELECT_KEEP (keep, Select, NULL, i, j) ;
+                    #else
+                    GB_AXB_SELECT_KEEP (keep, Select, Cx + pC, i, j) ;
+                    #endif
+                    if (!keep)
+                    { 
+                        // C(i,j) is dropped, and becomes a zombie
+                        task_nzombies++ ;
+                        Ci [pC] = GB_ZOMBIE (i) ;
+                    }
+                }
+            }
+            nzombies += task_nzombies ;
+        }
+        #endif
+
         C_jumbled = C_jumbled || task_C_jumbled ;
     }
 
     //--------------------------------------------------------------------------
-    // log the state of C->jumbled
+    // log the state of C->jumbled, and the zombies from the select op
     //--------------------------------------------------------------------------
 
     C->jumbled = C_jumbled ;    // C is jumbled if any task left it jumbled
+    C->nzombies = nzombies ;
 }
 
 #undef GB_NO_MASK
+#undef GB_SAXPY3_SELECT_RANGE
 #undef GB_MASK_COMP
 
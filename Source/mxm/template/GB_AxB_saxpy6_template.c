@@ -0,0 +1,205 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy6_template.c: C=A*B, A full with 2 to 64 rows, B sparse/hyper
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C is full or bitmap, with the same number of rows as A.
+// A is full, non-iso, and has between 2 and 64 rows.
+// B is sparse or hypersparse.  It may be iso and/or jumbled.
+
+// Each column C(:,j) is computed in a set of registers, 4*GB_S6_VL rows at a
+// time (all of C(:,j) for most tall-and-skinny matrices), and written to C
+// just once.  The column A(:,k) is contiguous since A is full.  If GB_S6_VL
+// is zero, C(:,j) is computed in a small workspace of 16 entries instead,
+// which the compiler can vectorize if it supports the target architecture.
+
+// If GB_S6_A_IS_PATTERN is true (the PLUS_SECOND semiring), all entries in
+// C(:,j) are the same, and only depend on B(:,j).
+
+// The caller defines GB_S6_A_IS_PATTERN, GB_S6_B_IS_PATTERN, GB_S6_TYPE,
+// GB_S6_VL, GB_S6_IDENTITY, GB_S6_GETB, GB_S6_MULTADD (for scalars), and
+// GB_S6_MULTADD_V (for vectors of length GB_S6_VL, if GB_S6_VL > 0).
+// GB_S6_ITYPE is an integer type of the same size as GB_S6_TYPE, if the
+// vector multiply-add needs it.
+
+{
+
+    //--------------------------------------------------------------------------
+    // get C, A, and B
+    //--------------------------------------------------------------------------
+
+    const int64_t m = A->vlen ;     // # of rows of C and A
+    const int64_t *restrict Bp = B->p ;
+    const int64_t *restrict Bh = B->h ;
+    const int64_t *restrict Bi = B->i ;
+    #if !GB_S6_A_IS_PATTERN
+    const GB_S6_TYPE *restrict Ax = (GB_S6_TYPE *) A->x ;
+    #endif
+    #if !GB_S6_B_IS_PATTERN
+    const bool B_iso = B->iso ;
+    const GB_S6_TYPE *restrict Bx = (GB_S6_TYPE *) B->x ;
+    #endif
+          GB_S6_TYPE *restrict Cx = (GB_S6_TYPE *) C->x ;
+          int8_t     *restrict Cb = C->b ;
+    int64_t cnvals = 0 ;
+
+    //--------------------------------------------------------------------------
+    // define the vectors
+    //--------------------------------------------------------------------------
+
+    #if GB_S6_VL > 0
+    typedef GB_S6_TYPE __attribute__ ((vector_size (GB_S6_VL * sizeof (GB_S6_TYPE)))) v ;
+    typedef GB_S6_TYPE __attribute__ ((vector_size (GB_S6_VL * sizeof (GB_S6_TYPE)), aligned (sizeof (GB_S6_TYPE)))) vu ;
+    #ifdef GB_S6_ITYPE
+    typedef GB_S6_ITYPE __attribute__ ((vector_size (GB_S6_VL * sizeof (GB_S6_TYPE)))) vi ;
+    #endif
+    const v vid = ((v) { 0 }) + ((GB_S6_TYPE) GB_S6_IDENTITY) ;
+    #endif
+
+    //--------------------------------------------------------------------------
+    // C = A*B
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(+:cnvals)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        const int64_t kB_start = B_slice [tid] ;
+        const int64_t kB_end   = B_slice [tid+1] ;
+        for (int64_t kB = kB_start ; kB < kB_end ; kB++)
+        {
+
+            //------------------------------------------------------------------
+            // get B(:,j) and C(:,j)
+            //------------------------------------------------------------------
+
+            const int64_t pB_start = Bp [kB] ;
+            const int64_t pB_end   = Bp [kB+1] ;
+            if (pB_start == pB_end)
+            {
+                // B(:,j) is empty, so C(:,j) is empty too
+                continue ;
+            }
+            const int64_t j = GBH_B (Bh, kB) ;
+            GB_S6_TYPE *restrict Cxj = Cx + (j * m) ;
+            if (Cb != NULL)
+            {
+                memset (Cb + (j * m), 1, m) ;
+            }
+            cnvals += m ;
+            int64_t i = 0 ;
+
+            #if GB_S6_A_IS_PATTERN
+
+            //------------------------------------------------------------------
+            // C(:,j) = B(:,j) reduced to a scalar, for all rows of C
+            //------------------------------------------------------------------
+
+            GB_S6_TYPE cj = GB_S6_IDENTITY ;
+            for (int64_t pB = pB_start ; pB < pB_end ; pB++)
+            {
+                GB_S6_GETB (bkj, pB) ;
+                GB_S6_MULTADD (cj, ignore, bkj) ;
+            }
+            for ( ; i < m ; i++)
+            {
+                Cxj [i] = cj ;
+            }
+
+            #elif GB_S6_VL > 0
+
+            //------------------------------------------------------------------
+            // C(i:i+4*VL-1,j) = A(i:i+4*VL-1,:)*B(:,j), in 4 registers
+            //------------------------------------------------------------------
+
+            for ( ; i + 4*GB_S6_VL <= m ; i += 4*GB_S6_VL)
+            {
+                v c1 = vid, c2 = vid, c3 = vid, c4 = vid ;
+                for (int64_t pB = pB_start ; pB < pB_end ; pB++)
+                {
+                    const GB_S6_TYPE *restrict ax = Ax + (Bi [pB] * m + i) ;
+                    GB_S6_GETB (bkj, pB) ;
+                    GB_S6_MULTADD_V (c1, (*((vu *) (ax             ))), bkj) ;
+                    GB_S6_MULTADD_V (c2, (*((vu *) (ax +   GB_S6_VL))), bkj) ;
+                    GB_S6_MULTADD_V (c3, (*((vu *) (ax + 2*GB_S6_VL))), bkj) ;
+                    GB_S6_MULTADD_V (c4, (*((vu *) (ax + 3*GB_S6_VL))), bkj) ;
+                }
+                (*((vu *) (Cxj + i             ))) = c1 ;
+                (*((vu *) (Cxj + i +   GB_S6_VL))) = c2 ;
+                (*((vu *) (Cxj + i + 2*GB_S6_VL))) = c3 ;
+                (*((vu *) (Cxj + i + 3*GB_S6_VL))) = c4 ;
+            }
+
+            //------------------------------------------------------------------
+            // C(i:i+VL-1,j) = A(i:i+VL-1,:)*B(:,j), in a single register
+            //------------------------------------------------------------------
+
+            for ( ; i + GB_S6_VL <= m ; i += GB_S6_VL)
+            {
+                v c1 = vid ;
+                for (int64_t pB = pB_start ; pB < pB_end ; pB++)
+                {
+                    const GB_S6_TYPE *restrict ax = Ax + (Bi [pB] * m + i) ;
+                    GB_S6_GETB (bkj, pB) ;
+                    GB_S6_MULTADD_V (c1, (*((vu *) ax)), bkj) ;
+                }
+                (*((vu *) (Cxj + i))) = c1 ;
+            }
+
+            #else
+
+            //------------------------------------------------------------------
+            // C(i:i+15,j) = A(i:i+15,:)*B(:,j), in a workspace of size 16
+            //------------------------------------------------------------------
+
+            for ( ; i + 16 <= m ; i += 16)
+            {
+                GB_S6_TYPE cx [16] ;
+                for (int t = 0 ; t < 16 ; t++)
+                {
+                    cx [t] = GB_S6_IDENTITY ;
+                }
+                for (int64_t pB = pB_start ; pB < pB_end ; pB++)
+                {
+                    const GB_S6_TYPE *restrict ax = Ax + (Bi [pB] * m + i) ;
+                    GB_S6_GETB (bkj, pB) ;
+                    for (int t = 0 ; t < 16 ; t++)
+                    {
+                        GB_S6_MULTADD (cx [t], ax [t], bkj) ;
+                    }
+                }
+                memcpy (Cxj + i, cx, 16 * sizeof (GB_S6_TYPE)) ;
+            }
+
+            #endif
+
+            #if !GB_S6_A_IS_PATTERN
+
+            //------------------------------------------------------------------
+            // C(i:m-1,j) = A(i:m-1,:)*B(:,j) for the last few rows
+            //------------------------------------------------------------------
+
+            for ( ; i < m ; i++)
+            {
+                GB_S6_TYPE cij = GB_S6_IDENTITY ;
+                for (int64_t pB = pB_start ; pB < pB_end ; pB++)
+                {
+                    GB_S6_GETB (bkj, pB) ;
+                    GB_S6_MULTADD (cij, Ax [Bi [pB] * m + i], bkj) ;
+                }
+                Cxj [i] = cij ;
+            }
+
+            #endif
+        }
+    }
+
+    (*cnvals_handle) = cnvals ;
+}
+
+#undef GB_S6_VL
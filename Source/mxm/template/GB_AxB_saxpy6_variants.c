@@ -0,0 +1,88 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy6_variants.c: saxpy6 kernels for a single semiring
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Defines the AVX512F, AVX2, and vanilla variants of the saxpy6 kernel for a
+// single semiring, and a kernel GB_S6_FUNC (kernel) that selects one of them
+// at run time.  GB_S6_NBITS is the size of GB_S6_TYPE, in bits.
+
+#define GB_S6_JOIN2(name,variant) GB_AxB_saxpy6_ ## name ## _ ## variant
+#define GB_S6_JOIN(name,variant) GB_S6_JOIN2 (name, variant)
+#define GB_S6_FUNC(variant) GB_S6_JOIN (GB_S6_NAME, variant)
+
+#define GB_S6_ARGS                                                      \
+    GrB_Matrix C,                                                       \
+    const GrB_Matrix A,                                                 \
+    const GrB_Matrix B,                                                 \
+    const int64_t *restrict B_slice,                                    \
+    const int ntasks,                                                   \
+    const int nthreads,                                                 \
+    int64_t *cnvals_handle
+
+//------------------------------------------------------------------------------
+// AVX512F: vectors of length 8 for double, 16 for single
+//------------------------------------------------------------------------------
+
+#if GB_COMPILER_SUPPORTS_AVX512F
+GB_TARGET_AVX512F static void GB_S6_FUNC (avx512f) (GB_S6_ARGS)
+{
+    #define GB_S6_VL (512 / GB_S6_NBITS)
+    #include "mxm/template/GB_AxB_saxpy6_template.c"
+}
+#endif
+
+//------------------------------------------------------------------------------
+// AVX2: vectors of length 4 for double, 8 for single
+//------------------------------------------------------------------------------
+
+#if GB_COMPILER_SUPPORTS_AVX2
+GB_TARGET_AVX2 static void GB_S6_FUNC (avx2) (GB_S6_ARGS)
+{
+    #define GB_S6_VL (256 / GB_S6_NBITS)
+    #include "mxm/template/GB_AxB_saxpy6_template.c"
+}
+#endif
+
+//------------------------------------------------------------------------------
+// any architecture: no explicit vectors
+//------------------------------------------------------------------------------
+
+static void GB_S6_FUNC (vanilla) (GB_S6_ARGS)
+{
+    #define GB_S6_VL 0
+    #include "mxm/template/GB_AxB_saxpy6_template.c"
+}
+
+//------------------------------------------------------------------------------
+// select the kernel variant
+//------------------------------------------------------------------------------
+
+static void GB_S6_FUNC (kernel) (GB_S6_ARGS)
+{
+    #if GB_COMPILER_SUPPORTS_AVX512F
+    if (GB_Global_cpu_features_avx512f ( ))
+    {
+        GB_S6_FUNC (avx512f) (C, A, B, B_slice, ntasks, nthreads,
+            cnvals_handle) ;
+        return ;
+    }
+    #endif
+    #if GB_COMPILER_SUPPORTS_AVX2
+    if (GB_Global_cpu_features_avx2 ( ))
+    {
+        GB_S6_FUNC (avx2) (C, A, B, B_slice, ntasks, nthreads, cnvals_handle);
+        return ;
+    }
+    #endif
+    GB_S6_FUNC (vanilla) (C, A, B, B_slice, ntasks, nthreads, cnvals_handle) ;
+}
+
+#undef GB_S6_JOIN2
+#undef GB_S6_JOIN
+#undef GB_S6_FUNC
+#undef GB_S6_ARGS
@@ -0,0 +1,45 @@
+//------------------------------------------------------------------------------
+// GB_Ingest.h: pending tuples for concurrent GrB_setElement
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#ifndef GB_INGEST_H
+#define GB_INGEST_H
+
+GrB_Info GB_Ingest_set      // enable/disable concurrent setElement
+(
+    GrB_Matrix A,           // matrix to modify
+    int nslots,             // # of slots, or 0 to disable
+    GB_Werk Werk
+) ;
+
+void GB_Ingest_free         // free the concurrent setElement buffers
+(
+    GB_Ingest *IHandle
+) ;
+
+GrB_Info GB_Ingest_setElement   // C(row,col) = scalar, from any user thread
+(
+    GrB_Matrix C,                   // matrix to modify
+    const void *scalar,             // scalar to set
+    const GrB_Index row,            // row index
+    const GrB_Index col,            // column index
+    const GB_Type_code scalar_code  // type of the scalar
+) ;
+
+GrB_Info GB_Ingest_flush    // move concurrent setElement tuples into A
+(
+    GrB_Matrix A,           // matrix to flush
+    GB_Werk Werk
+) ;
+
+// true if GrB_*_setElement can be done concurrently on the matrix C
+#define GB_INGEST(C) \
+    ((C) != NULL && (C)->magic == GB_MAGIC && (C)->Ingest != NULL)
+
+#endif
+
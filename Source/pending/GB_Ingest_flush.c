@@ -0,0 +1,345 @@
+//------------------------------------------------------------------------------
+// GB_Ingest_flush: move the concurrent setElement tuples into A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The pending tuples held in the slots of A->Ingest are moved into A, and the
+// slots are emptied.  If A is sparse or hypersparse, the tuples are appended
+// to A->Pending, slot by slot.  Like GB_setElement, a tuple for an entry
+// already present in A (live or zombie) is then written into A directly,
+// since GB_wait requires the pending tuples to be disjoint from the entries in
+// A.  The entries are found in parallel by GB_Element_lookup.  The remaining
+// tuples are assembled by GB_wait with GB_builder, just like the tuples from
+// GB_setElement.  If A is bitmap or full, all tuples are written into A
+// directly.  The order of the tuples from a single slot is kept, but if two
+// user threads set the same entry at the same time, either value may be the
+// one kept.
+
+// If A is iso and all the new values are equal to the iso value, A remains
+// iso.  Otherwise, it is converted to non-iso.  If A is empty and all the new
+// values are the same, A becomes iso, as it does for GB_setElement.
+
+// This method is not thread-safe.  It is used only when no user thread is
+// calling GrB_*_setElement on A.  If it fails, A is cleared, and all tuples
+// in the slots are discarded.
+
+#define GB_FREE_ALL                                                 \
+{                                                                   \
+    for (int s = 0 ; s < nslots ; s++)                              \
+    {                                                               \
+        GB_Pending_free (&(slot [s].Pending)) ;                     \
+    }                                                               \
+    GB_FREE_WORK (&W, W_size) ;                                     \
+}
+
+#include "pending/GB_Pending.h"
+
+GrB_Info GB_Ingest_flush    // move concurrent setElement tuples into A
+(
+    GrB_Matrix A,           // matrix to flush
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (A != NULL) ;
+    int64_t *restrict W = NULL ; size_t W_size = 0 ;
+    GB_Ingest Ingest = A->Ingest ;
+    if (Ingest == NULL || !Ingest->pending)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    // clear the flag first, so that GB_wait does not flush A again
+    Ingest->pending = 0 ;
+
+    //--------------------------------------------------------------------------
+    // count the tuples in the slots
+    //--------------------------------------------------------------------------
+
+    GB_Ingest_slot *slot = Ingest->slot ;
+    const int nslots = Ingest->nslots ;
+    int64_t n = 0 ;
+    int nlists = 0 ;
+    int s1 = -1 ;
+    for (int s = 0 ; s < nslots ; s++)
+    {
+        GB_Pending P = slot [s].Pending ;
+        if (P != NULL && P->n > 0)
+        {
+            n += P->n ;
+            nlists++ ;
+            s1 = s ;
+        }
+    }
+
+    if (n == 0)
+    {
+        GB_FREE_ALL ;
+        return (GrB_SUCCESS) ;
+    }
+
+    GB_BURBLE_MATRIX (A, "(flush " GBd " tuples from %d slots) ", n, nlists) ;
+
+    //--------------------------------------------------------------------------
+    // A is about to be modified, so copy it out of any memory mapping
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_unmap (A)) ;
+
+    //--------------------------------------------------------------------------
+    // assemble any prior pending tuples that are not compatible
+    //--------------------------------------------------------------------------
+
+    // The tuples in the slots have the same type as A, with the implicit
+    // SECOND operator.  A must also be unjumbled, so that its entries can be
+    // found with a binary search.
+
+    GrB_Type ctype = A->type ;
+    const size_t csize = ctype->size ;
+    if (A->jumbled)
+    {
+        GB_OK (GB_wait (A, "A (flush:jumbled)", Werk)) ;
+    }
+    if (A->Pending != NULL && !(A->Pending->type == ctype &&
+        GB_op_is_second (A->Pending->op, ctype)))
+    {
+        GB_OK (GB_wait (A, "A (flush:incompatible pending tuples)", Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check if A needs to convert to non-iso, or if A is a new iso matrix
+    //--------------------------------------------------------------------------
+
+    GB_void *x0 = (A->iso) ? ((GB_void *) A->x) : slot [s1].Pending->x ;
+    bool same = true ;
+    for (int s = 0 ; s < nslots && same ; s++)
+    {
+        GB_Pending P = slot [s].Pending ;
+        if (P == NULL) continue ;
+        const GB_void *Px = P->x ;
+        for (int64_t k = 0 ; k < P->n && same ; k++)
+        {
+            same = (memcmp (Px + k * csize, x0, csize) == 0) ;
+        }
+    }
+
+    if (A->iso && !same)
+    {
+        // The new entries differ from the iso value of A.  Assemble all
+        // pending tuples and convert A to non-iso.  Zombies are OK.
+        if (A->Pending != NULL)
+        {
+            GB_OK (GB_wait (A, "A (flush:to non-iso)", Werk)) ;
+        }
+        GB_OK (GB_convert_any_to_non_iso (A, true)) ;
+    }
+    else if (!A->iso && same && GB_nnz (A) == 0 && !GB_IS_FULL (A)
+        && A->Pending == NULL)
+    {
+        // A is empty and all new entries are the same: convert A to iso
+        GB_OK (GB_convert_any_to_iso (A, x0)) ;
+    }
+
+    const bool A_iso = A->iso ;
+
+    //--------------------------------------------------------------------------
+    // bitmap or full case: write the tuples directly into A
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_FULL (A) || GB_IS_BITMAP (A))
+    {
+        const int64_t avlen = A->vlen ;
+        int8_t *restrict Ab = A->b ;
+        GB_void *restrict Ax = (GB_void *) A->x ;
+        for (int s = 0 ; s < nslots ; s++)
+        {
+            GB_Pending P = slot [s].Pending ;
+            if (P == NULL) continue ;
+            const int64_t *restrict Pi = P->i ;
+            const int64_t *restrict Pj = P->j ;
+            const GB_void *restrict Px = P->x ;
+            for (int64_t k = 0 ; k < P->n ; k++)
+            {
+                int64_t p = Pi [k] + ((Pj == NULL) ? 0 : Pj [k]) * avlen ;
+                if (!A_iso)
+                {
+                    memcpy (Ax + p * csize, Px + k * csize, csize) ;
+                }
+                if (Ab != NULL)
+                {
+                    A->nvals += (Ab [p] == 0) ;
+                    Ab [p] = 1 ;
+                }
+            }
+        }
+        GB_FREE_ALL ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sparse or hypersparse case: append the tuples to A->Pending
+    //--------------------------------------------------------------------------
+
+    // any tuples held by a background job are not in A->Pending->[ijx]
+    const int64_t pn0 = (A->Pending == NULL) ? 0 : A->Pending->n ;
+    if (A->Pending == NULL && nlists == 1)
+    {
+        // move the single list of tuples into A->Pending
+        A->Pending = slot [s1].Pending ;
+        slot [s1].Pending = NULL ;
+        if (A_iso)
+        {
+            // the values of iso pending tuples are not kept
+            GB_FREE (&(A->Pending->x), A->Pending->x_size) ;
+        }
+    }
+    else
+    {
+        // ensure A->Pending is large enough for all tuples in the slots
+        const bool is_matrix = (A->vdim > 1) ;
+        if (!GB_Pending_ensure (&(A->Pending), A_iso, ctype, NULL, is_matrix,
+            n, Werk))
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            GB_phybix_free (A) ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        // append each list, in order of the slots
+        GB_Pending Pending = A->Pending ;
+        for (int s = 0 ; s < nslots ; s++)
+        {
+            GB_Pending P = slot [s].Pending ;
+            if (P == NULL || P->n == 0) continue ;
+            int64_t pn = Pending->n ;
+            int64_t kn = P->n ;
+            ASSERT (pn + kn <= Pending->nmax) ;
+            ASSERT ((Pending->j == NULL) == (P->j == NULL)) ;
+            if (Pending->sorted)
+            {
+                // the result is sorted if both lists are sorted, and the
+                // last prior tuple comes before the first new one
+                int64_t ilast = (pn > 0) ? Pending->i [pn-1] : -1 ;
+                int64_t jlast = (pn > 0 && Pending->j != NULL) ?
+                    Pending->j [pn-1] : 0 ;
+                int64_t i = P->i [0] ;
+                int64_t j = (P->j != NULL) ? P->j [0] : 0 ;
+                Pending->sorted = P->sorted &&
+                    ((jlast < j) || (jlast == j && ilast <= i)) ;
+            }
+            memcpy (Pending->i + pn, P->i, kn * sizeof (int64_t)) ;
+            if (Pending->j != NULL)
+            {
+                memcpy (Pending->j + pn, P->j, kn * sizeof (int64_t)) ;
+            }
+            if (!A_iso)
+            {
+                memcpy (Pending->x + pn * csize, P->x, kn * csize) ;
+            }
+            Pending->n += kn ;
+            GB_Pending_free (&(slot [s].Pending)) ;
+        }
+    }
+
+    GB_FREE_ALL ;
+
+    //--------------------------------------------------------------------------
+    // find the new tuples that are already entries in A
+    //--------------------------------------------------------------------------
+
+    GB_Pending Pending = A->Pending ;
+    ASSERT (Pending->n == pn0 + n) ;
+    int64_t *restrict Pending_i = Pending->i ;
+    int64_t *restrict Pending_j = Pending->j ;
+    GB_void *restrict Pending_x = Pending->x ;
+
+    if (GB_nnz (A) > 0)
+    {
+
+        // W [k] = p if the kth new tuple is the entry at A->i [p], or -1 if
+        // it is not in A
+        W = GB_MALLOC_WORK (n, int64_t, &W_size) ;
+        if (W == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            GB_phybix_free (A) ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        double chunk = GB_Context_chunk ( ) ;
+        int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+        GB_Element_lookup (W, A, Pending_i + pn0,
+            (Pending_j == NULL) ? NULL : (Pending_j + pn0), n, nthreads) ;
+
+        //----------------------------------------------------------------------
+        // update the entries found in A, and keep the rest as pending tuples
+        //----------------------------------------------------------------------
+
+        // This is done in order, so that the last of any duplicates is kept.
+        // Removing tuples from the list does not change its sorted status.
+
+        int64_t *restrict Ai = A->i ;
+        GB_void *restrict Ax = (GB_void *) A->x ;
+        int64_t nkeep = pn0 ;
+        for (int64_t k = 0 ; k < n ; k++)
+        {
+            int64_t p = W [k] ;
+            int64_t pk = pn0 + k ;
+            if (p >= 0)
+            {
+                // A(i,j) = x, and bring it back to life if it is a zombie
+                if (!A_iso)
+                {
+                    memcpy (Ax + p * csize, Pending_x + pk * csize, csize) ;
+                }
+                if (GB_IS_ZOMBIE (Ai [p]))
+                {
+                    Ai [p] = Pending_i [pk] ;
+                    A->nzombies-- ;
+                }
+            }
+            else
+            {
+                // keep (i,j,x) as a pending tuple
+                Pending_i [nkeep] = Pending_i [pk] ;
+                if (Pending_j != NULL)
+                {
+                    Pending_j [nkeep] = Pending_j [pk] ;
+                }
+                if (!A_iso)
+                {
+                    memcpy (Pending_x + nkeep * csize, Pending_x + pk * csize,
+                        csize) ;
+                }
+                nkeep++ ;
+            }
+        }
+        Pending->n = nkeep ;
+        GB_FREE_WORK (&W, W_size) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    if (Pending->n == 0)
+    {
+        // all tuples were entries already in A
+        GB_Pending_free (&(A->Pending)) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+// GB_Ingest_free: free the concurrent setElement buffers of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Any pending tuples still held in the slots are discarded.
+
+#include "pending/GB_Pending.h"
+
+void GB_Ingest_free         // free the concurrent setElement buffers
+(
+    GB_Ingest *IHandle
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (IHandle != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // free the pending tuples in each slot, and the Ingest struct itself
+    //--------------------------------------------------------------------------
+
+    GB_Ingest Ingest = (*IHandle) ;
+    if (Ingest != NULL)
+    {
+        if (Ingest->slot != NULL)
+        {
+            for (int s = 0 ; s < Ingest->nslots ; s++)
+            {
+                GB_Pending_free (&(Ingest->slot [s].Pending)) ;
+            }
+        }
+        GB_FREE (&(Ingest->slot), Ingest->slot_size) ;
+        GB_FREE (&(Ingest), Ingest->header_size) ;
+    }
+
+    (*IHandle) = NULL ;
+}
+
@@ -0,0 +1,82 @@
+//------------------------------------------------------------------------------
+// GB_Ingest_set: enable or disable concurrent setElement on a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GrB_set (A, nslots, GxB_CONCURRENT_SETELEMENT) enables concurrent
+// GrB_*_setElement on A with nslots per-thread lists of pending tuples, or
+// disables it if nslots is zero.  Any tuples held in the prior slots are
+// first moved into A->Pending.
+
+#include "pending/GB_Pending.h"
+#define GB_FREE_ALL ;
+
+GrB_Info GB_Ingest_set      // enable/disable concurrent setElement
+(
+    GrB_Matrix A,           // matrix to modify
+    int nslots,             // # of slots, or 0 to disable
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (A != NULL) ;
+    if (nslots < 0)
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // flush and free the prior slots, if any
+    //--------------------------------------------------------------------------
+
+    if (A->Ingest != NULL && A->Ingest->nslots == nslots)
+    {
+        // no change
+        return (GrB_SUCCESS) ;
+    }
+
+    GB_OK (GB_Ingest_flush (A, Werk)) ;
+    GB_Ingest_free (&(A->Ingest)) ;
+    if (nslots == 0)
+    {
+        // concurrent setElement is now disabled
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the new slots
+    //--------------------------------------------------------------------------
+
+    size_t header_size ;
+    GB_Ingest Ingest = GB_MALLOC (1, struct GB_Ingest_struct, &header_size) ;
+    if (Ingest == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    Ingest->header_size = header_size ;
+    Ingest->nslots = nslots ;
+    Ingest->pending = 0 ;
+    Ingest->slot_size = 0 ;
+    Ingest->slot = GB_CALLOC (nslots, GB_Ingest_slot, &(Ingest->slot_size)) ;
+    if (Ingest->slot == NULL)
+    {
+        // out of memory
+        GB_Ingest_free (&Ingest) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    A->Ingest = Ingest ;
+    #pragma omp flush
+    return (GrB_SUCCESS) ;
+}
+
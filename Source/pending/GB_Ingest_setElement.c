@@ -0,0 +1,197 @@
+//------------------------------------------------------------------------------
+// GB_Ingest_setElement: C(row,col) = scalar, from any user thread
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_Ingest_setElement does the work for GrB_*_setElement_TYPE when
+// concurrent setElement has been enabled for C, via GrB_set (C, nslots,
+// GxB_CONCURRENT_SETELEMENT).  Any number of user threads may call this method
+// on the same matrix C at the same time, but no other method may access C
+// while they do so.
+
+// The scalar is typecast to the type of C and appended, as the tuple
+// (i,j,scalar), to a list of pending tuples owned by one slot of C->Ingest.
+// The slot is selected by a thread-local id, so that each user thread uses
+// its own slot unless more user threads than slots are active.  Each slot has
+// a spin lock, which is only contended if two threads share the same slot.
+// C itself is not accessed or modified, except to read its type, dimensions,
+// and format, and no error is logged in C (GrB_error is not thread-safe).
+// Unlike GB_setElement, existing entries are not modified in place, and
+// GB_block is not used.  The tuples are moved into C->Pending by
+// GB_Ingest_flush, which is done by GB_wait and by GB_WHERE before C is
+// modified by any other method.
+
+#include "pending/GB_Pending.h"
+
+//------------------------------------------------------------------------------
+// thread-local slot id
+//------------------------------------------------------------------------------
+
+// GB_INGEST_THREAD is -1 for a user thread that has not yet called this
+// method.  Otherwise, it is a unique id for the user thread, assigned from a
+// global counter.  Without thread-local storage, all user threads share
+// slot 0 of any matrix, which is still correct since each slot is locked.
+
+#if defined ( _OPENMP )
+
+    // OpenMP threadprivate is preferred
+    static int64_t GB_INGEST_THREAD = -1 ;
+    #pragma omp threadprivate (GB_INGEST_THREAD)
+
+#elif defined ( HAVE_KEYWORD__THREAD )
+
+    // gcc and many other compilers support the __thread keyword
+    static __thread int64_t GB_INGEST_THREAD = -1 ;
+
+#elif defined ( HAVE_KEYWORD__DECLSPEC_THREAD )
+
+    // Windows: __declspec (thread)
+    static __declspec ( thread ) int64_t GB_INGEST_THREAD = -1 ;
+
+#elif defined ( HAVE_KEYWORD__THREAD_LOCAL )
+
+    // C11 threads
+    #include <threads.h>
+    static _Thread_local int64_t GB_INGEST_THREAD = -1 ;
+
+#else
+
+    // no thread-local storage
+    #define NO_THREAD_LOCAL_STORAGE
+
+#endif
+
+// # of user threads that have been given an id
+static int64_t GB_ingest_nthreads = 0 ;
+
+static inline int64_t GB_ingest_thread_id (void)
+{
+    #if defined ( NO_THREAD_LOCAL_STORAGE )
+    return (0) ;
+    #else
+    if (GB_INGEST_THREAD < 0)
+    {
+        // first call from this user thread: get a new id
+        int64_t id ;
+        GB_ATOMIC_CAPTURE_INC64 (id, GB_ingest_nthreads) ;
+        GB_INGEST_THREAD = id ;
+    }
+    return (GB_INGEST_THREAD) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_Ingest_setElement
+//------------------------------------------------------------------------------
+
+GrB_Info GB_Ingest_setElement   // C(row,col) = scalar, from any user thread
+(
+    GrB_Matrix C,                   // matrix to modify
+    const void *scalar,             // scalar to set
+    const GrB_Index row,            // row index
+    const GrB_Index col,            // column index
+    const GB_Type_code scalar_code  // type of the scalar
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (!GB_Global_GrB_init_called_get ( ))
+    {
+        return (GrB_PANIC) ;    // GrB_init not called
+    }
+
+    ASSERT (GB_INGEST (C)) ;
+    if (scalar == NULL)
+    {
+        return (GrB_NULL_POINTER) ;
+    }
+    if (row >= GB_NROWS (C) || col >= GB_NCOLS (C))
+    {
+        return (GrB_INVALID_INDEX) ;
+    }
+
+    GrB_Type ctype = C->type ;
+    GB_Type_code ccode = ctype->code ;
+    if (!GB_code_compatible (scalar_code, ccode))
+    {
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // typecast the scalar to the type of C
+    //--------------------------------------------------------------------------
+
+    size_t csize = ctype->size ;
+    GB_void cwork [GB_VLA(csize)] ;
+    GB_cast_scalar (cwork, ccode, scalar, scalar_code, csize) ;
+
+    //--------------------------------------------------------------------------
+    // handle the CSR/CSC format
+    //--------------------------------------------------------------------------
+
+    int64_t i, j ;
+    if (C->is_csc)
+    {
+        i = row ;
+        j = col ;
+    }
+    else
+    {
+        i = col ;
+        j = row ;
+    }
+
+    //--------------------------------------------------------------------------
+    // lock the slot for this user thread
+    //--------------------------------------------------------------------------
+
+    GB_Ingest Ingest = C->Ingest ;
+    GB_Ingest_slot *slot =
+        &(Ingest->slot [GB_ingest_thread_id ( ) % Ingest->nslots]) ;
+    int8_t unlocked = 0, locked = 1 ;
+    while (!GB_ATOMIC_COMPARE_EXCHANGE_8 (&(slot->lock), unlocked, locked))
+    {
+        // the slot is in use by another thread; try again
+        unlocked = 0 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // append the tuple to the slot, and unlock it
+    //--------------------------------------------------------------------------
+
+    bool ok = GB_Pending_add (&(slot->Pending), false, cwork, ctype, NULL,
+        i, j, C->vdim > 1, false, NULL) ;
+
+    while (!GB_ATOMIC_COMPARE_EXCHANGE_8 (&(slot->lock), locked, unlocked))
+    {
+        locked = 1 ;
+    }
+
+    if (!ok)
+    {
+        // out of memory; all prior tuples in this slot have been lost
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // note that C has pending tuples in its slots
+    //--------------------------------------------------------------------------
+
+    int8_t pending ;
+    GB_ATOMIC_READ
+    pending = Ingest->pending ;
+    if (!pending)
+    {
+        GB_ATOMIC_WRITE
+        Ingest->pending = 1 ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
@@ -37,10 +37,79 @@ void GB_Pending_free        // free a list of pending tuples
     GB_Pending *PHandle
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_Pending_job: pending tuples assembled by a background thread
+//------------------------------------------------------------------------------
+
+// A job owns a list of pending tuples detached from a matrix A, and assembles
+// them into the hypersparse matrix T, in a background thread, just as GB_wait
+// would do with GB_builder.  If the job replaced an earlier finished job, the
+// earlier result T0 is added to T, using the same operator to combine any
+// duplicates.  The job does not access A itself.  The user thread that owns A
+// waits for the job to finish (GB_Pending_join) before it uses the result.
+
+struct GB_Pending_job_struct
+{
+    size_t header_size ;    // size of the malloc'd block for this struct
+    int64_t n ;             // # of pending tuples held by the job
+    GB_Pending Pending ;    // the detached list of pending tuples
+    GrB_Type type ;         // the type of A, and of T
+    int64_t vlen ;          // the dimensions and format of A
+    int64_t vdim ;
+    bool is_csc ;
+    bool iso ;              // true if A is iso
+    GB_void *iso_value ;    // the iso value of A, if A is iso
+    size_t iso_value_size ;
+    GrB_BinaryOp op ;       // operator to combine duplicates; NULL for SECOND
+    GrB_Matrix T0 ;         // result of an earlier job, or NULL
+    GrB_Matrix T ;          // result of this job, or NULL
+    struct GB_Matrix_opaque T0_header, T_header, S_header ;
+    GrB_Info info ;         // status of the job
+    int8_t done ;           // 1 when the job has finished
+    void *thread ;          // the background thread, or NULL
+    size_t thread_size ;
+} ;
+
+GrB_Info GB_Pending_background  // assemble pending tuples in the background
+(
+    GrB_Matrix A,           // matrix with pending tuples
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_Pending_join    // finish a background job and take its result
+(
+    GrB_Matrix T,           // output: static header, assembled tuples
+    GB_Pending_job *job_handle  // job to finish; freed on output
+) ;
+
+void GB_Pending_job_free    // free a background job
+(
+    GB_Pending_job *job_handle
+) ;
+
+//------------------------------------------------------------------------------
+// GB_Pending_hash: find a pending tuple with the same (i,j)
+//------------------------------------------------------------------------------
+
+int64_t GB_Pending_hash     // position of (i,j) in the list, or -1
+(
+    GB_Pending Pending,     // list of pending tuples
+    const int64_t i,        // index into vector
+    const int64_t j,        // vector index
+    const int64_t nkeys_max // max # of distinct (i,j) in the hash table
+) ;
+
 //------------------------------------------------------------------------------
 // GB_Pending_add:  add an entry A(i,j) to the list of pending tuples
 //------------------------------------------------------------------------------
 
+// If combine is true, and GxB_PENDING_COMBINE is enabled, a tuple with the
+// same (i,j) as a prior tuple is combined into that tuple with Pending->op,
+// instead of being appended to the list.  The caller must only set combine to
+// true if the result is the same as assembling the tuples later with
+// GB_builder: the scalars must have the same type as the matrix, unless the
+// pending operator is the implicit SECOND.
+
 static inline bool GB_Pending_add   // add a tuple to the list
 (
     GB_Pending *PHandle,    // Pending tuples to create or append
@@ -51,6 +120,7 @@ static inline bool GB_Pending_add   // add a tuple to the list
     const int64_t i,        // index into vector
     const int64_t j,        // vector index
     const bool is_matrix,   // allocate Pending->j, if list is created
+    const bool combine,     // if true, duplicates may be combined
     GB_Werk Werk
 )
 {
@@ -77,6 +147,44 @@ static inline bool GB_Pending_add   // add a tuple to the list
     ASSERT (Pending->i != NULL) ;
     ASSERT ((is_matrix) == (Pending->j != NULL)) ;
 
+    //--------------------------------------------------------------------------
+    // combine the tuple with a prior tuple with the same (i,j), if enabled
+    //--------------------------------------------------------------------------
+
+    const int64_t nkeys_max = (combine) ? GB_Global_pending_combine_get ( ) : 0;
+    if (nkeys_max > 0)
+    {
+        const GrB_BinaryOp dup = Pending->op ;
+        if (dup == NULL || (dup->binop_function != NULL &&
+            dup->xtype == type && dup->ytype == type && dup->ztype == type &&
+            !GB_OPCODE_IS_POSITIONAL (dup->opcode)))
+        {
+            int64_t k = GB_Pending_hash (Pending, i, j, nkeys_max) ;
+            if (k >= 0)
+            {
+                // Pending->x [k] = dup (Pending->x [k], scalar)
+                size_t size = type->size ;
+                GB_void *restrict xk = Pending->x + k * size ;
+                if (Pending->x == NULL)
+                { 
+                    // the pending tuples are iso; nothing to do
+                }
+                else if (dup == NULL)
+                { 
+                    // implicit SECOND: the new value replaces the old one
+                    memcpy (xk, scalar, size) ;
+                }
+                else
+                { 
+                    GB_void z [GB_VLA(size)] ;
+                    dup->binop_function (z, xk, scalar) ;
+                    memcpy (xk, z, size) ;
+                }
+                return (true) ;
+            }
+        }
+    }
+
     //--------------------------------------------------------------------------
     // keep track of whether or not the pending tuples are already sorted
     //--------------------------------------------------------------------------
@@ -51,6 +51,13 @@ bool GB_Pending_alloc       // create a list of pending tuples
     Pending->type = type ;              // type of pending tuples
     Pending->size = type->size ;        // size of pending tuple type
     Pending->op = (iso) ? NULL : op ;   // pending operator (NULL is OK)
+    Pending->job = NULL ;               // no background assembly
+    Pending->hash = NULL ;              // no hash table of (i,j) yet
+    Pending->hash_size = 0 ;
+    Pending->hash_bits = 0 ;
+    Pending->hash_nkeys = 0 ;
+    Pending->hash_nkeys_max = 0 ;
+    Pending->hash_ntuples = 0 ;
     Pending->i_size = 0 ;
     Pending->j_size = 0 ;
     Pending->x_size = 0 ;
@@ -0,0 +1,329 @@
+//------------------------------------------------------------------------------
+// GB_Pending_background: assemble pending tuples in a background thread
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If GrB_set (GrB_GLOBAL, threshold, GxB_BACKGROUND_WAIT) has been used with a
+// threshold > 0, GB_block calls this method in non-blocking mode, each time
+// pending tuples are added to A.  Once A->Pending holds at least threshold
+// tuples, the list is detached from A and handed to a new background thread,
+// which sorts the tuples and combines their duplicates into a hypersparse
+// matrix T with GB_builder, the costliest part of GB_wait.  A new empty list
+// of pending tuples takes its place, with the same type and operator, and
+// holds the job in A->Pending->job.  The user application can keep adding
+// tuples to A while the job runs.
+
+// The background thread never accesses A, so no lock is needed on A.  A is
+// still owned by a single user thread, which finishes the job when GB_wait is
+// next called on A.  GB_wait waits for the job if it is still running, adds
+// any new tuples to its result T, and then adds T to A.  The job remains
+// valid while A is modified in other ways: the new entries of A are always
+// pending tuples, which are disjoint from the entries in A, so T stays
+// disjoint from A.  Any method that needs to change the type, operator, or
+// iso value of the pending tuples calls GB_wait first, since it sees the
+// empty list in A->Pending with the same properties as those held by the job.
+
+// If the list fills up again while the job is still running, nothing is done,
+// and the list keeps growing, so a user thread never waits for the background
+// thread here.  If the job has finished, and the new list is at least as large
+// as the prior job, a new job is started, which adds the result of the prior
+// job to the result of the new tuples, so a matrix has at most one job at any
+// time.
+
+// The background job is only used if the pending tuples have the same type
+// as A, and the operator (if any) has that type for its inputs and output.
+// The result of the job is later combined with the result of the tuples added
+// after it, as dup (dup (x1,x2), dup (x3,x4)) for four tuples with the same
+// (i,j), so the operator must also be associative, as for a monoid.  The
+// result is then the same as if all the tuples were assembled at once, except
+// for floating-point roundoff with the PLUS and TIMES operators.
+// If threads are not available, or if the job cannot be started, this method
+// does nothing, and the tuples are assembled later by GB_wait as usual.
+
+#include "pending/GB_Pending.h"
+#include "builder/GB_build.h"
+#include "add/GB_add.h"
+#include "binaryop/GB_binop.h"
+
+#if defined ( GB_HAVE_PTHREADS )
+#include <pthread.h>
+
+//------------------------------------------------------------------------------
+// GB_Pending_associative: check if the pending operator is associative
+//------------------------------------------------------------------------------
+
+// Returns true if dup (dup (x,y),w) is equal to dup (x, dup (y,w)).  The
+// floating-point PLUS and TIMES operators are treated as associative, as they
+// are for the built-in monoids, even though the roundoff may differ.
+
+static bool GB_Pending_associative
+(
+    const GrB_BinaryOp op
+)
+{
+    switch (op->opcode)
+    {
+        case GB_FIRST_binop_code  :
+        case GB_SECOND_binop_code :
+        case GB_ANY_binop_code    :
+        case GB_PAIR_binop_code   :
+        case GB_MIN_binop_code    :
+        case GB_MAX_binop_code    :
+        case GB_LOR_binop_code    :
+        case GB_LAND_binop_code   :
+        case GB_LXOR_binop_code   :
+        case GB_EQ_binop_code     :     // z = (x == y) is LXNOR for bool
+        case GB_BOR_binop_code    :
+        case GB_BAND_binop_code   :
+        case GB_BXOR_binop_code   :
+        case GB_BXNOR_binop_code  :
+        case GB_PLUS_binop_code   :
+        case GB_TIMES_binop_code  :
+            return (true) ;
+        default :
+            return (false) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_Pending_worker: the background thread
+//------------------------------------------------------------------------------
+
+static void *GB_Pending_worker (void *arg)
+{
+
+    GB_Pending_job job = (GB_Pending_job) arg ;
+    GB_WERK ("background wait") ;
+    GB_Pending Pending = job->Pending ;
+    GrB_Info info ;
+
+    //--------------------------------------------------------------------------
+    // T = the assembled pending tuples
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix T = NULL ;
+    GB_CLEAR_STATIC_HEADER (T, &(job->T_header)) ;
+    GrB_Type stype = (job->iso) ? job->type : Pending->type ;
+    info = GB_builder (
+        T,                      // create T using a static header
+        job->type,              // T->type = A->type
+        job->vlen,              // T->vlen = A->vlen
+        job->vdim,              // T->vdim = A->vdim
+        job->is_csc,            // T->is_csc = A->is_csc
+        &(Pending->i),          // iwork_handle, becomes T->i on output
+        &(Pending->i_size),
+        &(Pending->j),          // jwork_handle, free on output
+        &(Pending->j_size),
+        &(Pending->x),          // Swork_handle, free on output
+        &(Pending->x_size),
+        Pending->sorted,        // tuples may or may not be sorted
+        false,                  // there might be duplicates; look for them
+        Pending->nmax,          // size of Pending->[ijx] arrays
+        true,                   // is_matrix: unused
+        NULL, NULL, job->iso_value, // original I,J,S_input tuples
+        job->iso,               // pending tuples are iso if A is iso
+        Pending->n,             // # of tuples
+        job->op,                // dup operator, NULL if A is iso
+        stype,                  // type of Pending->x
+        false,                  // no burble from the background thread
+        Werk
+    ) ;
+    GB_Pending_free (&(job->Pending)) ;
+
+    //--------------------------------------------------------------------------
+    // T = T0 + T, if an earlier job has been replaced by this one
+    //--------------------------------------------------------------------------
+
+    if (info == GrB_SUCCESS && job->T0 != NULL)
+    {
+        struct GB_BinaryOp_opaque op_header ;
+        GrB_BinaryOp op = (job->op == NULL) ?
+            GB_binop_second (job->type, &op_header) : job->op ;
+        GrB_Matrix S = NULL ;
+        GB_CLEAR_STATIC_HEADER (S, &(job->S_header)) ;
+        bool ignore ;
+        info = GB_add (S, job->type, job->is_csc, NULL, 0, 0, &ignore,
+            job->T0, T, false, NULL, NULL, op, false, false, Werk) ;
+        GB_Matrix_free (&T) ;
+        T = S ;
+    }
+    GB_Matrix_free (&(job->T0)) ;
+
+    //--------------------------------------------------------------------------
+    // save the result and tell the user thread the job is done
+    //--------------------------------------------------------------------------
+
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory; the pending tuples have been lost
+        GB_Matrix_free (&T) ;
+    }
+    job->T = T ;
+    job->info = info ;
+    #pragma omp flush
+    GB_ATOMIC_WRITE
+    job->done = 1 ;
+    return (NULL) ;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// GB_Pending_background: start a background job, if needed
+//------------------------------------------------------------------------------
+
+GrB_Info GB_Pending_background  // assemble pending tuples in the background
+(
+    GrB_Matrix A,           // matrix with pending tuples
+    GB_Werk Werk
+)
+{
+
+    #if defined ( GB_HAVE_PTHREADS )
+
+    //--------------------------------------------------------------------------
+    // check if a background job should be started
+    //--------------------------------------------------------------------------
+
+    ASSERT (A != NULL) ;
+    GB_Pending Pending = A->Pending ;
+    int64_t threshold = GB_Global_background_wait_get ( ) ;
+    if (threshold <= 0 || Pending == NULL || Pending->n < threshold)
+    {
+        // too few pending tuples
+        return (GrB_SUCCESS) ;
+    }
+
+    GrB_Type type = A->type ;
+    GrB_BinaryOp op = Pending->op ;
+    if (Pending->type != type || (op != NULL && (op->xtype != type ||
+        op->ytype != type || op->ztype != type ||
+        !GB_Pending_associative (op))))
+    {
+        // the tuples must be assembled all at once, by GB_wait
+        return (GrB_SUCCESS) ;
+    }
+
+    GB_Pending_job old = Pending->job ;
+    if (old != NULL)
+    {
+        int8_t done ;
+        GB_ATOMIC_READ
+        done = old->done ;
+        if (!done)
+        {
+            // the prior job is still running; do not wait for it
+            return (GrB_SUCCESS) ;
+        }
+        #pragma omp flush
+        if (old->info != GrB_SUCCESS)
+        {
+            // the prior job failed; GB_wait will report the error
+            return (GrB_SUCCESS) ;
+        }
+        if (Pending->n < old->n)
+        {
+            // wait until the new list is as large as the result of the prior
+            // job, so that the total work of adding the results of a chain of
+            // jobs is proportional to the number of tuples
+            return (GrB_SUCCESS) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the job and the new list of pending tuples
+    //--------------------------------------------------------------------------
+
+    // If any of this fails, nothing is changed, and the pending tuples will
+    // be assembled by GB_wait instead.
+
+    size_t header_size ;
+    GB_Pending_job job = GB_CALLOC (1, struct GB_Pending_job_struct,
+        &header_size) ;
+    if (job == NULL)
+    {
+        return (GrB_SUCCESS) ;
+    }
+    job->header_size = header_size ;
+
+    const size_t asize = type->size ;
+    GB_Pending Pending_new = NULL ;
+    bool ok = GB_Pending_alloc (&Pending_new, A->iso, type, op, A->vdim > 1,
+        0) ;
+    job->thread = GB_MALLOC (1, pthread_t, &(job->thread_size)) ;
+    ok = ok && (job->thread != NULL) ;
+    if (ok && A->iso)
+    {
+        job->iso_value = GB_MALLOC (asize, GB_void, &(job->iso_value_size)) ;
+        ok = (job->iso_value != NULL) ;
+    }
+    if (!ok)
+    {
+        // the thread has not been started
+        GB_FREE (&(job->thread), job->thread_size) ;
+        GB_Pending_free (&Pending_new) ;
+        GB_Pending_job_free (&job) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // move the pending tuples of A, and the result of any prior job, into job
+    //--------------------------------------------------------------------------
+
+    job->type = type ;
+    job->vlen = A->vlen ;
+    job->vdim = A->vdim ;
+    job->is_csc = A->is_csc ;
+    job->iso = A->iso ;
+    if (A->iso)
+    {
+        memcpy (job->iso_value, A->x, asize) ;
+    }
+    job->op = op ;
+    job->n = Pending->n ;
+    job->info = GrB_SUCCESS ;
+    job->done = 0 ;
+
+    if (old != NULL)
+    {
+        // the result of the prior job is added to the result of this job
+        Pending->job = NULL ;
+        GrB_Info info = GB_Pending_join (&(job->T0_header), &old) ;
+        if (info != GrB_SUCCESS)
+        {
+            // the prior job has already been checked, so this cannot fail
+            GB_FREE (&(job->thread), job->thread_size) ;
+            GB_Pending_free (&Pending_new) ;
+            GB_Pending_job_free (&job) ;
+            return (info) ;
+        }
+        job->T0 = &(job->T0_header) ;
+        job->n += GB_nnz (job->T0) ;
+    }
+
+    job->Pending = Pending ;
+    Pending_new->job = job ;
+    A->Pending = Pending_new ;
+
+    GB_BURBLE_MATRIX (A, "(background wait: " GBd " pending) ", job->n) ;
+
+    //--------------------------------------------------------------------------
+    // start the background thread
+    //--------------------------------------------------------------------------
+
+    #pragma omp flush
+    if (pthread_create ((pthread_t *) job->thread, NULL, GB_Pending_worker,
+        job) != 0)
+    {
+        // the thread could not be created, so do the work now instead
+        GB_FREE (&(job->thread), job->thread_size) ;
+        GB_Pending_worker (job) ;
+    }
+
+    #endif
+
+    return (GrB_SUCCESS) ;
+}
@@ -28,9 +28,12 @@ void GB_Pending_free        // free a list of pending tuples
     GB_Pending Pending = (*PHandle) ;
     if (Pending != NULL)
     { 
+        // wait for any background job, and discard its result
+        GB_Pending_job_free (&(Pending->job)) ;
         GB_FREE (&(Pending->i), Pending->i_size) ;
         GB_FREE (&(Pending->j), Pending->j_size) ;
         GB_FREE (&(Pending->x), Pending->x_size) ;
+        GB_FREE (&(Pending->hash), Pending->hash_size) ;
         GB_FREE (&(Pending), Pending->header_size) ;
     }
 
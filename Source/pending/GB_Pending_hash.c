@@ -0,0 +1,285 @@
+//------------------------------------------------------------------------------
+// GB_Pending_hash: find a pending tuple with the same (i,j)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If GrB_set (GrB_GLOBAL, nkeys_max, GxB_PENDING_COMBINE) has been used with
+// nkeys_max > 0, GB_Pending_add calls this method before it appends a tuple
+// (i,j,x) to the list.  If the list already has a tuple with the same (i,j),
+// its position k is returned, and GB_Pending_add combines x into it instead
+// of appending a new tuple.  Otherwise, -1 is returned, and the position of
+// the new tuple, Pending->n, is added to the hash table.  The list then holds
+// at most one tuple for each (i,j) in the hash table, so its size is bounded
+// by the number of distinct entries, and GB_wait has fewer tuples to sort.
+
+// The hash table holds the position of the last tuple in the list for each
+// (i,j) it contains, with linear probing.  The keys are not held in the table
+// itself, but found in Pending->i and Pending->j.  Tuples may also be
+// appended to the list by other methods (GB_setElements, GB_Ingest_flush, and
+// the GB_subassign kernels), which do not use the hash table.  Those tuples are
+// added to the table here, in order, before (i,j) is found, so that the table
+// always refers to the last tuple of each (i,j).  A new tuple can then be
+// combined with it in the same order that GB_builder would use, if the
+// pending operator is the implicit SECOND, since only the last tuple is kept.
+// Otherwise, GB_builder computes dup (dup (x1,x2),x3) for three tuples with
+// the same (i,j), which differs from dup (x1, dup (x2,x3)) if dup is not
+// associative.  A new tuple is then only combined with the single tuple of
+// its (i,j), so an (i,j) with two or more tuples in the list is flipped in the
+// table, and no more tuples are combined into it.
+
+// The table is allocated when first needed, with at most 1024 entries, and is
+// doubled in size when it becomes half full, up to the smallest power of 2
+// that is at least 2*nkeys_max.  Once nkeys_max distinct (i,j) are in the
+// table, or if the table cannot grow, no more are added, and any other (i,j)
+// is simply appended to the list, as usual.  Tuples already in the table are
+// still found.  The limit nkeys_max is fixed when the table is allocated, and
+// is reduced to the # of (i,j) in the table if it cannot grow, so that an
+// (i,j) left out of the table is never added to it later, after some of its
+// tuples.  If the table cannot be allocated, -1 is returned.
+
+#include "pending/GB_Pending.h"
+#include "math/include/GB_hash.h"
+
+// an (i,j) with two or more tuples is held in the table as a flipped position
+#define GB_PENDING_FLIP(q) (-(q)-2)
+
+//------------------------------------------------------------------------------
+// GB_Pending_hashf: hash function for (i,j)
+//------------------------------------------------------------------------------
+
+static inline int64_t GB_Pending_hashf
+(
+    const int64_t i,
+    const int64_t j,
+    const int64_t hash_bits
+)
+{
+    uint64_t key = ((uint64_t) i) + (((uint64_t) j) << 32) ;
+    key *= 0x9E3779B97F4A7C15 ;
+    return ((int64_t) (key >> 20) & hash_bits) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Pending_hash_find: find (i,j) in the hash table, or add it
+//------------------------------------------------------------------------------
+
+// Returns the position q of (i,j) in the table, or -1 if not found, or if
+// (i,j) is flipped in the table.  If found and update is true, tuple p has the
+// same (i,j) as tuple q, and the table is modified so that (i,j) refers to
+// position p instead, or (i,j) is flipped if the pending operator is not the
+// implicit SECOND.  If not found, (i,j) is added with position p, if there is
+// room.
+
+static inline int64_t GB_Pending_hash_find
+(
+    GB_Pending Pending,
+    const int64_t i,
+    const int64_t j,
+    const int64_t p,
+    const bool update
+)
+{
+    int64_t *restrict Hash = Pending->hash ;
+    const int64_t *restrict Pending_i = Pending->i ;
+    const int64_t *restrict Pending_j = Pending->j ;
+    const int64_t hash_bits = Pending->hash_bits ;
+    for (int64_t h = GB_Pending_hashf (i, j, hash_bits) ; ;
+        GB_REHASH (h, i, hash_bits))
+    {
+        const int64_t q = Hash [h] ;
+        if (q == -1)
+        {
+            // (i,j) is not in the table; add it if the table has room
+            const int64_t nkeys = Pending->hash_nkeys ;
+            if (nkeys < Pending->hash_nkeys_max &&
+                2 * (nkeys + 1) <= hash_bits + 1)
+            {
+                Hash [h] = p ;
+                Pending->hash_nkeys++ ;
+            }
+            return (-1) ;
+        }
+        const int64_t k = (q < 0) ? GB_PENDING_FLIP (q) : q ;
+        if (Pending_i [k] == i && (Pending_j == NULL || Pending_j [k] == j))
+        {
+            // (i,j) found at position k
+            if (q < 0)
+            {
+                // (i,j) has two or more tuples, and cannot be combined
+                return (-1) ;
+            }
+            if (update)
+            {
+                Hash [h] = (Pending->op == NULL) ? p : GB_PENDING_FLIP (q) ;
+            }
+            return (q) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_Pending_hash_resize: allocate or enlarge the hash table
+//------------------------------------------------------------------------------
+
+// Returns false if out of memory, in which case the old table, if any, is
+// unchanged.
+
+static bool GB_Pending_hash_resize
+(
+    GB_Pending Pending,
+    const int64_t hash_size
+)
+{
+
+    //--------------------------------------------------------------------------
+    // allocate the new table
+    //--------------------------------------------------------------------------
+
+    size_t Hash_new_size = 0 ;
+    int64_t *restrict Hash_new = GB_MALLOC (hash_size, int64_t,
+        &Hash_new_size) ;
+    if (Hash_new == NULL)
+    {
+        // out of memory
+        return (false) ;
+    }
+    for (int64_t h = 0 ; h < hash_size ; h++)
+    {
+        Hash_new [h] = -1 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // move the positions from the old table to the new one
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Hash = Pending->hash ;
+    const int64_t *restrict Pending_i = Pending->i ;
+    const int64_t *restrict Pending_j = Pending->j ;
+    const int64_t hash_bits = hash_size - 1 ;
+    if (Hash != NULL)
+    {
+        for (int64_t h_old = 0 ; h_old <= Pending->hash_bits ; h_old++)
+        {
+            const int64_t q = Hash [h_old] ;
+            if (q == -1) continue ;
+            const int64_t k = (q < 0) ? GB_PENDING_FLIP (q) : q ;
+            const int64_t i = Pending_i [k] ;
+            const int64_t j = (Pending_j == NULL) ? 0 : Pending_j [k] ;
+            int64_t h = GB_Pending_hashf (i, j, hash_bits) ;
+            while (Hash_new [h] != -1)
+            {
+                GB_REHASH (h, i, hash_bits) ;
+            }
+            Hash_new [h] = q ;
+        }
+        GB_FREE (&(Pending->hash), Pending->hash_size) ;
+    }
+
+    Pending->hash = Hash_new ;
+    Pending->hash_size = Hash_new_size ;
+    Pending->hash_bits = hash_bits ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Pending_hash: find a pending tuple with the same (i,j)
+//------------------------------------------------------------------------------
+
+int64_t GB_Pending_hash     // position of (i,j) in the list, or -1
+(
+    GB_Pending Pending,     // list of pending tuples
+    const int64_t i,        // index into vector
+    const int64_t j,        // vector index
+    const int64_t nkeys_max // max # of distinct (i,j) in the hash table
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Pending != NULL) ;
+    ASSERT (nkeys_max > 0) ;
+    ASSERT (Pending->hash_ntuples <= Pending->n) ;
+
+    // the largest table needed, a power of 2 that is at least 2*nkeys_max,
+    // where nkeys_max is fixed when the table is allocated
+    if (Pending->hash == NULL)
+    {
+        Pending->hash_nkeys_max = GB_IMIN (nkeys_max, ((int64_t) 1) << 40) ;
+    }
+    int64_t hash_max = 1 ;
+    while (hash_max < 2 * Pending->hash_nkeys_max)
+    {
+        hash_max = 2 * hash_max ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the table, if this is the first time it is needed
+    //--------------------------------------------------------------------------
+
+    if (Pending->hash == NULL)
+    {
+        if (!GB_Pending_hash_resize (Pending, GB_IMIN (hash_max, 1024)))
+        {
+            // out of memory; the tuple is not combined
+            return (-1) ;
+        }
+        Pending->hash_nkeys = 0 ;
+        Pending->hash_ntuples = 0 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // add the tuples appended to the list by other methods
+    //--------------------------------------------------------------------------
+
+    const int64_t n = Pending->n ;
+    const int64_t *restrict Pending_i = Pending->i ;
+    const int64_t *restrict Pending_j = Pending->j ;
+    for (int64_t t = Pending->hash_ntuples ; t <= n ; t++)
+    {
+
+        //----------------------------------------------------------------------
+        // double the size of the table if it is half full
+        //----------------------------------------------------------------------
+
+        const int64_t hash_size = Pending->hash_bits + 1 ;
+        if (2 * (Pending->hash_nkeys + 1) > hash_size && hash_size < hash_max
+            && Pending->hash_nkeys < Pending->hash_nkeys_max)
+        {
+            if (!GB_Pending_hash_resize (Pending, 2 * hash_size))
+            {
+                // out of memory; the table stays the same size and no more
+                // (i,j) are added to it
+                Pending->hash_nkeys_max = Pending->hash_nkeys ;
+            }
+        }
+
+        if (t == n) break ;
+
+        //----------------------------------------------------------------------
+        // tuple t is now the last one in the list with its (i,j)
+        //----------------------------------------------------------------------
+
+        GB_Pending_hash_find (Pending, Pending_i [t],
+            (Pending_j == NULL) ? 0 : Pending_j [t], t, true) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find (i,j), or add it as the new tuple at position n
+    //--------------------------------------------------------------------------
+
+    Pending->hash_ntuples = n + 1 ;
+    int64_t k = GB_Pending_hash_find (Pending, i, j, n, false) ;
+    if (k >= 0)
+    {
+        // (i,j) was found, so the new tuple is not appended
+        Pending->hash_ntuples = n ;
+    }
+    return (k) ;
+}
+
@@ -0,0 +1,54 @@
+//------------------------------------------------------------------------------
+// GB_Pending_job_free: free a background job
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Waits for the background thread of the job to finish, if it is still
+// running, and discards the pending tuples held by the job.
+
+#include "pending/GB_Pending.h"
+
+#if defined ( GB_HAVE_PTHREADS )
+#include <pthread.h>
+#endif
+
+void GB_Pending_job_free    // free a background job
+(
+    GB_Pending_job *job_handle
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (job_handle != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // wait for the background thread, and free the job
+    //--------------------------------------------------------------------------
+
+    GB_Pending_job job = (*job_handle) ;
+    if (job != NULL)
+    {
+        #if defined ( GB_HAVE_PTHREADS )
+        if (job->thread != NULL)
+        { 
+            pthread_join (*((pthread_t *) job->thread), NULL) ;
+            GB_FREE (&(job->thread), job->thread_size) ;
+        }
+        #endif
+        #pragma omp flush
+        GB_Pending_free (&(job->Pending)) ;
+        GB_Matrix_free (&(job->T0)) ;
+        GB_Matrix_free (&(job->T)) ;
+        GB_FREE (&(job->iso_value), job->iso_value_size) ;
+        GB_FREE (&(job), job->header_size) ;
+    }
+
+    (*job_handle) = NULL ;
+}
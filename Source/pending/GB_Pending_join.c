@@ -0,0 +1,66 @@
+//------------------------------------------------------------------------------
+// GB_Pending_join: finish a background job and take its result
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Waits for the background thread of the job to finish, if it is still
+// running, and moves its result into T, a matrix with a static header.  T is
+// the hypersparse matrix of the pending tuples held by the job, with the type
+// and dimensions of the matrix that owned them.  The job is freed.  If the job
+// failed, T is empty and its error status is returned.
+
+#include "pending/GB_Pending.h"
+
+#if defined ( GB_HAVE_PTHREADS )
+#include <pthread.h>
+#endif
+
+GrB_Info GB_Pending_join    // finish a background job and take its result
+(
+    GrB_Matrix T,           // output: static header, assembled tuples
+    GB_Pending_job *job_handle  // job to finish; freed on output
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (T != NULL) ;
+    ASSERT (job_handle != NULL) ;
+    GB_Pending_job job = (*job_handle) ;
+    ASSERT (job != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // wait for the background thread
+    //--------------------------------------------------------------------------
+
+    #if defined ( GB_HAVE_PTHREADS )
+    if (job->thread != NULL)
+    { 
+        pthread_join (*((pthread_t *) job->thread), NULL) ;
+        GB_FREE (&(job->thread), job->thread_size) ;
+    }
+    #endif
+    #pragma omp flush
+    ASSERT (job->done) ;
+
+    //--------------------------------------------------------------------------
+    // move the result into T and free the job
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = job->info ;
+    if (info == GrB_SUCCESS)
+    { 
+        ASSERT (job->T != NULL) ;
+        memcpy (T, job->T, sizeof (struct GB_Matrix_opaque)) ;
+        job->T = NULL ;
+        ASSERT_MATRIX_OK (T, "T from background job", GB0) ;
+    }
+    GB_Pending_job_free (job_handle) ;
+    return (info) ;
+}
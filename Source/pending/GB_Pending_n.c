@@ -18,8 +18,13 @@ int64_t GB_Pending_n        // return # of pending tuples in A
     int64_t n = 0 ;
     if (A != NULL && A->Pending != NULL)
     { 
-        // only sparse and hypersparse matries can have pending tuples
+        // only sparse and hypersparse matries can have pending tuples,
+        // including any tuples held by a background job
         n = A->Pending->n ;
+        if (A->Pending->job != NULL)
+        { 
+            n += A->Pending->job->n ;
+        }
     }
     return (n) ;
 }
@@ -54,6 +54,12 @@ GrB_Info GB_Context_check       // check a GraphBLAS Context
     int gpu_id = GB_Context_gpu_id_get (Context) ;
     if (gpu_id >= 0) GBPR0 ("    Context.gpu_id:   %d\n", gpu_id) ;
 
+    double workspace_max = GB_Context_workspace_max_get (Context) ;
+    if (workspace_max > 0)
+    { 
+        GBPR0 ("    Context.workspace_max: %g\n", workspace_max) ;
+    }
+
     return (GrB_SUCCESS) ;
 }
 
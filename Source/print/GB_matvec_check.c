@@ -357,6 +357,7 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
             A->x, A->x_shallow, (uint64_t) A->x_size) ;
         GBPR ("  ->Y: %p shallow: %d no_hyper_hash: %d\n",
             A->Y, A->Y_shallow, A->no_hyper_hash) ;
+        GBPR ("  ->AT: %p cache_AT: %d\n", A->AT, A->cache_AT) ;
     }
     #endif
 
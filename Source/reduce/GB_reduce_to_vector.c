@@ -211,7 +211,8 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
     //--------------------------------------------------------------------------
 
     info = GB_mxm (C, C_replace, M, Mask_comp, Mask_struct, accum,
-        semiring, A, A_transpose, B, false, false, GxB_DEFAULT, do_sort, Werk) ;
+        semiring, A, A_transpose, B, false, false, GxB_DEFAULT, do_sort,
+        NULL, NULL, Werk) ;
     GB_FREE_ALL ;
     return (info) ;
 }
@@ -74,6 +74,18 @@ GrB_Info GB_reshape         // reshape a GrB_Matrix into another GrB_Matrix
     { 
         (*Chandle) = NULL ;
     }
+    else
+    { 
+        // A is reshaped in place, so its cached transpose is no longer valid,
+        // and A must be copied out of its memory mapping, if any
+        GB_Matrix_free (&(A->AT)) ;
+        info = GB_unmap (A) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            return (info) ;
+        }
+    }
 
     GrB_Index matrix_size, s ;
     int64_t nrows_old = GB_NROWS (A) ;
@@ -59,6 +59,15 @@ GrB_Scalar GB_Scalar_wrap   // create a new GrB_Scalar with one entry
     s->Y_shallow = false ;
     s->no_hyper_hash = true ;
 
+    s->AT = NULL ;
+    s->cache_AT = false ;
+
+    s->mapping = NULL ;
+    s->mapping_size = 0 ;
+    s->mapping_release = NULL ;
+
+    s->Ingest = NULL ;
+
     s->nvals = 0 ;
 
     s->Pending = NULL ;
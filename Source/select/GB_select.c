@@ -16,8 +16,6 @@
 
 #include "select/GB_select.h"
 #include "mask/GB_accum_mask.h"
-#include "transpose/GB_transpose.h"
-#include "scalar/GB_Scalar_wrap.h"
 
 GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
 (
@@ -60,7 +58,6 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     GrB_Info info ;
     GB_OK (GB_compatible (C->type, C, M, Mask_struct, accum, A->type, Werk));
 
-    GB_Type_code xcode = (op->xtype == NULL) ? GB_ignore_code : op->xtype->code;
     GB_Opcode opcode = op->opcode ;
     ASSERT (GB_IS_INDEXUNARYOP_CODE (opcode)) ;
     ASSERT (opcode != GB_FLIPDIAGINDEX_idxunop_code) ;
@@ -156,236 +153,11 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     // do not match, GB_accum_mask transposes T, computing C<M>=accum(C,T').
 
     //--------------------------------------------------------------------------
-    // change the op if needed
-    //--------------------------------------------------------------------------
-
-    bool flipij = !A_csc ;
-
-    ASSERT_SCALAR_OK (Thunk, "Thunk now GB_select", GB0) ;
-
-    bool make_copy = false ;
-    bool is_empty = false ;
-    bool negate_thunk = false ;
-    bool bthunk = false ;
-    bool op_is_bool_valued = (xcode == GB_BOOL_code &&
-      (opcode >= GB_VALUENE_idxunop_code && opcode <= GB_VALUELE_idxunop_code)) ;
-    if (op_is_bool_valued)
-    { 
-        GB_cast_scalar (&bthunk, GB_BOOL_code, Thunk->x, ttype->code,
-            sizeof (bool)) ;
-    }
-
-    if (flipij && GB_IS_INDEXUNARYOP_CODE_POSITIONAL (opcode))
-    { 
-
-        //----------------------------------------------------------------------
-        // tril, triu, diag, offdiag, ...: handle the flip
-        //----------------------------------------------------------------------
-
-        // The built-in operators are modified so they can always work as if A
-        // were in CSC format.  If A is not in CSC, then the operation is
-        // flipped.
-
-        switch (opcode)
-        {
-            // TRIL becomes TRIU with thunk negated
-            case GB_TRIL_idxunop_code : 
-                negate_thunk = true ;
-                op = GrB_TRIU ;
-                break ;
-
-            // TRIU becomes TRIL with thunk negated
-            case GB_TRIU_idxunop_code : 
-                negate_thunk = true ;
-                op = GrB_TRIL ;
-                break ;
-
-            // DIAG, OFFDIAG, DIAGINDEX: same op, but negate the thunk
-            case GB_DIAG_idxunop_code : 
-            case GB_OFFDIAG_idxunop_code : 
-            case GB_DIAGINDEX_idxunop_code : 
-                negate_thunk = true ;
-                break ;
-
-            // ROWINDEX becomes COLINDEX
-            case GB_ROWINDEX_idxunop_code  : 
-                // i+thunk becomes j+thunk: no change to thunk
-                op = (xcode == GB_INT32_code) ? GrB_COLINDEX_INT32
-                                              : GrB_COLINDEX_INT64 ;
-                break ;
-
-            // COLINDEX becomes ROWINDEX
-            case GB_COLINDEX_idxunop_code  : 
-                // j+thunk becomes i+thunk: no change to thunk
-                op = (xcode == GB_INT32_code) ? GrB_ROWINDEX_INT32
-                                              : GrB_ROWINDEX_INT64 ;
-                break ;
-
-            // COLLE becomes ROWLE
-            case GB_COLLE_idxunop_code : 
-                // j <= thunk becomes i <= thunk: no change to thunk
-                op = GrB_ROWLE ;
-                break ;
-
-            // COLGT becomes ROWGT
-            case GB_COLGT_idxunop_code : 
-                // j > thunk becomes i > thunk: no change to thunk
-                op = GrB_ROWGT ;
-                break ;
-
-            // ROWLE becomes COLLE
-            case GB_ROWLE_idxunop_code : 
-                // i <= thunk becomes j <= thunk: no change to thunk
-                op = GrB_COLLE ;
-                break ;
-
-            // ROWGT becomes COLGT
-            case GB_ROWGT_idxunop_code : 
-                // i > thunk becomes j > thunk: no change to thunk
-                op = GrB_COLGT ;
-                break ;
-
-            default:;
-        }
-
-        // flipij is now false for any positional operator
-        flipij = false ;
-
-    }
-    else if (op_is_bool_valued)
-    {
-
-        //----------------------------------------------------------------------
-        // convert all VALUE* bool cases to VALUEEQ
-        //----------------------------------------------------------------------
-
-        op = GrB_VALUEEQ_BOOL ;
-        switch (opcode)
-        {
-
-            case GB_VALUENE_idxunop_code   : // A(i,j) != thunk
-
-                // use A(i,j) == !thunk
-                bthunk = !bthunk ;
-                break ;
-
-            case GB_VALUEGT_idxunop_code   : // A(i,j) > thunk
-
-                if (bthunk)
-                { 
-                    // if thunk is true,  return an empty matrix
-                    is_empty = true ;
-                }
-                else
-                { 
-                    // otherwise, use A(i,j) == true
-                    bthunk = true ;
-                }
-                break ;
-
-            case GB_VALUEGE_idxunop_code   : // A(i,j) >= thunk
-
-                if (!bthunk)
-                { 
-                    // if thunk is false, make a copy
-                    make_copy = true ;
-                }
-                else
-                { 
-                    // otherwise, use A(i,j) == true
-                    bthunk = true ;
-                }
-                break ;
-
-            case GB_VALUELT_idxunop_code   : // A(i,j) < thunk
-
-                // if thunk is false, return an empty matrix
-                if (!bthunk)
-                { 
-                    is_empty = true ;
-                }
-                else
-                { 
-                    // otherwise, use A(i,j) == false
-                    bthunk = false ;
-                }
-                break ;
-
-            case GB_VALUELE_idxunop_code   : // A(i,j) <= thunk
-
-                // if thunk is true, make a copy
-                if (bthunk)
-                { 
-                    make_copy = true ;
-                }
-                else
-                { 
-                    // otherwise, use A(i,j) == false
-                    bthunk = false ;
-                }
-                break ;
-
-            default : ;
-        }
-    }
-
-    if (opcode != GB_USER_idxunop_code)
-    { 
-        // flipij can still be true but is only needed for if the
-        // GrB_IndexUnaryOp is user-defined.  So set here it to false for all
-        // but user-defined ops.
-        flipij = false ;
-    }
-
-    //--------------------------------------------------------------------------
-    // negate the Thunk if needed
-    //--------------------------------------------------------------------------
-
-    GrB_Scalar Thunk2 ;
-    struct GB_Scalar_opaque Thunk2_header ;
-    int64_t ithunk = 0 ;
-    if (negate_thunk)
-    { 
-        // Thunk = -(int64_t) Thunk
-        GB_cast_scalar (&ithunk, GB_INT64_code, Thunk->x, ttype->code,
-            sizeof (int64_t)) ;
-        ithunk = -ithunk ;
-        Thunk2 = GB_Scalar_wrap (&Thunk2_header, GrB_INT64, &ithunk) ;
-    }
-    else if (op_is_bool_valued)
-    { 
-        // Thunk = bthunk
-        Thunk2 = GB_Scalar_wrap (&Thunk2_header, GrB_BOOL, &bthunk) ;
-    }
-    else
-    { 
-        // use Thunk as-is
-        Thunk2 = Thunk ;
-    }
-
-    //--------------------------------------------------------------------------
-    // create T
+    // T = select (A,Thunk)
     //--------------------------------------------------------------------------
 
     GB_CLEAR_STATIC_HEADER (T, &T_header) ;
-
-    if (make_copy)
-    { 
-        // T = A
-        GB_OK (GB_shallow_copy (T, A_csc, A, Werk)) ;
-    }
-    else if (is_empty)
-    { 
-        // T is an empty non-iso matrix
-        GB_OK (GB_new (&T, // auto (sparse or hyper), existing header
-            A->type, A->vlen, A->vdim, GB_Ap_calloc, A_csc,
-            GxB_SPARSE + GxB_HYPERSPARSE, GB_Global_hyper_switch_get ( ), 1)) ;
-    }
-    else
-    { 
-        // T = select (A, Thunk)
-        GB_OK (GB_selector (T, op, flipij, A, Thunk2, Werk)) ;
-    }
+    GB_OK (GB_selector_flip (T, op, A_csc, A, Thunk, Werk)) ;
 
     T->is_csc = A_csc ;
     ASSERT_MATRIX_OK (T, "T=select(A,Thunk) output", GB0) ;
@@ -37,6 +37,16 @@ GrB_Info GB_selector
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_selector_flip
+(
+    GrB_Matrix T,               // output matrix, static header, or NULL
+    const GrB_IndexUnaryOp op_in,
+    const bool A_csc,           // if true, treat A as if held by column
+    GrB_Matrix A,               // input matrix, or input/output if T is NULL
+    const GrB_Scalar Thunk,     // always present, and not empty
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_select_sparse
 (
     GrB_Matrix C,
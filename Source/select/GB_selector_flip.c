@@ -0,0 +1,339 @@
+//------------------------------------------------------------------------------
+// GB_selector_flip: select entries, modifying the op for the matrix format
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// T = select (A,Thunk), where A is treated as if in CSC format if A_csc is
+// true, or CSR otherwise.  The built-in positional operators are modified so
+// that GB_selector can always work as if A were held by column.  If T is
+// NULL, A is modified in place instead (used by GB_mxm to select entries
+// from its result T=A*B before T is accumulated into C).  The caller has
+// already checked the op, the Thunk, and their types.
+
+#include "select/GB_select.h"
+#include "transplant/GB_transplant.h"
+#include "transpose/GB_transpose.h"
+#include "scalar/GB_Scalar_wrap.h"
+
+#define GB_FREE_ALL         {                               GB_Matrix_free (&T2) ;  }
+
+GrB_Info GB_selector_flip
+(
+    GrB_Matrix T,               // output matrix, static header, or NULL
+    const GrB_IndexUnaryOp op_in,
+    const bool A_csc,           // if true, treat A as if held by column
+    GrB_Matrix A,               // input matrix, or input/output if T is NULL
+    const GrB_Scalar Thunk,     // always present, and not empty
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    struct GB_Matrix_opaque T2_header ;
+    GrB_Matrix T2 = NULL ;
+
+    GrB_IndexUnaryOp op = op_in ;
+    ASSERT_INDEXUNARYOP_OK (op, "op for GB_selector_flip", GB0) ;
+    ASSERT_MATRIX_OK (A, "A input for GB_selector_flip", GB0) ;
+    ASSERT (!GB_ZOMBIES (A) && !GB_PENDING (A)) ;
+    ASSERT (GB_nnz ((GrB_Matrix) Thunk) > 0) ;
+    ASSERT (T == NULL || (T->static_header || GBNSTATIC)) ;
+
+    GrB_Type ttype = Thunk->type ;
+    GB_Type_code xcode = (op->xtype == NULL) ? GB_ignore_code : op->xtype->code;
+    GB_Opcode opcode = op->opcode ;
+
+    //--------------------------------------------------------------------------
+    // change the op if needed
+    //--------------------------------------------------------------------------
+
+    bool flipij = !A_csc ;
+
+    ASSERT_SCALAR_OK (Thunk, "Thunk for GB_selector_flip", GB0) ;
+
+    bool make_copy = false ;
+    bool is_empty = false ;
+    bool negate_thunk = false ;
+    bool bthunk = false ;
+    bool op_is_bool_valued = (xcode == GB_BOOL_code &&
+      (opcode >= GB_VALUENE_idxunop_code && opcode <= GB_VALUELE_idxunop_code)) ;
+    if (op_is_bool_valued)
+    { 
+        GB_cast_scalar (&bthunk, GB_BOOL_code, Thunk->x, ttype->code,
+            sizeof (bool)) ;
+    }
+
+    if (flipij && GB_IS_INDEXUNARYOP_CODE_POSITIONAL (opcode))
+    { 
+
+        //----------------------------------------------------------------------
+        // tril, triu, diag, offdiag, ...: handle the flip
+        //----------------------------------------------------------------------
+
+        // The built-in operators are modified so they can always work as if A
+        // were in CSC format.  If A is not in CSC, then the operation is
+        // flipped.
+
+        switch (opcode)
+        {
+            // TRIL becomes TRIU with thunk negated
+            case GB_TRIL_idxunop_code : 
+                negate_thunk = true ;
+                op = GrB_TRIU ;
+                break ;
+
+            // TRIU becomes TRIL with thunk negated
+            case GB_TRIU_idxunop_code : 
+                negate_thunk = true ;
+                op = GrB_TRIL ;
+                break ;
+
+            // DIAG, OFFDIAG, DIAGINDEX: same op, but negate the thunk
+            case GB_DIAG_idxunop_code : 
+            case GB_OFFDIAG_idxunop_code : 
+            case GB_DIAGINDEX_idxunop_code : 
+                negate_thunk = true ;
+                break ;
+
+            // ROWINDEX becomes COLINDEX
+            case GB_ROWINDEX_idxunop_code  : 
+                // i+thunk becomes j+thunk: no change to thunk
+                op = (xcode == GB_INT32_code) ? GrB_COLINDEX_INT32
+                                              : GrB_COLINDEX_INT64 ;
+                break ;
+
+            // COLINDEX becomes ROWINDEX
+            case GB_COLINDEX_idxunop_code  : 
+                // j+thunk becomes i+thunk: no change to thunk
+                op = (xcode == GB_INT32_code) ? GrB_ROWINDEX_INT32
+                                              : GrB_ROWINDEX_INT64 ;
+                break ;
+
+            // COLLE becomes ROWLE
+            case GB_COLLE_idxunop_code : 
+                // j <= thunk becomes i <= thunk: no change to thunk
+                op = GrB_ROWLE ;
+                break ;
+
+            // COLGT becomes ROWGT
+            case GB_COLGT_idxunop_code : 
+                // j > thunk becomes i > thunk: no change to thunk
+                op = GrB_ROWGT ;
+                break ;
+
+            // ROWLE becomes COLLE
+            case GB_ROWLE_idxunop_code : 
+                // i <= thunk becomes j <= thunk: no change to thunk
+                op = GrB_COLLE ;
+                break ;
+
+            // ROWGT becomes COLGT
+            case GB_ROWGT_idxunop_code : 
+                // i > thunk becomes j > thunk: no change to thunk
+                op = GrB_COLGT ;
+                break ;
+
+            default:;
+        }
+
+        // flipij is now false for any positional operator
+        flipij = false ;
+
+    }
+    else if (op_is_bool_valued)
+    {
+
+        //----------------------------------------------------------------------
+        // convert all VALUE* bool cases to VALUEEQ
+        //----------------------------------------------------------------------
+
+        op = GrB_VALUEEQ_BOOL ;
+        switch (opcode)
+        {
+
+            case GB_VALUENE_idxunop_code   : // A(i,j) != thunk
+
+                // use A(i,j) == !thunk
+                bthunk = !bthunk ;
+                break ;
+
+            case GB_VALUEGT_idxunop_code   : // A(i,j) > thunk
+
+                if (bthunk)
+                { 
+                    // if thunk is true,  return an empty matrix
+                    is_empty = true ;
+                }
+                else
+                { 
+                    // otherwise, use A(i,j) == true
+                    bthunk = true ;
+                }
+                break ;
+
+            case GB_VALUEGE_idxunop_code   : // A(i,j) >= thunk
+
+                if (!bthunk)
+                { 
+                    // if thunk is false, make a copy
+                    make_copy = true ;
+                }
+                else
+                { 
+                    // otherwise, use A(i,j) == true
+                    bthunk = true ;
+                }
+                break ;
+
+            case GB_VALUELT_idxunop_code   : // A(i,j) < thunk
+
+                // if thunk is false, return an empty matrix
+                if (!bthunk)
+                { 
+                    is_empty = true ;
+                }
+                else
+                { 
+                    // otherwise, use A(i,j) == false
+                    bthunk = false ;
+                }
+                break ;
+
+            case GB_VALUELE_idxunop_code   : // A(i,j) <= thunk
+
+                // if thunk is true, make a copy
+                if (bthunk)
+                { 
+                    make_copy = true ;
+                }
+                else
+                { 
+                    // otherwise, use A(i,j) == false
+                    bthunk = false ;
+                }
+                break ;
+
+            default : ;
+        }
+    }
+
+    if (opcode != GB_USER_idxunop_code)
+    { 
+        // flipij can still be true but is only needed for if the
+        // GrB_IndexUnaryOp is user-defined.  So set here it to false for all
+        // but user-defined ops.
+        flipij = false ;
+    }
+
+    //--------------------------------------------------------------------------
+    // negate the Thunk if needed
+    //--------------------------------------------------------------------------
+
+    GrB_Scalar Thunk2 ;
+    struct GB_Scalar_opaque Thunk2_header ;
+    int64_t ithunk = 0 ;
+    if (negate_thunk)
+    { 
+        // Thunk = -(int64_t) Thunk
+        GB_cast_scalar (&ithunk, GB_INT64_code, Thunk->x, ttype->code,
+            sizeof (int64_t)) ;
+        ithunk = -ithunk ;
+        Thunk2 = GB_Scalar_wrap (&Thunk2_header, GrB_INT64, &ithunk) ;
+    }
+    else if (op_is_bool_valued)
+    { 
+        // Thunk = bthunk
+        Thunk2 = GB_Scalar_wrap (&Thunk2_header, GrB_BOOL, &bthunk) ;
+    }
+    else
+    { 
+        // use Thunk as-is
+        Thunk2 = Thunk ;
+    }
+
+    //--------------------------------------------------------------------------
+    // select A in place
+    //--------------------------------------------------------------------------
+
+    if (T == NULL)
+    {
+        if (make_copy)
+        { 
+            // A = A: nothing to do
+            return (GrB_SUCCESS) ;
+        }
+        else if (is_empty)
+        { 
+            // A is now empty
+            return (GB_clear (A, Werk)) ;
+        }
+
+        ASSERT (A_csc == A->is_csc) ;
+        GB_Opcode sel_opcode = op->opcode ;
+        if (GB_IS_INDEXUNARYOP_CODE_POSITIONAL (sel_opcode))
+        { 
+            // positional ops cannot be applied to a jumbled matrix
+            GB_MATRIX_WAIT (A) ;
+        }
+
+        bool column_op = (sel_opcode == GB_COLINDEX_idxunop_code ||
+                          sel_opcode == GB_COLLE_idxunop_code ||
+                          sel_opcode == GB_COLGT_idxunop_code) ;
+        bool iso_value_op = A->iso &&
+            (sel_opcode >= GB_VALUENE_idxunop_code &&
+             sel_opcode <= GB_VALUELE_idxunop_code) ;
+        if ((GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A))
+            && !column_op && !iso_value_op && !GB_is_shallow (A))
+        { 
+            // A = select (A, Thunk), compacting A->i and A->x in place
+            GB_BURBLE_MATRIX (A, "(in-place select) ") ;
+            return (GB_selector (NULL, op, flipij, A, Thunk2, Werk)) ;
+        }
+
+        // A is bitmap, full, or shallow, or the op has no in-place selector:
+        // select into T2 and transplant it back into A.
+        GB_CLEAR_STATIC_HEADER (T2, &T2_header) ;
+        GB_OK (GB_selector (T2, op, flipij, A, Thunk2, Werk)) ;
+        if (GB_is_shallow (T2))
+        {
+            // the selector returns a shallow copy of A only if all entries
+            // are kept, so A is unchanged
+            GB_FREE_ALL ;
+            return (GrB_SUCCESS) ;
+        }
+        T2->is_csc = A->is_csc ;
+        return (GB_transplant (A, A->type, &T2, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // create T
+    //--------------------------------------------------------------------------
+
+    if (make_copy)
+    { 
+        // T = A
+        GB_OK (GB_shallow_copy (T, A_csc, A, Werk)) ;
+    }
+    else if (is_empty)
+    { 
+        // T is an empty non-iso matrix
+        GB_OK (GB_new (&T, // auto (sparse or hyper), existing header
+            A->type, A->vlen, A->vdim, GB_Ap_calloc, A_csc,
+            GxB_SPARSE + GxB_HYPERSPARSE, GB_Global_hyper_switch_get ( ), 1)) ;
+    }
+    else
+    { 
+        // T = select (A, Thunk)
+        GB_OK (GB_selector (T, op, flipij, A, Thunk2, Werk)) ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,143 @@
+//------------------------------------------------------------------------------
+// GB_delta_get: get the delta section of a blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Reads the header of a blob, and returns a pointer to its delta section (see
+// GB_serialize.h), or NULL if the blob has none.  The delta section is checked
+// for consistency with the dimensions of the matrix in the blob.  A streamed
+// blob never has a delta section.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+GrB_Info GB_delta_get               // get the delta section of a blob
+(
+    // output:
+    const uint64_t **Delta_handle,  // delta section, or NULL if not present
+    int64_t *vlen_handle,           // vector length of the matrix in the blob
+    int64_t *vdim_handle,           // # of vectors of the matrix in the blob
+    int32_t *typecode_handle,       // type code of the matrix in the blob
+    bool *is_csc_handle,            // format of the matrix in the blob
+    // input:
+    const GB_void *blob,            // serialized matrix
+    size_t blob_size                // size of the blob
+)
+{
+
+    //--------------------------------------------------------------------------
+    // read the content of the header (160 bytes)
+    //--------------------------------------------------------------------------
+
+    (*Delta_handle) = NULL ;
+    size_t s = 0 ;
+
+    if (blob_size < GB_BLOB_HEADER_SIZE)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    GB_BLOB_READ (blob_size2, uint64_t) ;
+    GB_BLOB_READ (typecode, int32_t) ;
+    if (blob_size2 == 0)
+    {
+        // a streamed blob has no delta section
+        return (GrB_SUCCESS) ;
+    }
+    if (blob_size2 != (uint64_t) blob_size
+        || typecode < GB_BOOL_code || typecode > GB_UDT_code
+        || (typecode == GB_UDT_code &&
+            blob_size < GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN))
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    GB_BLOB_READ (version, int32_t) ;
+    GB_BLOB_READ (vlen, int64_t) ;
+    GB_BLOB_READ (vdim, int64_t) ;
+    GB_BLOB_READ (nvec, int64_t) ;
+    GB_BLOB_READ (nvec_nonempty, int64_t) ;
+    GB_BLOB_READ (nvals, int64_t) ;
+    GB_BLOB_READ (typesize, int64_t) ;
+    GB_BLOB_READ (Cp_len, int64_t) ;
+    GB_BLOB_READ (Ch_len, int64_t) ;
+    GB_BLOB_READ (Cb_len, int64_t) ;
+    GB_BLOB_READ (Ci_len, int64_t) ;
+    GB_BLOB_READ (Cx_len, int64_t) ;
+    GB_BLOB_READ (hyper_switch, float) ;
+    GB_BLOB_READ (bitmap_switch, float) ;
+    GB_BLOB_READ (sparsity_control, int32_t) ;
+    GB_BLOB_READ (sparsity_iso_csc, int32_t) ;
+    GB_BLOB_READ (Cp_nblocks, int32_t) ; GB_BLOB_READ (Cp_method, int32_t) ;
+    GB_BLOB_READ (Ch_nblocks, int32_t) ; GB_BLOB_READ (Ch_method, int32_t) ;
+    GB_BLOB_READ (Cb_nblocks, int32_t) ; GB_BLOB_READ (Cb_method, int32_t) ;
+    GB_BLOB_READ (Ci_nblocks, int32_t) ; GB_BLOB_READ (Ci_method, int32_t) ;
+    GB_BLOB_READ (Cx_nblocks, int32_t) ; GB_BLOB_READ (Cx_method, int32_t) ;
+
+    bool checksum = ((sparsity_iso_csc & GB_BLOB_CHECKSUM) != 0) ;
+    bool has_delta = ((sparsity_iso_csc & GB_BLOB_DELTA) != 0) ;
+    sparsity_iso_csc = sparsity_iso_csc & (GB_BLOB_ALIGNED - 1) ;
+    bool is_csc = ((sparsity_iso_csc & 1) == 1) ;
+
+    (*vlen_handle) = vlen ;
+    (*vdim_handle) = vdim ;
+    (*typecode_handle) = typecode ;
+    (*is_csc_handle) = is_csc ;
+
+    if (!has_delta)
+    {
+        // the blob has no delta section
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // skip the type name, the Sblocks, and the checksums
+    //--------------------------------------------------------------------------
+
+    if (typecode == GB_UDT_code)
+    {
+        s += GxB_MAX_NAME_LEN ;
+    }
+
+    if (Cp_nblocks < 0 || Ch_nblocks < 0 || Cb_nblocks < 0 || Ci_nblocks < 0
+        || Cx_nblocks < 0)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    s += ((int64_t) Cp_nblocks + Ch_nblocks + Cb_nblocks + Ci_nblocks
+        + Cx_nblocks) * sizeof (int64_t) ;
+
+    if (checksum)
+    {
+        s += (GB_CHECKSUM_COUNT (Cp_len, Cp_nblocks, Cp_method) +
+              GB_CHECKSUM_COUNT (Ch_len, Ch_nblocks, Ch_method) +
+              GB_CHECKSUM_COUNT (Cb_len, Cb_nblocks, Cb_method) +
+              GB_CHECKSUM_COUNT (Ci_len, Ci_nblocks, Ci_method) +
+              GB_CHECKSUM_COUNT (Cx_len, Cx_nblocks, Cx_method))
+            * sizeof (uint64_t) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the delta section and check it
+    //--------------------------------------------------------------------------
+
+    GB_BLOB_READ_DELTA (Delta) ;
+    if (s > blob_size || vdim < 0 ||
+        Delta [1] != (uint64_t) GB_DELTA_GSIZE (vdim) ||
+        Delta [0] != (uint64_t) GB_ICEIL (vdim, GB_DELTA_GSIZE (vdim)))
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    (*Delta_handle) = Delta ;
+    return (GrB_SUCCESS) ;
+}
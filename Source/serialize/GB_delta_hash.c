@@ -0,0 +1,131 @@
+//------------------------------------------------------------------------------
+// GB_delta_hash: hash each group of vectors of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The vectors of A are partitioned into ngroups groups, where group g holds
+// the vectors j = g*gsize to (g+1)*gsize-1.  Hgroups [g] is an XXH3 hash of
+// the content of the nonempty vectors in group g: the index j of each vector,
+// its row indices, and its values.  Empty vectors are skipped, so the hash
+// is the same whether A is sparse or hypersparse.  The values are hashed in
+// chunks of GB_DELTA_CHUNK entries, and an iso value is hashed as if it were
+// expanded, so the hash is also the same whether or not A is iso-valued.  The
+// hash of a group with no entries is zero.  The groups are hashed in parallel.
+
+// A must be sparse or hypersparse, with no pending work.
+
+#include "GB.h"
+#include "jitifyer/GB_jitifyer.h"
+#include "serialize/GB_serialize.h"
+
+#define GB_DELTA_CHUNK 4096
+
+// fold the 64-bit values a, b, and c into the hash h
+#define GB_DELTA_FOLD(h,a,b,c)                                              \
+{                                                                           \
+    uint64_t w [4] ;                                                        \
+    w [0] = (h) ; w [1] = (a) ; w [2] = (b) ; w [3] = (c) ;                 \
+    (h) = GB_jitifyer_hash (w, sizeof (w), true) ;                          \
+}
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_FREE_WORK (&Iso, Iso_size) ;     \
+}
+
+GrB_Info GB_delta_hash              // hash each group of vectors of A
+(
+    // output:
+    uint64_t *Hgroups,              // array of size ngroups
+    // input:
+    const GrB_Matrix A,             // sparse or hypersparse matrix
+    int64_t ngroups,                // # of groups
+    int64_t gsize,                  // # of vectors in each group
+    int nthreads_max
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    const GB_void *restrict Ax = (GB_void *) A->x ;
+    const int64_t anvec = A->nvec ;
+    const int64_t vdim = A->vdim ;
+    const size_t asize = A->type->size ;
+    const bool A_iso = A->iso ;
+
+    //--------------------------------------------------------------------------
+    // expand the iso value into a single chunk
+    //--------------------------------------------------------------------------
+
+    GB_void *Iso = NULL ; size_t Iso_size = 0 ;
+    if (A_iso)
+    {
+        Iso = GB_MALLOC_WORK (GB_DELTA_CHUNK * asize, GB_void, &Iso_size) ;
+        if (Iso == NULL)
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        for (int64_t p = 0 ; p < GB_DELTA_CHUNK ; p++)
+        {
+            memcpy (Iso + p * asize, Ax, asize) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // hash each group in parallel
+    //--------------------------------------------------------------------------
+
+    int nthreads = (int) GB_IMIN (nthreads_max, ngroups) ;
+    nthreads = GB_IMAX (nthreads, 1) ;
+    int64_t g ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (g = 0 ; g < ngroups ; g++)
+    {
+        int64_t j0 = g * gsize ;
+        int64_t j1 = GB_IMIN (j0 + gsize, vdim) ;
+        int64_t k0 = GB_delta_vector (Ah, anvec, j0) ;
+        int64_t k1 = GB_delta_vector (Ah, anvec, j1) ;
+        uint64_t h = 0 ;
+        for (int64_t k = k0 ; k < k1 ; k++)
+        {
+            int64_t pstart = Ap [k] ;
+            int64_t pend = Ap [k+1] ;
+            if (pstart == pend) continue ;
+            int64_t j = GBH (Ah, k) ;
+            // hash the row indices of A(:,j)
+            uint64_t hi = GB_jitifyer_hash (Ai + pstart,
+                (pend - pstart) * sizeof (int64_t), true) ;
+            // hash the values of A(:,j), one chunk at a time
+            uint64_t hx = 0 ;
+            for (int64_t p = pstart ; p < pend ; p += GB_DELTA_CHUNK)
+            {
+                int64_t n = GB_IMIN (GB_DELTA_CHUNK, pend - p) ;
+                const GB_void *X = (A_iso) ? Iso : (Ax + p * asize) ;
+                uint64_t hc = GB_jitifyer_hash (X, n * asize, true) ;
+                GB_DELTA_FOLD (hx, hc, n, 0) ;
+            }
+            GB_DELTA_FOLD (h, j, hi, hx) ;
+        }
+        Hgroups [g] = h ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,185 @@
+//------------------------------------------------------------------------------
+// GB_delta_splice: splice the groups of vectors of two matrices
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C is a new hypersparse matrix whose vectors in group g (see GB_delta_hash)
+// are taken from B if the group is flagged in the Changed bitmap, or from A
+// otherwise.  If A is NULL, C holds just the changed groups of B.  Empty
+// vectors are not copied into C.  The groups are counted and then copied in
+// parallel.
+
+// A and B must be sparse or hypersparse, with no pending work, and with the
+// same type, dimensions, and format.  If A is present, A and B must both be
+// non-iso, or both iso with the same iso value; C is then iso if B is iso.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_FREE_WORK (&Gk, Gk_size) ;           \
+    GB_FREE_WORK (&Gvec, Gvec_size) ;       \
+    GB_FREE_WORK (&Gnz, Gnz_size) ;         \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    GB_Matrix_free (&C) ;                   \
+}
+
+GrB_Info GB_delta_splice            // splice groups of vectors of A and B
+(
+    // output:
+    GrB_Matrix *Chandle,            // new hypersparse matrix
+    // input:
+    const GrB_Matrix A,             // unchanged groups, or NULL if none
+    const GrB_Matrix B,             // changed groups
+    const uint64_t *Changed,        // bitmap of changed groups
+    int64_t ngroups,                // # of groups
+    int64_t gsize,                  // # of vectors in each group
+    int nthreads_max
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Chandle != NULL) ;
+    ASSERT (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)) ;
+    ASSERT (!GB_ANY_PENDING_WORK (B)) ;
+    ASSERT (A == NULL || GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (A == NULL || !GB_ANY_PENDING_WORK (A)) ;
+    ASSERT (A == NULL || (A->vlen == B->vlen && A->vdim == B->vdim)) ;
+    ASSERT (A == NULL || A->iso == B->iso) ;
+
+    (*Chandle) = NULL ;
+    GrB_Matrix C = NULL ;
+    int64_t *Gk = NULL ; size_t Gk_size = 0 ;
+    int64_t *Gvec = NULL ; size_t Gvec_size = 0 ;
+    int64_t *Gnz = NULL ; size_t Gnz_size = 0 ;
+
+    const size_t csize = B->type->size ;
+    const bool C_iso = B->iso ;
+    const int64_t vdim = B->vdim ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    Gk   = GB_MALLOC_WORK (ngroups + 1, int64_t, &Gk_size) ;
+    Gvec = GB_MALLOC_WORK (ngroups + 1, int64_t, &Gvec_size) ;
+    Gnz  = GB_MALLOC_WORK (ngroups + 1, int64_t, &Gnz_size) ;
+    if (Gk == NULL || Gvec == NULL || Gnz == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the vectors and entries of C in each group
+    //--------------------------------------------------------------------------
+
+    int nthreads = (int) GB_IMIN (nthreads_max, ngroups) ;
+    nthreads = GB_IMAX (nthreads, 1) ;
+    int64_t g ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (g = 0 ; g < ngroups ; g++)
+    {
+        GrB_Matrix X = GB_DELTA_CHANGED (Changed, g) ? B : A ;
+        Gk [g] = 0 ;
+        Gvec [g] = 0 ;
+        Gnz [g] = 0 ;
+        if (X == NULL) continue ;
+        const int64_t *restrict Xp = X->p ;
+        int64_t j0 = g * gsize ;
+        int64_t j1 = GB_IMIN (j0 + gsize, vdim) ;
+        int64_t k0 = GB_delta_vector (X->h, X->nvec, j0) ;
+        int64_t k1 = GB_delta_vector (X->h, X->nvec, j1) ;
+        int64_t nvec = 0 ;
+        for (int64_t k = k0 ; k < k1 ; k++)
+        {
+            nvec += (Xp [k+1] > Xp [k]) ;
+        }
+        Gk [g] = k0 ;
+        Gvec [g] = nvec ;
+        Gnz [g] = Xp [k1] - Xp [k0] ;
+    }
+
+    GB_cumsum (Gvec, ngroups, NULL, 1, NULL) ;
+    GB_cumsum (Gnz, ngroups, NULL, 1, NULL) ;
+    int64_t cnvec = Gvec [ngroups] ;
+    int64_t cnz = Gnz [ngroups] ;
+
+    //--------------------------------------------------------------------------
+    // allocate C
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new_bix (&C, // hypersparse, new header
+        B->type, B->vlen, vdim, GB_Ap_malloc, B->is_csc, GxB_HYPERSPARSE,
+        false, B->hyper_switch, GB_IMAX (cnvec, 1), GB_IMAX (cnz, 1), true,
+        C_iso)) ;
+
+    int64_t *restrict Cp = C->p ;
+    int64_t *restrict Ch = C->h ;
+    int64_t *restrict Ci = C->i ;
+    GB_void *restrict Cx = (GB_void *) C->x ;
+    if (C_iso)
+    {
+        memcpy (Cx, B->x, csize) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy the vectors of each group into C
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (g = 0 ; g < ngroups ; g++)
+    {
+        GrB_Matrix X = GB_DELTA_CHANGED (Changed, g) ? B : A ;
+        int64_t gnz = Gnz [g+1] - Gnz [g] ;
+        if (X == NULL || Gvec [g+1] == Gvec [g]) continue ;
+        const int64_t *restrict Xp = X->p ;
+        const int64_t *restrict Xh = X->h ;
+        int64_t k0 = Gk [g] ;
+        int64_t pstart = Xp [k0] ;
+        int64_t pC = Gnz [g] ;
+        int64_t kC = Gvec [g] ;
+        for (int64_t k = k0 ; kC < Gvec [g+1] ; k++)
+        {
+            if (Xp [k+1] == Xp [k]) continue ;
+            Ch [kC] = GBH (Xh, k) ;
+            Cp [kC] = pC + (Xp [k] - pstart) ;
+            kC++ ;
+        }
+        memcpy (Ci + pC, X->i + pstart, gnz * sizeof (int64_t)) ;
+        if (!C_iso)
+        {
+            memcpy (Cx + pC * csize, ((GB_void *) X->x) + pstart * csize,
+                gnz * csize) ;
+        }
+    }
+
+    Cp [cnvec] = cnz ;
+    C->nvec = cnvec ;
+    C->nvec_nonempty = cnvec ;
+    C->nvals = cnz ;
+    C->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    (*Chandle) = C ;
+    ASSERT_MATRIX_OK (C, "C from delta splice", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -9,6 +9,18 @@
 
 // A parallel decompression of a serialized blob into a GrB_Matrix.
 
+// If zero_copy is true and the blob is uncompressed and aligned, the arrays of
+// C are not copied but point directly into the blob, as shallow components of
+// C.  The caller must then keep the blob alive for as long as C uses it (see
+// GxB_Matrix_deserialize_mmap).  Otherwise, C is a deep copy of the blob.
+
+// A streamed blob written by GxB_Matrix_serialize_stream may also be held in
+// memory and deserialized by this method.
+
+// A blob written by GxB_Matrix_serialize_delta that is a complete snapshot can
+// be deserialized by this method.  An incremental delta holds only part of the
+// matrix, and is rejected unless delta is true (for GB_deserialize_delta).
+
 #include "GB.h"
 #include "get_set/GB_get_set.h"
 #include "serialize/GB_serialize.h"
@@ -19,6 +31,35 @@
     GB_Matrix_free (&C) ;                   \
 }
 
+//------------------------------------------------------------------------------
+// GB_blob_read: read a streamed blob held in memory
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    const GB_void *blob ;   // the blob
+    size_t blob_size ;      // size of the blob
+    size_t s ;              // current position in the blob
+}
+GB_blob_reader ;
+
+static bool GB_blob_read (void *handle, void *buffer, size_t size)
+{
+    GB_blob_reader *reader = (GB_blob_reader *) handle ;
+    if (size > reader->blob_size - reader->s)
+    { 
+        // blob is truncated
+        return (false) ;
+    }
+    memcpy (buffer, reader->blob + reader->s, size) ;
+    reader->s += size ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize
+//------------------------------------------------------------------------------
+
 GrB_Info GB_deserialize             // deserialize a matrix from a blob
 (
     // output:
@@ -26,7 +67,10 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     // input:
     GrB_Type type_expected,         // type expected (NULL for any built-in)
     const GB_void *blob,            // serialized matrix 
-    size_t blob_size                // size of the blob
+    size_t blob_size,               // size of the blob
+    bool zero_copy,                 // if true, C may point into the blob
+    bool delta                      // if true, the blob may hold an
+                                    // incremental delta
 )
 {
 
@@ -55,6 +99,19 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     GB_BLOB_READ (typecode, int32_t) ;
     uint64_t blob_size1 = (uint64_t) blob_size ;
 
+    if (blob_size2 == 0)
+    { 
+        // The blob was written by GxB_Matrix_serialize_stream, and then
+        // read into memory by the user application.  It is never used in
+        // place, so zero_copy is ignored.
+        GB_blob_reader reader ;
+        reader.blob = blob ;
+        reader.blob_size = blob_size ;
+        reader.s = 0 ;
+        return (GB_deserialize_stream (Chandle, type_expected, GB_blob_read,
+            &reader)) ;
+    }
+
     if (blob_size1 != blob_size2
         || typecode < GB_BOOL_code || typecode > GB_UDT_code
         || (typecode == GB_UDT_code &&
@@ -86,7 +143,12 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     GB_BLOB_READ (Ci_nblocks, int32_t) ; GB_BLOB_READ (Ci_method, int32_t) ;
     GB_BLOB_READ (Cx_nblocks, int32_t) ; GB_BLOB_READ (Cx_method, int32_t) ;
 
+    bool aligned = ((sparsity_iso_csc & GB_BLOB_ALIGNED) != 0) ;
+    bool checksum = ((sparsity_iso_csc & GB_BLOB_CHECKSUM) != 0) ;
+    bool has_delta = ((sparsity_iso_csc & GB_BLOB_DELTA) != 0) ;
+    sparsity_iso_csc = sparsity_iso_csc & (GB_BLOB_ALIGNED - 1) ;
     int32_t sparsity = sparsity_iso_csc / 4 ;
+    zero_copy = zero_copy && aligned ;
     bool iso = ((sparsity_iso_csc & 2) == 2) ;
     bool is_csc = ((sparsity_iso_csc & 1) == 1) ;
 
@@ -134,6 +196,31 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     GB_BLOB_READS (Ci_Sblocks, Ci_nblocks) ;
     GB_BLOB_READS (Cx_Sblocks, Cx_nblocks) ;
 
+    // get the checksums of each array, if present
+    GB_BLOB_READ_CHECKSUMS (Cp_Hblocks,
+        GB_CHECKSUM_COUNT (Cp_len, Cp_nblocks, Cp_method)) ;
+    GB_BLOB_READ_CHECKSUMS (Ch_Hblocks,
+        GB_CHECKSUM_COUNT (Ch_len, Ch_nblocks, Ch_method)) ;
+    GB_BLOB_READ_CHECKSUMS (Cb_Hblocks,
+        GB_CHECKSUM_COUNT (Cb_len, Cb_nblocks, Cb_method)) ;
+    GB_BLOB_READ_CHECKSUMS (Ci_Hblocks,
+        GB_CHECKSUM_COUNT (Ci_len, Ci_nblocks, Ci_method)) ;
+    GB_BLOB_READ_CHECKSUMS (Cx_Hblocks,
+        GB_CHECKSUM_COUNT (Cx_len, Cx_nblocks, Cx_method)) ;
+
+    // get the delta section, if present
+    GB_BLOB_READ_DELTA (Delta) ;
+    if (s > blob_size)
+    { 
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+    if (Delta != NULL && Delta [2] != 0 && !delta)
+    { 
+        // an incremental delta must be applied with GB_deserialize_delta
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
     //--------------------------------------------------------------------------
     // allocate the output matrix C
     //--------------------------------------------------------------------------
@@ -159,41 +246,48 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     // decompress each array (Cp, Ch, Cb, Ci, and Cx)
     //--------------------------------------------------------------------------
 
+    // Each array starts at an aligned offset in the blob, if it is aligned.
+    // Its blocks are checked before they are decompressed, if the blob has
+    // checksums.
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+
+    #define GB_DESERIALIZE_ARRAY(X,CX)                                      \
+    {                                                                       \
+        if (aligned) s = GB_BLOB_ALIGN (s) ;                                \
+        if (checksum)                                                       \
+        {                                                                   \
+            GB_OK (GB_serialize_checksum (CX ## _Hblocks, true, 0,          \
+                CX ## _len, CX ## _len, blob, blob_size, s,                 \
+                CX ## _Sblocks, CX ## _nblocks, CX ## _method,              \
+                nthreads_max)) ;                                            \
+        }                                                                   \
+        GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->X),              \
+            &(C->X ## _size), &(C->X ## _shallow), CX ## _len, blob,        \
+            blob_size, CX ## _Sblocks, CX ## _nblocks, CX ## _method,       \
+            zero_copy, &s)) ;                                               \
+    }
+
     switch (sparsity)
     {
         case GxB_HYPERSPARSE : 
             // decompress Cp, Ch, and Ci
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->p), &(C->p_size),
-                Cp_len, blob, blob_size, Cp_Sblocks, Cp_nblocks, Cp_method,
-                &s)) ;
-
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->h), &(C->h_size),
-                Ch_len, blob, blob_size, Ch_Sblocks, Ch_nblocks, Ch_method,
-                &s)) ;
-
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->i), &(C->i_size),
-                Ci_len, blob, blob_size, Ci_Sblocks, Ci_nblocks, Ci_method,
-                &s)) ;
+            GB_DESERIALIZE_ARRAY (p, Cp) ;
+            GB_DESERIALIZE_ARRAY (h, Ch) ;
+            GB_DESERIALIZE_ARRAY (i, Ci) ;
             break ;
 
         case GxB_SPARSE : 
 
             // decompress Cp and Ci
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->p), &(C->p_size),
-                Cp_len, blob, blob_size, Cp_Sblocks, Cp_nblocks, Cp_method,
-                &s)) ;
-
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->i), &(C->i_size),
-                Ci_len, blob, blob_size, Ci_Sblocks, Ci_nblocks, Ci_method,
-                &s)) ;
+            GB_DESERIALIZE_ARRAY (p, Cp) ;
+            GB_DESERIALIZE_ARRAY (i, Ci) ;
             break ;
 
         case GxB_BITMAP : 
 
             // decompress Cb
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->b), &(C->b_size),
-                Cb_len, blob, blob_size, Cb_Sblocks, Cb_nblocks, Cb_method,
-                &s)) ;
+            GB_DESERIALIZE_ARRAY (b, Cb) ;
             break ;
 
         case GxB_FULL : 
@@ -202,8 +296,7 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     }
 
     // decompress Cx
-    GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->x), &(C->x_size), Cx_len,
-        blob, blob_size, Cx_Sblocks, Cx_nblocks, Cx_method, &s)) ;
+    GB_DESERIALIZE_ARRAY (x, Cx) ;
 
     if (C->p != NULL)
     { 
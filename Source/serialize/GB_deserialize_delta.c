@@ -0,0 +1,141 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_delta: apply a delta blob to a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The blob must have been written by GxB_Matrix_serialize_delta.  If it is a
+// complete snapshot, the content of C is replaced with the matrix in the blob.
+// Otherwise, C must hold the matrix of the base snapshot the delta was
+// computed from: the group hashes of C (see GB_delta_hash) are computed, and
+// their digest must match the digest of the base recorded in the blob.  The
+// vectors of C in each changed group are then replaced with those held in the
+// blob, and the vectors of all other groups are kept.  C keeps its GrB_NAME
+// and its sparsity control.
+
+#include "GB.h"
+#include "jitifyer/GB_jitifyer.h"
+#include "serialize/GB_serialize.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORK (&Hgroups, Hgroups_size) ; \
+    GB_Matrix_free (&D) ;                   \
+    GB_Matrix_free (&T) ;                   \
+}
+
+GrB_Info GB_deserialize_delta       // apply a delta to a matrix
+(
+    // input/output:
+    GrB_Matrix C,                   // matrix to update
+    // input:
+    const GB_void *blob,            // serialized delta
+    size_t blob_size,               // size of the blob
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (blob != NULL) ;
+    ASSERT_MATRIX_OK (C, "C to update with a delta", GB0) ;
+
+    uint64_t *Hgroups = NULL ; size_t Hgroups_size = 0 ;
+    GrB_Matrix D = NULL, T = NULL ;
+
+    const uint64_t *Delta ;
+    int64_t vlen, vdim ;
+    int32_t typecode ;
+    bool is_csc ;
+    GB_OK (GB_delta_get (&Delta, &vlen, &vdim, &typecode, &is_csc, blob,
+        blob_size)) ;
+    if (Delta == NULL)
+    {
+        // the blob was not written by GxB_Matrix_serialize_delta
+        return (GrB_INVALID_VALUE) ;
+    }
+    if (vlen != C->vlen || vdim != C->vdim || is_csc != C->is_csc)
+    {
+        // the blob holds a matrix of a different size or format
+        return (GrB_DIMENSION_MISMATCH) ;
+    }
+
+    int64_t ngroups = (int64_t) Delta [0] ;
+    int64_t gsize = (int64_t) Delta [1] ;
+    uint64_t base_digest = Delta [2] ;
+    const uint64_t *Changed = Delta + 3 + ngroups ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+
+    //--------------------------------------------------------------------------
+    // deserialize the changed vectors
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_deserialize (&D, C->type, blob, blob_size, false, true)) ;
+
+    if (base_digest == 0)
+    {
+
+        //----------------------------------------------------------------------
+        // the blob is a complete snapshot: replace the content of C
+        //----------------------------------------------------------------------
+
+        GBURBLE ("(delta: complete) ") ;
+        GB_OK (GB_transplant_conform (C, C->type, &D, Werk)) ;
+        ASSERT_MATRIX_OK (C, "C from complete delta", GB0) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check that C is the base snapshot of the delta
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_wait (C, "C to update with a delta", Werk)) ;
+    GB_ENSURE_SPARSE (C) ;
+    Hgroups = GB_MALLOC_WORK (ngroups, uint64_t, &Hgroups_size) ;
+    if (Hgroups == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    GB_OK (GB_delta_hash (Hgroups, C, ngroups, gsize, nthreads_max)) ;
+    if (GB_jitifyer_hash (Hgroups, ngroups * sizeof (uint64_t), true)
+        != base_digest)
+    {
+        // C is not the matrix the delta was computed from
+        GB_FREE_ALL ;
+        GB_OK (GB_conform (C, Werk)) ;
+        return (GrB_INVALID_VALUE) ;
+    }
+    GB_FREE_WORK (&Hgroups, Hgroups_size) ;
+
+    //--------------------------------------------------------------------------
+    // replace the changed groups of C with the vectors of D
+    //--------------------------------------------------------------------------
+
+    GB_ENSURE_SPARSE (D) ;
+    if (C->iso != D->iso || (C->iso &&
+        memcmp (C->x, D->x, C->type->size) != 0))
+    {
+        // C and D must both be non-iso, or have the same iso value
+        GB_OK (GB_convert_any_to_non_iso (C, true)) ;
+        GB_OK (GB_convert_any_to_non_iso (D, true)) ;
+    }
+    GB_OK (GB_delta_splice (&T, C, D, Changed, ngroups, gsize,
+        nthreads_max)) ;
+    GB_Matrix_free (&D) ;
+    GB_OK (GB_transplant_conform (C, C->type, &T, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (C, "C updated with a delta", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -13,14 +13,24 @@
 // However, the contents of output array are not fully checked.  This step is
 // done by GB_deserialize, if requested.
 
+// If zero_copy is true and the array is held uncompressed in the blob, X is
+// not allocated.  It is returned as a pointer into the blob instead, and
+// X_shallow is returned as true.
+
+// If the blocks were filtered before they were compressed (see
+// GB_serialize.h), each block is decompressed into workspace W and then
+// unfiltered into X.  With GxB_COMPRESSION_ZSTD_LONG, block 0 is the shared
+// prefix of all other blocks, so it is decompressed first.
+
 #include "GB.h"
 #include "serialize/GB_serialize.h"
 #include "lz4_wrapper/GB_lz4.h"
 #include "zstd_wrapper/GB_zstd.h"
 
-#define GB_FREE_ALL         \
-{                           \
-    GB_FREE (&X, X_size) ;  \
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_FREE (&X, X_size) ;          \
+    GB_FREE_WORK (&W, W_size) ;     \
 }
 
 GrB_Info GB_deserialize_from_blob
@@ -28,6 +38,7 @@ GrB_Info GB_deserialize_from_blob
     // output:
     GB_void **X_handle,         // uncompressed output array
     size_t *X_size_handle,      // size of X as allocated
+    bool *X_shallow_handle,     // true if X points into the blob
     // input:
     int64_t X_len,              // size of X in bytes
     const GB_void *blob,        // serialized blob of size blob_size
@@ -35,6 +46,7 @@ GrB_Info GB_deserialize_from_blob
     int64_t *Sblocks,           // array of size nblocks
     int32_t nblocks,            // # of compressed blocks for this array
     int32_t method,             // compression method used for each block
+    bool zero_copy,             // if true, X may point into the blob
     // input/output:
     size_t *s_handle            // where to read from the blob
 )
@@ -49,8 +61,10 @@ GrB_Info GB_deserialize_from_blob
     ASSERT (s_handle != NULL) ;
     ASSERT (X_handle != NULL) ;
     ASSERT (X_size_handle != NULL) ;
+    ASSERT (X_shallow_handle != NULL) ;
     (*X_handle) = NULL ;
     (*X_size_handle) = 0 ;
+    (*X_shallow_handle) = false ;
 
     //--------------------------------------------------------------------------
     // parse the method
@@ -58,16 +72,53 @@ GrB_Info GB_deserialize_from_blob
 
     int32_t algo, level ;
     GB_serialize_method (&algo, &level, method) ;
+    int32_t filter = GB_FILTER (method) ;
+    int64_t esize = GB_FILTER_ESIZE (filter) ;
+    if (!GB_FILTER_VALID (filter) || X_len % esize != 0 || nblocks < 0 ||
+        (nblocks == 0) != (X_len == 0))
+    { 
+        // blob is invalid; an empty array has no blocks
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // use the uncompressed array in place, if requested
+    //--------------------------------------------------------------------------
+
+    size_t s = (*s_handle) ;
+
+    if (zero_copy && algo == GxB_COMPRESSION_NONE && nblocks == 1 &&
+        (((uintptr_t) (blob + s)) % sizeof (int64_t)) == 0)
+    {
+        if (Sblocks [0] != X_len || s + X_len > blob_size)
+        { 
+            // blob is invalid
+            return (GrB_INVALID_OBJECT) ;
+        }
+        // X is a shallow pointer into the blob
+        (*X_handle) = (GB_void *) (blob + s) ;
+        (*X_size_handle) = X_len ;
+        (*X_shallow_handle) = true ;
+        (*s_handle) = s + X_len ;
+        return (GrB_SUCCESS) ;
+    }
 
     //--------------------------------------------------------------------------
     // allocate the output array
     //--------------------------------------------------------------------------
 
-    size_t X_size = 0 ;
+    size_t X_size = 0, W_size = 0 ;
     GB_void *X = GB_MALLOC (X_len, GB_void, &X_size) ;  // OK
-    if (X == NULL)
+    GB_void *W = NULL ;
+    if (filter != GB_FILTER_NONE)
+    { 
+        // workspace for the filtered blocks
+        W = GB_MALLOC_WORK (X_len, GB_void, &W_size) ;
+    }
+    if (X == NULL || (filter != GB_FILTER_NONE && W == NULL))
     { 
         // out of memory
+        GB_FREE_ALL ;
         return (GrB_OUT_OF_MEMORY) ;
     }
 
@@ -81,7 +132,6 @@ GrB_Info GB_deserialize_from_blob
     // decompress the blocks from the blob
     //--------------------------------------------------------------------------
 
-    size_t s = (*s_handle) ;
     bool ok = true ;
 
     if (algo == GxB_COMPRESSION_NONE)
@@ -91,7 +141,8 @@ GrB_Info GB_deserialize_from_blob
         // no compression; the array is held in a single block
         //----------------------------------------------------------------------
 
-        if (nblocks > 1 || Sblocks [0] != X_len || s + X_len > blob_size)
+        if (nblocks > 1 || (nblocks == 1 && Sblocks [0] != X_len) ||
+            s + X_len > blob_size)
         { 
             // blob is invalid: guard against an unsafe memcpy
             ok = false ;
@@ -111,58 +162,99 @@ GrB_Info GB_deserialize_from_blob
         // LZ4, LZ4HC, or ZSTD compression
         //----------------------------------------------------------------------
 
-        int nthreads = GB_IMIN (nthreads_max, nblocks) ;
-        int32_t blockid ;
-        #pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
-            reduction(&&:ok)
-        for (blockid = 0 ; blockid < nblocks ; blockid++)
-        {
-            // get the start and end of the compressed and uncompressed blocks
+        // With ZSTD_LONG, block 0 is decompressed in a first phase, since
+        // it is the prefix of all other blocks, which are decompressed in a
+        // second phase.  Otherwise, all blocks are done in the second phase.
+        const GB_void *prefix = NULL ;
+        size_t prefix_size = 0 ;
+        bool two_phase = (algo == GxB_COMPRESSION_ZSTD_LONG && nblocks > 1) ;
+        if (two_phase)
+        { 
             int64_t kstart, kend ;
-            GB_PARTITION (kstart, kend, X_len, blockid, nblocks) ;
-            int64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
-            int64_t s_end   = Sblocks [blockid] ;
-            size_t  s_size  = s_end - s_start ;
-            size_t  d_size  = kend - kstart ;
-            // ensure s_start, s_end, kstart, and kend are all valid,
-            // to avoid accessing arrays out of bounds, if input is corrupted.
-            if (kstart < 0 || kend < 0 || s_start < 0 || s_end < 0 ||
-                kstart >= kend || s_start >= s_end || s_size > INT32_MAX ||
-                s + s_start > blob_size || s + s_end > blob_size ||
-                kstart > X_len || kend > X_len || d_size > INT32_MAX)
-            { 
-                // blob is invalid
-                ok = false ;
-            }
-            else
-            { 
-                // uncompress the compressed block of size s_size
-                // from blob [s + s_start:s_end-1] into X [kstart:kend-1].
-                // This is safe and secure so far.  The contents of X are
-                // not yet checked, however.  That step is done in
-                // GB_deserialize, if requested.
-                const char *src = (const char *) (blob + s + s_start) ;
-                char *dst = (char *) (X + kstart) ;
-                if (algo == GxB_COMPRESSION_ZSTD)
+            GB_BLOCK_PARTITION (kstart, kend, X_len, 0, nblocks, esize) ;
+            prefix = (W == NULL) ? X : W ;
+            prefix_size = kend - kstart ;
+        }
+
+        for (int phase = (two_phase ? 0 : 1) ; phase <= 1 && ok ; phase++)
+        {
+            int32_t block_first = (phase == 1 && two_phase) ? 1 : 0 ;
+            int32_t block_last = (phase == 0) ? 0 : (nblocks - 1) ;
+            int nthreads = GB_IMIN (nthreads_max,
+                block_last - block_first + 1) ;
+            int32_t blockid ;
+            #pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+                reduction(&&:ok)
+            for (blockid = block_first ; blockid <= block_last ; blockid++)
+            {
+                // get the start and end of the compressed and uncompressed
+                // blocks
+                int64_t kstart, kend ;
+                GB_BLOCK_PARTITION (kstart, kend, X_len, blockid, nblocks,
+                    esize) ;
+                int64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
+                int64_t s_end   = Sblocks [blockid] ;
+                size_t  s_size  = s_end - s_start ;
+                size_t  d_size  = kend - kstart ;
+                // ensure s_start, s_end, kstart, and kend are all valid, to
+                // avoid accessing arrays out of bounds, if input is corrupted.
+                if (kstart < 0 || kend < 0 || s_start < 0 || s_end < 0 ||
+                    kstart >= kend || s_start >= s_end || s_size > INT32_MAX ||
+                    s + s_start > blob_size || s + s_end > blob_size ||
+                    kstart > X_len || kend > X_len || d_size > INT32_MAX)
                 { 
-                    // ZSTD
-                    size_t u = ZSTD_decompress (dst, d_size, src, s_size) ;
-                    if (u != d_size)
-                    {
-                        // blob is invalid
-                        ok = false ;
-                    }
+                    // blob is invalid
+                    ok = false ;
                 }
                 else
                 { 
-                    // LZ4 or LZ4HC
-                    int src_size = (int) s_size ;
-                    int dst_size = (int) d_size ;
-                    int u = LZ4_decompress_safe (src, dst, src_size, dst_size) ;
-                    if (u != dst_size)
-                    {
-                        // blob is invalid
-                        ok = false ;
+                    // uncompress the compressed block of size s_size
+                    // from blob [s + s_start:s_end-1] into X [kstart:kend-1].
+                    // This is safe and secure so far.  The contents of X are
+                    // not yet checked, however.  That step is done in
+                    // GB_deserialize, if requested.
+                    const char *src = (const char *) (blob + s + s_start) ;
+                    char *dst = (char *) ((W == NULL) ? X : W) + kstart ;
+                    if (algo == GxB_COMPRESSION_ZSTD)
+                    { 
+                        // ZSTD
+                        size_t u = ZSTD_decompress (dst, d_size, src, s_size) ;
+                        if (u != d_size)
+                        {
+                            // blob is invalid
+                            ok = false ;
+                        }
+                    }
+                    else if (algo == GxB_COMPRESSION_ZSTD_LONG)
+                    { 
+                        // ZSTD with long-distance matching and a shared prefix
+                        size_t u = GB_zstd_long_decompress (dst, d_size,
+                            src, s_size, (blockid == 0) ? NULL : prefix,
+                            prefix_size) ;
+                        if (u != d_size)
+                        {
+                            // blob is invalid
+                            ok = false ;
+                        }
+                    }
+                    else
+                    { 
+                        // LZ4 or LZ4HC
+                        int src_size = (int) s_size ;
+                        int dst_size = (int) d_size ;
+                        int u = LZ4_decompress_safe (src, dst, src_size,
+                            dst_size) ;
+                        if (u != dst_size)
+                        {
+                            // blob is invalid
+                            ok = false ;
+                        }
+                    }
+                    if (ok && W != NULL)
+                    { 
+                        // unfilter the block from W into X
+                        GB_deserialize_unfilter (X + kstart, W + kstart, d_size,
+                            filter) ;
                     }
                 }
             }
@@ -175,6 +267,7 @@ GrB_Info GB_deserialize_from_blob
         GB_FREE_ALL ;
         return (GrB_INVALID_OBJECT) ;
     }
+    GB_FREE_WORK (&W, W_size) ;
 
     //--------------------------------------------------------------------------
     // return result: X, its size, and updated index into the blob
@@ -0,0 +1,759 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_range: deserialize a range of vectors from a blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C = A(:,first:last) if by_col is true, or C = A(first:last,:) otherwise,
+// where A is the matrix held in the blob.  If pattern is true, the values of
+// A are not read, and C is returned as an iso-valued GrB_BOOL matrix whose
+// entries are all true.
+
+// Each array of the blob is split into nblocks blocks that evenly partition
+// the uncompressed array (with GB_BLOCK_PARTITION), and Sblocks gives
+// the offset of each compressed block in the blob.  Together these form an
+// index into the blob, so the bytes X [b0:b1-1] of any array can be found in a
+// few blocks, and only those blocks need to be decompressed.  If the range is
+// a set of vectors of A (columns if A is held by column, rows if held by
+// row), only the blocks holding A->p [first:last+1], and the entries of those
+// vectors in A->i and A->x (or A->b and A->x if A is bitmap or full) are
+// decompressed, in parallel.  A hypersparse A also requires A->h in full.
+
+// If the range is not a set of vectors, or if the blob was written by
+// GxB_Matrix_serialize_stream, the whole matrix is deserialized and C is
+// extracted from it.
+
+#include "GB.h"
+#include "get_set/GB_get_set.h"
+#include "serialize/GB_serialize.h"
+#include "extract/GB_extract.h"
+#include "lz4_wrapper/GB_lz4.h"
+#include "zstd_wrapper/GB_zstd.h"
+
+//------------------------------------------------------------------------------
+// GB_decompress_block: decompress a single block
+//------------------------------------------------------------------------------
+
+static inline bool GB_decompress_block
+(
+    GB_void *dst,           // output block of size d_size
+    size_t d_size,
+    const GB_void *src,     // compressed block of size s_size
+    size_t s_size,
+    int32_t algo,           // LZ4, LZ4HC, ZSTD, or ZSTD_LONG
+    const GB_void *prefix,  // shared prefix for ZSTD_LONG, or NULL if none
+    size_t prefix_size
+)
+{
+    if (algo == GxB_COMPRESSION_ZSTD)
+    {
+        // ZSTD
+        size_t u = ZSTD_decompress (dst, d_size, src, s_size) ;
+        return (u == d_size) ;
+    }
+    else if (algo == GxB_COMPRESSION_ZSTD_LONG)
+    {
+        // ZSTD with long-distance matching and a shared prefix
+        size_t u = GB_zstd_long_decompress (dst, d_size, src, s_size,
+            prefix, prefix_size) ;
+        return (u == d_size) ;
+    }
+    else
+    {
+        // LZ4 or LZ4HC
+        int u = LZ4_decompress_safe ((const char *) src, (char *) dst,
+            (int) s_size, (int) d_size) ;
+        return (u == (int) d_size) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize_bytes: decompress X [b0:b1-1] of an array in the blob
+//------------------------------------------------------------------------------
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_FREE_WORK (&W, W_size) ;         \
+}
+
+static GrB_Info GB_deserialize_bytes
+(
+    // output:
+    GB_void *dest,              // X [b0:b1-1] is returned in dest [0:b1-b0-1]
+    // input:
+    int64_t b0,                 // first byte of X to return
+    int64_t b1,                 // one past the last byte of X to return
+    int64_t X_len,              // size of X in bytes
+    const GB_void *blob,        // serialized blob of size blob_size
+    size_t blob_size,
+    size_t s,                   // X is held in the blob starting at blob [s]
+    const int64_t *Sblocks,     // array of size nblocks
+    int32_t nblocks,            // # of compressed blocks for this array
+    int32_t method,             // compression method used for each block
+    int nthreads_max
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_void *W = NULL ; size_t W_size = 0 ;
+    if (b0 >= b1)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+    if (b0 < 0 || b1 > X_len || nblocks <= 0)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    int32_t algo, level ;
+    GB_serialize_method (&algo, &level, method) ;
+    int32_t filter = GB_FILTER (method) ;
+    int64_t esize = GB_FILTER_ESIZE (filter) ;
+    if (!GB_FILTER_VALID (filter) || X_len % esize != 0)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy the bytes from an uncompressed array
+    //--------------------------------------------------------------------------
+
+    if (algo == GxB_COMPRESSION_NONE)
+    {
+        if (nblocks > 1 || Sblocks [0] != X_len || s + X_len > blob_size)
+        {
+            // blob is invalid
+            return (GrB_INVALID_OBJECT) ;
+        }
+        GB_memcpy (dest, blob + s + b0, b1 - b0, nthreads_max) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the blocks blocklo:blockhi that hold X [b0:b1-1]
+    //--------------------------------------------------------------------------
+
+    int32_t blocklo = -1, blockhi = -1, blockid ;
+    int64_t dmax = 0 ;
+    for (blockid = 0 ; blockid < nblocks ; blockid++)
+    {
+        int64_t kstart, kend ;
+        GB_BLOCK_PARTITION (kstart, kend, X_len, blockid, nblocks, esize) ;
+        if (kstart <= b0 && b0 < kend) blocklo = blockid ;
+        if (kstart < b1 && b1 <= kend) blockhi = blockid ;
+        dmax = GB_IMAX (dmax, kend - kstart) ;
+    }
+    if (blocklo < 0 || blockhi < blocklo)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    // workspace for the first and last blocks, which may be partial, for
+    // each filtered block before it is unfiltered, and for the shared prefix
+    // of ZSTD_LONG
+    bool need_prefix = (algo == GxB_COMPRESSION_ZSTD_LONG && blockhi > 0) ;
+    int64_t nw = 2 + ((filter == GB_FILTER_NONE) ? 0 : (blockhi-blocklo+1)) ;
+    W = GB_MALLOC_WORK ((nw + need_prefix) * dmax, GB_void, &W_size) ;
+    if (W == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // decompress the shared prefix, if needed
+    //--------------------------------------------------------------------------
+
+    const GB_void *prefix = NULL ;
+    size_t prefix_size = 0 ;
+    if (need_prefix)
+    {
+        // decompress block 0 (but do not unfilter it) into the workspace
+        int64_t kstart, kend ;
+        GB_BLOCK_PARTITION (kstart, kend, X_len, 0, nblocks, esize) ;
+        int64_t s_end = Sblocks [0] ;
+        prefix_size = kend - kstart ;
+        GB_void *Wprefix = W + nw * dmax ;
+        if (s_end <= 0 || s + s_end > blob_size || prefix_size > INT32_MAX ||
+            !GB_decompress_block (Wprefix, prefix_size, blob + s, s_end, algo,
+            NULL, 0))
+        {
+            // blob is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        prefix = Wprefix ;
+    }
+
+    //--------------------------------------------------------------------------
+    // decompress the blocks in parallel
+    //--------------------------------------------------------------------------
+
+    bool ok = true ;
+    int nthreads = GB_IMIN (nthreads_max, blockhi - blocklo + 1) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+        reduction(&&:ok)
+    for (blockid = blocklo ; blockid <= blockhi ; blockid++)
+    {
+        // get the start and end of the compressed and uncompressed blocks
+        int64_t kstart, kend ;
+        GB_BLOCK_PARTITION (kstart, kend, X_len, blockid, nblocks, esize) ;
+        int64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
+        int64_t s_end   = Sblocks [blockid] ;
+        size_t  s_size  = s_end - s_start ;
+        size_t  d_size  = kend - kstart ;
+        // ensure the block is valid, as in GB_deserialize_from_blob
+        if (kstart < 0 || kend < 0 || s_start < 0 || s_end < 0 ||
+            kstart >= kend || s_start >= s_end || s_size > INT32_MAX ||
+            s + s_start > blob_size || s + s_end > blob_size ||
+            kstart > X_len || kend > X_len || d_size > INT32_MAX)
+        {
+            // blob is invalid
+            ok = false ;
+        }
+        else
+        {
+            // If the whole block is needed, it is decompressed into place.
+            // Otherwise, only part of the block is needed, and it is
+            // decompressed into workspace.  A filtered block is first
+            // decompressed into its own workspace, and then unfiltered.
+            bool whole = (kstart >= b0 && kend <= b1) ;
+            GB_void *Wblock = whole ? (dest + (kstart - b0)) :
+                (W + ((blockid == blocklo) ? 0 : dmax)) ;
+            GB_void *Wfilter = (filter == GB_FILTER_NONE) ? NULL :
+                (W + (2 + blockid - blocklo) * dmax) ;
+            bool block_ok = GB_decompress_block (
+                (Wfilter == NULL) ? Wblock : Wfilter, d_size,
+                blob + s + s_start, s_size, algo,
+                (blockid == 0) ? NULL : prefix, prefix_size) ;
+            if (block_ok && Wfilter != NULL)
+            {
+                GB_deserialize_unfilter (Wblock, Wfilter, d_size, filter) ;
+            }
+            if (block_ok && !whole)
+            {
+                int64_t k0 = GB_IMAX (kstart, b0) ;
+                int64_t k1 = GB_IMIN (kend, b1) ;
+                memcpy (dest + (k0 - b0), Wblock + (k0 - kstart), k1 - k0) ;
+            }
+            ok = ok && block_ok ;
+        }
+    }
+
+    GB_FREE_ALL ;
+    return (ok ? GrB_SUCCESS : GrB_INVALID_OBJECT) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize_range_pattern: discard the values of C
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_deserialize_range_pattern (GrB_Matrix C)
+{
+    GB_FREE (&(C->x), C->x_size) ;
+    C->x = GB_MALLOC (1, bool, &(C->x_size)) ;
+    if (C->x == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    ((bool *) C->x) [0] = true ;
+    C->x_shallow = false ;
+    C->type = GrB_BOOL ;
+    C->iso = true ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize_range
+//------------------------------------------------------------------------------
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORK (&Ah, Ah_size) ;           \
+    GB_Matrix_free (&T) ;                   \
+    GB_Matrix_free (&C) ;                   \
+}
+
+GrB_Info GB_deserialize_range       // deserialize a range of a blob
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the blob
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const GB_void *blob,            // serialized matrix
+    size_t blob_size,               // size of the blob
+    bool by_col,                    // C = A(:,first:last) if true,
+                                    // C = A(first:last,:) if false
+    int64_t first,                  // first row or column of the range
+    int64_t last,                   // last row or column of the range
+    bool pattern,                   // if true, do not read the values
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (blob != NULL && Chandle != NULL) ;
+    ASSERT (first <= last) ;
+    (*Chandle) = NULL ;
+    GrB_Matrix C = NULL, T = NULL ;
+    int64_t *Ah = NULL ; size_t Ah_size = 0 ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+
+    //--------------------------------------------------------------------------
+    // read the content of the header (160 bytes)
+    //--------------------------------------------------------------------------
+
+    size_t s = 0 ;
+
+    if (blob_size < GB_BLOB_HEADER_SIZE)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    GB_BLOB_READ (blob_size2, uint64_t) ;
+    GB_BLOB_READ (typecode, int32_t) ;
+    uint64_t blob_size1 = (uint64_t) blob_size ;
+    bool streamed = (blob_size2 == 0) ;
+
+    if ((!streamed && blob_size1 != blob_size2)
+        || typecode < GB_BOOL_code || typecode > GB_UDT_code
+        || (typecode == GB_UDT_code &&
+            blob_size < GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN))
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    GB_BLOB_READ (version, int32_t) ;
+    GB_BLOB_READ (vlen, int64_t) ;
+    GB_BLOB_READ (vdim, int64_t) ;
+    GB_BLOB_READ (nvec, int64_t) ;
+    GB_BLOB_READ (nvec_nonempty, int64_t) ;
+    GB_BLOB_READ (nvals, int64_t) ;
+    GB_BLOB_READ (typesize, int64_t) ;
+    GB_BLOB_READ (Cp_len, int64_t) ;
+    GB_BLOB_READ (Ch_len, int64_t) ;
+    GB_BLOB_READ (Cb_len, int64_t) ;
+    GB_BLOB_READ (Ci_len, int64_t) ;
+    GB_BLOB_READ (Cx_len, int64_t) ;
+    GB_BLOB_READ (hyper_switch, float) ;
+    GB_BLOB_READ (bitmap_switch, float) ;
+    GB_BLOB_READ (sparsity_control, int32_t) ;
+    GB_BLOB_READ (sparsity_iso_csc, int32_t) ;
+    GB_BLOB_READ (Cp_nblocks, int32_t) ; GB_BLOB_READ (Cp_method, int32_t) ;
+    GB_BLOB_READ (Ch_nblocks, int32_t) ; GB_BLOB_READ (Ch_method, int32_t) ;
+    GB_BLOB_READ (Cb_nblocks, int32_t) ; GB_BLOB_READ (Cb_method, int32_t) ;
+    GB_BLOB_READ (Ci_nblocks, int32_t) ; GB_BLOB_READ (Ci_method, int32_t) ;
+    GB_BLOB_READ (Cx_nblocks, int32_t) ; GB_BLOB_READ (Cx_method, int32_t) ;
+
+    bool aligned = ((sparsity_iso_csc & GB_BLOB_ALIGNED) != 0) ;
+    bool checksum = ((sparsity_iso_csc & GB_BLOB_CHECKSUM) != 0) ;
+    bool has_delta = ((sparsity_iso_csc & GB_BLOB_DELTA) != 0) ;
+    sparsity_iso_csc = sparsity_iso_csc & (GB_BLOB_ALIGNED - 1) ;
+    int32_t sparsity = sparsity_iso_csc / 4 ;
+    bool iso = ((sparsity_iso_csc & 2) == 2) ;
+    bool is_csc = ((sparsity_iso_csc & 1) == 1) ;
+
+    //--------------------------------------------------------------------------
+    // check the range
+    //--------------------------------------------------------------------------
+
+    int64_t nrows = (is_csc) ? vlen : vdim ;
+    int64_t ncols = (is_csc) ? vdim : vlen ;
+    if (first < 0 || last >= ((by_col) ? ncols : nrows))
+    {
+        // the range is out of bounds
+        return (GrB_INDEX_OUT_OF_BOUNDS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // extract C from the whole matrix, if the range is not a set of vectors
+    //--------------------------------------------------------------------------
+
+    if (streamed || by_col != is_csc)
+    {
+        GBURBLE ("(deserialize range: all) ") ;
+        GB_OK (GB_deserialize (&T, type_expected, blob, blob_size, false,
+            false)) ;
+        GrB_Index range [2] = { first, last } ;
+        GrB_Index cnrows = (by_col) ? nrows : (last - first + 1) ;
+        GrB_Index cncols = (by_col) ? (last - first + 1) : ncols ;
+        GB_OK (GB_new (&C, // sparse or hyper, new header
+            T->type, (is_csc) ? cnrows : cncols, (is_csc) ? cncols : cnrows,
+            GB_Ap_calloc, is_csc, GxB_SPARSE + GxB_HYPERSPARSE,
+            GB_Global_hyper_switch_get ( ), 1)) ;
+        if (by_col)
+        {
+            // C = T (:,first:last)
+            GB_OK (GB_extract (C, false, NULL, false, false, NULL, T, false,
+                GrB_ALL, cnrows, range, GxB_RANGE, Werk)) ;
+        }
+        else
+        {
+            // C = T (first:last,:)
+            GB_OK (GB_extract (C, false, NULL, false, false, NULL, T, false,
+                range, GxB_RANGE, GrB_ALL, cncols, Werk)) ;
+        }
+        if (T->user_name != NULL)
+        { 
+            GB_OK (GB_matvec_name_set (C, T->user_name, GrB_NAME)) ;
+        }
+        GB_Matrix_free (&T) ;
+        GB_OK (GB_wait (C, "C range", Werk)) ;
+        if (pattern)
+        {
+            GB_OK (GB_deserialize_range_pattern (C)) ;
+        }
+        (*Chandle) = C ;
+        ASSERT_MATRIX_OK (*Chandle, "C from deserialize range", GB0) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the matrix type
+    //--------------------------------------------------------------------------
+
+    GB_Type_code ccode = (GB_Type_code) typecode ;
+    GrB_Type ctype = GB_code_type (ccode, type_expected) ;
+
+    // ensure the type has the right size
+    if (ctype == NULL || ctype->size != typesize)
+    {
+        // blob is invalid; type is missing or the wrong size
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    if (ccode == GB_UDT_code)
+    {
+        // ensure the user-defined type has the right name
+        ASSERT (ctype == type_expected) ;
+        if (strncmp ((const char *) (blob + s), ctype->name,
+            GxB_MAX_NAME_LEN) != 0)
+        {
+            // blob is invalid
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+        s += GxB_MAX_NAME_LEN ;
+    }
+    else if (type_expected != NULL && ctype != type_expected)
+    {
+        // built-in type must match type_expected
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the compressed block sizes and the location of each array
+    //--------------------------------------------------------------------------
+
+    if (s + (Cp_nblocks + Ch_nblocks + Cb_nblocks + Ci_nblocks + Cx_nblocks)
+        * sizeof (int64_t) > blob_size)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    GB_BLOB_READS (Cp_Sblocks, Cp_nblocks) ;
+    GB_BLOB_READS (Ch_Sblocks, Ch_nblocks) ;
+    GB_BLOB_READS (Cb_Sblocks, Cb_nblocks) ;
+    GB_BLOB_READS (Ci_Sblocks, Ci_nblocks) ;
+    GB_BLOB_READS (Cx_Sblocks, Cx_nblocks) ;
+
+    // get the checksums of each array, if present
+    GB_BLOB_READ_CHECKSUMS (Cp_Hblocks,
+        GB_CHECKSUM_COUNT (Cp_len, Cp_nblocks, Cp_method)) ;
+    GB_BLOB_READ_CHECKSUMS (Ch_Hblocks,
+        GB_CHECKSUM_COUNT (Ch_len, Ch_nblocks, Ch_method)) ;
+    GB_BLOB_READ_CHECKSUMS (Cb_Hblocks,
+        GB_CHECKSUM_COUNT (Cb_len, Cb_nblocks, Cb_method)) ;
+    GB_BLOB_READ_CHECKSUMS (Ci_Hblocks,
+        GB_CHECKSUM_COUNT (Ci_len, Ci_nblocks, Ci_method)) ;
+    GB_BLOB_READ_CHECKSUMS (Cx_Hblocks,
+        GB_CHECKSUM_COUNT (Cx_len, Cx_nblocks, Cx_method)) ;
+
+    // get the delta section, if present
+    GB_BLOB_READ_DELTA (Delta) ;
+    if (s > blob_size || (Delta != NULL && Delta [2] != 0))
+    {
+        // blob is invalid, or is an incremental delta
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    // Each array starts at an aligned offset in the blob, if it is aligned.
+    #define GB_BLOB_LOCATE(CX)                                              \
+        if (aligned) s = GB_BLOB_ALIGN (s) ;                                \
+        size_t CX ## _s = s ;                                               \
+        s += (CX ## _nblocks > 0) ? CX ## _Sblocks [CX ## _nblocks-1] : 0 ;
+
+    GB_BLOB_LOCATE (Cp) ;
+    GB_BLOB_LOCATE (Ch) ;
+    GB_BLOB_LOCATE (Cb) ;
+    GB_BLOB_LOCATE (Ci) ;
+    GB_BLOB_LOCATE (Cx) ;
+
+    // decompress X [b0:b1-1] of the array CX into dest, after checking the
+    // blocks that hold it, if the blob has checksums
+    #define GB_DESERIALIZE_BYTES(dest,b0,b1,CX)                             \
+    {                                                                       \
+        if (checksum)                                                       \
+        {                                                                   \
+            GB_OK (GB_serialize_checksum (CX ## _Hblocks, true, b0, b1,     \
+                CX ## _len, blob, blob_size, CX ## _s, CX ## _Sblocks,      \
+                CX ## _nblocks, CX ## _method, nthreads_max)) ;             \
+        }                                                                   \
+        GB_OK (GB_deserialize_bytes ((GB_void *) (dest), b0, b1,            \
+            CX ## _len, blob, blob_size, CX ## _s, CX ## _Sblocks,          \
+            CX ## _nblocks, CX ## _method, nthreads_max)) ;                 \
+    }
+
+    //--------------------------------------------------------------------------
+    // find the vectors kfirst:klast-1 of A that hold the range first:last
+    //--------------------------------------------------------------------------
+
+    bool is_sparse = (sparsity == GxB_SPARSE || sparsity == GxB_HYPERSPARSE) ;
+    int64_t kfirst = first ;
+    int64_t klast = last + 1 ;
+    if (is_sparse && Cp_len != (int64_t) sizeof (int64_t) * (nvec + 1))
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    if (sparsity == GxB_HYPERSPARSE)
+    {
+        // decompress all of Ah, and search it for the range
+        if (Ch_len != (int64_t) sizeof (int64_t) * nvec)
+        {
+            // blob is invalid
+            return (GrB_INVALID_OBJECT)  ;
+        }
+        Ah = GB_MALLOC_WORK (nvec, int64_t, &Ah_size) ;
+        if (Ah == NULL)
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        GB_DESERIALIZE_BYTES (Ah, 0, Ch_len, Ch) ;
+        int64_t pleft, pright ;
+        bool found ;
+        pleft = 0 ; pright = nvec-1 ;
+        GB_SPLIT_BINARY_SEARCH (first, Ah, pleft, pright, found) ;
+        kfirst = pleft ;
+        pleft = 0 ; pright = nvec-1 ;
+        GB_SPLIT_BINARY_SEARCH (last+1, Ah, pleft, pright, found) ;
+        klast = pleft ;
+    }
+    else if (sparsity == GxB_SPARSE && klast > nvec)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    int64_t nk = last - first + 1 ;                 // # of vectors of C
+    int64_t cnvec = GB_IMAX (klast - kfirst, 0) ;   // # of vectors in C->h
+
+    //--------------------------------------------------------------------------
+    // allocate the output matrix C
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new (&C,  // new header (C is NULL on input)
+        ctype, vlen, nk, GB_Ap_null, is_csc,
+        sparsity, hyper_switch, cnvec)) ;
+
+    C->nvec = (sparsity == GxB_HYPERSPARSE) ? cnvec : nk ;
+    C->bitmap_switch = bitmap_switch ;
+    C->sparsity_control = sparsity_control ;
+    C->iso = iso ;
+
+    //--------------------------------------------------------------------------
+    // decompress the parts of each array needed for C
+    //--------------------------------------------------------------------------
+
+    int64_t cnz ;
+    if (is_sparse)
+    {
+
+        //----------------------------------------------------------------------
+        // C is sparse or hypersparse
+        //----------------------------------------------------------------------
+
+        // Cp = Ap [kfirst:klast] - Ap [kfirst].  C->plen is set by GB_new,
+        // and can exceed cnvec if C is hypersparse (if cnvec is zero and C
+        // has a single vector, for example).
+        ASSERT (C->plen >= cnvec) ;
+        C->p = GB_MALLOC (C->plen+1, int64_t, &(C->p_size)) ;
+        if (C->p == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        int64_t *restrict Cp = C->p ;
+        GB_DESERIALIZE_BYTES (Cp, kfirst * sizeof (int64_t),
+            (klast + 1) * sizeof (int64_t), Cp) ;
+        int64_t pstart = Cp [0] ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads_max) schedule(static)
+        for (k = 0 ; k <= cnvec ; k++)
+        {
+            Cp [k] -= pstart ;
+        }
+        cnz = Cp [cnvec] ;
+
+        if (sparsity == GxB_HYPERSPARSE)
+        {
+            // Ch = Ah [kfirst:klast-1] - first
+            C->h = GB_MALLOC (C->plen, int64_t, &(C->h_size)) ;
+            if (C->h == NULL)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            int64_t *restrict Ch = C->h ;
+            #pragma omp parallel for num_threads(nthreads_max) schedule(static)
+            for (k = 0 ; k < cnvec ; k++)
+            {
+                Ch [k] = Ah [kfirst + k] - first ;
+            }
+        }
+
+        // Ci = Ai [pstart:pstart+cnz-1]
+        if (pstart < 0 || cnz < 0 ||
+            (pstart + cnz) > Ci_len / (int64_t) sizeof (int64_t))
+        {
+            // blob is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        C->i = GB_MALLOC (cnz, int64_t, &(C->i_size)) ;
+        if (C->i == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        GB_DESERIALIZE_BYTES (C->i, pstart * sizeof (int64_t),
+            (pstart + cnz) * sizeof (int64_t), Ci) ;
+
+        // Cx = Ax [pstart:pstart+cnz-1], or Ax [0] if iso
+        if (!pattern)
+        {
+            int64_t xstart = (iso) ? 0 : pstart ;
+            int64_t xn = (iso) ? 1 : cnz ;
+            C->x = GB_MALLOC (xn * typesize, GB_void, &(C->x_size)) ;
+            if (C->x == NULL)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            GB_DESERIALIZE_BYTES (C->x, xstart * typesize,
+                (xstart + xn) * typesize, Cx) ;
+        }
+        C->nvals = cnz ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // C is bitmap or full
+        //----------------------------------------------------------------------
+
+        // C holds vectors first:last of A, each of length vlen
+        int64_t pstart = first * vlen ;
+        cnz = nk * vlen ;
+
+        if (sparsity == GxB_BITMAP)
+        {
+            // Cb = Ab [pstart:pstart+cnz-1]
+            C->b = GB_MALLOC (cnz, int8_t, &(C->b_size)) ;
+            if (C->b == NULL)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            GB_DESERIALIZE_BYTES (C->b, pstart, pstart + cnz, Cb) ;
+            // count the entries in the bitmap
+            const int8_t *restrict Cb = C->b ;
+            int64_t p, cnvals = 0 ;
+            #pragma omp parallel for num_threads(nthreads_max) \
+                schedule(static) reduction(+:cnvals)
+            for (p = 0 ; p < cnz ; p++)
+            {
+                cnvals += Cb [p] ;
+            }
+            C->nvals = cnvals ;
+        }
+        else
+        {
+            C->nvals = cnz ;
+        }
+
+        // Cx = Ax [pstart:pstart+cnz-1], or Ax [0] if iso
+        if (!pattern)
+        {
+            int64_t xstart = (iso) ? 0 : pstart ;
+            int64_t xn = (iso) ? 1 : cnz ;
+            C->x = GB_MALLOC (xn * typesize, GB_void, &(C->x_size)) ;
+            if (C->x == NULL)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            GB_DESERIALIZE_BYTES (C->x, xstart * typesize,
+                (xstart + xn) * typesize, Cx) ;
+        }
+    }
+
+    GB_FREE_WORK (&Ah, Ah_size) ;
+    C->magic = GB_MAGIC ;
+    C->nvec_nonempty = GB_nvec_nonempty (C) ;
+
+    //--------------------------------------------------------------------------
+    // discard the values, if requested
+    //--------------------------------------------------------------------------
+
+    if (pattern)
+    {
+        GB_OK (GB_deserialize_range_pattern (C)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the GrB_NAME
+    //--------------------------------------------------------------------------
+
+    if (version >= GxB_VERSION (8,1,0) && s < blob_size &&
+        memchr (blob + s, 0, blob_size - s) != NULL)
+    {
+        GB_OK (GB_matvec_name_set (C, (char *) (blob + s), GrB_NAME)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*Chandle) = C ;
+    ASSERT_MATRIX_OK (*Chandle, "Final result from deserialize range", GB0) ;
+    return (GrB_SUCCESS) ;
+}
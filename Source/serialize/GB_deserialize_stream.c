@@ -0,0 +1,540 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_stream: decompress and deserialize a stream into a GrB_Matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A streamed blob (see GB_serialize.h) is read in pieces by the user-provided
+// read_func.  The block records of each array are read in batches of up to
+// GB_STREAM_CHUNK compressed bytes, and the blocks of each batch are then
+// decompressed in parallel, directly into the arrays of C.  Uncompressed
+// blocks are read directly into C, with no intermediate buffer.  Filtered
+// blocks (see GB_serialize.h) are decompressed into workspace, and then
+// unfiltered into C.  A batch also holds at most GB_STREAM_CHUNK uncompressed
+// bytes, which bounds the size of this workspace.  As in
+// GB_deserialize_from_blob, every block is checked so that a mangled stream
+// cannot cause any out-of-bounds access.  If the stream holds checksums, each
+// block is checked before it is decompressed.
+
+#include "GB.h"
+#include "get_set/GB_get_set.h"
+#include "jitifyer/GB_jitifyer.h"
+#include "serialize/GB_serialize.h"
+#include "lz4_wrapper/GB_lz4.h"
+#include "zstd_wrapper/GB_zstd.h"
+
+typedef struct
+{
+    int64_t k ;             // the block is X [k:k+d_size-1]
+    int64_t d_size ;        // uncompressed size of the block
+    int64_t s_size ;        // compressed size of the block
+    int64_t s_offset ;      // compressed block is Buf [s_offset:...]
+    uint64_t hash ;         // checksum of the compressed block, if present
+    int32_t algo ;          // compression algorithm used for the block
+    int32_t filter ;        // filter used for the block
+}
+GB_stream_block ;
+
+// read exactly size bytes from the stream
+#define GB_STREAM_READ(buffer,size)                                 \
+{                                                                   \
+    if ((size) > 0 && !read_func (handle, buffer, size))            \
+    {                                                               \
+        /* the stream is truncated, or the user function failed */  \
+        GB_FREE_ALL ;                                               \
+        return (GrB_INVALID_OBJECT) ;                               \
+    }                                                               \
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize_stream_array: read and decompress one array from the stream
+//------------------------------------------------------------------------------
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE (&X, X_size) ;                      \
+    GB_FREE_WORK (&Buf, Buf_size) ;             \
+    GB_FREE_WORK (&W, W_size) ;                 \
+    GB_FREE_WORK (&Rec, Rec_size) ;             \
+}
+
+static GrB_Info GB_deserialize_stream_array
+(
+    // output:
+    GB_void **X_handle,         // uncompressed output array
+    size_t *X_size_handle,      // size of X as allocated
+    // input:
+    int64_t X_len,              // size of X in bytes
+    bool checksum,              // if true, each record has a checksum
+    GxB_read_function read_func,
+    void *handle
+)
+{
+
+    //--------------------------------------------------------------------------
+    // allocate the output array and workspace
+    //--------------------------------------------------------------------------
+
+    GB_void *Buf = NULL ; size_t Buf_size = 0 ;
+    GB_void *W = NULL ; size_t W_size = 0 ;
+    GB_stream_block *Rec = NULL ; size_t Rec_size = 0 ;
+    size_t X_size = 0 ;
+    GB_void *X = GB_MALLOC (X_len, GB_void, &X_size) ;  // OK
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    int nrec_max = 4 * nthreads_max ;
+    Rec = GB_MALLOC_WORK (nrec_max, GB_stream_block, &Rec_size) ;
+    if (X == NULL || Rec == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read and decompress the blocks of X, one batch at a time
+    //--------------------------------------------------------------------------
+
+    int64_t k = 0 ;
+    while (k < X_len)
+    {
+
+        //----------------------------------------------------------------------
+        // read a batch of block records
+        //----------------------------------------------------------------------
+
+        int nrec = 0 ;
+        int64_t buf_used = 0 ;
+        int64_t kbatch = k ;
+        bool filtered = false ;
+        while (k < X_len && nrec < nrec_max && buf_used < GB_STREAM_CHUNK
+            && k - kbatch < GB_STREAM_CHUNK)
+        {
+            int64_t record [3] ;
+            GB_STREAM_READ (record, GB_STREAM_RECORD_SIZE) ;
+            int64_t d_size = record [0] ;
+            int64_t s_size = record [1] ;
+            int32_t algo, level ;
+            GB_serialize_method (&algo, &level, (int32_t) record [2]) ;
+            int32_t filter = GB_FILTER ((int32_t) record [2]) ;
+            if (d_size <= 0 || d_size > X_len - k || d_size > INT32_MAX ||
+                s_size <= 0 || record [2] < GxB_COMPRESSION_NONE ||
+                record [2] > INT32_MAX || !GB_FILTER_VALID (filter) ||
+                d_size % GB_FILTER_ESIZE (filter) != 0)
+            {
+                // stream is invalid
+                GB_FREE_ALL ;
+                return (GrB_INVALID_OBJECT) ;
+            }
+            uint64_t hash = 0 ;
+            if (checksum)
+            { 
+                GB_STREAM_READ (&hash, GB_STREAM_CHECKSUM_SIZE) ;
+            }
+
+            if (algo == GxB_COMPRESSION_NONE)
+            {
+                // read an uncompressed block directly into X
+                if (s_size != d_size)
+                {
+                    // stream is invalid
+                    GB_FREE_ALL ;
+                    return (GrB_INVALID_OBJECT) ;
+                }
+                GB_STREAM_READ (X + k, d_size) ;
+                if (checksum && GB_jitifyer_hash (X + k, d_size, true) != hash)
+                {
+                    // checksum mismatch; stream is invalid
+                    GB_FREE_ALL ;
+                    return (GrB_INVALID_OBJECT) ;
+                }
+            }
+            else
+            {
+                // read a compressed block into the batch buffer
+                int64_t s_max = (algo == GxB_COMPRESSION_ZSTD) ?
+                    (int64_t) ZSTD_compressBound (d_size) :
+                    (int64_t) LZ4_compressBound ((int) d_size) ;
+                if (s_size > s_max)
+                {
+                    // stream is invalid
+                    GB_FREE_ALL ;
+                    return (GrB_INVALID_OBJECT) ;
+                }
+                if (buf_used + s_size > (int64_t) Buf_size)
+                {
+                    bool ok ;
+                    int64_t nnew = GB_IMAX (buf_used + s_size,
+                        GB_IMIN (GB_STREAM_CHUNK, X_len) + s_max) ;
+                    GB_REALLOC_WORK (Buf, nnew, GB_void, &Buf_size, &ok) ;
+                    if (!ok)
+                    {
+                        // out of memory
+                        GB_FREE_ALL ;
+                        return (GrB_OUT_OF_MEMORY) ;
+                    }
+                }
+                GB_STREAM_READ (Buf + buf_used, s_size) ;
+                Rec [nrec].k = k ;
+                Rec [nrec].d_size = d_size ;
+                Rec [nrec].s_size = s_size ;
+                Rec [nrec].s_offset = buf_used ;
+                Rec [nrec].algo = algo ;
+                Rec [nrec].filter = filter ;
+                Rec [nrec].hash = hash ;
+                filtered = filtered || (filter != GB_FILTER_NONE) ;
+                buf_used += s_size ;
+                nrec++ ;
+            }
+            k += d_size ;
+        }
+
+        //----------------------------------------------------------------------
+        // allocate workspace for the filtered blocks of the batch
+        //----------------------------------------------------------------------
+
+        bool ok = true ;
+        if (filtered && k - kbatch > (int64_t) W_size)
+        {
+            GB_FREE_WORK (&W, W_size) ;
+            W = GB_MALLOC_WORK (GB_IMAX (k - kbatch,
+                GB_IMIN (GB_STREAM_CHUNK, X_len)), GB_void, &W_size) ;
+            if (W == NULL)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // decompress the batch in parallel
+        //----------------------------------------------------------------------
+
+        int nthreads = GB_IMIN (nthreads_max, nrec) ;
+        int r ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+            reduction(&&:ok)
+        for (r = 0 ; r < nrec ; r++)
+        {
+            const char *src = (const char *) (Buf + Rec [r].s_offset) ;
+            int32_t filter = Rec [r].filter ;
+            GB_void *Wblock = (W == NULL) ? NULL :
+                (W + (Rec [r].k - kbatch)) ;
+            char *dst = (char *) ((filter == GB_FILTER_NONE) ?
+                (X + Rec [r].k) : Wblock) ;
+            size_t s_size = Rec [r].s_size ;
+            size_t d_size = Rec [r].d_size ;
+            if (checksum)
+            { 
+                // check the compressed block before decompressing it
+                ok = ok && (GB_jitifyer_hash (src, s_size, true) ==
+                    Rec [r].hash) ;
+            }
+            if (!ok)
+            { 
+                // skip the block; the stream is invalid
+            }
+            else if (Rec [r].algo == GxB_COMPRESSION_ZSTD)
+            {
+                // ZSTD
+                size_t u = ZSTD_decompress (dst, d_size, src, s_size) ;
+                ok = ok && (u == d_size) ;
+            }
+            else
+            {
+                // LZ4 or LZ4HC
+                int u = LZ4_decompress_safe (src, dst, (int) s_size,
+                    (int) d_size) ;
+                ok = ok && (u == (int) d_size) ;
+            }
+            if (ok && filter != GB_FILTER_NONE)
+            {
+                // unfilter the block from W into X
+                GB_deserialize_unfilter (X + Rec [r].k, Wblock, d_size,
+                    filter) ;
+            }
+        }
+
+        if (!ok)
+        {
+            // decompression failure; stream is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK (&Buf, Buf_size) ;
+    GB_FREE_WORK (&W, W_size) ;
+    GB_FREE_WORK (&Rec, Rec_size) ;
+    (*X_handle) = X ;
+    (*X_size_handle) = X_size ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize_stream_string: read a nul-terminated string from the stream
+//------------------------------------------------------------------------------
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORK (&S, S_size) ;                 \
+}
+
+static GrB_Info GB_deserialize_stream_string
+(
+    // output:
+    char **S_handle,            // the string, allocated on output
+    size_t *S_size_handle,      // size of S as allocated
+    // input:
+    GxB_read_function read_func,
+    void *handle
+)
+{
+
+    size_t S_size = 0 ;
+    char *S = GB_MALLOC_WORK (GxB_MAX_NAME_LEN, char, &S_size) ;
+    if (S == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    size_t len = 0 ;
+    while (true)
+    {
+        if (len == S_size)
+        {
+            bool ok ;
+            GB_REALLOC_WORK (S, 2 * S_size, char, &S_size, &ok) ;
+            if (!ok)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+        }
+        GB_STREAM_READ (S + len, 1) ;
+        if (S [len++] == '\0') break ;
+    }
+
+    (*S_handle) = S ;
+    (*S_size_handle) = S_size ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize_stream
+//------------------------------------------------------------------------------
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORK (&S, S_size) ;                 \
+    GB_Matrix_free (&C) ;                       \
+}
+
+GrB_Info GB_deserialize_stream      // deserialize a matrix from a stream
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the stream
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    GxB_read_function read_func,    // user function to read the stream
+    void *handle                    // user handle passed to read_func
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (read_func != NULL && Chandle != NULL) ;
+    (*Chandle) = NULL ;
+    GrB_Matrix C = NULL ;
+    char *S = NULL ; size_t S_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // read the content of the header (160 bytes)
+    //--------------------------------------------------------------------------
+
+    GB_void blob [GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN] ;
+    GB_STREAM_READ (blob, GB_BLOB_HEADER_SIZE) ;
+    size_t s = 0 ;
+
+    GB_BLOB_READ (blob_size, uint64_t) ;
+    GB_BLOB_READ (typecode, int32_t) ;
+    if (blob_size != 0 || typecode < GB_BOOL_code || typecode > GB_UDT_code)
+    {
+        // stream is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    GB_BLOB_READ (version, int32_t) ;
+    GB_BLOB_READ (vlen, int64_t) ;
+    GB_BLOB_READ (vdim, int64_t) ;
+    GB_BLOB_READ (nvec, int64_t) ;
+    GB_BLOB_READ (nvec_nonempty, int64_t) ;
+    GB_BLOB_READ (nvals, int64_t) ;
+    GB_BLOB_READ (typesize, int64_t) ;
+    GB_BLOB_READ (Cp_len, int64_t) ;
+    GB_BLOB_READ (Ch_len, int64_t) ;
+    GB_BLOB_READ (Cb_len, int64_t) ;
+    GB_BLOB_READ (Ci_len, int64_t) ;
+    GB_BLOB_READ (Cx_len, int64_t) ;
+    GB_BLOB_READ (hyper_switch, float) ;
+    GB_BLOB_READ (bitmap_switch, float) ;
+    GB_BLOB_READ (sparsity_control, int32_t) ;
+    GB_BLOB_READ (sparsity_iso_csc, int32_t) ;
+    // A[phbix]_nblocks and A[phbix]_method are not used
+
+    bool checksum = ((sparsity_iso_csc & GB_BLOB_CHECKSUM) != 0) ;
+    if ((sparsity_iso_csc & GB_BLOB_DELTA) != 0)
+    { 
+        // a stream never holds a delta section
+        return (GrB_INVALID_OBJECT)  ;
+    }
+    sparsity_iso_csc = sparsity_iso_csc & (GB_BLOB_ALIGNED - 1) ;
+    int32_t sparsity = sparsity_iso_csc / 4 ;
+    bool iso = ((sparsity_iso_csc & 2) == 2) ;
+    bool is_csc = ((sparsity_iso_csc & 1) == 1) ;
+
+    if (nvec < 0 || Cp_len < 0 || Ch_len < 0 || Cb_len < 0 || Ci_len < 0
+        || Cx_len < 0)
+    {
+        // stream is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the matrix type
+    //--------------------------------------------------------------------------
+
+    GB_Type_code ccode = (GB_Type_code) typecode ;
+    GrB_Type ctype = GB_code_type (ccode, type_expected) ;
+
+    // ensure the type has the right size
+    if (ctype == NULL || ctype->size != typesize)
+    {
+        // stream is invalid; type is missing or the wrong size
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    if (ccode == GB_UDT_code)
+    {
+        // user-defined name is 128 bytes, if present
+        // ensure the user-defined type has the right name
+        ASSERT (ctype == type_expected) ;
+        GB_STREAM_READ (blob + s, GxB_MAX_NAME_LEN) ;
+        if (strncmp ((const char *) (blob + s), ctype->name,
+            GxB_MAX_NAME_LEN) != 0)
+        {
+            // stream is invalid
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+    }
+    else if (type_expected != NULL && ctype != type_expected)
+    {
+        // built-in type must match type_expected
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the output matrix C
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new (&C,  // new header (C is NULL on input)
+        ctype, vlen, vdim, GB_Ap_null, is_csc,
+        sparsity, hyper_switch, nvec)) ;
+
+    C->nvec = nvec ;
+    C->nvec_nonempty = nvec_nonempty ;
+    C->nvals = nvals ;      // revised below
+    C->bitmap_switch = bitmap_switch ;
+    C->sparsity_control = sparsity_control ;
+    C->iso = iso ;
+
+    //--------------------------------------------------------------------------
+    // read and decompress each array (Cp, Ch, Cb, Ci, and Cx)
+    //--------------------------------------------------------------------------
+
+    #define GB_DESERIALIZE_STREAM_ARRAY(X,CX)                               \
+    {                                                                       \
+        GB_OK (GB_deserialize_stream_array ((GB_void **) &(C->X),           \
+            &(C->X ## _size), CX ## _len, checksum, read_func, handle)) ;   \
+    }
+
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+            // read Cp, Ch, and Ci
+            GB_DESERIALIZE_STREAM_ARRAY (p, Cp) ;
+            GB_DESERIALIZE_STREAM_ARRAY (h, Ch) ;
+            GB_DESERIALIZE_STREAM_ARRAY (i, Ci) ;
+            break ;
+
+        case GxB_SPARSE :
+            // read Cp and Ci
+            GB_DESERIALIZE_STREAM_ARRAY (p, Cp) ;
+            GB_DESERIALIZE_STREAM_ARRAY (i, Ci) ;
+            break ;
+
+        case GxB_BITMAP :
+            // read Cb
+            GB_DESERIALIZE_STREAM_ARRAY (b, Cb) ;
+            break ;
+
+        case GxB_FULL :
+            break ;
+        default: ;
+    }
+
+    // read Cx
+    GB_DESERIALIZE_STREAM_ARRAY (x, Cx) ;
+
+    if (C->p != NULL)
+    {
+        // C is sparse or hypersparse
+        if (Cp_len != (int64_t) sizeof (int64_t) * (nvec+1))
+        {
+            // stream is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        C->nvals = C->p [C->nvec] ;
+    }
+    C->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // read the GrB_NAME and GrB_EL_TYPE_STRING
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_deserialize_stream_string (&S, &S_size, read_func, handle)) ;
+    if (S [0] != '\0')
+    {
+        GB_OK (GB_matvec_name_set (C, S, GrB_NAME)) ;
+    }
+    GB_FREE_WORK (&S, S_size) ;
+
+    // GrB_EL_TYPE_STRING not needed, but it must be read from the stream
+    GB_OK (GB_deserialize_stream_string (&S, &S_size, read_func, handle)) ;
+    GB_FREE_WORK (&S, S_size) ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*Chandle) = C ;
+    ASSERT_MATRIX_OK (*Chandle, "Final result from deserialize stream", GB0) ;
+    return (GrB_SUCCESS) ;
+}
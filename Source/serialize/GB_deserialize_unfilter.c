@@ -0,0 +1,76 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_unfilter: undo the filter of a decompressed block
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The inverse of GB_serialize_filter: src [0:len-1] holds a block that was
+// filtered by GB_serialize_filter, and dst [0:len-1] is returned as the
+// original block.  Any contents of src are safe, since the filters are
+// bijections on blocks of len bytes.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+void GB_deserialize_unfilter
+(
+    GB_void *dst,               // unfiltered block of size len
+    const GB_void *src,         // filtered block of size len
+    int64_t len,                // size of the block, in bytes
+    int32_t filter              // filter to undo
+)
+{
+
+    int64_t esize = GB_FILTER_ESIZE (filter) ;
+    int64_t n = len / esize ;
+    ASSERT (n * esize == len) ;
+
+    if (filter == GB_FILTER_DELTA)
+    {
+
+        //----------------------------------------------------------------------
+        // byte unshuffle, then undo the zigzag and delta encoding
+        //----------------------------------------------------------------------
+
+        uint64_t prev = 0 ;
+        for (int64_t i = 0 ; i < n ; i++)
+        { 
+            uint64_t z = 0 ;
+            for (int k = 0 ; k < 8 ; k++)
+            { 
+                z |= ((uint64_t) src [k*n + i]) << (8*k) ;
+            }
+            uint64_t d = (z >> 1) ^ (0 - (z & 1)) ;
+            prev += d ;
+            memcpy (dst + i * sizeof (uint64_t), &prev, sizeof (uint64_t)) ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // byte unshuffle
+        //----------------------------------------------------------------------
+
+        #define GB_UNSHUFFLE(esize)                                 \
+        {                                                           \
+            for (int64_t i = 0 ; i < n ; i++)                       \
+            {                                                       \
+                for (int k = 0 ; k < esize ; k++)                   \
+                {                                                   \
+                    dst [i*esize + k] = src [k*n + i] ;             \
+                }                                                   \
+            }                                                       \
+        }
+        switch (esize)
+        {
+            case 2  : GB_UNSHUFFLE (2) ; break ;
+            case 4  : GB_UNSHUFFLE (4) ; break ;
+            default : GB_UNSHUFFLE (8) ; break ;
+        }
+    }
+}
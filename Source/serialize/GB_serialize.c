@@ -51,6 +51,8 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     // input:
     const GrB_Matrix A,             // matrix to serialize
     int32_t method,                 // method to use
+    const uint64_t *Delta,          // delta section to add to the blob, if
+                                    // not NULL (see GB_serialize_delta)
     GB_Werk Werk
 )
 {
@@ -128,14 +130,19 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     //--------------------------------------------------------------------------
 
     int32_t algo, level ;
+    bool checksum = (method > GxB_COMPRESSION_CHECKSUM / 2) ;
+    if (checksum) method -= GxB_COMPRESSION_CHECKSUM ;
+    bool filter = (GB_FILTER (method) != GB_FILTER_NONE) ;
     GB_serialize_method (&algo, &level, method) ;
     method = algo + level ;
-    GBURBLE ("(compression: %s%s%s%s:%d) ",
+    filter = filter && (algo != GxB_COMPRESSION_NONE) ;
+    GBURBLE ("(compression: %s%s%s%s%s:%d%s%s) ",
         (algo == GxB_COMPRESSION_NONE ) ? "none" : "",
         (algo == GxB_COMPRESSION_LZ4  ) ? "LZ4" : "",
         (algo == GxB_COMPRESSION_LZ4HC) ? "LZ4HC" : "",
         (algo == GxB_COMPRESSION_ZSTD ) ? "ZSTD" : "",
-        level) ;
+        (algo == GxB_COMPRESSION_ZSTD_LONG) ? "ZSTD_LONG" : "",
+        level, filter ? " filtered" : "", checksum ? " checksum" : "") ;
 
     //--------------------------------------------------------------------------
     // get the content of the matrix
@@ -194,17 +201,26 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     // For the dryrun case, this just computes A[phbix]_compressed_size as an
     // upper bound on each array size when compressed, and A[phbix]_nblocks.
 
+    // If filters are requested, the index arrays (Ap, Ah, and Ai) are delta
+    // encoded and the values (Ax) are byte shuffled.  Ab is not filtered.
+    int32_t index_method = method, value_method = method ;
+    if (filter)
+    { 
+        index_method += GB_FILTER_DELTA * GxB_COMPRESSION_FILTER ;
+        value_method += GB_FILTER_VALUES (typesize) * GxB_COMPRESSION_FILTER ;
+    }
+
     int32_t Ap_method, Ah_method, Ab_method, Ai_method, Ax_method ;
 
     GB_OK (GB_serialize_array (&Ap_Blocks, &Ap_Blocks_size,
         &Ap_Sblocks, &Ap_Sblocks_size, &Ap_nblocks, &Ap_method,
         &Ap_compressed_size, dryrun,
-        (GB_void *) A->p, Ap_len, method, algo, level, Werk)) ;
+        (GB_void *) A->p, Ap_len, index_method, algo, level, Werk)) ;
 
     GB_OK (GB_serialize_array (&Ah_Blocks, &Ah_Blocks_size,
         &Ah_Sblocks, &Ah_Sblocks_size, &Ah_nblocks, &Ah_method,
         &Ah_compressed_size, dryrun,
-        (GB_void *) A->h, Ah_len, method, algo, level, Werk)) ;
+        (GB_void *) A->h, Ah_len, index_method, algo, level, Werk)) ;
 
     GB_OK (GB_serialize_array (&Ab_Blocks, &Ab_Blocks_size,
         &Ab_Sblocks, &Ab_Sblocks_size, &Ab_nblocks, &Ab_method,
@@ -214,17 +230,27 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     GB_OK (GB_serialize_array (&Ai_Blocks, &Ai_Blocks_size,
         &Ai_Sblocks, &Ai_Sblocks_size, &Ai_nblocks, &Ai_method,
         &Ai_compressed_size, dryrun,
-        (GB_void *) A->i, Ai_len, method, algo, level, Werk)) ;
+        (GB_void *) A->i, Ai_len, index_method, algo, level, Werk)) ;
 
     GB_OK (GB_serialize_array (&Ax_Blocks, &Ax_Blocks_size,
         &Ax_Sblocks, &Ax_Sblocks_size, &Ax_nblocks, &Ax_method,
         &Ax_compressed_size, dryrun,
-        (GB_void *) A->x, Ax_len, method, algo, level, Werk)) ;
+        (GB_void *) A->x, Ax_len, value_method, algo, level, Werk)) ;
 
     //--------------------------------------------------------------------------
     // determine the size of the blob
     //--------------------------------------------------------------------------
 
+    int64_t Ap_nchecksums = GB_CHECKSUM_COUNT (Ap_len, Ap_nblocks, Ap_method) ;
+    int64_t Ah_nchecksums = GB_CHECKSUM_COUNT (Ah_len, Ah_nblocks, Ah_method) ;
+    int64_t Ab_nchecksums = GB_CHECKSUM_COUNT (Ab_len, Ab_nblocks, Ab_method) ;
+    int64_t Ai_nchecksums = GB_CHECKSUM_COUNT (Ai_len, Ai_nblocks, Ai_method) ;
+    int64_t Ax_nchecksums = GB_CHECKSUM_COUNT (Ax_len, Ax_nblocks, Ax_method) ;
+    int64_t nchecksums = (!checksum) ? 0 : (Ap_nchecksums + Ah_nchecksums
+        + Ab_nchecksums + Ai_nchecksums + Ax_nchecksums) ;
+    size_t delta_size = (Delta == NULL) ? 0 :
+        GB_DELTA_SIZE ((int64_t) Delta [0]) ;
+
     size_t s =
         // header information
         GB_BLOB_HEADER_SIZE
@@ -234,14 +260,25 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
         + Ab_nblocks * sizeof (int64_t)     // Ab_Sblocks [1:Ab_nblocks]
         + Ai_nblocks * sizeof (int64_t)     // Ai_Sblocks [1:Ai_nblocks]
         + Ax_nblocks * sizeof (int64_t)     // Ax_Sblocks [1:Ax_nblocks]
+        // checksums for each array, if requested
+        + nchecksums * sizeof (uint64_t)
+        // delta section, if present
+        + delta_size
         // type_name for user-defined types
         + ((typecode == GB_UDT_code) ? GxB_MAX_NAME_LEN : 0) ;
 
-    // size of compressed arrays Ap, Ah, Ab, Ai, and Ax in the blob
+    // size of compressed arrays Ap, Ah, Ab, Ai, and Ax in the blob.  If the
+    // blob is not compressed, each array starts at an aligned offset.
+    bool aligned = (algo == GxB_COMPRESSION_NONE) ;
+    if (aligned) s = GB_BLOB_ALIGN (s) ;
     s += Ap_compressed_size ;
+    if (aligned) s = GB_BLOB_ALIGN (s) ;
     s += Ah_compressed_size ;
+    if (aligned) s = GB_BLOB_ALIGN (s) ;
     s += Ab_compressed_size ;
+    if (aligned) s = GB_BLOB_ALIGN (s) ;
     s += Ai_compressed_size ;
+    if (aligned) s = GB_BLOB_ALIGN (s) ;
     s += Ax_compressed_size ;
 
     // size of the GrB_NAME and GrB_EL_TYPE_STRING, including one nul byte each
@@ -305,7 +342,9 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
 
     s = 0 ;
     int32_t sparsity_iso_csc = (4 * sparsity) + (iso ? 2 : 0) +
-        (A->is_csc ? 1 : 0) ;
+        (A->is_csc ? 1 : 0) + (aligned ? GB_BLOB_ALIGNED : 0) +
+        (checksum ? GB_BLOB_CHECKSUM : 0) +
+        ((Delta != NULL) ? GB_BLOB_DELTA : 0) ;
 
     // size_t is 32 bits if GraphBLAS is compiled in ILP32 mode,
     // so write a 64-bit blob size, regardless of the size of size_t
@@ -360,17 +399,68 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     GB_BLOB_WRITES (Ai_Sblocks, Ai_nblocks) ;
     GB_BLOB_WRITES (Ax_Sblocks, Ax_nblocks) ;
 
+    // 8 * (# checksums for Ap, Ah, Ab, Ai, Ax), computed below
+    uint64_t *Hblocks = (uint64_t *) (blob + s) ;
+    s += nchecksums * sizeof (uint64_t) ;
+
+    // delta section, if present
+    if (delta_size > 0)
+    { 
+        memcpy (blob + s, Delta, delta_size) ;
+        s += delta_size ;
+    }
+
+    // zero padding before each array, if the blob is aligned
+    #define GB_BLOB_PAD                                 \
+    if (aligned)                                        \
+    {                                                   \
+        size_t s_aligned = GB_BLOB_ALIGN (s) ;          \
+        memset (blob + s, 0, s_aligned - s) ;           \
+        s = s_aligned ;                                 \
+    }
+
+    GB_BLOB_PAD ;
+    size_t Ap_s = s ;
     GB_serialize_to_blob (blob, &s, Ap_Blocks, Ap_Sblocks+1, Ap_nblocks,
         nthreads_max) ;
+    GB_BLOB_PAD ;
+    size_t Ah_s = s ;
     GB_serialize_to_blob (blob, &s, Ah_Blocks, Ah_Sblocks+1, Ah_nblocks,
         nthreads_max) ;
+    GB_BLOB_PAD ;
+    size_t Ab_s = s ;
     GB_serialize_to_blob (blob, &s, Ab_Blocks, Ab_Sblocks+1, Ab_nblocks,
         nthreads_max) ;
+    GB_BLOB_PAD ;
+    size_t Ai_s = s ;
     GB_serialize_to_blob (blob, &s, Ai_Blocks, Ai_Sblocks+1, Ai_nblocks,
         nthreads_max) ;
+    GB_BLOB_PAD ;
+    size_t Ax_s = s ;
     GB_serialize_to_blob (blob, &s, Ax_Blocks, Ax_Sblocks+1, Ax_nblocks,
         nthreads_max) ;
 
+    //--------------------------------------------------------------------------
+    // compute the checksums of each array, if requested
+    //--------------------------------------------------------------------------
+
+    #define GB_BLOB_CHECKSUMS(X)                                            \
+    {                                                                       \
+        GB_OK (GB_serialize_checksum (Hblocks, false, 0, 0, X ## _len,      \
+            blob, blob_size_required, X ## _s, X ## _Sblocks + 1,           \
+            X ## _nblocks, X ## _method, nthreads_max)) ;                   \
+        Hblocks += X ## _nchecksums ;                                       \
+    }
+
+    if (checksum)
+    { 
+        GB_BLOB_CHECKSUMS (Ap) ;
+        GB_BLOB_CHECKSUMS (Ah) ;
+        GB_BLOB_CHECKSUMS (Ab) ;
+        GB_BLOB_CHECKSUMS (Ai) ;
+        GB_BLOB_CHECKSUMS (Ax) ;
+    }
+
     //--------------------------------------------------------------------------
     // append the GrB_NAME and GrB_EL_TYPE_STRING to the blob
     //--------------------------------------------------------------------------
@@ -18,6 +18,8 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     // input:
     const GrB_Matrix A,             // matrix to serialize
     int32_t method,                 // method to use
+    const uint64_t *Delta,          // delta section to add to the blob, if
+                                    // not NULL (see GB_serialize_delta)
     GB_Werk Werk
 ) ;
 
@@ -37,9 +39,126 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     // input:
     GrB_Type type_expected,         // type expected (NULL for any built-in)
     const GB_void *blob,            // serialized matrix 
+    size_t blob_size,               // size of the blob
+    bool zero_copy,                 // if true, C may point into the blob
+    bool delta                      // if true, the blob may hold an
+                                    // incremental delta
+) ;
+
+GrB_Info GB_serialize_delta         // serialize the changes to a matrix
+(
+    // output:
+    GB_void **blob_handle,          // serialized delta, allocated on output
+    size_t *blob_size_handle,       // size of the blob
+    // input:
+    const GrB_Matrix A,             // matrix to serialize
+    const GB_void *base,            // blob of a prior snapshot of A, or NULL
+    size_t base_size,               // size of the base blob
+    int32_t method,                 // method to use
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_deserialize_delta       // apply a delta to a matrix
+(
+    // input/output:
+    GrB_Matrix C,                   // matrix to update
+    // input:
+    const GB_void *blob,            // serialized delta
+    size_t blob_size,               // size of the blob
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_delta_get               // get the delta section of a blob
+(
+    // output:
+    const uint64_t **Delta_handle,  // delta section, or NULL if not present
+    int64_t *vlen,                  // vector length of the matrix in the blob
+    int64_t *vdim,                  // # of vectors of the matrix in the blob
+    int32_t *typecode,              // type code of the matrix in the blob
+    bool *is_csc,                   // format of the matrix in the blob
+    // input:
+    const GB_void *blob,            // serialized matrix
     size_t blob_size                // size of the blob
 ) ;
 
+GrB_Info GB_delta_hash              // hash each group of vectors of A
+(
+    // output:
+    uint64_t *Hgroups,              // array of size ngroups
+    // input:
+    const GrB_Matrix A,             // sparse or hypersparse matrix
+    int64_t ngroups,                // # of groups
+    int64_t gsize,                  // # of vectors in each group
+    int nthreads_max
+) ;
+
+GrB_Info GB_delta_splice            // splice groups of vectors of A and B
+(
+    // output:
+    GrB_Matrix *Chandle,            // new hypersparse matrix
+    // input:
+    const GrB_Matrix A,             // unchanged groups, or NULL if none
+    const GrB_Matrix B,             // changed groups
+    const uint64_t *Changed,        // bitmap of changed groups
+    int64_t ngroups,                // # of groups
+    int64_t gsize,                  // # of vectors in each group
+    int nthreads_max
+) ;
+
+GrB_Info GB_serialize_stream        // serialize a matrix to a stream
+(
+    // input:
+    GxB_write_function write_func,  // user function to write the stream
+    void *handle,                   // user handle passed to write_func
+    const GrB_Matrix A,             // matrix to serialize
+    int32_t method,                 // method to use
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_deserialize_stream      // deserialize a matrix from a stream
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the stream
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    GxB_read_function read_func,    // user function to read the stream
+    void *handle                    // user handle passed to read_func
+) ;
+
+GrB_Info GB_deserialize_range       // deserialize a range of a blob
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the blob
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const GB_void *blob,            // serialized matrix
+    size_t blob_size,               // size of the blob
+    bool by_col,                    // C = A(:,first:last) if true,
+                                    // C = A(first:last,:) if false
+    int64_t first,                  // first row or column of the range
+    int64_t last,                   // last row or column of the range
+    bool pattern,                   // if true, do not read the values
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_serialize_checksum
+(
+    // input/output:
+    uint64_t *Hblocks,          // checksums of the array
+    // input:
+    bool check,                 // if true, check Hblocks; else compute it
+    int64_t b0,                 // first byte of X to check
+    int64_t b1,                 // one past the last byte of X to check
+    int64_t X_len,              // size of X in bytes, when uncompressed
+    const GB_void *blob,        // serialized blob of size blob_size
+    size_t blob_size,
+    size_t s,                   // X is held in the blob starting at blob [s]
+    const int64_t *Sblocks,     // array of size nblocks
+    int32_t nblocks,            // # of compressed blocks for this array
+    int32_t method,             // compression method used for each block
+    int nthreads_max
+) ;
+
 typedef struct
 {
     void *p ;                   // pointer to the compressed block
@@ -92,6 +211,7 @@ GrB_Info GB_deserialize_from_blob
     // output:
     GB_void **X_handle,         // uncompressed output array
     size_t *X_size_handle,      // size of X as allocated
+    bool *X_shallow_handle,     // true if X points into the blob
     // input:
     int64_t X_len,              // size of X in bytes
     const GB_void *blob,        // serialized blob of size blob_size
@@ -99,6 +219,7 @@ GrB_Info GB_deserialize_from_blob
     int64_t *Sblocks,           // array of size nblocks
     int32_t nblocks,            // # of compressed blocks for this array
     int32_t method_used,        // compression method used for each block
+    bool zero_copy,             // if true, X may point into the blob
     // input/output:
     size_t *s_handle            // where to read from the blob
 ) ;
@@ -112,6 +233,158 @@ GrB_Info GB_deserialize_from_blob
                                 /* sparsity_iso_csc                     */  \
     + 2 * sizeof (float)        /* hyper_switch, bitmap_switch          */
 
+// If all arrays in the blob are uncompressed (GxB_COMPRESSION_NONE), each of
+// the Ap, Ah, Ab, Ai, and Ax arrays starts at an offset in the blob that is a
+// multiple of GB_BLOB_ALIGNMENT, with zero padding in between.  This is
+// flagged in the sparsity_iso_csc field of the header.  A blob held in a
+// memory-mapped file can then be used in place by GxB_Matrix_deserialize_mmap,
+// without copying any array.  Blobs written prior to v9.5.0 are not aligned.
+
+#define GB_BLOB_ALIGNED 0x100
+#define GB_BLOB_ALIGNMENT 64
+#define GB_BLOB_ALIGN(s) \
+    ((((s) + GB_BLOB_ALIGNMENT - 1) / GB_BLOB_ALIGNMENT) * GB_BLOB_ALIGNMENT)
+
+// If GxB_COMPRESSION_CHECKSUM is added to the method, the blob holds an XXH3
+// checksum of each compressed block, and each reader checks the blocks it
+// uses before decompressing them.  This is flagged in the sparsity_iso_csc
+// field of the header.  The checksums of each array follow all of the Sblocks
+// tables, one table per array (Ap, Ah, Ab, Ai, and Ax), with one checksum per
+// compressed block.  An uncompressed array has one checksum for each piece of
+// at most GB_SERIALIZE_BLOCKSIZE_MAX bytes, so its checksums can also be
+// computed and checked in parallel, and a part of it can be checked on its own.
+
+#define GB_BLOB_CHECKSUM 0x200
+#define GB_CHECKSUM_COUNT(X_len,nblocks,method)                             \
+    (((method) < 0) ? GB_ICEIL (X_len, GB_SERIALIZE_BLOCKSIZE_MAX) : (nblocks))
+
+// A blob written by GxB_Matrix_serialize_delta has a delta section, which
+// follows the checksums (if any), and is flagged in the sparsity_iso_csc field
+// of the header.  The vectors of the matrix A (columns if held by column, rows
+// if held by row) are partitioned into ngroups groups of gsize vectors each.
+// The delta section is an array of uint64_t values: ngroups, gsize, the digest
+// of the group hashes of the base snapshot (zero if the blob is a complete
+// snapshot), the hash Hgroups [0:ngroups-1] of the content of each group of A,
+// and a bitmap Changed of the groups that differ from the base snapshot.  The
+// blob itself holds only the vectors of A in the changed groups.  The hash of
+// a group does not depend on the sparsity format of A, or whether or not it is
+// iso-valued, so a delta can be computed from the Hgroups of the base blob
+// alone, and checked against the matrix it is applied to.
+
+#define GB_BLOB_DELTA 0x400
+#define GB_DELTA_GROUP_MIN 64
+#define GB_DELTA_NGROUPS_MAX (64 * 1024)
+#define GB_DELTA_GSIZE(vdim) \
+    GB_IMAX (GB_DELTA_GROUP_MIN, GB_ICEIL (vdim, GB_DELTA_NGROUPS_MAX))
+#define GB_DELTA_NWORDS(ngroups) GB_ICEIL (ngroups, 64)
+#define GB_DELTA_SIZE(ngroups) \
+    ((3 + (ngroups) + GB_DELTA_NWORDS (ngroups)) * sizeof (uint64_t))
+#define GB_DELTA_CHANGED(Changed,g) \
+    (((Changed) [(g) / 64] >> ((g) % 64)) & 1)
+
+// first vector k of a sparse or hypersparse matrix with Ah [k] >= j
+static inline int64_t GB_delta_vector
+(
+    const int64_t *restrict Ah,     // A->h, or NULL if A is sparse
+    int64_t nvec,
+    int64_t j
+)
+{
+    if (Ah == NULL) return (GB_IMIN (j, nvec)) ;
+    int64_t pleft = 0, pright = nvec - 1 ;
+    bool found ;
+    GB_SPLIT_BINARY_SEARCH (j, Ah, pleft, pright, found) ;
+    return (pleft) ;
+}
+
+// A streamed blob (GxB_Matrix_serialize_stream) has the same header as a
+// blob, except that its blob_size is zero and all of its A[phbix]_nblocks are
+// zero.  The header (and the type name of a user-defined type) is followed by
+// each of the Ap, Ah, Ab, Ai, and Ax arrays as a sequence of block records.
+// Each record is three int64_t values (the uncompressed size of the block,
+// its compressed size, and the compression method used), followed by the
+// compressed block itself.  If the header is flagged with GB_BLOB_CHECKSUM,
+// each record also has a fourth int64_t value, the XXH3 checksum of the
+// compressed block.  The records of an array end when their
+// uncompressed sizes sum to the A[phbix]_len of the array.  The GrB_NAME and
+// GrB_EL_TYPE_STRING follow, as for a blob.  The writer compresses each array
+// in chunks of at most GB_STREAM_CHUNK bytes, so the blocks of only one chunk
+// are held in memory at any one time.
+
+#define GB_STREAM_CHUNK (16 * 1024 * 1024)
+#define GB_STREAM_RECORD_SIZE (3 * sizeof (int64_t))
+#define GB_STREAM_CHECKSUM_SIZE (sizeof (uint64_t))
+
+// Each array is compressed in blocks of at most GB_SERIALIZE_BLOCKSIZE_MAX
+// bytes, regardless of the number of threads used, so that a part of any
+// array can be decompressed on its own.  Each block of an array of len bytes
+// is X [kstart:kend-1], given by GB_BLOCK_PARTITION (kstart, kend, len,
+// blockid, nblocks, esize), where esize is 1 unless the array is filtered
+// (see below).  The blocks of each array are listed in its Sblocks, so these
+// form an index into the blob (see GB_deserialize_range).
+
+#define GB_SERIALIZE_BLOCKSIZE_MAX (4 * 1024 * 1024)
+
+// With GxB_COMPRESSION_ZSTD_LONG, the first block of an array of at least
+// GB_ZSTD_LONG_MIN bytes is a shared prefix for all of its other blocks (see
+// GB_zstd_long_compress), so block 0 must be decompressed (but not
+// unfiltered) before any other block of the array.  Smaller arrays are
+// compressed with GxB_COMPRESSION_ZSTD, and their method records that.
+
+#define GB_ZSTD_LONG_MIN (1024 * 1024)
+
+// If GxB_COMPRESSION_FILTER is added to the method, each compressed block is
+// filtered before it is compressed.  The filter used for an array is recorded
+// in its method, as GB_FILTER (method) * GxB_COMPRESSION_FILTER plus the
+// algorithm and level.  A filter of GB_FILTER_DELTA treats the block as an
+// int64_t array, replaces each entry with its difference from the prior entry
+// in the block (zigzag encoded so that small negative differences are small),
+// and then shuffles the bytes.  A filter of 2, 4, or 8 just shuffles the
+// bytes of the block, as an array of elements of that size: the first byte of
+// each element, then all of the second bytes, and so on.  The blocks of a
+// filtered array hold a whole number of elements, so each block can still be
+// decompressed and unfiltered on its own.
+
+#define GB_FILTER_NONE  0
+#define GB_FILTER_DELTA 1
+#define GB_FILTER(method) \
+    (((method) < 0) ? GB_FILTER_NONE : ((method) / GxB_COMPRESSION_FILTER))
+#define GB_FILTER_ESIZE(filter) \
+    (((filter) == GB_FILTER_DELTA) ? 8 : GB_IMAX (filter, 1))
+#define GB_FILTER_VALID(filter) \
+    ((filter) == GB_FILTER_NONE || (filter) == GB_FILTER_DELTA || \
+     (filter) == 2 || (filter) == 4 || (filter) == 8)
+
+// filter used for Ax, for a type of size typesize
+#define GB_FILTER_VALUES(typesize)                                          \
+    (((typesize) % 8 == 0) ? 8 :                                            \
+     ((typesize) % 4 == 0) ? 4 :                                            \
+     ((typesize) % 2 == 0) ? 2 : GB_FILTER_NONE)
+
+// block blockid of an array of len bytes, with elements of size esize
+#define GB_BLOCK_PARTITION(kstart,kend,len,blockid,nblocks,esize)           \
+{                                                                           \
+    GB_PARTITION (kstart, kend, (len) / (esize), blockid, nblocks) ;        \
+    kstart *= (esize) ;                                                     \
+    kend   *= (esize) ;                                                     \
+}
+
+void GB_serialize_filter
+(
+    GB_void *dst,               // filtered block of size len
+    const GB_void *src,         // block to filter, of size len
+    int64_t len,                // size of the block, in bytes
+    int32_t filter              // filter to apply
+) ;
+
+void GB_deserialize_unfilter
+(
+    GB_void *dst,               // unfiltered block of size len
+    const GB_void *src,         // filtered block of size len
+    int64_t len,                // size of the block, in bytes
+    int32_t filter              // filter to undo
+) ;
+
 // write a scalar to the blob
 #define GB_BLOB_WRITE(x,type)                                               \
     memcpy (blob + s, &(x), sizeof (type)) ;                                \
@@ -136,5 +409,27 @@ GrB_Info GB_deserialize_from_blob
     int64_t *S = (int64_t *) (blob + s) ;                                   \
     s += n * sizeof (int64_t) ;
 
+// get a uint64_t pointer to the checksums of an array in the blob, if present
+#define GB_BLOB_READ_CHECKSUMS(H,n)                                         \
+    uint64_t *H = NULL ;                                                    \
+    if (checksum)                                                           \
+    {                                                                       \
+        H = (uint64_t *) (blob + s) ;                                       \
+        s += (n) * sizeof (uint64_t) ;                                      \
+    }
+
+// get a uint64_t pointer to the delta section of the blob, if present.  If the
+// section is invalid, s is set past the end of the blob.
+#define GB_BLOB_READ_DELTA(D)                                               \
+    const uint64_t *D = NULL ;                                              \
+    if (has_delta)                                                          \
+    {                                                                       \
+        D = (const uint64_t *) (blob + s) ;                                 \
+        uint64_t D_ngroups = (s + GB_DELTA_SIZE (0) <= blob_size) ?        \
+            D [0] : UINT64_MAX ;                                            \
+        s = (D_ngroups > GB_DELTA_NGROUPS_MAX) ? (blob_size + 1) :          \
+            (s + GB_DELTA_SIZE ((int64_t) D_ngroups)) ;                     \
+    }
+
 #endif
 
@@ -9,7 +9,11 @@
 
 // Parallel compression method for an array.  The array is compressed into
 // a sequence of independently allocated blocks, or returned as-is if not
-// compressed.  Currently, only LZ4, LZ4HC, and ZSTD are supported.
+// compressed.  Currently, only LZ4, LZ4HC, and ZSTD are supported.  If the
+// method includes a filter (see GB_serialize.h), each block is filtered and
+// then compressed, and the blocks are aligned with the elements of the array.
+// With GxB_COMPRESSION_ZSTD_LONG, the first (filtered) block of the array is
+// a shared prefix for all other blocks (see GB_zstd_long_compress).
 
 #include "GB.h"
 #include "serialize/GB_serialize.h"
@@ -114,7 +118,17 @@ GrB_Info GB_serialize_array
         return (GrB_SUCCESS) ;
     }
 
+    if (algo == GxB_COMPRESSION_ZSTD_LONG && len < GB_ZSTD_LONG_MIN)
+    { 
+        // the array is too small to benefit from a shared prefix
+        algo = GxB_COMPRESSION_ZSTD ;
+        method = method - GxB_COMPRESSION_ZSTD_LONG + GxB_COMPRESSION_ZSTD ;
+    }
+
     (*method_used) = method ;
+    int32_t filter = GB_FILTER (method) ;
+    int64_t esize = GB_FILTER_ESIZE (filter) ;
+    ASSERT (GB_FILTER_VALID (filter) && len % esize == 0) ;
 
     //--------------------------------------------------------------------------
     // determine # of threads to use
@@ -136,6 +150,10 @@ GrB_Info GB_serialize_array
     ASSERT (LZ4_MAX_INPUT_SIZE < INT32_MAX) ;
     blocksize = GB_IMIN (blocksize, LZ4_MAX_INPUT_SIZE/2) ;
 
+    // limit the blocksize so that a range of the array can be decompressed
+    // without decompressing the whole array (see GB_deserialize_range)
+    blocksize = GB_IMIN (blocksize, GB_SERIALIZE_BLOCKSIZE_MAX) ;
+
     // ensure the blocksize is not too small
     blocksize = GB_IMAX (blocksize, (64*1024)) ;
 
@@ -164,7 +182,7 @@ GrB_Info GB_serialize_array
     { 
         // allocate a single block for the compression of X [kstart:kend-1]
         int64_t kstart, kend ;
-        GB_PARTITION (kstart, kend, len, blockid, nblocks) ;
+        GB_BLOCK_PARTITION (kstart, kend, len, blockid, nblocks, esize) ;
         size_t uncompressed = kend - kstart ;
         ASSERT (uncompressed < INT32_MAX) ;
         ASSERT (uncompressed > 0) ;
@@ -178,6 +196,7 @@ GrB_Info GB_serialize_array
                 break ;
             default :
             case GxB_COMPRESSION_ZSTD : 
+            case GxB_COMPRESSION_ZSTD_LONG : 
                 s = ZSTD_compressBound (uncompressed) ;
                 break ;
         }
@@ -190,8 +209,10 @@ GrB_Info GB_serialize_array
         }
         else
         { 
-            // allocate the block
+            // allocate the block, with space for the filtered block after
+            // the compressed block, if the array is filtered
             size_t size_allocated = 0 ;
+            if (filter != GB_FILTER_NONE) s += uncompressed ;
             GB_void *p = GB_MALLOC (s, GB_void, &size_allocated) ;
             ok = (p != NULL) ;
             Blocks [blockid].p = p ;
@@ -215,6 +236,30 @@ GrB_Info GB_serialize_array
         return (GrB_OUT_OF_MEMORY) ;
     }
 
+    //--------------------------------------------------------------------------
+    // get the shared prefix for ZSTD_LONG
+    //--------------------------------------------------------------------------
+
+    const GB_void *prefix = NULL ;
+    size_t prefix_size = 0 ;
+    if (algo == GxB_COMPRESSION_ZSTD_LONG && nblocks > 1)
+    {
+        // the prefix is block 0, after it is filtered
+        int64_t kstart, kend ;
+        GB_BLOCK_PARTITION (kstart, kend, len, 0, nblocks, esize) ;
+        prefix_size = kend - kstart ;
+        prefix = X ;
+        if (filter != GB_FILTER_NONE)
+        { 
+            // filter block 0 now, into the end of its block, since all other
+            // blocks depend on it
+            GB_void *filtered = ((GB_void *) Blocks [0].p) +
+                (Blocks [0].p_size_allocated - prefix_size) ;
+            GB_serialize_filter (filtered, X, prefix_size, filter) ;
+            prefix = filtered ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // compress the blocks in parallel
     //--------------------------------------------------------------------------
@@ -225,11 +270,24 @@ GrB_Info GB_serialize_array
     {
         // compress X [kstart:kend-1] into Blocks [blockid].p
         int64_t kstart, kend ;
-        GB_PARTITION (kstart, kend, len, blockid, nblocks) ;
+        GB_BLOCK_PARTITION (kstart, kend, len, blockid, nblocks, esize) ;
         const char *src = (const char *) (X + kstart) ;     // source
         char *dst = (char *) Blocks [blockid].p ;           // destination
         int srcSize = (int) (kend - kstart) ;               // size of source
         size_t dsize = Blocks [blockid].p_size_allocated ;  // size of dest
+        if (filter != GB_FILTER_NONE)
+        { 
+            // filter X [kstart:kend-1] into the end of the block, and
+            // compress it from there
+            dsize -= srcSize ;
+            GB_void *filtered = ((GB_void *) dst) + dsize ;
+            if (blockid > 0 || prefix == NULL)
+            { 
+                // block 0 is already filtered if it is the shared prefix
+                GB_serialize_filter (filtered, X + kstart, srcSize, filter) ;
+            }
+            src = (const char *) filtered ;
+        }
         int dstCapacity = (int) GB_IMIN (dsize, INT32_MAX) ;
         int s ;
         size_t s64 ;
@@ -257,6 +315,14 @@ GrB_Info GB_serialize_array
                 // compressed block is now in dst [0:s64-1], of size s64
                 Sblocks [blockid] = (int64_t) s64 ;
                 break ;
+
+            case GxB_COMPRESSION_ZSTD_LONG : 
+                s64 = GB_zstd_long_compress (dst, dstCapacity, src, srcSize,
+                    (blockid == 0) ? NULL : prefix, prefix_size, level) ;
+                ok = ok && !ZSTD_isError (s64) && (s64 <= dstCapacity) ;
+                // compressed block is now in dst [0:s64-1], of size s64
+                Sblocks [blockid] = (int64_t) s64 ;
+                break ;
         }
     }
 
@@ -0,0 +1,140 @@
+//------------------------------------------------------------------------------
+// GB_serialize_checksum: compute or check the checksums of an array in a blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The array X of size X_len (uncompressed) is held in the blob starting at
+// blob [s], as nblocks compressed blocks, or as a single uncompressed block.
+// Its checksums Hblocks [0:nchecksums-1] are the XXH3 hashes of each
+// compressed block as held in the blob, or of each piece of at most
+// GB_SERIALIZE_BLOCKSIZE_MAX bytes of an uncompressed array (see
+// GB_serialize.h).  If check is false, the checksums of all of X are
+// computed.  Otherwise, the checksums are checked, but only for the blocks
+// that hold X [b0:b1-1], and GrB_INVALID_OBJECT is returned if any of them do
+// not match.  The checksums are computed in parallel.
+
+#include "GB.h"
+#include "jitifyer/GB_jitifyer.h"
+#include "serialize/GB_serialize.h"
+
+GrB_Info GB_serialize_checksum
+(
+    // input/output:
+    uint64_t *Hblocks,          // checksums of the array
+    // input:
+    bool check,                 // if true, check Hblocks; else compute it
+    int64_t b0,                 // first byte of X to check
+    int64_t b1,                 // one past the last byte of X to check
+    int64_t X_len,              // size of X in bytes, when uncompressed
+    const GB_void *blob,        // serialized blob of size blob_size
+    size_t blob_size,
+    size_t s,                   // X is held in the blob starting at blob [s]
+    const int64_t *Sblocks,     // array of size nblocks
+    int32_t nblocks,            // # of compressed blocks for this array
+    int32_t method,             // compression method used for each block
+    int nthreads_max
+)
+{
+
+    //--------------------------------------------------------------------------
+    // find the checksums u0:u1-1 to compute or check
+    //--------------------------------------------------------------------------
+
+    if (!check)
+    { 
+        b0 = 0 ;
+        b1 = X_len ;
+    }
+    if (b0 >= b1 || X_len == 0)
+    { 
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+    if (b0 < 0 || b1 > X_len || nblocks <= 0)
+    { 
+        // blob is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    bool compressed = (method >= 0) ;
+    int64_t esize = GB_FILTER_ESIZE (GB_FILTER (method)) ;
+    int64_t u0, u1 ;
+    if (compressed)
+    {
+        // find the compressed blocks that hold X [b0:b1-1]
+        u0 = -1 ;
+        u1 = -1 ;
+        for (int32_t blockid = 0 ; blockid < nblocks ; blockid++)
+        {
+            int64_t kstart, kend ;
+            GB_BLOCK_PARTITION (kstart, kend, X_len, blockid, nblocks, esize) ;
+            if (kstart <= b0 && b0 < kend) u0 = blockid ;
+            if (kstart < b1 && b1 <= kend) u1 = blockid + 1 ;
+        }
+        if (u0 < 0 || u1 <= u0)
+        { 
+            // blob is invalid
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+    else
+    {
+        // find the pieces of the uncompressed array that hold X [b0:b1-1]
+        if (nblocks > 1 || Sblocks [0] != X_len || s + X_len > blob_size)
+        { 
+            // blob is invalid
+            return (GrB_INVALID_OBJECT) ;
+        }
+        u0 = b0 / GB_SERIALIZE_BLOCKSIZE_MAX ;
+        u1 = GB_ICEIL (b1, GB_SERIALIZE_BLOCKSIZE_MAX) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compute or check the checksums in parallel
+    //--------------------------------------------------------------------------
+
+    bool ok = true ;
+    int nthreads = (int) GB_IMIN (nthreads_max, u1 - u0) ;
+    int64_t u ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+        reduction(&&:ok)
+    for (u = u0 ; u < u1 ; u++)
+    {
+        // get the part of the blob that holds the block or piece u
+        int64_t s_start, s_end ;
+        if (compressed)
+        { 
+            s_start = (u == 0) ? 0 : Sblocks [u-1] ;
+            s_end   = Sblocks [u] ;
+        }
+        else
+        { 
+            s_start = u * GB_SERIALIZE_BLOCKSIZE_MAX ;
+            s_end   = GB_IMIN (s_start + GB_SERIALIZE_BLOCKSIZE_MAX, X_len) ;
+        }
+        if (s_start < 0 || s_start >= s_end || s + s_end > blob_size)
+        { 
+            // blob is invalid
+            ok = false ;
+        }
+        else
+        {
+            uint64_t hash = GB_jitifyer_hash (blob + s + s_start,
+                s_end - s_start, true) ;
+            if (check)
+            { 
+                ok = ok && (Hblocks [u] == hash) ;
+            }
+            else
+            { 
+                Hblocks [u] = hash ;
+            }
+        }
+    }
+
+    return (ok ? GrB_SUCCESS : GrB_INVALID_OBJECT) ;
+}
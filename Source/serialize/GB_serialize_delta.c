@@ -0,0 +1,166 @@
+//------------------------------------------------------------------------------
+// GB_serialize_delta: serialize the changes to a matrix since a prior snapshot
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The vectors of A are partitioned into groups, and the content of each group
+// is hashed (see GB_delta_hash).  If a base blob is given, it must have been
+// written by GxB_Matrix_serialize_delta, for a matrix of the same type,
+// dimensions, and format as A.  The group hashes of A are compared with those
+// recorded in the base blob, and only the vectors of A in the groups that
+// differ are serialized.  The blob also records the hash of every group of A,
+// so that it can serve as the base of the next delta, and a digest of the
+// group hashes of the base, so that GB_deserialize_delta can check that it is
+// applied to the right matrix.  The base blob is not decompressed.  If base
+// is NULL, or if all groups differ, all of A is serialized.
+
+#include "GB.h"
+#include "jitifyer/GB_jitifyer.h"
+#include "serialize/GB_serialize.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORK (&Delta, Delta_size) ;     \
+    GB_Matrix_free (&T) ;                   \
+    GB_Matrix_free (&D) ;                   \
+}
+
+GrB_Info GB_serialize_delta         // serialize the changes to a matrix
+(
+    // output:
+    GB_void **blob_handle,          // serialized delta, allocated on output
+    size_t *blob_size_handle,       // size of the blob
+    // input:
+    const GrB_Matrix A,             // matrix to serialize
+    const GB_void *base,            // blob of a prior snapshot of A, or NULL
+    size_t base_size,               // size of the base blob
+    int32_t method,                 // method to use
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (blob_handle != NULL && blob_size_handle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for serialize delta", GB0) ;
+
+    uint64_t *Delta = NULL ; size_t Delta_size = 0 ;
+    GrB_Matrix T = NULL, D = NULL ;
+
+    GB_OK (GB_wait (A, "A to serialize delta", Werk)) ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+
+    //--------------------------------------------------------------------------
+    // get the group hashes of the base blob
+    //--------------------------------------------------------------------------
+
+    int64_t vdim = A->vdim ;
+    int64_t gsize = GB_DELTA_GSIZE (vdim) ;
+    int64_t ngroups = GB_ICEIL (vdim, gsize) ;
+    const uint64_t *Hbase = NULL ;
+    uint64_t base_digest = 0 ;
+
+    if (base != NULL)
+    {
+        const uint64_t *Base_delta ;
+        int64_t base_vlen, base_vdim ;
+        int32_t base_typecode ;
+        bool base_is_csc ;
+        GB_OK (GB_delta_get (&Base_delta, &base_vlen, &base_vdim,
+            &base_typecode, &base_is_csc, base, base_size)) ;
+        if (Base_delta == NULL)
+        {
+            // the base blob was not written by GxB_Matrix_serialize_delta
+            return (GrB_INVALID_VALUE) ;
+        }
+        if (base_typecode != (int32_t) A->type->code)
+        {
+            // the base blob holds a matrix of a different type
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+        if (base_vlen != A->vlen || base_vdim != vdim ||
+            base_is_csc != A->is_csc)
+        {
+            // the base blob holds a matrix of a different size or format
+            return (GrB_DIMENSION_MISMATCH) ;
+        }
+        Hbase = Base_delta + 3 ;
+        base_digest = GB_jitifyer_hash (Hbase, ngroups * sizeof (uint64_t),
+            true) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // hash each group of A
+    //--------------------------------------------------------------------------
+
+    // The delta section is ngroups, gsize, base_digest, Hgroups, and Changed.
+    Delta = GB_CALLOC_WORK (GB_DELTA_SIZE (ngroups) / sizeof (uint64_t),
+        uint64_t, &Delta_size) ;
+    if (Delta == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    Delta [0] = ngroups ;
+    Delta [1] = gsize ;
+    Delta [2] = base_digest ;
+    uint64_t *Hgroups = Delta + 3 ;
+    uint64_t *Changed = Hgroups + ngroups ;
+
+    if (GB_IS_BITMAP (A) || GB_IS_FULL (A))
+    {
+        // hash a sparse copy of A
+        GB_OK (GB_dup (&T, A, Werk)) ;
+        GB_ENSURE_SPARSE (T) ;
+    }
+    GrB_Matrix S = (T == NULL) ? A : T ;
+    GB_OK (GB_delta_hash (Hgroups, S, ngroups, gsize, nthreads_max)) ;
+
+    //--------------------------------------------------------------------------
+    // find the groups that differ from the base
+    //--------------------------------------------------------------------------
+
+    int64_t nchanged = 0 ;
+    for (int64_t g = 0 ; g < ngroups ; g++)
+    {
+        if (Hbase == NULL || Hgroups [g] != Hbase [g])
+        {
+            Changed [g / 64] |= ((uint64_t) 1) << (g % 64) ;
+            nchanged++ ;
+        }
+    }
+
+    GBURBLE ("(delta: %" PRId64 " of %" PRId64 " groups changed) ",
+        nchanged, ngroups) ;
+
+    //--------------------------------------------------------------------------
+    // serialize the vectors of A in the changed groups
+    //--------------------------------------------------------------------------
+
+    if (nchanged < ngroups)
+    {
+        GB_OK (GB_delta_splice (&D, NULL, S, Changed, ngroups, gsize,
+            nthreads_max)) ;
+        D->hyper_switch = A->hyper_switch ;
+        D->bitmap_switch = A->bitmap_switch ;
+        D->sparsity_control = A->sparsity_control ;
+    }
+
+    GB_OK (GB_serialize (blob_handle, blob_size_handle,
+        (D == NULL) ? A : D, method, Delta, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,79 @@
+//------------------------------------------------------------------------------
+// GB_serialize_filter: filter a block before it is compressed
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The block src [0:len-1] is filtered into dst [0:len-1] (see GB_serialize.h
+// for a description of the filters).  The block is treated as n = len/esize
+// elements, each of size esize, and the k-th byte of the i-th element is
+// written to dst [k*n+i].  With the GB_FILTER_DELTA filter, the elements are
+// first replaced with the zigzag encoding of their differences.  The block is
+// filtered by a single thread; the caller filters the blocks in parallel.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+void GB_serialize_filter
+(
+    GB_void *dst,               // filtered block of size len
+    const GB_void *src,         // block to filter, of size len
+    int64_t len,                // size of the block, in bytes
+    int32_t filter              // filter to apply
+)
+{
+
+    int64_t esize = GB_FILTER_ESIZE (filter) ;
+    int64_t n = len / esize ;
+    ASSERT (n * esize == len) ;
+
+    if (filter == GB_FILTER_DELTA)
+    {
+
+        //----------------------------------------------------------------------
+        // delta and zigzag encoding of int64_t values, then byte shuffle
+        //----------------------------------------------------------------------
+
+        uint64_t prev = 0 ;
+        for (int64_t i = 0 ; i < n ; i++)
+        { 
+            uint64_t x ;
+            memcpy (&x, src + i * sizeof (uint64_t), sizeof (uint64_t)) ;
+            uint64_t d = x - prev ;
+            prev = x ;
+            uint64_t z = (d << 1) ^ (uint64_t) (((int64_t) d) >> 63) ;
+            for (int k = 0 ; k < 8 ; k++)
+            { 
+                dst [k*n + i] = (GB_void) (z >> (8*k)) ;
+            }
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // byte shuffle
+        //----------------------------------------------------------------------
+
+        #define GB_SHUFFLE(esize)                                   \
+        {                                                           \
+            for (int64_t i = 0 ; i < n ; i++)                       \
+            {                                                       \
+                for (int k = 0 ; k < esize ; k++)                   \
+                {                                                   \
+                    dst [k*n + i] = src [i*esize + k] ;             \
+                }                                                   \
+            }                                                       \
+        }
+        switch (esize)
+        {
+            case 2  : GB_SHUFFLE (2) ; break ;
+            case 4  : GB_SHUFFLE (4) ; break ;
+            default : GB_SHUFFLE (8) ; break ;
+        }
+    }
+}
@@ -28,6 +28,9 @@ void GB_serialize_method
         return ;
     }
 
+    // ignore the filter, if present (see GB_serialize_array)
+    method = method % GxB_COMPRESSION_FILTER ;
+
     // Determine the algorithm and level.  Lower levels give faster compression
     // time but not as good of compression.  Higher levels give more compact
     // compressions, at the cost of higher run times.  For all methods: a level
@@ -60,6 +63,7 @@ void GB_serialize_method
             break ;
 
         case GxB_COMPRESSION_ZSTD :     // ZSTD: level 1 to 19; default 1.
+        case GxB_COMPRESSION_ZSTD_LONG :
             if ((*level) <= 0 || (*level) > 19) (*level) = 1 ;
             break ;
     }
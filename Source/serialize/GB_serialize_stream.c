@@ -0,0 +1,299 @@
+//------------------------------------------------------------------------------
+// GB_serialize_stream: compress and serialize a GrB_Matrix to a stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The matrix A is serialized as a streamed blob (see GB_serialize.h), written
+// in pieces by the user-provided write_func.  The header is written first, and
+// then each array is compressed in chunks of GB_STREAM_CHUNK bytes.  The blocks
+// of each chunk are compressed in parallel, written, and then freed before the
+// next chunk is compressed.  The entire blob is never held in memory.
+
+#include "GB.h"
+#include "get_set/GB_get_set.h"
+#include "jitifyer/GB_jitifyer.h"
+#include "serialize/GB_serialize.h"
+
+#define GB_FREE_ALL                                                 \
+{                                                                   \
+    GB_FREE (&Sblocks, Sblocks_size) ;                              \
+    GB_FREE_WORK (&Hblocks, Hblocks_size) ;                         \
+    GB_serialize_free_blocks (&Blocks, Blocks_size, nblocks) ;      \
+}
+
+// write bytes to the stream
+#define GB_STREAM_WRITE(buffer,size)                                \
+{                                                                   \
+    if ((size) > 0 && !write_func (handle, buffer, size))           \
+    {                                                               \
+        /* the user write function has failed */                    \
+        GB_FREE_ALL ;                                               \
+        return (GrB_INVALID_VALUE) ;                                \
+    }                                                               \
+}
+
+GrB_Info GB_serialize_stream        // serialize a matrix to a stream
+(
+    // input:
+    GxB_write_function write_func,  // user function to write the stream
+    void *handle,                   // user handle passed to write_func
+    const GrB_Matrix A,             // matrix to serialize
+    int32_t method,                 // method to use
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (write_func != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for serialize stream", GB0) ;
+
+    GB_blocks *Blocks = NULL ; size_t Blocks_size = 0 ;
+    int64_t *Sblocks = NULL  ; size_t Sblocks_size = 0 ;
+    uint64_t *Hblocks = NULL ; size_t Hblocks_size = 0 ;
+    int32_t nblocks = 0 ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+
+    //--------------------------------------------------------------------------
+    // ensure all pending work is finished
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_wait (A, "A to serialize", Werk)) ;
+    ASSERT (A->nvec_nonempty >= 0) ;
+
+    //--------------------------------------------------------------------------
+    // parse the method
+    //--------------------------------------------------------------------------
+
+    int32_t algo, level ;
+    bool checksum = (method > GxB_COMPRESSION_CHECKSUM / 2) ;
+    if (checksum) method -= GxB_COMPRESSION_CHECKSUM ;
+    bool filter = (GB_FILTER (method) != GB_FILTER_NONE) ;
+    GB_serialize_method (&algo, &level, method) ;
+    if (algo == GxB_COMPRESSION_ZSTD_LONG)
+    { 
+        // each chunk is compressed on its own, so a shared prefix would
+        // have to be held in memory for the whole stream; use ZSTD instead
+        algo = GxB_COMPRESSION_ZSTD ;
+    }
+    method = algo + level ;
+    filter = filter && (algo != GxB_COMPRESSION_NONE) ;
+    GBURBLE ("(stream compression: %s%s%s%s:%d%s%s) ",
+        (algo == GxB_COMPRESSION_NONE ) ? "none" : "",
+        (algo == GxB_COMPRESSION_LZ4  ) ? "LZ4" : "",
+        (algo == GxB_COMPRESSION_LZ4HC) ? "LZ4HC" : "",
+        (algo == GxB_COMPRESSION_ZSTD ) ? "ZSTD" : "",
+        level, filter ? " filtered" : "", checksum ? " checksum" : "") ;
+
+    //--------------------------------------------------------------------------
+    // get the content of the matrix
+    //--------------------------------------------------------------------------
+
+    int32_t version = GxB_IMPLEMENTATION ;
+    int64_t vlen = A->vlen ;
+    int64_t vdim = A->vdim ;
+    int64_t nvec = A->nvec ;
+    int64_t nvals = A->nvals ;
+    int64_t nvec_nonempty = A->nvec_nonempty ;
+    int32_t sparsity = GB_sparsity (A) ;
+    bool iso = A->iso ;
+    float hyper_switch = A->hyper_switch ;
+    float bitmap_switch = A->bitmap_switch ;
+    int32_t sparsity_control = A->sparsity_control ;
+    ASSERT (A->Pending == NULL) ;
+    ASSERT (A->nzombies == 0) ;
+    ASSERT (!A->jumbled) ;
+    GrB_Type atype = A->type ;
+    int64_t typesize = atype->size ;
+    int32_t typecode = (int32_t) (atype->code) ;
+    int64_t anz = GB_nnz (A) ;
+    int64_t anz_held = GB_nnz_held (A) ;
+
+    // determine the uncompressed sizes of Ap, Ah, Ab, Ai, and Ax
+    int64_t Ap_len = 0 ;
+    int64_t Ah_len = 0 ;
+    int64_t Ab_len = 0 ;
+    int64_t Ai_len = 0 ;
+    int64_t Ax_len = 0 ;
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+            Ah_len = sizeof (GrB_Index) * nvec ;
+            // fall through to the sparse case
+        case GxB_SPARSE :
+            Ap_len = sizeof (GrB_Index) * (nvec+1) ;
+            Ai_len = sizeof (GrB_Index) * anz ;
+            Ax_len = typesize * (iso ? 1 : anz) ;
+            break ;
+        case GxB_BITMAP :
+            Ab_len = sizeof (int8_t) * anz_held ;
+            // fall through to the full case
+        case GxB_FULL :
+            Ax_len = typesize * (iso ? 1 : anz_held) ;
+            break ;
+        default: ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the header and type_name to the stream
+    //--------------------------------------------------------------------------
+
+    // 160 bytes, plus 128 bytes for user-defined types
+    GB_void blob [GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN] ;
+    size_t s = 0 ;
+
+    int32_t sparsity_iso_csc = (4 * sparsity) + (iso ? 2 : 0) +
+        (A->is_csc ? 1 : 0) + (checksum ? GB_BLOB_CHECKSUM : 0) ;
+
+    // a zero blob_size denotes a streamed blob; no blocks are listed
+    uint64_t blob_size_zero = 0 ;
+    int32_t zero = 0 ;
+    GB_BLOB_WRITE (blob_size_zero, uint64_t) ;
+    GB_BLOB_WRITE (typecode, int32_t) ;
+    GB_BLOB_WRITE (version, int32_t) ;
+    GB_BLOB_WRITE (vlen, int64_t) ;
+    GB_BLOB_WRITE (vdim, int64_t) ;
+    GB_BLOB_WRITE (nvec, int64_t) ;
+    GB_BLOB_WRITE (nvec_nonempty, int64_t) ;
+    GB_BLOB_WRITE (nvals, int64_t) ;
+    GB_BLOB_WRITE (typesize, int64_t) ;
+    GB_BLOB_WRITE (Ap_len, int64_t) ;
+    GB_BLOB_WRITE (Ah_len, int64_t) ;
+    GB_BLOB_WRITE (Ab_len, int64_t) ;
+    GB_BLOB_WRITE (Ai_len, int64_t) ;
+    GB_BLOB_WRITE (Ax_len, int64_t) ;
+    GB_BLOB_WRITE (hyper_switch, float) ;
+    GB_BLOB_WRITE (bitmap_switch, float) ;
+    GB_BLOB_WRITE (sparsity_control, int32_t) ;
+    GB_BLOB_WRITE (sparsity_iso_csc, int32_t);
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        // A[phbix]_nblocks and A[phbix]_method
+        GB_BLOB_WRITE (zero, int32_t) ;
+        GB_BLOB_WRITE (method, int32_t) ;
+    }
+
+    if (typecode == GB_UDT_code)
+    {
+        // only write the type_name for user-defined types
+        memset (blob + s, 0, GxB_MAX_NAME_LEN) ;
+        #if GB_COMPILER_GCC
+        #if (__GNUC__ > 5)
+        #pragma GCC diagnostic ignored "-Wstringop-truncation"
+        #endif
+        #endif
+        strncpy ((char *) (blob + s), atype->name, GxB_MAX_NAME_LEN-1) ;
+        s += GxB_MAX_NAME_LEN ;
+    }
+
+    GB_STREAM_WRITE (blob, s) ;
+
+    //--------------------------------------------------------------------------
+    // compress and write each array (Ap, Ah, Ab, Ai, and Ax)
+    //--------------------------------------------------------------------------
+
+    GB_void *X_list [5] = { (GB_void *) A->p, (GB_void *) A->h,
+        (GB_void *) A->b, (GB_void *) A->i, (GB_void *) A->x } ;
+    int64_t X_len_list [5] = { Ap_len, Ah_len, Ab_len, Ai_len, Ax_len } ;
+
+    // If filters are requested, the index arrays (Ap, Ah, and Ai) are delta
+    // encoded and the values (Ax) are byte shuffled, as in GB_serialize.
+    int32_t X_filter_list [5] = { GB_FILTER_DELTA, GB_FILTER_DELTA,
+        GB_FILTER_NONE, GB_FILTER_DELTA, GB_FILTER_VALUES (typesize) } ;
+
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        GB_void *X = X_list [k] ;
+        int64_t X_len = X_len_list [k] ;
+        int32_t X_method = method ;
+        if (filter) X_method += X_filter_list [k] * GxB_COMPRESSION_FILTER ;
+        for (int64_t offset = 0 ; offset < X_len ; offset += GB_STREAM_CHUNK)
+        {
+
+            //------------------------------------------------------------------
+            // compress X [offset:offset+len-1] into a set of blocks
+            //------------------------------------------------------------------
+
+            int64_t len = GB_IMIN (X_len - offset, GB_STREAM_CHUNK) ;
+            int32_t method_used ;
+            size_t compressed_size ;
+            GB_OK (GB_serialize_array (&Blocks, &Blocks_size,
+                &Sblocks, &Sblocks_size, &nblocks, &method_used,
+                &compressed_size, false, X + offset, len, X_method, algo,
+                level, Werk)) ;
+
+            //------------------------------------------------------------------
+            // compute the checksum of each block in parallel, if requested
+            //------------------------------------------------------------------
+
+            if (checksum)
+            {
+                Hblocks = GB_MALLOC_WORK (nblocks, uint64_t, &Hblocks_size) ;
+                if (Hblocks == NULL)
+                { 
+                    // out of memory
+                    GB_FREE_ALL ;
+                    return (GrB_OUT_OF_MEMORY) ;
+                }
+                int nthreads = GB_IMIN (nthreads_max, nblocks) ;
+                int32_t blockid ;
+                #pragma omp parallel for num_threads(nthreads) \
+                    schedule(dynamic)
+                for (blockid = 0 ; blockid < nblocks ; blockid++)
+                { 
+                    Hblocks [blockid] = GB_jitifyer_hash (Blocks [blockid].p,
+                        Sblocks [blockid+1] - Sblocks [blockid], true) ;
+                }
+            }
+
+            //------------------------------------------------------------------
+            // write each block as a record
+            //------------------------------------------------------------------
+
+            for (int32_t blockid = 0 ; blockid < nblocks ; blockid++)
+            {
+                int64_t kstart, kend ;
+                GB_BLOCK_PARTITION (kstart, kend, len, blockid, nblocks,
+                    GB_FILTER_ESIZE (GB_FILTER (method_used))) ;
+                int64_t record [3] ;
+                record [0] = kend - kstart ;
+                record [1] = Sblocks [blockid+1] - Sblocks [blockid] ;
+                record [2] = method_used ;
+                GB_STREAM_WRITE (record, GB_STREAM_RECORD_SIZE) ;
+                if (checksum)
+                { 
+                    GB_STREAM_WRITE (&(Hblocks [blockid]),
+                        GB_STREAM_CHECKSUM_SIZE) ;
+                }
+                GB_STREAM_WRITE (Blocks [blockid].p, (size_t) record [1]) ;
+            }
+
+            //------------------------------------------------------------------
+            // free the blocks of this chunk
+            //------------------------------------------------------------------
+
+            GB_FREE_ALL ;
+            nblocks = 0 ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // write the GrB_NAME and GrB_EL_TYPE_STRING, each with a nul byte
+    //--------------------------------------------------------------------------
+
+    const char *user_name = A->user_name ;
+    const char *eltype_string = GB_type_name_get (A->type) ;
+    if (user_name == NULL) user_name = "" ;
+    if (eltype_string == NULL) eltype_string = "" ;
+    GB_STREAM_WRITE (user_name, strlen (user_name) + 1) ;
+    GB_STREAM_WRITE (eltype_string, strlen (eltype_string) + 1) ;
+
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_delta: apply a delta blob to a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Update C in place with a blob written by GxB_Matrix_serialize_delta.  If
+// the blob is an incremental delta, C must hold the matrix of the base
+// snapshot it was computed from.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize_delta   // apply a delta blob to a matrix
+(
+    // input/output:
+    GrB_Matrix C,                   // matrix to update
+    // input:
+    const void *blob,               // the blob
+    GrB_Index blob_size,            // size of the blob
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (C, "GxB_Matrix_deserialize_delta (C, blob, blob_size, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_delta") ;
+    GB_RETURN_IF_NULL (blob) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // apply the delta to C
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize_delta (C, (const GB_void *) blob, (size_t) blob_size,
+        Werk) ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
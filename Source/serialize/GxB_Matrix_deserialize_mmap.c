@@ -0,0 +1,140 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_mmap: create a matrix from a memory-mapped blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// deserialize: create a GrB_Matrix from a file holding a serialized blob.
+
+// The file must hold exactly one blob, as written by GrB_Matrix_serialize or
+// GxB_Matrix_serialize.  The file is mapped into memory, read-only.  If the
+// blob was serialized with GxB_COMPRESSION_NONE, the matrix C is not copied
+// from the file: its arrays point directly into the mapping, and the page
+// cache is shared with any other process that maps the same file.  The
+// mapping is released when C is freed.  If C is later modified, it is first
+// copied out of the mapping into its own memory.  The file must not be
+// modified or truncated while C uses it.
+
+// If the blob is compressed, or if the file cannot be mapped (on Windows, for
+// example), the blob is read and C is deserialized as a copy, just as
+// GxB_Matrix_deserialize would do.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+#include "jitifyer/GB_file.h"
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_file_munmap (mapping, mapping_size) ;    \
+    GB_FREE (&blob, blob_size_allocated) ;      \
+    if (f != NULL) fclose (f) ;                 \
+}
+
+GrB_Info GxB_Matrix_deserialize_mmap    // deserialize a file into a GrB_Matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the file
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blob holds a
+                        // matrix of user-defined type.  May be NULL if blob
+                        // holds a built-in type; otherwise must match the
+                        // type of C.
+    const char *filename,       // file holding the blob
+    const GrB_Descriptor desc   // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_deserialize_mmap (&C, type, filename, desc)") ;
+    void *mapping = NULL ;
+    size_t mapping_size = 0 ;
+    GB_void *blob = NULL ;
+    size_t blob_size_allocated = 0 ;
+    FILE *f = NULL ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_mmap") ;
+    GB_RETURN_IF_NULL (filename) ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    (*C) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // map the file into memory
+    //--------------------------------------------------------------------------
+
+    mapping = GB_file_mmap (filename, &mapping_size) ;
+
+    if (mapping != NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // deserialize the blob in place, if possible
+        //----------------------------------------------------------------------
+
+        GB_OK (GB_deserialize (C, type, (const GB_void *) mapping,
+            mapping_size, true, false)) ;
+
+        if (GB_is_shallow (*C))
+        { 
+            // C points into the mapping, so C now owns the mapping
+            GBURBLE ("(mmap: zero copy) ") ;
+            (*C)->mapping = mapping ;
+            (*C)->mapping_size = mapping_size ;
+        }
+        else
+        { 
+            // the blob is compressed, so C is a copy
+            GB_file_munmap (mapping, mapping_size) ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // read the file into memory and deserialize it
+        //----------------------------------------------------------------------
+
+        f = fopen (filename, "rb") ;
+        if (f == NULL)
+        { 
+            // file cannot be opened
+            return (GrB_INVALID_VALUE) ;
+        }
+        fseek (f, 0, SEEK_END) ;
+        long len = ftell (f) ;
+        fseek (f, 0, SEEK_SET) ;
+        if (len <= 0)
+        { 
+            // file is empty or cannot be read
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        size_t blob_size = (size_t) len ;
+        blob = GB_MALLOC (blob_size, GB_void, &blob_size_allocated) ;
+        if (blob == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        if (fread (blob, 1, blob_size, f) != blob_size)
+        { 
+            // file cannot be read
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        fclose (f) ;
+        f = NULL ;
+        info = GB_deserialize (C, type, blob, blob_size, false, false) ;
+        GB_FREE (&blob, blob_size_allocated) ;
+    }
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
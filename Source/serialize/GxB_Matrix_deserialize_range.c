@@ -0,0 +1,65 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_range: create a matrix from part of a blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C = A(first:last,:) or C = A(:,first:last), where A is the matrix held in a
+// blob written by GrB_Matrix_serialize or GxB_Matrix_serialize.  Only the
+// parts of the blob needed for C are decompressed, if A is held by row (for a
+// range of rows) or by column (for a range of columns).  If pattern is true,
+// the values of A are not read and C is returned as an iso-valued GrB_BOOL
+// matrix with all entries equal to true.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize_range   // deserialize part of a blob
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blob
+    // input:
+    GrB_Type type,      // type of the matrix in the blob.  Required if the
+                        // blob holds a matrix of user-defined type.  May be
+                        // NULL if blob holds a built-in type; otherwise must
+                        // match the type of the matrix in the blob.
+    const void *blob,       // the blob
+    GrB_Index blob_size,    // size of the blob
+    int format,             // GxB_BY_ROW: C = A(first:last,:)
+                            // GxB_BY_COL: C = A(:,first:last)
+    GrB_Index first,        // first row or column of the range
+    GrB_Index last,         // last row or column of the range
+    bool pattern,           // if true, return just the pattern of C
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_deserialize_range (&C, type, blob, blob_size, "
+        "format, first, last, pattern, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_range") ;
+    GB_RETURN_IF_NULL (blob) ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    if (!(format == GxB_BY_ROW || format == GxB_BY_COL) || first > last
+        || last >= GB_NMAX)
+    { 
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // deserialize the range of the blob into a matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize_range (C, type, (const GB_void *) blob,
+        (size_t) blob_size, format == GxB_BY_COL, (int64_t) first,
+        (int64_t) last, pattern, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,50 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_stream: create a matrix from a user-defined stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// deserialize: create a GrB_Matrix from a stream written by
+// GxB_Matrix_serialize_stream, read in pieces with a user-provided read
+// function.
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize_stream  // deserialize a stream to a GrB_Matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the stream
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the stream holds
+                        // a matrix of user-defined type.  May be NULL if it
+                        // holds a built-in type; otherwise must match the
+                        // type of C.
+    GxB_read_function read_func,    // user function to read the stream
+    void *handle,                   // user handle passed to read_func
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_deserialize_stream (&C, type, read_func, handle, "
+        "desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_stream") ;
+    GB_RETURN_IF_NULL (read_func) ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // deserialize the stream into a matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize_stream (C, type, read_func, handle) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
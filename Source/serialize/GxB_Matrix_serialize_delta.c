@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_serialize_delta: serialize the changes to a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Serialize the vectors of A that have changed since a prior snapshot, held in
+// a base blob written by this method.  If base is NULL, all of A is
+// serialized.  The blob is allocated and returned, as for
+// GxB_Matrix_serialize.  Example usage:
+
+/*
+    void *base = NULL, *delta = NULL ;
+    GrB_Index base_size = 0, delta_size = 0 ;
+    // write a complete snapshot of A:
+    GxB_Matrix_serialize_delta (&base, &base_size, A, NULL, 0, NULL) ;
+    GxB_Matrix_deserialize (&C, atype, base, base_size, NULL) ;
+    // modify A, then write just the changes:
+    GxB_Matrix_serialize_delta (&delta, &delta_size, A, base, base_size, NULL) ;
+    // update C to match A:
+    GxB_Matrix_deserialize_delta (C, delta, delta_size, NULL) ;
+*/
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+GrB_Info GxB_Matrix_serialize_delta     // serialize the changes to a matrix
+(
+    // output:
+    void **blob_handle,             // the blob, allocated on output
+    GrB_Index *blob_size_handle,    // size of the blob on output
+    // input:
+    GrB_Matrix A,                   // matrix to serialize
+    const void *base,               // blob of a prior snapshot, or NULL
+    GrB_Index base_size,            // size of the base blob
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_serialize_delta (&blob, &blob_size, A, base, "
+        "base_size, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_serialize_delta") ;
+    GB_RETURN_IF_NULL (blob_handle) ;
+    GB_RETURN_IF_NULL (blob_size_handle) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    // get the compression method from the descriptor
+    int method = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+
+    //--------------------------------------------------------------------------
+    // serialize the changes to the matrix
+    //--------------------------------------------------------------------------
+
+    (*blob_handle) = NULL ;
+    size_t blob_size = 0 ;
+    info = GB_serialize_delta ((GB_void **) blob_handle, &blob_size, A,
+        (const GB_void *) base, (size_t) base_size, method, Werk) ;
+    (*blob_size_handle) = (GrB_Index) blob_size ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
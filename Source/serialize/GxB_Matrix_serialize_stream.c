@@ -0,0 +1,65 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_serialize_stream: serialize a matrix to a user-defined stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// serialize a GrB_Matrix in pieces, with a user-provided write function.
+// Example usage, writing to a file:
+
+/*
+    bool my_write (void *handle, const void *buffer, size_t size)
+    {
+        return (fwrite (buffer, 1, size, (FILE *) handle) == size) ;
+    }
+    bool my_read (void *handle, void *buffer, size_t size)
+    {
+        return (fread (buffer, 1, size, (FILE *) handle) == size) ;
+    }
+
+    FILE *f = fopen ("A.blob", "w") ;
+    GxB_Matrix_serialize_stream (my_write, f, A, NULL) ;
+    fclose (f) ;
+    f = fopen ("A.blob", "r") ;
+    GxB_Matrix_deserialize_stream (&B, atype, my_read, f, NULL) ;
+    fclose (f) ;
+*/
+
+#include "GB.h"
+#include "serialize/GB_serialize.h"
+
+GrB_Info GxB_Matrix_serialize_stream    // serialize a GrB_Matrix to a stream
+(
+    GxB_write_function write_func,  // user function to write the stream
+    void *handle,                   // user handle passed to write_func
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_serialize_stream (write_func, handle, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_serialize_stream") ;
+    GB_RETURN_IF_NULL (write_func) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    // get the compression method from the descriptor
+    int method = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+
+    //--------------------------------------------------------------------------
+    // serialize the matrix to the stream
+    //--------------------------------------------------------------------------
+
+    info = GB_serialize_stream (write_func, handle, A, method, Werk) ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
@@ -276,6 +276,18 @@ GrB_Info GB_sort
     { 
         GB_phybix_free (C) ;
     }
+    else
+    { 
+        // A is sorted in place, so its cached transpose is no longer valid,
+        // and A must be copied out of its memory mapping, if any
+        GB_Matrix_free (&(A->AT)) ;
+        info = GB_unmap (A) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            return (info) ;
+        }
+    }
 
     //--------------------------------------------------------------------------
     // make a copy of A, unless it is aliased with C
@@ -99,6 +99,8 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A' or C=op(A')
     if (in_place)
     { 
         GBURBLE ("(in-place transpose) ") ;
+        // the cached transpose of A is no longer valid
+        GB_Matrix_free (&(A->AT)) ;
     }
 
     // get the current sparsity control of A
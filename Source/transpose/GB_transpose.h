@@ -50,6 +50,22 @@ GrB_Info GB_transpose_cast      // C= (ctype) A' or one (A'), not in-place
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_transpose_cache     // construct A->AT if A->cache_AT is true
+(
+    GrB_Matrix A,               // matrix to transpose; A->AT is modified
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_transpose_cached    // C = A', or a shallow copy of A->AT
+(
+    GrB_Matrix C,               // output matrix C, static header
+    GrB_Type ctype,             // desired type of C, if not cached
+    const bool C_is_csc,        // desired CSR/CSC format of C
+    const GrB_Matrix A,         // input matrix; C != A
+    const bool iso_one,         // if true, C = one (A'), if not cached
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
 (
     GrB_Matrix C,               // output matrix (static header)
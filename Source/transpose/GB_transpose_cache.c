@@ -0,0 +1,84 @@
+//------------------------------------------------------------------------------
+// GB_transpose_cache: construct the cached transpose of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If A->cache_AT is true and A->AT is not yet computed, A->AT = A' is
+// constructed, with the same type as A.  A->AT is the transpose of the
+// storage of A: if A is held by column, A->AT is the transpose of A held by
+// column; if A is held by row, A->AT is the transpose of A held by row.
+
+// A->AT is not constructed if A has pending work other than being jumbled
+// (the transpose is not needed by GB_wait itself), or if the transpose would
+// be a shallow copy of A (which is the case for some vectors, and takes O(1)
+// time anyway).  A->AT is computed inside a critical section, since A may be
+// an input matrix shared by multiple user threads.
+
+#include "transpose/GB_transpose.h"
+
+#define GB_FREE_ALL GB_Matrix_free (&AT) ;
+
+GrB_Info GB_transpose_cache     // construct A->AT if A->cache_AT is true
+(
+    GrB_Matrix A,               // matrix to transpose; A->AT is modified
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A for transpose cache", GB0) ;
+    if (!A->cache_AT || A->AT != NULL || GB_PENDING (A) || GB_ZOMBIES (A))
+    { 
+        // quick return: A->AT is disabled or already computed, or A has
+        // pending tuples or zombies
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // AT = A', held in the same CSR/CSC format as A
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GrB_SUCCESS ;
+    GrB_Matrix AT = NULL ;
+    #pragma omp critical (GB_transpose_cache)
+    {
+        if (A->AT == NULL)
+        {
+            GB_BURBLE_MATRIX (A, "(cache transpose) ") ;
+            // allocate the dynamic header of AT
+            info = GB_new (&AT, // new header
+                A->type, A->vdim, A->vlen, GB_Ap_null, A->is_csc,
+                GxB_AUTO_SPARSITY, GB_Global_hyper_switch_get ( ), 0) ;
+            if (info == GrB_SUCCESS)
+            { 
+                info = GB_transpose_cast (AT, A->type, A->is_csc, A, false,
+                    Werk) ;
+            }
+            if (info == GrB_SUCCESS)
+            { 
+                info = GB_hyper_hash_build (AT, Werk) ;
+            }
+            if (info == GrB_SUCCESS && !GB_is_shallow (AT))
+            { 
+                // A->AT now owns AT
+                A->AT = AT ;
+                AT = NULL ;
+            }
+            GB_FREE_ALL ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK_OR_NULL (A->AT, "A->AT cached transpose", GB0) ;
+    return (info) ;
+}
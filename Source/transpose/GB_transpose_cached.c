@@ -0,0 +1,63 @@
+//------------------------------------------------------------------------------
+// GB_transpose_cached: transpose a matrix, using its cached transpose
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If A->cache_AT is false, this method is identical to GB_transpose_cast:
+// C = (ctype) A' or C = (ctype) one (A') is computed.
+
+// Otherwise, A->AT is constructed if it does not already exist, and C is
+// returned as a purely shallow copy of A->AT.  In this case, ctype and iso_one
+// are ignored, and C has the same type as A and is iso only if A is iso.  The
+// caller must be able to handle this; the matrix multiply methods typecast
+// their inputs as needed and ignore the values of a matrix that is used only
+// for its pattern.
+
+#include "transpose/GB_transpose.h"
+#define GB_FREE_ALL ;
+
+GrB_Info GB_transpose_cached    // C = A', or a shallow copy of A->AT
+(
+    GrB_Matrix C,               // output matrix C, static header
+    GrB_Type ctype,             // desired type of C, if not cached
+    const bool C_is_csc,        // desired CSR/CSC format of C
+    const GrB_Matrix A,         // input matrix; C != A
+    const bool iso_one,         // if true, C = one (A'), if not cached
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL && (C->static_header || GBNSTATIC)) ;
+    ASSERT (C != A && !GB_any_aliased (C, A)) ;
+
+    //--------------------------------------------------------------------------
+    // construct A->AT if requested
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_transpose_cache (A, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // C = A'
+    //--------------------------------------------------------------------------
+
+    if (A->AT != NULL)
+    { 
+        // C = A->AT, as a purely shallow copy
+        GBURBLE ("(cached transpose) ") ;
+        return (GB_shallow_copy (C, C_is_csc, A->AT, Werk)) ;
+    }
+    else
+    { 
+        // C = (ctype) A' or C = (ctype) one (A')
+        return (GB_transpose_cast (C, ctype, C_is_csc, A, iso_one, Werk)) ;
+    }
+}
@@ -48,6 +48,12 @@ GrB_Info GB_block   // apply all pending computations if blocking mode enabled
         GB_OK (GB_wait (A, "matrix", Werk)) ;
         GB_OK (GB_hyper_hash_build (A, Werk)) ;
     }
+    else if (A->Pending != NULL)
+    { 
+        // assemble the pending tuples in the background, if enabled and if
+        // there are enough of them
+        GB_OK (GB_Pending_background (A, Werk)) ;
+    }
     return (GrB_SUCCESS) ;
 }
 
@@ -44,6 +44,17 @@ GrB_Info GB_unjumble        // unjumble a matrix
     ASSERT (!GB_IS_BITMAP (A)) ;
     ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
 
+    //--------------------------------------------------------------------------
+    // copy A out of any borrowed buffers, since it is sorted in place
+    //--------------------------------------------------------------------------
+
+    GrB_Info unmap_info = GB_unmap (A) ;
+    if (unmap_info != GrB_SUCCESS)
+    {
+        // out of memory
+        return (unmap_info) ;
+    }
+
     //--------------------------------------------------------------------------
     // get A
     //--------------------------------------------------------------------------
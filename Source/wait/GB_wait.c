@@ -27,6 +27,13 @@
 // If A is non-hypersparse, then O(n) is added in the worst case, to prune
 // zombies and to update the vector pointers for A.
 
+// If only a few pending tuples are added to A, they are merged into A in place
+// by GB_wait_inplace, which only examines the vectors of A that they touch.
+
+// If some of the pending tuples were handed to a background thread by
+// GB_Pending_background, the thread is waited for (if it is still running),
+// and the result is added to the assembled remaining pending tuples.
+
 // If A->nvec_nonempty is unknown (-1) it is computed.
 
 // The A->Y hyper_hash is freed if the A->h hyperlist has to be constructed.
@@ -39,8 +46,10 @@
 {                                       \
     GB_Matrix_free (&Y) ;               \
     GB_Matrix_free (&T) ;               \
+    GB_Matrix_free (&T0) ;              \
     GB_Matrix_free (&S) ;               \
     GB_Matrix_free (&A1) ;              \
+    GB_Pending_job_free (&job) ;        \
 }
 
 #define GB_FREE_ALL                     \
@@ -70,11 +79,33 @@ GrB_Info GB_wait                // finish all pending computations
     //--------------------------------------------------------------------------
 
     GrB_Info info = GrB_SUCCESS ;
-    struct GB_Matrix_opaque T_header, A1_header, S_header ;
-    GrB_Matrix T = NULL, A1 = NULL, S = NULL, Y = NULL ;
+    struct GB_Matrix_opaque T_header, T0_header, T1_header, A1_header,
+        S_header ;
+    GrB_Matrix T = NULL, T0 = NULL, A1 = NULL, S = NULL, Y = NULL ;
+    GB_Pending_job job = NULL ;
 
     ASSERT_MATRIX_OK (A, "A to wait", GB_ZOMBIE (GB0)) ;
 
+    //--------------------------------------------------------------------------
+    // free the cached transpose of A, if A is about to change
+    //--------------------------------------------------------------------------
+
+    if (GB_INGEST_PENDING (A) || GB_PENDING (A) || GB_ZOMBIES (A))
+    { 
+        // A->AT is normally freed by GB_WHERE when A is modified, but
+        // concurrent GrB_setElement does not modify A itself.
+        GB_Matrix_free (&(A->AT)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // move any tuples from concurrent GrB_setElement into A
+    //--------------------------------------------------------------------------
+
+    if (GB_INGEST_PENDING (A))
+    { 
+        GB_OK (GB_Ingest_flush (A, Werk)) ;
+    }
+
     if (GB_IS_FULL (A) || GB_IS_BITMAP (A))
     { 
         // full and bitmap matrices never have any pending work
@@ -157,6 +188,15 @@ GrB_Info GB_wait                // finish all pending computations
     if (npending > 0)
     {
 
+        //----------------------------------------------------------------------
+        // get any background job, which holds some of the pending tuples
+        //----------------------------------------------------------------------
+
+        job = A->Pending->job ;
+        A->Pending->job = NULL ;
+        const int64_t nnew = A->Pending->n ;
+        GrB_BinaryOp pending_op = A->Pending->op ;
+
         //----------------------------------------------------------------------
         // construct a new hypersparse matrix T with just the pending tuples
         //----------------------------------------------------------------------
@@ -189,7 +229,7 @@ GrB_Info GB_wait                // finish all pending computations
             true,                   // is_matrix: unused
             NULL, NULL, S_input,    // original I,J,S_input tuples
             A_iso,                  // pending tuples are iso if A is iso
-            npending,               // # of tuples
+            nnew,                   // # of tuples, not including the job
             A->Pending->op,         // dup operator for assembling duplicates,
                                     // NULL if A is iso
             stype,                  // type of Pending->x
@@ -231,6 +271,41 @@ GrB_Info GB_wait                // finish all pending computations
             return (info) ;
         }
 
+        //----------------------------------------------------------------------
+        // add the tuples assembled in the background to T
+        //----------------------------------------------------------------------
+
+        if (job != NULL)
+        {
+            // T0 = the tuples assembled by the background job, waiting for it
+            // to finish if needed
+            GB_CLEAR_STATIC_HEADER (T0, &T0_header) ;
+            GB_OK (GB_Pending_join (T0, &job)) ;
+            if (nnew == 0)
+            { 
+                // no pending tuples were added after the job was started
+                GB_Matrix_free (&T) ;
+                T = T0 ;
+                T0 = NULL ;
+            }
+            else
+            { 
+                // T = T0 + T, combining duplicates with the pending operator
+                struct GB_BinaryOp_opaque dup_header ;
+                GrB_BinaryOp dup = (pending_op == NULL) ?
+                    GB_binop_second (A->type, &dup_header) : pending_op ;
+                GrB_Matrix T1 = NULL ;
+                GB_CLEAR_STATIC_HEADER (T1, &T1_header) ;
+                bool ignore ;
+                info = GB_add (T1, A->type, A->is_csc, NULL, 0, 0, &ignore,
+                    T0, T, false, NULL, NULL, dup, false, false, Werk) ;
+                GB_Matrix_free (&T) ;
+                T = T1 ;
+                GB_OK (info) ;
+                GB_Matrix_free (&T0) ;
+            }
+        }
+
         ASSERT_MATRIX_OK (T, "T = hypersparse matrix of pending tuples", GB0) ;
         ASSERT (GB_IS_HYPERSPARSE (T)) ;
         ASSERT (!GB_ZOMBIES (T)) ;
@@ -310,6 +385,39 @@ GrB_Info GB_wait                // finish all pending computations
         return (info) ;
     }
 
+    //--------------------------------------------------------------------------
+    // add T into A in place, if T is small
+    //--------------------------------------------------------------------------
+
+    // If T is small compared with A, its entries are merged into A in place,
+    // with work proportional to the vectors of A that T touches, plus a
+    // memmove of the entries of A that follow them.  This is not possible if
+    // T has vectors not in the hyperlist of A.
+
+    if (16 * tnz <= anz)
+    {
+        info = GB_wait_inplace (A, T, Werk) ;
+        if (info == GrB_SUCCESS)
+        { 
+            // conform A to its desired sparsity structure
+            GB_Matrix_free (&T) ;
+            GB_OK (GB_conform (A, Werk)) ;
+            ASSERT (A->nvec_nonempty >= 0) ;
+            ASSERT_MATRIX_OK (A, "A after GB_wait:inplace", GB0) ;
+            GB_FREE_WORKSPACE ;
+            #pragma omp flush
+            return (GrB_SUCCESS) ;
+        }
+        else if (info != GrB_NO_VALUE)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (info) ;
+        }
+        // otherwise, T has new vectors, and A is unchanged
+        info = GrB_SUCCESS ;
+    }
+
     //--------------------------------------------------------------------------
     // create the SECOND_ATYPE binary operator
     //--------------------------------------------------------------------------
@@ -23,6 +23,13 @@ GrB_Info GB_wait                // finish all pending computations
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_wait_inplace        // A = A+T, in place
+(
+    GrB_Matrix A,               // matrix to modify
+    const GrB_Matrix T,         // assembled pending tuples, hypersparse
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_unjumble        // unjumble a matrix
 (
     GrB_Matrix A,           // matrix to unjumble
@@ -0,0 +1,265 @@
+//------------------------------------------------------------------------------
+// GB_wait_inplace: add a few assembled pending tuples into A, in place
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A = A+T, where T holds the assembled pending tuples of A, as a hypersparse
+// matrix.  A is sparse or hypersparse, with no zombies, pending tuples, or
+// jumbled vectors, and the pattern of T is disjoint from the pattern of A.
+// T is not modified.  A->Y is not modified since A->h does not change, so it
+// remains valid if present.
+
+// The update is done in place, without constructing a new matrix.  The
+// entries of A are shifted towards the end of A->i and A->x, from the last
+// vector to the first, in one pass.  A vector of A not in T is not examined:
+// each run of such vectors between two vectors of T is moved with a single
+// memmove, by the number of entries of T that precede it.  Only the vectors
+// of A that appear in T are merged, entry by entry, with the vectors of T.
+// The entries of A before its first vector in T are not moved.  Thus the
+// work is proportional to the number of entries of T and the size of the
+// vectors they touch, plus a memmove of the entries that follow the first
+// vector of T.  The space in A->i and A->x is doubled if it is too small, so
+// that later updates can use the remaining space without reallocating.
+
+// Returns GrB_NO_VALUE if this method does not apply, because T has a vector
+// that is not present in the hyperlist of A.  In that case, A is unchanged.
+
+#include "GB.h"
+#include "wait/GB_wait.h"
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_FREE_WORK (&K, K_size) ;         \
+}
+
+GrB_Info GB_wait_inplace        // A = A+T, in place
+(
+    GrB_Matrix A,               // matrix to modify
+    const GrB_Matrix T,         // assembled pending tuples, hypersparse
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A for wait inplace", GB0) ;
+    ASSERT_MATRIX_OK (T, "T for wait inplace", GB0) ;
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (GB_IS_HYPERSPARSE (T)) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+    ASSERT (!GB_ANY_PENDING_WORK (T)) ;
+    ASSERT (A->iso == T->iso) ;
+    ASSERT (A->type == T->type) ;
+
+    GrB_Info info ;
+    int64_t *restrict K = NULL ; size_t K_size = 0 ;
+
+    const int64_t *restrict Tp = T->p ;
+    const int64_t *restrict Th = T->h ;
+    const int64_t *restrict Ti = T->i ;
+    const GB_void *restrict Tx = (GB_void *) T->x ;
+    const int64_t tnvec = T->nvec ;
+    const int64_t tnz = GB_nnz (T) ;
+
+    const int64_t *restrict Ah = A->h ;
+    const int64_t anvec = A->nvec ;
+    const int64_t anz = GB_nnz (A) ;
+    const bool A_iso = A->iso ;
+    const size_t asize = A->type->size ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+
+    //--------------------------------------------------------------------------
+    // find the vectors of T in A
+    //--------------------------------------------------------------------------
+
+    // K [t] = k if the vector j = Th [t] is A(:,k)
+
+    K = GB_MALLOC_WORK (tnvec, int64_t, &K_size) ;
+    if (K == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    int64_t nmissing = 0 ;
+    int64_t t ;
+    int nthreads = GB_nthreads (tnvec, chunk, nthreads_max) ;
+    if (Ah == NULL)
+    {
+        // A is sparse, so all vectors are present
+        GB_memcpy (K, Th, tnvec * sizeof (int64_t), nthreads) ;
+    }
+    else
+    {
+        // A is hypersparse: look for each vector j in A->h
+        const int64_t *restrict Ap = A->p ;
+        const int64_t *restrict A_Yp = (A->Y == NULL) ? NULL : A->Y->p ;
+        const int64_t *restrict A_Yi = (A->Y == NULL) ? NULL : A->Y->i ;
+        const int64_t *restrict A_Yx = (A->Y == NULL) ? NULL : A->Y->x ;
+        const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:nmissing)
+        for (t = 0 ; t < tnvec ; t++)
+        {
+            int64_t pA_start, pA_end ;
+            int64_t k = GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yp, A_Yi, A_Yx,
+                A_hash_bits, Th [t], &pA_start, &pA_end) ;
+            K [t] = k ;
+            nmissing += (k < 0) ;
+        }
+    }
+
+    if (nmissing > 0)
+    {
+        // T has vectors not in A->h; this method does not apply
+        GB_FREE_ALL ;
+        return (GrB_NO_VALUE) ;
+    }
+
+    GB_BURBLE_MATRIX (A, "(in place) ") ;
+
+    //--------------------------------------------------------------------------
+    // make sure A has enough space for the new entries
+    //--------------------------------------------------------------------------
+
+    const int64_t anz_new = anz + tnz ;
+    if (anz_new > GB_nnz_max (A))
+    {
+        // double the size if not enough space
+        info = GB_ix_realloc (A, 2 * anz_new) ;
+        if (info != GrB_SUCCESS)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (info) ;
+        }
+    }
+
+    int64_t *restrict Ap = A->p ;
+    int64_t *restrict Ai = A->i ;
+    GB_void *restrict Ax = (GB_void *) A->x ;
+
+    //--------------------------------------------------------------------------
+    // shift and merge the entries of A, from the last vector to the first
+    //--------------------------------------------------------------------------
+
+    // The entries of A(:,k) move up by the number of entries in T that are in
+    // vectors before A(:,k).  On input, A(:,K[t]) is held in Ap [K[t]] to
+    // Ap [K[t]+1]-1.  On output, it is merged with T(:,t) and held in
+    // Ap [K[t]]+Tp [t] to Ap [K[t]+1]+Tp [t+1]-1.  Entries are only moved
+    // upwards, so each memmove and the backward merge are safe.
+
+    int64_t pend = anz ;            // A->i [pend...] has been moved already
+    int64_t nempty = 0 ;            // # of vectors of A that were empty
+
+    for (t = tnvec - 1 ; t >= 0 ; t--)
+    {
+
+        //----------------------------------------------------------------------
+        // move the vectors of A that follow A(:,k) and precede the next one
+        //----------------------------------------------------------------------
+
+        const int64_t k = K [t] ;
+        const int64_t pA_start = Ap [k] ;
+        const int64_t pA_end = Ap [k+1] ;
+        const int64_t shift = Tp [t+1] ;
+        const int64_t nrun = pend - pA_end ;
+        if (nrun > 0)
+        {
+            memmove (Ai + pA_end + shift, Ai + pA_end,
+                nrun * sizeof (int64_t)) ;
+            if (!A_iso)
+            {
+                memmove (Ax + (pA_end + shift) * asize, Ax + pA_end * asize,
+                    nrun * asize) ;
+            }
+        }
+        nempty += (pA_end == pA_start) ;
+
+        //----------------------------------------------------------------------
+        // merge T(:,t) into A(:,k), backwards
+        //----------------------------------------------------------------------
+
+        int64_t pA = pA_end - 1 ;
+        int64_t pT = Tp [t+1] - 1 ;
+        int64_t pC = pA_end + shift - 1 ;
+        const int64_t pT_start = Tp [t] ;
+        while (pT >= pT_start)
+        {
+            if (pA >= pA_start && Ai [pA] > Ti [pT])
+            {
+                // C(i,j) = A(i,j)
+                Ai [pC] = Ai [pA] ;
+                if (!A_iso)
+                {
+                    memcpy (Ax + pC * asize, Ax + pA * asize, asize) ;
+                }
+                pA-- ;
+            }
+            else
+            {
+                // C(i,j) = T(i,j); the patterns of A and T are disjoint
+                ASSERT (pA < pA_start || Ai [pA] < Ti [pT]) ;
+                Ai [pC] = Ti [pT] ;
+                if (!A_iso)
+                {
+                    memcpy (Ax + pC * asize, Tx + pT * asize, asize) ;
+                }
+                pT-- ;
+            }
+            pC-- ;
+        }
+
+        // A(:,k) from pA_start to pA has not yet been moved.  It is moved by
+        // Tp [t], with the vectors that precede it, in the next iteration.
+        pend = pA + 1 ;
+    }
+
+    ASSERT (Tp [0] == 0) ;
+
+    //--------------------------------------------------------------------------
+    // update the vector pointers of A
+    //--------------------------------------------------------------------------
+
+    // Ap [k] for k in the range K [t]+1 to K [t+1] is increased by Tp [t+1]
+    // (or up to anvec if t is the last vector of T).  These ranges are
+    // disjoint, so each one can be done by a different thread.
+
+    nthreads = GB_nthreads (anvec - K [0], chunk, nthreads_max) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (t = 0 ; t < tnvec ; t++)
+    {
+        const int64_t kfirst = K [t] + 1 ;
+        const int64_t klast = (t == tnvec - 1) ? anvec : K [t+1] ;
+        const int64_t shift = Tp [t+1] ;
+        for (int64_t k = kfirst ; k <= klast ; k++)
+        {
+            Ap [k] += shift ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize A and return result
+    //--------------------------------------------------------------------------
+
+    ASSERT (Ap [anvec] == anz_new) ;
+    A->nvals = anz_new ;
+    if (A->nvec_nonempty >= 0)
+    {
+        // each vector of A that was empty is now non-empty
+        A->nvec_nonempty += nempty ;
+    }
+
+    GB_FREE_ALL ;
+    ASSERT_MATRIX_OK (A, "A after wait inplace", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -7,9 +7,12 @@
 
 //------------------------------------------------------------------------------
 
-// Finishes all work on a matrix, followed by an OpenMP flush.
+// Finishes all work on a matrix, followed by an OpenMP flush.  If A->cache_AT
+// is true, the cached transpose A->AT is also constructed, so that A can be
+// used as a transposed input by multiple user threads without contention.
 
 #include "GB.h"
+#include "transpose/GB_transpose.h"
 
 #define GB_FREE_ALL ;
 
@@ -24,7 +27,7 @@ GrB_Info GrB_Matrix_wait    // finish all work on a matrix
     // check inputs
     //--------------------------------------------------------------------------
 
-    GB_WHERE (A, "GrB_Matrix_wait (A, waitmode)") ;
+    GB_WHERE_LOGGER (A, "GrB_Matrix_wait (A, waitmode)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
 
     //--------------------------------------------------------------------------
@@ -32,12 +35,14 @@ GrB_Info GrB_Matrix_wait    // finish all work on a matrix
     //--------------------------------------------------------------------------
 
     if (waitmode != GrB_COMPLETE &&
-        (GB_ANY_PENDING_WORK (A) || GB_hyper_hash_need (A)))
+        (GB_ANY_PENDING_WORK (A) || GB_hyper_hash_need (A) ||
+        (A->cache_AT && A->AT == NULL)))
     { 
         GrB_Info info ;
         GB_BURBLE_START ("GrB_Matrix_wait") ;
         GB_OK (GB_wait (A, "matrix", Werk)) ;
         GB_OK (GB_hyper_hash_build (A, Werk)) ;
+        GB_OK (GB_transpose_cache (A, Werk)) ;
         GB_BURBLE_END ;
     }
 
@@ -10,8 +10,13 @@
 #ifndef GB_WAIT_MACROS_H
 #define GB_WAIT_MACROS_H
 
+// true if a matrix has pending tuples from concurrent GrB_setElement
+#define GB_INGEST_PENDING(A) \
+    ((A) != NULL && (A)->Ingest != NULL && (A)->Ingest->pending)
+
 // true if a matrix has pending tuples
-#define GB_PENDING(A) ((A) != NULL && (A)->Pending != NULL)
+#define GB_PENDING(A) \
+    ((A) != NULL && ((A)->Pending != NULL || GB_INGEST_PENDING (A)))
 
 // true if a matrix is allowed to have pending tuples
 #define GB_PENDING_OK(A) (GB_PENDING (A) || !GB_PENDING (A))
@@ -36,8 +36,8 @@
     /* initialize the Werk stack */                                 \
     Werk->pwerk = 0 ;
 
-// C is a matrix, vector, scalar, or descriptor
-#define GB_WHERE(C,where_string)                                    \
+// C is a matrix, vector, scalar, or descriptor, and is not modified
+#define GB_WHERE_LOGGER(C,where_string)                             \
     if (!GB_Global_GrB_init_called_get ( ))                         \
     {                                                               \
         return (GrB_PANIC) ; /* GrB_init not called */              \
@@ -51,6 +51,35 @@
         Werk->logger_size_handle = &(C->logger_size) ;              \
     }
 
+// C is a matrix, vector, or scalar, and is the output of the method.  Its
+// cached transpose C->AT (if any) is freed since C is about to be modified.
+// If C is memory-mapped, it is first copied out of its read-only mapping.
+// Any tuples from concurrent GrB_setElement are moved into C->Pending, so
+// that they come before any pending tuples added by the method.
+#define GB_WHERE(C,where_string)                                    \
+    GB_WHERE_LOGGER (C, where_string)                               \
+    if (C != NULL)                                                  \
+    {                                                               \
+        GB_Matrix_free (&(C->AT)) ;                                 \
+        if (C->mapping != NULL)                                     \
+        {                                                           \
+            GrB_Info unmap_info = GB_unmap ((GrB_Matrix) C) ;       \
+            if (unmap_info != GrB_SUCCESS)                          \
+            {                                                       \
+                return (unmap_info) ;                               \
+            }                                                       \
+        }                                                           \
+        if (GB_INGEST_PENDING (C))                                  \
+        {                                                           \
+            GrB_Info flush_info = GB_Ingest_flush ((GrB_Matrix) C,  \
+                Werk) ;                                             \
+            if (flush_info != GrB_SUCCESS)                          \
+            {                                                       \
+                return (flush_info) ;                               \
+            }                                                       \
+        }                                                           \
+    }
+
 // create the Werk, with no error logging
 #define GB_WHERE1(where_string)                                     \
     if (!GB_Global_GrB_init_called_get ( ))                         \
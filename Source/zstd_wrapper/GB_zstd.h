@@ -867,5 +867,38 @@ GBZSTD (FSE_writeNCount)
 #define ZSTD_DISABLE_ASM
 
 #include "zstd.h"
+
+//------------------------------------------------------------------------------
+// ZSTD with long-distance matching and a shared prefix
+//------------------------------------------------------------------------------
+
+// GB_zstd_long_compress compresses a block with long-distance matching, and
+// with a window large enough to hold the block and the prefix, if any.  The
+// prefix (if not NULL) is the uncompressed content of another block, which is
+// used as a dictionary.  The same prefix must be given to
+// GB_zstd_long_decompress.  Both return the size of their output, or a ZSTD
+// error code (see ZSTD_isError).
+
+size_t GB_zstd_long_compress
+(
+    void *dst,                  // compressed block
+    size_t dst_capacity,        // size of dst
+    const void *src,            // block to compress
+    size_t src_size,            // size of src
+    const void *prefix,         // shared prefix, or NULL if none
+    size_t prefix_size,         // size of the prefix
+    int level                   // compression level, 1 to 19
+) ;
+
+size_t GB_zstd_long_decompress
+(
+    void *dst,                  // uncompressed block
+    size_t dst_capacity,        // size of dst
+    const void *src,            // compressed block
+    size_t src_size,            // size of src
+    const void *prefix,         // shared prefix, or NULL if none
+    size_t prefix_size          // size of the prefix
+) ;
+
 #endif
 
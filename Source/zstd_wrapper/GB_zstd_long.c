@@ -0,0 +1,115 @@
+//------------------------------------------------------------------------------
+// GB_zstd_long: ZSTD with long-distance matching and a shared prefix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Used by GxB_COMPRESSION_ZSTD_LONG (see GB_serialize_array).  Each block of
+// an array is compressed independently, as with GxB_COMPRESSION_ZSTD, so the
+// blocks can be compressed and decompressed in parallel.  However, the first
+// block of the array serves as a shared prefix (a dictionary) for all other
+// blocks, and long-distance matching is enabled so that matches can be found
+// anywhere in the prefix or the block.  This gives a better compression ratio
+// for arrays whose content repeats across blocks, such as the indices of a
+// graph.  ZSTD itself is single-threaded (see GB_zstd.h).
+
+#include "GB.h"
+#include "zstd_wrapper/GB_zstd.h"
+
+// smallest and largest windows used: the prefix and block are each at most
+// 4MB (see GB_SERIALIZE_BLOCKSIZE_MAX)
+#define GB_ZSTD_LONG_WINDOWLOG_MIN 10
+#define GB_ZSTD_LONG_WINDOWLOG_MAX 23
+
+//------------------------------------------------------------------------------
+// GB_zstd_long_compress
+//------------------------------------------------------------------------------
+
+size_t GB_zstd_long_compress
+(
+    void *dst,                  // compressed block
+    size_t dst_capacity,        // size of dst
+    const void *src,            // block to compress
+    size_t src_size,            // size of src
+    const void *prefix,         // shared prefix, or NULL if none
+    size_t prefix_size,         // size of the prefix
+    int level                   // compression level, 1 to 19
+)
+{
+
+    ZSTD_CCtx *cctx = ZSTD_createCCtx ( ) ;
+    if (cctx == NULL)
+    { 
+        // out of memory
+        return ((size_t) -1) ;
+    }
+
+    // find the smallest window that holds the prefix and the block
+    size_t total = src_size + ((prefix == NULL) ? 0 : prefix_size) ;
+    int windowlog = GB_ZSTD_LONG_WINDOWLOG_MIN ;
+    while (windowlog < GB_ZSTD_LONG_WINDOWLOG_MAX &&
+        (((size_t) 1) << windowlog) < total)
+    { 
+        windowlog++ ;
+    }
+
+    size_t s = ZSTD_CCtx_setParameter (cctx, ZSTD_c_compressionLevel, level) ;
+    if (!ZSTD_isError (s))
+    { 
+        s = ZSTD_CCtx_setParameter (cctx, ZSTD_c_windowLog, windowlog) ;
+    }
+    if (!ZSTD_isError (s))
+    { 
+        s = ZSTD_CCtx_setParameter (cctx,
+            ZSTD_c_enableLongDistanceMatching, 1) ;
+    }
+    if (!ZSTD_isError (s) && prefix != NULL)
+    { 
+        s = ZSTD_CCtx_refPrefix (cctx, prefix, prefix_size) ;
+    }
+    if (!ZSTD_isError (s))
+    { 
+        s = ZSTD_compress2 (cctx, dst, dst_capacity, src, src_size) ;
+    }
+    ZSTD_freeCCtx (cctx) ;
+    return (s) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_zstd_long_decompress
+//------------------------------------------------------------------------------
+
+size_t GB_zstd_long_decompress
+(
+    void *dst,                  // uncompressed block
+    size_t dst_capacity,        // size of dst
+    const void *src,            // compressed block
+    size_t src_size,            // size of src
+    const void *prefix,         // shared prefix, or NULL if none
+    size_t prefix_size          // size of the prefix
+)
+{
+
+    if (prefix == NULL)
+    { 
+        // the block was compressed on its own
+        return (ZSTD_decompress (dst, dst_capacity, src, src_size)) ;
+    }
+
+    ZSTD_DCtx *dctx = ZSTD_createDCtx ( ) ;
+    if (dctx == NULL)
+    { 
+        // out of memory
+        return ((size_t) -1) ;
+    }
+    size_t s = ZSTD_DCtx_refPrefix (dctx, prefix, prefix_size) ;
+    if (!ZSTD_isError (s))
+    { 
+        s = ZSTD_decompressDCtx (dctx, dst, dst_capacity, src, src_size) ;
+    }
+    ZSTD_freeDCtx (dctx) ;
+    return (s) ;
+}
@@ -278,6 +278,26 @@
 %   test284  - test GrB_mxm using indexop-based semirings
 %   test285  - test GrB_assign (bitmap case, C<!M>+=A, whole matrix)
 %   test286  - test kron with idxop
+%   test287  - test saxpy3 with tiled coarse Gustavson tasks
+%   test288  - test GxB_mxm_reduce
+%   test289  - test GxB_mxm_select
+%   test290  - test saxpy6 vs dot2 for C=A*B with A full and few rows
+%   test291  - test the cached transpose, A->AT
+%   test292  - test the saxpy3 workspace kept in a Context
+%   test293  - test GxB_Matrix_deserialize_mmap
+%   test294  - test GxB_Matrix_serialize_stream and deserialize_stream
+%   test295  - test GxB_Matrix_deserialize_range
+%   test296  - test the checksums of a serialized blob
+%   test298  - test GxB_Matrix_serialize_delta and deserialize_delta
+%   test299  - test GxB_Matrix_read_mtx, write_mtx, and read_edges
+%   test300  - test GxB_Matrix_export_Arrow and import_Arrow
+%   test301  - test GxB_Matrix_import_borrowed
+%   test302  - test concurrent setElement
+%   test303  - test setElements and extractElements
+%   test304  - test GB_wait_inplace
+%   test305  - test background assembly of pending tuples
+%   test306  - test combining pending tuples with a hash table
+%   test307  - test the calibrated and online selection of dot2 vs saxpy
 
 % Helper functions
 
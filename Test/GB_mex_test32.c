@@ -1978,6 +1978,20 @@ void mexFunction
     GETNAME (GxB_BXNOR_BXNOR_UINT32) ;
     GETNAME (GxB_BXNOR_BXNOR_UINT64) ;
 
+    //--------------------------------------------------------------------------
+    // bitset semirings
+    //--------------------------------------------------------------------------
+
+    GETNAME (GxB_BOR_FIRST_UINT8) ;
+    GETNAME (GxB_BOR_FIRST_UINT16) ;
+    GETNAME (GxB_BOR_FIRST_UINT32) ;
+    GETNAME (GxB_BOR_FIRST_UINT64) ;
+
+    GETNAME (GxB_BOR_SECOND_UINT8) ;
+    GETNAME (GxB_BOR_SECOND_UINT16) ;
+    GETNAME (GxB_BOR_SECOND_UINT32) ;
+    GETNAME (GxB_BOR_SECOND_UINT64) ;
+
     //--------------------------------------------------------------------------
     // positional semirings
     //--------------------------------------------------------------------------
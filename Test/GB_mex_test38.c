@@ -0,0 +1,172 @@
+//------------------------------------------------------------------------------
+// GB_mex_test38: test saxpy3 with tiled coarse Gustavson tasks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A*B is computed with the Gustavson method, where C has more than
+// GB_SAXPY3_TILE_BYTES/GB_SAXPY3_TILE_ROW_BYTES rows, so that each coarse
+// Gustavson task is tiled into more than one band of rows.  The result is
+// compared with C=A*B computed by the dot product method.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "../Source/mxm/GB_AxB_saxpy3.h"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Descriptor_free (&desc_gus) ;   \
+    GrB_Descriptor_free (&desc_dot) ;   \
+    if (I != NULL) mxFree (I) ;         \
+    if (J != NULL) mxFree (J) ;         \
+    if (X != NULL) mxFree (X) ;         \
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random sparse matrix with integer values
+//------------------------------------------------------------------------------
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Type type,
+    GrB_Index nrows,
+    GrB_Index ncols,
+    GrB_Index nvals,
+    GrB_Index *I,
+    GrB_Index *J,
+    double *X
+)
+{
+    for (int64_t k = 0 ; k < nvals ; k++)
+    {
+        I [k] = simple_rand_i ( ) % nrows ;
+        J [k] = simple_rand_i ( ) % ncols ;
+        X [k] = (double) (simple_rand_i ( ) % 8) + 1 ;
+    }
+    GrB_Info info = GrB_Matrix_new (A_handle, type, nrows, ncols) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    return (GrB_Matrix_build_FP64 (*A_handle, I, J, X, nvals,
+        GrB_PLUS_FP64)) ;
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Descriptor desc_gus = NULL, desc_dot = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    int nthreads_save ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+
+    OK (GrB_Descriptor_new (&desc_gus)) ;
+    OK (GrB_Descriptor_set_INT32 (desc_gus, GxB_AxB_GUSTAVSON,
+        (GrB_Field) GxB_AxB_METHOD)) ;
+    OK (GrB_Descriptor_new (&desc_dot)) ;
+    OK (GrB_Descriptor_set_INT32 (desc_dot, GxB_AxB_DOT,
+        (GrB_Field) GxB_AxB_METHOD)) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem
+    //--------------------------------------------------------------------------
+
+    // C is m-by-n with 4 bands of rows per coarse Gustavson task.  Each
+    // column of A has about 3000 entries, so each C(:,j) has enough entries
+    // to be computed one band at a time.
+    GrB_Index m = 3 * (GB_SAXPY3_TILE_BYTES / GB_SAXPY3_TILE_ROW_BYTES) + 7 ;
+    GrB_Index k = 100 ;
+    GrB_Index n = 12 ;
+    GrB_Index anz = 300000 ;
+    GrB_Index bnz = 300 ;
+    CHECK (GB_saxpy3_nbands (m, m, true) > 1) ;
+
+    I = mxMalloc (anz * sizeof (GrB_Index)) ;
+    J = mxMalloc (anz * sizeof (GrB_Index)) ;
+    X = mxMalloc (anz * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL) ;
+    simple_rand_seed (38) ;
+
+    GrB_Semiring semirings [3] =
+    {
+        GrB_PLUS_TIMES_SEMIRING_FP64,
+        GrB_MIN_PLUS_SEMIRING_FP64,
+        GrB_PLUS_TIMES_SEMIRING_INT64
+    } ;
+    GrB_Type types [3] = { GrB_FP64, GrB_FP64, GrB_INT64 } ;
+
+    for (int ksemiring = 0 ; ksemiring < 3 ; ksemiring++)
+    {
+        GrB_Semiring semiring = semirings [ksemiring] ;
+        GrB_Type type = types [ksemiring] ;
+        OK (random_matrix (&A, type, m, k, anz, I, J, X)) ;
+        OK (random_matrix (&B, type, k, n, bnz, I, J, X)) ;
+
+        for (int asparsity = 0 ; asparsity <= 1 ; asparsity++)
+        {
+            OK (GrB_Matrix_set_INT32 (A, (asparsity == 0) ? GxB_SPARSE :
+                GxB_HYPERSPARSE, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+            for (int bsparsity = 0 ; bsparsity <= 1 ; bsparsity++)
+            {
+                OK (GrB_Matrix_set_INT32 (B, (bsparsity == 0) ? GxB_SPARSE :
+                    GxB_HYPERSPARSE, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+                {
+                    OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads,
+                        (GrB_Field) GxB_NTHREADS)) ;
+
+                    // C1 = A*B with tiled coarse Gustavson tasks
+                    OK (GrB_Matrix_new (&C1, type, m, n)) ;
+                    OK (GrB_mxm (C1, NULL, NULL, semiring, A, B, desc_gus)) ;
+
+                    // C2 = A*B with the dot product method
+                    OK (GrB_Matrix_new (&C2, type, m, n)) ;
+                    OK (GrB_mxm (C2, NULL, NULL, semiring, A, B, desc_dot)) ;
+
+                    OK (GrB_Matrix_set_INT32 (C1, GxB_SPARSE,
+                        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                    OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+                        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+                    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+                    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                    GrB_Matrix_free (&C1) ;
+                    GrB_Matrix_free (&C2) ;
+                }
+            }
+        }
+        GrB_Matrix_free (&A) ;
+        GrB_Matrix_free (&B) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test38: all tests passed\n\n") ;
+}
+
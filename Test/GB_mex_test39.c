@@ -0,0 +1,333 @@
+//------------------------------------------------------------------------------
+// GB_mex_test39: test GxB_mxm_reduce
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// s = accum (s, reduce (C<M>=A*B)) is computed with GxB_mxm_reduce, and
+// compared with C<M>=A*B computed by GrB_mxm and then reduced to a scalar with
+// GrB_Matrix_reduce_Monoid_Scalar.  If the JIT is enabled, the fused dot3
+// method is used when the mask is sparse and not complemented, the monoid is
+// the additive monoid of the semiring, and A is transposed.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&M) ;              \
+    GrB_Matrix_free (&Mempty) ;         \
+    GrB_Matrix_free (&Aempty) ;         \
+    GrB_Scalar_free (&s1) ;             \
+    GrB_Scalar_free (&s2) ;             \
+    GrB_Scalar_free (&s_udt) ;          \
+    GrB_Descriptor_free (&desc) ;       \
+    GrB_Monoid_free (&mon_udt) ;        \
+    GrB_BinaryOp_free (&op_udt) ;       \
+    GrB_Type_free (&Type_udt) ;         \
+}
+
+typedef struct { double a ; double b ; } pair_t ;
+
+void first_pair (pair_t *z, const pair_t *x, const pair_t *y) ;
+void first_pair (pair_t *z, const pair_t *x, const pair_t *y)
+{
+    (*z) = (*x) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix with small integer values
+//------------------------------------------------------------------------------
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Type type,
+    GrB_Index nrows,
+    GrB_Index ncols,
+    GrB_Index nvals,
+    int32_t nvalues         // values are in range 0:nvalues-1
+)
+{
+    GrB_Info info = GrB_Matrix_new (A_handle, type, nrows, ncols) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    for (int64_t k = 0 ; k < nvals ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % nrows ;
+        GrB_Index j = simple_rand_i ( ) % ncols ;
+        int32_t x = simple_rand_i ( ) % nvalues ;
+        info = GrB_Matrix_setElement_INT32 (*A_handle, x, i, j) ;
+        if (info != GrB_SUCCESS) return (info) ;
+    }
+    return (GrB_Matrix_wait (*A_handle, GrB_MATERIALIZE)) ;
+}
+
+//------------------------------------------------------------------------------
+// same_scalar: return true if s1 and s2 are the same
+//------------------------------------------------------------------------------
+
+static bool same_scalar (GrB_Scalar s1, GrB_Scalar s2)
+{
+    GrB_Index n1 = 0, n2 = 0 ;
+    GrB_Scalar_nvals (&n1, s1) ;
+    GrB_Scalar_nvals (&n2, s2) ;
+    if (n1 != n2) return (false) ;
+    if (n1 == 0) return (true) ;
+    double x1 = 0, x2 = 0 ;
+    GrB_Scalar_extractElement_FP64 (&x1, s1) ;
+    GrB_Scalar_extractElement_FP64 (&x2, s2) ;
+    return (x1 == x2) ;
+}
+
+//------------------------------------------------------------------------------
+// check_reduce: compare GxB_mxm_reduce with GrB_mxm and then reduce
+//------------------------------------------------------------------------------
+
+// C<Mask>=A*B has already been computed.  If C_is_empty is true, the mask has
+// no entries, so s is cleared if there is no accum, and unchanged otherwise.
+
+static GrB_Info check_reduce
+(
+    bool s_empty,           // if true, s starts with no entry
+    GrB_BinaryOp accum,
+    GrB_Monoid monoid,
+    GrB_Matrix Mask,
+    GrB_Semiring semiring,
+    GrB_Matrix A,
+    GrB_Matrix B,
+    GrB_Descriptor desc,
+    GrB_Matrix C,           // C<Mask>=A*B
+    GrB_Type type,
+    bool C_is_empty
+)
+{
+    GrB_Scalar s1 = NULL, s2 = NULL ;
+    GrB_Info info = GrB_Scalar_new (&s1, type) ;
+    if (info == GrB_SUCCESS) info = GrB_Scalar_new (&s2, type) ;
+    if (info == GrB_SUCCESS && !s_empty)
+    {
+        // s1 and s2 start with the same value
+        info = GrB_Scalar_setElement_INT32 (s1, 1000) ;
+        if (info == GrB_SUCCESS) info = GrB_Scalar_setElement_INT32 (s2, 1000);
+    }
+    if (info == GrB_SUCCESS)
+    {
+        // s1 = accum (s1, reduce (C<Mask>=A*B))
+        info = GxB_mxm_reduce (s1, accum, monoid, Mask, semiring, A, B, desc) ;
+    }
+    if (info == GrB_SUCCESS)
+    {
+        // s2 = accum (s2, reduce (C))
+        info = GrB_Matrix_reduce_Monoid_Scalar (s2, accum, monoid, C, NULL) ;
+    }
+    if (info == GrB_SUCCESS && !same_scalar (s1, s2))
+    {
+        info = GrB_PANIC ;
+    }
+    if (info == GrB_SUCCESS && C_is_empty)
+    {
+        GrB_Index nvals ;
+        GrB_Scalar_nvals (&nvals, s1) ;
+        if (nvals != ((accum == NULL || s_empty) ? 0 : 1)) info = GrB_PANIC ;
+    }
+    GrB_Scalar_free (&s1) ;
+    GrB_Scalar_free (&s2) ;
+    return (info) ;
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL, M = NULL, Mempty = NULL ;
+    GrB_Matrix Aempty = NULL ;
+    GrB_Scalar s1 = NULL, s2 = NULL, s_udt = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GrB_Type Type_udt = NULL ;
+    GrB_BinaryOp op_udt = NULL ;
+    GrB_Monoid mon_udt = NULL ;
+    simple_rand_seed (39) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem
+    //--------------------------------------------------------------------------
+
+    // C=A*B where A is m-by-k and B is k-by-n; A is transposed if A'*B is
+    // used, in which case it is held as k-by-m
+    GrB_Index m = 50, k = 40, n = 30 ;
+    OK (random_matrix (&M, GrB_BOOL, m, n, 600, 2)) ;
+    OK (GrB_Matrix_new (&Mempty, GrB_BOOL, m, n)) ;
+
+    GrB_Semiring semirings [2] =
+        { GrB_PLUS_TIMES_SEMIRING_FP64, GrB_PLUS_TIMES_SEMIRING_INT64 } ;
+    GrB_Monoid plus_monoids [2] =
+        { GrB_PLUS_MONOID_FP64, GrB_PLUS_MONOID_INT64 } ;
+    GrB_Monoid max_monoids [2] =
+        { GrB_MAX_MONOID_FP64, GrB_MAX_MONOID_INT64 } ;
+    GrB_BinaryOp accums [2] = { GrB_PLUS_FP64, GrB_PLUS_INT64 } ;
+    GrB_Type types [2] = { GrB_FP64, GrB_INT64 } ;
+
+    int ntrials = 0 ;
+    for (int ksemiring = 0 ; ksemiring < 2 ; ksemiring++)
+    {
+        GrB_Semiring semiring = semirings [ksemiring] ;
+        GrB_Type type = types [ksemiring] ;
+        for (int A_tran = 0 ; A_tran <= 1 ; A_tran++)
+        {
+            // create A and B
+            OK (random_matrix (&A, type, A_tran ? k : m, A_tran ? m : k,
+                300, 5)) ;
+            OK (random_matrix (&B, type, k, n, 300, 5)) ;
+            for (int msparsity = 0 ; msparsity <= 2 ; msparsity++)
+            {
+                // the fused method requires a sparse or hypersparse mask
+                int sparsity = (msparsity == 0) ? GxB_SPARSE :
+                    ((msparsity == 1) ? GxB_HYPERSPARSE : GxB_BITMAP) ;
+                OK (GrB_Matrix_set_INT32 (M, sparsity,
+                    (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                OK (GrB_Matrix_set_INT32 (Mempty, sparsity,
+                    (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                for (int kmask = 0 ; kmask <= 4 ; kmask++)
+                {
+                    // kmask 0: no mask, 1: M, 2: structural M, 3: !M,
+                    // 4: empty mask, so C has no entries
+                    GrB_Matrix Mask = (kmask == 0) ? NULL :
+                        ((kmask == 4) ? Mempty : M) ;
+                    OK (GrB_Descriptor_new (&desc)) ;
+                    if (A_tran)
+                    {
+                        OK (GrB_Descriptor_set_INT32 (desc, GrB_TRAN,
+                            GrB_INP0)) ;
+                    }
+                    if (kmask == 2)
+                    {
+                        OK (GrB_Descriptor_set_INT32 (desc, GrB_STRUCTURE,
+                            GrB_MASK)) ;
+                    }
+                    else if (kmask == 3)
+                    {
+                        OK (GrB_Descriptor_set_INT32 (desc, GrB_COMP,
+                            GrB_MASK)) ;
+                    }
+
+                    // reference: C<Mask>=A*B
+                    OK (GrB_Matrix_new (&C, type, m, n)) ;
+                    OK (GrB_mxm (C, Mask, NULL, semiring, A, B, desc)) ;
+
+                    // compare GxB_mxm_reduce with reduce (C)
+                    for (int kmonoid = 0 ; kmonoid <= 1 ; kmonoid++)
+                    {
+                        GrB_Monoid monoid = (kmonoid == 0) ?
+                            plus_monoids [ksemiring] : max_monoids [ksemiring];
+                        for (int kaccum = 0 ; kaccum <= 1 ; kaccum++)
+                        {
+                            GrB_BinaryOp accum = (kaccum == 0) ? NULL :
+                                accums [ksemiring] ;
+                            for (int s_empty = 0 ; s_empty <= 1 ; s_empty++)
+                            {
+                                OK (check_reduce (s_empty, accum, monoid,
+                                    Mask, semiring, A, B, desc, C, type,
+                                    kmask == 4)) ;
+                                ntrials++ ;
+                            }
+                        }
+                    }
+                    GrB_Matrix_free (&C) ;
+                    GrB_Descriptor_free (&desc) ;
+                }
+            }
+            GrB_Matrix_free (&A) ;
+            GrB_Matrix_free (&B) ;
+        }
+    }
+    printf ("ntrials: %d\n", ntrials) ;
+
+    //--------------------------------------------------------------------------
+    // M with zombies and pending tuples
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A, GrB_FP64, k, m, 300, 5)) ;
+    OK (random_matrix (&B, GrB_FP64, k, n, 300, 5)) ;
+    OK (GrB_Matrix_set_INT32 (M, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_removeElement (M, 0, 0)) ;
+    OK (GrB_Matrix_removeElement (M, 3, 4)) ;
+    OK (GrB_Matrix_setElement_BOOL (M, true, 7, 2)) ;
+    OK (GrB_Matrix_setElement_BOOL (M, true, m-1, n-1)) ;
+    OK (GrB_Scalar_new (&s1, GrB_FP64)) ;
+    OK (GrB_Scalar_new (&s2, GrB_FP64)) ;
+    OK (GxB_mxm_reduce (s1, NULL, GrB_PLUS_MONOID_FP64, M,
+        GrB_PLUS_TIMES_SEMIRING_FP64, A, B, GrB_DESC_T0)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, m, n)) ;
+    OK (GrB_mxm (C, M, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+        GrB_DESC_T0)) ;
+    OK (GrB_Matrix_reduce_Monoid_Scalar (s2, NULL, GrB_PLUS_MONOID_FP64, C,
+        NULL)) ;
+    CHECK (same_scalar (s1, s2)) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_mxm_reduce (NULL, NULL, GrB_PLUS_MONOID_FP64, M,
+        GrB_PLUS_TIMES_SEMIRING_FP64, A, B, GrB_DESC_T0)) ;
+    ERR (GxB_mxm_reduce (s1, NULL, NULL, M,
+        GrB_PLUS_TIMES_SEMIRING_FP64, A, B, GrB_DESC_T0)) ;
+    ERR (GxB_mxm_reduce (s1, NULL, GrB_PLUS_MONOID_FP64, M,
+        NULL, A, B, GrB_DESC_T0)) ;
+
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR (GxB_mxm_reduce (s1, NULL, GrB_PLUS_MONOID_FP64, M,
+        GrB_PLUS_TIMES_SEMIRING_FP64, A, B, NULL)) ;
+    ERR (GxB_mxm_reduce (s1, NULL, GrB_PLUS_MONOID_FP64, Mempty,
+        GrB_PLUS_TIMES_SEMIRING_FP64, B, A, GrB_DESC_T0)) ;
+
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_mxm_reduce (s1, GxB_FIRSTI_INT64, GrB_PLUS_MONOID_FP64, M,
+        GrB_PLUS_TIMES_SEMIRING_FP64, A, B, GrB_DESC_T0)) ;
+    OK (GrB_Type_new (&Type_udt, sizeof (pair_t))) ;
+    OK (GrB_BinaryOp_new (&op_udt, (GxB_binary_function) first_pair,
+        Type_udt, Type_udt, Type_udt)) ;
+    pair_t pair_identity = { 0, 0 } ;
+    OK (GrB_Monoid_new_UDT (&mon_udt, op_udt, &pair_identity)) ;
+    ERR (GxB_mxm_reduce (s1, NULL, mon_udt, M,
+        GrB_PLUS_TIMES_SEMIRING_FP64, A, B, GrB_DESC_T0)) ;
+
+    // s cannot hold the monoid type, even if A*B has no entries and the
+    // fused dot3 method would otherwise just clear s
+    OK (GrB_Scalar_new (&s_udt, Type_udt)) ;
+    OK (GrB_Matrix_new (&Aempty, GrB_FP64, k, m)) ;
+    ERR (GxB_mxm_reduce (s_udt, NULL, GrB_PLUS_MONOID_FP64, M,
+        GrB_PLUS_TIMES_SEMIRING_FP64, Aempty, B, GrB_DESC_T0)) ;
+    ERR (GxB_mxm_reduce (s_udt, NULL, GrB_PLUS_MONOID_FP64, M,
+        GrB_PLUS_TIMES_SEMIRING_FP64, A, B, GrB_DESC_T0)) ;
+    ERR (GxB_mxm_reduce (s1, op_udt, GrB_PLUS_MONOID_FP64, M,
+        GrB_PLUS_TIMES_SEMIRING_FP64, Aempty, B, GrB_DESC_T0)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test39: all tests passed\n\n") ;
+}
+
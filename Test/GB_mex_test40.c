@@ -0,0 +1,391 @@
+//------------------------------------------------------------------------------
+// GB_mex_test40: test GxB_mxm_select
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M> = accum (C, select (A*B, Thunk)) is computed with GxB_mxm_select, and
+// compared with T=A*B computed by GrB_mxm, followed by
+// GrB_select (C, M, accum, op, T, Thunk, desc).
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&C0) ;             \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Matrix_free (&T) ;              \
+    GrB_Matrix_free (&M) ;              \
+    GrB_Scalar_free (&Thunk) ;          \
+    GrB_Scalar_free (&Empty) ;          \
+    GrB_Descriptor_free (&desc) ;       \
+    GrB_Descriptor_free (&desc_mxm) ;   \
+    GrB_Descriptor_free (&desc_sel) ;   \
+    GrB_IndexUnaryOp_free (&mod3) ;     \
+    GrB_Scalar_free (&Thunk_udt) ;      \
+    GrB_Type_free (&Type_udt) ;         \
+}
+
+void mod3_op (bool *z, const double *x, GrB_Index i, GrB_Index j,
+    const double *y) ;
+void mod3_op (bool *z, const double *x, GrB_Index i, GrB_Index j,
+    const double *y)
+{
+    (*z) = ((int64_t) ((*x) + i + j + (*y))) % 3 != 0 ;
+}
+
+#define MOD3_DEFN                                                       \
+"void mod3_op (bool *z, const double *x, GrB_Index i, GrB_Index j,  \n" \
+"    const double *y)                                               \n" \
+"{                                                                  \n" \
+"    (*z) = ((int64_t) ((*x) + i + j + (*y))) % 3 != 0 ;            \n" \
+"}"
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix with small integer values
+//------------------------------------------------------------------------------
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Type type,
+    GrB_Index nrows,
+    GrB_Index ncols,
+    GrB_Index nvals,
+    int32_t nvalues,        // values are in range 0:nvalues-1
+    bool by_row
+)
+{
+    GrB_Info info = GrB_Matrix_new (A_handle, type, nrows, ncols) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    if (by_row)
+    {
+        info = GrB_Matrix_set_INT32 (*A_handle, GrB_ROWMAJOR,
+            GrB_STORAGE_ORIENTATION_HINT) ;
+        if (info != GrB_SUCCESS) return (info) ;
+    }
+    for (int64_t k = 0 ; k < nvals ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % nrows ;
+        GrB_Index j = simple_rand_i ( ) % ncols ;
+        int32_t x = simple_rand_i ( ) % nvalues ;
+        info = GrB_Matrix_setElement_INT32 (*A_handle, x, i, j) ;
+        if (info != GrB_SUCCESS) return (info) ;
+    }
+    return (GrB_Matrix_wait (*A_handle, GrB_MATERIALIZE)) ;
+}
+
+//------------------------------------------------------------------------------
+// set_desc: set the descriptor fields
+//------------------------------------------------------------------------------
+
+static GrB_Info set_desc
+(
+    GrB_Descriptor desc,
+    bool replace,
+    int kmask,              // 2: structural mask, 3: complemented mask
+    bool A_tran
+)
+{
+    GrB_Info info = GrB_SUCCESS ;
+    if (replace)
+    {
+        info = GrB_Descriptor_set_INT32 (desc, GrB_REPLACE, GrB_OUTP) ;
+    }
+    if (info == GrB_SUCCESS && kmask == 2)
+    {
+        info = GrB_Descriptor_set_INT32 (desc, GrB_STRUCTURE, GrB_MASK) ;
+    }
+    if (info == GrB_SUCCESS && kmask == 3)
+    {
+        info = GrB_Descriptor_set_INT32 (desc, GrB_COMP, GrB_MASK) ;
+    }
+    if (info == GrB_SUCCESS && A_tran)
+    {
+        info = GrB_Descriptor_set_INT32 (desc, GrB_TRAN, GrB_INP0) ;
+    }
+    return (info) ;
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C0 = NULL, C1 = NULL, C2 = NULL, T = NULL,
+        M = NULL ;
+    GrB_Scalar Thunk = NULL, Empty = NULL, Thunk_udt = NULL ;
+    GrB_Type Type_udt = NULL ;
+    GrB_Descriptor desc = NULL, desc_mxm = NULL, desc_sel = NULL ;
+    GrB_IndexUnaryOp mod3 = NULL ;
+    simple_rand_seed (40) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem
+    //--------------------------------------------------------------------------
+
+    GrB_Index m = 40, k = 30, n = 35 ;
+    OK (GrB_Scalar_new (&Thunk, GrB_FP64)) ;
+    OK (GrB_Scalar_new (&Empty, GrB_FP64)) ;
+    OK (GxB_IndexUnaryOp_new (&mod3, (GxB_index_unary_function) mod3_op,
+        GrB_BOOL, GrB_FP64, GrB_FP64, "mod3_op", MOD3_DEFN)) ;
+
+    #define NOPS 7
+    GrB_IndexUnaryOp ops [NOPS] =
+    {
+        GrB_VALUEGT_FP64,   // T(i,j) > thunk
+        GrB_VALUENE_FP64,   // T(i,j) != thunk
+        GrB_VALUELE_INT32,  // T is typecast to int32
+        GrB_TRIL,           // positional ops
+        GrB_ROWLE,
+        GrB_OFFDIAG,
+        NULL                // user-defined op mod3
+    } ;
+    double thunks [NOPS] = { 6, 0, 4, -2, 20, 0, 1 } ;
+    ops [NOPS-1] = mod3 ;
+
+    int ntrials = 0 ;
+    for (int by_row = 0 ; by_row <= 1 ; by_row++)
+    {
+        // C0 is the initial C, held by row or by column
+        OK (random_matrix (&C0, GrB_FP64, m, n, 200, 8, by_row)) ;
+        OK (random_matrix (&M, GrB_BOOL, m, n, 300, 2, by_row)) ;
+
+        for (int A_tran = 0 ; A_tran <= 1 ; A_tran++)
+        {
+            OK (random_matrix (&A, GrB_FP64, A_tran ? k : m, A_tran ? m : k,
+                250, 4, false)) ;
+            OK (random_matrix (&B, GrB_FP64, k, n, 250, 4, by_row)) ;
+
+            for (int kop = 0 ; kop < NOPS ; kop++)
+            {
+                GrB_IndexUnaryOp op = ops [kop] ;
+                OK (GrB_Scalar_setElement_FP64 (Thunk, thunks [kop])) ;
+
+                for (int kmask = 0 ; kmask <= 3 ; kmask++)
+                {
+                    // kmask 0: no mask, 1: M, 2: structural M, 3: !M
+                    GrB_Matrix Mask = (kmask == 0) ? NULL : M ;
+                    for (int kaccum = 0 ; kaccum <= 1 ; kaccum++)
+                    {
+                        GrB_BinaryOp accum = (kaccum == 0) ? NULL :
+                            GrB_PLUS_FP64 ;
+                        for (int replace = 0 ; replace <= 1 ; replace++)
+                        {
+
+                            // desc: for GxB_mxm_select
+                            OK (GrB_Descriptor_new (&desc)) ;
+                            OK (set_desc (desc, replace, kmask, A_tran)) ;
+                            // desc_mxm: for T=A*B
+                            OK (GrB_Descriptor_new (&desc_mxm)) ;
+                            OK (set_desc (desc_mxm, false, 0, A_tran)) ;
+                            // desc_sel: for C<M>=accum(C,select(T,Thunk))
+                            OK (GrB_Descriptor_new (&desc_sel)) ;
+                            OK (set_desc (desc_sel, replace, kmask, false)) ;
+
+                            // C1<M> = accum (C1, select (A*B, Thunk))
+                            OK (GrB_Matrix_dup (&C1, C0)) ;
+                            OK (GxB_mxm_select (C1, Mask, accum,
+                                GrB_PLUS_TIMES_SEMIRING_FP64, A, B, op,
+                                Thunk, desc)) ;
+
+                            // T = A*B, C2<M> = accum (C2, select (T, Thunk))
+                            OK (GrB_Matrix_dup (&C2, C0)) ;
+                            OK (GrB_Matrix_new (&T, GrB_FP64, m, n)) ;
+                            OK (GrB_mxm (T, NULL, NULL,
+                                GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+                                desc_mxm)) ;
+                            OK (GrB_Matrix_select_Scalar (C2, Mask, accum,
+                                op, T, Thunk, desc_sel)) ;
+
+                            // compare C1 and C2
+                            OK (GrB_Matrix_set_INT32 (C1, GxB_SPARSE,
+                                (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                            OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+                                (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                            OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+                            OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+                            CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+                            GrB_Matrix_free (&C1) ;
+                            GrB_Matrix_free (&C2) ;
+                            GrB_Matrix_free (&T) ;
+                            GrB_Descriptor_free (&desc) ;
+                            GrB_Descriptor_free (&desc_mxm) ;
+                            GrB_Descriptor_free (&desc_sel) ;
+                            ntrials++ ;
+                        }
+                    }
+                }
+            }
+            GrB_Matrix_free (&A) ;
+            GrB_Matrix_free (&B) ;
+        }
+        GrB_Matrix_free (&C0) ;
+        GrB_Matrix_free (&M) ;
+    }
+    printf ("ntrials: %d\n", ntrials) ;
+
+    //--------------------------------------------------------------------------
+    // each mxm method, with the select op applied by the dot3/saxpy3 kernels
+    //--------------------------------------------------------------------------
+
+    // The dot3 and saxpy3 JIT kernels apply the op as they compute T=A*B
+    // (dot3 for C<M>=A'*B, saxpy3 with fine and coarse, Gustavson and hash
+    // tasks).  ANY_PAIR gives an iso T, and MIN_PLUS_INT32 gives a T whose
+    // type differs from the op xtype.  Both leave the op to GB_selector.
+
+    m = 600 ; k = 400 ; n = 500 ;
+    #define NMETHODS 4
+    GrB_Desc_Value methods [NMETHODS] = { GxB_DEFAULT, GxB_AxB_DOT,
+        GxB_AxB_HASH, GxB_AxB_GUSTAVSON } ;
+    #define NSEMI 3
+    GrB_Semiring semirings [NSEMI] = { GrB_PLUS_TIMES_SEMIRING_FP64,
+        GxB_ANY_PAIR_FP64, GrB_MIN_PLUS_SEMIRING_INT32 } ;
+    GrB_Type ttypes [NSEMI] = { GrB_FP64, GrB_FP64, GrB_INT32 } ;
+    OK (random_matrix (&M, GrB_BOOL, m, n, 20000, 2, false)) ;
+    GxB_JIT_Control control ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+    for (int by_row = 0 ; by_row <= 1 ; by_row++)
+    {
+        OK (random_matrix (&A, GrB_FP64, k, m, 4000, 6, by_row)) ;
+        OK (random_matrix (&B, GrB_FP64, k, n, 60000, 6, false)) ;
+        for (int kmethod = 0 ; kmethod < NMETHODS ; kmethod++)
+        {
+            for (int ksemi = 0 ; ksemi < NSEMI ; ksemi++)
+            {
+                for (int kop = 0 ; kop < NOPS ; kop++)
+                {
+                    GrB_IndexUnaryOp op = ops [kop] ;
+                    OK (GrB_Scalar_setElement_FP64 (Thunk, thunks [kop])) ;
+                    for (int kmask = 0 ; kmask <= 1 ; kmask++)
+                    {
+                        GrB_Matrix Mask = (kmask == 0) ? NULL : M ;
+                        OK (GrB_Descriptor_new (&desc)) ;
+                        OK (set_desc (desc, false, 0, true)) ;
+                        OK (GrB_Descriptor_set_INT32 (desc, methods [kmethod],
+                            (GrB_Field) GxB_AxB_METHOD)) ;
+
+                        // C1<M> = select (A'*B, Thunk)
+                        OK (GrB_Matrix_new (&C1, ttypes [ksemi], m, n)) ;
+                        OK (GrB_Matrix_set_INT32 (C1, by_row ? GrB_ROWMAJOR :
+                            GrB_COLMAJOR, GrB_STORAGE_ORIENTATION_HINT)) ;
+                        OK (GxB_mxm_select (C1, Mask, NULL, semirings [ksemi],
+                            A, B, op, Thunk, desc)) ;
+
+                        // T<M> = A'*B, C2 = select (T, Thunk)
+                        OK (GrB_Matrix_new (&T, ttypes [ksemi], m, n)) ;
+                        OK (GrB_mxm (T, Mask, NULL, semirings [ksemi], A, B,
+                            desc)) ;
+                        OK (GrB_Matrix_new (&C2, ttypes [ksemi], m, n)) ;
+                        OK (GrB_Matrix_set_INT32 (C2, by_row ? GrB_ROWMAJOR :
+                            GrB_COLMAJOR, GrB_STORAGE_ORIENTATION_HINT)) ;
+                        OK (GrB_Matrix_select_Scalar (C2, NULL, NULL, op, T,
+                            Thunk, NULL)) ;
+
+                        // compare C1 and C2
+                        OK (GrB_Matrix_set_INT32 (C1, GxB_SPARSE,
+                            (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                        OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+                            (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                        OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+                        OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+                        if (!GB_mx_isequal (C1, C2, 0)) { fflush (stdout) ; fprintf (stderr, "FAIL row %d meth %d semi %d op %d mask %d\n", by_row, kmethod, ksemi, kop, kmask) ; GxB_print (C1, 2) ; GxB_print (C2, 2) ; }
+
+                        GrB_Matrix_free (&C1) ;
+                        GrB_Matrix_free (&C2) ;
+                        GrB_Matrix_free (&T) ;
+                        GrB_Descriptor_free (&desc) ;
+                    }
+                }
+            }
+        }
+        GrB_Matrix_free (&A) ;
+        GrB_Matrix_free (&B) ;
+    }
+    GrB_Matrix_free (&M) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, control)) ;
+
+    //--------------------------------------------------------------------------
+    // C is aliased with A
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A, GrB_FP64, m, m, 300, 4, false)) ;
+    OK (GrB_Matrix_dup (&C2, A)) ;
+    OK (GrB_Scalar_setElement_FP64 (Thunk, 2)) ;
+    OK (GxB_mxm_select (A, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+        GrB_VALUEGT_FP64, Thunk, NULL)) ;
+    OK (GrB_Matrix_new (&T, GrB_FP64, m, m)) ;
+    OK (GrB_mxm (T, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, C2, C2, NULL)) ;
+    OK (GrB_Matrix_select_Scalar (C2, NULL, NULL, GrB_VALUEGT_FP64, T, Thunk,
+        NULL)) ;
+    OK (GrB_Matrix_set_INT32 (A, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, C2, 0)) ;
+    GrB_Matrix_free (&T) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&B, GrB_FP64, m, n, 100, 4, false)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, m, n)) ;
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_mxm_select (NULL, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+        GrB_VALUEGT_FP64, Thunk, NULL)) ;
+    ERR (GxB_mxm_select (C1, NULL, NULL, NULL, A, B,
+        GrB_VALUEGT_FP64, Thunk, NULL)) ;
+    ERR (GxB_mxm_select (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+        NULL, Thunk, NULL)) ;
+    ERR (GxB_mxm_select (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+        GrB_VALUEGT_FP64, NULL, NULL)) ;
+
+    expected = GrB_EMPTY_OBJECT ;
+    ERR1 (C1, GxB_mxm_select (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        A, B, GrB_VALUEGT_FP64, Empty, NULL)) ;
+
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR1 (C1, GxB_mxm_select (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        B, A, GrB_VALUEGT_FP64, Thunk, NULL)) ;
+
+    expected = GrB_DOMAIN_MISMATCH ;
+    typedef struct { double a ; double b ; } pair_t ;
+    pair_t pair = { 1, 2 } ;
+    OK (GrB_Type_new (&Type_udt, sizeof (pair_t))) ;
+    OK (GrB_Scalar_new (&Thunk_udt, Type_udt)) ;
+    OK (GrB_Scalar_setElement_UDT (Thunk_udt, &pair)) ;
+    ERR1 (C1, GxB_mxm_select (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        A, B, GrB_VALUEGT_FP64, Thunk_udt, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test40: all tests passed\n\n") ;
+}
+
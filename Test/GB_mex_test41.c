@@ -0,0 +1,181 @@
+//------------------------------------------------------------------------------
+// GB_mex_test41: test saxpy6, for C=A*B with A full and few rows
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A*B is computed where A is full with k rows, for k = 1 to 65, and B is
+// sparse or hypersparse.  With the default method and B sparse, saxpy6 is
+// used for the plus_times, plus_first, plus_second, and max_plus semirings on
+// FP32 and FP64, if k is at most 64 and at least the length of one vector (8
+// or 16 with AVX512F, 4 or 8 with AVX2, and 16 otherwise), or if k is at least
+// 2 for plus_second.  Otherwise (small k, k = 65, or any other semiring, such
+// as plus_min), the dot2 method is used instead.  If B is hypersparse, C is
+// hypersparse and saxpy3 is used.  The result is compared
+// with C=A*B computed by the dot2 method, selected with GxB_AxB_DOT.  The
+// entries of A and B are small nonzero integers, so the results are exact.
+// Zero is avoided since saxpy6 starts each sum with the identity and dot2
+// starts it with the first product, so 0*(-1) gives +0 in saxpy6 and -0 in
+// dot2, which GB_mx_isequal would report as different.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Descriptor_free (&desc_dot) ;   \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Descriptor desc_dot = NULL ;
+    int nthreads_save ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+    OK (GrB_Descriptor_new (&desc_dot)) ;
+    OK (GrB_Descriptor_set_INT32 (desc_dot, GxB_AxB_DOT,
+        (GrB_Field) GxB_AxB_METHOD)) ;
+    simple_rand_seed (41) ;
+
+    #define NSEMIRINGS 10
+    GrB_Semiring semirings [NSEMIRINGS] =
+    {
+        // semirings for saxpy6
+        GrB_PLUS_TIMES_SEMIRING_FP32,   GrB_PLUS_TIMES_SEMIRING_FP64,
+        GxB_PLUS_FIRST_FP32,            GxB_PLUS_FIRST_FP64,
+        GxB_PLUS_SECOND_FP32,           GxB_PLUS_SECOND_FP64,
+        GrB_MAX_PLUS_SEMIRING_FP32,     GrB_MAX_PLUS_SEMIRING_FP64,
+        // other semirings, not handled by saxpy6
+        GrB_PLUS_MIN_SEMIRING_FP64,     GrB_PLUS_TIMES_SEMIRING_INT64
+    } ;
+    GrB_Type types [NSEMIRINGS] =
+    {
+        GrB_FP32, GrB_FP64, GrB_FP32, GrB_FP64, GrB_FP32, GrB_FP64,
+        GrB_FP32, GrB_FP64, GrB_FP64, GrB_INT64
+    } ;
+
+    //--------------------------------------------------------------------------
+    // C=A*B with A full and k-by-n, and B sparse and n-by-m
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 300, m = 200 ;
+    int ntrials = 0 ;
+
+    for (int k = 1 ; k <= 65 ; k++)
+    {
+        // test all k from 1 to 10, and a few larger ones, including the
+        // smallest and largest that saxpy6 handles and the first k it does
+        // not (k = 65)
+        if (!(k <= 10 || k == 16 || k == 17 || k == 31 || k == 32 || k == 33
+            || k == 63 || k == 64 || k == 65)) continue ;
+
+        for (int ksemiring = 0 ; ksemiring < NSEMIRINGS ; ksemiring++)
+        {
+            GrB_Semiring semiring = semirings [ksemiring] ;
+            GrB_Type type = types [ksemiring] ;
+
+            // A = random full k-by-n matrix, not iso
+            OK (GrB_Matrix_new (&A, type, k, n)) ;
+            for (int64_t j = 0 ; j < n ; j++)
+            {
+                for (int64_t i = 0 ; i < k ; i++)
+                {
+                    int32_t x = (simple_rand_i ( ) % 4) + 1 ;
+                    if (simple_rand_i ( ) % 2) x = -x ;
+                    OK (GrB_Matrix_setElement_INT32 (A, x, i, j)) ;
+                }
+            }
+            OK (GrB_Matrix_setElement_INT32 (A, 5, 0, 0)) ;
+            OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+            for (int B_empty_cols = 0 ; B_empty_cols <= 1 ; B_empty_cols++)
+            {
+                for (int B_hyper = 0 ; B_hyper <= 1 ; B_hyper++)
+                {
+
+                    // B = random sparse n-by-m matrix.  If B_empty_cols is
+                    // false, every column of B has at least one entry, and C
+                    // is full.  Otherwise, C is bitmap.
+                    OK (GrB_Matrix_new (&B, type, n, m)) ;
+                    for (int64_t j = 0 ; j < m ; j++)
+                    {
+                        if (B_empty_cols && j % 3 == 1) continue ;
+                        int64_t bjnz = 1 + simple_rand_i ( ) % 8 ;
+                        for (int64_t p = 0 ; p < bjnz ; p++)
+                        {
+                            int64_t i = simple_rand_i ( ) % n ;
+                            int32_t x = (simple_rand_i ( ) % 3) + 1 ;
+                            if (simple_rand_i ( ) % 2) x = -x ;
+                            OK (GrB_Matrix_setElement_INT32 (B, x, i, j)) ;
+                        }
+                    }
+                    OK (GrB_Matrix_set_INT32 (B, B_hyper ? GxB_HYPERSPARSE :
+                        GxB_SPARSE, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+                    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+                    {
+                        OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads,
+                            (GrB_Field) GxB_NTHREADS)) ;
+
+                        // C1 = A*B, with saxpy6 if it applies
+                        OK (GrB_Matrix_new (&C1, type, k, m)) ;
+                        OK (GrB_mxm (C1, NULL, NULL, semiring, A, B, NULL)) ;
+
+                        // C2 = A*B with the dot2 method
+                        OK (GrB_Matrix_new (&C2, type, k, m)) ;
+                        OK (GrB_mxm (C2, NULL, NULL, semiring, A, B,
+                            desc_dot)) ;
+
+                        // compare C1 and C2
+                        OK (GrB_Matrix_set_INT32 (C1, GxB_SPARSE,
+                            (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                        OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+                            (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                        OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+                        OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+                        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                        GrB_Matrix_free (&C1) ;
+                        GrB_Matrix_free (&C2) ;
+                        ntrials++ ;
+                    }
+                    GrB_Matrix_free (&B) ;
+                }
+            }
+            GrB_Matrix_free (&A) ;
+        }
+    }
+    printf ("ntrials: %d\n", ntrials) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test41: all tests passed\n\n") ;
+}
+
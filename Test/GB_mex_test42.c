@@ -0,0 +1,404 @@
+//------------------------------------------------------------------------------
+// GB_mex_test42: test the cached transpose, A->AT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GrB_set (A, true, GxB_CACHE_TRANSPOSE) keeps A' in A->AT once it has been
+// computed by GrB_wait or GrB_mxm.  This test checks that A->AT is correct,
+// that it is reused by GrB_mxm, GrB_mxv, and GrB_vxm, that it is counted by
+// GxB_Matrix_memoryUsage, and that GB_AxB_meta prefers to transpose a matrix
+// with a cached transpose.  It also checks that A->AT is freed when A is
+// modified by GrB_setElement, GrB_assign, GrB_removeElement, an in-place
+// GrB_transpose, GrB_mxm with C aliased to A, and GrB_wait after concurrent
+// GrB_setElement, which does not free A->AT when the tuple is added.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&A2) ;             \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Vector_free (&u) ;              \
+    GrB_Vector_free (&w1) ;             \
+    GrB_Vector_free (&w2) ;             \
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random sparse matrix held by column
+//------------------------------------------------------------------------------
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Index nrows,
+    GrB_Index ncols,
+    GrB_Index nvals
+)
+{
+    GrB_Info info = GrB_Matrix_new (A_handle, GrB_FP64, nrows, ncols) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    GrB_Matrix A = *A_handle ;
+    info = GrB_Matrix_set_INT32 (A, GrB_COLMAJOR,
+        GrB_STORAGE_ORIENTATION_HINT) ;
+    for (int64_t k = 0 ; k < nvals && info == GrB_SUCCESS ; k++)
+    {
+        int64_t i = simple_rand_i ( ) % nrows ;
+        int64_t j = simple_rand_i ( ) % ncols ;
+        double x = (double) (simple_rand_i ( ) % 8) + 1 ;
+        info = GrB_Matrix_setElement_FP64 (A, x, i, j) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (A, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// check_AT: check if A->AT is the transpose of A
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&T1) ;             \
+    GrB_Matrix_free (&T2) ;             \
+}
+
+static GrB_Info check_AT (GrB_Matrix A)
+{
+    GrB_Info info ;
+    GrB_Matrix T1 = NULL, T2 = NULL ;
+    bool malloc_debug = false ;
+    CHECK (A->AT != NULL) ;
+    CHECK (A->AT->is_csc == A->is_csc) ;
+    CHECK (!GB_is_shallow (A->AT)) ;
+
+    // T1 = A->AT and T2 = A'
+    GrB_Index nrows, ncols ;
+    OK (GrB_Matrix_nrows (&nrows, A)) ;
+    OK (GrB_Matrix_ncols (&ncols, A)) ;
+    OK (GrB_Matrix_dup (&T1, A->AT)) ;
+    OK (GrB_Matrix_new (&T2, A->type, ncols, nrows)) ;
+    OK (GrB_transpose (T2, NULL, NULL, A, NULL)) ;
+    OK (GrB_Matrix_set_INT32 (T1, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (T2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (T1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (T2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (T1, T2, 0)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_mxm: check C=A'*B with A cached, and C=A*B' with B cached
+//------------------------------------------------------------------------------
+
+// A is n-by-n with a cached transpose, and A2 = A with no cached transpose.
+// B is n-by-n.
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+}
+
+static GrB_Info check_mxm (GrB_Matrix A, GrB_Matrix A2, GrB_Matrix B)
+{
+    GrB_Info info ;
+    GrB_Matrix C1 = NULL, C2 = NULL ;
+    bool malloc_debug = false ;
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, A)) ;
+
+    GrB_Semiring semirings [3] =
+    {
+        GrB_PLUS_TIMES_SEMIRING_FP64,
+        GrB_MIN_PLUS_SEMIRING_FP64,
+        GrB_PLUS_TIMES_SEMIRING_INT32   // A->AT is FP64, typecast to INT32
+    } ;
+
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        for (int atrans = 0 ; atrans <= 1 ; atrans++)
+        {
+            GrB_Descriptor desc = atrans ? GrB_DESC_T0 : GrB_DESC_T1 ;
+
+            // C1 = A'*B or B*A' using A->AT
+            OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+            if (atrans)
+            {
+                OK (GrB_mxm (C1, NULL, NULL, semirings [k], A, B, desc)) ;
+            }
+            else
+            {
+                OK (GrB_mxm (C1, NULL, NULL, semirings [k], B, A, desc)) ;
+            }
+
+            // C2 = A2'*B or B*A2' with no cached transpose
+            OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+            if (atrans)
+            {
+                OK (GrB_mxm (C2, NULL, NULL, semirings [k], A2, B, desc)) ;
+            }
+            else
+            {
+                OK (GrB_mxm (C2, NULL, NULL, semirings [k], B, A2, desc)) ;
+            }
+
+            OK (GrB_Matrix_set_INT32 (C1, GxB_SPARSE,
+                (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+            OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+                (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+            OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+            OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+            CHECK (GB_mx_isequal (C1, C2, 0)) ;
+            FREE_ALL ;
+        }
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test42
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&A2) ;             \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Vector_free (&u) ;              \
+    GrB_Vector_free (&w1) ;             \
+    GrB_Vector_free (&w2) ;             \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected = GrB_SUCCESS ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, A2 = NULL, B = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Vector u = NULL, w1 = NULL, w2 = NULL ;
+    simple_rand_seed (42) ;
+    GrB_Index n = 200 ;
+    int32_t cache ;
+
+    //--------------------------------------------------------------------------
+    // A->AT is built by GrB_wait, and reused by GrB_mxm
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A, n, n, 2000)) ;
+    OK (GrB_Matrix_get_INT32 (A, &cache, (GrB_Field) GxB_CACHE_TRANSPOSE)) ;
+    CHECK (!cache) ;
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (random_matrix (&B, n, n, 2000)) ;
+
+    // A->AT is not built when the option is set, but by GrB_wait
+    OK (GrB_Matrix_set_INT32 (A, true, (GrB_Field) GxB_CACHE_TRANSPOSE)) ;
+    OK (GrB_Matrix_get_INT32 (A, &cache, (GrB_Field) GxB_CACHE_TRANSPOSE)) ;
+    CHECK (cache) ;
+    CHECK (A->AT == NULL) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (check_AT (A)) ;
+
+    // A->AT is counted by GxB_Matrix_memoryUsage
+    size_t size_cached, size ;
+    OK (GxB_Matrix_memoryUsage (&size_cached, A)) ;
+    OK (GxB_Matrix_memoryUsage (&size, A2)) ;
+    CHECK (size_cached > size) ;
+
+    // A->AT is reused by GrB_mxm, GrB_mxv, and GrB_vxm
+    GrB_Matrix AT = A->AT ;
+    OK (check_mxm (A, A2, B)) ;
+    CHECK (A->AT == AT) ;
+
+    OK (GrB_Vector_new (&u, GrB_FP64, n)) ;
+    OK (GrB_Vector_new (&w1, GrB_FP64, n)) ;
+    OK (GrB_Vector_new (&w2, GrB_FP64, n)) ;
+    for (int64_t i = 0 ; i < n ; i += 7)
+    {
+        OK (GrB_Vector_setElement_FP64 (u, (double) i, i)) ;
+    }
+    OK (GrB_mxv (w1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, u,
+        GrB_DESC_T0)) ;
+    OK (GrB_mxv (w2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A2, u,
+        GrB_DESC_T0)) ;
+    CHECK (GB_mx_isequal ((GrB_Matrix) w1, (GrB_Matrix) w2, 0)) ;
+    OK (GrB_vxm (w1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, u, A,
+        GrB_DESC_T1)) ;
+    OK (GrB_vxm (w2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, u, A2,
+        GrB_DESC_T1)) ;
+    CHECK (GB_mx_isequal ((GrB_Matrix) w1, (GrB_Matrix) w2, 0)) ;
+    CHECK (A->AT == AT) ;
+
+    // turning the option off frees A->AT
+    OK (GrB_Matrix_set_INT32 (A, false, (GrB_Field) GxB_CACHE_TRANSPOSE)) ;
+    CHECK (A->AT == NULL) ;
+    OK (GxB_Matrix_memoryUsage (&size_cached, A)) ;
+    CHECK (size_cached == size) ;
+
+    // A->AT cannot be cached for a vector
+    expected = GrB_INVALID_VALUE ;
+    ERR1 (u, GrB_Vector_set_INT32 (u, true,
+        (GrB_Field) GxB_CACHE_TRANSPOSE)) ;
+
+    //--------------------------------------------------------------------------
+    // GrB_mxm builds A->AT on first use
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_set_INT32 (A, true, (GrB_Field) GxB_CACHE_TRANSPOSE)) ;
+    CHECK (A->AT == NULL) ;
+    OK (check_mxm (A, A2, B)) ;
+    OK (check_AT (A)) ;
+    GrB_Matrix_free (&A2) ;
+    GrB_Matrix_free (&B) ;
+
+    //--------------------------------------------------------------------------
+    // the work to transpose a matrix with a cached transpose is zero
+    //--------------------------------------------------------------------------
+
+    // C = A2*B' with C, A2, and B all held by column, where A2 is 2-by-n, B
+    // is m-by-n and much larger than A2 and C.  With no cached transposes,
+    // GB_AxB_meta would use the swap rule and compute C'=B*A2', transposing
+    // A2 instead of B.  If both A2 and B have cached transposes, the work to
+    // transpose either is zero, so C=A2*B' is computed with B->AT instead.
+
+    GrB_Index m = 1000 ;
+    OK (random_matrix (&A2, 2, n, 20)) ;
+    OK (random_matrix (&B, m, n, 10000)) ;
+    OK (GrB_Matrix_set_INT32 (A2, true, (GrB_Field) GxB_CACHE_TRANSPOSE)) ;
+    OK (GrB_Matrix_set_INT32 (B, true, (GrB_Field) GxB_CACHE_TRANSPOSE)) ;
+    CHECK (A2->AT == NULL && B->AT == NULL) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, 2, m)) ;
+    OK (GrB_Matrix_set_INT32 (C1, GrB_COLMAJOR,
+        GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A2, B,
+        GrB_DESC_T1)) ;
+    CHECK (A2->AT == NULL) ;
+    OK (check_AT (B)) ;
+
+    // compare with C2 = A2*B' computed with no cached transposes
+    OK (GrB_Matrix_set_INT32 (A2, false, (GrB_Field) GxB_CACHE_TRANSPOSE)) ;
+    OK (GrB_Matrix_set_INT32 (B, false, (GrB_Field) GxB_CACHE_TRANSPOSE)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, 2, m)) ;
+    OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A2, B,
+        GrB_DESC_T1)) ;
+    OK (GrB_Matrix_set_INT32 (C1, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+    GrB_Matrix_free (&A2) ;
+    GrB_Matrix_free (&B) ;
+    GrB_Matrix_free (&C1) ;
+    GrB_Matrix_free (&C2) ;
+
+    //--------------------------------------------------------------------------
+    // A->AT is freed when A is modified
+    //--------------------------------------------------------------------------
+
+    for (int kind = 0 ; kind <= 5 ; kind++)
+    {
+
+        // A has a valid cached transpose
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        OK (check_AT (A)) ;
+
+        switch (kind)
+        {
+            case 0 :
+                // GrB_setElement, as a pending tuple
+                OK (GrB_Matrix_setElement_FP64 (A, 99, n-1, 0)) ;
+                CHECK (A->AT == NULL) ;
+                break ;
+
+            case 1 :
+                // GrB_assign
+                OK (GrB_Matrix_assign_FP64 (A, NULL, NULL, 3, GrB_ALL, 4,
+                    GrB_ALL, 4, NULL)) ;
+                CHECK (A->AT == NULL) ;
+                break ;
+
+            case 2 :
+                // GrB_removeElement, as a zombie
+                OK (GrB_Matrix_removeElement (A, 0, 0)) ;
+                CHECK (A->AT == NULL) ;
+                break ;
+
+            case 3 :
+                // in-place transpose
+                OK (GrB_transpose (A, NULL, NULL, A, NULL)) ;
+                CHECK (A->AT == NULL) ;
+                break ;
+
+            case 4 :
+                // GrB_mxm with C aliased to A
+                OK (GrB_mxm (A, NULL, NULL, GrB_MIN_PLUS_SEMIRING_FP64, A, A,
+                    GrB_DESC_T0)) ;
+                CHECK (A->AT == NULL) ;
+                break ;
+
+            case 5 :
+                // concurrent GrB_setElement does not free A->AT, but the
+                // next GrB_wait does
+                OK (GrB_Matrix_dup (&A2, A)) ;
+                OK (GrB_Matrix_set_INT32 (A2, false,
+                    (GrB_Field) GxB_CACHE_TRANSPOSE)) ;
+                OK (GrB_Matrix_setElement_FP64 (A2, 42, 1, n-1)) ;
+                OK (GrB_Matrix_setElement_FP64 (A2, 43, n-1, 1)) ;
+                OK (GrB_Matrix_set_INT32 (A, 4,
+                    (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+                OK (GrB_Matrix_setElement_FP64 (A, 42, 1, n-1)) ;
+                OK (GrB_Matrix_setElement_FP64 (A, 43, n-1, 1)) ;
+                CHECK (A->AT != NULL) ;
+
+                // C1 = A'*B must use the new A, not the stale A->AT
+                OK (random_matrix (&B, n, n, 2000)) ;
+                OK (check_mxm (A, A2, B)) ;
+                GrB_Matrix_free (&A2) ;
+                GrB_Matrix_free (&B) ;
+                OK (GrB_Matrix_set_INT32 (A, 0,
+                    (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+                break ;
+
+            default :
+                break ;
+        }
+
+        // the next GrB_wait builds A->AT again, from the new A
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        OK (check_AT (A)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test42: all tests passed\n\n") ;
+}
@@ -0,0 +1,374 @@
+//------------------------------------------------------------------------------
+// GB_mex_test43: test the saxpy3 workspace kept in a Context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If GxB_CONTEXT_WORKSPACE_MAX is large enough, GB_AxB_saxpy3 keeps its Hf,
+// Hi, and Hx workspace in the Context between calls, and the coarse tasks of
+// the next call start counting from the mark left in Hf by the prior call.
+// This test computes C=A*B, C<M>=A*B, and C<!M>=A*B with saxpy3 (Gustavson
+// and hash, coarse and fine tasks) many times with the same workspace, and
+// compares the results with those computed with no kept workspace.  It
+// checks that the workspace is reused, that the Hf mark starts again at zero
+// when it gets close to GB_SAXPY3_HF_MARK_MAX, and that the workspace is
+// freed when GxB_CONTEXT_WORKSPACE_MAX is reduced and by GxB_Context_free.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "../Source/mxm/GB_AxB_saxpy3.h"
+
+#define NCASES 12
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random sparse matrix with integer values
+//------------------------------------------------------------------------------
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Index nrows,
+    GrB_Index ncols,
+    GrB_Index nvals
+)
+{
+    GrB_Info info = GrB_Matrix_new (A_handle, GrB_FP64, nrows, ncols) ;
+    for (int64_t k = 0 ; k < nvals && info == GrB_SUCCESS ; k++)
+    {
+        int64_t i = simple_rand_i ( ) % nrows ;
+        int64_t j = simple_rand_i ( ) % ncols ;
+        double x = (double) (simple_rand_i ( ) % 8) + 1 ;
+        info = GrB_Matrix_setElement_FP64 (*A_handle, x, i, j) ;
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_set_INT32 (*A_handle, GxB_SPARSE,
+            (GrB_Field) GxB_SPARSITY_CONTROL) ;
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GrB_Matrix_wait (*A_handle, GrB_MATERIALIZE) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// mxm_case: compute one of the NCASES products with saxpy3
+//------------------------------------------------------------------------------
+
+// kase = method + 2*(mask + 3*fine), where method is Gustavson (0) or hash
+// (1), mask is none (0), M (1), or !M (2), and fine is 0 for C=A*B with B
+// having many columns (coarse tasks), or 1 for C=A*b with b having a single
+// column (fine tasks, if more than one thread is used).
+
+static GrB_Info mxm_case
+(
+    GrB_Matrix *C_handle,
+    int kase,
+    GrB_Matrix M,
+    GrB_Matrix A,
+    GrB_Matrix B,
+    GrB_Matrix b,
+    GrB_Descriptor desc
+)
+{
+    int method = kase % 2 ;
+    int mask = (kase / 2) % 3 ;
+    int fine = kase / 6 ;
+    GrB_Matrix Bin = fine ? b : B ;
+    GrB_Index nrows, ncols ;
+    GrB_Info info = GrB_Matrix_nrows (&nrows, A) ;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_ncols (&ncols, Bin) ;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_new (C_handle, GrB_FP64,
+        nrows, ncols) ;
+    if (info == GrB_SUCCESS) info = GrB_Descriptor_set_INT32 (desc,
+        method ? GxB_AxB_HASH : GxB_AxB_GUSTAVSON,
+        (GrB_Field) GxB_AxB_METHOD) ;
+    if (info == GrB_SUCCESS) info = GrB_Descriptor_set_INT32 (desc,
+        (mask == 2) ? GrB_COMP : GxB_DEFAULT, GrB_MASK) ;
+    if (info == GrB_SUCCESS)
+    {
+        GrB_Matrix Mask = NULL ;
+        if (mask > 0)
+        {
+            // b has one column, so only the first column of M is used
+            Mask = M ;
+            if (fine)
+            {
+                GrB_Index j0 = 0 ;
+                info = GrB_Matrix_new (&Mask, GrB_BOOL, nrows, 1) ;
+                if (info == GrB_SUCCESS) info = GrB_Matrix_extract (Mask,
+                    NULL, NULL, M, GrB_ALL, nrows, &j0, 1, NULL) ;
+            }
+        }
+        if (info == GrB_SUCCESS) info = GrB_mxm (*C_handle, Mask, NULL,
+            GrB_PLUS_TIMES_SEMIRING_FP64, A, Bin, desc) ;
+        if (Mask != M) GrB_Matrix_free (&Mask) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_set_INT32 (*C_handle,
+        GxB_SPARSE, (GrB_Field) GxB_SPARSITY_CONTROL) ;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*C_handle,
+        GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// check_all_cases: compute all cases and compare with the reference results
+//------------------------------------------------------------------------------
+
+#define FREE_ALL GrB_Matrix_free (&C) ;
+
+static GrB_Info check_all_cases
+(
+    GrB_Matrix *Cref,
+    GrB_Matrix M,
+    GrB_Matrix A,
+    GrB_Matrix B,
+    GrB_Matrix b,
+    GrB_Descriptor desc
+)
+{
+    GrB_Info info ;
+    GrB_Matrix C = NULL ;
+    bool malloc_debug = false ;
+    for (int kase = 0 ; kase < NCASES ; kase++)
+    {
+        OK (mxm_case (&C, kase, M, A, B, b, desc)) ;
+        CHECK (GB_mx_isequal (C, Cref [kase], 0)) ;
+        GrB_Matrix_free (&C) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// set_Hf_mark: set the mark of the kept Hf, and fill Hf with it
+//------------------------------------------------------------------------------
+
+// All entries of the kept Hf must be in the range 0 to Hf_mark.  Setting all
+// of them equal to Hf_mark is the hardest case, since none of them may be
+// mistaken for a mark used by the next call.
+
+static void set_Hf_mark (GxB_Context Context, int64_t Hf_mark)
+{
+    GB_saxpy3_workspace_struct *W = &(Context->saxpy3_work) ;
+    int64_t n = W->Hf_size / sizeof (int64_t) ;
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        W->Hf [k] = Hf_mark ;
+    }
+    W->Hf_mark = Hf_mark ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test43
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free (&A) ;                      \
+    GrB_Matrix_free (&B) ;                      \
+    GrB_Matrix_free (&b) ;                      \
+    GrB_Matrix_free (&M) ;                      \
+    GrB_Matrix_free (&C) ;                      \
+    for (int kase = 0 ; kase < NCASES ; kase++) \
+    {                                           \
+        GrB_Matrix_free (&(Cref [kase])) ;      \
+    }                                           \
+    GrB_Descriptor_free (&desc) ;               \
+    GxB_Context_free (&Context) ;               \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, b = NULL, M = NULL, C = NULL ;
+    GrB_Matrix Cref [NCASES] ;
+    for (int kase = 0 ; kase < NCASES ; kase++)
+    {
+        Cref [kase] = NULL ;
+    }
+    GrB_Descriptor desc = NULL ;
+    GxB_Context Context = NULL ;
+    GB_saxpy3_workspace_struct *W = &(GxB_CONTEXT_WORLD->saxpy3_work) ;
+    int nthreads_save ;
+    double wmax, chunk_save ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &chunk_save)) ;
+    // use all threads, even for this small problem
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, 1)) ;
+    simple_rand_seed (43) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 2000, m = 40 ;
+    OK (random_matrix (&A, n, n, 8000)) ;
+    OK (random_matrix (&B, n, m, 200)) ;
+    OK (random_matrix (&b, n, 1, 400)) ;
+    OK (random_matrix (&M, n, m, 20000)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    int64_t bnvec = m ;
+
+    // by default, no workspace is kept
+    OK (GxB_Context_get_FP64 (GxB_CONTEXT_WORLD,
+        GxB_CONTEXT_WORKSPACE_MAX, &wmax)) ;
+    CHECK (wmax == 0) ;
+
+    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+    {
+        OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads,
+            (GrB_Field) GxB_NTHREADS)) ;
+
+        //----------------------------------------------------------------------
+        // compute the reference results with no workspace kept
+        //----------------------------------------------------------------------
+
+        OK (GxB_Context_set_FP64 (GxB_CONTEXT_WORLD,
+            GxB_CONTEXT_WORKSPACE_MAX, 0)) ;
+        for (int kase = 0 ; kase < NCASES ; kase++)
+        {
+            OK (mxm_case (&(Cref [kase]), kase, M, A, B, b, desc)) ;
+            CHECK (W->Hf == NULL && W->Hi == NULL && W->Hx == NULL) ;
+        }
+
+        //----------------------------------------------------------------------
+        // compute them again, many times, with the workspace kept
+        //----------------------------------------------------------------------
+
+        OK (GxB_Context_set_FP64 (GxB_CONTEXT_WORLD,
+            GxB_CONTEXT_WORKSPACE_MAX, 1e9)) ;
+        OK (GxB_Context_get_FP64 (GxB_CONTEXT_WORLD,
+            GxB_CONTEXT_WORKSPACE_MAX, &wmax)) ;
+        CHECK (wmax == 1e9) ;
+        for (int trial = 0 ; trial < 4 ; trial++)
+        {
+            OK (check_all_cases (Cref, M, A, B, b, desc)) ;
+            CHECK (W->Hf != NULL) ;
+        }
+
+        // C=A*B with the same problem reuses the kept Hf, and its mark
+        // grows by 4*bnvec+4
+        OK (mxm_case (&C, 0, M, A, B, b, desc)) ;
+        GrB_Matrix_free (&C) ;
+        int64_t *Hf = W->Hf ;
+        int64_t Hf_mark = W->Hf_mark ;
+        CHECK (Hf != NULL && Hf_mark > 0) ;
+        OK (mxm_case (&C, 0, M, A, B, b, desc)) ;
+        CHECK (GB_mx_isequal (C, Cref [0], 0)) ;
+        GrB_Matrix_free (&C) ;
+        CHECK (W->Hf == Hf) ;
+        CHECK (W->Hf_mark == Hf_mark + 4 * bnvec + 4) ;
+
+        //----------------------------------------------------------------------
+        // Hf mark wraparound
+        //----------------------------------------------------------------------
+
+        int64_t mark_max = GB_SAXPY3_HF_MARK_MAX - 4 * bnvec - 4 ;
+        for (int kase = 0 ; kase < NCASES ; kase++)
+        {
+            // mark_max is the largest mark that is not reset by the next
+            // call to C=A*B, where B has bnvec vectors.  b has one vector.
+            int64_t kase_bnvec = (kase < 6) ? bnvec : 1 ;
+
+            // C=A*B with the mark just below the limit: not reset
+            OK (mxm_case (&C, 0, M, A, B, b, desc)) ;
+            GrB_Matrix_free (&C) ;
+            CHECK (W->Hf != NULL) ;
+            set_Hf_mark (GxB_CONTEXT_WORLD, mark_max) ;
+            OK (mxm_case (&C, 0, M, A, B, b, desc)) ;
+            CHECK (GB_mx_isequal (C, Cref [0], 0)) ;
+            GrB_Matrix_free (&C) ;
+            CHECK (W->Hf_mark == GB_SAXPY3_HF_MARK_MAX) ;
+
+            // any case, with the mark at or past the limit: reset to zero
+            set_Hf_mark (GxB_CONTEXT_WORLD, (kase % 2) ?
+                GB_SAXPY3_HF_MARK_MAX :
+                (GB_SAXPY3_HF_MARK_MAX - 4 * kase_bnvec - 3)) ;
+            OK (mxm_case (&C, kase, M, A, B, b, desc)) ;
+            CHECK (GB_mx_isequal (C, Cref [kase], 0)) ;
+            GrB_Matrix_free (&C) ;
+            CHECK (W->Hf_mark <= 4 * kase_bnvec + 4) ;
+
+            // the next call uses the new mark
+            OK (check_all_cases (Cref, M, A, B, b, desc)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // reducing the limit frees the kept workspace
+        //----------------------------------------------------------------------
+
+        CHECK (W->Hf != NULL) ;
+        OK (GxB_Context_set_FP64 (GxB_CONTEXT_WORLD,
+            GxB_CONTEXT_WORKSPACE_MAX, 64)) ;
+        CHECK (W->Hf == NULL && W->Hi == NULL && W->Hx == NULL) ;
+        OK (check_all_cases (Cref, M, A, B, b, desc)) ;
+        CHECK (W->Hf == NULL && W->Hi == NULL && W->Hx == NULL) ;
+
+        // a negative limit is the same as zero
+        OK (GxB_Context_set_FP64 (GxB_CONTEXT_WORLD,
+            GxB_CONTEXT_WORKSPACE_MAX, -1)) ;
+        OK (GxB_Context_get_FP64 (GxB_CONTEXT_WORLD,
+            GxB_CONTEXT_WORKSPACE_MAX, &wmax)) ;
+        CHECK (wmax == 0) ;
+
+        //----------------------------------------------------------------------
+        // workspace kept in a user Context
+        //----------------------------------------------------------------------
+
+        OK (GxB_Context_new (&Context)) ;
+        OK (GxB_Context_set_INT32 (Context, GxB_CONTEXT_NTHREADS, nthreads)) ;
+        OK (GxB_Context_set_FP64 (Context, GxB_CONTEXT_WORKSPACE_MAX, 1e9)) ;
+        OK (GxB_Context_engage (Context)) ;
+        for (int trial = 0 ; trial < 3 ; trial++)
+        {
+            OK (check_all_cases (Cref, M, A, B, b, desc)) ;
+            CHECK (Context->saxpy3_work.Hf != NULL) ;
+            CHECK (W->Hf == NULL) ;
+        }
+
+        // Hf mark wraparound in the user Context
+        set_Hf_mark (Context, GB_SAXPY3_HF_MARK_MAX) ;
+        OK (check_all_cases (Cref, M, A, B, b, desc)) ;
+        CHECK (Context->saxpy3_work.Hf_mark < GB_SAXPY3_HF_MARK_MAX / 2) ;
+
+        // GxB_Context_free frees the kept workspace
+        OK (GxB_Context_disengage (Context)) ;
+        OK (GxB_Context_free (&Context)) ;
+
+        for (int kase = 0 ; kase < NCASES ; kase++)
+        {
+            GrB_Matrix_free (&(Cref [kase])) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Context_set_FP64 (GxB_CONTEXT_WORLD,
+        GxB_CONTEXT_WORKSPACE_MAX, 0)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, chunk_save)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test43: all tests passed\n\n") ;
+}
@@ -0,0 +1,369 @@
+//------------------------------------------------------------------------------
+// GB_mex_test44: test GxB_Matrix_deserialize_mmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix in each sparsity format, iso or not, held by row or by column, is
+// serialized with and without compression, written to a file, and read back
+// with GxB_Matrix_deserialize_mmap.  If the blob is not compressed, the
+// matrix must point into the mapped file; otherwise it must be a copy.  The
+// matrix is then modified in several ways, each of which must first copy it
+// out of the mapping.  The file is removed before the matrix is modified, to
+// check that the mapping stays valid.  Finally, the error cases are checked:
+// missing, empty, truncated, and corrupted files, and a mismatched type.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FILENAME "GB_mex_test44_blob.bin"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&D) ;              \
+    GrB_Descriptor_free (&desc) ;       \
+    if (blob != NULL) mxFree (blob) ;   \
+    blob = NULL ;                       \
+    remove (FILENAME) ;                 \
+}
+
+//------------------------------------------------------------------------------
+// write_file: write the first size bytes of a blob to a file
+//------------------------------------------------------------------------------
+
+static bool write_file (const void *blob, size_t size)
+{
+    FILE *f = fopen (FILENAME, "wb") ;
+    if (f == NULL) return (false) ;
+    bool ok = (size == 0) || (fwrite (blob, 1, size, f) == size) ;
+    return (fclose (f) == 0 && ok) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random n-by-n FP64 matrix
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL GrB_Matrix_free (&A) ;
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Index n,
+    int sparsity,       // GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, or GxB_FULL
+    bool iso,
+    int format          // GxB_BY_ROW or GxB_BY_COL
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix A = NULL ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_set_INT32 (A, format, GrB_STORAGE_ORIENTATION_HINT)) ;
+    if (sparsity == GxB_FULL)
+    {
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            for (int64_t j = 0 ; j < n ; j++)
+            {
+                double x = iso ? 3 : (double) (simple_rand_i ( ) % 100) ;
+                OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+            }
+        }
+    }
+    else
+    {
+        int64_t nz = (sparsity == GxB_HYPERSPARSE) ? (n / 4) : (4 * n) ;
+        for (int64_t k = 0 ; k < nz ; k++)
+        {
+            int64_t i = simple_rand_i ( ) % n ;
+            int64_t j = simple_rand_i ( ) % n ;
+            double x = iso ? 3 : (double) (simple_rand_i ( ) % 100) ;
+            OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+        }
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_set_INT32 (A, sparsity, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    CHECK (GB_sparsity (A) == sparsity) ;
+    CHECK (A->iso == iso) ;
+    (*A_handle) = A ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// modify: modify a matrix in one of several ways
+//------------------------------------------------------------------------------
+
+#define NMODIFY 6
+
+#undef  FREE_ALL
+#define FREE_ALL ;
+
+static GrB_Info modify (GrB_Matrix C, int kmodify)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    switch (kmodify)
+    {
+        case 0 :
+            // C(0,1) = 99
+            OK (GrB_Matrix_setElement_FP64 (C, 99, 0, 1)) ;
+            OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+            break ;
+        case 1 :
+            // C(0:9,0:9) = 7
+            OK (GrB_Matrix_assign_FP64 (C, NULL, NULL, 7, GrB_ALL, 10,
+                GrB_ALL, 10, NULL)) ;
+            OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+            break ;
+        case 2 :
+            // C = C'
+            OK (GrB_transpose (C, NULL, NULL, C, NULL)) ;
+            break ;
+        case 3 :
+            // change the sparsity format of C
+            OK (GrB_Matrix_set_INT32 (C, GxB_SPARSE,
+                (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+            break ;
+        case 4 :
+            // change the storage orientation of C
+            OK (GrB_Matrix_set_INT32 (C, GrB_ROWMAJOR,
+                GrB_STORAGE_ORIENTATION_HINT)) ;
+            OK (GrB_Matrix_set_INT32 (C, GrB_COLMAJOR,
+                GrB_STORAGE_ORIENTATION_HINT)) ;
+            break ;
+        default :
+            // C = -C
+            OK (GrB_Matrix_apply (C, NULL, NULL, GrB_AINV_FP64, C, NULL)) ;
+            break ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test44
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&D) ;              \
+    GrB_Descriptor_free (&desc) ;       \
+    if (blob != NULL) mxFree (blob) ;   \
+    blob = NULL ;                       \
+    remove (FILENAME) ;                 \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected = GrB_SUCCESS ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL, D = NULL ;
+    GrB_Descriptor desc = NULL ;
+    void *blob = NULL ;
+    GrB_Index blob_size = 0 ;
+    simple_rand_seed (44) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+
+    #define NMETHODS 5
+    int methods [NMETHODS] =
+    {
+        GxB_COMPRESSION_NONE,
+        GxB_COMPRESSION_NONE + GxB_COMPRESSION_CHECKSUM,
+        GxB_COMPRESSION_LZ4,
+        GxB_COMPRESSION_ZSTD,
+        GxB_COMPRESSION_ZSTD + GxB_COMPRESSION_FILTER
+    } ;
+
+    int sparsities [4] =
+    {
+        GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL
+    } ;
+
+    //--------------------------------------------------------------------------
+    // round trip through a file
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 200 ;
+    int ntrials = 0, nmapped = 0 ;
+
+    for (int ks = 0 ; ks < 4 ; ks++)
+    {
+        int sparsity = sparsities [ks] ;
+        for (int iso = 0 ; iso <= 1 ; iso++)
+        {
+            for (int by_row = 0 ; by_row <= 1 ; by_row++)
+            {
+                int format = by_row ? GxB_BY_ROW : GxB_BY_COL ;
+                OK (random_matrix (&A, n, sparsity, iso, format)) ;
+
+                for (int km = 0 ; km < NMETHODS ; km++)
+                {
+                    int method = methods [km] ;
+                    bool compressed = (km >= 2) ;
+                    OK (GrB_Descriptor_set_INT32 (desc, method,
+                        (GrB_Field) GxB_COMPRESSION)) ;
+
+                    // write A to the file
+                    OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+                    CHECK (write_file (blob, blob_size)) ;
+                    mxFree (blob) ;
+                    blob = NULL ;
+
+                    // C = A, from the file
+                    OK (GxB_Matrix_deserialize_mmap (&C, NULL, FILENAME,
+                        NULL)) ;
+                    OK (GxB_Matrix_fprint (C, "C from file", GxB_SILENT,
+                        NULL)) ;
+                    if (compressed)
+                    {
+                        // C is a copy
+                        CHECK (C->mapping == NULL) ;
+                        CHECK (!GB_is_shallow (C)) ;
+                    }
+                    else
+                    {
+                        // C points into the mapped file
+                        CHECK (C->mapping != NULL) ;
+                        CHECK (C->mapping_release == NULL) ;
+                        CHECK (GB_is_shallow (C)) ;
+                        nmapped++ ;
+                    }
+                    CHECK (GB_mx_isequal (C, A, 0)) ;
+
+                    // D = C does not modify C
+                    OK (GrB_Matrix_dup (&D, C)) ;
+                    CHECK (!GB_is_shallow (D)) ;
+                    CHECK (D->mapping == NULL) ;
+                    CHECK (GB_mx_isequal (D, A, 0)) ;
+                    CHECK ((C->mapping != NULL) == !compressed) ;
+                    GrB_Matrix_free (&D) ;
+
+                    // the mapping remains valid after the file is removed
+                    remove (FILENAME) ;
+                    CHECK (GB_mx_isequal (C, A, 0)) ;
+
+                    // modify C, and the same for D = A
+                    int kmodify = ntrials % NMODIFY ;
+                    OK (GrB_Matrix_dup (&D, A)) ;
+                    OK (modify (C, kmodify)) ;
+                    OK (modify (D, kmodify)) ;
+                    CHECK (C->mapping == NULL) ;
+                    CHECK (!GB_is_shallow (C)) ;
+                    OK (GrB_Matrix_set_INT32 (C, GxB_SPARSE,
+                        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                    OK (GrB_Matrix_set_INT32 (D, GxB_SPARSE,
+                        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                    OK (GrB_Matrix_wait (D, GrB_MATERIALIZE)) ;
+                    CHECK (GB_mx_isequal (C, D, 0)) ;
+                    GrB_Matrix_free (&C) ;
+                    GrB_Matrix_free (&D) ;
+
+                    // free a matrix that still holds its mapping
+                    OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+                    CHECK (write_file (blob, blob_size)) ;
+                    mxFree (blob) ;
+                    blob = NULL ;
+                    OK (GxB_Matrix_deserialize_mmap (&C, GrB_FP64, FILENAME,
+                        NULL)) ;
+                    CHECK ((C->mapping != NULL) == !compressed) ;
+                    GrB_Matrix_free (&C) ;
+                    remove (FILENAME) ;
+                    ntrials++ ;
+                }
+                GrB_Matrix_free (&A) ;
+            }
+        }
+    }
+    CHECK (nmapped == 4 * 2 * 2 * 2) ;
+    printf ("ntrials: %d\n", ntrials) ;
+
+    //--------------------------------------------------------------------------
+    // a larger matrix, with arrays split into many blocks
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A, 20000, GxB_SPARSE, false, GxB_BY_COL)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_COMPRESSION_NONE,
+        (GrB_Field) GxB_COMPRESSION)) ;
+    OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+    CHECK (write_file (blob, blob_size)) ;
+    OK (GxB_Matrix_deserialize_mmap (&C, NULL, FILENAME, NULL)) ;
+    CHECK (GB_mx_isequal (C, A, 0)) ;
+    OK (GrB_Matrix_setElement_FP64 (C, 1, 0, 0)) ;
+    OK (GrB_Matrix_setElement_FP64 (A, 1, 0, 0)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (C->mapping == NULL) ;
+    CHECK (!GB_is_shallow (C)) ;
+    CHECK (GB_mx_isequal (C, A, 0)) ;
+    GrB_Matrix_free (&C) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    // the file still holds the blob of A, with FP64 entries
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_deserialize_mmap (NULL, NULL, FILENAME, NULL)) ;
+    ERR (GxB_Matrix_deserialize_mmap (&C, NULL, NULL, NULL)) ;
+    CHECK (C == NULL) ;
+
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Matrix_deserialize_mmap (&C, GrB_INT32, FILENAME, NULL)) ;
+    CHECK (C == NULL) ;
+
+    // a missing file
+    remove (FILENAME) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Matrix_deserialize_mmap (&C, NULL, FILENAME, NULL)) ;
+    CHECK (C == NULL) ;
+
+    // an empty file
+    CHECK (write_file (blob, 0)) ;
+    expected = GrB_INVALID_OBJECT ;
+    ERR (GxB_Matrix_deserialize_mmap (&C, NULL, FILENAME, NULL)) ;
+    CHECK (C == NULL) ;
+
+    // truncated files
+    size_t sizes [4] = { 1, 16, blob_size / 2, blob_size - 1 } ;
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        CHECK (write_file (blob, sizes [k])) ;
+        ERR (GxB_Matrix_deserialize_mmap (&C, NULL, FILENAME, NULL)) ;
+        CHECK (C == NULL) ;
+    }
+
+    // a file that is not a blob
+    memset (blob, 0xA5, blob_size) ;
+    CHECK (write_file (blob, blob_size)) ;
+    ERR (GxB_Matrix_deserialize_mmap (&C, NULL, FILENAME, NULL)) ;
+    CHECK (C == NULL) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test44: all tests passed\n\n") ;
+}
+
@@ -0,0 +1,450 @@
+//------------------------------------------------------------------------------
+// GB_mex_test45: test GxB_Matrix_serialize_stream and deserialize_stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Matrices are serialized to a stream held in memory, and read back with
+// GxB_Matrix_deserialize_stream, GxB_Matrix_deserialize, and
+// GxB_Matrix_deserialize_mmap.  Several matrices are written to the same
+// stream, to check that each is read back with exactly the bytes it wrote.
+// A matrix with arrays larger than the stream chunk size is also written, to
+// check that no single write exceeds the chunk size.  The error cases are a
+// write function that fails, a truncated or corrupted stream, and a type that
+// does not match.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define FILENAME "GB_mex_test45_stream.bin"
+
+// the chunk size of the stream, from GB_serialize.h
+#define CHUNK (16 * 1024 * 1024)
+
+//------------------------------------------------------------------------------
+// stream held in memory
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    uint8_t *buffer ;   // bytes of the stream
+    size_t size ;       // # of bytes written
+    size_t space ;      // size of the buffer
+    size_t pos ;        // position of the next read
+    size_t maxwrite ;   // largest single write
+    int64_t nwrites ;   // # of calls to write_func
+    int64_t fail_at ;   // write_func fails on this call, if >= 0
+}
+stream_t ;
+
+static bool write_func (void *handle, const void *buffer, size_t size)
+{
+    stream_t *S = (stream_t *) handle ;
+    if (S->nwrites++ == S->fail_at) return (false) ;
+    if (S->size + size > S->space)
+    {
+        size_t space = 2 * (S->size + size) ;
+        uint8_t *p = realloc (S->buffer, space) ;
+        if (p == NULL) return (false) ;
+        S->buffer = p ;
+        S->space = space ;
+    }
+    memcpy (S->buffer + S->size, buffer, size) ;
+    S->size += size ;
+    S->maxwrite = GB_IMAX (S->maxwrite, size) ;
+    return (true) ;
+}
+
+static bool read_func (void *handle, void *buffer, size_t size)
+{
+    stream_t *S = (stream_t *) handle ;
+    if (size > S->size - S->pos) return (false) ;
+    memcpy (buffer, S->buffer + S->pos, size) ;
+    S->pos += size ;
+    return (true) ;
+}
+
+static void stream_clear (stream_t *S)
+{
+    free (S->buffer) ;
+    memset (S, 0, sizeof (stream_t)) ;
+    S->fail_at = -1 ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random n-by-n FP64 matrix
+//------------------------------------------------------------------------------
+
+#define FREE_ALL GrB_Matrix_free (&A) ;
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Index n,
+    int sparsity,       // GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, or GxB_FULL
+    bool iso,
+    int format          // GxB_BY_ROW or GxB_BY_COL
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix A = NULL ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_set_INT32 (A, format, GrB_STORAGE_ORIENTATION_HINT)) ;
+    if (sparsity == GxB_FULL)
+    {
+        OK (GrB_Matrix_assign_FP64 (A, NULL, NULL, 3, GrB_ALL, n, GrB_ALL, n,
+            NULL)) ;
+        if (!iso)
+        {
+            OK (GrB_Matrix_apply_IndexOp_INT64 (A, NULL, NULL,
+                GrB_ROWINDEX_INT64, A, 1, NULL)) ;
+        }
+    }
+    else
+    {
+        int64_t nz = (sparsity == GxB_HYPERSPARSE) ? (n / 4) : (4 * n) ;
+        for (int64_t k = 0 ; k < nz ; k++)
+        {
+            int64_t i = simple_rand_i ( ) % n ;
+            int64_t j = simple_rand_i ( ) % n ;
+            double x = iso ? 3 : (double) (simple_rand_i ( ) % 100) ;
+            OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+        }
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_set_INT32 (A, sparsity, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    CHECK (GB_sparsity (A) == sparsity) ;
+    CHECK (A->iso == iso) ;
+    (*A_handle) = A ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test45
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    for (int k = 0 ; k < 3 ; k++)       \
+    {                                   \
+        GrB_Matrix_free (&(A [k])) ;    \
+        GrB_Matrix_free (&(C [k])) ;    \
+    }                                   \
+    GrB_Type_free (&mytype) ;           \
+    GrB_Descriptor_free (&desc) ;       \
+    stream_clear (&S) ;                 \
+    remove (FILENAME) ;                 \
+}
+
+typedef struct { int32_t a ; double b ; } mytype_t ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected = GrB_SUCCESS ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A [3] = { NULL, NULL, NULL }, C [3] = { NULL, NULL, NULL } ;
+    GrB_Type mytype = NULL ;
+    GrB_Descriptor desc = NULL ;
+    stream_t S ;
+    memset (&S, 0, sizeof (stream_t)) ;
+    stream_clear (&S) ;
+    simple_rand_seed (45) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+
+    #define NMETHODS 7
+    int methods [NMETHODS] =
+    {
+        GxB_COMPRESSION_NONE,
+        GxB_COMPRESSION_NONE + GxB_COMPRESSION_CHECKSUM,
+        GxB_COMPRESSION_LZ4,
+        GxB_COMPRESSION_ZSTD,
+        GxB_COMPRESSION_ZSTD_LONG,
+        GxB_COMPRESSION_ZSTD + GxB_COMPRESSION_FILTER,
+        GxB_COMPRESSION_LZ4 + GxB_COMPRESSION_FILTER
+            + GxB_COMPRESSION_CHECKSUM
+    } ;
+
+    int sparsities [4] =
+    {
+        GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL
+    } ;
+
+    //--------------------------------------------------------------------------
+    // round trip of three matrices through a single stream
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 200 ;
+    int ntrials = 0 ;
+
+    for (int ks = 0 ; ks < 4 ; ks++)
+    {
+        int sparsity = sparsities [ks] ;
+        for (int iso = 0 ; iso <= 1 ; iso++)
+        {
+            // A [0] held by column, A [1] by row, and A [2] of another format
+            OK (random_matrix (&(A [0]), n, sparsity, iso, GxB_BY_COL)) ;
+            OK (random_matrix (&(A [1]), n, sparsity, iso, GxB_BY_ROW)) ;
+            OK (random_matrix (&(A [2]), n, sparsities [(ks+1) % 4], !iso,
+                GxB_BY_COL)) ;
+            OK (GrB_Matrix_set_String (A [1], "A1 has a name", GrB_NAME)) ;
+
+            for (int km = 0 ; km < NMETHODS ; km++)
+            {
+                OK (GrB_Descriptor_set_INT32 (desc, methods [km],
+                    (GrB_Field) GxB_COMPRESSION)) ;
+
+                // write all three matrices to the stream
+                for (int k = 0 ; k < 3 ; k++)
+                {
+                    OK (GxB_Matrix_serialize_stream (write_func, &S, A [k],
+                        desc)) ;
+                }
+
+                // read them back, in order
+                for (int k = 0 ; k < 3 ; k++)
+                {
+                    OK (GxB_Matrix_deserialize_stream (&(C [k]), NULL,
+                        read_func, &S, NULL)) ;
+                    CHECK (GB_mx_isequal (C [k], A [k], 0)) ;
+                }
+                CHECK (S.pos == S.size) ;
+                char name [GxB_MAX_NAME_LEN] ;
+                OK (GrB_Matrix_get_String (C [1], name, GrB_NAME)) ;
+                CHECK (strcmp (name, "A1 has a name") == 0) ;
+                for (int k = 0 ; k < 3 ; k++)
+                {
+                    GrB_Matrix_free (&(C [k])) ;
+                }
+                stream_clear (&S) ;
+
+                // a stream of one matrix is also a blob
+                OK (GxB_Matrix_serialize_stream (write_func, &S, A [0],
+                    desc)) ;
+                OK (GxB_Matrix_deserialize (&(C [0]), NULL, S.buffer, S.size,
+                    NULL)) ;
+                CHECK (GB_mx_isequal (C [0], A [0], 0)) ;
+                GrB_Matrix_free (&(C [0])) ;
+                int32_t code ;
+                OK (GxB_Serialized_get_INT32 (S.buffer, &code,
+                    GrB_EL_TYPE_CODE, S.size)) ;
+                CHECK (code == GrB_FP64_CODE) ;
+
+                // and it can be read from a file
+                FILE *f = fopen (FILENAME, "wb") ;
+                CHECK (f != NULL) ;
+                CHECK (fwrite (S.buffer, 1, S.size, f) == S.size) ;
+                CHECK (fclose (f) == 0) ;
+                OK (GxB_Matrix_deserialize_mmap (&(C [0]), NULL, FILENAME,
+                    NULL)) ;
+                CHECK (GB_mx_isequal (C [0], A [0], 0)) ;
+                GrB_Matrix_free (&(C [0])) ;
+                remove (FILENAME) ;
+                stream_clear (&S) ;
+                ntrials++ ;
+            }
+
+            for (int k = 0 ; k < 3 ; k++)
+            {
+                GrB_Matrix_free (&(A [k])) ;
+            }
+        }
+    }
+    printf ("ntrials: %d\n", ntrials) ;
+
+    //--------------------------------------------------------------------------
+    // a user-defined type
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Type_new (&mytype, sizeof (mytype_t), "mytype_t",
+        "typedef struct { int32_t a ; double b ; } mytype_t ;")) ;
+    OK (GrB_Matrix_new (&(A [0]), mytype, 10, 20)) ;
+    for (int k = 0 ; k < 30 ; k++)
+    {
+        mytype_t x = { .a = k, .b = 2.5 * k } ;
+        OK (GrB_Matrix_setElement_UDT (A [0], &x, k % 10, (3*k) % 20)) ;
+    }
+    OK (GrB_Matrix_wait (A [0], GrB_MATERIALIZE)) ;
+    OK (GxB_Matrix_serialize_stream (write_func, &S, A [0], NULL)) ;
+    OK (GxB_Matrix_deserialize_stream (&(C [0]), mytype, read_func, &S,
+        NULL)) ;
+    CHECK (GB_mx_isequal (C [0], A [0], 0)) ;
+    GrB_Matrix_free (&(C [0])) ;
+
+    // the type must be given for a user-defined type
+    expected = GrB_DOMAIN_MISMATCH ;
+    S.pos = 0 ;
+    ERR (GxB_Matrix_deserialize_stream (&(C [0]), NULL, read_func, &S,
+        NULL)) ;
+    CHECK (C [0] == NULL) ;
+    S.pos = 0 ;
+    ERR (GxB_Matrix_deserialize_stream (&(C [0]), GrB_FP64, read_func, &S,
+        NULL)) ;
+    CHECK (C [0] == NULL) ;
+    GrB_Matrix_free (&(A [0])) ;
+    stream_clear (&S) ;
+
+    //--------------------------------------------------------------------------
+    // a matrix with arrays larger than the chunk size
+    //--------------------------------------------------------------------------
+
+    // A is sparse with 2.5 million entries, so A->i and A->x are each 20MB
+    int64_t nbig = 100000, nzbig = 2500000 ;
+    GrB_Index *I = mxMalloc (nzbig * sizeof (GrB_Index)) ;
+    GrB_Index *J = mxMalloc (nzbig * sizeof (GrB_Index)) ;
+    double *X = mxMalloc (nzbig * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL) ;
+    for (int64_t k = 0 ; k < nzbig ; k++)
+    {
+        I [k] = simple_rand_i ( ) % nbig ;
+        J [k] = simple_rand_i ( ) % nbig ;
+        X [k] = (double) (simple_rand_i ( ) % 1000) ;
+    }
+    OK (GrB_Matrix_new (&(A [0]), GrB_FP64, nbig, nbig)) ;
+    OK (GrB_Matrix_build_FP64 (A [0], I, J, X, nzbig, GrB_PLUS_FP64)) ;
+    mxFree (I) ;
+    mxFree (J) ;
+    mxFree (X) ;
+    OK (GrB_Matrix_wait (A [0], GrB_MATERIALIZE)) ;
+
+    for (int km = 0 ; km <= 2 ; km += 2)
+    {
+        // no compression, and LZ4
+        OK (GrB_Descriptor_set_INT32 (desc, methods [km],
+            (GrB_Field) GxB_COMPRESSION)) ;
+        OK (GxB_Matrix_serialize_stream (write_func, &S, A [0], desc)) ;
+        printf ("big stream: %g MB in %ld writes, largest %g MB\n",
+            (double) S.size / 1e6, S.nwrites, (double) S.maxwrite / 1e6) ;
+        CHECK (S.maxwrite <= CHUNK) ;
+        CHECK (S.size > 2 * CHUNK || km > 0) ;
+        OK (GxB_Matrix_deserialize_stream (&(C [0]), NULL, read_func, &S,
+            NULL)) ;
+        CHECK (S.pos == S.size) ;
+        CHECK (GB_mx_isequal (C [0], A [0], 0)) ;
+        GrB_Matrix_free (&(C [0])) ;
+        stream_clear (&S) ;
+    }
+    GrB_Matrix_free (&(A [0])) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&(A [0]), n, GxB_HYPERSPARSE, false, GxB_BY_COL)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_COMPRESSION_LZ4 +
+        GxB_COMPRESSION_CHECKSUM, (GrB_Field) GxB_COMPRESSION)) ;
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_serialize_stream (NULL, &S, A [0], desc)) ;
+    ERR (GxB_Matrix_serialize_stream (write_func, &S, NULL, desc)) ;
+    ERR (GxB_Matrix_deserialize_stream (NULL, NULL, read_func, &S, NULL)) ;
+    ERR (GxB_Matrix_deserialize_stream (&(C [0]), NULL, NULL, &S, NULL)) ;
+
+    // the write function fails on each of its calls in turn
+    OK (GxB_Matrix_serialize_stream (write_func, &S, A [0], desc)) ;
+    int64_t nwrites = S.nwrites ;
+    size_t size = S.size ;
+    uint8_t *good = mxMalloc (size) ;
+    CHECK (good != NULL) ;
+    memcpy (good, S.buffer, size) ;
+    printf ("stream of %ld bytes in %ld writes\n", size, nwrites) ;
+    CHECK (nwrites > 5) ;
+    expected = GrB_INVALID_VALUE ;
+    for (int64_t k = 0 ; k < nwrites ; k++)
+    {
+        stream_clear (&S) ;
+        S.fail_at = k ;
+        ERR (GxB_Matrix_serialize_stream (write_func, &S, A [0], desc)) ;
+        CHECK (S.nwrites == k + 1) ;
+    }
+    stream_clear (&S) ;
+
+    // the stream is truncated
+    expected = GrB_INVALID_OBJECT ;
+    for (size_t len = 0 ; len < size ; len += GB_IMAX (1, len / 8))
+    {
+        stream_clear (&S) ;
+        CHECK (write_func (&S, good, len)) ;
+        ERR (GxB_Matrix_deserialize_stream (&(C [0]), NULL, read_func, &S,
+            NULL)) ;
+        CHECK (C [0] == NULL) ;
+    }
+
+    // a byte in the stream is corrupted; the header is checked for
+    // consistency, and the data blocks by their checksums
+    int ncorrupt = 0 ;
+    for (size_t p = 0 ; p < size ; p += 7)
+    {
+        stream_clear (&S) ;
+        CHECK (write_func (&S, good, size)) ;
+        S.buffer [p] ^= 0x5A ;
+        info = GxB_Matrix_deserialize_stream (&(C [0]), NULL, read_func, &S,
+            NULL) ;
+        if (info == GrB_SUCCESS)
+        {
+            // the byte was not used (padding, or an unused field)
+            GrB_Matrix_free (&(C [0])) ;
+        }
+        else
+        {
+            CHECK (info == GrB_INVALID_OBJECT || info == GrB_DOMAIN_MISMATCH
+                || info == GrB_OUT_OF_MEMORY) ;
+            CHECK (C [0] == NULL) ;
+            ncorrupt++ ;
+        }
+    }
+    printf ("corrupted streams detected: %d\n", ncorrupt) ;
+    CHECK (ncorrupt > 0) ;
+
+    // the last data block is corrupted, which only its checksum can detect
+    stream_clear (&S) ;
+    CHECK (write_func (&S, good, size)) ;
+    // the stream ends with the GrB_NAME and GrB_EL_TYPE_STRING of A [0]
+    char eltype [GxB_MAX_NAME_LEN] ;
+    OK (GrB_Matrix_get_String (A [0], eltype, GrB_EL_TYPE_STRING)) ;
+    size_t tail = strlen ("") + 1 + strlen (eltype) + 1 ;
+    S.buffer [size - tail - 1] ^= 0x01 ;
+    ERR (GxB_Matrix_deserialize_stream (&(C [0]), NULL, read_func, &S,
+        NULL)) ;
+    CHECK (C [0] == NULL) ;
+
+    // the type does not match
+    stream_clear (&S) ;
+    CHECK (write_func (&S, good, size)) ;
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Matrix_deserialize_stream (&(C [0]), GrB_INT64, read_func, &S,
+        NULL)) ;
+    CHECK (C [0] == NULL) ;
+
+    // the uncorrupted stream can still be read
+    stream_clear (&S) ;
+    CHECK (write_func (&S, good, size)) ;
+    OK (GxB_Matrix_deserialize_stream (&(C [0]), GrB_FP64, read_func, &S,
+        NULL)) ;
+    CHECK (GB_mx_isequal (C [0], A [0], 0)) ;
+    mxFree (good) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test45: all tests passed\n\n") ;
+}
+
@@ -0,0 +1,493 @@
+//------------------------------------------------------------------------------
+// GB_mex_test46: test GxB_Matrix_deserialize_range
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C = A(first:last,:) and C = A(:,first:last) are deserialized from a blob
+// holding A, and compared with the same submatrix extracted by GrB_extract.
+// A is sparse, hypersparse, bitmap, or full, iso or not, held by row or by
+// column, and is large enough that its arrays are split into many blocks.
+// If the range is a set of vectors of A, only part of the blob is
+// decompressed; otherwise the whole blob is deserialized.  Both cases are
+// tested, with and without the pattern option, and for a blob written by
+// GxB_Matrix_serialize_stream.  A blob with checksums is corrupted, one byte
+// at a time, and any range that is returned must still be correct.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "serialize/GB_serialize.h"
+
+//------------------------------------------------------------------------------
+// stream written to memory
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    uint8_t *buffer ;   // bytes of the stream
+    size_t size ;       // # of bytes written
+    size_t space ;      // size of the buffer
+}
+stream_t ;
+
+static bool write_func (void *handle, const void *buffer, size_t size)
+{
+    stream_t *S = (stream_t *) handle ;
+    if (S->size + size > S->space)
+    {
+        size_t space = 2 * (S->size + size) ;
+        uint8_t *p = realloc (S->buffer, space) ;
+        if (p == NULL) return (false) ;
+        S->buffer = p ;
+        S->space = space ;
+    }
+    memcpy (S->buffer + S->size, buffer, size) ;
+    S->size += size ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random m-by-n FP64 matrix
+//------------------------------------------------------------------------------
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    if (I != NULL) mxFree (I) ;         \
+    if (J != NULL) mxFree (J) ;         \
+    if (X != NULL) mxFree (X) ;         \
+}
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Index m,
+    GrB_Index n,
+    GrB_Index nz,       // # of entries to create, for a sparse matrix
+    int sparsity,       // GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, or GxB_FULL
+    bool iso,
+    int format          // GxB_BY_ROW or GxB_BY_COL
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix A = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    OK (GrB_Matrix_set_INT32 (A, format, GrB_STORAGE_ORIENTATION_HINT)) ;
+    if (sparsity == GxB_FULL)
+    {
+        OK (GrB_Matrix_assign_FP64 (A, NULL, NULL, 3, GrB_ALL, m, GrB_ALL, n,
+            NULL)) ;
+    }
+    else
+    {
+        I = mxMalloc (nz * sizeof (GrB_Index)) ;
+        J = mxMalloc (nz * sizeof (GrB_Index)) ;
+        X = mxMalloc (nz * sizeof (double)) ;
+        CHECK (I != NULL && J != NULL && X != NULL) ;
+        for (int64_t k = 0 ; k < nz ; k++)
+        {
+            I [k] = simple_rand_i ( ) % m ;
+            J [k] = simple_rand_i ( ) % n ;
+            X [k] = 3 ;
+        }
+        OK (GrB_Matrix_build_FP64 (A, I, J, X, nz, GrB_SECOND_FP64)) ;
+    }
+    if (!iso)
+    {
+        // A(i,j) = i + A(i,j)
+        OK (GrB_Matrix_apply_IndexOp_INT64 (A, NULL, GrB_PLUS_FP64,
+            GrB_ROWINDEX_INT64, A, 0, NULL)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_set_INT32 (A, sparsity, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    CHECK (GB_sparsity (A) == sparsity) ;
+    CHECK (A->iso == iso) ;
+    (*A_handle) = A ;
+    A = NULL ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_range: check C = A(first:last,:) or A(:,first:last) from a blob
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&R) ;              \
+    GrB_Matrix_free (&P) ;              \
+}
+
+static GrB_Info check_range
+(
+    GrB_Matrix A,           // matrix held in the blob
+    const void *blob,
+    GrB_Index blob_size,
+    int format,             // GxB_BY_ROW or GxB_BY_COL
+    GrB_Index first,
+    GrB_Index last,
+    bool pattern
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix C = NULL, R = NULL, P = NULL ;
+    GrB_Index nrows, ncols, range [2] = { first, last } ;
+    OK (GrB_Matrix_nrows (&nrows, A)) ;
+    OK (GrB_Matrix_ncols (&ncols, A)) ;
+
+    // C = the range of A, from the blob
+    OK (GxB_Matrix_deserialize_range (&C, NULL, blob, blob_size, format,
+        first, last, pattern, NULL)) ;
+
+    // R = the same range of A, from GrB_extract
+    if (format == GxB_BY_ROW)
+    {
+        OK (GrB_Matrix_new (&R, GrB_FP64, last - first + 1, ncols)) ;
+        OK (GrB_Matrix_extract (R, NULL, NULL, A, range, GxB_RANGE, GrB_ALL,
+            ncols, NULL)) ;
+    }
+    else
+    {
+        OK (GrB_Matrix_new (&R, GrB_FP64, nrows, last - first + 1)) ;
+        OK (GrB_Matrix_extract (R, NULL, NULL, A, GrB_ALL, nrows, range,
+            GxB_RANGE, NULL)) ;
+    }
+    if (pattern)
+    {
+        // P = the pattern of R, as an iso GrB_BOOL matrix
+        GrB_Index pnrows, pncols ;
+        OK (GrB_Matrix_nrows (&pnrows, R)) ;
+        OK (GrB_Matrix_ncols (&pncols, R)) ;
+        OK (GrB_Matrix_new (&P, GrB_BOOL, pnrows, pncols)) ;
+        OK (GrB_Matrix_assign_BOOL (P, R, NULL, true, GrB_ALL, pnrows,
+            GrB_ALL, pncols, GrB_DESC_S)) ;
+        GrB_Matrix_free (&R) ;
+        R = P ;
+        P = NULL ;
+        CHECK (C->type == GrB_BOOL) ;
+        CHECK (C->iso) ;
+    }
+
+    // compare C and R
+    OK (GrB_Matrix_set_INT32 (C, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (R, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (C, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (R, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (R, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C, R, 0)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_ranges: check many ranges of a blob
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL ;
+
+static GrB_Info check_ranges
+(
+    GrB_Matrix A,           // matrix held in the blob
+    const void *blob,
+    GrB_Index blob_size
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Index nrows, ncols ;
+    OK (GrB_Matrix_nrows (&nrows, A)) ;
+    OK (GrB_Matrix_ncols (&ncols, A)) ;
+    for (int by_col = 0 ; by_col <= 1 ; by_col++)
+    {
+        int format = by_col ? GxB_BY_COL : GxB_BY_ROW ;
+        int64_t dim = by_col ? ncols : nrows ;
+        int64_t a = simple_rand_i ( ) % dim ;
+        int64_t b = simple_rand_i ( ) % dim ;
+        int64_t ranges [6][2] =
+        {
+            { 0, 0 },                   // the first vector
+            { dim-1, dim-1 },           // the last vector
+            { 0, dim-1 },               // all vectors
+            { GB_IMIN (a,b), GB_IMAX (a,b) },   // a random range
+            { dim/3, dim/3 + 7 },       // a few vectors
+            { 0, dim/2 },               // the first half
+        } ;
+        for (int k = 0 ; k < 6 ; k++)
+        {
+            int64_t first = ranges [k][0] ;
+            int64_t last  = GB_IMIN (ranges [k][1], dim-1) ;
+            for (int pattern = 0 ; pattern <= 1 ; pattern++)
+            {
+                OK (check_range (A, blob, blob_size, format, first, last,
+                    pattern)) ;
+            }
+        }
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test46
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&R) ;              \
+    GrB_Descriptor_free (&desc) ;       \
+    if (blob != NULL) mxFree (blob) ;   \
+    blob = NULL ;                       \
+    free (S.buffer) ;                   \
+    S.buffer = NULL ;                   \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected = GrB_SUCCESS ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL, R = NULL ;
+    GrB_Descriptor desc = NULL ;
+    void *blob = NULL ;
+    GrB_Index blob_size = 0 ;
+    stream_t S = { NULL, 0, 0 } ;
+    simple_rand_seed (46) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    int nthreads_save ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+
+    #define NMETHODS 6
+    int methods [NMETHODS] =
+    {
+        GxB_COMPRESSION_NONE,
+        GxB_COMPRESSION_LZ4,
+        GxB_COMPRESSION_LZ4HC,
+        GxB_COMPRESSION_ZSTD + GxB_COMPRESSION_CHECKSUM,
+        GxB_COMPRESSION_ZSTD_LONG,
+        GxB_COMPRESSION_ZSTD + GxB_COMPRESSION_FILTER
+    } ;
+
+    int sparsities [4] =
+    {
+        GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL
+    } ;
+
+    //--------------------------------------------------------------------------
+    // ranges of a blob
+    //--------------------------------------------------------------------------
+
+    int ntrials = 0 ;
+    for (int ks = 0 ; ks < 4 ; ks++)
+    {
+        int sparsity = sparsities [ks] ;
+        // A is large enough that its arrays are split into many blocks
+        GrB_Index m = 2000, n = 3000, nz = 200000 ;
+        if (sparsity == GxB_HYPERSPARSE)
+        {
+            m = 2000 ; n = 1000000 ; nz = 20000 ;
+        }
+        else if (sparsity == GxB_BITMAP || sparsity == GxB_FULL)
+        {
+            m = 300 ; n = 700 ; nz = 40000 ;
+        }
+        for (int iso = 0 ; iso <= 1 ; iso++)
+        {
+            for (int by_col = 0 ; by_col <= 1 ; by_col++)
+            {
+                OK (random_matrix (&A, m, n, nz, sparsity, iso,
+                    by_col ? GxB_BY_COL : GxB_BY_ROW)) ;
+                for (int km = 0 ; km < NMETHODS ; km++)
+                {
+                    // use 4 threads so the arrays are split into more blocks
+                    OK (GrB_Global_set_INT32 (GrB_GLOBAL, 4,
+                        (GrB_Field) GxB_NTHREADS)) ;
+                    OK (GrB_Descriptor_set_INT32 (desc, methods [km],
+                        (GrB_Field) GxB_COMPRESSION)) ;
+                    OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+                    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+                    {
+                        OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads,
+                            (GrB_Field) GxB_NTHREADS)) ;
+                        OK (check_ranges (A, blob, blob_size)) ;
+                    }
+                    mxFree (blob) ;
+                    blob = NULL ;
+                    ntrials++ ;
+                }
+
+                // a streamed blob is deserialized in full
+                OK (GxB_Matrix_serialize_stream (write_func, &S, A, NULL)) ;
+                OK (check_ranges (A, S.buffer, S.size)) ;
+                free (S.buffer) ;
+                S.buffer = NULL ;
+                S.size = 0 ;
+                S.space = 0 ;
+                GrB_Matrix_free (&A) ;
+            }
+        }
+    }
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+    printf ("ntrials: %d\n", ntrials) ;
+
+    //--------------------------------------------------------------------------
+    // a range of an empty matrix, and of a matrix with a name
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_INT32, 10, 20)) ;
+    OK (GrB_Matrix_set_String (A, "A has a name", GrB_NAME)) ;
+    OK (GxB_Matrix_serialize (&blob, &blob_size, A, NULL)) ;
+    OK (GxB_Matrix_deserialize_range (&C, GrB_INT32, blob, blob_size,
+        GxB_BY_COL, 3, 5, false, NULL)) ;
+    GrB_Index nrows, ncols, nvals ;
+    OK (GrB_Matrix_nrows (&nrows, C)) ;
+    OK (GrB_Matrix_ncols (&ncols, C)) ;
+    OK (GrB_Matrix_nvals (&nvals, C)) ;
+    CHECK (nrows == 10 && ncols == 3 && nvals == 0) ;
+    CHECK (C->type == GrB_INT32) ;
+    char name [GxB_MAX_NAME_LEN] ;
+    OK (GrB_Matrix_get_String (C, name, GrB_NAME)) ;
+    CHECK (strcmp (name, "A has a name") == 0) ;
+    GrB_Matrix_free (&C) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_deserialize_range (NULL, NULL, blob, blob_size,
+        GxB_BY_COL, 0, 0, false, NULL)) ;
+    ERR (GxB_Matrix_deserialize_range (&C, NULL, NULL, blob_size,
+        GxB_BY_COL, 0, 0, false, NULL)) ;
+    CHECK (C == NULL) ;
+
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Matrix_deserialize_range (&C, NULL, blob, blob_size,
+        GxB_BY_COL, 5, 4, false, NULL)) ;
+    CHECK (C == NULL) ;
+    ERR (GxB_Matrix_deserialize_range (&C, NULL, blob, blob_size,
+        GxB_NO_FORMAT, 0, 0, false, NULL)) ;
+    CHECK (C == NULL) ;
+
+    expected = GrB_INDEX_OUT_OF_BOUNDS ;
+    ERR (GxB_Matrix_deserialize_range (&C, NULL, blob, blob_size,
+        GxB_BY_COL, 0, 20, false, NULL)) ;
+    CHECK (C == NULL) ;
+    ERR (GxB_Matrix_deserialize_range (&C, NULL, blob, blob_size,
+        GxB_BY_ROW, 10, 10, false, NULL)) ;
+    CHECK (C == NULL) ;
+
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Matrix_deserialize_range (&C, GrB_FP64, blob, blob_size,
+        GxB_BY_COL, 0, 0, false, NULL)) ;
+    CHECK (C == NULL) ;
+
+    expected = GrB_INVALID_OBJECT ;
+    ERR (GxB_Matrix_deserialize_range (&C, NULL, blob, 16,
+        GxB_BY_COL, 0, 0, false, NULL)) ;
+    CHECK (C == NULL) ;
+    mxFree (blob) ;
+    blob = NULL ;
+    GrB_Matrix_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // truncated and corrupted blobs
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A, 500, 600, 20000, GxB_SPARSE, false, GxB_BY_COL)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_COMPRESSION_LZ4 +
+        GxB_COMPRESSION_CHECKSUM, (GrB_Field) GxB_COMPRESSION)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, 4, (GrB_Field) GxB_NTHREADS)) ;
+    OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+    GrB_Index range [2] = { 100, 199 } ;
+    OK (GrB_Matrix_new (&R, GrB_FP64, 500, 100)) ;
+    OK (GrB_Matrix_extract (R, NULL, NULL, A, GrB_ALL, 500, range, GxB_RANGE,
+        NULL)) ;
+    OK (GrB_Matrix_set_INT32 (R, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (R, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_wait (R, GrB_MATERIALIZE)) ;
+
+    // any truncated blob is rejected
+    for (size_t len = 0 ; len < blob_size ; len += GB_IMAX (1, len / 8))
+    {
+        info = GxB_Matrix_deserialize_range (&C, NULL, blob, len,
+            GxB_BY_COL, 100, 199, false, NULL) ;
+        CHECK (info == GrB_INVALID_OBJECT || info == GrB_DOMAIN_MISMATCH) ;
+        CHECK (C == NULL) ;
+    }
+
+    // a corrupted byte in the blob is either detected, or is not used.  The
+    // fixed-size header of the blob (the dimensions, the type, and so on) is
+    // not covered by the checksums, so a corrupted header may give a valid
+    // matrix that differs from A; only the checksums are tested here.
+    uint8_t *p = (uint8_t *) blob ;
+    int ncorrupt = 0, nok = 0 ;
+    for (size_t k = 0 ; k < blob_size ; k += 5)
+    {
+        p [k] ^= 0x5A ;
+        info = GxB_Matrix_deserialize_range (&C, NULL, blob, blob_size,
+            GxB_BY_COL, 100, 199, false, NULL) ;
+        p [k] ^= 0x5A ;
+        if (info == GrB_SUCCESS)
+        {
+            if (k >= GB_BLOB_HEADER_SIZE)
+            {
+                // the range is correct
+                OK (GrB_Matrix_set_INT32 (C, GxB_SPARSE,
+                    (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                CHECK (GB_mx_isequal (C, R, 0)) ;
+                nok++ ;
+            }
+            GrB_Matrix_free (&C) ;
+        }
+        else
+        {
+            CHECK (info == GrB_INVALID_OBJECT || info == GrB_DOMAIN_MISMATCH
+                || info == GrB_OUT_OF_MEMORY
+                || info == GrB_INDEX_OUT_OF_BOUNDS) ;
+            CHECK (C == NULL) ;
+            ncorrupt++ ;
+        }
+    }
+    printf ("corrupted blobs: %d detected, %d not used\n", ncorrupt, nok) ;
+    CHECK (ncorrupt > 0 && nok > 0) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test46: all tests passed\n\n") ;
+}
+
@@ -0,0 +1,382 @@
+//------------------------------------------------------------------------------
+// GB_mex_test47: test the checksums of a serialized blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix is serialized with GxB_COMPRESSION_CHECKSUM, with each compression
+// method, and each byte of the blob after its fixed-size header is then
+// corrupted in turn.  If the blob is compressed, every byte of its blocks is
+// covered by a checksum, so every corruption must be detected, with
+// GrB_INVALID_OBJECT.  If the blob is not compressed, the zero padding
+// between its arrays is not covered, so a corruption must be either detected,
+// or not change the matrix.  A single entry of an uncompressed blob is then
+// corrupted: this must be detected by each method that deserializes a blob,
+// and must go undetected (giving a different matrix) without the checksums.
+// The GxB_BLOB_CHECKSUM digest of the blob is also checked.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "serialize/GB_serialize.h"
+
+#define FILENAME "GB_mex_test47_blob.bin"
+
+//------------------------------------------------------------------------------
+// stream held in memory
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    uint8_t *buffer ;   // bytes of the stream
+    size_t size ;       // # of bytes written
+    size_t space ;      // size of the buffer
+    size_t pos ;        // position of the next read
+}
+stream_t ;
+
+static bool write_func (void *handle, const void *buffer, size_t size)
+{
+    stream_t *S = (stream_t *) handle ;
+    if (S->size + size > S->space)
+    {
+        size_t space = 2 * (S->size + size) ;
+        uint8_t *p = realloc (S->buffer, space) ;
+        if (p == NULL) return (false) ;
+        S->buffer = p ;
+        S->space = space ;
+    }
+    memcpy (S->buffer + S->size, buffer, size) ;
+    S->size += size ;
+    return (true) ;
+}
+
+static bool read_func (void *handle, void *buffer, size_t size)
+{
+    stream_t *S = (stream_t *) handle ;
+    if (size > S->size - S->pos) return (false) ;
+    memcpy (buffer, S->buffer + S->pos, size) ;
+    S->pos += size ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// find_entry: find the 8 bytes of a double value in a blob
+//------------------------------------------------------------------------------
+
+static int64_t find_entry (const uint8_t *blob, size_t blob_size, double x)
+{
+    int64_t found = -1 ;
+    for (size_t k = 0 ; k + sizeof (double) <= blob_size ; k++)
+    {
+        if (memcmp (blob + k, &x, sizeof (double)) == 0)
+        {
+            // the value must appear exactly once
+            if (found >= 0) return (-1) ;
+            found = k ;
+        }
+    }
+    return (found) ;
+}
+
+//------------------------------------------------------------------------------
+// write_file: write a blob to a file
+//------------------------------------------------------------------------------
+
+static bool write_file (const void *blob, size_t size)
+{
+    FILE *f = fopen (FILENAME, "wb") ;
+    if (f == NULL) return (false) ;
+    bool ok = (fwrite (blob, 1, size, f) == size) ;
+    return (fclose (f) == 0 && ok) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test47
+//------------------------------------------------------------------------------
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Vector_free (&v) ;              \
+    GrB_Vector_free (&w) ;              \
+    GrB_Descriptor_free (&desc) ;       \
+    if (blob != NULL) mxFree (blob) ;   \
+    blob = NULL ;                       \
+    if (blob2 != NULL) mxFree (blob2) ; \
+    blob2 = NULL ;                      \
+    free (S.buffer) ;                   \
+    S.buffer = NULL ;                   \
+    remove (FILENAME) ;                 \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected = GrB_SUCCESS ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL ;
+    GrB_Vector v = NULL, w = NULL ;
+    GrB_Descriptor desc = NULL ;
+    void *blob = NULL, *blob2 = NULL ;
+    GrB_Index blob_size = 0, blob2_size = 0 ;
+    stream_t S = { NULL, 0, 0, 0 } ;
+    simple_rand_seed (47) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    int nthreads_save ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+
+    //--------------------------------------------------------------------------
+    // create the test matrix
+    //--------------------------------------------------------------------------
+
+    // A is 300-by-400 with 3000 entries, whose values are all distinct, so
+    // the bytes of any one value appear in an uncompressed blob only once
+    GrB_Index m = 300, n = 400 ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    for (int64_t k = 0 ; k < 3000 ; k++)
+    {
+        int64_t i = simple_rand_i ( ) % m ;
+        int64_t j = simple_rand_i ( ) % n ;
+        OK (GrB_Matrix_setElement_FP64 (A, 1000.25 + k, i, j)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_set_INT32 (A, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    char eltype [GxB_MAX_NAME_LEN] ;
+    OK (GrB_Matrix_get_String (A, eltype, GrB_EL_TYPE_STRING)) ;
+
+    #define NMETHODS 6
+    int methods [NMETHODS] =
+    {
+        GxB_COMPRESSION_NONE,
+        GxB_COMPRESSION_LZ4,
+        GxB_COMPRESSION_LZ4HC,
+        GxB_COMPRESSION_ZSTD,
+        GxB_COMPRESSION_ZSTD_LONG,
+        GxB_COMPRESSION_ZSTD + GxB_COMPRESSION_FILTER
+    } ;
+
+    //--------------------------------------------------------------------------
+    // corrupt each byte of a blob
+    //--------------------------------------------------------------------------
+
+    for (int km = 0 ; km < NMETHODS ; km++)
+    {
+        bool compressed = (km > 0) ;
+        for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+        {
+            OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads,
+                (GrB_Field) GxB_NTHREADS)) ;
+
+            // blob2: without checksums
+            OK (GrB_Descriptor_set_INT32 (desc, methods [km],
+                (GrB_Field) GxB_COMPRESSION)) ;
+            OK (GxB_Matrix_serialize (&blob2, &blob2_size, A, desc)) ;
+            size_t digest = 1 ;
+            OK (GxB_Serialized_get_SIZE (blob2, &digest, GxB_BLOB_CHECKSUM,
+                blob2_size)) ;
+            CHECK (digest == 0) ;
+
+            // blob: with checksums
+            OK (GrB_Descriptor_set_INT32 (desc, methods [km] +
+                GxB_COMPRESSION_CHECKSUM, (GrB_Field) GxB_COMPRESSION)) ;
+            OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+            OK (GxB_Serialized_get_SIZE (blob, &digest, GxB_BLOB_CHECKSUM,
+                blob_size)) ;
+            CHECK (digest != 0) ;
+            CHECK (blob_size > blob2_size) ;
+
+            // the digest is the same for the same blob
+            size_t digest2 = 0 ;
+            mxFree (blob2) ;
+            OK (GxB_Matrix_serialize (&blob2, &blob2_size, A, desc)) ;
+            CHECK (blob2_size == blob_size) ;
+            CHECK (memcmp (blob, blob2, blob_size) == 0) ;
+            OK (GxB_Serialized_get_SIZE (blob2, &digest2, GxB_BLOB_CHECKSUM,
+                blob2_size)) ;
+            CHECK (digest == digest2) ;
+            mxFree (blob2) ;
+            blob2 = NULL ;
+
+            // the blob is valid
+            OK (GxB_Matrix_deserialize (&C, NULL, blob, blob_size, NULL)) ;
+            CHECK (GB_mx_isequal (C, A, 0)) ;
+            GrB_Matrix_free (&C) ;
+
+            // the blob ends with the GrB_NAME (an empty string, or none) and
+            // the GrB_EL_TYPE_STRING of A, which are not covered by the
+            // checksums
+            size_t tail = 1 + strlen (eltype) + 1 ;
+            uint8_t *p = (uint8_t *) blob ;
+            int ndetected = 0, nunused = 0 ;
+            for (size_t k = GB_BLOB_HEADER_SIZE ; k < blob_size - tail ; k++)
+            {
+                p [k] ^= 0x10 ;
+                info = GxB_Matrix_deserialize (&C, NULL, blob, blob_size,
+                    NULL) ;
+                p [k] ^= 0x10 ;
+                if (info == GrB_SUCCESS)
+                {
+                    // only padding of an uncompressed blob is not covered
+                    CHECK (!compressed) ;
+                    CHECK (GB_mx_isequal (C, A, 0)) ;
+                    GrB_Matrix_free (&C) ;
+                    nunused++ ;
+                }
+                else
+                {
+                    CHECK (info == GrB_INVALID_OBJECT) ;
+                    CHECK (C == NULL) ;
+                    ndetected++ ;
+                }
+            }
+            printf ("method %d, nthreads %d: blob size %ld, %d corruptions "
+                "detected, %d in padding\n", methods [km], nthreads,
+                blob_size, ndetected, nunused) ;
+            CHECK (ndetected > 0) ;
+            mxFree (blob) ;
+            blob = NULL ;
+        }
+    }
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+
+    //--------------------------------------------------------------------------
+    // corrupt one entry of an uncompressed blob
+    //--------------------------------------------------------------------------
+
+    // blob: with checksums, and blob2: without
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_COMPRESSION_NONE +
+        GxB_COMPRESSION_CHECKSUM, (GrB_Field) GxB_COMPRESSION)) ;
+    OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_COMPRESSION_NONE,
+        (GrB_Field) GxB_COMPRESSION)) ;
+    OK (GxB_Matrix_serialize (&blob2, &blob2_size, A, desc)) ;
+
+    // find the entry A(i,j) = 1500.25 in each blob
+    GrB_Index I [1], J [1] ;
+    double X [1] ;
+    GrB_Index nvals = 1 ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, m, n)) ;
+    OK (GrB_Matrix_select_FP64 (C, NULL, NULL, GrB_VALUEEQ_FP64, A, 1500.25,
+        NULL)) ;
+    OK (GrB_Matrix_extractTuples_FP64 (I, J, X, &nvals, C)) ;
+    CHECK (nvals == 1) ;
+    GrB_Matrix_free (&C) ;
+    int64_t k1 = find_entry (blob, blob_size, 1500.25) ;
+    int64_t k2 = find_entry (blob2, blob2_size, 1500.25) ;
+    CHECK (k1 >= GB_BLOB_HEADER_SIZE && k2 >= GB_BLOB_HEADER_SIZE) ;
+    ((uint8_t *) blob ) [k1] ^= 0x01 ;
+    ((uint8_t *) blob2) [k2] ^= 0x01 ;
+
+    // without checksums, the corrupted entry is not detected
+    OK (GxB_Matrix_deserialize (&C, NULL, blob2, blob2_size, NULL)) ;
+    CHECK (!GB_mx_isequal (C, A, 0)) ;
+    double x ;
+    OK (GrB_Matrix_extractElement_FP64 (&x, C, I [0], J [0])) ;
+    CHECK (x != 1500.25) ;
+    GrB_Matrix_free (&C) ;
+
+    // with checksums, it is detected by each method
+    expected = GrB_INVALID_OBJECT ;
+    ERR (GxB_Matrix_deserialize (&C, NULL, blob, blob_size, NULL)) ;
+    CHECK (C == NULL) ;
+    ERR (GrB_Matrix_deserialize (&C, NULL, blob, blob_size)) ;
+    CHECK (C == NULL) ;
+    // a range of the vectors of A that includes the corrupted entry
+    int format = A->is_csc ? GxB_BY_COL : GxB_BY_ROW ;
+    GrB_Index vector = A->is_csc ? J [0] : I [0] ;
+    ERR (GxB_Matrix_deserialize_range (&C, NULL, blob, blob_size,
+        format, vector, vector, false, NULL)) ;
+    CHECK (C == NULL) ;
+    CHECK (write_file (blob, blob_size)) ;
+    ERR (GxB_Matrix_deserialize_mmap (&C, NULL, FILENAME, NULL)) ;
+    CHECK (C == NULL) ;
+    remove (FILENAME) ;
+
+    // the pattern of the range does not need the values of A
+    OK (GxB_Matrix_deserialize_range (&C, NULL, blob, blob_size,
+        format, vector, vector, true, NULL)) ;
+    GrB_Matrix_free (&C) ;
+
+    // the uncorrupted blob can be read by each method
+    ((uint8_t *) blob ) [k1] ^= 0x01 ;
+    OK (GxB_Matrix_deserialize (&C, NULL, blob, blob_size, NULL)) ;
+    CHECK (GB_mx_isequal (C, A, 0)) ;
+    GrB_Matrix_free (&C) ;
+    CHECK (write_file (blob, blob_size)) ;
+    OK (GxB_Matrix_deserialize_mmap (&C, NULL, FILENAME, NULL)) ;
+    CHECK (GB_mx_isequal (C, A, 0)) ;
+    GrB_Matrix_free (&C) ;
+    remove (FILENAME) ;
+    mxFree (blob) ;
+    blob = NULL ;
+    mxFree (blob2) ;
+    blob2 = NULL ;
+
+    //--------------------------------------------------------------------------
+    // corrupt one entry of an uncompressed stream
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_COMPRESSION_NONE +
+        GxB_COMPRESSION_CHECKSUM, (GrB_Field) GxB_COMPRESSION)) ;
+    OK (GxB_Matrix_serialize_stream (write_func, &S, A, desc)) ;
+    k1 = find_entry (S.buffer, S.size, 1500.25) ;
+    CHECK (k1 >= GB_BLOB_HEADER_SIZE) ;
+    S.buffer [k1] ^= 0x01 ;
+    ERR (GxB_Matrix_deserialize_stream (&C, NULL, read_func, &S, NULL)) ;
+    CHECK (C == NULL) ;
+    S.pos = 0 ;
+    ERR (GxB_Matrix_deserialize (&C, NULL, S.buffer, S.size, NULL)) ;
+    CHECK (C == NULL) ;
+    S.buffer [k1] ^= 0x01 ;
+    S.pos = 0 ;
+    OK (GxB_Matrix_deserialize_stream (&C, NULL, read_func, &S, NULL)) ;
+    CHECK (GB_mx_isequal (C, A, 0)) ;
+    GrB_Matrix_free (&C) ;
+
+    //--------------------------------------------------------------------------
+    // corrupt one entry of a vector
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&v, GrB_FP64, 1000)) ;
+    for (int64_t i = 0 ; i < 1000 ; i += 3)
+    {
+        OK (GrB_Vector_setElement_FP64 (v, 2000.5 + i, i)) ;
+    }
+    OK (GrB_Vector_wait (v, GrB_MATERIALIZE)) ;
+    OK (GxB_Vector_serialize (&blob, &blob_size, v, desc)) ;
+    OK (GxB_Vector_deserialize (&w, NULL, blob, blob_size, NULL)) ;
+    CHECK (GB_mx_isequal ((GrB_Matrix) w, (GrB_Matrix) v, 0)) ;
+    GrB_Vector_free (&w) ;
+    k1 = find_entry (blob, blob_size, 2000.5 + 30) ;
+    CHECK (k1 >= GB_BLOB_HEADER_SIZE) ;
+    ((uint8_t *) blob) [k1] ^= 0x01 ;
+    ERR (GxB_Vector_deserialize (&w, NULL, blob, blob_size, NULL)) ;
+    CHECK (w == NULL) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test47: all tests passed\n\n") ;
+}
+
@@ -0,0 +1,598 @@
+//------------------------------------------------------------------------------
+// GB_mex_test48: test GxB_Matrix_serialize_delta and deserialize_delta
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A complete snapshot of a matrix A is written with
+// GxB_Matrix_serialize_delta, and deserialized into C.  A is then modified in
+// a sequence of steps, and after each step, a delta is written with the blob
+// of the prior step as its base, and applied to C, which must then match A.
+// Each delta must be much smaller than a complete snapshot, and a delta with
+// no changes must leave C unchanged.  A delta computed from the first
+// snapshot is also applied to a second copy of it, and a delta applied to the
+// wrong matrix must be rejected without modifying it.  This is done for each
+// sparsity format, iso and non-iso matrices, both formats, and several
+// compression methods.  The error cases of both methods are then checked.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "serialize/GB_serialize.h"
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix
+//------------------------------------------------------------------------------
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    if (I != NULL) mxFree (I) ;         \
+    if (J != NULL) mxFree (J) ;         \
+    if (X != NULL) mxFree (X) ;         \
+}
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Index m,
+    GrB_Index n,
+    GrB_Index nz,       // # of entries to create, for a sparse matrix
+    int sparsity,       // GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, or GxB_FULL
+    bool iso,
+    int format          // GxB_BY_ROW or GxB_BY_COL
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix A = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    OK (GrB_Matrix_set_INT32 (A, format, GrB_STORAGE_ORIENTATION_HINT)) ;
+    if (sparsity == GxB_FULL)
+    {
+        OK (GrB_Matrix_assign_FP64 (A, NULL, NULL, 3, GrB_ALL, m, GrB_ALL, n,
+            NULL)) ;
+    }
+    else
+    {
+        I = mxMalloc (nz * sizeof (GrB_Index)) ;
+        J = mxMalloc (nz * sizeof (GrB_Index)) ;
+        X = mxMalloc (nz * sizeof (double)) ;
+        CHECK (I != NULL && J != NULL && X != NULL) ;
+        for (int64_t k = 0 ; k < nz ; k++)
+        {
+            I [k] = simple_rand_i ( ) % m ;
+            J [k] = simple_rand_i ( ) % n ;
+            X [k] = 3 ;
+        }
+        OK (GrB_Matrix_build_FP64 (A, I, J, X, nz, GrB_SECOND_FP64)) ;
+    }
+    if (!iso)
+    {
+        // A(i,j) = i + A(i,j)
+        OK (GrB_Matrix_apply_IndexOp_INT64 (A, NULL, GrB_PLUS_FP64,
+            GrB_ROWINDEX_INT64, A, 0, NULL)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_set_INT32 (A, sparsity, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    CHECK (GB_sparsity (A) == sparsity) ;
+    CHECK (A->iso == iso) ;
+    (*A_handle) = A ;
+    A = NULL ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_same: check if C and A hold the same matrix
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Matrix_free (&A2) ;             \
+}
+
+static GrB_Info check_same
+(
+    GrB_Matrix C,
+    GrB_Matrix A
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix C2 = NULL, A2 = NULL ;
+    OK (GrB_Matrix_dup (&C2, C)) ;
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C2, A2, 0)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// modify: change the entries of a single vector of A
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL ;
+
+static GrB_Info modify
+(
+    GrB_Matrix A,
+    GrB_Index k,            // vector of A to change
+    double x,               // new value of the changed entries
+    bool delete             // if true, also delete an entry
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Index m, n ;
+    OK (GrB_Matrix_nrows (&m, A)) ;
+    OK (GrB_Matrix_ncols (&n, A)) ;
+    int32_t sparsity, format ;
+    OK (GrB_Matrix_get_INT32 (A, &sparsity,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_get_INT32 (A, &format, GrB_STORAGE_ORIENTATION_HINT)) ;
+    bool by_col = (format == GrB_COLMAJOR) ;
+    GrB_Index vlen = by_col ? m : n ;
+    for (int t = 0 ; t < 4 ; t++)
+    {
+        GrB_Index r = simple_rand_i ( ) % vlen ;
+        GrB_Index i = by_col ? r : k ;
+        GrB_Index j = by_col ? k : r ;
+        OK (GrB_Matrix_setElement_FP64 (A, x + t, i, j)) ;
+    }
+    if (delete)
+    {
+        GrB_Index r = simple_rand_i ( ) % vlen ;
+        GrB_Index i = by_col ? r : k ;
+        GrB_Index j = by_col ? k : r ;
+        OK (GrB_Matrix_removeElement (A, i, j)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test48
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                            \
+{                                           \
+    GrB_Matrix_free (&A) ;                  \
+    GrB_Matrix_free (&C) ;                  \
+    GrB_Matrix_free (&C0) ;                 \
+    GrB_Matrix_free (&E) ;                  \
+    GrB_Matrix_free (&B) ;                  \
+    GrB_Descriptor_free (&desc) ;           \
+    if (base != NULL) mxFree (base) ;       \
+    base = NULL ;                           \
+    if (prev != NULL) mxFree (prev) ;       \
+    prev = NULL ;                           \
+    if (delta != NULL) mxFree (delta) ;     \
+    delta = NULL ;                          \
+    if (blob != NULL) mxFree (blob) ;       \
+    blob = NULL ;                           \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected = GrB_SUCCESS ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL, C0 = NULL, E = NULL, B = NULL ;
+    GrB_Descriptor desc = NULL ;
+    void *base = NULL, *prev = NULL, *delta = NULL, *blob = NULL ;
+    GrB_Index base_size = 0, prev_size = 0, delta_size = 0, blob_size = 0 ;
+    simple_rand_seed (48) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    char name [GxB_MAX_NAME_LEN] ;
+
+    #define NMETHODS 4
+    int methods [NMETHODS] =
+    {
+        GxB_COMPRESSION_NONE,
+        GxB_COMPRESSION_LZ4,
+        GxB_COMPRESSION_ZSTD + GxB_COMPRESSION_FILTER,
+        GxB_COMPRESSION_NONE + GxB_COMPRESSION_CHECKSUM,
+    } ;
+
+    int sparsities [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL } ;
+
+    //--------------------------------------------------------------------------
+    // apply a sequence of deltas
+    //--------------------------------------------------------------------------
+
+    // A is 1024-by-1024, so its vectors are held in 16 groups of 64 vectors
+    GrB_Index n = 1024 ;
+    int64_t ngroups = GB_ICEIL (n, GB_DELTA_GSIZE (n)) ;
+    CHECK (ngroups == 16) ;
+
+    for (int ks = 0 ; ks < 4 ; ks++)
+    {
+        int sparsity = sparsities [ks] ;
+        for (int iso = 0 ; iso <= 1 ; iso++)
+        {
+            for (int format = GxB_BY_ROW ; format <= GxB_BY_COL ; format++)
+            {
+                for (int km = 0 ; km < NMETHODS ; km++)
+                {
+                    OK (GrB_Descriptor_set_INT32 (desc, methods [km],
+                        (GrB_Field) GxB_COMPRESSION)) ;
+                    OK (random_matrix (&A, n, n, 20000, sparsity, iso,
+                        format)) ;
+
+                    //----------------------------------------------------------
+                    // write a complete snapshot of A and deserialize it
+                    //----------------------------------------------------------
+
+                    OK (GxB_Matrix_serialize_delta (&base, &base_size, A,
+                        NULL, 0, desc)) ;
+                    OK (GxB_Matrix_deserialize (&C, GrB_FP64, base,
+                        base_size, NULL)) ;
+                    OK (check_same (C, A)) ;
+                    OK (GrB_Matrix_deserialize (&C0, GrB_FP64, base,
+                        base_size)) ;
+                    OK (check_same (C0, A)) ;
+
+                    // C keeps its name and sparsity control
+                    OK (GrB_Matrix_set_String (C, "C has a name", GrB_NAME)) ;
+                    int C_sparsity = sparsities [(ks + 1) % 4] ;
+                    OK (GrB_Matrix_set_INT32 (C, C_sparsity,
+                        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+
+                    // a complete snapshot can be applied to any matrix of the
+                    // same type, dimensions, and format
+                    OK (GrB_Matrix_new (&E, GrB_FP64, n, n)) ;
+                    OK (GrB_Matrix_set_INT32 (E, format,
+                        GrB_STORAGE_ORIENTATION_HINT)) ;
+                    OK (GrB_Matrix_set_String (E, "E has a name", GrB_NAME)) ;
+                    OK (GxB_Matrix_deserialize_delta (E, base, base_size,
+                        NULL)) ;
+                    OK (check_same (E, A)) ;
+                    OK (GrB_Matrix_get_String (E, name, GrB_NAME)) ;
+                    CHECK (strcmp (name, "E has a name") == 0) ;
+                    GrB_Matrix_free (&E) ;
+
+                    //----------------------------------------------------------
+                    // modify A in a sequence of steps
+                    //----------------------------------------------------------
+
+                    GrB_Index full_size = base_size ;
+                    prev = base ;
+                    prev_size = base_size ;
+                    base = NULL ;
+                    for (int step = 0 ; step < 6 ; step++)
+                    {
+                        // change a single vector of A, except in the last
+                        // step, which makes no change
+                        bool no_change = (step == 5) ;
+                        if (!no_change)
+                        {
+                            GrB_Index k = (step * 337 + 41) % n ;
+                            OK (modify (A, k, 1000 * (step + 1),
+                                sparsity != GxB_FULL)) ;
+                        }
+
+                        // write the delta, with the prior blob as its base
+                        OK (GxB_Matrix_serialize_delta (&delta, &delta_size,
+                            A, prev, prev_size, desc)) ;
+                        // an iso snapshot has no values, but the changed
+                        // vectors of a delta do
+                        CHECK (iso || delta_size < full_size) ;
+
+                        // an incremental delta cannot be deserialized
+                        expected = GrB_INVALID_OBJECT ;
+                        ERR (GxB_Matrix_deserialize (&B, GrB_FP64, delta,
+                            delta_size, NULL)) ;
+                        CHECK (B == NULL) ;
+
+                        // apply the delta to C
+                        OK (GxB_Matrix_deserialize_delta (C, delta,
+                            delta_size, NULL)) ;
+                        OK (check_same (C, A)) ;
+                        OK (GrB_Matrix_get_String (C, name, GrB_NAME)) ;
+                        CHECK (strcmp (name, "C has a name") == 0) ;
+                        int32_t s ;
+                        OK (GrB_Matrix_get_INT32 (C, &s,
+                            (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                        CHECK (s == C_sparsity) ;
+
+                        // C is no longer the base of the delta, so the delta
+                        // cannot be applied again, unless it has no changes
+                        if (no_change)
+                        {
+                            OK (GxB_Matrix_deserialize_delta (C, delta,
+                                delta_size, NULL)) ;
+                        }
+                        else
+                        {
+                            expected = GrB_INVALID_VALUE ;
+                            ERR (GxB_Matrix_deserialize_delta (C, delta,
+                                delta_size, NULL)) ;
+                        }
+                        OK (check_same (C, A)) ;
+
+                        // the delta is the base of the next step
+                        mxFree (prev) ;
+                        prev = delta ;
+                        prev_size = delta_size ;
+                        delta = NULL ;
+                    }
+
+                    //----------------------------------------------------------
+                    // apply a delta from the first snapshot to a copy of it
+                    //----------------------------------------------------------
+
+                    OK (GxB_Matrix_serialize_delta (&base, &base_size, C0,
+                        NULL, 0, desc)) ;
+                    OK (GxB_Matrix_serialize_delta (&delta, &delta_size, A,
+                        base, base_size, desc)) ;
+                    OK (GxB_Matrix_deserialize_delta (C0, delta, delta_size,
+                        NULL)) ;
+                    OK (check_same (C0, A)) ;
+                    mxFree (base) ; base = NULL ;
+                    mxFree (delta) ; delta = NULL ;
+
+                    //----------------------------------------------------------
+                    // change every vector of A
+                    //----------------------------------------------------------
+
+                    OK (GrB_Matrix_apply_BinaryOp2nd_FP64 (A, NULL, NULL,
+                        GrB_PLUS_FP64, A, 1, NULL)) ;
+                    OK (GxB_Matrix_serialize_delta (&delta, &delta_size, A,
+                        prev, prev_size, desc)) ;
+                    OK (GxB_Matrix_deserialize_delta (C, delta, delta_size,
+                        NULL)) ;
+                    OK (check_same (C, A)) ;
+
+                    // a delta where every group has changed holds all of A,
+                    // but it is still incremental, since it has a base
+                    CHECK (delta_size > full_size / 2) ;
+                    expected = GrB_INVALID_OBJECT ;
+                    ERR (GxB_Matrix_deserialize (&B, GrB_FP64, delta,
+                        delta_size, NULL)) ;
+                    CHECK (B == NULL) ;
+
+                    mxFree (prev) ; prev = NULL ;
+                    mxFree (delta) ; delta = NULL ;
+                    GrB_Matrix_free (&A) ;
+                    GrB_Matrix_free (&C) ;
+                    GrB_Matrix_free (&C0) ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // the size of a delta
+    //--------------------------------------------------------------------------
+
+    // A has 16 groups, and a change to one vector changes just one group
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_COMPRESSION_NONE,
+        (GrB_Field) GxB_COMPRESSION)) ;
+    OK (random_matrix (&A, n, n, 20000, GxB_SPARSE, false, GxB_BY_COL)) ;
+    OK (GxB_Matrix_serialize_delta (&base, &base_size, A, NULL, 0, desc)) ;
+    OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+    CHECK (base_size >= blob_size + GB_DELTA_SIZE (ngroups)) ;
+    OK (modify (A, 100, 1000, true)) ;
+    OK (GxB_Matrix_serialize_delta (&delta, &delta_size, A, base, base_size,
+        desc)) ;
+    CHECK (delta_size < base_size / 8) ;
+    mxFree (delta) ; delta = NULL ;
+
+    // a delta with no changes holds no entries
+    OK (GxB_Matrix_serialize_delta (&prev, &prev_size, A, base, base_size,
+        desc)) ;
+    OK (GxB_Matrix_serialize_delta (&delta, &delta_size, A, prev, prev_size,
+        desc)) ;
+    CHECK (delta_size < base_size / 16) ;
+    // it is still incremental, and cannot be applied to an empty matrix
+    OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Matrix_deserialize_delta (C, delta, delta_size, NULL)) ;
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, C)) ;
+    CHECK (nvals == 0) ;
+    mxFree (base) ; base = NULL ;
+    mxFree (prev) ; prev = NULL ;
+    mxFree (delta) ; delta = NULL ;
+    mxFree (blob) ; blob = NULL ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&C) ;
+
+    //--------------------------------------------------------------------------
+    // a hypersparse matrix with many groups
+    //--------------------------------------------------------------------------
+
+    // A is 1000-by-1e8, with 1000 entries; each group has 1526 vectors
+    GrB_Index nbig = 100000000 ;
+    ngroups = GB_ICEIL (nbig, GB_DELTA_GSIZE (nbig)) ;
+    CHECK (GB_DELTA_GSIZE (nbig) > GB_DELTA_GROUP_MIN) ;
+    CHECK (ngroups <= GB_DELTA_NGROUPS_MAX) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_COMPRESSION_LZ4,
+        (GrB_Field) GxB_COMPRESSION)) ;
+    OK (random_matrix (&A, 1000, nbig, 1000, GxB_HYPERSPARSE, false,
+        GxB_BY_COL)) ;
+    OK (GxB_Matrix_serialize_delta (&base, &base_size, A, NULL, 0, desc)) ;
+    OK (GxB_Matrix_deserialize (&C, GrB_FP64, base, base_size, NULL)) ;
+    OK (check_same (C, A)) ;
+    GrB_Index full_size = base_size ;
+    prev = base ;
+    prev_size = base_size ;
+    base = NULL ;
+    for (int step = 0 ; step < 4 ; step++)
+    {
+        // change a vector, and delete an entry in another group
+        GrB_Index k = (step * 1234567 + 89) % nbig ;
+        OK (modify (A, k, 1000 * (step + 1), false)) ;
+        GrB_Index nz ;
+        OK (GrB_Matrix_nvals (&nz, A)) ;
+        GrB_Index *I = mxMalloc (nz * sizeof (GrB_Index)) ;
+        GrB_Index *J = mxMalloc (nz * sizeof (GrB_Index)) ;
+        CHECK (I != NULL && J != NULL) ;
+        OK (GrB_Matrix_extractTuples_FP64 (I, J, NULL, &nz, A)) ;
+        GrB_Index t = simple_rand_i ( ) % nz ;
+        info = GrB_Matrix_removeElement (A, I [t], J [t]) ;
+        mxFree (I) ;
+        mxFree (J) ;
+        OK (info) ;
+        OK (GxB_Matrix_serialize_delta (&delta, &delta_size, A, prev,
+            prev_size, desc)) ;
+        CHECK (delta_size < full_size) ;
+        OK (GxB_Matrix_deserialize_delta (C, delta, delta_size, NULL)) ;
+        OK (check_same (C, A)) ;
+        mxFree (prev) ;
+        prev = delta ;
+        prev_size = delta_size ;
+        delta = NULL ;
+    }
+    mxFree (prev) ; prev = NULL ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&C) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Descriptor_set_INT32 (desc,
+        GxB_COMPRESSION_NONE + GxB_COMPRESSION_CHECKSUM,
+        (GrB_Field) GxB_COMPRESSION)) ;
+    OK (random_matrix (&A, 300, 400, 3000, GxB_SPARSE, false, GxB_BY_COL)) ;
+    OK (GxB_Matrix_serialize_delta (&base, &base_size, A, NULL, 0, desc)) ;
+    OK (GxB_Matrix_deserialize (&C, GrB_FP64, base, base_size, NULL)) ;
+
+    // NULL arguments
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_serialize_delta (NULL, &delta_size, A, base, base_size,
+        desc)) ;
+    ERR (GxB_Matrix_serialize_delta (&delta, NULL, A, base, base_size,
+        desc)) ;
+    ERR (GxB_Matrix_serialize_delta (&delta, &delta_size, NULL, base,
+        base_size, desc)) ;
+    ERR (GxB_Matrix_deserialize_delta (NULL, base, base_size, NULL)) ;
+    ERR (GxB_Matrix_deserialize_delta (C, NULL, base_size, NULL)) ;
+    CHECK (delta == NULL) ;
+
+    // the base must be a blob written by GxB_Matrix_serialize_delta
+    OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Matrix_serialize_delta (&delta, &delta_size, A, blob, blob_size,
+        desc)) ;
+    CHECK (delta == NULL) ;
+    ERR (GxB_Matrix_deserialize_delta (C, blob, blob_size, NULL)) ;
+    OK (check_same (C, A)) ;
+    mxFree (blob) ; blob = NULL ;
+
+    // the base must be a valid blob
+    expected = GrB_INVALID_OBJECT ;
+    ERR (GxB_Matrix_serialize_delta (&delta, &delta_size, A, base,
+        GB_BLOB_HEADER_SIZE - 1, desc)) ;
+    ERR (GxB_Matrix_serialize_delta (&delta, &delta_size, A, base,
+        base_size - 1, desc)) ;
+    ERR (GxB_Matrix_deserialize_delta (C, base, base_size - 1, NULL)) ;
+    CHECK (delta == NULL) ;
+    OK (check_same (C, A)) ;
+
+    // the base must hold a matrix of the same type
+    OK (GrB_Matrix_new (&B, GrB_INT32, 300, 400)) ;
+    OK (GxB_Matrix_serialize_delta (&blob, &blob_size, B, NULL, 0, desc)) ;
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Matrix_serialize_delta (&delta, &delta_size, A, blob, blob_size,
+        desc)) ;
+    CHECK (delta == NULL) ;
+    ERR (GxB_Matrix_deserialize_delta (C, blob, blob_size, NULL)) ;
+    OK (check_same (C, A)) ;
+    mxFree (blob) ; blob = NULL ;
+    GrB_Matrix_free (&B) ;
+
+    // the base must hold a matrix of the same size and format
+    expected = GrB_DIMENSION_MISMATCH ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, 300, 401)) ;
+    OK (GxB_Matrix_serialize_delta (&blob, &blob_size, B, NULL, 0, desc)) ;
+    ERR (GxB_Matrix_serialize_delta (&delta, &delta_size, A, blob, blob_size,
+        desc)) ;
+    ERR (GxB_Matrix_deserialize_delta (C, blob, blob_size, NULL)) ;
+    mxFree (blob) ; blob = NULL ;
+    GrB_Matrix_free (&B) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, 301, 400)) ;
+    OK (GxB_Matrix_serialize_delta (&blob, &blob_size, B, NULL, 0, desc)) ;
+    ERR (GxB_Matrix_serialize_delta (&delta, &delta_size, A, blob, blob_size,
+        desc)) ;
+    ERR (GxB_Matrix_deserialize_delta (C, blob, blob_size, NULL)) ;
+    mxFree (blob) ; blob = NULL ;
+    GrB_Matrix_free (&B) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, 300, 400)) ;
+    OK (GrB_Matrix_set_INT32 (B, GxB_BY_ROW, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GxB_Matrix_serialize_delta (&blob, &blob_size, B, NULL, 0, desc)) ;
+    ERR (GxB_Matrix_serialize_delta (&delta, &delta_size, A, blob, blob_size,
+        desc)) ;
+    ERR (GxB_Matrix_deserialize_delta (C, blob, blob_size, NULL)) ;
+    CHECK (delta == NULL) ;
+    OK (check_same (C, A)) ;
+    mxFree (blob) ; blob = NULL ;
+    GrB_Matrix_free (&B) ;
+
+    // an incremental delta must be applied to the matrix of its base
+    OK (modify (A, 7, 1000, true)) ;
+    OK (GxB_Matrix_serialize_delta (&delta, &delta_size, A, base, base_size,
+        desc)) ;
+    OK (GrB_Matrix_dup (&B, C)) ;
+    OK (GrB_Matrix_setElement_FP64 (B, 99, 299, 399)) ;
+    OK (GrB_Matrix_dup (&E, B)) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Matrix_deserialize_delta (B, delta, delta_size, NULL)) ;
+    OK (check_same (B, E)) ;
+    GrB_Matrix_free (&B) ;
+    GrB_Matrix_free (&E) ;
+
+    // a corrupted entry of the delta is detected by its checksums
+    double x = 1000 ;
+    uint8_t *d = (uint8_t *) delta ;
+    int64_t found = -1 ;
+    for (size_t k = 0 ; k + sizeof (double) <= delta_size ; k++)
+    {
+        if (memcmp (d + k, &x, sizeof (double)) == 0)
+        {
+            found = k ;
+            break ;
+        }
+    }
+    CHECK (found > (int64_t) GB_BLOB_HEADER_SIZE) ;
+    d [found + sizeof (double) - 1] ^= 0x10 ;
+    expected = GrB_INVALID_OBJECT ;
+    ERR (GxB_Matrix_deserialize_delta (C, delta, delta_size, NULL)) ;
+    d [found + sizeof (double) - 1] ^= 0x10 ;
+    OK (GxB_Matrix_deserialize_delta (C, delta, delta_size, NULL)) ;
+    OK (check_same (C, A)) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test48: all tests passed\n\n") ;
+}
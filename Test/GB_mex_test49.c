@@ -0,0 +1,975 @@
+//------------------------------------------------------------------------------
+// GB_mex_test49: test GxB_Matrix_read_mtx, write_mtx, and read_edges
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Matrices of each built-in type, including extreme values, are written to a
+// Matrix Market file with GxB_Matrix_write_mtx and read back with
+// GxB_Matrix_read_mtx, which must return the same matrix.  Large matrices are
+// written and read with 1 and 4 threads, so that the file is formatted in
+// many rounds and parsed in many chunks.  Files in each format, field, and
+// symmetry are then written by hand and read, and each real value of a file
+// with many forms of numbers must be parsed exactly as strtod does.  Binary
+// edge lists are read with GxB_Matrix_read_edges, and the error cases of all
+// three methods are checked.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "io/GB_io.h"
+#include <float.h>
+
+#define MTXFILE "GB_mex_test49.mtx"
+#define BINFILE "GB_mex_test49.bin"
+
+//------------------------------------------------------------------------------
+// write_text: write a string to a file
+//------------------------------------------------------------------------------
+
+static bool write_text (const char *filename, const char *text)
+{
+    FILE *f = fopen (filename, "wb") ;
+    if (f == NULL) return (false) ;
+    size_t len = strlen (text) ;
+    bool ok = (fwrite (text, 1, len, f) == len) ;
+    return (fclose (f) == 0 && ok) ;
+}
+
+//------------------------------------------------------------------------------
+// write_bytes: write an array to a file
+//------------------------------------------------------------------------------
+
+static bool write_bytes (const char *filename, const void *x, size_t size)
+{
+    FILE *f = fopen (filename, "wb") ;
+    if (f == NULL) return (false) ;
+    bool ok = (size == 0) || (fwrite (x, 1, size, f) == size) ;
+    return (fclose (f) == 0 && ok) ;
+}
+
+//------------------------------------------------------------------------------
+// check_same: check if C and A hold the same matrix
+//------------------------------------------------------------------------------
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Matrix_free (&A2) ;             \
+}
+
+static GrB_Info check_same
+(
+    GrB_Matrix C,
+    GrB_Matrix A
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix C2 = NULL, A2 = NULL ;
+    OK (GrB_Matrix_dup (&C2, C)) ;
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C2, A2, 0)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_file: read a Matrix Market file and compare it with a matrix
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C) ;              \
+}
+
+static GrB_Info check_file
+(
+    const char *text,       // content of the file
+    GrB_Type type,          // type to read, or NULL
+    GrB_Matrix A            // expected result
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix C = NULL ;
+    CHECK (write_text (MTXFILE, text)) ;
+    OK (GxB_Matrix_read_mtx (&C, type, MTXFILE, NULL)) ;
+    OK (check_same (C, A)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_error: check that a Matrix Market file cannot be read
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL ;
+
+static GrB_Info check_error
+(
+    const char *text,       // content of the file
+    GrB_Type type,          // type to read, or NULL
+    GrB_Info expected       // expected error
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix C = NULL ;
+    CHECK (write_text (MTXFILE, text)) ;
+    ERR (GxB_Matrix_read_mtx (&C, type, MTXFILE, NULL)) ;
+    CHECK (C == NULL) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_roundtrip: write a matrix to a file and read it back
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C) ;              \
+}
+
+static GrB_Info check_roundtrip
+(
+    GrB_Matrix A
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix C = NULL ;
+    OK (GxB_Matrix_write_mtx (MTXFILE, A, NULL)) ;
+    OK (GxB_Matrix_read_mtx (&C, NULL, MTXFILE, NULL)) ;
+    GrB_Type atype, ctype ;
+    OK (GxB_Matrix_type (&atype, A)) ;
+    OK (GxB_Matrix_type (&ctype, C)) ;
+    CHECK (atype == ctype) ;
+    OK (check_same (C, A)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_edges: read an edge list and compare it with GrB_Matrix_build
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&R) ;              \
+    if (E32 != NULL) mxFree (E32) ;     \
+    if (E64 != NULL) mxFree (E64) ;     \
+    if (I != NULL) mxFree (I) ;         \
+    if (J != NULL) mxFree (J) ;         \
+    if (X != NULL) mxFree (X) ;         \
+}
+
+static GrB_Info check_edges
+(
+    GrB_Index nedges,
+    GrB_Index imax,         // row indices in range 0:imax-1
+    GrB_Index jmax,         // column indices in range 0:jmax-1
+    GrB_Index nrows,        // # of rows to pass to read_edges, or 0
+    GrB_Index ncols,        // # of columns to pass to read_edges, or 0
+    size_t index_size,
+    bool sorted,            // if true, the edges are sorted
+    GrB_Type type           // type of C, or NULL
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix C = NULL, R = NULL ;
+    uint32_t *E32 = NULL ;
+    uint64_t *E64 = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    bool *X = NULL ;
+    size_t n = GB_IMAX (nedges, 1) ;
+    I = mxMalloc (n * sizeof (GrB_Index)) ;
+    J = mxMalloc (n * sizeof (GrB_Index)) ;
+    X = mxMalloc (n * sizeof (bool)) ;
+    E32 = mxMalloc (2 * n * sizeof (uint32_t)) ;
+    E64 = mxMalloc (2 * n * sizeof (uint64_t)) ;
+    CHECK (I != NULL && J != NULL && X != NULL && E32 != NULL && E64 != NULL) ;
+
+    // create the edges, with duplicates
+    GrB_Index imax_found = 0, jmax_found = 0 ;
+    for (int64_t k = 0 ; k < nedges ; k++)
+    {
+        if (sorted)
+        {
+            // sorted by column, then by row, in the format of C
+            J [k] = (k * jmax) / nedges ;
+            I [k] = (k % 7 == 0 && k > 0) ? I [k-1] : (k % imax) ;
+            if (k > 0 && J [k] == J [k-1] && I [k] < I [k-1]) I [k] = I [k-1] ;
+        }
+        else
+        {
+            I [k] = simple_rand_i ( ) % imax ;
+            J [k] = simple_rand_i ( ) % jmax ;
+        }
+        X [k] = true ;
+        E32 [2*k  ] = (uint32_t) I [k] ;
+        E32 [2*k+1] = (uint32_t) J [k] ;
+        E64 [2*k  ] = I [k] ;
+        E64 [2*k+1] = J [k] ;
+        imax_found = GB_IMAX (imax_found, I [k]) ;
+        jmax_found = GB_IMAX (jmax_found, J [k]) ;
+    }
+    if (index_size == 4)
+    {
+        CHECK (write_bytes (BINFILE, E32, 2 * nedges * sizeof (uint32_t))) ;
+    }
+    else
+    {
+        CHECK (write_bytes (BINFILE, E64, 2 * nedges * sizeof (uint64_t))) ;
+    }
+
+    // C = the edges read from the file
+    OK (GxB_Matrix_read_edges (&C, type, nrows, ncols, BINFILE, index_size,
+        NULL)) ;
+    GrB_Index cnrows, cncols ;
+    OK (GrB_Matrix_nrows (&cnrows, C)) ;
+    OK (GrB_Matrix_ncols (&cncols, C)) ;
+    CHECK (cnrows == ((nrows > 0) ? nrows :
+        ((nedges > 0) ? (imax_found + 1) : 0))) ;
+    CHECK (cncols == ((ncols > 0) ? ncols :
+        ((nedges > 0) ? (jmax_found + 1) : 0))) ;
+    CHECK (C->iso || GB_nnz (C) == 0) ;
+
+    // R = the same edges, from GrB_Matrix_build
+    OK (GrB_Matrix_new (&R, GrB_BOOL, cnrows, cncols)) ;
+    OK (GrB_Matrix_build_BOOL (R, I, J, X, nedges, GrB_LOR)) ;
+    if (type != NULL && type != GrB_BOOL)
+    {
+        GrB_Matrix T = NULL ;
+        OK (GrB_Matrix_new (&T, type, cnrows, cncols)) ;
+        OK (GrB_Matrix_assign (T, NULL, NULL, R, GrB_ALL, cnrows, GrB_ALL,
+            cncols, NULL)) ;
+        GrB_Matrix_free (&R) ;
+        R = T ;
+    }
+    OK (check_same (C, R)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test49
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                            \
+{                                           \
+    GrB_Matrix_free (&A) ;                  \
+    GrB_Matrix_free (&C) ;                  \
+    GrB_Type_free (&mytype) ;               \
+    if (text != NULL) mxFree (text) ;       \
+    text = NULL ;                           \
+    remove (MTXFILE) ;                      \
+    remove (BINFILE) ;                      \
+}
+
+typedef struct { double a, b ; } mytype_t ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected = GrB_SUCCESS ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL ;
+    GrB_Type mytype = NULL ;
+    char *text = NULL ;
+    simple_rand_seed (49) ;
+    int nthreads_save ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+    OK (GrB_Type_new (&mytype, sizeof (mytype_t))) ;
+
+    //--------------------------------------------------------------------------
+    // write and read a matrix of each built-in type
+    //--------------------------------------------------------------------------
+
+    GrB_Type types [13] =
+    {
+        GrB_BOOL, GrB_INT8, GrB_INT16, GrB_INT32, GrB_INT64,
+        GrB_UINT8, GrB_UINT16, GrB_UINT32, GrB_UINT64,
+        GrB_FP32, GrB_FP64, GxB_FC32, GxB_FC64
+    } ;
+
+    for (int kt = 0 ; kt < 13 ; kt++)
+    {
+        GrB_Type type = types [kt] ;
+        for (int sparsity = 1 ; sparsity <= 8 ; sparsity *= 2)
+        {
+            for (int format = GxB_BY_ROW ; format <= GxB_BY_COL ; format++)
+            {
+                // A is 50-by-80, with values that are integers for the
+                // integer types, and fractions for the other types
+                bool fp = (type == GrB_FP32 || type == GrB_FP64 ||
+                    type == GxB_FC32 || type == GxB_FC64) ;
+                OK (GrB_Matrix_new (&A, type, 50, 80)) ;
+                OK (GrB_Matrix_set_INT32 (A, format,
+                    GrB_STORAGE_ORIENTATION_HINT)) ;
+                int64_t nz = (sparsity == GxB_FULL) ? 4000 : 500 ;
+                for (int64_t k = 0 ; k < nz ; k++)
+                {
+                    GrB_Index i, j ;
+                    if (sparsity == GxB_FULL)
+                    {
+                        i = k % 50 ;
+                        j = k / 50 ;
+                    }
+                    else
+                    {
+                        i = simple_rand_i ( ) % 50 ;
+                        j = simple_rand_i ( ) % 80 ;
+                    }
+                    double x = (double) ((int64_t) (simple_rand_i ( ) % 2001)
+                        - 1000) ;
+                    if (fp) x = x / 7 ;
+                    if (type == GrB_BOOL) x = (k % 3 == 0) ;
+                    OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+                }
+
+                // extreme values of each type
+                #define SET(suffix,x,i,j) \
+                    OK (GrB_Matrix_setElement_ ## suffix (A, x, i, j))
+                if (type == GrB_INT8)
+                {
+                    SET (INT8, INT8_MIN, 0, 0) ; SET (INT8, INT8_MAX, 1, 0) ;
+                }
+                else if (type == GrB_INT16)
+                {
+                    SET (INT16, INT16_MIN, 0, 0) ; SET (INT16, INT16_MAX, 1, 0);
+                }
+                else if (type == GrB_INT32)
+                {
+                    SET (INT32, INT32_MIN, 0, 0) ; SET (INT32, INT32_MAX, 1, 0);
+                }
+                else if (type == GrB_INT64)
+                {
+                    SET (INT64, INT64_MIN, 0, 0) ; SET (INT64, INT64_MAX, 1, 0);
+                }
+                else if (type == GrB_UINT8)
+                {
+                    SET (UINT8, UINT8_MAX, 0, 0) ;
+                }
+                else if (type == GrB_UINT16)
+                {
+                    SET (UINT16, UINT16_MAX, 0, 0) ;
+                }
+                else if (type == GrB_UINT32)
+                {
+                    SET (UINT32, UINT32_MAX, 0, 0) ;
+                }
+                else if (type == GrB_UINT64)
+                {
+                    SET (UINT64, UINT64_MAX, 0, 0) ;
+                    SET (UINT64, ((uint64_t) INT64_MAX) + 1, 1, 0) ;
+                }
+                else if (type == GrB_FP32)
+                {
+                    SET (FP32, FLT_MAX, 0, 0) ; SET (FP32, -FLT_MIN, 1, 0) ;
+                    SET (FP32, 1.4e-45f, 2, 0) ; SET (FP32, 0.1f, 3, 0) ;
+                    SET (FP32, -0.0f, 4, 0) ; SET (FP32, INFINITY, 5, 0) ;
+                    SET (FP32, -INFINITY, 6, 0) ; SET (FP32, NAN, 7, 0) ;
+                    SET (FP32, 16777216.0f, 8, 0) ; SET (FP32, 1e30f, 9, 0) ;
+                }
+                else if (type == GrB_FP64)
+                {
+                    SET (FP64, DBL_MAX, 0, 0) ; SET (FP64, -DBL_MIN, 1, 0) ;
+                    SET (FP64, 4.9e-324, 2, 0) ; SET (FP64, 0.1, 3, 0) ;
+                    SET (FP64, -0.0, 4, 0) ; SET (FP64, INFINITY, 5, 0) ;
+                    SET (FP64, -INFINITY, 6, 0) ; SET (FP64, NAN, 7, 0) ;
+                    SET (FP64, 9007199254740993.0, 8, 0) ;
+                    SET (FP64, 1.0/3.0, 9, 0) ; SET (FP64, 1e300, 10, 0) ;
+                    SET (FP64, -9007199254740992.0, 11, 0) ;
+                    SET (FP64, 123456789012345678.0, 12, 0) ;
+                }
+                else if (type == GxB_FC32)
+                {
+                    OK (GxB_Matrix_setElement_FC32 (A,
+                        GxB_CMPLXF (FLT_MAX, -0.1f), 0, 0)) ;
+                    OK (GxB_Matrix_setElement_FC32 (A,
+                        GxB_CMPLXF (-0.0f, INFINITY), 1, 0)) ;
+                }
+                else if (type == GxB_FC64)
+                {
+                    OK (GxB_Matrix_setElement_FC64 (A,
+                        GxB_CMPLX (DBL_MAX, -0.1), 0, 0)) ;
+                    OK (GxB_Matrix_setElement_FC64 (A,
+                        GxB_CMPLX (-0.0, 4.9e-324), 1, 0)) ;
+                    OK (GxB_Matrix_setElement_FC64 (A,
+                        GxB_CMPLX (1.0/3.0, -INFINITY), 2, 0)) ;
+                }
+
+                OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                OK (GrB_Matrix_set_INT32 (A, sparsity,
+                    (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                OK (check_roundtrip (A)) ;
+                GrB_Matrix_free (&A) ;
+            }
+        }
+
+        // an empty matrix, and an iso matrix
+        OK (GrB_Matrix_new (&A, type, 10, 0)) ;
+        OK (check_roundtrip (A)) ;
+        GrB_Matrix_free (&A) ;
+        OK (GrB_Matrix_new (&A, type, 7, 5)) ;
+        OK (check_roundtrip (A)) ;
+        OK (GrB_Matrix_assign_FP64 (A, NULL, NULL, 1, GrB_ALL, 7, GrB_ALL, 5,
+            NULL)) ;
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        CHECK (A->iso) ;
+        OK (check_roundtrip (A)) ;
+        GrB_Matrix_free (&A) ;
+    }
+
+    // the type is recorded in the file, but can be overridden
+    OK (GrB_Matrix_new (&A, GrB_INT16, 4, 4)) ;
+    OK (GrB_Matrix_setElement_INT16 (A, -300, 3, 1)) ;
+    OK (GxB_Matrix_write_mtx (MTXFILE, A, NULL)) ;
+    OK (GxB_Matrix_read_mtx (&C, GrB_FP32, MTXFILE, NULL)) ;
+    GrB_Type ctype ;
+    OK (GxB_Matrix_type (&ctype, C)) ;
+    CHECK (ctype == GrB_FP32) ;
+    float y = 0 ;
+    OK (GrB_Matrix_extractElement_FP32 (&y, C, 3, 1)) ;
+    CHECK (y == -300) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&C) ;
+
+    //--------------------------------------------------------------------------
+    // write and read large matrices
+    //--------------------------------------------------------------------------
+
+    // A has 600,000 entries, so it is written in many rounds of 64K entries
+    // per thread, and its file of about 17MB is read in many chunks
+    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+    {
+        OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads,
+            (GrB_Field) GxB_NTHREADS)) ;
+        for (int format = GxB_BY_ROW ; format <= GxB_BY_COL ; format++)
+        {
+            OK (GrB_Matrix_new (&A, GrB_FP64, 100000, 200000)) ;
+            OK (GrB_Matrix_set_INT32 (A, format,
+                GrB_STORAGE_ORIENTATION_HINT)) ;
+            for (int64_t k = 0 ; k < 600000 ; k++)
+            {
+                GrB_Index i = simple_rand_i ( ) % 100000 ;
+                GrB_Index j = simple_rand_i ( ) % 200000 ;
+                double x = ((double) simple_rand_i ( )) / 3 - 1e6 ;
+                OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+            }
+            OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+            OK (check_roundtrip (A)) ;
+
+            // read into a matrix held by row
+            OK (GrB_Global_set_INT32 (GrB_GLOBAL, GrB_ROWMAJOR,
+                GrB_STORAGE_ORIENTATION_HINT)) ;
+            OK (GxB_Matrix_read_mtx (&C, NULL, MTXFILE, NULL)) ;
+            OK (GrB_Global_set_INT32 (GrB_GLOBAL, GrB_COLMAJOR,
+                GrB_STORAGE_ORIENTATION_HINT)) ;
+            CHECK (!C->is_csc) ;
+            OK (check_same (C, A)) ;
+            GrB_Matrix_free (&C) ;
+            GrB_Matrix_free (&A) ;
+        }
+
+        // a large dense symmetric array, in many chunks
+        int64_t n = 600 ;
+        size_t len = 20 * n * n + 100 ;
+        text = mxMalloc (len) ;
+        CHECK (text != NULL) ;
+        char *s = text ;
+        s += sprintf (s, "%%%%MatrixMarket matrix array real symmetric\n"
+            "%d %d\n", (int) n, (int) n) ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+        for (int64_t j = 0 ; j < n ; j++)
+        {
+            for (int64_t i = j ; i < n ; i++)
+            {
+                double x = (double) (i * 1000 + j) + 0.25 ;
+                s += sprintf (s, "%.17g\n", x) ;
+                OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+                OK (GrB_Matrix_setElement_FP64 (A, x, j, i)) ;
+            }
+        }
+        CHECK (s - text > 4 * GB_IO_CHUNK) ;
+        OK (check_file (text, NULL, A)) ;
+        GrB_Matrix_free (&A) ;
+
+        // the same matrix, as a skew-symmetric array
+        s = text ;
+        s += sprintf (s, "%%%%MatrixMarket matrix array integer "
+            "skew-symmetric\n%d %d\n", (int) n, (int) n) ;
+        OK (GrB_Matrix_new (&A, GrB_INT64, n, n)) ;
+        for (int64_t j = 0 ; j < n ; j++)
+        {
+            for (int64_t i = j + 1 ; i < n ; i++)
+            {
+                int64_t x = i * 1000 + j ;
+                s += sprintf (s, "%" PRId64 "\n", x) ;
+                OK (GrB_Matrix_setElement_INT64 (A, x, i, j)) ;
+                OK (GrB_Matrix_setElement_INT64 (A, -x, j, i)) ;
+            }
+        }
+        OK (check_file (text, NULL, A)) ;
+        GrB_Matrix_free (&A) ;
+
+        // the same matrix, as a general array, with comments
+        s = text ;
+        s += sprintf (s, "%%%%MatrixMarket matrix array real general\n"
+            "%% comment\n%d %d\n", (int) n, (int) n) ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+        for (int64_t j = 0 ; j < n ; j++)
+        {
+            for (int64_t i = 0 ; i < n ; i++)
+            {
+                double x = (double) (i * 1000 + j) - 0.5 ;
+                s += sprintf (s, "%.17g\n", x) ;
+                if (i % 97 == 0) s += sprintf (s, "%% comment\n\n") ;
+                OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+            }
+        }
+        OK (check_file (text, NULL, A)) ;
+        GrB_Matrix_free (&A) ;
+        mxFree (text) ;
+        text = NULL ;
+    }
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+
+    //--------------------------------------------------------------------------
+    // parse many forms of real values
+    //--------------------------------------------------------------------------
+
+    // each value must be parsed exactly as strtod parses it
+    #define NVALUES 20000
+    const char *forms [ ] =
+    {
+        "0", "-0", "+0", "1", "-1", "0.1", ".5", "-.5", "5.", "1e3", "1E-3",
+        "1.5e+10", "00012", "0.000123", "123.4500", "2.2250738585072014e-308",
+        "4.9e-324", "1e-400", "1.7976931348623157e308", "1e308", "9e15",
+        "9007199254740993", "123456789012345678901234567890",
+        "3.14159265358979323846264338", "1e22", "1e23", "1e-22", "1e-23",
+        "inf", "-Inf", "INFINITY", "0.30000000000000004", "+1.25",
+    } ;
+    int nforms = (int) (sizeof (forms) / sizeof (forms [0])) ;
+    double *values = mxMalloc (NVALUES * sizeof (double)) ;
+    text = mxMalloc (NVALUES * 64 + 100) ;
+    CHECK (values != NULL && text != NULL) ;
+    char *s = text ;
+    s += sprintf (s, "%%%%MatrixMarket matrix coordinate real general\n"
+        "%d 1 %d\n", NVALUES, NVALUES) ;
+    for (int k = 0 ; k < NVALUES ; k++)
+    {
+        char tok [64] ;
+        if (k < nforms)
+        {
+            strcpy (tok, forms [k]) ;
+        }
+        else
+        {
+            // a random decimal value
+            uint64_t m = ((uint64_t) simple_rand_i ( ) << 32) |
+                simple_rand_i ( ) ;
+            int digits = 1 + simple_rand_i ( ) % 19 ;
+            uint64_t p10 = 1 ;
+            for (int d = 0 ; d < digits ; d++) p10 *= 10 ;
+            m = m % p10 ;
+            int e = (int) (simple_rand_i ( ) % 61) - 30 ;
+            int form = simple_rand_i ( ) % 3 ;
+            const char *sign = (simple_rand_i ( ) % 2) ? "-" : "" ;
+            if (form == 0)
+            {
+                sprintf (tok, "%s%" PRIu64 "e%d", sign, m, e) ;
+            }
+            else if (form == 1)
+            {
+                int frac = simple_rand_i ( ) % (digits + 1) ;
+                char digs [24] ;
+                sprintf (digs, "%0*" PRIu64, digits, m) ;
+                sprintf (tok, "%s%.*s.%s", sign, digits - frac, digs,
+                    digs + digits - frac) ;
+            }
+            else
+            {
+                sprintf (tok, "%s%.17g", sign, ((double) m) * pow (10, e)) ;
+            }
+        }
+        values [k] = strtod (tok, NULL) ;
+        s += sprintf (s, "%d 1 %s\n", k + 1, tok) ;
+    }
+    CHECK (write_text (MTXFILE, text)) ;
+    OK (GxB_Matrix_read_mtx (&C, NULL, MTXFILE, NULL)) ;
+    for (int k = 0 ; k < NVALUES ; k++)
+    {
+        double x = 0 ;
+        OK (GrB_Matrix_extractElement_FP64 (&x, C, k, 0)) ;
+        CHECK (memcmp (&x, &(values [k]), sizeof (double)) == 0) ;
+    }
+    GrB_Matrix_free (&C) ;
+    mxFree (values) ;
+    mxFree (text) ;
+    text = NULL ;
+
+    // nan is read as nan
+    CHECK (write_text (MTXFILE, "%%MatrixMarket matrix coordinate real "
+        "general\n2 1 2\n1 1 nan\n2 1 -NaN\n")) ;
+    OK (GxB_Matrix_read_mtx (&C, NULL, MTXFILE, NULL)) ;
+    double x = 0 ;
+    OK (GrB_Matrix_extractElement_FP64 (&x, C, 0, 0)) ;
+    CHECK (isnan (x)) ;
+    OK (GrB_Matrix_extractElement_FP64 (&x, C, 1, 0)) ;
+    CHECK (isnan (x)) ;
+    GrB_Matrix_free (&C) ;
+
+    //--------------------------------------------------------------------------
+    // read files written by hand
+    //--------------------------------------------------------------------------
+
+    // symmetric real array
+    OK (GrB_Matrix_new (&A, GrB_FP64, 3, 3)) ;
+    double sym [3][3] = { {1.5, 2, 3}, {2, 4, 5}, {3, 5, 6} } ;
+    for (int i = 0 ; i < 3 ; i++)
+    {
+        for (int j = 0 ; j < 3 ; j++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (A, sym [i][j], i, j)) ;
+        }
+    }
+    OK (check_file ("%%MatrixMarket matrix array real symmetric\n"
+        "% comment\n3 3\n1.5\n2\n3\n4\n5\n6\n", NULL, A)) ;
+    OK (check_file ("%%MatrixMarket matrix array double symmetric\n"
+        "3 3\n1.5\n2\n3\n4\n5\n6\n", NULL, A)) ;
+    // the same matrix, as a general array with CRLF line endings, and
+    // a banner in mixed case
+    OK (check_file ("%%matrixmarket MATRIX Array Real General\r\n"
+        "\r\n3 3\r\n1.5\r\n2\r\n3\r\n2\r\n4\r\n5\r\n3\r\n5\r\n6\r\n",
+        NULL, A)) ;
+    // the same matrix, in the coordinate format
+    OK (check_file ("%%MatrixMarket matrix coordinate real symmetric\n"
+        "3 3 6\n1 1 1.5\n2 1 2\n3 1 3\n2 2 4\n3 2 5\n3 3 6\n", NULL, A)) ;
+    // the same matrix, in the coordinate format, out of order
+    OK (check_file ("%%MatrixMarket matrix coordinate real symmetric\n"
+        "3 3 6\n3 3 6\n2 1 2\n3 2 5\n1 1 1.5\n3 1 3\n2 2 4\n", NULL, A)) ;
+    GrB_Matrix_free (&A) ;
+
+    // skew-symmetric real array
+    OK (GrB_Matrix_new (&A, GrB_FP32, 3, 3)) ;
+    OK (GrB_Matrix_setElement_FP32 (A,  1, 1, 0)) ;
+    OK (GrB_Matrix_setElement_FP32 (A, -1, 0, 1)) ;
+    OK (GrB_Matrix_setElement_FP32 (A,  2, 2, 0)) ;
+    OK (GrB_Matrix_setElement_FP32 (A, -2, 0, 2)) ;
+    OK (GrB_Matrix_setElement_FP32 (A,  3, 2, 1)) ;
+    OK (GrB_Matrix_setElement_FP32 (A, -3, 1, 2)) ;
+    OK (check_file ("%%MatrixMarket matrix array real skew-symmetric\n"
+        "3 3\n1\n2\n3\n", GrB_FP32, A)) ;
+    GrB_Matrix_free (&A) ;
+
+    // skew-symmetric integer coordinate, typecasted to int8
+    OK (GrB_Matrix_new (&A, GrB_INT8, 4, 4)) ;
+    OK (GrB_Matrix_setElement_INT8 (A,  5, 3, 0)) ;
+    OK (GrB_Matrix_setElement_INT8 (A, -5, 0, 3)) ;
+    OK (GrB_Matrix_setElement_INT8 (A, -7, 2, 1)) ;
+    OK (GrB_Matrix_setElement_INT8 (A,  7, 1, 2)) ;
+    OK (check_file ("%%MatrixMarket matrix coordinate integer "
+        "skew-symmetric\n4 4 2\n4 1 5\n3 2 -7\n", GrB_INT8, A)) ;
+    GrB_Matrix_free (&A) ;
+
+    // Hermitian complex
+    OK (GrB_Matrix_new (&A, GxB_FC64, 2, 2)) ;
+    OK (GxB_Matrix_setElement_FC64 (A, GxB_CMPLX (3, 0), 0, 0)) ;
+    OK (GxB_Matrix_setElement_FC64 (A, GxB_CMPLX (1, 2), 1, 0)) ;
+    OK (GxB_Matrix_setElement_FC64 (A, GxB_CMPLX (1, -2), 0, 1)) ;
+    OK (check_file ("%%MatrixMarket matrix coordinate complex hermitian\n"
+        "2 2 2\n1 1 3 0\n2 1 1 2\n", NULL, A)) ;
+    GrB_Matrix_free (&A) ;
+
+    // skew-symmetric complex
+    OK (GrB_Matrix_new (&A, GxB_FC64, 2, 2)) ;
+    OK (GxB_Matrix_setElement_FC64 (A, GxB_CMPLX (1, 2), 1, 0)) ;
+    OK (GxB_Matrix_setElement_FC64 (A, GxB_CMPLX (-1, -2), 0, 1)) ;
+    OK (check_file ("%%MatrixMarket matrix coordinate complex "
+        "skew-symmetric\n2 2 1\n2 1 1 2\n", NULL, A)) ;
+    GrB_Matrix_free (&A) ;
+
+    // a real Hermitian matrix is symmetric
+    OK (GrB_Matrix_new (&A, GrB_FP64, 2, 2)) ;
+    OK (GrB_Matrix_setElement_FP64 (A, 4, 1, 0)) ;
+    OK (GrB_Matrix_setElement_FP64 (A, 4, 0, 1)) ;
+    OK (check_file ("%%MatrixMarket matrix coordinate real hermitian\n"
+        "2 2 1\n2 1 4\n", NULL, A)) ;
+    GrB_Matrix_free (&A) ;
+
+    // symmetric pattern: an iso-valued GrB_BOOL matrix
+    OK (GrB_Matrix_new (&A, GrB_BOOL, 3, 3)) ;
+    OK (GrB_Matrix_setElement_BOOL (A, true, 1, 0)) ;
+    OK (GrB_Matrix_setElement_BOOL (A, true, 0, 1)) ;
+    OK (GrB_Matrix_setElement_BOOL (A, true, 2, 2)) ;
+    OK (check_file ("%%MatrixMarket matrix coordinate pattern symmetric\n"
+        "3 3 2\n2 1\n3 3\n", NULL, A)) ;
+    CHECK (write_text (MTXFILE, "%%MatrixMarket matrix coordinate pattern "
+        "general\n3 3 3\n2 1\n3 3\n2 1\n")) ;
+    OK (GxB_Matrix_read_mtx (&C, GrB_INT32, MTXFILE, NULL)) ;
+    CHECK (C->iso) ;
+    int32_t z = 0 ;
+    OK (GrB_Matrix_extractElement_INT32 (&z, C, 1, 0)) ;
+    CHECK (z == 1) ;
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, C)) ;
+    CHECK (nvals == 2) ;
+    GrB_Matrix_free (&C) ;
+    GrB_Matrix_free (&A) ;
+
+    // duplicates are summed, and comments and blank lines are skipped
+    OK (GrB_Matrix_new (&A, GrB_FP32, 2, 3)) ;
+    OK (GrB_Matrix_setElement_FP32 (A, 7, 0, 0)) ;
+    OK (GrB_Matrix_setElement_FP32 (A, -7, 1, 2)) ;
+    OK (GrB_Matrix_setElement_FP32 (A, 3, 1, 1)) ;
+    OK (check_file ("%%MatrixMarket matrix coordinate integer general\r\n"
+        "% comment\r\n\r\n  2 3 4\r\n1 1 5\r\n% inside\r\n\r\n2 3 -7\r\n"
+        "  1\t1 2\r\n2 2 +3", GrB_FP32, A)) ;
+    GrB_Matrix_free (&A) ;
+
+    // a %%GraphBLAS type comment gives the type of C
+    OK (GrB_Matrix_new (&A, GxB_FC32, 2, 2)) ;
+    OK (GxB_Matrix_setElement_FC32 (A, GxB_CMPLXF (1, -1), 1, 1)) ;
+    OK (check_file ("%%MatrixMarket matrix coordinate complex general\n"
+        "%%GraphBLAS type float complex  \n2 2 1\n2 2 1 -1\n", NULL, A)) ;
+    GrB_Matrix_free (&A) ;
+    // an unknown type name is ignored
+    OK (GrB_Matrix_new (&A, GrB_INT64, 2, 2)) ;
+    OK (GrB_Matrix_setElement_INT64 (A, 3, 1, 1)) ;
+    OK (check_file ("%%MatrixMarket matrix coordinate integer general\n"
+        "%%GraphBLAS type mytype\n2 2 1\n2 2 3\n", NULL, A)) ;
+    GrB_Matrix_free (&A) ;
+
+    // empty matrices
+    OK (GrB_Matrix_new (&A, GrB_FP64, 0, 4)) ;
+    OK (check_file ("%%MatrixMarket matrix coordinate real general\n"
+        "0 4 0\n", NULL, A)) ;
+    OK (check_file ("%%MatrixMarket matrix array real general\n"
+        "0 4\n", NULL, A)) ;
+    GrB_Matrix_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // Matrix Market errors
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 2, 2)) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_read_mtx (NULL, NULL, MTXFILE, NULL)) ;
+    ERR (GxB_Matrix_read_mtx (&C, NULL, NULL, NULL)) ;
+    CHECK (C == NULL) ;
+    ERR (GxB_Matrix_write_mtx (NULL, A, NULL)) ;
+    ERR (GxB_Matrix_write_mtx (MTXFILE, NULL, NULL)) ;
+
+    // files that cannot be opened
+    expected = GrB_INVALID_VALUE ;
+    remove (MTXFILE) ;
+    ERR (GxB_Matrix_read_mtx (&C, NULL, MTXFILE, NULL)) ;
+    CHECK (C == NULL) ;
+    ERR (GxB_Matrix_write_mtx ("no_such_folder/GB_mex_test49.mtx", A, NULL)) ;
+    GrB_Matrix_free (&A) ;
+
+    // user-defined types are not supported
+    OK (GrB_Matrix_new (&A, mytype, 2, 2)) ;
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Matrix_write_mtx (MTXFILE, A, NULL)) ;
+    GrB_Matrix_free (&A) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate real general\n"
+        "2 2 0\n", mytype, GrB_DOMAIN_MISMATCH)) ;
+
+    // invalid headers
+    OK (check_error ("", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("hello\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket vector coordinate real general\n"
+        "2 2 0\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix sparse real general\n"
+        "2 2 0\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate quaternion general\n"
+        "2 2 0\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate real upper\n"
+        "2 2 0\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix array pattern general\n"
+        "2 2\n", NULL, GrB_INVALID_OBJECT)) ;
+
+    // invalid size lines
+    OK (check_error ("%%MatrixMarket matrix coordinate real general\n",
+        NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate real general\n"
+        "2 2\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate real general\n"
+        "-2 2 0\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate real general\n"
+        "2 2.5 0\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate real general\n"
+        "2 99999999999999999999 0\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate real general\n"
+        "2 2305843009213693952 0\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate real symmetric\n"
+        "2 3 0\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix array real general\n"
+        "4294967296 4294967296\n", NULL, GrB_INVALID_OBJECT)) ;
+
+    // the wrong number of entries
+    OK (check_error ("%%MatrixMarket matrix coordinate real general\n"
+        "2 2 2\n1 1 1\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate real general\n"
+        "2 2 1\n1 1 1\n2 2 2\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix array real general\n"
+        "2 2\n1\n2\n3\n", NULL, GrB_INVALID_OBJECT)) ;
+
+    // invalid data lines
+    OK (check_error ("%%MatrixMarket matrix coordinate real general\n"
+        "2 2 1\n1 1\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate real general\n"
+        "2 2 1\n1 x 1\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate real general\n"
+        "2 2 1\n1 1 1.5x\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate real general\n"
+        "2 2 1\n1 1 .\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate integer general\n"
+        "2 2 1\n1 1 1.5\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate integer general\n"
+        "2 2 1\n1 1 99999999999999999999\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate complex general\n"
+        "2 2 1\n1 1 1\n", NULL, GrB_INVALID_OBJECT)) ;
+    OK (check_error ("%%MatrixMarket matrix array real general\n"
+        "1 1\nhello\n", NULL, GrB_INVALID_OBJECT)) ;
+
+    // indices out of bounds
+    OK (check_error ("%%MatrixMarket matrix coordinate real general\n"
+        "2 2 1\n3 1 1\n", NULL, GrB_INDEX_OUT_OF_BOUNDS)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate real general\n"
+        "2 2 1\n1 0 1\n", NULL, GrB_INDEX_OUT_OF_BOUNDS)) ;
+    OK (check_error ("%%MatrixMarket matrix coordinate pattern general\n"
+        "2 2 1\n1 -1\n", NULL, GrB_INDEX_OUT_OF_BOUNDS)) ;
+
+    //--------------------------------------------------------------------------
+    // binary edge lists
+    //--------------------------------------------------------------------------
+
+    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+    {
+        OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads,
+            (GrB_Field) GxB_NTHREADS)) ;
+        for (size_t isize = 4 ; isize <= 8 ; isize += 4)
+        {
+            for (int sorted = 0 ; sorted <= 1 ; sorted++)
+            {
+                OK (check_edges (1000, 50, 70, 0, 0, isize, sorted, NULL)) ;
+                OK (check_edges (1000, 50, 70, 60, 0, isize, sorted,
+                    GrB_BOOL)) ;
+                OK (check_edges (1000, 50, 70, 0, 80, isize, sorted,
+                    GrB_INT32)) ;
+                OK (check_edges (1000, 50, 70, 50, 70, isize, sorted,
+                    GxB_FC64)) ;
+                OK (check_edges (1000000, 100000, 200000, 0, 0, isize,
+                    sorted, GrB_FP64)) ;
+                OK (GrB_Global_set_INT32 (GrB_GLOBAL, GrB_ROWMAJOR,
+                    GrB_STORAGE_ORIENTATION_HINT)) ;
+                OK (check_edges (100000, 1000, 2000, 0, 0, isize, sorted,
+                    NULL)) ;
+                OK (GrB_Global_set_INT32 (GrB_GLOBAL, GrB_COLMAJOR,
+                    GrB_STORAGE_ORIENTATION_HINT)) ;
+            }
+        }
+    }
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, nthreads_save,
+        (GrB_Field) GxB_NTHREADS)) ;
+
+    // a single edge
+    OK (check_edges (1, 1, 1, 0, 0, 8, true, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // edge list errors
+    //--------------------------------------------------------------------------
+
+    uint64_t E [4] = { 0, 1, 2, 3 } ;
+    CHECK (write_bytes (BINFILE, E, sizeof (E))) ;
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_read_edges (NULL, NULL, 0, 0, BINFILE, 8, NULL)) ;
+    ERR (GxB_Matrix_read_edges (&C, NULL, 0, 0, NULL, 8, NULL)) ;
+    CHECK (C == NULL) ;
+
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Matrix_read_edges (&C, NULL, 0, 0, BINFILE, 2, NULL)) ;
+    ERR (GxB_Matrix_read_edges (&C, NULL, 0, 0, BINFILE, 16, NULL)) ;
+    ERR (GxB_Matrix_read_edges (&C, NULL, GB_NMAX + 1, 0, BINFILE, 8,
+        NULL)) ;
+    ERR (GxB_Matrix_read_edges (&C, NULL, 0, GB_NMAX + 1, BINFILE, 8,
+        NULL)) ;
+    CHECK (C == NULL) ;
+
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Matrix_read_edges (&C, mytype, 0, 0, BINFILE, 8, NULL)) ;
+    CHECK (C == NULL) ;
+
+    // indices out of bounds
+    expected = GrB_INDEX_OUT_OF_BOUNDS ;
+    ERR (GxB_Matrix_read_edges (&C, NULL, 2, 0, BINFILE, 8, NULL)) ;
+    ERR (GxB_Matrix_read_edges (&C, NULL, 0, 3, BINFILE, 8, NULL)) ;
+    CHECK (C == NULL) ;
+    E [3] = GB_NMAX ;
+    CHECK (write_bytes (BINFILE, E, sizeof (E))) ;
+    ERR (GxB_Matrix_read_edges (&C, NULL, 0, 0, BINFILE, 8, NULL)) ;
+    ERR (GxB_Matrix_read_edges (&C, NULL, 10, 10, BINFILE, 8, NULL)) ;
+    E [3] = UINT64_MAX ;
+    CHECK (write_bytes (BINFILE, E, sizeof (E))) ;
+    ERR (GxB_Matrix_read_edges (&C, NULL, 0, 0, BINFILE, 8, NULL)) ;
+    ERR (GxB_Matrix_read_edges (&C, NULL, 10, 10, BINFILE, 8, NULL)) ;
+    CHECK (C == NULL) ;
+
+    // the file must hold a whole number of edges
+    expected = GrB_INVALID_OBJECT ;
+    CHECK (write_bytes (BINFILE, E, 3 * sizeof (uint32_t))) ;
+    ERR (GxB_Matrix_read_edges (&C, NULL, 0, 0, BINFILE, 4, NULL)) ;
+    CHECK (write_bytes (BINFILE, E, 3 * sizeof (uint64_t))) ;
+    ERR (GxB_Matrix_read_edges (&C, NULL, 0, 0, BINFILE, 8, NULL)) ;
+    CHECK (write_bytes (BINFILE, E, 0)) ;
+    ERR (GxB_Matrix_read_edges (&C, NULL, 0, 0, BINFILE, 8, NULL)) ;
+    CHECK (C == NULL) ;
+
+    // the file must exist
+    expected = GrB_INVALID_VALUE ;
+    remove (BINFILE) ;
+    ERR (GxB_Matrix_read_edges (&C, NULL, 0, 0, BINFILE, 8, NULL)) ;
+    CHECK (C == NULL) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test49: all tests passed\n\n") ;
+}
@@ -0,0 +1,1006 @@
+//------------------------------------------------------------------------------
+// GB_mex_test50: test GxB_Matrix_export_Arrow and GxB_Matrix_import_Arrow
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Matrices of each type, sparsity, and format are exported as an ArrowArray
+// and ArrowSchema with GxB_Matrix_export_Arrow, the layout of the schema is
+// checked, and the matrix is imported back with GxB_Matrix_import_Arrow, which
+// must return the same matrix, with the buffers of the ArrowArray held as
+// shallow components.  Modifying the imported matrix must copy its content
+// and release the ArrowArray (copy-on-write).  ArrowArrays built by hand are
+// then imported, with release callbacks that count how often they are called:
+// the ArrowSchema must be released once by the import, and the ArrowArray
+// once when the matrix is freed or modified.  These include bit-packed
+// booleans, non-zero offsets, and empty buffers.  On error, the ArrowArray and
+// ArrowSchema must be left unchanged and still owned by the caller.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix
+//------------------------------------------------------------------------------
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&A_fp64) ;         \
+    if (I != NULL) mxFree (I) ;         \
+    if (J != NULL) mxFree (J) ;         \
+    if (X != NULL) mxFree (X) ;         \
+}
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Type type,      // any built-in type
+    GrB_Index m,
+    GrB_Index n,
+    GrB_Index nz,       // # of entries to create, for a sparse matrix
+    int sparsity,       // GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, or GxB_FULL
+    bool iso,
+    int format          // GxB_BY_ROW or GxB_BY_COL
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix A = NULL, A_fp64 = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    OK (GrB_Matrix_new (&A_fp64, GrB_FP64, m, n)) ;
+    if (sparsity == GxB_FULL)
+    {
+        OK (GrB_Matrix_assign_FP64 (A_fp64, NULL, NULL, 3, GrB_ALL, m,
+            GrB_ALL, n, NULL)) ;
+    }
+    else
+    {
+        I = mxMalloc (nz * sizeof (GrB_Index)) ;
+        J = mxMalloc (nz * sizeof (GrB_Index)) ;
+        X = mxMalloc (nz * sizeof (double)) ;
+        CHECK (I != NULL && J != NULL && X != NULL) ;
+        for (int64_t k = 0 ; k < nz ; k++)
+        {
+            I [k] = simple_rand_i ( ) % m ;
+            J [k] = simple_rand_i ( ) % n ;
+            X [k] = 3 ;
+        }
+        OK (GrB_Matrix_build_FP64 (A_fp64, I, J, X, nz, GrB_SECOND_FP64)) ;
+    }
+    if (!iso)
+    {
+        // A(i,j) = i - j + A(i,j), so that some boolean values are false
+        OK (GrB_Matrix_apply_IndexOp_INT64 (A_fp64, NULL, GrB_PLUS_FP64,
+            GrB_ROWINDEX_INT64, A_fp64, 0, NULL)) ;
+        OK (GrB_Matrix_apply_IndexOp_INT64 (A_fp64, NULL, GrB_MINUS_FP64,
+            GrB_COLINDEX_INT64, A_fp64, 0, NULL)) ;
+    }
+    OK (GrB_Matrix_new (&A, type, m, n)) ;
+    OK (GrB_Matrix_set_INT32 (A, format, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_assign (A, NULL, NULL, A_fp64, GrB_ALL, m, GrB_ALL, n,
+        NULL)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_set_INT32 (A, sparsity, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    CHECK (GB_sparsity (A) == sparsity) ;
+    (*A_handle) = A ;
+    A = NULL ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_same: check if C and A hold the same matrix
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Matrix_free (&A2) ;             \
+}
+
+static GrB_Info check_same
+(
+    GrB_Matrix C,
+    GrB_Matrix A
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix C2 = NULL, A2 = NULL ;
+    OK (GrB_Matrix_dup (&C2, C)) ;
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C2, A2, 0)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// metadata_put: append a key/value pair to Arrow schema metadata
+//------------------------------------------------------------------------------
+
+// The metadata is an int32 count of the key/value pairs, followed by each
+// pair as an int32 length and the bytes of the key, then of the value.
+
+static size_t metadata_put
+(
+    char *metadata,         // metadata to append to
+    size_t len,             // current length of the metadata, or 0 if empty
+    const char *key,
+    const char *value
+)
+{
+    int32_t npairs = 0 ;
+    if (len == 0)
+    {
+        len = sizeof (int32_t) ;
+    }
+    else
+    {
+        memcpy (&npairs, metadata, sizeof (int32_t)) ;
+    }
+    npairs++ ;
+    memcpy (metadata, &npairs, sizeof (int32_t)) ;
+    int32_t klen = (int32_t) strlen (key) ;
+    int32_t vlen = (int32_t) strlen (value) ;
+    memcpy (metadata + len, &klen, sizeof (int32_t)) ;
+    memcpy (metadata + len + sizeof (int32_t), key, klen) ;
+    len += sizeof (int32_t) + klen ;
+    memcpy (metadata + len, &vlen, sizeof (int32_t)) ;
+    memcpy (metadata + len + sizeof (int32_t), value, vlen) ;
+    return (len + sizeof (int32_t) + vlen) ;
+}
+
+//------------------------------------------------------------------------------
+// metadata_get: find a key in Arrow schema metadata
+//------------------------------------------------------------------------------
+
+static bool metadata_get
+(
+    char *value,            // value of the key, of size 64
+    const char *metadata,
+    const char *key
+)
+{
+    if (metadata == NULL) return (false) ;
+    int32_t npairs ;
+    memcpy (&npairs, metadata, sizeof (int32_t)) ;
+    const char *s = metadata + sizeof (int32_t) ;
+    for (int32_t k = 0 ; k < npairs ; k++)
+    {
+        int32_t klen, vlen ;
+        memcpy (&klen, s, sizeof (int32_t)) ;
+        const char *kstring = s + sizeof (int32_t) ;
+        s = kstring + klen ;
+        memcpy (&vlen, s, sizeof (int32_t)) ;
+        const char *vstring = s + sizeof (int32_t) ;
+        s = vstring + vlen ;
+        if (klen == (int32_t) strlen (key) && memcmp (kstring, key, klen) == 0
+            && vlen < 64)
+        {
+            memcpy (value, vstring, vlen) ;
+            value [vlen] = '\0' ;
+            return (true) ;
+        }
+    }
+    return (false) ;
+}
+
+//------------------------------------------------------------------------------
+// user_arrow: an ArrowArray and ArrowSchema built by the user
+//------------------------------------------------------------------------------
+
+// The nodes are: 0: the struct "+s" of all vectors, 1: "id" (hypersparse
+// only), 2: "vectors" "+L", 3: "entries" "+s", 4: "index" "l", 5: "value".
+// The release callbacks of the root nodes count how often they are called.
+
+typedef struct
+{
+    struct ArrowArray node [6] ;
+    struct ArrowArray *children [6] ;
+    const void *buffers [6][2] ;
+    struct ArrowSchema snode [6] ;
+    struct ArrowSchema *schildren [6] ;
+    char metadata [256] ;
+}
+user_arrow ;
+
+static int array_released = 0 ;
+static int schema_released = 0 ;
+
+static void user_array_release (struct ArrowArray *a)
+{
+    for (int64_t k = 0 ; k < a->n_children ; k++)
+    {
+        struct ArrowArray *child = a->children [k] ;
+        if (child->release != NULL) child->release (child) ;
+    }
+    a->release = NULL ;
+    if (a->private_data != NULL) array_released++ ;
+}
+
+static void user_schema_release (struct ArrowSchema *s)
+{
+    for (int64_t k = 0 ; k < s->n_children ; k++)
+    {
+        struct ArrowSchema *child = s->children [k] ;
+        if (child->release != NULL) child->release (child) ;
+    }
+    s->release = NULL ;
+    if (s->private_data != NULL) schema_released++ ;
+}
+
+//------------------------------------------------------------------------------
+// user_arrow_init: construct a user ArrowArray and ArrowSchema
+//------------------------------------------------------------------------------
+
+// The root nodes are u->node [0] and u->snode [0].  The offsets of all nodes
+// are zero, and can be changed by the caller.
+
+static void user_arrow_init
+(
+    user_arrow *u,
+    int64_t nrows,
+    int64_t ncols,
+    const char *format,     // "CSR", "CSC", ..., or NULL if not present
+    bool is_hyper,
+    int64_t nvec,
+    const int64_t *Ap,      // the "vectors" offsets, of size nvec+1
+    const int64_t *Ah,      // the "id" buffer, of size nvec, if hypersparse
+    int64_t nentries,       // length of the "entries" struct
+    const int64_t *Ai,      // the "index" buffer
+    const void *Ax,         // the "value" buffer
+    const char *value_format
+)
+{
+    memset (u, 0, sizeof (user_arrow)) ;
+    char nrows_string [32], ncols_string [32] ;
+    snprintf (nrows_string, 32, "%" PRId64, nrows) ;
+    snprintf (ncols_string, 32, "%" PRId64, ncols) ;
+    size_t len = 0 ;
+    len = metadata_put (u->metadata, len, "GraphBLAS.nrows", nrows_string) ;
+    len = metadata_put (u->metadata, len, "GraphBLAS.ncols", ncols_string) ;
+    if (format != NULL)
+    {
+        len = metadata_put (u->metadata, len, "GraphBLAS.format", format) ;
+    }
+    int parent [6] = { -1, 0, 0, 2, 3, 3 } ;
+    int64_t length [6] = { nvec, nvec, nvec, nentries, nentries, nentries } ;
+    const void *X [6] = { NULL, Ah, Ap, NULL, Ai, Ax } ;
+    const char *name [6] = { "", "id", "vectors", "entries", "index",
+        "value" } ;
+    const char *fmt [6] = { "+s", "l", "+L", "+s", "l", value_format } ;
+    int nchildren = 0 ;
+    for (int k = 0 ; k < 6 ; k++)
+    {
+        if (k == 1 && !is_hyper) continue ;
+        struct ArrowArray *a = &(u->node [k]) ;
+        a->length = length [k] ;
+        a->n_buffers = (k == 0 || k == 3) ? 1 : 2 ;
+        a->buffers = u->buffers [k] ;
+        a->buffers [1] = X [k] ;
+        a->release = user_array_release ;
+        a->private_data = (k == 0) ? u : NULL ;
+        struct ArrowSchema *s = &(u->snode [k]) ;
+        s->format = fmt [k] ;
+        s->name = name [k] ;
+        s->metadata = (k == 0) ? u->metadata : NULL ;
+        s->release = user_schema_release ;
+        s->private_data = (k == 0) ? u : NULL ;
+        int p = parent [k] ;
+        if (p >= 0)
+        {
+            struct ArrowArray *ap = &(u->node [p]) ;
+            struct ArrowSchema *sp = &(u->snode [p]) ;
+            if (ap->n_children == 0)
+            {
+                ap->children = &(u->children [nchildren]) ;
+                sp->children = &(u->schildren [nchildren]) ;
+            }
+            ap->children [ap->n_children++] = a ;
+            sp->children [sp->n_children++] = s ;
+            nchildren++ ;
+        }
+    }
+    array_released = 0 ;
+    schema_released = 0 ;
+}
+
+//------------------------------------------------------------------------------
+// check_import_error: check that a user ArrowArray cannot be imported
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C) ;              \
+}
+
+static GrB_Info check_import_error
+(
+    user_arrow *u,
+    GrB_Type type,
+    GrB_Descriptor desc,
+    GrB_Info expected
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix C = NULL ;
+    ERR (GxB_Matrix_import_Arrow (&C, type, &(u->node [0]), &(u->snode [0]),
+        desc)) ;
+    CHECK (C == NULL) ;
+    // the array and schema are unchanged, and still owned by the caller
+    CHECK (array_released == 0 && schema_released == 0) ;
+    CHECK (u->node [0].release == user_array_release) ;
+    CHECK (u->snode [0].release == user_schema_release) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test50
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free (&A) ;                      \
+    GrB_Matrix_free (&A0) ;                     \
+    GrB_Matrix_free (&C) ;                      \
+    GrB_Matrix_free (&D) ;                      \
+    GrB_Type_free (&mytype) ;                   \
+    GrB_Descriptor_free (&desc) ;               \
+    if (array.release != NULL) array.release (&array) ;     \
+    if (schema.release != NULL) schema.release (&schema) ;  \
+}
+
+typedef struct { float a, b, c ; } mytype_t ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected = GrB_SUCCESS ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, A0 = NULL, C = NULL, D = NULL ;
+    GrB_Type mytype = NULL ;
+    GrB_Descriptor desc = NULL ;
+    struct ArrowArray array ;
+    struct ArrowSchema schema ;
+    memset (&array, 0, sizeof (struct ArrowArray)) ;
+    memset (&schema, 0, sizeof (struct ArrowSchema)) ;
+    user_arrow u ;
+    char value [64] ;
+    simple_rand_seed (50) ;
+    OK (GxB_Type_new (&mytype, sizeof (mytype_t), "mytype_t",
+        "typedef struct { float a, b, c ; } mytype_t ;")) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_SECURE_IMPORT,
+        (GrB_Field) GxB_IMPORT)) ;
+
+    //--------------------------------------------------------------------------
+    // export and import a matrix of each built-in type
+    //--------------------------------------------------------------------------
+
+    GrB_Type types [13] =
+    {
+        GrB_BOOL, GrB_INT8, GrB_INT16, GrB_INT32, GrB_INT64,
+        GrB_UINT8, GrB_UINT16, GrB_UINT32, GrB_UINT64,
+        GrB_FP32, GrB_FP64, GxB_FC32, GxB_FC64
+    } ;
+    const char *value_formats [13] =
+    {
+        "C", "c", "s", "i", "l",
+        "C", "S", "I", "L",
+        "f", "g", "+w:2", "+w:2"
+    } ;
+
+    for (int kt = 0 ; kt < 13 ; kt++)
+    {
+        GrB_Type type = types [kt] ;
+        bool is_complex = (type == GxB_FC32 || type == GxB_FC64) ;
+        for (int sparsity = 1 ; sparsity <= 8 ; sparsity *= 2)
+        {
+            for (int format = GxB_BY_ROW ; format <= GxB_BY_COL ; format++)
+            {
+                for (int iso = 0 ; iso <= 1 ; iso++)
+                {
+
+                    //----------------------------------------------------------
+                    // create the matrix and export it
+                    //----------------------------------------------------------
+
+                    OK (random_matrix (&A, type, 40, 50, 300, sparsity, iso,
+                        format)) ;
+                    OK (GrB_Matrix_dup (&A0, A)) ;
+                    bool is_hyper = (sparsity == GxB_HYPERSPARSE) ;
+                    bool is_csc = (format == GxB_BY_COL) ;
+                    GrB_Index nvals ;
+                    OK (GrB_Matrix_nvals (&nvals, A)) ;
+                    OK (GxB_Matrix_export_Arrow (&array, &schema, &A, NULL)) ;
+                    CHECK (A == NULL) ;
+
+                    //----------------------------------------------------------
+                    // check the layout of the schema and array
+                    //----------------------------------------------------------
+
+                    CHECK (strcmp (schema.format, "+s") == 0) ;
+                    CHECK (schema.n_children == (is_hyper ? 2 : 1)) ;
+                    CHECK (array.n_children == (is_hyper ? 2 : 1)) ;
+                    CHECK (array.null_count == 0 && array.offset == 0) ;
+                    CHECK (metadata_get (value, schema.metadata,
+                        "GraphBLAS.nrows")) ;
+                    CHECK (strcmp (value, "40") == 0) ;
+                    CHECK (metadata_get (value, schema.metadata,
+                        "GraphBLAS.ncols")) ;
+                    CHECK (strcmp (value, "50") == 0) ;
+                    CHECK (metadata_get (value, schema.metadata,
+                        "GraphBLAS.format")) ;
+                    CHECK (strcmp (value, is_csc ?
+                        (is_hyper ? "HyperCSC" : "CSC") :
+                        (is_hyper ? "HyperCSR" : "CSR")) == 0) ;
+                    CHECK (metadata_get (value, schema.metadata,
+                        "GraphBLAS.type")) ;
+                    struct ArrowSchema *vec_s =
+                        schema.children [is_hyper ? 1 : 0] ;
+                    struct ArrowArray *vec = array.children [is_hyper ? 1 : 0] ;
+                    if (is_hyper)
+                    {
+                        CHECK (strcmp (schema.children [0]->name, "id") == 0) ;
+                        CHECK (strcmp (schema.children [0]->format, "l") == 0) ;
+                        CHECK (array.children [0]->length == array.length) ;
+                    }
+                    else
+                    {
+                        CHECK (array.length == (is_csc ? 50 : 40)) ;
+                    }
+                    CHECK (strcmp (vec_s->name, "vectors") == 0) ;
+                    CHECK (strcmp (vec_s->format, "+L") == 0) ;
+                    CHECK (vec->length == array.length) ;
+                    const int64_t *Ap = (const int64_t *) vec->buffers [1] ;
+                    CHECK (Ap [0] == 0 && Ap [array.length] == nvals) ;
+                    struct ArrowSchema *ent_s = vec_s->children [0] ;
+                    struct ArrowArray *ent = vec->children [0] ;
+                    CHECK (strcmp (ent_s->format, "+s") == 0) ;
+                    CHECK (ent->length == nvals) ;
+                    CHECK (ent->n_children == 2) ;
+                    CHECK (strcmp (ent_s->children [0]->name, "index") == 0) ;
+                    CHECK (strcmp (ent_s->children [1]->name, "value") == 0) ;
+                    CHECK (strcmp (ent_s->children [1]->format,
+                        value_formats [kt]) == 0) ;
+                    CHECK (ent->children [1]->n_children == (is_complex ? 1:0));
+                    if (is_complex)
+                    {
+                        // the "item" field holds the real and imaginary parts
+                        CHECK (ent->children [1]->children [0]->length ==
+                            2 * nvals) ;
+                    }
+
+                    //----------------------------------------------------------
+                    // the type of C must match the values
+                    //----------------------------------------------------------
+
+                    expected = GrB_DOMAIN_MISMATCH ;
+                    ERR (GxB_Matrix_import_Arrow (&C,
+                        (type == GrB_INT64) ? GrB_FP64 : GrB_INT64,
+                        &array, &schema, NULL)) ;
+                    ERR (GxB_Matrix_import_Arrow (&C, mytype,
+                        &array, &schema, NULL)) ;
+                    CHECK (C == NULL) ;
+                    CHECK (array.release != NULL && schema.release != NULL) ;
+
+                    //----------------------------------------------------------
+                    // import the matrix back, with no copy
+                    //----------------------------------------------------------
+
+                    OK (GxB_Matrix_import_Arrow (&C, type, &array, &schema,
+                        (iso) ? desc : NULL)) ;
+                    CHECK (array.release == NULL) ;
+                    CHECK (schema.release == NULL) ;
+                    CHECK (C->mapping != NULL) ;
+                    CHECK (C->is_csc == is_csc) ;
+                    CHECK (GB_IS_HYPERSPARSE (C) == is_hyper) ;
+                    CHECK (C->p_shallow) ;
+                    CHECK (C->i_shallow == (nvals > 0)) ;
+                    CHECK (C->x_shallow == (nvals > 0)) ;
+                    CHECK (!C->iso) ;
+                    OK (check_same (C, A0)) ;
+
+                    //----------------------------------------------------------
+                    // a dup of C does not depend on C
+                    //----------------------------------------------------------
+
+                    OK (GrB_Matrix_dup (&D, C)) ;
+                    CHECK (D->mapping == NULL) ;
+                    CHECK (!D->p_shallow && !D->i_shallow && !D->x_shallow) ;
+                    if (kt % 2 == 0)
+                    {
+                        OK (GrB_Matrix_free (&C)) ;
+                    }
+
+                    //----------------------------------------------------------
+                    // modify C, which first copies C out of the ArrowArray
+                    //----------------------------------------------------------
+
+                    if (C != NULL)
+                    {
+                        OK (GrB_Matrix_setElement_INT32 (C, 1, 3, 4)) ;
+                        CHECK (C->mapping == NULL) ;
+                        CHECK (!C->p_shallow && !C->i_shallow &&
+                            !C->x_shallow) ;
+                        OK (GrB_Matrix_setElement_INT32 (A0, 1, 3, 4)) ;
+                        OK (GrB_Matrix_setElement_INT32 (D, 1, 3, 4)) ;
+                        OK (check_same (C, A0)) ;
+                    }
+                    OK (check_same (D, A0)) ;
+                    GrB_Matrix_free (&A0) ;
+                    GrB_Matrix_free (&C) ;
+                    GrB_Matrix_free (&D) ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // export and import a matrix with a user-defined type
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, mytype, 10, 20)) ;
+    for (int k = 0 ; k < 30 ; k++)
+    {
+        mytype_t x = { (float) k, (float) -k, 0.5f } ;
+        OK (GrB_Matrix_setElement_UDT (A, &x, simple_rand_i ( ) % 10,
+            simple_rand_i ( ) % 20)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_dup (&A0, A)) ;
+    OK (GxB_Matrix_export_Arrow (&array, &schema, &A, NULL)) ;
+    CHECK (metadata_get (value, schema.metadata, "GraphBLAS.type")) ;
+    CHECK (strcmp (value, "mytype_t") == 0) ;
+    struct ArrowSchema *ent_s = schema.children [0]->children [0] ;
+    snprintf (value, 64, "w:%d", (int) sizeof (mytype_t)) ;
+    CHECK (strcmp (ent_s->children [1]->format, value) == 0) ;
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Matrix_import_Arrow (&C, GrB_FP64, &array, &schema, NULL)) ;
+    OK (GxB_Matrix_import_Arrow (&C, mytype, &array, &schema, desc)) ;
+    OK (check_same (C, A0)) ;
+    GrB_Matrix_free (&A0) ;
+    GrB_Matrix_free (&C) ;
+
+    //--------------------------------------------------------------------------
+    // release an exported matrix after moving a child out of it
+    //--------------------------------------------------------------------------
+
+    // The Arrow C data interface allows the consumer to move a child out of
+    // its parent, and to release the two independently.
+
+    for (int sparsity = GxB_HYPERSPARSE ; sparsity <= GxB_SPARSE ; sparsity++)
+    {
+        OK (random_matrix (&A, GxB_FC64, 40, 50, 300, sparsity, false,
+            GxB_BY_COL)) ;
+        OK (GxB_Matrix_export_Arrow (&array, &schema, &A, NULL)) ;
+        struct ArrowArray *child = array.children [array.n_children - 1] ;
+        struct ArrowArray moved = (*child) ;
+        child->release = NULL ;
+        array.release (&array) ;
+        CHECK (array.release == NULL) ;
+        // the moved child still holds the entries of the matrix
+        struct ArrowArray *ent = moved.children [0] ;
+        CHECK (ent->length == ((int64_t *) moved.buffers [1]) [moved.length]) ;
+        moved.release (&moved) ;
+        CHECK (moved.release == NULL) ;
+        schema.release (&schema) ;
+        CHECK (schema.release == NULL) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // export errors
+    //--------------------------------------------------------------------------
+
+    expected = GrB_NULL_POINTER ;
+    OK (random_matrix (&A, GrB_FP64, 4, 5, 10, GxB_SPARSE, false,
+        GxB_BY_ROW)) ;
+    ERR (GxB_Matrix_export_Arrow (NULL, &schema, &A, NULL)) ;
+    ERR (GxB_Matrix_export_Arrow (&array, NULL, &A, NULL)) ;
+    ERR (GxB_Matrix_export_Arrow (&array, &schema, NULL, NULL)) ;
+    ERR (GxB_Matrix_export_Arrow (&array, &schema, &C, NULL)) ;
+    CHECK (A != NULL && array.release == NULL && schema.release == NULL) ;
+    GrB_Matrix_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // import a user ArrowArray
+    //--------------------------------------------------------------------------
+
+    // A is 4-by-5, held by row:
+    //  [ 1 . 2 . . ]
+    //  [ . . . . . ]
+    //  [ . 3 . 4 5 ]
+    //  [ 6 . . . . ]
+
+    int64_t Ap [5] = { 0, 2, 2, 5, 6 } ;
+    int64_t Ai [6] = { 0, 2, 1, 3, 4, 0 } ;
+    int32_t Ax [6] = { 1, 2, 3, 4, 5, 6 } ;
+    GrB_Index I [6] = { 0, 0, 2, 2, 2, 3 } ;
+    OK (GrB_Matrix_new (&A0, GrB_INT32, 4, 5)) ;
+    OK (GrB_Matrix_build_INT32 (A0, I, (GrB_Index *) Ai, Ax, 6, NULL)) ;
+
+    // import with and without the format metadata, freeing C at the end
+    for (int has_format = 0 ; has_format <= 1 ; has_format++)
+    {
+        user_arrow_init (&u, 4, 5, has_format ? "CSR" : NULL, false, 4,
+            Ap, NULL, 6, Ai, Ax, "i") ;
+        OK (GxB_Matrix_import_Arrow (&C, GrB_INT32, &(u.node [0]),
+            &(u.snode [0]), has_format ? desc : NULL)) ;
+        CHECK (schema_released == 1 && array_released == 0) ;
+        CHECK (u.node [0].release == NULL && u.snode [0].release == NULL) ;
+        CHECK (C->p_shallow && C->i_shallow && C->x_shallow) ;
+        CHECK (C->p == Ap && C->i == Ai && C->x == (void *) Ax) ;
+        CHECK (!C->is_csc) ;
+        OK (check_same (C, A0)) ;
+        // reading C does not copy it
+        int32_t s = 0 ;
+        OK (GrB_Matrix_reduce_INT32 (&s, NULL, GrB_PLUS_MONOID_INT32, C,
+            NULL)) ;
+        CHECK (s == 21) ;
+        OK (GrB_Matrix_extractElement_INT32 (&s, C, 2, 3)) ;
+        CHECK (s == 4) ;
+        CHECK (C->mapping != NULL && array_released == 0) ;
+        OK (GrB_Matrix_dup (&D, C)) ;
+        CHECK (array_released == 0) ;
+        GrB_Matrix_free (&C) ;
+        CHECK (schema_released == 1 && array_released == 1) ;
+        // D does not depend on the ArrowArray
+        OK (check_same (D, A0)) ;
+        GrB_Matrix_free (&D) ;
+    }
+
+    // import, then modify C, which releases the ArrowArray once
+    user_arrow_init (&u, 4, 5, "CSR", false, 4, Ap, NULL, 6, Ai, Ax, "i") ;
+    OK (GxB_Matrix_import_Arrow (&C, GrB_INT32, &(u.node [0]),
+        &(u.snode [0]), NULL)) ;
+    CHECK (schema_released == 1 && array_released == 0) ;
+    OK (GrB_Matrix_setElement_INT32 (C, 7, 1, 1)) ;
+    CHECK (array_released == 1) ;
+    CHECK (C->mapping == NULL) ;
+    CHECK (!C->p_shallow && !C->i_shallow && !C->x_shallow) ;
+    // the user buffers are unchanged
+    CHECK (Ap [2] == 2 && Ax [2] == 3) ;
+    OK (GrB_Matrix_dup (&D, A0)) ;
+    OK (GrB_Matrix_setElement_INT32 (D, 7, 1, 1)) ;
+    OK (check_same (C, D)) ;
+    OK (GrB_Matrix_setElement_INT32 (C, 8, 0, 0)) ;
+    GrB_Matrix_free (&C) ;
+    GrB_Matrix_free (&D) ;
+    CHECK (schema_released == 1 && array_released == 1) ;
+
+    // import, then clear C
+    user_arrow_init (&u, 4, 5, "CSR", false, 4, Ap, NULL, 6, Ai, Ax, "i") ;
+    OK (GxB_Matrix_import_Arrow (&C, GrB_INT32, &(u.node [0]),
+        &(u.snode [0]), NULL)) ;
+    OK (GrB_Matrix_clear (C)) ;
+    CHECK (array_released == 1) ;
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, C)) ;
+    CHECK (nvals == 0) ;
+    GrB_Matrix_free (&C) ;
+    CHECK (schema_released == 1 && array_released == 1) ;
+
+    // import as the transpose, held by column (HyperCSC with all vectors)
+    int64_t Ah [4] = { 0, 1, 2, 3 } ;
+    user_arrow_init (&u, 5, 4, "HyperCSC", true, 4, Ap, Ah, 6, Ai, Ax, "i") ;
+    OK (GxB_Matrix_import_Arrow (&C, GrB_INT32, &(u.node [0]),
+        &(u.snode [0]), desc)) ;
+    CHECK (C->is_csc && GB_IS_HYPERSPARSE (C)) ;
+    CHECK (C->h_shallow && C->h == Ah) ;
+    OK (GrB_Matrix_new (&D, GrB_INT32, 5, 4)) ;
+    OK (GrB_transpose (D, NULL, NULL, A0, NULL)) ;
+    OK (check_same (C, D)) ;
+    GrB_Matrix_free (&C) ;
+    GrB_Matrix_free (&D) ;
+    CHECK (schema_released == 1 && array_released == 1) ;
+
+    // hypersparse, with only the non-empty rows 0, 2, and 3
+    int64_t Hp [4] = { 0, 2, 5, 6 } ;
+    int64_t Hh [3] = { 0, 2, 3 } ;
+    user_arrow_init (&u, 4, 5, NULL, true, 3, Hp, Hh, 6, Ai, Ax, "i") ;
+    OK (GxB_Matrix_import_Arrow (&C, GrB_INT32, &(u.node [0]),
+        &(u.snode [0]), desc)) ;
+    CHECK (!C->is_csc && GB_IS_HYPERSPARSE (C) && C->nvec == 3) ;
+    OK (check_same (C, A0)) ;
+    GrB_Matrix_free (&C) ;
+    CHECK (schema_released == 1 && array_released == 1) ;
+
+    //--------------------------------------------------------------------------
+    // non-zero offsets
+    //--------------------------------------------------------------------------
+
+    // The buffers hold extra vectors and entries at the start, which are
+    // skipped by the offsets of the nodes.  The "vectors" offsets start at 2,
+    // so they are copied, but the other buffers are not.
+
+    {
+        int64_t Op [6] = { 99, 2, 4, 4, 7, 8 } ;
+        int64_t Oh [6] = { 99, 99, 0, 1, 2, 3 } ;
+        int64_t Oi [10] = { 99, 99, 99, 99, 0, 2, 1, 3, 4, 0 } ;
+        int32_t Ox [10] = { 99, 99, 99, 99, 1, 2, 3, 4, 5, 6 } ;
+        for (int is_hyper = 0 ; is_hyper <= 1 ; is_hyper++)
+        {
+            user_arrow_init (&u, 4, 5, NULL, is_hyper, 4, Op, Oh, 9, Oi, Ox,
+                "i") ;
+            // the root offset skips vector 0 of the children
+            u.node [0].offset = 1 ;
+            u.node [0].length = 4 ;
+            u.node [2].length = 5 ;
+            if (is_hyper)
+            {
+                // the "id" node skips one more vector
+                u.node [1].offset = 1 ;
+                u.node [1].length = 5 ;
+            }
+            // the "vectors" offsets start at 2, the "entries" offset skips
+            // one more entry, and the "index" and "value" offsets one more
+            u.node [3].offset = 1 ;
+            u.node [4].offset = 1 ;
+            u.node [4].length = 9 ;
+            u.node [5].offset = 1 ;
+            u.node [5].length = 9 ;
+            OK (GxB_Matrix_import_Arrow (&C, GrB_INT32, &(u.node [0]),
+                &(u.snode [0]), desc)) ;
+            CHECK (!C->p_shallow && C->i_shallow && C->x_shallow) ;
+            CHECK (C->i == Oi + 4 && C->x == (void *) (Ox + 4)) ;
+            CHECK (C->h_shallow == is_hyper) ;
+            OK (check_same (C, A0)) ;
+            GrB_Matrix_free (&C) ;
+            CHECK (schema_released == 1 && array_released == 1) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // boolean values, as uint8 and bit-packed
+    //--------------------------------------------------------------------------
+
+    {
+        // A is 4-by-5 with the pattern above, and values 1, 0, 1, 1, 0, 1
+        bool Bx [6] = { 1, 0, 1, 1, 0, 1 } ;
+        OK (GrB_Matrix_new (&D, GrB_BOOL, 4, 5)) ;
+        OK (GrB_Matrix_build_BOOL (D, I, (GrB_Index *) Ai, Bx, 6, NULL)) ;
+        user_arrow_init (&u, 4, 5, "CSR", false, 4, Ap, NULL, 6, Ai, Bx,
+            "C") ;
+        OK (GxB_Matrix_import_Arrow (&C, GrB_BOOL, &(u.node [0]),
+            &(u.snode [0]), desc)) ;
+        CHECK (C->x_shallow && C->x == (void *) Bx) ;
+        OK (check_same (C, D)) ;
+        GrB_Matrix_free (&C) ;
+        CHECK (schema_released == 1 && array_released == 1) ;
+        // the values are the bits 3 to 8 (least significant first) of the
+        // bit-packed buffer, after 3 bits skipped by the "value" offset
+        uint8_t bits [2] = { 0x05 | 0x08 | 0x20 | 0x40, 0x01 } ;
+        user_arrow_init (&u, 4, 5, "CSR", false, 4, Ap, NULL, 6, Ai, bits,
+            "b") ;
+        u.node [5].offset = 3 ;
+        u.node [5].length = 9 ;
+        expected = GrB_DOMAIN_MISMATCH ;
+        OK (check_import_error (&u, GrB_UINT8, NULL, expected)) ;
+        OK (GxB_Matrix_import_Arrow (&C, GrB_BOOL, &(u.node [0]),
+            &(u.snode [0]), desc)) ;
+        CHECK (!C->x_shallow && C->i_shallow && C->p_shallow) ;
+        CHECK (schema_released == 1 && array_released == 0) ;
+        OK (check_same (C, D)) ;
+        GrB_Matrix_free (&C) ;
+        GrB_Matrix_free (&D) ;
+        CHECK (schema_released == 1 && array_released == 1) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // empty matrices, with no buffers
+    //--------------------------------------------------------------------------
+
+    {
+        int64_t Ep [6] = { 0, 0, 0, 0, 0, 0 } ;
+        for (int is_hyper = 0 ; is_hyper <= 1 ; is_hyper++)
+        {
+            int64_t nvec = is_hyper ? 0 : 5 ;
+            user_arrow_init (&u, 3, 5, is_hyper ? "HyperCSC" : "CSC",
+                is_hyper, nvec, Ep, NULL, 0, NULL, NULL, "g") ;
+            OK (GxB_Matrix_import_Arrow (&C, GrB_FP64, &(u.node [0]),
+                &(u.snode [0]), desc)) ;
+            CHECK (schema_released == 1 && array_released == 0) ;
+            OK (GrB_Matrix_nvals (&nvals, C)) ;
+            CHECK (nvals == 0 && C->is_csc) ;
+            CHECK (GB_IS_HYPERSPARSE (C) == is_hyper) ;
+            OK (GrB_Matrix_setElement_FP64 (C, 2, 1, 4)) ;
+            OK (GrB_Matrix_nvals (&nvals, C)) ;
+            CHECK (nvals == 1) ;
+            CHECK (array_released == 1) ;
+            GrB_Matrix_free (&C) ;
+            CHECK (schema_released == 1 && array_released == 1) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // import errors
+    //--------------------------------------------------------------------------
+
+    user_arrow_init (&u, 4, 5, "CSR", false, 4, Ap, NULL, 6, Ai, Ax, "i") ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_import_Arrow (NULL, GrB_INT32, &(u.node [0]),
+        &(u.snode [0]), NULL)) ;
+    ERR (GxB_Matrix_import_Arrow (&C, NULL, &(u.node [0]),
+        &(u.snode [0]), NULL)) ;
+    ERR (GxB_Matrix_import_Arrow (&C, GrB_INT32, NULL,
+        &(u.snode [0]), NULL)) ;
+    ERR (GxB_Matrix_import_Arrow (&C, GrB_INT32, &(u.node [0]),
+        NULL, NULL)) ;
+    CHECK (array_released == 0 && schema_released == 0) ;
+
+    // the array or schema has already been released
+    expected = GrB_INVALID_OBJECT ;
+    u.node [0].release = NULL ;
+    ERR (GxB_Matrix_import_Arrow (&C, GrB_INT32, &(u.node [0]),
+        &(u.snode [0]), NULL)) ;
+    u.node [0].release = user_array_release ;
+    u.snode [0].release = NULL ;
+    ERR (GxB_Matrix_import_Arrow (&C, GrB_INT32, &(u.node [0]),
+        &(u.snode [0]), NULL)) ;
+    u.snode [0].release = user_schema_release ;
+
+    // the layout must match the export
+    expected = GrB_INVALID_VALUE ;
+    u.snode [0].format = "+L" ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.snode [0].format = "+s" ;
+    u.node [0].n_buffers = 2 ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.node [0].n_buffers = 1 ;
+    u.snode [2].format = "+l" ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.snode [2].format = "+L" ;
+    u.snode [4].format = "i" ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.snode [4].format = "l" ;
+    u.node [3].n_children = 1 ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.node [3].n_children = 2 ;
+
+    // nulls are not allowed
+    int64_t validity = 0 ;
+    u.node [4].null_count = 1 ;
+    u.node [4].buffers [0] = &validity ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.node [4].null_count = 0 ;
+    u.node [4].buffers [0] = NULL ;
+
+    // the dimensions are required, and must be valid
+    u.snode [0].metadata = NULL ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    user_arrow_init (&u, 4, -1, "CSR", false, 4, Ap, NULL, 6, Ai, Ax, "i") ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    user_arrow_init (&u, 4, GB_NMAX + 1, "CSR", false, 4, Ap, NULL, 6, Ai,
+        Ax, "i") ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    user_arrow_init (&u, 5, 5, "CSR", false, 4, Ap, NULL, 6, Ai, Ax, "i") ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    user_arrow_init (&u, 4, 5, "CSC", false, 4, Ap, NULL, 6, Ai, Ax, "i") ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    user_arrow_init (&u, 3, 5, "HyperCSR", true, 4, Ap, Ah, 6, Ai, Ax, "i") ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+
+    // the format must match the layout
+    user_arrow_init (&u, 4, 5, "HyperCSR", false, 4, Ap, NULL, 6, Ai, Ax,
+        "i") ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    user_arrow_init (&u, 4, 5, "CSR", true, 4, Ap, Ah, 6, Ai, Ax, "i") ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    user_arrow_init (&u, 4, 5, "COO", false, 4, Ap, NULL, 6, Ai, Ax, "i") ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+
+    // the buffers must be long enough
+    user_arrow_init (&u, 4, 5, "CSR", false, 4, Ap, NULL, 6, Ai, Ax, "i") ;
+    u.node [2].length = 3 ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.node [2].length = 4 ;
+    u.node [3].length = 5 ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.node [3].length = 6 ;
+    u.node [4].length = 5 ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.node [4].length = 6 ;
+    u.node [5].length = 5 ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.node [5].length = 6 ;
+    u.node [3].offset = 1 ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.node [3].offset = 0 ;
+
+    // the buffers must be present, unless the matrix is empty
+    u.node [2].buffers [1] = NULL ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.node [2].buffers [1] = Ap ;
+    u.node [4].buffers [1] = NULL ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.node [4].buffers [1] = Ai ;
+    u.node [5].buffers [1] = NULL ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.node [5].buffers [1] = Ax ;
+
+    // the buffers must be aligned
+    int64_t Ai_space [7] ;
+    int64_t *Ai_misaligned = (int64_t *) (((char *) Ai_space) + 4) ;
+    memcpy (Ai_misaligned, Ai, 6 * sizeof (int64_t)) ;
+    u.node [4].buffers [1] = Ai_misaligned ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.node [4].buffers [1] = Ai ;
+
+    // the type of the values must match the type of C
+    expected = GrB_DOMAIN_MISMATCH ;
+    OK (check_import_error (&u, GrB_FP64, NULL, expected)) ;
+    OK (check_import_error (&u, GrB_BOOL, NULL, expected)) ;
+    OK (check_import_error (&u, mytype, NULL, expected)) ;
+    u.snode [5].format = "b" ;
+    OK (check_import_error (&u, GrB_INT32, NULL, expected)) ;
+    u.snode [5].format = "i" ;
+
+    // a secure import checks the content
+    {
+        int64_t Bp [5] = { 0, 2, 1, 5, 6 } ;
+        int64_t Bi [6] = { 2, 0, 1, 3, 4, 0 } ;
+        int64_t Bh [3] = { 0, 3, 2 } ;
+        int64_t Oi [6] = { 0, 2, 1, 3, 5, 0 } ;
+        int64_t Op [5] = { 2, 4, 4, 7, 8 } ;
+        // unsorted indices
+        expected = GrB_INDEX_OUT_OF_BOUNDS ;
+        user_arrow_init (&u, 4, 5, "CSR", false, 4, Ap, NULL, 6, Bi, Ax,
+            "i") ;
+        OK (check_import_error (&u, GrB_INT32, desc, expected)) ;
+        // an index out of range
+        expected = GrB_INVALID_OBJECT ;
+        user_arrow_init (&u, 4, 5, "CSR", false, 4, Ap, NULL, 6, Oi, Ax,
+            "i") ;
+        OK (check_import_error (&u, GrB_INT32, desc, expected)) ;
+        // offsets that decrease
+        user_arrow_init (&u, 4, 5, "CSR", false, 4, Bp, NULL, 6, Ai, Ax,
+            "i") ;
+        OK (check_import_error (&u, GrB_INT32, desc, expected)) ;
+        // unsorted hyperlist
+        user_arrow_init (&u, 4, 5, "HyperCSR", true, 3, Hp, Bh, 6, Ai, Ax,
+            "i") ;
+        OK (check_import_error (&u, GrB_INT32, desc, expected)) ;
+        // unsorted indices, with "vectors" offsets copied by the import
+        expected = GrB_INDEX_OUT_OF_BOUNDS ;
+        int64_t Bi2 [8] = { 99, 99, 2, 0, 1, 3, 4, 0 } ;
+        int32_t Ax2 [8] = { 99, 99, 1, 2, 3, 4, 5, 6 } ;
+        user_arrow_init (&u, 4, 5, "CSR", false, 4, Op, NULL, 8, Bi2, Ax2,
+            "i") ;
+        OK (check_import_error (&u, GrB_INT32, desc, expected)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test50: all tests passed\n\n") ;
+}
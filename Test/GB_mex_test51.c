@@ -0,0 +1,649 @@
+//------------------------------------------------------------------------------
+// GB_mex_test51: test GxB_Matrix_import_borrowed
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Matrices of each sparsity and format, iso and non-iso, are copied into
+// arrays owned by the test, which are imported with GxB_Matrix_import_borrowed.
+// The release function counts how often it is called for each import: it
+// must be called exactly once, when the matrix is freed or first modified
+// (copy-on-write), and never if the import fails.  The borrowed arrays must
+// never be modified, even when a jumbled matrix is sorted or a bitmap or full
+// matrix is converted to sparse for an export.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix
+//------------------------------------------------------------------------------
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    if (I != NULL) mxFree (I) ;         \
+    if (J != NULL) mxFree (J) ;         \
+    if (X != NULL) mxFree (X) ;         \
+}
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Index m,
+    GrB_Index n,
+    GrB_Index nz,       // # of entries to create, for a sparse matrix
+    int sparsity,       // GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, or GxB_FULL
+    bool iso,
+    int format          // GxB_BY_ROW or GxB_BY_COL
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix A = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    OK (GrB_Matrix_set_INT32 (A, format, GrB_STORAGE_ORIENTATION_HINT)) ;
+    if (sparsity == GxB_FULL)
+    {
+        OK (GrB_Matrix_assign_FP64 (A, NULL, NULL, 3, GrB_ALL, m, GrB_ALL, n,
+            NULL)) ;
+    }
+    else
+    {
+        I = mxMalloc (nz * sizeof (GrB_Index)) ;
+        J = mxMalloc (nz * sizeof (GrB_Index)) ;
+        X = mxMalloc (nz * sizeof (double)) ;
+        CHECK (I != NULL && J != NULL && X != NULL) ;
+        for (int64_t k = 0 ; k < nz ; k++)
+        {
+            I [k] = simple_rand_i ( ) % m ;
+            J [k] = simple_rand_i ( ) % n ;
+            X [k] = 3 ;
+        }
+        OK (GrB_Matrix_build_FP64 (A, I, J, X, nz, GrB_SECOND_FP64)) ;
+    }
+    if (!iso)
+    {
+        // A(i,j) = i + A(i,j)
+        OK (GrB_Matrix_apply_IndexOp_INT64 (A, NULL, GrB_PLUS_FP64,
+            GrB_ROWINDEX_INT64, A, 0, NULL)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_set_INT32 (A, sparsity, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    CHECK (GB_sparsity (A) == sparsity) ;
+    CHECK (A->iso == iso) ;
+    (*A_handle) = A ;
+    A = NULL ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_same: check if C and A hold the same matrix
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Matrix_free (&A2) ;             \
+}
+
+static GrB_Info check_same
+(
+    GrB_Matrix C,
+    GrB_Matrix A
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix C2 = NULL, A2 = NULL ;
+    OK (GrB_Matrix_dup (&C2, C)) ;
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C2, A2, 0)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// borrowed arrays
+//------------------------------------------------------------------------------
+
+// The arrays are allocated by the test, and a second copy of each is kept to
+// check that GraphBLAS never modifies them.
+
+typedef struct
+{
+    void *X [5] ;           // Ap, Ah, Ab, Ai, Ax
+    void *X_save [5] ;      // copy of each array
+    size_t X_size [5] ;     // size of each array in bytes
+    GrB_Index nvals ;       // # of entries, for the bitmap format
+    GrB_Index nvec ;        // # of vectors, for the hypersparse format
+    int sparsity ;
+    bool by_col, iso, jumbled ;
+    int nreleased ;         // # of times the arrays have been released
+}
+borrowed_t ;
+
+static void release_borrowed (void *handle)
+{
+    borrowed_t *B = (borrowed_t *) handle ;
+    B->nreleased++ ;
+}
+
+static void borrowed_free (borrowed_t *B)
+{
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        if (B->X [k] != NULL) mxFree (B->X [k]) ;
+        if (B->X_save [k] != NULL) mxFree (B->X_save [k]) ;
+        B->X [k] = NULL ;
+        B->X_save [k] = NULL ;
+    }
+}
+
+// true if the borrowed arrays are unchanged
+static bool borrowed_unchanged (borrowed_t *B)
+{
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        if (B->X [k] != NULL &&
+            memcmp (B->X [k], B->X_save [k], B->X_size [k]) != 0)
+        {
+            return (false) ;
+        }
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// borrowed_copy: copy the content of a matrix into borrowed arrays
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL ;
+
+static GrB_Info borrowed_copy
+(
+    borrowed_t *B,
+    GrB_Matrix A            // matrix to copy; must have no pending work
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    memset (B, 0, sizeof (borrowed_t)) ;
+    CHECK (!GB_ANY_PENDING_WORK (A)) ;
+    int64_t anz_held = GB_nnz_held (A) ;
+    B->sparsity = GB_sparsity (A) ;
+    B->by_col = A->is_csc ;
+    B->iso = A->iso ;
+    B->jumbled = A->jumbled ;
+    B->nvals = GB_nnz (A) ;
+    B->nvec = A->nvec ;
+    const void *Ax [5] = { A->p, A->h, A->b, A->i, A->x } ;
+    B->X_size [0] = (A->p == NULL) ? 0 : (A->nvec + 1) * sizeof (int64_t) ;
+    B->X_size [1] = (A->h == NULL) ? 0 : A->nvec * sizeof (int64_t) ;
+    B->X_size [2] = (A->b == NULL) ? 0 : anz_held ;
+    B->X_size [3] = (A->i == NULL) ? 0 : GB_nnz (A) * sizeof (int64_t) ;
+    B->X_size [4] = (A->iso ? 1 : anz_held) * A->type->size ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        if (Ax [k] == NULL || B->X_size [k] == 0) continue ;
+        B->X [k] = mxMalloc (B->X_size [k]) ;
+        B->X_save [k] = mxMalloc (B->X_size [k]) ;
+        CHECK (B->X [k] != NULL && B->X_save [k] != NULL) ;
+        memcpy (B->X [k], Ax [k], B->X_size [k]) ;
+        memcpy (B->X_save [k], Ax [k], B->X_size [k]) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// borrowed_import: import the borrowed arrays as a matrix
+//------------------------------------------------------------------------------
+
+static GrB_Info borrowed_import
+(
+    GrB_Matrix *C,
+    borrowed_t *B,
+    GrB_Type type,
+    GrB_Index nrows,
+    GrB_Index ncols,
+    GrB_Descriptor desc
+)
+{
+    return (GxB_Matrix_import_borrowed (C, type, nrows, ncols,
+        B->X [0], B->X [1], B->X [2], B->X [3], B->X [4],
+        B->X_size [0], B->X_size [1], B->X_size [2], B->X_size [3],
+        B->X_size [4], B->nvals, B->nvec, B->sparsity, B->by_col, B->iso,
+        B->jumbled, release_borrowed, B, desc)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test51
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free (&A) ;                      \
+    GrB_Matrix_free (&C) ;                      \
+    GrB_Matrix_free (&D) ;                      \
+    GrB_Matrix_free (&T) ;                      \
+    GrB_Descriptor_free (&desc) ;               \
+    borrowed_free (&B) ;                        \
+    if (Ti != NULL) mxFree (Ti) ;               \
+    if (Tj != NULL) mxFree (Tj) ;               \
+    if (Tx != NULL) mxFree (Tx) ;               \
+    if (blob != NULL) mxFree (blob) ;           \
+}
+
+#define NMODS 10
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected = GrB_SUCCESS ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL, D = NULL, T = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GrB_Index *Ti = NULL, *Tj = NULL ;
+    double *Tx = NULL ;
+    void *blob = NULL ;
+    borrowed_t B ;
+    memset (&B, 0, sizeof (borrowed_t)) ;
+    simple_rand_seed (51) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_SECURE_IMPORT,
+        (GrB_Field) GxB_IMPORT)) ;
+
+    //--------------------------------------------------------------------------
+    // borrow each sparsity, format, and iso property
+    //--------------------------------------------------------------------------
+
+    for (int sparsity = 1 ; sparsity <= 8 ; sparsity *= 2)
+    {
+        for (int format = GxB_BY_ROW ; format <= GxB_BY_COL ; format++)
+        {
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            {
+                for (int mod = 0 ; mod < NMODS ; mod++)
+                {
+
+                    //----------------------------------------------------------
+                    // import a copy of A from borrowed arrays
+                    //----------------------------------------------------------
+
+                    OK (random_matrix (&A, 40, 50, 200, sparsity, iso,
+                        format)) ;
+                    OK (borrowed_copy (&B, A)) ;
+                    OK (borrowed_import (&C, &B, GrB_FP64, 40, 50,
+                        (mod % 2 == 0) ? desc : NULL)) ;
+                    CHECK (B.nreleased == 0) ;
+                    CHECK (C->mapping != NULL) ;
+                    CHECK (GB_sparsity (C) == sparsity) ;
+                    CHECK (C->is_csc == (format == GxB_BY_COL)) ;
+                    CHECK (C->iso == iso) ;
+                    CHECK (C->p == B.X [0] && C->h == B.X [1]) ;
+                    CHECK (C->b == B.X [2] && C->i == B.X [3]) ;
+                    CHECK (C->x == B.X [4]) ;
+                    CHECK (C->p_shallow == (C->p != NULL)) ;
+                    CHECK (C->x_shallow) ;
+
+                    //----------------------------------------------------------
+                    // use C as an input, which does not release the arrays
+                    //----------------------------------------------------------
+
+                    OK (check_same (C, A)) ;
+                    double s = 0, t = 0 ;
+                    OK (GrB_Matrix_reduce_FP64 (&s, NULL,
+                        GrB_PLUS_MONOID_FP64, C, NULL)) ;
+                    OK (GrB_Matrix_reduce_FP64 (&t, NULL,
+                        GrB_PLUS_MONOID_FP64, A, NULL)) ;
+                    CHECK (s == t) ;
+                    OK (GrB_Matrix_new (&T, GrB_FP64, 50, 50)) ;
+                    OK (GrB_mxm (T, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+                        C, C, GrB_DESC_T0)) ;
+                    GrB_Matrix_free (&T) ;
+                    OK (GrB_Matrix_new (&T, GrB_FP64, 50, 40)) ;
+                    OK (GrB_transpose (T, NULL, NULL, C, NULL)) ;
+                    GrB_Matrix_free (&T) ;
+                    GrB_Index blob_size ;
+                    OK (GxB_Matrix_serialize (&blob, &blob_size, C, NULL)) ;
+                    mxFree (blob) ;
+                    blob = NULL ;
+                    OK (GrB_Matrix_dup (&D, C)) ;
+                    CHECK (D->mapping == NULL && !D->x_shallow) ;
+                    CHECK (B.nreleased == 0) ;
+                    CHECK (borrowed_unchanged (&B)) ;
+
+                    //----------------------------------------------------------
+                    // free or modify C
+                    //----------------------------------------------------------
+
+                    GrB_Index nvals ;
+                    switch (mod)
+                    {
+                        case 0:
+                            // free C
+                            OK (GrB_Matrix_free (&C)) ;
+                            break ;
+                        case 1:
+                            // set an entry of C
+                            OK (GrB_Matrix_setElement_FP64 (C, 99, 3, 4)) ;
+                            OK (GrB_Matrix_setElement_FP64 (D, 99, 3, 4)) ;
+                            break ;
+                        case 2:
+                            // remove an entry from C
+                            OK (GrB_Matrix_removeElement (C, 3, 4)) ;
+                            OK (GrB_Matrix_removeElement (D, 3, 4)) ;
+                            break ;
+                        case 3:
+                            // clear C
+                            OK (GrB_Matrix_clear (C)) ;
+                            OK (GrB_Matrix_clear (D)) ;
+                            break ;
+                        case 4:
+                            // C = C + C, with C aliased as the input
+                            OK (GrB_Matrix_eWiseAdd_BinaryOp (C, NULL, NULL,
+                                GrB_PLUS_FP64, C, C, NULL)) ;
+                            OK (GrB_Matrix_eWiseAdd_BinaryOp (D, NULL, NULL,
+                                GrB_PLUS_FP64, D, D, NULL)) ;
+                            break ;
+                        case 5:
+                            // change the format of C
+                            OK (GrB_Matrix_set_INT32 (C,
+                                (format == GxB_BY_ROW) ? GxB_BY_COL :
+                                GxB_BY_ROW, GrB_STORAGE_ORIENTATION_HINT)) ;
+                            break ;
+                        case 6:
+                            // change the sparsity of C
+                            OK (GrB_Matrix_set_INT32 (C,
+                                (sparsity == GxB_SPARSE) ? GxB_BITMAP :
+                                GxB_SPARSE, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+                            break ;
+                        case 7:
+                            // export C as CSR
+                            {
+                                GrB_Type type ;
+                                GrB_Index nr, nc, Tp_size, Ti_size, Tx_size ;
+                                GrB_Index *Tp = NULL ;
+                                bool t_iso, t_jumbled ;
+                                OK (GxB_Matrix_export_CSR (&C, &type, &nr, &nc,
+                                    &Tp, &Ti, (void **) &Tx, &Tp_size, &Ti_size,
+                                    &Tx_size, &t_iso, &t_jumbled, NULL)) ;
+                                CHECK (C == NULL) ;
+                                CHECK (B.nreleased == 1) ;
+                                // the exported arrays are not borrowed
+                                for (int k = 0 ; k < 5 ; k++)
+                                {
+                                    CHECK (Tp != B.X [k] && Ti != B.X [k]) ;
+                                    CHECK ((void *) Tx != B.X [k]) ;
+                                }
+                                OK (GxB_Matrix_import_CSR (&C, type, nr, nc,
+                                    &Tp, &Ti, (void **) &Tx, Tp_size, Ti_size,
+                                    Tx_size, t_iso, t_jumbled, NULL)) ;
+                            }
+                            break ;
+                        case 8:
+                            // C<M> = 2, using a structural mask
+                            OK (GrB_Matrix_new (&T, GrB_BOOL, 40, 50)) ;
+                            OK (GrB_Matrix_setElement_BOOL (T, true, 7, 8)) ;
+                            OK (GrB_Matrix_assign_FP64 (C, T, NULL, 2,
+                                GrB_ALL, 40, GrB_ALL, 50, GrB_DESC_S)) ;
+                            OK (GrB_Matrix_assign_FP64 (D, T, NULL, 2,
+                                GrB_ALL, 40, GrB_ALL, 50, GrB_DESC_S)) ;
+                            GrB_Matrix_free (&T) ;
+                            break ;
+                        case 9:
+                            // pack new content into C
+                            {
+                                GrB_Type type ;
+                                GrB_Index nr, nc, Tp_size, Ti_size, Tx_size ;
+                                GrB_Index *Tp = NULL ;
+                                bool t_iso, t_jumbled ;
+                                OK (GrB_Matrix_dup (&T, D)) ;
+                                OK (GxB_Matrix_export_CSR (&T, &type, &nr, &nc,
+                                    &Tp, &Ti, (void **) &Tx, &Tp_size, &Ti_size,
+                                    &Tx_size, &t_iso, &t_jumbled, NULL)) ;
+                                OK (GxB_Matrix_pack_CSR (C, &Tp, &Ti,
+                                    (void **) &Tx, Tp_size, Ti_size, Tx_size,
+                                    t_iso, t_jumbled, NULL)) ;
+                                CHECK (Tp == NULL && Ti == NULL && Tx == NULL) ;
+                            }
+                            break ;
+                        default: ;
+                    }
+
+                    // the arrays are released exactly once, and not modified
+                    CHECK (B.nreleased == 1) ;
+                    CHECK (borrowed_unchanged (&B)) ;
+                    if (C != NULL)
+                    {
+                        CHECK (C->mapping == NULL) ;
+                        CHECK (!C->p_shallow && !C->h_shallow &&
+                            !C->b_shallow && !C->i_shallow && !C->x_shallow) ;
+                        OK (check_same (C, D)) ;
+                        // modifying C again does not release the arrays again
+                        OK (GrB_Matrix_setElement_FP64 (C, 42, 5, 6)) ;
+                        OK (GrB_Matrix_setElement_FP64 (D, 42, 5, 6)) ;
+                        OK (GrB_Matrix_nvals (&nvals, C)) ;
+                        OK (check_same (C, D)) ;
+                        GrB_Matrix_free (&C) ;
+                    }
+                    CHECK (B.nreleased == 1) ;
+                    CHECK (borrowed_unchanged (&B)) ;
+                    borrowed_free (&B) ;
+                    GrB_Matrix_free (&A) ;
+                    GrB_Matrix_free (&D) ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // a jumbled matrix is sorted in a copy of the borrowed arrays
+    //--------------------------------------------------------------------------
+
+    for (int op = 0 ; op < 3 ; op++)
+    {
+        OK (random_matrix (&A, 40, 50, 200, GxB_SPARSE, false, GxB_BY_COL)) ;
+        OK (borrowed_copy (&B, A)) ;
+        // reverse the entries of each vector of the borrowed arrays
+        int64_t *Bp = B.X [0], *Bi = B.X [3] ;
+        double *Bx = B.X [4] ;
+        for (int64_t k = 0 ; k < 50 ; k++)
+        {
+            for (int64_t p1 = Bp [k], p2 = Bp [k+1] - 1 ; p1 < p2 ; p1++, p2--)
+            {
+                int64_t i = Bi [p1] ; Bi [p1] = Bi [p2] ; Bi [p2] = i ;
+                double x = Bx [p1] ; Bx [p1] = Bx [p2] ; Bx [p2] = x ;
+            }
+        }
+        memcpy (B.X_save [3], B.X [3], B.X_size [3]) ;
+        memcpy (B.X_save [4], B.X [4], B.X_size [4]) ;
+        B.jumbled = true ;
+        OK (borrowed_import (&C, &B, GrB_FP64, 40, 50, desc)) ;
+        CHECK (C->jumbled && B.nreleased == 0) ;
+        double x = 0 ;
+        switch (op)
+        {
+            case 0:
+                // wait for C to be sorted
+                OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                break ;
+            case 1:
+                // extract an entry, which sorts C first
+                info = GrB_Matrix_extractElement_FP64 (&x, C, 3, 4) ;
+                CHECK (info == GrB_SUCCESS || info == GrB_NO_VALUE) ;
+                break ;
+            case 2:
+                // extract the tuples of C, which may be returned in any
+                // order, so C is not sorted
+                Ti = mxMalloc (200 * sizeof (GrB_Index)) ;
+                Tj = mxMalloc (200 * sizeof (GrB_Index)) ;
+                Tx = mxMalloc (200 * sizeof (double)) ;
+                CHECK (Ti != NULL && Tj != NULL && Tx != NULL) ;
+                GrB_Index nvals = 200 ;
+                OK (GrB_Matrix_extractTuples_FP64 (Ti, Tj, Tx, &nvals, C)) ;
+                mxFree (Ti) ; Ti = NULL ;
+                mxFree (Tj) ; Tj = NULL ;
+                mxFree (Tx) ; Tx = NULL ;
+                break ;
+            default: ;
+        }
+        if (op < 2)
+        {
+            // the borrowed arrays have been copied and released, and the
+            // copy has been sorted
+            CHECK (!C->jumbled && C->mapping == NULL) ;
+            CHECK (B.nreleased == 1) ;
+        }
+        else
+        {
+            // C is still jumbled, and still holds the borrowed arrays
+            CHECK (C->jumbled && C->mapping != NULL) ;
+            CHECK (B.nreleased == 0) ;
+        }
+        CHECK (borrowed_unchanged (&B)) ;
+        OK (check_same (C, A)) ;
+        GrB_Matrix_free (&C) ;
+        CHECK (B.nreleased == 1) ;
+        borrowed_free (&B) ;
+        GrB_Matrix_free (&A) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // waiting on C does not modify or release the borrowed arrays
+    //--------------------------------------------------------------------------
+
+    // A is sparse with only 2 non-empty columns
+    OK (GrB_Matrix_new (&A, GrB_FP64, 1000, 1000)) ;
+    OK (GrB_Matrix_set_INT32 (A, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_setElement_FP64 (A, 1, 3, 4)) ;
+    OK (GrB_Matrix_setElement_FP64 (A, 2, 5, 900)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (borrowed_copy (&B, A)) ;
+    OK (borrowed_import (&C, &B, GrB_FP64, 1000, 1000, NULL)) ;
+    CHECK (GB_IS_SPARSE (C)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    CHECK (C->mapping != NULL) ;
+    CHECK (B.nreleased == 0) ;
+    CHECK (borrowed_unchanged (&B)) ;
+    OK (check_same (C, A)) ;
+    GrB_Matrix_free (&C) ;
+    CHECK (B.nreleased == 1) ;
+    borrowed_free (&B) ;
+    GrB_Matrix_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // the release function may be NULL
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A, 40, 50, 200, GxB_HYPERSPARSE, false, GxB_BY_ROW)) ;
+    OK (borrowed_copy (&B, A)) ;
+    OK (GxB_Matrix_import_borrowed (&C, GrB_FP64, 40, 50,
+        B.X [0], B.X [1], B.X [2], B.X [3], B.X [4],
+        B.X_size [0], B.X_size [1], B.X_size [2], B.X_size [3],
+        B.X_size [4], B.nvals, B.nvec, B.sparsity, B.by_col, B.iso,
+        B.jumbled, NULL, NULL, NULL)) ;
+    OK (check_same (C, A)) ;
+    OK (GrB_Matrix_setElement_FP64 (C, 1, 2, 3)) ;
+    CHECK (C->mapping == NULL) ;
+    GrB_Matrix_free (&C) ;
+    CHECK (B.nreleased == 0) ;
+    CHECK (borrowed_unchanged (&B)) ;
+
+    //--------------------------------------------------------------------------
+    // errors: the arrays are not released
+    //--------------------------------------------------------------------------
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_import_borrowed (NULL, GrB_FP64, 40, 50,
+        B.X [0], B.X [1], B.X [2], B.X [3], B.X [4],
+        B.X_size [0], B.X_size [1], B.X_size [2], B.X_size [3],
+        B.X_size [4], B.nvals, B.nvec, B.sparsity, B.by_col, B.iso,
+        B.jumbled, release_borrowed, &B, NULL)) ;
+    ERR (GxB_Matrix_import_borrowed (&C, NULL, 40, 50,
+        B.X [0], B.X [1], B.X [2], B.X [3], B.X [4],
+        B.X_size [0], B.X_size [1], B.X_size [2], B.X_size [3],
+        B.X_size [4], B.nvals, B.nvec, B.sparsity, B.by_col, B.iso,
+        B.jumbled, release_borrowed, &B, NULL)) ;
+    CHECK (C == NULL) ;
+
+    // invalid sparsity
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Matrix_import_borrowed (&C, GrB_FP64, 40, 50,
+        B.X [0], B.X [1], B.X [2], B.X [3], B.X [4],
+        B.X_size [0], B.X_size [1], B.X_size [2], B.X_size [3],
+        B.X_size [4], B.nvals, B.nvec, 3, B.by_col, B.iso,
+        B.jumbled, release_borrowed, &B, NULL)) ;
+    CHECK (C == NULL) ;
+
+    // arrays that are too small
+    B.X_size [3] -= sizeof (int64_t) ;
+    ERR (borrowed_import (&C, &B, GrB_FP64, 40, 50, NULL)) ;
+    B.X_size [3] += sizeof (int64_t) ;
+    B.X_size [1] -= sizeof (int64_t) ;
+    ERR (borrowed_import (&C, &B, GrB_FP64, 40, 50, NULL)) ;
+    B.X_size [1] += sizeof (int64_t) ;
+    CHECK (C == NULL) ;
+
+    // invalid content, found by a secure import
+    expected = GrB_INVALID_OBJECT ;
+    int64_t *Bh = B.X [1] ;
+    int64_t h0 = Bh [0] ;
+    Bh [0] = 1000 ;
+    ERR (borrowed_import (&C, &B, GrB_FP64, 40, 50, desc)) ;
+    Bh [0] = h0 ;
+    CHECK (C == NULL) ;
+    expected = GrB_INDEX_OUT_OF_BOUNDS ;
+    int64_t *Bp = B.X [0], *Bi = B.X [3] ;
+    int64_t k = 0 ;
+    while (Bp [k+1] - Bp [k] < 2) k++ ;
+    int64_t i0 = Bi [Bp [k]] ;
+    Bi [Bp [k]] = Bi [Bp [k] + 1] ;
+    ERR (borrowed_import (&C, &B, GrB_FP64, 40, 50, desc)) ;
+    Bi [Bp [k]] = i0 ;
+    CHECK (C == NULL) ;
+    CHECK (B.nreleased == 0) ;
+    CHECK (borrowed_unchanged (&B)) ;
+
+    // the arrays are still valid, and can be imported again
+    OK (borrowed_import (&C, &B, GrB_FP64, 40, 50, desc)) ;
+    OK (check_same (C, A)) ;
+    GrB_Matrix_free (&C) ;
+    CHECK (B.nreleased == 1) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test51: all tests passed\n\n") ;
+}
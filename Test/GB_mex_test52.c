@@ -0,0 +1,559 @@
+//------------------------------------------------------------------------------
+// GB_mex_test52: test concurrent GrB_*_setElement
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Concurrent setElement is enabled on a matrix C with GrB_set (C, nslots,
+// GxB_CONCURRENT_SETELEMENT), and several user threads then call
+// GrB_Matrix_setElement on C at the same time.  Each entry C(i,j) is owned by
+// a single user thread, so the result is deterministic: it must match a
+// matrix D modified by the same calls to GrB_Matrix_setElement, in the same
+// order, from a single thread.  C is sparse, hypersparse, bitmap, or full, by
+// row or by column, iso or non-iso, and it may be empty, or hold entries,
+// zombies, and pending tuples before the concurrent calls begin.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define NTHREADS 8
+#define NTUPLES 4000
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix
+//------------------------------------------------------------------------------
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    if (I != NULL) mxFree (I) ;         \
+    if (J != NULL) mxFree (J) ;         \
+    if (X != NULL) mxFree (X) ;         \
+}
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Index m,
+    GrB_Index n,
+    GrB_Index nz,       // # of entries to create; if zero, A is empty
+    int sparsity,       // GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, or GxB_FULL
+    bool iso,
+    int format          // GxB_BY_ROW or GxB_BY_COL
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix A = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    OK (GrB_Matrix_set_INT32 (A, format, GrB_STORAGE_ORIENTATION_HINT)) ;
+    if (sparsity == GxB_FULL)
+    {
+        OK (GrB_Matrix_assign_FP64 (A, NULL, NULL, 3, GrB_ALL, m, GrB_ALL, n,
+            NULL)) ;
+    }
+    else if (nz > 0)
+    {
+        I = mxMalloc (nz * sizeof (GrB_Index)) ;
+        J = mxMalloc (nz * sizeof (GrB_Index)) ;
+        X = mxMalloc (nz * sizeof (double)) ;
+        CHECK (I != NULL && J != NULL && X != NULL) ;
+        for (int64_t k = 0 ; k < nz ; k++)
+        {
+            I [k] = simple_rand_i ( ) % m ;
+            J [k] = simple_rand_i ( ) % n ;
+            X [k] = 3 ;
+        }
+        OK (GrB_Matrix_build_FP64 (A, I, J, X, nz, GrB_SECOND_FP64)) ;
+    }
+    if (!iso)
+    {
+        // A(i,j) = i + A(i,j)
+        OK (GrB_Matrix_apply_IndexOp_INT64 (A, NULL, GrB_PLUS_FP64,
+            GrB_ROWINDEX_INT64, A, 0, NULL)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_set_INT32 (A, sparsity, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    CHECK (GB_sparsity (A) == sparsity) ;
+    CHECK (A->iso == (iso && nz > 0)) ;
+    (*A_handle) = A ;
+    A = NULL ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_same: check if C and A hold the same matrix
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Matrix_free (&A2) ;             \
+}
+
+static GrB_Info check_same
+(
+    GrB_Matrix C,
+    GrB_Matrix A
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix C2 = NULL, A2 = NULL ;
+    OK (GrB_Matrix_dup (&C2, C)) ;
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C2, A2, 0)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// concurrent_setElement: C(i,j) = x for each tuple, from NTHREADS threads
+//------------------------------------------------------------------------------
+
+// Each user thread sets the entries C(i,j) it owns, in the order of the list.
+// The sequential reference D is modified by the same tuples, in order.  Every
+// other tuple is set with GrB_Matrix_setElement_INT32, so that it is typecast
+// to the type of C.  The values are integers, so no precision is lost.
+
+#undef  FREE_ALL
+#define FREE_ALL ;
+
+static GrB_Info concurrent_setElement
+(
+    GrB_Matrix C,
+    GrB_Matrix D,
+    const GrB_Index *Ti,
+    const GrB_Index *Tj,
+    const double *Tx,
+    int64_t ntuples
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Index m ;
+    OK (GrB_Matrix_nrows (&m, D)) ;
+
+    int nfailures = 0 ;
+    #pragma omp parallel for num_threads(NTHREADS) schedule(static,1) \
+        reduction(+:nfailures)
+    for (int tid = 0 ; tid < NTHREADS ; tid++)
+    {
+        for (int64_t k = 0 ; k < ntuples ; k++)
+        {
+            if ((Ti [k] + Tj [k] * m) % NTHREADS != tid) continue ;
+            GrB_Info thread_info ;
+            if (k % 2 == 0)
+            {
+                thread_info = GrB_Matrix_setElement_FP64 (C, Tx [k],
+                    Ti [k], Tj [k]) ;
+            }
+            else
+            {
+                thread_info = GrB_Matrix_setElement_INT32 (C,
+                    (int32_t) Tx [k], Ti [k], Tj [k]) ;
+            }
+            nfailures += (thread_info != GrB_SUCCESS) ;
+        }
+    }
+    CHECK (nfailures == 0) ;
+
+    for (int64_t k = 0 ; k < ntuples ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (D, Tx [k], Ti [k], Tj [k])) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test52
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&D) ;              \
+    GrB_Vector_free (&u) ;              \
+    GrB_Vector_free (&v) ;              \
+    if (Ti != NULL) mxFree (Ti) ;       \
+    if (Tj != NULL) mxFree (Tj) ;       \
+    if (Tx != NULL) mxFree (Tx) ;       \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected = GrB_SUCCESS ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL, D = NULL ;
+    GrB_Vector u = NULL, v = NULL ;
+    GrB_Index *Ti = NULL, *Tj = NULL ;
+    double *Tx = NULL ;
+    simple_rand_seed (52) ;
+
+    const GrB_Index m = 40, n = 30 ;
+    Ti = mxMalloc (NTUPLES * sizeof (GrB_Index)) ;
+    Tj = mxMalloc (NTUPLES * sizeof (GrB_Index)) ;
+    Tx = mxMalloc (NTUPLES * sizeof (double)) ;
+    CHECK (Ti != NULL && Tj != NULL && Tx != NULL) ;
+
+    int Sparsity [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL } ;
+    int Nslots [3] = { 1, 3, 16 } ;
+
+    //--------------------------------------------------------------------------
+    // concurrent setElement on each kind of matrix
+    //--------------------------------------------------------------------------
+
+    // kind 0: C is empty
+    // kind 1: C has entries
+    // kind 2: C has entries, zombies, and pending tuples (sparse or hyper)
+
+    for (int ks = 0 ; ks < 4 ; ks++)
+    {
+        int sparsity = Sparsity [ks] ;
+        bool sparse_or_hyper =
+            (sparsity == GxB_SPARSE || sparsity == GxB_HYPERSPARSE) ;
+        for (int kind = 0 ; kind <= 2 ; kind++)
+        {
+            // a full matrix cannot be empty, and has no zombies or pending
+            // tuples
+            if (sparsity == GxB_FULL && kind != 1) continue ;
+            // a bitmap matrix has no zombies or pending tuples
+            if (sparsity == GxB_BITMAP && kind == 2) continue ;
+            for (int format = GxB_BY_ROW ; format <= GxB_BY_COL ; format++)
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            for (int same = 0 ; same <= 1 ; same++)
+            for (int kslots = 0 ; kslots < 3 ; kslots++)
+            {
+                int nslots = Nslots [kslots] ;
+
+                //--------------------------------------------------------------
+                // create C and its sequential reference D
+                //--------------------------------------------------------------
+
+                OK (random_matrix (&A, m, n, (kind == 0) ? 0 : 200, sparsity,
+                    iso, format)) ;
+                OK (GrB_Matrix_dup (&C, A)) ;
+                OK (GrB_Matrix_dup (&D, A)) ;
+                GrB_Matrix_free (&A) ;
+                CHECK (GB_sparsity (C) == sparsity) ;
+
+                if (kind == 2)
+                {
+                    // delete some entries to create zombies, and add some
+                    // pending tuples
+                    for (int64_t k = 0 ; k < 100 ; k++)
+                    {
+                        GrB_Index i = simple_rand_i ( ) % m ;
+                        GrB_Index j = simple_rand_i ( ) % n ;
+                        OK (GrB_Matrix_removeElement (C, i, j)) ;
+                        OK (GrB_Matrix_removeElement (D, i, j)) ;
+                    }
+                    for (int64_t k = 0 ; k < 100 ; k++)
+                    {
+                        GrB_Index i = simple_rand_i ( ) % m ;
+                        GrB_Index j = simple_rand_i ( ) % n ;
+                        double x = same ? 3 : (double) (k + 10) ;
+                        OK (GrB_Matrix_setElement_FP64 (C, x, i, j)) ;
+                        OK (GrB_Matrix_setElement_FP64 (D, x, i, j)) ;
+                    }
+                    CHECK (C->nzombies > 0) ;
+                    CHECK (C->Pending != NULL) ;
+                }
+
+                //--------------------------------------------------------------
+                // enable concurrent setElement on C
+                //--------------------------------------------------------------
+
+                int32_t s = -1 ;
+                OK (GrB_Matrix_get_INT32 (C, &s,
+                    (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+                CHECK (s == 0) ;
+                OK (GrB_Matrix_set_INT32 (C, nslots,
+                    (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+                OK (GrB_Matrix_get_INT32 (C, &s,
+                    (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+                CHECK (s == nslots) ;
+                CHECK (C->Ingest != NULL && !C->Ingest->pending) ;
+
+                // the prior zombies and pending tuples are kept
+                if (kind == 2)
+                {
+                    CHECK (C->nzombies > 0) ;
+                    CHECK (C->Pending != NULL) ;
+                }
+
+                //--------------------------------------------------------------
+                // first round: set entries from NTHREADS threads
+                //--------------------------------------------------------------
+
+                // Many tuples are duplicates, and many are entries already
+                // in C, live or zombie.  If same is true, all values are
+                // equal to the iso value of random_matrix.
+
+                for (int64_t k = 0 ; k < NTUPLES ; k++)
+                {
+                    Ti [k] = simple_rand_i ( ) % m ;
+                    Tj [k] = simple_rand_i ( ) % n ;
+                    Tx [k] = same ? 3 : (double) (simple_rand_i ( ) % 100) ;
+                }
+                OK (concurrent_setElement (C, D, Ti, Tj, Tx, NTUPLES)) ;
+
+                // C itself is not modified until the tuples are flushed
+                CHECK (C->Ingest->pending) ;
+                CHECK (GB_sparsity (C) == sparsity) ;
+                if (kind == 2)
+                {
+                    CHECK (C->nzombies > 0) ;
+                }
+
+                //--------------------------------------------------------------
+                // GrB_assign flushes the tuples into C before modifying C
+                //--------------------------------------------------------------
+
+                GrB_Index I [3] = { 1, 5, 7 } ;
+                GrB_Index J [2] = { 2, 4 } ;
+                double y = same ? 3 : 99 ;
+                OK (GrB_Matrix_assign_FP64 (C, NULL, NULL, y, I, 3, J, 2,
+                    NULL)) ;
+                OK (GrB_Matrix_assign_FP64 (D, NULL, NULL, y, I, 3, J, 2,
+                    NULL)) ;
+                CHECK (!C->Ingest->pending) ;
+                OK (check_same (C, D)) ;
+
+                //--------------------------------------------------------------
+                // second round: set more entries
+                //--------------------------------------------------------------
+
+                for (int64_t k = 0 ; k < NTUPLES ; k++)
+                {
+                    Ti [k] = simple_rand_i ( ) % m ;
+                    Tj [k] = simple_rand_i ( ) % n ;
+                    Tx [k] = same ? 3 : (double) (simple_rand_i ( ) % 100) ;
+                }
+                OK (concurrent_setElement (C, D, Ti, Tj, Tx, NTUPLES / 4)) ;
+                CHECK (C->Ingest->pending) ;
+
+                //--------------------------------------------------------------
+                // check the result
+                //--------------------------------------------------------------
+
+                // GrB_Matrix_nvals finishes the work on C
+                GrB_Index cnvals, dnvals ;
+                OK (GrB_Matrix_nvals (&cnvals, C)) ;
+                OK (GrB_Matrix_nvals (&dnvals, D)) ;
+                CHECK (cnvals == dnvals) ;
+                CHECK (!C->Ingest->pending) ;
+                CHECK (C->Pending == NULL) ;
+                CHECK (C->nzombies == 0) ;
+                OK (check_same (C, D)) ;
+
+                // C is iso if and only if D is iso
+                OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                OK (GrB_Matrix_wait (D, GrB_MATERIALIZE)) ;
+                CHECK (C->iso == D->iso) ;
+                if (same && (iso || kind == 0))
+                {
+                    CHECK (C->iso) ;
+                }
+                if (!same && !(sparsity == GxB_FULL && iso))
+                {
+                    // some new value differs from the iso value (3); this is
+                    // always the case for 2000 random values
+                    CHECK (!C->iso) ;
+                }
+
+                // concurrent setElement is still enabled
+                OK (GrB_Matrix_get_INT32 (C, &s,
+                    (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+                CHECK (s == nslots) ;
+
+                //--------------------------------------------------------------
+                // change the # of slots, and then disable concurrent setElement
+                //--------------------------------------------------------------
+
+                // the tuples held in the prior slots are not lost
+                OK (concurrent_setElement (C, D, Ti + 1000, Tj + 1000,
+                    Tx + 1000, 500)) ;
+                OK (GrB_Matrix_set_INT32 (C, nslots + 1,
+                    (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+                CHECK (C->Ingest != NULL && C->Ingest->nslots == nslots + 1) ;
+                CHECK (!C->Ingest->pending) ;
+
+                OK (concurrent_setElement (C, D, Ti + 2000, Tj + 2000,
+                    Tx + 2000, 500)) ;
+                OK (GrB_Matrix_set_INT32 (C, 0,
+                    (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+                CHECK (C->Ingest == NULL) ;
+                OK (GrB_Matrix_get_INT32 (C, &s,
+                    (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+                CHECK (s == 0) ;
+                OK (check_same (C, D)) ;
+
+                // GrB_Matrix_setElement on C is now sequential
+                OK (GrB_Matrix_setElement_FP64 (C, 42, 0, 0)) ;
+                OK (GrB_Matrix_setElement_FP64 (D, 42, 0, 0)) ;
+                OK (check_same (C, D)) ;
+
+                GrB_Matrix_free (&C) ;
+                GrB_Matrix_free (&D) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // methods that read C see the tuples held in its slots
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&A, m, n, 200, GxB_SPARSE, false, GxB_BY_COL)) ;
+    OK (GrB_Matrix_dup (&C, A)) ;
+    OK (GrB_Matrix_dup (&D, A)) ;
+    GrB_Matrix_free (&A) ;
+    OK (GrB_Matrix_set_INT32 (C, 4, (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+    for (int64_t k = 0 ; k < NTUPLES ; k++)
+    {
+        Ti [k] = simple_rand_i ( ) % m ;
+        Tj [k] = simple_rand_i ( ) % n ;
+        Tx [k] = (double) (simple_rand_i ( ) % 100) ;
+    }
+
+    // GrB_reduce
+    OK (concurrent_setElement (C, D, Ti, Tj, Tx, 1000)) ;
+    double csum = 0, dsum = 0 ;
+    OK (GrB_Matrix_reduce_FP64 (&csum, NULL, GrB_PLUS_MONOID_FP64, C, NULL)) ;
+    OK (GrB_Matrix_reduce_FP64 (&dsum, NULL, GrB_PLUS_MONOID_FP64, D, NULL)) ;
+    CHECK (csum == dsum) ;
+    CHECK (!C->Ingest->pending) ;
+
+    // GrB_extractElement
+    OK (concurrent_setElement (C, D, Ti + 1000, Tj + 1000, Tx + 1000, 1000)) ;
+    for (int64_t k = 1000 ; k < 1100 ; k++)
+    {
+        double cx = -1, dx = -2 ;
+        OK (GrB_Matrix_extractElement_FP64 (&cx, C, Ti [k], Tj [k])) ;
+        OK (GrB_Matrix_extractElement_FP64 (&dx, D, Ti [k], Tj [k])) ;
+        CHECK (cx == dx) ;
+    }
+
+    // GrB_dup: the copy does not have concurrent setElement enabled
+    OK (concurrent_setElement (C, D, Ti + 2000, Tj + 2000, Tx + 2000, 1000)) ;
+    OK (GrB_Matrix_dup (&A, C)) ;
+    CHECK (A->Ingest == NULL) ;
+    OK (check_same (A, D)) ;
+    GrB_Matrix_free (&A) ;
+
+    // GrB_Matrix_clear discards all entries, but C keeps its slots
+    OK (concurrent_setElement (C, D, Ti + 3000, Tj + 3000, Tx + 3000, 1000)) ;
+    OK (GrB_Matrix_clear (C)) ;
+    OK (GrB_Matrix_clear (D)) ;
+    CHECK (C->Ingest != NULL && !C->Ingest->pending) ;
+    GrB_Index nvals = 1 ;
+    OK (GrB_Matrix_nvals (&nvals, C)) ;
+    CHECK (nvals == 0) ;
+    OK (concurrent_setElement (C, D, Ti, Tj, Tx, 1000)) ;
+    OK (check_same (C, D)) ;
+
+    // C can be freed with tuples still held in its slots
+    OK (concurrent_setElement (C, D, Ti + 1000, Tj + 1000, Tx + 1000, 1000)) ;
+    CHECK (C->Ingest->pending) ;
+    GrB_Matrix_free (&C) ;
+    GrB_Matrix_free (&D) ;
+
+    //--------------------------------------------------------------------------
+    // concurrent GrB_Vector_setElement
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&u, GrB_INT64, 1000)) ;
+    OK (GrB_Vector_new (&v, GrB_INT64, 1000)) ;
+    OK (GrB_Vector_set_INT32 (u, 5, (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+    int32_t s = 0 ;
+    OK (GrB_Vector_get_INT32 (u, &s, (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+    CHECK (s == 5) ;
+    int nfailures = 0 ;
+    #pragma omp parallel for num_threads(NTHREADS) schedule(static,1) \
+        reduction(+:nfailures)
+    for (int tid = 0 ; tid < NTHREADS ; tid++)
+    {
+        for (int64_t k = 0 ; k < NTUPLES ; k++)
+        {
+            GrB_Index i = (Ti [k] * n + Tj [k]) % 1000 ;
+            if (i % NTHREADS != tid) continue ;
+            GrB_Info thread_info = GrB_Vector_setElement_INT64 (u, k, i) ;
+            nfailures += (thread_info != GrB_SUCCESS) ;
+        }
+    }
+    CHECK (nfailures == 0) ;
+    for (int64_t k = 0 ; k < NTUPLES ; k++)
+    {
+        GrB_Index i = (Ti [k] * n + Tj [k]) % 1000 ;
+        OK (GrB_Vector_setElement_INT64 (v, k, i)) ;
+    }
+    OK (check_same ((GrB_Matrix) u, (GrB_Matrix) v)) ;
+    GrB_Vector_free (&u) ;
+    GrB_Vector_free (&v) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&C, m, n, 200, GxB_SPARSE, false, GxB_BY_COL)) ;
+    OK (GrB_Matrix_dup (&D, C)) ;
+
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_Matrix_set_INT32 (C, -1, (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+    CHECK (C->Ingest == NULL) ;
+
+    OK (GrB_Matrix_set_INT32 (C, 2, (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+
+    // an index out of range is caught, and nothing is added to C
+    expected = GrB_INVALID_INDEX ;
+    ERR (GrB_Matrix_setElement_FP64 (C, 1, m, 0)) ;
+    ERR (GrB_Matrix_setElement_FP64 (C, 1, 0, n)) ;
+    CHECK (!C->Ingest->pending) ;
+
+    // a user-defined scalar cannot be typecast to FP64
+    double z = 7 ;
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GrB_Matrix_setElement_UDT (C, &z, 0, 0)) ;
+    CHECK (!C->Ingest->pending) ;
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GrB_Matrix_setElement_UDT (C, NULL, 0, 0)) ;
+    CHECK (!C->Ingest->pending) ;
+    OK (check_same (C, D)) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test52: all tests passed\n\n") ;
+}
@@ -0,0 +1,575 @@
+//------------------------------------------------------------------------------
+// GB_mex_test53: test GxB_*_setElements and GxB_*_extractElements
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_setElements (C, X, xtype, I, J, n) must give the same result as
+// n calls to GrB_Matrix_setElement, in order, on a reference matrix D.  C is
+// sparse, hypersparse, bitmap, or full, by row or by column, iso or non-iso,
+// and it may be empty, or hold entries, zombies, and pending tuples.  The
+// batches include duplicates, and X is typecast to the type of C.  Each
+// result is then checked with GxB_Matrix_extractElements, against the same
+// calls to GrB_Matrix_extractElement, including entries that are not present.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define NMAX 1000
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix
+//------------------------------------------------------------------------------
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    if (I != NULL) mxFree (I) ;         \
+    if (J != NULL) mxFree (J) ;         \
+    if (X != NULL) mxFree (X) ;         \
+}
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Index m,
+    GrB_Index n,
+    GrB_Index nz,       // # of entries to create; if zero, A is empty
+    int sparsity,       // GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, or GxB_FULL
+    bool iso,
+    int format          // GxB_BY_ROW or GxB_BY_COL
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix A = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    OK (GrB_Matrix_set_INT32 (A, format, GrB_STORAGE_ORIENTATION_HINT)) ;
+    if (sparsity == GxB_FULL)
+    {
+        OK (GrB_Matrix_assign_FP64 (A, NULL, NULL, 3, GrB_ALL, m, GrB_ALL, n,
+            NULL)) ;
+    }
+    else if (nz > 0)
+    {
+        I = mxMalloc (nz * sizeof (GrB_Index)) ;
+        J = mxMalloc (nz * sizeof (GrB_Index)) ;
+        X = mxMalloc (nz * sizeof (double)) ;
+        CHECK (I != NULL && J != NULL && X != NULL) ;
+        for (int64_t k = 0 ; k < nz ; k++)
+        {
+            I [k] = simple_rand_i ( ) % m ;
+            J [k] = simple_rand_i ( ) % n ;
+            X [k] = 3 ;
+        }
+        OK (GrB_Matrix_build_FP64 (A, I, J, X, nz, GrB_SECOND_FP64)) ;
+    }
+    if (!iso)
+    {
+        // A(i,j) = i + A(i,j)
+        OK (GrB_Matrix_apply_IndexOp_INT64 (A, NULL, GrB_PLUS_FP64,
+            GrB_ROWINDEX_INT64, A, 0, NULL)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_set_INT32 (A, sparsity, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    CHECK (GB_sparsity (A) == sparsity) ;
+    CHECK (A->iso == (iso && nz > 0)) ;
+    (*A_handle) = A ;
+    A = NULL ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_same: check if C and A hold the same matrix
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Matrix_free (&A2) ;             \
+}
+
+static GrB_Info check_same
+(
+    GrB_Matrix C,
+    GrB_Matrix A
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix C2 = NULL, A2 = NULL ;
+    OK (GrB_Matrix_dup (&C2, C)) ;
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C2, A2, 0)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// set_reference: D(I(k),J(k)) = X(k) with GrB_Matrix_setElement, in order
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL ;
+
+static GrB_Info set_reference
+(
+    GrB_Matrix D,
+    const void *X,
+    GrB_Type xtype,
+    const GrB_Index *I,
+    const GrB_Index *J,
+    int64_t n
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        if (xtype == GrB_FP64)
+        {
+            OK (GrB_Matrix_setElement_FP64 (D, ((double *) X) [k], I [k],
+                J [k])) ;
+        }
+        else if (xtype == GrB_INT32)
+        {
+            OK (GrB_Matrix_setElement_INT32 (D, ((int32_t *) X) [k], I [k],
+                J [k])) ;
+        }
+        else
+        {
+            OK (GrB_Matrix_setElement_BOOL (D, ((bool *) X) [k], I [k],
+                J [k])) ;
+        }
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_extract: check GxB_Matrix_extractElements against D
+//------------------------------------------------------------------------------
+
+// X(k) = C(I(k),J(k)) is extracted as int32_t, and compared with the same
+// calls to GrB_Matrix_extractElement_INT32 on D.  An entry not present must
+// leave X(k) unmodified, and the method must then return GrB_NO_VALUE.
+
+static GrB_Info check_extract
+(
+    GrB_Matrix C,
+    GrB_Matrix D,
+    const GrB_Index *I,
+    const GrB_Index *J,
+    int64_t n
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    int32_t X [NMAX] ;
+    bool present [NMAX] ;
+    CHECK (n <= NMAX) ;
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        X [k] = -911 ;
+        present [k] = (k % 2 == 0) ;
+    }
+    GrB_Info info_C = GxB_Matrix_extractElements (X, present, GrB_INT32, C,
+        I, J, n) ;
+    CHECK (info_C == GrB_SUCCESS || info_C == GrB_NO_VALUE) ;
+    int64_t nmissing = 0 ;
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        int32_t d = -911 ;
+        GrB_Info info_D = GrB_Matrix_extractElement_INT32 (&d, D, I [k],
+            J [k]) ;
+        CHECK (info_D == GrB_SUCCESS || info_D == GrB_NO_VALUE) ;
+        CHECK (present [k] == (info_D == GrB_SUCCESS)) ;
+        CHECK (X [k] == d) ;
+        nmissing += (info_D == GrB_NO_VALUE) ;
+    }
+    CHECK (info_C == ((nmissing == 0) ? GrB_SUCCESS : GrB_NO_VALUE)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test53
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&D) ;              \
+    GrB_Vector_free (&u) ;              \
+    GrB_Vector_free (&v) ;              \
+    GrB_Type_free (&Type) ;             \
+}
+
+typedef struct { double a ; int32_t b ; } mytype_t ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected = GrB_SUCCESS ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL, D = NULL ;
+    GrB_Vector u = NULL, v = NULL ;
+    GrB_Type Type = NULL ;
+    simple_rand_seed (53) ;
+
+    const GrB_Index m = 20, n = 15 ;
+    GrB_Index I [NMAX], J [NMAX] ;
+    double X_fp64 [NMAX] ;
+    int32_t X_int32 [NMAX] ;
+    bool X_bool [NMAX] ;
+
+    // all entries of an m-by-n matrix, and some more at random
+    GrB_Index Iall [NMAX], Jall [NMAX] ;
+    int64_t nall = 0 ;
+    for (int64_t j = 0 ; j < n ; j++)
+    {
+        for (int64_t i = 0 ; i < m ; i++)
+        {
+            Iall [nall] = i ;
+            Jall [nall] = j ;
+            nall++ ;
+        }
+    }
+    for ( ; nall < 400 ; nall++)
+    {
+        Iall [nall] = simple_rand_i ( ) % m ;
+        Jall [nall] = simple_rand_i ( ) % n ;
+    }
+
+    int Sparsity [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL } ;
+    GrB_Type Xtypes [3] = { GrB_FP64, GrB_INT32, GrB_BOOL } ;
+    void *Xarrays [3] = { X_fp64, X_int32, X_bool } ;
+
+    //--------------------------------------------------------------------------
+    // setElements on each kind of matrix
+    //--------------------------------------------------------------------------
+
+    // kind 0: C is empty
+    // kind 1: C has entries
+    // kind 2: C has entries, zombies, and pending tuples (sparse or hyper)
+
+    for (int ks = 0 ; ks < 4 ; ks++)
+    {
+        int sparsity = Sparsity [ks] ;
+        for (int kind = 0 ; kind <= 2 ; kind++)
+        {
+            if (sparsity == GxB_FULL && kind != 1) continue ;
+            if (sparsity == GxB_BITMAP && kind == 2) continue ;
+            for (int format = GxB_BY_ROW ; format <= GxB_BY_COL ; format++)
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            for (int same = 0 ; same <= 1 ; same++)
+            for (int kx = 0 ; kx < 3 ; kx++)
+            {
+                GrB_Type xtype = Xtypes [kx] ;
+                void *X = Xarrays [kx] ;
+
+                //--------------------------------------------------------------
+                // create C and its reference D
+                //--------------------------------------------------------------
+
+                OK (random_matrix (&A, m, n, (kind == 0) ? 0 : 100, sparsity,
+                    iso, format)) ;
+                OK (GrB_Matrix_dup (&C, A)) ;
+                OK (GrB_Matrix_dup (&D, A)) ;
+                GrB_Matrix_free (&A) ;
+
+                if (kind == 2)
+                {
+                    // delete some entries to create zombies, and add some
+                    // pending tuples
+                    for (int64_t k = 0 ; k < 50 ; k++)
+                    {
+                        GrB_Index i = simple_rand_i ( ) % m ;
+                        GrB_Index j = simple_rand_i ( ) % n ;
+                        OK (GrB_Matrix_removeElement (C, i, j)) ;
+                        OK (GrB_Matrix_removeElement (D, i, j)) ;
+                    }
+                    for (int64_t k = 0 ; k < 20 ; k++)
+                    {
+                        GrB_Index i = simple_rand_i ( ) % m ;
+                        GrB_Index j = simple_rand_i ( ) % n ;
+                        double x = same ? 3 : (double) (k + 10) ;
+                        OK (GrB_Matrix_setElement_FP64 (C, x, i, j)) ;
+                        OK (GrB_Matrix_setElement_FP64 (D, x, i, j)) ;
+                    }
+                    CHECK (C->nzombies > 0) ;
+                    CHECK (C->Pending != NULL) ;
+                }
+
+                //--------------------------------------------------------------
+                // first batch: random entries, with many duplicates
+                //--------------------------------------------------------------
+
+                // If same is true, all values are equal to the iso value of
+                // random_matrix, unless X is boolean.
+
+                int64_t nbatch = 600 ;
+                for (int64_t k = 0 ; k < nbatch ; k++)
+                {
+                    I [k] = simple_rand_i ( ) % m ;
+                    J [k] = simple_rand_i ( ) % n ;
+                    int32_t x = same ? 3 : (simple_rand_i ( ) % 100) ;
+                    X_fp64 [k] = x ;
+                    X_int32 [k] = x ;
+                    X_bool [k] = same ? true : (x % 2) ;
+                }
+                OK (GxB_Matrix_setElements (C, X, xtype, I, J, nbatch)) ;
+                OK (set_reference (D, X, xtype, I, J, nbatch)) ;
+                CHECK (GB_sparsity (C) == sparsity) ;
+                OK (check_extract (C, D, Iall, Jall, nall)) ;
+                OK (check_same (C, D)) ;
+
+                //--------------------------------------------------------------
+                // second batch: sorted, while C has pending tuples
+                //--------------------------------------------------------------
+
+                // The entries are in increasing order of the vectors and
+                // indices of C, as held in its CSR or CSC format, so the
+                // pending tuples of C remain sorted if they were already.
+
+                OK (GxB_Matrix_setElements (C, X, xtype, I, J, 100)) ;
+                OK (set_reference (D, X, xtype, I, J, 100)) ;
+                nbatch = 0 ;
+                bool by_col = (format == GxB_BY_COL) ;
+                for (int64_t t = 0 ; t < m * n ; t += 1 + (nbatch % 5))
+                {
+                    int64_t i = by_col ? (t % m) : (t / n) ;
+                    int64_t j = by_col ? (t / m) : (t % n) ;
+                    I [nbatch] = i ;
+                    J [nbatch] = j ;
+                    int32_t x = same ? 3 : (int32_t) (t % 50) ;
+                    X_fp64 [nbatch] = x ;
+                    X_int32 [nbatch] = x ;
+                    X_bool [nbatch] = same ? true : (x % 2) ;
+                    nbatch++ ;
+                }
+                OK (GxB_Matrix_setElements (C, X, xtype, I, J, nbatch)) ;
+                OK (set_reference (D, X, xtype, I, J, nbatch)) ;
+
+                //--------------------------------------------------------------
+                // check the result
+                //--------------------------------------------------------------
+
+                OK (check_extract (C, D, Iall, Jall, nall)) ;
+                CHECK (C->Pending == NULL && C->nzombies == 0) ;
+                OK (check_same (C, D)) ;
+
+                // C is iso if and only if D is iso
+                OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                OK (GrB_Matrix_wait (D, GrB_MATERIALIZE)) ;
+                CHECK (C->iso == D->iso) ;
+
+                // all entries are present in the first m*n queries
+                int32_t Y [NMAX] ;
+                if (sparsity == GxB_FULL)
+                {
+                    OK (GxB_Matrix_extractElements (Y, NULL, GrB_INT32, C,
+                        Iall, Jall, nall)) ;
+                }
+
+                GrB_Matrix_free (&C) ;
+                GrB_Matrix_free (&D) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // a large hypersparse matrix
+    //--------------------------------------------------------------------------
+
+    // C has 50 vectors, so it has a hyper_hash.  The first batch only touches
+    // vectors already in C, and the second adds new vectors.
+
+    const GrB_Index huge = 1000000000 ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, 1000, huge)) ;
+    OK (GrB_Matrix_set_INT32 (C, GxB_HYPERSPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    GrB_Index Jvec [50] ;
+    for (int64_t k = 0 ; k < 50 ; k++)
+    {
+        Jvec [k] = (GrB_Index) (k * 19999999 + 7) ;
+        OK (GrB_Matrix_setElement_FP64 (C, k, k, Jvec [k])) ;
+    }
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_dup (&D, C)) ;
+    OK (GrB_Matrix_wait (D, GrB_MATERIALIZE)) ;
+
+    for (int64_t k = 0 ; k < NMAX ; k++)
+    {
+        I [k] = simple_rand_i ( ) % 1000 ;
+        J [k] = (k % 3 == 0) ? (GrB_Index) k : Jvec [simple_rand_i ( ) % 50] ;
+        X_fp64 [k] = (double) (simple_rand_i ( ) % 100) ;
+    }
+    OK (GxB_Matrix_setElements (C, X_fp64, GrB_FP64, I, J, 400)) ;
+    OK (set_reference (D, X_fp64, GrB_FP64, I, J, 400)) ;
+    OK (check_extract (C, D, I, J, NMAX)) ;
+    CHECK (C->Y != NULL) ;
+    OK (GxB_Matrix_setElements (C, X_fp64 + 400, GrB_FP64, I + 400, J + 400,
+        NMAX - 400)) ;
+    OK (set_reference (D, X_fp64 + 400, GrB_FP64, I + 400, J + 400,
+        NMAX - 400)) ;
+    OK (check_extract (C, D, I, J, NMAX)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (D, GrB_MATERIALIZE)) ;
+    CHECK (GB_IS_HYPERSPARSE (C) && GB_IS_HYPERSPARSE (D)) ;
+    CHECK (GB_mx_isequal (C, D, 0)) ;
+    GrB_Matrix_free (&C) ;
+    GrB_Matrix_free (&D) ;
+
+    //--------------------------------------------------------------------------
+    // vectors
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&u, GrB_INT64, 100)) ;
+    OK (GrB_Vector_new (&v, GrB_INT64, 100)) ;
+    for (int64_t k = 0 ; k < 300 ; k++)
+    {
+        I [k] = simple_rand_i ( ) % 100 ;
+        X_int32 [k] = (int32_t) k ;
+    }
+    OK (GxB_Vector_setElements (u, X_int32, GrB_INT32, I, 200)) ;
+    OK (GxB_Vector_setElements (u, X_int32 + 200, GrB_INT32, I + 200, 100)) ;
+    for (int64_t k = 0 ; k < 300 ; k++)
+    {
+        OK (GrB_Vector_setElement_INT32 (v, X_int32 [k], I [k])) ;
+    }
+    OK (check_same ((GrB_Matrix) u, (GrB_Matrix) v)) ;
+
+    double Z [100] ;
+    bool Zpresent [100] ;
+    for (int64_t k = 0 ; k < 100 ; k++)
+    {
+        Iall [k] = k ;
+        Z [k] = -1 ;
+    }
+    GrB_Index unvals ;
+    OK (GrB_Vector_nvals (&unvals, u)) ;
+    expected = (unvals == 100) ? GrB_SUCCESS : GrB_NO_VALUE ;
+    ERR (GxB_Vector_extractElements (Z, Zpresent, GrB_FP64, u, Iall, 100)) ;
+    for (int64_t k = 0 ; k < 100 ; k++)
+    {
+        int64_t y = -1 ;
+        info = GrB_Vector_extractElement_INT64 (&y, v, k) ;
+        CHECK (Zpresent [k] == (info == GrB_SUCCESS)) ;
+        CHECK (Z [k] == (double) y) ;
+    }
+    GrB_Vector_free (&u) ;
+    GrB_Vector_free (&v) ;
+
+    //--------------------------------------------------------------------------
+    // user-defined types
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Type_new (&Type, sizeof (mytype_t))) ;
+    OK (GrB_Matrix_new (&C, Type, m, n)) ;
+    OK (GrB_Matrix_new (&D, Type, m, n)) ;
+    mytype_t W [NMAX], W2 [NMAX] ;
+    memset (W, 0, sizeof (W)) ;
+    memset (W2, 0, sizeof (W2)) ;
+    for (int64_t k = 0 ; k < 300 ; k++)
+    {
+        I [k] = simple_rand_i ( ) % m ;
+        J [k] = simple_rand_i ( ) % n ;
+        W [k].a = (double) k ;
+        W [k].b = (int32_t) (simple_rand_i ( ) % 10) ;
+    }
+    OK (GxB_Matrix_setElements (C, W, Type, I, J, 300)) ;
+    for (int64_t k = 0 ; k < 300 ; k++)
+    {
+        OK (GrB_Matrix_setElement_UDT (D, &(W [k]), I [k], J [k])) ;
+    }
+    bool Wpresent [NMAX] ;
+    OK (GxB_Matrix_extractElements (W2, Wpresent, Type, C, I, J, 300)) ;
+    for (int64_t k = 0 ; k < 300 ; k++)
+    {
+        mytype_t w ;
+        OK (GrB_Matrix_extractElement_UDT (&w, D, I [k], J [k])) ;
+        CHECK (Wpresent [k]) ;
+        CHECK (W2 [k].a == w.a && W2 [k].b == w.b) ;
+    }
+
+    // a user-defined type cannot be typecast
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Matrix_setElements (C, X_fp64, GrB_FP64, I, J, 10)) ;
+    ERR (GxB_Matrix_extractElements (X_fp64, NULL, GrB_FP64, C, I, J, 10)) ;
+    GrB_Matrix_free (&C) ;
+    GrB_Matrix_free (&D) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (random_matrix (&C, m, n, 100, GxB_SPARSE, false, GxB_BY_COL)) ;
+    OK (GrB_Matrix_dup (&D, C)) ;
+    for (int64_t k = 0 ; k < 10 ; k++)
+    {
+        I [k] = k ;
+        J [k] = k ;
+        X_fp64 [k] = 1000 + k ;
+    }
+
+    // an invalid index is caught before any entry is modified
+    I [5] = m ;
+    expected = GrB_INVALID_INDEX ;
+    ERR (GxB_Matrix_setElements (C, X_fp64, GrB_FP64, I, J, 10)) ;
+    ERR (GxB_Matrix_extractElements (X_fp64, NULL, GrB_FP64, C, I, J, 10)) ;
+    I [5] = 5 ;
+    J [7] = n ;
+    ERR (GxB_Matrix_setElements (C, X_fp64, GrB_FP64, I, J, 10)) ;
+    ERR (GxB_Matrix_extractElements (X_fp64, NULL, GrB_FP64, C, I, J, 10)) ;
+    J [7] = 7 ;
+    CHECK (C->Pending == NULL) ;
+    OK (check_same (C, D)) ;
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_setElements (C, NULL, GrB_FP64, I, J, 10)) ;
+    ERR (GxB_Matrix_setElements (C, X_fp64, NULL, I, J, 10)) ;
+    ERR (GxB_Matrix_setElements (C, X_fp64, GrB_FP64, NULL, J, 10)) ;
+    ERR (GxB_Matrix_setElements (C, X_fp64, GrB_FP64, I, NULL, 10)) ;
+    ERR (GxB_Matrix_extractElements (NULL, NULL, GrB_FP64, C, I, J, 10)) ;
+    ERR (GxB_Matrix_extractElements (X_fp64, NULL, GrB_FP64, C, NULL, J, 10)) ;
+    ERR (GxB_Matrix_extractElements (X_fp64, NULL, GrB_FP64, C, I, NULL, 10)) ;
+
+    // an empty batch does nothing
+    OK (GxB_Matrix_setElements (C, NULL, GrB_FP64, NULL, NULL, 0)) ;
+    OK (GxB_Matrix_extractElements (NULL, NULL, GrB_FP64, C, NULL, NULL, 0)) ;
+    OK (check_same (C, D)) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test53: all tests passed\n\n") ;
+}
@@ -0,0 +1,344 @@
+//------------------------------------------------------------------------------
+// GB_mex_test54: test GB_wait_inplace
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_wait merges the pending tuples of A into A in place if they form no more
+// than nnz(A)/16 entries (after zombies are deleted), and if A is sparse, or
+// hypersparse with every vector they touch already in A->h.  The burble is
+// captured to see which method GB_wait uses, and each result is compared
+// with a reference matrix D.  Several rounds of updates check that the space
+// in A->i and A->x is doubled when it runs out, and that the remaining space
+// is then used by later updates without reallocating.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define N 150
+#define NROUNDS 4
+
+//------------------------------------------------------------------------------
+// capture the burble
+//------------------------------------------------------------------------------
+
+#define BURBLE_SIZE 100000
+static char burble [BURBLE_SIZE] ;
+static size_t burble_len = 0 ;
+
+static int capture_printf (const char *restrict format, ...)
+{
+    va_list ap ;
+    va_start (ap, format) ;
+    int n = vsnprintf (burble + burble_len, BURBLE_SIZE - burble_len, format,
+        ap) ;
+    va_end (ap) ;
+    if (n > 0)
+    {
+        burble_len = GB_IMIN (burble_len + n, BURBLE_SIZE - 1) ;
+    }
+    return (n) ;
+}
+
+//------------------------------------------------------------------------------
+// check_same: check if C and A hold the same matrix
+//------------------------------------------------------------------------------
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Matrix_free (&A2) ;             \
+}
+
+static GrB_Info check_same
+(
+    GrB_Matrix C,
+    GrB_Matrix A
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix C2 = NULL, A2 = NULL ;
+    OK (GrB_Matrix_dup (&C2, C)) ;
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C2, A2, 0)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// set_entry: A(i,j) = x and D(i,j) = x, where (i,j) is entry k of vector j
+//------------------------------------------------------------------------------
+
+// The position (k,vec) is held in the internal CSC or CSR format of A, so
+// that the test controls which vectors of A are touched.
+
+#undef  FREE_ALL
+#define FREE_ALL ;
+
+static GrB_Info set_entry
+(
+    GrB_Matrix A,
+    GrB_Matrix D,
+    int8_t *Mark,
+    int64_t k,
+    int64_t vec,
+    double x
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Index i = A->is_csc ? k : vec ;
+    GrB_Index j = A->is_csc ? vec : k ;
+    OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+    OK (GrB_Matrix_setElement_FP64 (D, x, i, j)) ;
+    Mark [k + vec * N] = 1 ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test54
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&D) ;              \
+    if (Mark != NULL) mxFree (Mark) ;   \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected = GrB_SUCCESS ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, D = NULL ;
+    int8_t *Mark = NULL ;
+    simple_rand_seed (54) ;
+
+    // Mark [k + vec*N] is 1 if A(k,vec) is present, in the internal format
+    // of A, 2 if it is a zombie, or 0 otherwise.  Vectors with (vec % 3 == 1)
+    // start out empty.
+    Mark = mxMalloc (N * N * sizeof (int8_t)) ;
+    CHECK (Mark != NULL) ;
+
+    int64_t ninplace = 0, ndoubled = 0, nreused = 0, nhash = 0 ;
+
+    for (int hyper = 0 ; hyper <= 1 ; hyper++)
+    for (int format = GxB_BY_ROW ; format <= GxB_BY_COL ; format++)
+    for (int iso = 0 ; iso <= 1 ; iso++)
+    for (int zombies = 0 ; zombies <= 1 ; zombies++)
+    for (int kase = 0 ; kase <= 2 ; kase++)
+    {
+
+        // kase 0: tnz = anz/16 entries, so the update is done in place
+        // kase 1: tnz = anz/16 + 1 entries, so GB_wait uses GB_add instead
+        // kase 2: like kase 0, but one entry is in an empty vector, which is
+        //      not in A->h if A is hypersparse
+
+        //----------------------------------------------------------------------
+        // create A, with empty vectors, and its reference D
+        //----------------------------------------------------------------------
+
+        int sparsity = hyper ? GxB_HYPERSPARSE : GxB_SPARSE ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, N, N)) ;
+        OK (GrB_Matrix_set_INT32 (A, format, GrB_STORAGE_ORIENTATION_HINT)) ;
+        OK (GrB_Matrix_set_INT32 (A, sparsity,
+            (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+        OK (GrB_Matrix_dup (&D, A)) ;
+        memset (Mark, 0, N * N * sizeof (int8_t)) ;
+        for (int64_t t = 0 ; t < 3000 ; t++)
+        {
+            int64_t k = simple_rand_i ( ) % N ;
+            int64_t vec = simple_rand_i ( ) % N ;
+            if (vec % 3 == 1) continue ;
+            double x = iso ? 3 : (double) (simple_rand_i ( ) % 1000) ;
+            OK (set_entry (A, D, Mark, k, vec, x)) ;
+        }
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        CHECK (GB_sparsity (A) == sparsity) ;
+        CHECK (A->iso == iso) ;
+
+        for (int round = 0 ; round < NROUNDS ; round++)
+        {
+
+            //------------------------------------------------------------------
+            // delete some entries, and update some others
+            //------------------------------------------------------------------
+
+            // the zombies of the prior round are gone
+            for (int64_t p = 0 ; p < N * N ; p++)
+            {
+                if (Mark [p] == 2) Mark [p] = 0 ;
+            }
+
+            if (zombies)
+            {
+                for (int64_t t = 0 ; t < 40 ; t++)
+                {
+                    int64_t k = simple_rand_i ( ) % N ;
+                    int64_t vec = simple_rand_i ( ) % N ;
+                    GrB_Index i = A->is_csc ? k : vec ;
+                    GrB_Index j = A->is_csc ? vec : k ;
+                    OK (GrB_Matrix_removeElement (A, i, j)) ;
+                    OK (GrB_Matrix_removeElement (D, i, j)) ;
+                    if (Mark [k + vec * N] == 1) Mark [k + vec * N] = 2 ;
+                }
+            }
+
+            int64_t anz = 0 ;
+            for (int64_t p = 0 ; p < N * N ; p++)
+            {
+                anz += (Mark [p] == 1) ;
+            }
+
+            // existing entries are updated in place by setElement, so they
+            // are not pending tuples
+            for (int64_t t = 0 ; t < 20 ; t++)
+            {
+                int64_t k = simple_rand_i ( ) % N ;
+                int64_t vec = simple_rand_i ( ) % N ;
+                if (Mark [k + vec * N] != 1) continue ;
+                double x = iso ? 3 : (double) (simple_rand_i ( ) % 1000) ;
+                OK (set_entry (A, D, Mark, k, vec, x)) ;
+            }
+
+            //------------------------------------------------------------------
+            // add tnz new entries as pending tuples
+            //------------------------------------------------------------------
+
+            // Each new entry is set twice, so the pending tuples have
+            // duplicates.  The first and last vectors of A are touched,
+            // except in kase 2.
+
+            int64_t tnz = anz / 16 + ((kase == 1) ? 1 : 0) ;
+            int64_t nnew = 0 ;
+            if (kase == 2)
+            {
+                // one entry is in an empty vector of A
+                int64_t vec = 1 ;
+                while (vec < N && Mark [vec * N] != 0) vec += 3 ;
+                CHECK (vec < N) ;
+                double x = iso ? 3 : 42 ;
+                OK (set_entry (A, D, Mark, 0, vec, x)) ;
+                nnew++ ;
+            }
+            while (nnew < tnz)
+            {
+                int64_t k = simple_rand_i ( ) % N ;
+                int64_t vec = simple_rand_i ( ) % N ;
+                if (kase < 2 && nnew == 0) vec = 0 ;
+                if (kase < 2 && nnew == 1) vec = N-1 ;
+                // a zombie would be brought back to life by setElement, so
+                // it would not be a pending tuple
+                if (vec % 3 == 1 || Mark [k + vec * N] != 0) continue ;
+                double x = iso ? 3 : (double) (simple_rand_i ( ) % 1000) ;
+                OK (set_entry (A, D, Mark, k, vec, x)) ;
+                x = iso ? 3 : (double) (simple_rand_i ( ) % 1000) ;
+                OK (set_entry (A, D, Mark, k, vec, x)) ;
+                nnew++ ;
+            }
+            CHECK (GB_Pending_n (A) >= tnz) ;
+
+            //------------------------------------------------------------------
+            // finish the work, and capture the burble
+            //------------------------------------------------------------------
+
+            bool no_zombies = (A->nzombies == 0) ;
+            int64_t *Ai_before = A->i ;
+            size_t Ai_size_before = A->i_size ;
+            int64_t nnz_max_before = GB_nnz_max (A) ;
+            GrB_Matrix Y_before = A->Y ;
+
+            burble_len = 0 ;
+            burble [0] = '\0' ;
+            OK (GrB_Global_set_VOID_ (GrB_GLOBAL, (void *) capture_printf,
+                (GrB_Field) GxB_PRINTF, sizeof (GB_printf_function_t))) ;
+            OK (GrB_Global_set_INT32 (GrB_GLOBAL, true,
+                (GrB_Field) GxB_BURBLE)) ;
+            OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+            OK (GrB_Global_set_INT32 (GrB_GLOBAL, false,
+                (GrB_Field) GxB_BURBLE)) ;
+            OK (GrB_Global_set_VOID_ (GrB_GLOBAL, (void *) mexPrintf,
+                (GrB_Field) GxB_PRINTF, sizeof (GB_printf_function_t))) ;
+
+            //------------------------------------------------------------------
+            // check the result
+            //------------------------------------------------------------------
+
+            bool inplace = (strstr (burble, "(in place)") != NULL) ;
+            bool expect_inplace = (kase == 0) || (kase == 2 && !hyper) ;
+            CHECK (inplace == expect_inplace) ;
+            CHECK (GB_sparsity (A) == sparsity) ;
+            CHECK (A->iso == iso) ;
+            CHECK (A->nvals == anz + tnz) ;
+            CHECK (A->nvec_nonempty == GB_nvec_nonempty (A)) ;
+            OK (check_same (A, D)) ;
+
+            if (inplace)
+            {
+                ninplace++ ;
+                int64_t anz_new = anz + tnz ;
+                if (no_zombies && nnz_max_before >= anz_new)
+                {
+                    // the space left over from a prior update is used
+                    CHECK (A->i == Ai_before) ;
+                    CHECK (A->i_size == Ai_size_before) ;
+                    nreused++ ;
+                }
+                else if (no_zombies)
+                {
+                    // the space is doubled
+                    CHECK (GB_nnz_max (A) >= 2 * anz_new) ;
+                    ndoubled++ ;
+                }
+                if (hyper && no_zombies && Y_before != NULL)
+                {
+                    // A->h does not change, so A->Y is kept
+                    CHECK (A->Y == Y_before) ;
+                    nhash++ ;
+                }
+            }
+        }
+
+        GrB_Matrix_free (&A) ;
+        GrB_Matrix_free (&D) ;
+    }
+
+    // each case has been tested
+    printf ("in place: %ld, doubled: %ld, reused: %ld, hyper_hash kept: %ld\n",
+        ninplace, ndoubled, nreused, nhash) ;
+    CHECK (ndoubled > 0) ;
+    CHECK (nreused > 0) ;
+    CHECK (nhash > 0) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test54: all tests passed\n\n") ;
+}
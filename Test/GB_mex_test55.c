@@ -0,0 +1,440 @@
+//------------------------------------------------------------------------------
+// GB_mex_test55: test the background assembly of pending tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// With GrB_set (GrB_GLOBAL, s, GxB_BACKGROUND_WAIT), a list of pending tuples
+// that reaches the threshold s is assembled by a background thread.  A matrix
+// A is modified with a sequence of GrB_setElement and GxB_subassign calls,
+// with and without an accum operator, while its jobs run, and the result must
+// match a reference D modified by the same calls with no background jobs.
+// GB_wait must join any job, and a matrix with a job that is still running
+// can be freed, cleared, overwritten, or used as an input.  If the library
+// has no threads, the jobs are done in the foreground, or not at all.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define M 1000
+#define N 800
+#define NTUPLES 20000
+#define THRESHOLD 500
+
+//------------------------------------------------------------------------------
+// set_threshold: set the threshold for background jobs
+//------------------------------------------------------------------------------
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Scalar_free (&s) ;              \
+}
+
+static GrB_Info set_threshold (int64_t threshold)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Scalar s = NULL ;
+    OK (GrB_Scalar_new (&s, GrB_INT64)) ;
+    OK (GrB_Scalar_setElement_INT64 (s, threshold)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s,
+        (GrB_Field) GxB_BACKGROUND_WAIT)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_same: check if C and A hold the same matrix
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Matrix_free (&A2) ;             \
+}
+
+static GrB_Info check_same
+(
+    GrB_Matrix C,
+    GrB_Matrix A
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix C2 = NULL, A2 = NULL ;
+    OK (GrB_Matrix_dup (&C2, C)) ;
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C2, A2, 0)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// update: modify A with background jobs, and D without them
+//------------------------------------------------------------------------------
+
+// The tuples k1 to k2-1 are applied to A and D with GrB_Matrix_setElement
+// (kind 0), or with a scalar GxB_subassign with the GrB_PLUS_FP64 accum
+// operator (kind 1).  In kind 1, the pending tuples of A have the PLUS
+// operator, and duplicates are summed.  If iso is true, all values are 3, and
+// kind 1 is not used.  Returns the # of times a new job was seen in A.
+
+#undef  FREE_ALL
+#define FREE_ALL ;
+
+static GrB_Info update
+(
+    int64_t *njobs,
+    GrB_Matrix A,
+    GrB_Matrix D,
+    const GrB_Index *I,
+    const GrB_Index *J,
+    const double *X,
+    int64_t k1,
+    int64_t k2,
+    int kind
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    const void *job = NULL ;
+
+    OK (set_threshold (THRESHOLD)) ;
+    for (int64_t k = k1 ; k < k2 ; k++)
+    {
+        if (kind == 0)
+        {
+            OK (GrB_Matrix_setElement_FP64 (A, X [k], I [k], J [k])) ;
+        }
+        else
+        {
+            OK (GxB_Matrix_subassign_FP64 (A, NULL, GrB_PLUS_FP64, X [k],
+                &(I [k]), 1, &(J [k]), 1, NULL)) ;
+        }
+        if (A->Pending != NULL && A->Pending->job != NULL &&
+            A->Pending->job != job)
+        {
+            // a new job has been started
+            job = A->Pending->job ;
+            (*njobs)++ ;
+        }
+    }
+
+    OK (set_threshold (0)) ;
+    for (int64_t k = k1 ; k < k2 ; k++)
+    {
+        if (kind == 0)
+        {
+            OK (GrB_Matrix_setElement_FP64 (D, X [k], I [k], J [k])) ;
+        }
+        else
+        {
+            OK (GxB_Matrix_subassign_FP64 (D, NULL, GrB_PLUS_FP64, X [k],
+                &(I [k]), 1, &(J [k]), 1, NULL)) ;
+        }
+        CHECK (D->Pending == NULL || D->Pending->job == NULL) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// create: create A and D with the same random entries
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL ;
+
+static GrB_Info create
+(
+    GrB_Matrix *A_handle,
+    GrB_Matrix *D_handle,
+    int sparsity,
+    int format,
+    bool iso
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    OK (GrB_Matrix_new (A_handle, GrB_FP64, M, N)) ;
+    GrB_Matrix A = *A_handle ;
+    OK (GrB_Matrix_set_INT32 (A, format, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (A, sparsity, (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    for (int64_t k = 0 ; k < 2000 ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % M ;
+        GrB_Index j = simple_rand_i ( ) % N ;
+        double x = iso ? 3 : (double) (simple_rand_i ( ) % 100) ;
+        OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (A->iso == iso) ;
+    OK (GrB_Matrix_dup (D_handle, A)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test55
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&C) ;              \
+    GrB_Matrix_free (&D) ;              \
+    GrB_Matrix_free (&E) ;              \
+    GrB_Scalar_free (&s) ;              \
+    if (I != NULL) mxFree (I) ;         \
+    if (J != NULL) mxFree (J) ;         \
+    if (X != NULL) mxFree (X) ;         \
+    set_threshold (0) ;                 \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected = GrB_SUCCESS ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL, D = NULL, E = NULL ;
+    GrB_Scalar s = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    simple_rand_seed (55) ;
+    int64_t njobs = 0 ;
+
+    I = mxMalloc (NTUPLES * sizeof (GrB_Index)) ;
+    J = mxMalloc (NTUPLES * sizeof (GrB_Index)) ;
+    X = mxMalloc (NTUPLES * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // get and set the threshold
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Scalar_new (&s, GrB_INT64)) ;
+    OK (set_threshold (42)) ;
+    int64_t threshold = -1 ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s,
+        (GrB_Field) GxB_BACKGROUND_WAIT)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&threshold, s)) ;
+    CHECK (threshold == 42) ;
+    OK (GrB_Scalar_setElement_INT64 (s, -1)) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_Global_set_Scalar (GrB_GLOBAL, s,
+        (GrB_Field) GxB_BACKGROUND_WAIT)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s,
+        (GrB_Field) GxB_BACKGROUND_WAIT)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&threshold, s)) ;
+    CHECK (threshold == 42) ;
+    OK (set_threshold (0)) ;
+
+    //--------------------------------------------------------------------------
+    // GB_wait joins the jobs
+    //--------------------------------------------------------------------------
+
+    for (int sparsity = GxB_HYPERSPARSE ; sparsity <= GxB_SPARSE ;
+        sparsity++)
+    for (int format = GxB_BY_ROW ; format <= GxB_BY_COL ; format++)
+    for (int iso = 0 ; iso <= 1 ; iso++)
+    for (int kind = 0 ; kind <= 1 ; kind++)
+    {
+        if (iso && kind == 1) continue ;
+
+        // many tuples, with duplicates
+        for (int64_t k = 0 ; k < NTUPLES ; k++)
+        {
+            I [k] = simple_rand_i ( ) % M ;
+            J [k] = simple_rand_i ( ) % 200 ;
+            X [k] = iso ? 3 : (double) (simple_rand_i ( ) % 100) ;
+        }
+
+        OK (create (&A, &D, sparsity, format, iso)) ;
+
+        // a single job, joined by GrB_Matrix_wait, maybe while it is running
+        OK (update (&njobs, A, D, I, J, X, 0, THRESHOLD, kind)) ;
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        CHECK (A->Pending == NULL) ;
+        OK (check_same (A, D)) ;
+
+        // a job followed by more pending tuples
+        OK (update (&njobs, A, D, I, J, X, 0, THRESHOLD + 100, kind)) ;
+        OK (check_same (A, D)) ;
+
+        // a chain of jobs, with zombies in A
+        for (int64_t k = 0 ; k < 100 ; k++)
+        {
+            GrB_Index i = simple_rand_i ( ) % M ;
+            GrB_Index j = simple_rand_i ( ) % N ;
+            OK (GrB_Matrix_removeElement (A, i, j)) ;
+            OK (GrB_Matrix_removeElement (D, i, j)) ;
+        }
+        OK (update (&njobs, A, D, I, J, X, 1000, NTUPLES, kind)) ;
+        OK (check_same (A, D)) ;
+
+        // a job with no tuples added after it, and GrB_Matrix_nvals
+        OK (update (&njobs, A, D, I, J, X, 0, THRESHOLD, kind)) ;
+        GrB_Index anvals, dnvals ;
+        OK (GrB_Matrix_nvals (&anvals, A)) ;
+        OK (GrB_Matrix_nvals (&dnvals, D)) ;
+        CHECK (anvals == dnvals) ;
+        OK (check_same (A, D)) ;
+        CHECK (A->iso == D->iso) ;
+
+        //----------------------------------------------------------------------
+        // A is used as an input while its job is running
+        //----------------------------------------------------------------------
+
+        OK (update (&njobs, A, D, I, J, X, 0, 2 * THRESHOLD, kind)) ;
+        OK (GrB_Matrix_new (&C, GrB_FP64, N, M)) ;
+        OK (GrB_Matrix_new (&E, GrB_FP64, N, M)) ;
+        OK (GrB_transpose (C, NULL, NULL, A, NULL)) ;
+        OK (GrB_transpose (E, NULL, NULL, D, NULL)) ;
+        OK (check_same (C, E)) ;
+        GrB_Matrix_free (&C) ;
+        GrB_Matrix_free (&E) ;
+
+        OK (update (&njobs, A, D, I, J, X, 5000, 5000 + 2 * THRESHOLD, kind)) ;
+        OK (GrB_Matrix_dup (&C, A)) ;
+        OK (check_same (C, D)) ;
+        GrB_Matrix_free (&C) ;
+
+        //----------------------------------------------------------------------
+        // changing the format of A finishes the job first
+        //----------------------------------------------------------------------
+
+        OK (update (&njobs, A, D, I, J, X, 0, 2 * THRESHOLD, kind)) ;
+        OK (GrB_Matrix_set_INT32 (A, (format == GxB_BY_ROW) ? GxB_BY_COL :
+            GxB_BY_ROW, GrB_STORAGE_ORIENTATION_HINT)) ;
+        OK (update (&njobs, A, D, I, J, X, 7000, 7000 + 2 * THRESHOLD, kind)) ;
+        OK (check_same (A, D)) ;
+
+        //----------------------------------------------------------------------
+        // a change to the pending operator finishes the job first
+        //----------------------------------------------------------------------
+
+        OK (update (&njobs, A, D, I, J, X, 0, 2 * THRESHOLD, kind)) ;
+        OK (update (&njobs, A, D, I, J, X, 9000, 9000 + 2 * THRESHOLD,
+            1 - kind)) ;
+        OK (check_same (A, D)) ;
+
+        //----------------------------------------------------------------------
+        // A is cleared while its job is running
+        //----------------------------------------------------------------------
+
+        OK (update (&njobs, A, D, I, J, X, 0, 4 * THRESHOLD, kind)) ;
+        OK (GrB_Matrix_clear (A)) ;
+        OK (GrB_Matrix_clear (D)) ;
+        CHECK (A->Pending == NULL) ;
+        OK (update (&njobs, A, D, I, J, X, 11000, 11000 + 2 * THRESHOLD,
+            kind)) ;
+        OK (check_same (A, D)) ;
+
+        //----------------------------------------------------------------------
+        // A is overwritten while its job is running
+        //----------------------------------------------------------------------
+
+        OK (update (&njobs, A, D, I, J, X, 0, 4 * THRESHOLD, kind)) ;
+        OK (GrB_Matrix_new (&B, GrB_FP64, M, N)) ;
+        OK (GrB_Matrix_assign_FP64 (B, NULL, NULL, 1, GrB_ALL, M, GrB_ALL, 10,
+            NULL)) ;
+        OK (GrB_Matrix_assign (A, NULL, NULL, B, GrB_ALL, M, GrB_ALL, N,
+            NULL)) ;
+        OK (check_same (A, B)) ;
+        OK (update (&njobs, A, B, I, J, X, 13000, 13000 + 2 * THRESHOLD,
+            kind)) ;
+        OK (check_same (A, B)) ;
+        GrB_Matrix_free (&B) ;
+
+        OK (update (&njobs, A, D, I, J, X, 0, 4 * THRESHOLD, kind)) ;
+        OK (GrB_Matrix_new (&B, GrB_FP64, M, N)) ;
+        OK (GrB_Matrix_apply (A, NULL, NULL, GrB_AINV_FP64, B, NULL)) ;
+        OK (check_same (A, B)) ;
+        GrB_Matrix_free (&B) ;
+
+        //----------------------------------------------------------------------
+        // A is freed while its job is running
+        //----------------------------------------------------------------------
+
+        OK (update (&njobs, A, D, I, J, X, 0, NTUPLES, kind)) ;
+        GrB_Matrix_free (&A) ;
+        GrB_Matrix_free (&D) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // a pending operator of another type is not done in the background
+    //--------------------------------------------------------------------------
+
+    OK (create (&A, &D, GxB_SPARSE, GxB_BY_COL, false)) ;
+    OK (set_threshold (10)) ;
+    for (int64_t k = 0 ; k < 1000 ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % M ;
+        GrB_Index j = simple_rand_i ( ) % N ;
+        OK (GxB_Matrix_subassign_INT32 (A, NULL, GrB_PLUS_INT32, (int32_t) k,
+            &i, 1, &j, 1, NULL)) ;
+        CHECK (A->Pending == NULL || A->Pending->job == NULL) ;
+    }
+    OK (set_threshold (0)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&D) ;
+
+    //--------------------------------------------------------------------------
+    // a pending operator that is not associative is not done in the background
+    //--------------------------------------------------------------------------
+
+    // With GrB_MINUS_FP64, the job would compute (x1-x2) - (x3-x4) for four
+    // tuples with the same (i,j), instead of ((x1-x2)-x3)-x4.
+
+    OK (create (&A, &D, GxB_SPARSE, GxB_BY_COL, false)) ;
+    for (int64_t k = 0 ; k < 4000 ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % 10 ;
+        GrB_Index j = simple_rand_i ( ) % 10 ;
+        double x = (double) (simple_rand_i ( ) % 100) ;
+        OK (set_threshold (10)) ;
+        OK (GxB_Matrix_subassign_FP64 (A, NULL, GrB_MINUS_FP64, x, &i, 1,
+            &j, 1, NULL)) ;
+        CHECK (A->Pending == NULL || A->Pending->job == NULL) ;
+        OK (set_threshold (0)) ;
+        OK (GxB_Matrix_subassign_FP64 (D, NULL, GrB_MINUS_FP64, x, &i, 1,
+            &j, 1, NULL)) ;
+    }
+    OK (check_same (A, D)) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&D) ;
+
+    // the background jobs have been used, unless the library has no threads
+    printf ("background jobs: %ld\n", njobs) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test55: all tests passed\n\n") ;
+}
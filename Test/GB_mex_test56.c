@@ -0,0 +1,591 @@
+//------------------------------------------------------------------------------
+// GB_mex_test56: test the combining of pending tuples with a hash table
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// With GrB_set (GrB_GLOBAL, s, GxB_PENDING_COMBINE), a pending tuple with the
+// same (i,j) as a prior one is combined into it as it is added, for up to s
+// distinct (i,j).  A matrix A is modified by a sequence of GrB_setElement and
+// GxB_subassign calls, with and without an accum operator, mixed with tuples
+// appended by GxB_Matrix_setElements, the concurrent setElement slots, and
+// the GxB_subassign kernels.  The # of pending tuples in A must be exactly as
+// predicted, and the result must match a reference D modified by the same
+// calls with no combining, whose duplicates are combined by GB_builder.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define M 60
+#define N 50
+#define NTUPLES 3000
+#define NKINDS 5
+
+//------------------------------------------------------------------------------
+// set_combine: set the # of keys for combining pending tuples
+//------------------------------------------------------------------------------
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Scalar_free (&s) ;              \
+}
+
+static GrB_Info set_combine (int64_t nkeys)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Scalar s = NULL ;
+    OK (GrB_Scalar_new (&s, GrB_INT64)) ;
+    OK (GrB_Scalar_setElement_INT64 (s, nkeys)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s,
+        (GrB_Field) GxB_PENDING_COMBINE)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    if (I != NULL) mxFree (I) ;         \
+    if (J != NULL) mxFree (J) ;         \
+    if (X != NULL) mxFree (X) ;         \
+}
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Index nz,       // # of entries to create
+    int sparsity,       // GxB_SPARSE or GxB_HYPERSPARSE
+    bool iso,
+    int format          // GxB_BY_ROW or GxB_BY_COL
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix A = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, M, N)) ;
+    OK (GrB_Matrix_set_INT32 (A, format, GrB_STORAGE_ORIENTATION_HINT)) ;
+    I = mxMalloc (nz * sizeof (GrB_Index)) ;
+    J = mxMalloc (nz * sizeof (GrB_Index)) ;
+    X = mxMalloc (nz * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL) ;
+    for (int64_t k = 0 ; k < nz ; k++)
+    {
+        I [k] = simple_rand_i ( ) % M ;
+        J [k] = simple_rand_i ( ) % N ;
+        X [k] = 3 ;
+    }
+    OK (GrB_Matrix_build_FP64 (A, I, J, X, nz, GrB_SECOND_FP64)) ;
+    if (!iso)
+    {
+        // A(i,j) = i + A(i,j)
+        OK (GrB_Matrix_apply_IndexOp_INT64 (A, NULL, GrB_PLUS_FP64,
+            GrB_ROWINDEX_INT64, A, 0, NULL)) ;
+    }
+    OK (GrB_Matrix_set_INT32 (A, sparsity,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (GB_sparsity (A) == sparsity) ;
+    (*A_handle) = A ;
+    A = NULL ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_same: check if C and A hold the same matrix
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Matrix_free (&A2) ;             \
+}
+
+static GrB_Info check_same
+(
+    GrB_Matrix C,
+    GrB_Matrix A
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix C2 = NULL, A2 = NULL ;
+    OK (GrB_Matrix_dup (&C2, C)) ;
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (C2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_set_INT32 (A2, GxB_BY_COL, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C2, A2, 0)) ;
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// update: modify A with combining, and D without it
+//------------------------------------------------------------------------------
+
+// The tuples 0 to n-1 are applied to A and D, one at a time, with:
+//
+//  kind 0: GrB_Matrix_setElement_FP64 (no accum; the last value is kept)
+//  kind 1: GxB_Matrix_subassign_FP64 with the GrB_PLUS_FP64 accum
+//  kind 2: GxB_Matrix_subassign_FP64 with the GrB_MINUS_FP64 accum, which is
+//          not associative, so the tuples must be combined in order
+//  kind 3: GrB_Matrix_setElement_INT32 (no accum, typecast to FP64)
+//  kind 4: GxB_Matrix_subassign_INT32 with the GrB_PLUS_INT32 accum, whose
+//          type differs from the matrix, so no tuples are combined
+//
+// The values in X are small integers, so the result is exact in any order.
+
+#undef  FREE_ALL
+#define FREE_ALL ;
+
+static GrB_Info update1
+(
+    GrB_Matrix A,
+    const GrB_Index *I,
+    const GrB_Index *J,
+    const double *X,
+    int64_t n,
+    int kind
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        switch (kind)
+        {
+            case 0 :
+                OK (GrB_Matrix_setElement_FP64 (A, X [k], I [k], J [k])) ;
+                break ;
+            case 1 :
+                OK (GxB_Matrix_subassign_FP64 (A, NULL, GrB_PLUS_FP64, X [k],
+                    &(I [k]), 1, &(J [k]), 1, NULL)) ;
+                break ;
+            case 2 :
+                OK (GxB_Matrix_subassign_FP64 (A, NULL, GrB_MINUS_FP64,
+                    X [k], &(I [k]), 1, &(J [k]), 1, NULL)) ;
+                break ;
+            case 3 :
+                OK (GrB_Matrix_setElement_INT32 (A, (int32_t) X [k], I [k],
+                    J [k])) ;
+                break ;
+            default :
+                OK (GxB_Matrix_subassign_INT32 (A, NULL, GrB_PLUS_INT32,
+                    (int32_t) X [k], &(I [k]), 1, &(J [k]), 1, NULL)) ;
+                break ;
+        }
+    }
+    return (GrB_SUCCESS) ;
+}
+
+static GrB_Info update
+(
+    GrB_Matrix A,
+    GrB_Matrix D,
+    const GrB_Index *I,
+    const GrB_Index *J,
+    const double *X,
+    int64_t n,
+    int kind,
+    int64_t nkeys
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    OK (set_combine (nkeys)) ;
+    OK (update1 (A, I, J, X, n, kind)) ;
+    OK (set_combine (0)) ;
+    OK (update1 (D, I, J, X, n, kind)) ;
+    CHECK (D->Pending == NULL || D->Pending->hash == NULL) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// append: append tuples to A and D without the hash table
+//------------------------------------------------------------------------------
+
+// For kinds 0 and 3, the tuples 0 to n-1 are appended by
+// GxB_Matrix_setElements, and then again by GrB_Matrix_setElement through
+// the concurrent setElement slots, which are flushed into the pending tuples
+// when the slots are disabled.  Otherwise, a 5-by-4 matrix B is added twice
+// into A(I,J) with GxB_subassign and the accum operator of the kind, so the
+// GxB_subassign kernels append two tuples for each entry of B not in A.
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&B) ;              \
+}
+
+static GrB_Info append1
+(
+    GrB_Matrix A,
+    const GrB_Index *I,
+    const GrB_Index *J,
+    const double *X,
+    int64_t n,
+    int kind
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    GrB_Matrix B = NULL ;
+    if (kind == 0 || kind == 3)
+    {
+        OK (GxB_Matrix_setElements (A, X, GrB_FP64, I, J, n)) ;
+        OK (GrB_Matrix_set_INT32 (A, 1,
+            (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+        for (int64_t k = 0 ; k < n ; k++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (A, X [k] + 1, I [k], J [k])) ;
+        }
+        OK (GrB_Matrix_set_INT32 (A, 0,
+            (GrB_Field) GxB_CONCURRENT_SETELEMENT)) ;
+        CHECK (A->Ingest == NULL) ;
+    }
+    else
+    {
+        GrB_Index Ilist [5] = { 1, 7, 13, 40, 59 } ;
+        GrB_Index Jlist [4] = { 0, 21, 22, 49 } ;
+        GrB_Type btype = (kind == 4) ? GrB_INT32 : GrB_FP64 ;
+        GrB_BinaryOp accum = (kind == 1) ? GrB_PLUS_FP64 :
+            ((kind == 2) ? GrB_MINUS_FP64 : GrB_PLUS_INT32) ;
+        OK (GrB_Matrix_new (&B, btype, 5, 4)) ;
+        OK (GrB_Matrix_assign_FP64 (B, NULL, NULL, 5, GrB_ALL, 5, GrB_ALL, 4,
+            NULL)) ;
+        OK (GrB_Matrix_apply_IndexOp_INT64 (B, NULL, NULL,
+            GrB_ROWINDEX_INT64, B, 2, NULL)) ;
+        for (int trial = 0 ; trial < 2 ; trial++)
+        {
+            OK (GxB_Matrix_subassign (A, NULL, accum, B, Ilist, 5, Jlist, 4,
+                NULL)) ;
+        }
+    }
+    FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+#undef  FREE_ALL
+#define FREE_ALL ;
+
+static GrB_Info append
+(
+    GrB_Matrix A,
+    GrB_Matrix D,
+    const GrB_Index *I,
+    const GrB_Index *J,
+    const double *X,
+    int64_t n,
+    int kind,
+    int64_t nkeys
+)
+{
+    GrB_Info info ;
+    bool malloc_debug = false ;
+    OK (set_combine (nkeys)) ;
+    OK (append1 (A, I, J, X, n, kind)) ;
+    OK (set_combine (0)) ;
+    OK (append1 (D, I, J, X, n, kind)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test56
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&D) ;              \
+    GrB_Scalar_free (&s) ;              \
+    if (I != NULL) mxFree (I) ;         \
+    if (J != NULL) mxFree (J) ;         \
+    if (X != NULL) mxFree (X) ;         \
+    if (Mark != NULL) mxFree (Mark) ;   \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected = GrB_SUCCESS ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, D = NULL ;
+    GrB_Scalar s = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    int8_t *Mark = NULL ;
+    simple_rand_seed (56) ;
+
+    I = mxMalloc (NTUPLES * sizeof (GrB_Index)) ;
+    J = mxMalloc (NTUPLES * sizeof (GrB_Index)) ;
+    X = mxMalloc (NTUPLES * sizeof (double)) ;
+    Mark = mxMalloc (M * N * sizeof (int8_t)) ;
+    CHECK (I != NULL && J != NULL && X != NULL && Mark != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // get and set the # of keys
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Scalar_new (&s, GrB_INT64)) ;
+    int64_t nkeys = -1 ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s,
+        (GrB_Field) GxB_PENDING_COMBINE)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&nkeys, s)) ;
+    CHECK (nkeys == 0) ;
+    OK (set_combine (42)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s,
+        (GrB_Field) GxB_PENDING_COMBINE)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&nkeys, s)) ;
+    CHECK (nkeys == 42) ;
+    OK (GrB_Scalar_setElement_INT64 (s, -1)) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_Global_set_Scalar (GrB_GLOBAL, s,
+        (GrB_Field) GxB_PENDING_COMBINE)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s,
+        (GrB_Field) GxB_PENDING_COMBINE)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&nkeys, s)) ;
+    CHECK (nkeys == 42) ;
+    OK (set_combine (0)) ;
+
+    //--------------------------------------------------------------------------
+    // combine the tuples and compare with GB_builder
+    //--------------------------------------------------------------------------
+
+    // The # of keys is zero (no combining), 7 and 500 (the limit is reached),
+    // or large enough for all (i,j), in which case the table grows from 1024
+    // to 4096 entries.
+
+    int64_t Nkeys [4] = { 0, 7, 500, 1000000 } ;
+    int64_t ncombined = 0 ;
+
+    for (int kk = 0 ; kk < 4 ; kk++)
+    for (int sparsity = GxB_HYPERSPARSE ; sparsity <= GxB_SPARSE ;
+        sparsity++)
+    for (int format = GxB_BY_ROW ; format <= GxB_BY_COL ; format++)
+    for (int iso = 0 ; iso <= 1 ; iso++)
+    for (int kind = 0 ; kind < NKINDS ; kind++)
+    {
+        if (iso && kind != 0) continue ;
+        nkeys = Nkeys [kk] ;
+
+        //----------------------------------------------------------------------
+        // create the matrices and the tuples
+        //----------------------------------------------------------------------
+
+        // Many tuples are duplicates, and many are entries already in A.  If
+        // iso is true, all values are equal to the iso value of A.
+
+        OK (random_matrix (&A, 600, sparsity, iso, format)) ;
+        OK (GrB_Matrix_dup (&D, A)) ;
+        for (int64_t k = 0 ; k < NTUPLES ; k++)
+        {
+            I [k] = simple_rand_i ( ) % M ;
+            J [k] = simple_rand_i ( ) % N ;
+            X [k] = iso ? 3 : (double) (simple_rand_i ( ) % 100) ;
+        }
+
+        //----------------------------------------------------------------------
+        // predict the # of pending tuples in A
+        //----------------------------------------------------------------------
+
+        // Mark [i+j*M] is 1 if A(i,j) is an entry, 2 if (i,j) is in the hash
+        // table, and 0 otherwise.  An entry already in A is modified in
+        // place, so its tuples are never pending.
+
+        bool combine = (nkeys > 0 && kind != 4) ;
+        memset (Mark, 0, M * N * sizeof (int8_t)) ;
+        for (int64_t i = 0 ; i < M ; i++)
+        {
+            for (int64_t j = 0 ; j < N ; j++)
+            {
+                double aij ;
+                info = GrB_Matrix_extractElement_FP64 (&aij, A, i, j) ;
+                CHECK (info == GrB_SUCCESS || info == GrB_NO_VALUE) ;
+                Mark [i+j*M] = (info == GrB_SUCCESS) ;
+            }
+        }
+        int64_t npending = 0, ntable = 0 ;
+        for (int64_t k = 0 ; k < NTUPLES ; k++)
+        {
+            int64_t p = I [k] + J [k] * M ;
+            if (Mark [p] == 1)
+            {
+                // A(i,j) is modified in place
+            }
+            else if (combine && Mark [p] == 2)
+            {
+                // the tuple is combined with a prior one
+                ncombined++ ;
+            }
+            else if (combine && ntable < nkeys)
+            {
+                // (i,j) is added to the hash table
+                Mark [p] = 2 ;
+                ntable++ ;
+                npending++ ;
+            }
+            else
+            {
+                // the tuple is appended to the list
+                npending++ ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // first round: single tuples
+        //----------------------------------------------------------------------
+
+        OK (update (A, D, I, J, X, NTUPLES, kind, nkeys)) ;
+        CHECK (A->Pending != NULL && D->Pending != NULL) ;
+        CHECK (A->Pending->n == npending) ;
+        CHECK (D->Pending->n >= npending) ;
+        if (combine)
+        {
+            CHECK (A->Pending->hash != NULL) ;
+            CHECK (A->Pending->hash_nkeys == ntable) ;
+            CHECK (A->Pending->hash_nkeys <= nkeys) ;
+            CHECK (2 * A->Pending->hash_nkeys <= A->Pending->hash_bits + 1) ;
+            CHECK (A->Pending->hash_ntuples == A->Pending->n) ;
+        }
+        else
+        {
+            CHECK (A->Pending->hash == NULL) ;
+        }
+        CHECK (A->Pending->x == NULL || !iso) ;
+
+        // the hash table is included in the memory usage of A
+        size_t asize ;
+        OK (GxB_Matrix_memoryUsage (&asize, A)) ;
+        CHECK (asize > A->Pending->hash_size) ;
+
+        //----------------------------------------------------------------------
+        // second round: tuples appended by other methods, then single tuples
+        //----------------------------------------------------------------------
+
+        // The appended tuples are added to the hash table in order, before
+        // the next single tuple is combined.  For kind 2, the pending tuples
+        // from the GxB_subassign kernels have two tuples for the same (i,j),
+        // and a new tuple must be combined as ((x1 - x2) - x3), not as
+        // (x1 - (x2 - x3)).
+
+        OK (append (A, D, I, J, X, 200, kind, nkeys)) ;
+        OK (update (A, D, I + 100, J + 100, X + 100, 1000, kind, nkeys)) ;
+        OK (append (A, D, I + 500, J + 500, X + 500, 50, kind, nkeys)) ;
+        for (int64_t k = 0 ; k < 20 ; k++)
+        {
+            // add tuples for the entries set by the GxB_subassign kernels
+            GrB_Index Ilist [5] = { 1, 7, 13, 40, 59 } ;
+            GrB_Index Jlist [4] = { 0, 21, 22, 49 } ;
+            I [k] = Ilist [k % 5] ;
+            J [k] = Jlist [k / 5] ;
+            X [k] = iso ? 3 : (double) (simple_rand_i ( ) % 100) ;
+        }
+        OK (update (A, D, I, J, X, 20, kind, nkeys)) ;
+        OK (update (A, D, I, J, X, 20, kind, nkeys)) ;
+        if (A->Pending != NULL && combine)
+        {
+            CHECK (A->Pending->hash_nkeys <= nkeys) ;
+        }
+
+        //----------------------------------------------------------------------
+        // check the result
+        //----------------------------------------------------------------------
+
+        GrB_Index anvals, dnvals ;
+        OK (GrB_Matrix_nvals (&anvals, A)) ;
+        OK (GrB_Matrix_nvals (&dnvals, D)) ;
+        CHECK (anvals == dnvals) ;
+        CHECK (A->Pending == NULL) ;
+        OK (check_same (A, D)) ;
+        bool a_iso, d_iso ;
+        OK (GxB_Matrix_iso (&a_iso, A)) ;
+        OK (GxB_Matrix_iso (&d_iso, D)) ;
+        CHECK (a_iso == d_iso) ;
+
+        //----------------------------------------------------------------------
+        // free a matrix with a hash table, and one with pending tuples
+        //----------------------------------------------------------------------
+
+        // A and D are cleared, so all the tuples are pending
+        OK (GrB_Matrix_clear (A)) ;
+        OK (GrB_Matrix_clear (D)) ;
+        OK (update (A, D, I + 1000, J + 1000, X + 1000, 500, kind, nkeys)) ;
+        CHECK (A->Pending != NULL) ;
+        CHECK (combine == (A->Pending->hash != NULL)) ;
+        GrB_Matrix_free (&A) ;
+        GrB_Matrix_free (&D) ;
+    }
+
+    OK (set_combine (0)) ;
+    printf ("tuples combined: %ld\n", ncombined) ;
+    CHECK (ncombined > 0) ;
+
+    //--------------------------------------------------------------------------
+    // a vector with a hash table
+    //--------------------------------------------------------------------------
+
+    // The # of keys is raised from 10 to 1000 halfway through, but the limit
+    // of the hash table is fixed when it is allocated.  Otherwise, an index
+    // left out of the table with several tuples could be added later, and
+    // combined out of order with the GrB_MINUS_FP64 operator.
+
+    GrB_Vector v = NULL, w = NULL ;
+    OK (GrB_Vector_new (&v, GrB_FP64, 1000000)) ;
+    OK (GrB_Vector_new (&w, GrB_FP64, 1000000)) ;
+    for (int64_t k = 0 ; k < NTUPLES ; k++)
+    {
+        I [k] = simple_rand_i ( ) % 100 ;
+        X [k] = (double) (simple_rand_i ( ) % 100) ;
+        OK (set_combine ((k < NTUPLES / 2) ? 10 : 1000)) ;
+        OK (GxB_Vector_subassign_FP64 (v, NULL, GrB_MINUS_FP64, X [k],
+            &(I [k]), 1, NULL)) ;
+        OK (set_combine (0)) ;
+        OK (GxB_Vector_subassign_FP64 (w, NULL, GrB_MINUS_FP64, X [k],
+            &(I [k]), 1, NULL)) ;
+    }
+    GrB_Matrix V = (GrB_Matrix) v ;
+    CHECK (V->Pending != NULL && V->Pending->j == NULL) ;
+    CHECK (V->Pending->hash_nkeys == 10) ;
+    CHECK (V->Pending->hash_nkeys_max == 10) ;
+    CHECK (V->Pending->n < NTUPLES) ;
+    OK (check_same ((GrB_Matrix) v, (GrB_Matrix) w)) ;
+    GrB_Vector_free (&v) ;
+    GrB_Vector_free (&w) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test56: all tests passed\n\n") ;
+}
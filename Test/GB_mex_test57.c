@@ -0,0 +1,381 @@
+//------------------------------------------------------------------------------
+// GB_mex_test57: test the calibrated and online selection of dot2 vs saxpy
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Tests GrB_get/GrB_set of GxB_AxB_TUNE, GxB_AxB_CALIBRATE, and
+// GxB_AxB_DOT2_RATIO, including invalid values.  The cost model file
+// GB_AxB_tune.txt is written in a temporary JIT cache folder, and then loaded
+// when the tuned mode is set: a valid file is loaded, while a corrupt file or
+// a file from another version of GraphBLAS is ignored, the cost model is
+// calibrated again, and the file is rewritten.  The online statistics are
+// then checked with synthetic run times: the calibrated choice is used for
+// the first few problems of a shape class, then the other method, and then
+// the faster one, which switches when the run times change.  Finally, C=A'*B
+// is computed with online tuning and compared with the result of the fixed
+// rule.  If GraphBLAS is compiled without OpenMP, there is no timer, and the
+// tuned modes must return GrB_NOT_IMPLEMENTED.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define CACHE "/tmp/GB_mex_test57_cache"
+#define TUNE_FILE CACHE "/GB_AxB_tune.txt"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free (&A) ;              \
+    GrB_Matrix_free (&B) ;              \
+    GrB_Matrix_free (&C1) ;             \
+    GrB_Matrix_free (&C2) ;             \
+    GrB_Scalar_free (&s) ;              \
+}
+
+//------------------------------------------------------------------------------
+// write_tune_file: write a cost model file
+//------------------------------------------------------------------------------
+
+static bool write_tune_file (int v1, int v2, int v3, double dot2_ratio,
+    bool corrupt)
+{
+    FILE *fp = fopen (TUNE_FILE, "w") ;
+    if (fp == NULL) return (false) ;
+    if (corrupt)
+    {
+        fprintf (fp, "// SuiteSparse:GraphBLAS garbage\n") ;
+    }
+    else
+    {
+        fprintf (fp, "// SuiteSparse:GraphBLAS %d.%d.%d AxB cost model\n"
+            "dot2_ratio %.17g\n", v1, v2, v3, dot2_ratio) ;
+    }
+    fclose (fp) ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// check_tune_file: check the file saved by the calibration
+//------------------------------------------------------------------------------
+
+static bool check_tune_file (double dot2_ratio)
+{
+    FILE *fp = fopen (TUNE_FILE, "r") ;
+    if (fp == NULL) return (false) ;
+    int v1 = -1, v2 = -1, v3 = -1 ;
+    double x = 0 ;
+    int r = fscanf (fp, "// SuiteSparse:GraphBLAS %d.%d.%d AxB cost model "
+        "dot2_ratio %lg", &v1, &v2, &v3, &x) ;
+    fclose (fp) ;
+    return (r == 4 && v1 == GxB_IMPLEMENTATION_MAJOR &&
+        v2 == GxB_IMPLEMENTATION_MINOR && v3 == GxB_IMPLEMENTATION_SUB &&
+        x == dot2_ratio) ;
+}
+
+//------------------------------------------------------------------------------
+// get_ratio: get the dot2_ratio
+//------------------------------------------------------------------------------
+
+static double get_ratio (GrB_Scalar s)
+{
+    double x = -1 ;
+    if (GrB_Global_get_Scalar (GrB_GLOBAL, s,
+        (GrB_Field) GxB_AxB_DOT2_RATIO) != GrB_SUCCESS) return (-1) ;
+    if (GrB_Scalar_extractElement_FP64 (&x, s) != GrB_SUCCESS) return (-1) ;
+    return (x) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test57 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected = GrB_SUCCESS ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Scalar s = NULL ;
+    int32_t tune = -1, calibrated = -1, has_openmp = -1 ;
+    simple_rand_seed (57) ;
+
+    // save the current settings
+    bool save_calibrated = GB_Global_axb_calibrated_get ( ) ;
+    double save_ratio = GB_Global_axb_dot2_ratio_get ( ) ;
+    const char *cache = NULL ;
+    OK (GxB_get (GxB_JIT_CACHE_PATH, &cache)) ;
+    char save_cache [2048] ;
+    strncpy (save_cache, cache, 2047) ;
+    save_cache [2047] = '\0' ;
+
+    //--------------------------------------------------------------------------
+    // get/set the tuning mode and the dot2_ratio
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Scalar_new (&s, GrB_FP64)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &tune, (GrB_Field) GxB_AxB_TUNE)) ;
+    CHECK (tune == GxB_AxB_TUNE_OFF) ;
+
+    OK (GrB_Scalar_setElement_FP64 (s, 0.5)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s,
+        (GrB_Field) GxB_AxB_DOT2_RATIO)) ;
+    CHECK (get_ratio (s) == 0.5) ;
+    // the fixed rule ignores the dot2_ratio
+    CHECK (GB_AxB_tune_dot2_ratio ( ) == GB_AXB_DOT2_RATIO_DEFAULT) ;
+
+    expected = GrB_INVALID_VALUE ;
+    double bad [4] = { 0, -1, INFINITY, NAN } ;
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        OK (GrB_Scalar_setElement_FP64 (s, bad [k])) ;
+        ERR (GrB_Global_set_Scalar (GrB_GLOBAL, s,
+            (GrB_Field) GxB_AxB_DOT2_RATIO)) ;
+    }
+    CHECK (get_ratio (s) == 0.5) ;
+    ERR (GrB_Global_set_INT32 (GrB_GLOBAL, -1, (GrB_Field) GxB_AxB_TUNE)) ;
+    ERR (GrB_Global_set_INT32 (GrB_GLOBAL, 3, (GrB_Field) GxB_AxB_TUNE)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &tune, (GrB_Field) GxB_AxB_TUNE)) ;
+    CHECK (tune == GxB_AxB_TUNE_OFF) ;
+
+    // setting GxB_AxB_CALIBRATE to false does nothing
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, false,
+        (GrB_Field) GxB_AxB_CALIBRATE)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNE_OFF,
+        (GrB_Field) GxB_AxB_TUNE)) ;
+
+    //--------------------------------------------------------------------------
+    // without OpenMP, the tuned modes are not available
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &has_openmp,
+        (GrB_Field) GxB_LIBRARY_OPENMP)) ;
+    if (!has_openmp)
+    {
+        expected = GrB_NOT_IMPLEMENTED ;
+        ERR (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNE_CALIBRATED,
+            (GrB_Field) GxB_AxB_TUNE)) ;
+        ERR (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNE_ONLINE,
+            (GrB_Field) GxB_AxB_TUNE)) ;
+        ERR (GrB_Global_set_INT32 (GrB_GLOBAL, true,
+            (GrB_Field) GxB_AxB_CALIBRATE)) ;
+        OK (GrB_Global_get_INT32 (GrB_GLOBAL, &tune,
+            (GrB_Field) GxB_AxB_TUNE)) ;
+        CHECK (tune == GxB_AxB_TUNE_OFF) ;
+        GB_Global_axb_dot2_ratio_set (save_ratio) ;
+        FREE_ALL ;
+        GB_mx_put_global (true) ;
+        printf ("\nGB_mex_test57: all tests passed (no OpenMP)\n\n") ;
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // load the cost model from the JIT cache
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_CACHE_PATH, CACHE)) ;
+
+    // a valid file is loaded
+    CHECK (write_tune_file (GxB_IMPLEMENTATION_MAJOR,
+        GxB_IMPLEMENTATION_MINOR, GxB_IMPLEMENTATION_SUB, 0.25, false)) ;
+    GB_Global_axb_calibrated_set (false) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNE_CALIBRATED,
+        (GrB_Field) GxB_AxB_TUNE)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &tune, (GrB_Field) GxB_AxB_TUNE)) ;
+    CHECK (tune == GxB_AxB_TUNE_CALIBRATED) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &calibrated,
+        (GrB_Field) GxB_AxB_CALIBRATE)) ;
+    CHECK (calibrated) ;
+    CHECK (get_ratio (s) == 0.25) ;
+    CHECK (GB_AxB_tune_dot2_ratio ( ) == 0.25) ;
+
+    // the model is not loaded again once it has been calibrated
+    CHECK (write_tune_file (GxB_IMPLEMENTATION_MAJOR,
+        GxB_IMPLEMENTATION_MINOR, GxB_IMPLEMENTATION_SUB, 0.125, false)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNE_CALIBRATED,
+        (GrB_Field) GxB_AxB_TUNE)) ;
+    CHECK (get_ratio (s) == 0.25) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNE_OFF,
+        (GrB_Field) GxB_AxB_TUNE)) ;
+
+    // a file from another version, a corrupt file, a file with an invalid
+    // dot2_ratio, and a missing file are all ignored, and the cost model is
+    // calibrated and saved again
+    for (int kfile = 0 ; kfile < 5 ; kfile++)
+    {
+        switch (kfile)
+        {
+            case 0 : CHECK (write_tune_file (GxB_IMPLEMENTATION_MAJOR + 1,
+                GxB_IMPLEMENTATION_MINOR, GxB_IMPLEMENTATION_SUB, 0.25,
+                false)) ; break ;
+            case 1 : CHECK (write_tune_file (GxB_IMPLEMENTATION_MAJOR,
+                GxB_IMPLEMENTATION_MINOR, GxB_IMPLEMENTATION_SUB + 1, 0.25,
+                false)) ; break ;
+            case 2 : CHECK (write_tune_file (0, 0, 0, 0, true)) ; break ;
+            case 3 : CHECK (write_tune_file (GxB_IMPLEMENTATION_MAJOR,
+                GxB_IMPLEMENTATION_MINOR, GxB_IMPLEMENTATION_SUB, -2,
+                false)) ; break ;
+            default : remove (TUNE_FILE) ; break ;
+        }
+        GB_Global_axb_calibrated_set (false) ;
+        OK (GrB_Scalar_setElement_FP64 (s, 0.5)) ;
+        OK (GrB_Global_set_Scalar (GrB_GLOBAL, s,
+            (GrB_Field) GxB_AxB_DOT2_RATIO)) ;
+        OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNE_CALIBRATED,
+            (GrB_Field) GxB_AxB_TUNE)) ;
+        OK (GrB_Global_get_INT32 (GrB_GLOBAL, &calibrated,
+            (GrB_Field) GxB_AxB_CALIBRATE)) ;
+        CHECK (calibrated) ;
+        double ratio = get_ratio (s) ;
+        printf ("file %d: calibrated dot2_ratio %g\n", kfile, ratio) ;
+        CHECK (ratio > 0 && isfinite (ratio) && ratio != 0.25) ;
+        CHECK (check_tune_file (ratio)) ;
+    }
+
+    // GxB_AxB_CALIBRATE runs the calibration again, and saves the result
+    CHECK (write_tune_file (GxB_IMPLEMENTATION_MAJOR,
+        GxB_IMPLEMENTATION_MINOR, GxB_IMPLEMENTATION_SUB, 0.25, false)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, true,
+        (GrB_Field) GxB_AxB_CALIBRATE)) ;
+    CHECK (check_tune_file (get_ratio (s))) ;
+
+    //--------------------------------------------------------------------------
+    // online switching between dot2 and saxpy
+    //--------------------------------------------------------------------------
+
+    // shape classes are only used in the online mode
+    CHECK (GB_AxB_tune_class (1000, 1000, 1000) == -1) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNE_ONLINE,
+        (GrB_Field) GxB_AxB_TUNE)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &tune, (GrB_Field) GxB_AxB_TUNE)) ;
+    CHECK (tune == GxB_AxB_TUNE_ONLINE) ;
+    int tune_class = GB_AxB_tune_class (1000, 1000, 1000) ;
+    CHECK (tune_class >= 0) ;
+    CHECK (GB_AxB_tune_class (1000, 1000, 50) == -1) ;
+    CHECK (GB_AxB_tune_class (1, 1, 1e6) == -1) ;
+    CHECK (GB_AxB_tune_class (1e9, 1e9, 200) == -1) ;
+    CHECK (GB_AxB_tune_class (1000, 1000, 100000) !=
+        GB_AxB_tune_class (1000, 1000, 1000)) ;
+
+    for (int calibrated_choice = 0 ; calibrated_choice <= 1 ;
+        calibrated_choice++)
+    {
+        bool use_dot2 = (bool) calibrated_choice ;
+        GB_AxB_tune_clear ( ) ;
+        // warmup: the calibrated choice is used 3 times, then the other
+        for (int k = 0 ; k < 6 ; k++)
+        {
+            bool d = GB_AxB_tune_choose (tune_class, use_dot2) ;
+            CHECK (d == ((k < 3) ? use_dot2 : !use_dot2)) ;
+            // dot2 takes 1 second and saxpy takes 2
+            GB_AxB_tune_record (tune_class, d, 1000, d ? 1.0 : 2.0) ;
+        }
+        // dot2 is faster, so it is used from now on
+        for (int k = 0 ; k < 4 ; k++)
+        {
+            CHECK (GB_AxB_tune_choose (tune_class, use_dot2)) ;
+            GB_AxB_tune_record (tune_class, true, 1000, 1.0) ;
+        }
+        // the host changes, and dot2 becomes slower; once its mean run time
+        // exceeds that of saxpy, saxpy is used
+        int k ;
+        for (k = 0 ; k < 20 ; k++)
+        {
+            if (!GB_AxB_tune_choose (tune_class, use_dot2)) break ;
+            GB_AxB_tune_record (tune_class, true, 1000, 10.0) ;
+        }
+        CHECK (k > 0 && k < 20) ;
+        CHECK (!GB_AxB_tune_choose (tune_class, use_dot2)) ;
+        // other shape classes are not affected
+        int other = GB_AxB_tune_class (1000, 1000, 100000) ;
+        CHECK (GB_AxB_tune_choose (other, use_dot2) == use_dot2) ;
+        CHECK (GB_AxB_tune_choose (-1, use_dot2) == use_dot2) ;
+    }
+
+    // setting the online mode again keeps the statistics, but switching to it
+    // from another mode clears them
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNE_ONLINE,
+        (GrB_Field) GxB_AxB_TUNE)) ;
+    CHECK (!GB_AxB_tune_choose (tune_class, true)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNE_CALIBRATED,
+        (GrB_Field) GxB_AxB_TUNE)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNE_ONLINE,
+        (GrB_Field) GxB_AxB_TUNE)) ;
+    CHECK (GB_AxB_tune_choose (tune_class, true)) ;
+
+    //--------------------------------------------------------------------------
+    // C=A'*B with online tuning gives the same result as the fixed rule
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 2000 ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, n, 4)) ;
+    for (int k = 0 ; k < 8000 ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % n ;
+        GrB_Index j = simple_rand_i ( ) % n ;
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (k % 7), i, j)) ;
+    }
+    for (int k = 0 ; k < 40 ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % n ;
+        GrB_Index j = simple_rand_i ( ) % 4 ;
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (k % 5), i, j)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_set_INT32 (A, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (B, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNE_OFF,
+        (GrB_Field) GxB_AxB_TUNE)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, n, 4)) ;
+    OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+        GrB_DESC_T0)) ;
+    OK (GrB_Matrix_set_INT32 (C1, GxB_SPARSE,
+        (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNE_ONLINE,
+        (GrB_Field) GxB_AxB_TUNE)) ;
+    for (int trial = 0 ; trial < 12 ; trial++)
+    {
+        GrB_Matrix_free (&C2) ;
+        OK (GrB_Matrix_new (&C2, GrB_FP64, n, 4)) ;
+        OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            GrB_DESC_T0)) ;
+        OK (GrB_Matrix_set_INT32 (C2, GxB_SPARSE,
+            (GrB_Field) GxB_SPARSITY_CONTROL)) ;
+        OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, GxB_AxB_TUNE_OFF,
+        (GrB_Field) GxB_AxB_TUNE)) ;
+    remove (TUNE_FILE) ;
+    OK (GxB_set (GxB_JIT_CACHE_PATH, save_cache)) ;
+    GB_Global_axb_dot2_ratio_set (save_ratio) ;
+    GB_Global_axb_calibrated_set (save_calibrated) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test57: all tests passed\n\n") ;
+}
+
@@ -419,6 +419,18 @@ GrB_Semiring GB_mx_semiring         // semiring, or NULL if error
                         }
                         break ;
 
+                    case GB_BOR_binop_code  :
+
+                        switch (zcode)
+                        {
+                            case GB_UINT8_code  : return (GxB_BOR_FIRST_UINT8   ) ;
+                            case GB_UINT16_code : return (GxB_BOR_FIRST_UINT16  ) ;
+                            case GB_UINT32_code : return (GxB_BOR_FIRST_UINT32  ) ;
+                            case GB_UINT64_code : return (GxB_BOR_FIRST_UINT64  ) ;
+                            default  : ;
+                        }
+                        break ;
+
                     default : ;
                 }
                 break ;
@@ -518,6 +530,18 @@ GrB_Semiring GB_mx_semiring         // semiring, or NULL if error
                         }
                         break ;
 
+                    case GB_BOR_binop_code  :
+
+                        switch (zcode)
+                        {
+                            case GB_UINT8_code  : return (GxB_BOR_SECOND_UINT8  ) ;
+                            case GB_UINT16_code : return (GxB_BOR_SECOND_UINT16 ) ;
+                            case GB_UINT32_code : return (GxB_BOR_SECOND_UINT32 ) ;
+                            case GB_UINT64_code : return (GxB_BOR_SECOND_UINT64 ) ;
+                            default  : ;
+                        }
+                        break ;
+
                     default : ;
                 }
                 break ;
@@ -0,0 +1,8 @@
+function test289
+%TEST289 test GxB_mxm_select
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test40 ;
+fprintf ('test289: all tests passed\n') ;
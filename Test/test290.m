@@ -0,0 +1,8 @@
+function test290
+%TEST290 test saxpy6 vs dot2 for C=A*B with A full and few rows
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test41 ;
+fprintf ('test290: all tests passed\n') ;
@@ -0,0 +1,8 @@
+function test294
+%TEST294 test GxB_Matrix_serialize_stream and deserialize_stream
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test45 ;
+fprintf ('test294: all tests passed\n') ;
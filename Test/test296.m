@@ -0,0 +1,8 @@
+function test296
+%TEST296 test the checksums of a serialized blob
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test47 ;
+fprintf ('test296: all tests passed\n') ;
@@ -0,0 +1,8 @@
+function test298
+%TEST298 test GxB_Matrix_serialize_delta and deserialize_delta
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test48 ;
+fprintf ('test298: all tests passed\n') ;
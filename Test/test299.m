@@ -0,0 +1,8 @@
+function test299
+%TEST299 test GxB_Matrix_read_mtx, write_mtx, and read_edges
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test49 ;
+fprintf ('test299: all tests passed\n') ;
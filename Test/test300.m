@@ -0,0 +1,8 @@
+function test300
+%TEST300 test GxB_Matrix_export_Arrow and import_Arrow
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test50 ;
+fprintf ('test300: all tests passed\n') ;
@@ -0,0 +1,8 @@
+function test301
+%TEST301 test GxB_Matrix_import_borrowed
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test51 ;
+fprintf ('test301: all tests passed\n') ;
@@ -0,0 +1,8 @@
+function test302
+%TEST302 test concurrent setElement
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test52 ;
+fprintf ('test302: all tests passed\n') ;
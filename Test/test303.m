@@ -0,0 +1,8 @@
+function test303
+%TEST303 test setElements and extractElements
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test53 ;
+fprintf ('test303: all tests passed\n') ;
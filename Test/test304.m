@@ -0,0 +1,8 @@
+function test304
+%TEST304 test GB_wait_inplace
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test54 ;
+fprintf ('test304: all tests passed\n') ;
@@ -0,0 +1,8 @@
+function test305
+%TEST305 test background assembly of pending tuples
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test55 ;
+fprintf ('test305: all tests passed\n') ;
@@ -0,0 +1,8 @@
+function test306
+%TEST306 test combining pending tuples with a hash table
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test56 ;
+fprintf ('test306: all tests passed\n') ;
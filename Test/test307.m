@@ -0,0 +1,8 @@
+function test307
+%TEST307 test the calibrated and online selection of dot2 vs saxpy
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test57 ;
+fprintf ('test307: all tests passed\n') ;
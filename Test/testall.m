@@ -153,6 +153,26 @@ logstat ('test274'    ,t, J0   , F1   ) ; % index unary op get/set
 logstat ('test276'    ,t, J0   , F1   ) ; % semiring get/set
 logstat ('test277'    ,t, J0   , F1   ) ; % context get/set
 logstat ('test279'    ,t, J0   , F1   ) ; % blob get/set
+logstat ('test287'    ,t, J0   , F1   ) ; % saxpy3 tiled Gustavson
+logstat ('test288'    ,t, J40  , F10  ) ; % GxB_mxm_reduce
+logstat ('test289'    ,t, J40  , F10  ) ; % GxB_mxm_select
+logstat ('test290'    ,t, J0   , F1   ) ; % saxpy6 vs dot2
+logstat ('test291'    ,t, J0   , F1   ) ; % cached transpose
+logstat ('test292'    ,t, J0   , F1   ) ; % saxpy3 workspace
+logstat ('test293'    ,t, J0   , F1   ) ; % deserialize_mmap
+logstat ('test294'    ,t, J0   , F1   ) ; % serialize_stream
+logstat ('test295'    ,t, J0   , F1   ) ; % deserialize_range
+logstat ('test296'    ,t, J0   , F1   ) ; % blob checksums
+logstat ('test298'    ,t, J0   , F1   ) ; % serialize_delta
+logstat ('test299'    ,t, J0   , F1   ) ; % Matrix Market and edge lists
+logstat ('test300'    ,t, J0   , F1   ) ; % Arrow
+logstat ('test301'    ,t, J0   , F1   ) ; % import_borrowed
+logstat ('test302'    ,t, J0   , F1   ) ; % concurrent setElement
+logstat ('test303'    ,t, J0   , F1   ) ; % setElements
+logstat ('test304'    ,t, J0   , F1   ) ; % wait in place
+logstat ('test305'    ,t, J0   , F1   ) ; % background wait
+logstat ('test306'    ,t, J0   , F1   ) ; % pending combine
+logstat ('test307'    ,t, J0   , F1   ) ; % AxB tune
 logstat ('test281'    ,t, J4   , F1   ) ; % user-defined idx unop, no JIT
 logstat ('test268'    ,t, J40  , F10  ) ; % C<M>=Z sparse masker
 logstat ('test207'    ,t, J4   , F1   ) ; % iso subref
@@ -35,6 +35,8 @@ foreach ( PSRC ${PRE1} )
         list ( APPEND PREPRO "JIT_DO2N (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__AxB_dot3_" )
         list ( APPEND PREPRO "JIT_DOT3 (" ${F} ")\n" )
+    elseif ( ${F} MATCHES "^GB_jit__AxB_dot3r_" )
+        list ( APPEND PREPRO "JIT_DO3R (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__AxB_dot4_" )
         list ( APPEND PREPRO "JIT_DOT4 (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__AxB_saxbit" )